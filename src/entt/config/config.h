@@ -36,6 +36,36 @@
 #    define ENTT_MAYBE_ATOMIC(Type) Type
 #endif
 
+#ifdef ENTT_USE_PREFETCH
+#    if defined __clang__ || defined __GNUC__
+#        define ENTT_PREFETCH(addr) __builtin_prefetch(addr)
+#    endif
+#endif
+
+#ifndef ENTT_PREFETCH
+#    define ENTT_PREFETCH(addr) (void(0))
+#endif
+
+#ifndef ENTT_PROFILE_SCOPE
+#    ifdef ENTT_USE_PROFILER
+#        define ENTT_PROFILE_SCOPE_NAME(line) entt_profile_scope_##line
+#        define ENTT_PROFILE_SCOPE_LINE(line) ENTT_PROFILE_SCOPE_NAME(line)
+#        define ENTT_PROFILE_SCOPE(name) const ::entt::profile_scope ENTT_PROFILE_SCOPE_LINE(__LINE__){name}
+#    else
+#        define ENTT_PROFILE_SCOPE(name) (void(0))
+#    endif
+#endif
+
+#ifndef ENTT_SIGNAL_SCOPE
+#    ifdef ENTT_USE_SIGNAL_TRACER
+#        define ENTT_SIGNAL_SCOPE_NAME(line) entt_signal_scope_##line
+#        define ENTT_SIGNAL_SCOPE_LINE(line) ENTT_SIGNAL_SCOPE_NAME(line)
+#        define ENTT_SIGNAL_SCOPE(info, listeners) const ::entt::signal_scope ENTT_SIGNAL_SCOPE_LINE(__LINE__){info, listeners}
+#    else
+#        define ENTT_SIGNAL_SCOPE(info, listeners) (void(0))
+#    endif
+#endif
+
 #ifndef ENTT_ID_TYPE
 #    include <cstdint>
 #    define ENTT_ID_TYPE std::uint32_t
@@ -51,6 +81,22 @@
 #    define ENTT_PACKED_PAGE 1024
 #endif
 
+#ifndef ENTT_PACKED_PAGE_BYTES
+#    define ENTT_PACKED_PAGE_BYTES 0
+#endif
+
+#ifndef ENTT_SIGH_INLINE
+#    define ENTT_SIGH_INLINE 2
+#endif
+
+#ifndef ENTT_META_ANY_LENGTH
+#    define ENTT_META_ANY_LENGTH sizeof(double[2])
+#endif
+
+#ifndef ENTT_META_ANY_ALIGNMENT
+#    define ENTT_META_ANY_ALIGNMENT alignof(double[2])
+#endif
+
 #ifdef ENTT_DISABLE_ASSERT
 #    undef ENTT_ASSERT
 #    define ENTT_ASSERT(condition, msg) (void(0))
@@ -0,0 +1,435 @@
+#ifndef ENTT_CONTAINER_CONCURRENT_DENSE_MAP_HPP
+#define ENTT_CONTAINER_CONCURRENT_DENSE_MAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "../core/bit.hpp"
+#include "../core/compressed_pair.hpp"
+#include "../core/type_traits.hpp"
+#include "dense_map.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Associative container for key-value pairs with unique keys, for
+ * concurrent use.
+ *
+ * Elements are distributed over a number of shards, each of them a dense map
+ * with its own reader-writer lock. Threads that work on different shards never
+ * wait for each other and readers of the same shard don't either.<br/>
+ * Since elements can be inserted or erased at any time by other threads, the
+ * container doesn't offer iterators. Elements are accessed through function
+ * objects that are invoked while the shard is locked instead.
+ *
+ * @warning
+ * Accessing the container from within a function object invoked by the
+ * container itself results in undefined behavior.
+ *
+ * @tparam Key Key type of the associative container.
+ * @tparam Type Mapped type of the associative container.
+ * @tparam Hash Type of function to use to hash the keys.
+ * @tparam KeyEqual Type of function to use to compare the keys for equality.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Key, typename Type, typename Hash, typename KeyEqual, typename Allocator>
+class concurrent_dense_map {
+    using map_type = dense_map<Key, Type, Hash, KeyEqual, Allocator>;
+
+    struct shard_type {
+        shard_type(const Hash &hash, const KeyEqual &equal, const Allocator &allocator)
+            : map{0u, hash, equal, allocator} {}
+
+        mutable std::shared_mutex mutex;
+        map_type map;
+    };
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using shard_alloc = typename alloc_traits::template rebind_alloc<shard_type>;
+    using shard_traits = std::allocator_traits<shard_alloc>;
+
+    template<typename Other>
+    [[nodiscard]] shard_type &shard_of(const Other &key) const {
+        // uses the high bits of the hash, the low ones select the bucket within the shard
+        const auto value = static_cast<std::uint64_t>(shards.second()(key)) * 0x9E3779B97F4A7C15ull;
+        return shards.first()[static_cast<size_type>(value >> 32u) & (length - 1u)];
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Key type of the container. */
+    using key_type = Key;
+    /*! @brief Mapped type of the container. */
+    using mapped_type = Type;
+    /*! @brief Key-value type of the container. */
+    using value_type = std::pair<const Key, Type>;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Type of function to use to hash the keys. */
+    using hasher = Hash;
+    /*! @brief Type of function to use to compare the keys for equality. */
+    using key_equal = KeyEqual;
+
+    /*! @brief Default constructor. */
+    concurrent_dense_map()
+        : concurrent_dense_map{16u} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit concurrent_dense_map(const allocator_type &allocator)
+        : concurrent_dense_map{16u, hasher{}, key_equal{}, allocator} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator, hash
+     * function, compare function and user supplied number of shards.
+     *
+     * The number of shards is rounded up to the next power of two.
+     *
+     * @param cnt Number of shards, at least one.
+     * @param hash Hash function to use.
+     * @param equal Compare function to use.
+     * @param allocator The allocator to use.
+     */
+    explicit concurrent_dense_map(const size_type cnt, const hasher &hash = hasher{}, const key_equal &equal = key_equal{}, const allocator_type &allocator = allocator_type{})
+        : shards{nullptr, hash},
+          length{next_power_of_two(cnt)},
+          alloc{allocator} {
+        ENTT_ASSERT(cnt != 0u, "Invalid number of shards");
+        shard_alloc shard_allocator{alloc};
+        shards.first() = shard_traits::allocate(shard_allocator, length);
+
+        for(size_type pos{}; pos < length; ++pos) {
+            shard_traits::construct(shard_allocator, shards.first() + pos, hash, equal, alloc);
+        }
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    concurrent_dense_map(const concurrent_dense_map &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    concurrent_dense_map(concurrent_dense_map &&) = delete;
+
+    /*! @brief Destructor. */
+    ~concurrent_dense_map() {
+        shard_alloc shard_allocator{alloc};
+
+        for(size_type pos{}; pos < length; ++pos) {
+            shard_traits::destroy(shard_allocator, shards.first() + pos);
+        }
+
+        shard_traits::deallocate(shard_allocator, shards.first(), length);
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This container.
+     */
+    concurrent_dense_map &operator=(const concurrent_dense_map &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This container.
+     */
+    concurrent_dense_map &operator=(concurrent_dense_map &&) = delete;
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return alloc;
+    }
+
+    /**
+     * @brief Returns the number of shards.
+     * @return The number of shards.
+     */
+    [[nodiscard]] size_type shard_count() const noexcept {
+        return length;
+    }
+
+    /**
+     * @brief Checks whether a container is empty.
+     * @return True if the container is empty at the time of the call, false
+     * otherwise.
+     */
+    [[nodiscard]] bool empty() const {
+        for(size_type pos{}; pos < length; ++pos) {
+            if(const std::shared_lock guard{shards.first()[pos].mutex}; !shards.first()[pos].map.empty()) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Returns the number of elements in a container.
+     *
+     * Shards are visited one at a time. Therefore, the result may not reflect
+     * the state of the container at any given time if other threads are
+     * modifying it.
+     *
+     * @return Number of elements in a container.
+     */
+    [[nodiscard]] size_type size() const {
+        size_type count{};
+
+        for(size_type pos{}; pos < length; ++pos) {
+            const std::shared_lock guard{shards.first()[pos].mutex};
+            count += shards.first()[pos].map.size();
+        }
+
+        return count;
+    }
+
+    /*! @brief Clears the container. */
+    void clear() {
+        for(size_type pos{}; pos < length; ++pos) {
+            const std::lock_guard guard{shards.first()[pos].mutex};
+            shards.first()[pos].map.clear();
+        }
+    }
+
+    /**
+     * @brief Reserves space for at least the specified number of elements.
+     *
+     * Elements are assumed to be evenly distributed over the shards.
+     *
+     * @param cnt New number of elements.
+     */
+    void reserve(const size_type cnt) {
+        for(size_type pos{}; pos < length; ++pos) {
+            const std::lock_guard guard{shards.first()[pos].mutex};
+            shards.first()[pos].map.reserve(cnt / length + 1u);
+        }
+    }
+
+    /**
+     * @brief Inserts an element into the container, if the key does not exist.
+     * @param value A key-value pair eventually convertible to the value type.
+     * @return True if the insertion took place, false otherwise.
+     */
+    bool insert(const value_type &value) {
+        auto &shard = shard_of(value.first);
+        const std::lock_guard guard{shard.mutex};
+        return shard.map.insert(value).second;
+    }
+
+    /*! @copydoc insert */
+    bool insert(value_type &&value) {
+        auto &shard = shard_of(value.first);
+        const std::lock_guard guard{shard.mutex};
+        return shard.map.insert(std::move(value)).second;
+    }
+
+    /**
+     * @brief Inserts an element into the container or assigns to the current
+     * element if the key already exists.
+     * @tparam Arg Type of the value to insert or assign.
+     * @param key A key used both to look up and to insert if not found.
+     * @param value A value to insert or assign.
+     * @return True if the insertion took place, false otherwise.
+     */
+    template<typename Arg>
+    bool insert_or_assign(const key_type &key, Arg &&value) {
+        auto &shard = shard_of(key);
+        const std::lock_guard guard{shard.mutex};
+        return shard.map.insert_or_assign(key, std::forward<Arg>(value)).second;
+    }
+
+    /*! @copydoc insert_or_assign */
+    template<typename Arg>
+    bool insert_or_assign(key_type &&key, Arg &&value) {
+        auto &shard = shard_of(key);
+        const std::lock_guard guard{shard.mutex};
+        return shard.map.insert_or_assign(std::move(key), std::forward<Arg>(value)).second;
+    }
+
+    /**
+     * @brief Inserts in-place if the key does not exist, does nothing if the
+     * key exists.
+     * @tparam Args Types of arguments to forward to the constructor of the
+     * element.
+     * @param key A key used both to look up and to insert if not found.
+     * @param args Arguments to forward to the constructor of the element.
+     * @return True if the insertion took place, false otherwise.
+     */
+    template<typename... Args>
+    bool try_emplace(const key_type &key, Args &&...args) {
+        auto &shard = shard_of(key);
+        const std::lock_guard guard{shard.mutex};
+        return shard.map.try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    /*! @copydoc try_emplace */
+    template<typename... Args>
+    bool try_emplace(key_type &&key, Args &&...args) {
+        auto &shard = shard_of(key);
+        const std::lock_guard guard{shard.mutex};
+        return shard.map.try_emplace(std::move(key), std::forward<Args>(args)...).second;
+    }
+
+    /**
+     * @brief Removes the element associated with a given key.
+     * @param key A key value of an element to remove.
+     * @return Number of elements removed (either 0 or 1).
+     */
+    size_type erase(const key_type &key) {
+        auto &shard = shard_of(key);
+        const std::lock_guard guard{shard.mutex};
+        return shard.map.erase(key);
+    }
+
+    /**
+     * @brief Invokes a function object with the mapped value of a given key,
+     * if any.
+     *
+     * The shard of the element is locked for reading in the meantime. The
+     * signature of the function is equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const Type &);
+     * @endcode
+     *
+     * @tparam Func Type of function object to invoke.
+     * @param key Key value of an element to search for.
+     * @param func A valid function object.
+     * @return True if the element exists, false otherwise.
+     */
+    template<typename Func>
+    bool visit(const key_type &key, Func func) const {
+        const auto &shard = shard_of(key);
+        const std::shared_lock guard{shard.mutex};
+
+        if(const auto it = shard.map.find(key); it != shard.map.cend()) {
+            func(it->second);
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Invokes a function object with the mapped value of a given key,
+     * if any.
+     *
+     * The shard of the element is locked for writing in the meantime. The
+     * signature of the function is equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(Type &);
+     * @endcode
+     *
+     * @tparam Func Type of function object to invoke.
+     * @param key Key value of an element to search for.
+     * @param func A valid function object.
+     * @return True if the element exists, false otherwise.
+     */
+    template<typename Func>
+    bool visit(const key_type &key, Func func) {
+        auto &shard = shard_of(key);
+        const std::lock_guard guard{shard.mutex};
+
+        if(auto it = shard.map.find(key); it != shard.map.end()) {
+            func(it->second);
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Invokes a function object with all the elements of the container.
+     *
+     * Shards are locked for reading one at a time. The signature of the
+     * function is equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const Key &, const Type &);
+     * @endcode
+     *
+     * @tparam Func Type of function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        for(size_type pos{}; pos < length; ++pos) {
+            const std::shared_lock guard{shards.first()[pos].mutex};
+
+            for(auto [key, value]: shards.first()[pos].map) {
+                func(key, value);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements matching a key (either 1 or 0).
+     * @param key Key value of an element to search for.
+     * @return Number of elements matching the key (either 1 or 0).
+     */
+    [[nodiscard]] size_type count(const key_type &key) const {
+        return contains(key);
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a given key.
+     * @param key Key value of an element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    [[nodiscard]] bool contains(const key_type &key) const {
+        const auto &shard = shard_of(key);
+        const std::shared_lock guard{shard.mutex};
+        return shard.map.contains(key);
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a key that
+     * compares _equivalent_ to a given value.
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, bool>>
+    contains(const Other &key) const {
+        const auto &shard = shard_of(key);
+        const std::shared_lock guard{shard.mutex};
+        return shard.map.contains(key);
+    }
+
+    /**
+     * @brief Returns the function used to hash the keys.
+     * @return The function used to hash the keys.
+     */
+    [[nodiscard]] hasher hash_function() const {
+        return shards.second();
+    }
+
+    /**
+     * @brief Returns the function used to compare keys for equality.
+     * @return The function used to compare keys for equality.
+     */
+    [[nodiscard]] key_equal key_eq() const {
+        return shards.first()[0u].map.key_eq();
+    }
+
+private:
+    compressed_pair<shard_type *, hasher> shards;
+    size_type length;
+    allocator_type alloc;
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,815 @@
+#ifndef ENTT_CONTAINER_DENSE_HASH_MAP_HPP
+#define ENTT_CONTAINER_DENSE_HASH_MAP_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/bit.hpp"
+#include "../core/compressed_pair.hpp"
+#include "../core/type_traits.hpp"
+#include "dense_map.hpp"
+#include "fwd.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define ENTT_DENSE_HASH_MAP_SSE2
+#endif
+
+namespace entt {
+
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+inline constexpr std::size_t dense_hash_map_group = 16u;
+inline constexpr std::uint8_t dense_hash_map_empty = 0x80u;
+inline constexpr std::uint8_t dense_hash_map_deleted = 0xFEu;
+
+[[nodiscard]] inline std::uint32_t dense_hash_map_match(const std::uint8_t *group, const std::uint8_t value) noexcept {
+#ifdef ENTT_DENSE_HASH_MAP_SSE2
+    const auto ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(static_cast<char>(value)))));
+#else
+    std::uint32_t mask{};
+
+    for(std::size_t pos{}; pos < dense_hash_map_group; ++pos) {
+        mask |= static_cast<std::uint32_t>(group[pos] == value) << pos;
+    }
+
+    return mask;
+#endif
+}
+
+[[nodiscard]] inline std::uint32_t dense_hash_map_free(const std::uint8_t *group) noexcept {
+#ifdef ENTT_DENSE_HASH_MAP_SSE2
+    // both empty and deleted slots have the most significant bit set
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(group))));
+#else
+    std::uint32_t mask{};
+
+    for(std::size_t pos{}; pos < dense_hash_map_group; ++pos) {
+        mask |= static_cast<std::uint32_t>(group[pos] >> 7u) << pos;
+    }
+
+    return mask;
+#endif
+}
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Associative container for key-value pairs with unique keys, based on
+ * open addressing.
+ *
+ * Elements are stored in a packed array and iterated in the same order as with
+ * a dense map. However, the hash table is a flat array of one byte control
+ * codes, probed in groups of sixteen. Most lookups are resolved by a single
+ * group, that is, by one or two cache lines.<br/>
+ * Groups are compared with SSE2 instructions when available. A portable
+ * implementation is used otherwise.
+ *
+ * @tparam Key Key type of the associative container.
+ * @tparam Type Mapped type of the associative container.
+ * @tparam Hash Type of function to use to hash the keys.
+ * @tparam KeyEqual Type of function to use to compare the keys for equality.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Key, typename Type, typename Hash, typename KeyEqual, typename Allocator>
+class dense_hash_map {
+    static constexpr std::size_t group_width = internal::dense_hash_map_group;
+    static constexpr std::size_t minimum_capacity = group_width;
+    static constexpr std::size_t placeholder = (std::numeric_limits<std::size_t>::max)();
+
+    using node_type = internal::dense_map_node<Key, Type>;
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, std::pair<const Key, Type>>, "Invalid value type");
+    using sparse_container_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
+    using packed_container_type = std::vector<node_type, typename alloc_traits::template rebind_alloc<node_type>>;
+    using control_container_type = std::vector<std::uint8_t, typename alloc_traits::template rebind_alloc<std::uint8_t>>;
+
+    template<typename Other>
+    [[nodiscard]] std::size_t hash_of(const Other &key) const {
+        // spreads hash values that are poorly distributed, such as identifiers
+        const auto value = static_cast<std::uint64_t>(sparse.second()(key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<std::size_t>(value ^ (value >> 32u));
+    }
+
+    template<typename Other>
+    [[nodiscard]] std::size_t slot_of(const Other &key, const std::size_t hash) const {
+        const auto tag = static_cast<std::uint8_t>(hash & 0x7Fu);
+        const auto mask = (bucket_count() / group_width) - 1u;
+
+        for(std::size_t group = (hash >> 7u) & mask, step{};; group = (group + ++step) & mask) {
+            const auto *ctrl = control.data() + group * group_width;
+
+            for(auto bits = internal::dense_hash_map_match(ctrl, tag); bits; bits &= bits - 1u) {
+                if(const auto pos = group * group_width + static_cast<std::size_t>(countr_zero(bits)); packed.second()(packed.first()[sparse.first()[pos]].element.first, key)) {
+                    return pos;
+                }
+            }
+
+            if(internal::dense_hash_map_match(ctrl, internal::dense_hash_map_empty) != 0u) {
+                return placeholder;
+            }
+        }
+    }
+
+    template<typename Other>
+    [[nodiscard]] auto constrained_find(const Other &key) {
+        const auto pos = slot_of(key, hash_of(key));
+        return (pos == placeholder) ? end() : (begin() + static_cast<difference_type>(sparse.first()[pos]));
+    }
+
+    template<typename Other>
+    [[nodiscard]] auto constrained_find(const Other &key) const {
+        const auto pos = slot_of(key, hash_of(key));
+        return (pos == placeholder) ? cend() : (cbegin() + static_cast<difference_type>(sparse.first()[pos]));
+    }
+
+    void assign_slot(const std::size_t index, const std::size_t hash) {
+        const auto mask = (bucket_count() / group_width) - 1u;
+
+        for(std::size_t group = (hash >> 7u) & mask, step{};; group = (group + ++step) & mask) {
+            if(const auto bits = internal::dense_hash_map_free(control.data() + group * group_width); bits != 0u) {
+                const auto pos = group * group_width + static_cast<std::size_t>(countr_zero(bits));
+                deleted -= (control[pos] == internal::dense_hash_map_deleted);
+                control[pos] = static_cast<std::uint8_t>(hash & 0x7Fu);
+                sparse.first()[pos] = index;
+                packed.first()[index].next = pos;
+                return;
+            }
+        }
+    }
+
+    void rehash_if_required() {
+        // at least one empty slot per probe sequence keeps lookups bounded
+        if(const auto bc = bucket_count(); (size() + deleted + 1u) * 8u > bc * 7u) {
+            // tombstones are purged without growing if they are the problem
+            (size() * 32u <= bc * 25u) ? rebuild(bc) : rehash(bc * 2u);
+        }
+    }
+
+    void rebuild(const std::size_t cnt) {
+        control.assign(cnt, internal::dense_hash_map_empty);
+        sparse.first().resize(cnt);
+        deleted = 0u;
+
+        for(std::size_t pos{}, last = size(); pos < last; ++pos) {
+            assign_slot(pos, hash_of(packed.first()[pos].element.first));
+        }
+    }
+
+    template<typename Other, typename... Args>
+    [[nodiscard]] auto insert_or_do_nothing(Other &&key, Args &&...args) {
+        if(auto it = constrained_find(key); it != end()) {
+            return std::make_pair(it, false);
+        }
+
+        rehash_if_required();
+        const auto hash = hash_of(key);
+        packed.first().emplace_back(placeholder, std::piecewise_construct, std::forward_as_tuple(std::forward<Other>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        assign_slot(size() - 1u, hash);
+
+        return std::make_pair(--end(), true);
+    }
+
+    template<typename Other, typename Arg>
+    [[nodiscard]] auto insert_or_overwrite(Other &&key, Arg &&value) {
+        if(auto it = constrained_find(key); it != end()) {
+            it->second = std::forward<Arg>(value);
+            return std::make_pair(it, false);
+        }
+
+        rehash_if_required();
+        const auto hash = hash_of(key);
+        packed.first().emplace_back(placeholder, std::forward<Other>(key), std::forward<Arg>(value));
+        assign_slot(size() - 1u, hash);
+
+        return std::make_pair(--end(), true);
+    }
+
+    void erase_slot(const std::size_t pos) {
+        // a group with an empty slot ends all probe sequences, no tombstone is required
+        if(internal::dense_hash_map_match(control.data() + (pos / group_width) * group_width, internal::dense_hash_map_empty) != 0u) {
+            control[pos] = internal::dense_hash_map_empty;
+        } else {
+            control[pos] = internal::dense_hash_map_deleted;
+            ++deleted;
+        }
+
+        if(const auto index = sparse.first()[pos], last = size() - 1u; index != last) {
+            packed.first()[index] = std::move(packed.first().back());
+            sparse.first()[packed.first()[index].next] = index;
+        }
+
+        packed.first().pop_back();
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Key type of the container. */
+    using key_type = Key;
+    /*! @brief Mapped type of the container. */
+    using mapped_type = Type;
+    /*! @brief Key-value type of the container. */
+    using value_type = std::pair<const Key, Type>;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Signed integer type. */
+    using difference_type = std::ptrdiff_t;
+    /*! @brief Type of function to use to hash the keys. */
+    using hasher = Hash;
+    /*! @brief Type of function to use to compare the keys for equality. */
+    using key_equal = KeyEqual;
+    /*! @brief Input iterator type. */
+    using iterator = internal::dense_map_iterator<typename packed_container_type::iterator>;
+    /*! @brief Constant input iterator type. */
+    using const_iterator = internal::dense_map_iterator<typename packed_container_type::const_iterator>;
+
+    /*! @brief Default constructor. */
+    dense_hash_map()
+        : dense_hash_map{minimum_capacity} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit dense_hash_map(const allocator_type &allocator)
+        : dense_hash_map{minimum_capacity, hasher{}, key_equal{}, allocator} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator and user
+     * supplied minimal number of slots.
+     * @param cnt Minimal number of slots.
+     * @param allocator The allocator to use.
+     */
+    dense_hash_map(const size_type cnt, const allocator_type &allocator)
+        : dense_hash_map{cnt, hasher{}, key_equal{}, allocator} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator, hash
+     * function and user supplied minimal number of slots.
+     * @param cnt Minimal number of slots.
+     * @param hash Hash function to use.
+     * @param allocator The allocator to use.
+     */
+    dense_hash_map(const size_type cnt, const hasher &hash, const allocator_type &allocator)
+        : dense_hash_map{cnt, hash, key_equal{}, allocator} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator, hash
+     * function, compare function and user supplied minimal number of slots.
+     * @param cnt Minimal number of slots.
+     * @param hash Hash function to use.
+     * @param equal Compare function to use.
+     * @param allocator The allocator to use.
+     */
+    explicit dense_hash_map(const size_type cnt, const hasher &hash = hasher{}, const key_equal &equal = key_equal{}, const allocator_type &allocator = allocator_type{})
+        : sparse{allocator, hash},
+          packed{allocator, equal},
+          control{allocator} {
+        rehash(cnt);
+    }
+
+    /*! @brief Default copy constructor. */
+    dense_hash_map(const dense_hash_map &) = default;
+
+    /**
+     * @brief Allocator-extended copy constructor.
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    dense_hash_map(const dense_hash_map &other, const allocator_type &allocator)
+        : sparse{std::piecewise_construct, std::forward_as_tuple(other.sparse.first(), allocator), std::forward_as_tuple(other.sparse.second())},
+          packed{std::piecewise_construct, std::forward_as_tuple(other.packed.first(), allocator), std::forward_as_tuple(other.packed.second())},
+          control{other.control, allocator},
+          deleted{other.deleted} {}
+
+    /*! @brief Default move constructor. */
+    dense_hash_map(dense_hash_map &&) noexcept = default;
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    dense_hash_map(dense_hash_map &&other, const allocator_type &allocator)
+        : sparse{std::piecewise_construct, std::forward_as_tuple(std::move(other.sparse.first()), allocator), std::forward_as_tuple(std::move(other.sparse.second()))},
+          packed{std::piecewise_construct, std::forward_as_tuple(std::move(other.packed.first()), allocator), std::forward_as_tuple(std::move(other.packed.second()))},
+          control{std::move(other.control), allocator},
+          deleted{other.deleted} {}
+
+    /*! @brief Default destructor. */
+    ~dense_hash_map() = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     * @return This container.
+     */
+    dense_hash_map &operator=(const dense_hash_map &) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This container.
+     */
+    dense_hash_map &operator=(dense_hash_map &&) noexcept = default;
+
+    /**
+     * @brief Exchanges the contents with those of a given container.
+     * @param other Container to exchange the content with.
+     */
+    void swap(dense_hash_map &other) noexcept {
+        using std::swap;
+        swap(sparse, other.sparse);
+        swap(packed, other.packed);
+        swap(control, other.control);
+        swap(deleted, other.deleted);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return sparse.first().get_allocator();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * If the array is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first instance of the internal array.
+     */
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        return packed.first().begin();
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() noexcept {
+        return packed.first().begin();
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * internal array.
+     */
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return packed.first().end();
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const noexcept {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() noexcept {
+        return packed.first().end();
+    }
+
+    /**
+     * @brief Checks whether a container is empty.
+     * @return True if the container is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return packed.first().empty();
+    }
+
+    /**
+     * @brief Returns the number of elements in a container.
+     * @return Number of elements in a container.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return packed.first().size();
+    }
+
+    /**
+     * @brief Returns the maximum possible number of elements.
+     * @return Maximum possible number of elements.
+     */
+    [[nodiscard]] size_type max_size() const noexcept {
+        return packed.first().max_size();
+    }
+
+    /*! @brief Clears the container. */
+    void clear() noexcept {
+        packed.first().clear();
+        rebuild(minimum_capacity);
+    }
+
+    /**
+     * @brief Inserts an element into the container, if the key does not exist.
+     * @param value A key-value pair eventually convertible to the value type.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    std::pair<iterator, bool> insert(const value_type &value) {
+        return insert_or_do_nothing(value.first, value.second);
+    }
+
+    /*! @copydoc insert */
+    std::pair<iterator, bool> insert(value_type &&value) {
+        return insert_or_do_nothing(std::move(value.first), std::move(value.second));
+    }
+
+    /**
+     * @copydoc insert
+     * @tparam Arg Type of the key-value pair to insert into the container.
+     */
+    template<typename Arg>
+    std::enable_if_t<std::is_constructible_v<value_type, Arg &&>, std::pair<iterator, bool>>
+    insert(Arg &&value) {
+        return insert_or_do_nothing(std::forward<Arg>(value).first, std::forward<Arg>(value).second);
+    }
+
+    /**
+     * @brief Inserts elements into the container, if their keys do not exist.
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of elements.
+     * @param last An iterator past the last element of the range of elements.
+     */
+    template<typename It>
+    void insert(It first, It last) {
+        for(; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    /**
+     * @brief Inserts an element into the container or assigns to the current
+     * element if the key already exists.
+     * @tparam Arg Type of the value to insert or assign.
+     * @param key A key used both to look up and to insert if not found.
+     * @param value A value to insert or assign.
+     * @return A pair consisting of an iterator to the element and a bool
+     * denoting whether the insertion took place.
+     */
+    template<typename Arg>
+    std::pair<iterator, bool> insert_or_assign(const key_type &key, Arg &&value) {
+        return insert_or_overwrite(key, std::forward<Arg>(value));
+    }
+
+    /*! @copydoc insert_or_assign */
+    template<typename Arg>
+    std::pair<iterator, bool> insert_or_assign(key_type &&key, Arg &&value) {
+        return insert_or_overwrite(std::move(key), std::forward<Arg>(value));
+    }
+
+    /**
+     * @brief Constructs an element in-place, if the key does not exist.
+     *
+     * The element is also constructed when the container already has the key,
+     * in which case the newly constructed object is destroyed immediately.
+     *
+     * @tparam Args Types of arguments to forward to the constructor of the
+     * element.
+     * @param args Arguments to forward to the constructor of the element.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> emplace([[maybe_unused]] Args &&...args) {
+        if constexpr(sizeof...(Args) == 0u) {
+            return insert_or_do_nothing(key_type{});
+        } else if constexpr(sizeof...(Args) == 1u) {
+            return insert_or_do_nothing(std::forward<Args>(args).first..., std::forward<Args>(args).second...);
+        } else if constexpr(sizeof...(Args) == 2u) {
+            return insert_or_do_nothing(std::forward<Args>(args)...);
+        } else {
+            rehash_if_required();
+            auto &node = packed.first().emplace_back(placeholder, std::forward<Args>(args)...);
+            const auto hash = hash_of(node.element.first);
+
+            if(const auto pos = slot_of(node.element.first, hash); pos != placeholder) {
+                packed.first().pop_back();
+                return std::make_pair(begin() + static_cast<difference_type>(sparse.first()[pos]), false);
+            }
+
+            assign_slot(size() - 1u, hash);
+            return std::make_pair(--end(), true);
+        }
+    }
+
+    /**
+     * @brief Inserts in-place if the key does not exist, does nothing if the
+     * key exists.
+     * @tparam Args Types of arguments to forward to the constructor of the
+     * element.
+     * @param key A key used both to look up and to insert if not found.
+     * @param args Arguments to forward to the constructor of the element.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+        return insert_or_do_nothing(key, std::forward<Args>(args)...);
+    }
+
+    /*! @copydoc try_emplace */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+        return insert_or_do_nothing(std::move(key), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Removes an element from a given position.
+     * @param pos An iterator to the element to remove.
+     * @return An iterator following the removed element.
+     */
+    iterator erase(const_iterator pos) {
+        const auto diff = pos - cbegin();
+        erase(pos->first);
+        return begin() + diff;
+    }
+
+    /**
+     * @brief Removes the given elements from a container.
+     * @param first An iterator to the first element of the range of elements.
+     * @param last An iterator past the last element of the range of elements.
+     * @return An iterator following the last removed element.
+     */
+    iterator erase(const_iterator first, const_iterator last) {
+        const auto dist = first - cbegin();
+
+        for(auto from = last - cbegin(); from != dist; --from) {
+            erase_slot(packed.first()[static_cast<size_type>(from) - 1u].next);
+        }
+
+        return (begin() + dist);
+    }
+
+    /**
+     * @brief Removes the element associated with a given key.
+     * @param key A key value of an element to remove.
+     * @return Number of elements removed (either 0 or 1).
+     */
+    size_type erase(const key_type &key) {
+        if(const auto pos = slot_of(key, hash_of(key)); pos != placeholder) {
+            erase_slot(pos);
+            return 1u;
+        }
+
+        return 0u;
+    }
+
+    /**
+     * @brief Accesses a given element with bounds checking.
+     * @param key A key of an element to find.
+     * @return A reference to the mapped value of the requested element.
+     */
+    [[nodiscard]] mapped_type &at(const key_type &key) {
+        auto it = find(key);
+        ENTT_ASSERT(it != end(), "Invalid key");
+        return it->second;
+    }
+
+    /*! @copydoc at */
+    [[nodiscard]] const mapped_type &at(const key_type &key) const {
+        auto it = find(key);
+        ENTT_ASSERT(it != cend(), "Invalid key");
+        return it->second;
+    }
+
+    /**
+     * @brief Accesses or inserts a given element.
+     * @param key A key of an element to find or insert.
+     * @return A reference to the mapped value of the requested element.
+     */
+    [[nodiscard]] mapped_type &operator[](const key_type &key) {
+        return insert_or_do_nothing(key).first->second;
+    }
+
+    /**
+     * @brief Accesses or inserts a given element.
+     * @param key A key of an element to find or insert.
+     * @return A reference to the mapped value of the requested element.
+     */
+    [[nodiscard]] mapped_type &operator[](key_type &&key) {
+        return insert_or_do_nothing(std::move(key)).first->second;
+    }
+
+    /**
+     * @brief Returns the number of elements matching a key (either 1 or 0).
+     * @param key Key value of an element to search for.
+     * @return Number of elements matching the key (either 1 or 0).
+     */
+    [[nodiscard]] size_type count(const key_type &key) const {
+        return find(key) != end();
+    }
+
+    /**
+     * @brief Returns the number of elements matching a key (either 1 or 0).
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @return Number of elements matching the key (either 1 or 0).
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, size_type>>
+    count(const Other &key) const {
+        return find(key) != end();
+    }
+
+    /**
+     * @brief Finds an element with a given key.
+     * @param key Key value of an element to search for.
+     * @return An iterator to an element with the given key. If no such element
+     * is found, a past-the-end iterator is returned.
+     */
+    [[nodiscard]] iterator find(const key_type &key) {
+        return constrained_find(key);
+    }
+
+    /*! @copydoc find */
+    [[nodiscard]] const_iterator find(const key_type &key) const {
+        return constrained_find(key);
+    }
+
+    /**
+     * @brief Finds an element with a key that compares _equivalent_ to a given
+     * key.
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @return An iterator to an element with the given key. If no such element
+     * is found, a past-the-end iterator is returned.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, iterator>>
+    find(const Other &key) {
+        return constrained_find(key);
+    }
+
+    /*! @copydoc find */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, const_iterator>>
+    find(const Other &key) const {
+        return constrained_find(key);
+    }
+
+    /**
+     * @brief Returns a range containing all elements with a given key.
+     * @param key Key value of an element to search for.
+     * @return A pair of iterators pointing to the first element and past the
+     * last element of the range.
+     */
+    [[nodiscard]] std::pair<iterator, iterator> equal_range(const key_type &key) {
+        const auto it = find(key);
+        return {it, it + !(it == end())};
+    }
+
+    /*! @copydoc equal_range */
+    [[nodiscard]] std::pair<const_iterator, const_iterator> equal_range(const key_type &key) const {
+        const auto it = find(key);
+        return {it, it + !(it == cend())};
+    }
+
+    /**
+     * @brief Returns a range containing all elements that compare _equivalent_
+     * to a given key.
+     * @tparam Other Type of an element to search for.
+     * @param key Key value of an element to search for.
+     * @return A pair of iterators pointing to the first element and past the
+     * last element of the range.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, std::pair<iterator, iterator>>>
+    equal_range(const Other &key) {
+        const auto it = find(key);
+        return {it, it + !(it == end())};
+    }
+
+    /*! @copydoc equal_range */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, std::pair<const_iterator, const_iterator>>>
+    equal_range(const Other &key) const {
+        const auto it = find(key);
+        return {it, it + !(it == cend())};
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a given key.
+     * @param key Key value of an element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    [[nodiscard]] bool contains(const key_type &key) const {
+        return (find(key) != cend());
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a key that
+     * compares _equivalent_ to a given value.
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, bool>>
+    contains(const Other &key) const {
+        return (find(key) != cend());
+    }
+
+    /**
+     * @brief Returns the number of slots of the hash table.
+     * @return The number of slots of the hash table.
+     */
+    [[nodiscard]] size_type bucket_count() const {
+        return control.size();
+    }
+
+    /**
+     * @brief Returns the maximum number of slots of the hash table.
+     * @return The maximum number of slots of the hash table.
+     */
+    [[nodiscard]] size_type max_bucket_count() const {
+        return sparse.first().max_size();
+    }
+
+    /**
+     * @brief Returns the ratio between elements and slots.
+     * @return The ratio between elements and slots.
+     */
+    [[nodiscard]] float load_factor() const {
+        return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+    /**
+     * @brief Returns the maximum ratio between elements and slots.
+     *
+     * The value is fixed for this type of container, since all probe sequences
+     * must find an empty slot sooner or later.
+     *
+     * @return The maximum ratio between elements and slots.
+     */
+    [[nodiscard]] float max_load_factor() const {
+        return 0.875f;
+    }
+
+    /**
+     * @brief Reserves at least the specified number of slots and regenerates
+     * the hash table.
+     * @param cnt New number of slots.
+     */
+    void rehash(const size_type cnt) {
+        auto value = cnt > minimum_capacity ? cnt : minimum_capacity;
+        const auto cap = (size() * 8u) / 7u + 1u;
+        value = value > cap ? value : cap;
+
+        if(const auto sz = next_power_of_two(value); sz != bucket_count()) {
+            rebuild(sz);
+        }
+    }
+
+    /**
+     * @brief Reserves space for at least the specified number of elements and
+     * regenerates the hash table.
+     * @param cnt New number of elements.
+     */
+    void reserve(const size_type cnt) {
+        packed.first().reserve(cnt);
+        rehash((cnt * 8u) / 7u + 1u);
+    }
+
+    /**
+     * @brief Returns the function used to hash the keys.
+     * @return The function used to hash the keys.
+     */
+    [[nodiscard]] hasher hash_function() const {
+        return sparse.second();
+    }
+
+    /**
+     * @brief Returns the function used to compare keys for equality.
+     * @return The function used to compare keys for equality.
+     */
+    [[nodiscard]] key_equal key_eq() const {
+        return packed.second();
+    }
+
+private:
+    compressed_pair<sparse_container_type, hasher> sparse;
+    compressed_pair<packed_container_type, key_equal> packed;
+    control_container_type control;
+    size_type deleted{};
+};
+
+} // namespace entt
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef ENTT_CONTAINER_DENSE_MAP_HPP
 #define ENTT_CONTAINER_DENSE_MAP_HPP
 
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <functional>
@@ -295,6 +296,32 @@ class dense_map {
         return cend();
     }
 
+    template<typename It, typename Func>
+    void batched_find(It first, It last, Func func) const {
+        static constexpr std::size_t batch = 16u;
+        std::array<size_type, batch> bucket{};
+
+        while(first != last) {
+            auto from = first;
+            size_type length{};
+
+            for(; length < batch && first != last; ++first, ++length) {
+                bucket[length] = key_to_bucket(*first);
+                ENTT_PREFETCH(&sparse.first()[bucket[length]]);
+            }
+
+            for(size_type pos{}; pos < length; ++pos) {
+                if(const auto head = sparse.first()[bucket[pos]]; head != (std::numeric_limits<size_type>::max)()) {
+                    ENTT_PREFETCH(&packed.first()[head]);
+                }
+            }
+
+            for(size_type pos{}; pos < length; ++pos, ++from) {
+                func(constrained_find(*from, bucket[pos]));
+            }
+        }
+    }
+
     template<typename Other, typename... Args>
     [[nodiscard]] auto insert_or_do_nothing(Other &&key, Args &&...args) {
         const auto index = key_to_bucket(key);
@@ -800,6 +827,35 @@ public:
         return constrained_find(key, key_to_bucket(key));
     }
 
+    /**
+     * @brief Finds the elements associated with a range of keys.
+     *
+     * Lookups are performed in batches. The buckets of all the keys of a batch
+     * are computed and prefetched first, then the chains are resolved. This
+     * hides the latency of independent cache misses rather than serializing
+     * them.
+     *
+     * @tparam It Type of forward iterator.
+     * @tparam Out Type of output iterator.
+     * @param first An iterator to the first key of the range.
+     * @param last An iterator past the last key of the range.
+     * @param out An output iterator for the results. A past-the-end iterator is
+     * returned for each key that isn't found.
+     * @return The output iterator past the last result.
+     */
+    template<typename It, typename Out>
+    Out find_many(It first, It last, Out out) {
+        batched_find(first, last, [this, &out](const const_iterator it) { *out++ = begin() + (it - cbegin()); });
+        return out;
+    }
+
+    /*! @copydoc find_many */
+    template<typename It, typename Out>
+    Out find_many(It first, It last, Out out) const {
+        batched_find(first, last, [&out](const const_iterator it) { *out++ = it; });
+        return out;
+    }
+
     /**
      * @brief Returns a range containing all elements with a given key.
      * @param key Key value of an element to search for.
@@ -1010,6 +1066,16 @@ public:
         rehash(static_cast<size_type>(std::ceil(static_cast<float>(cnt) / max_load_factor())));
     }
 
+    /**
+     * @brief Requests the removal of unused capacity and regenerates the hash
+     * table with the minimum number of buckets.
+     */
+    void shrink_to_fit() {
+        packed.first().shrink_to_fit();
+        rehash(0u);
+        sparse.first().shrink_to_fit();
+    }
+
     /**
      * @brief Returns the function used to hash the keys.
      * @return The function used to hash the keys.
@@ -1,6 +1,7 @@
 #ifndef ENTT_CONTAINER_DENSE_SET_HPP
 #define ENTT_CONTAINER_DENSE_SET_HPP
 
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <functional>
@@ -254,6 +255,32 @@ class dense_set {
         return cend();
     }
 
+    template<typename It, typename Func>
+    void batched_find(It first, It last, Func func) const {
+        static constexpr std::size_t batch = 16u;
+        std::array<size_type, batch> bucket{};
+
+        while(first != last) {
+            auto from = first;
+            size_type length{};
+
+            for(; length < batch && first != last; ++first, ++length) {
+                bucket[length] = value_to_bucket(*first);
+                ENTT_PREFETCH(&sparse.first()[bucket[length]]);
+            }
+
+            for(size_type pos{}; pos < length; ++pos) {
+                if(const auto head = sparse.first()[bucket[pos]]; head != (std::numeric_limits<size_type>::max)()) {
+                    ENTT_PREFETCH(&packed.first()[head]);
+                }
+            }
+
+            for(size_type pos{}; pos < length; ++pos, ++from) {
+                func(constrained_find(*from, bucket[pos]));
+            }
+        }
+    }
+
     template<typename Other>
     [[nodiscard]] auto insert_or_do_nothing(Other &&value) {
         const auto index = value_to_bucket(value);
@@ -692,6 +719,35 @@ public:
         return constrained_find(value, value_to_bucket(value));
     }
 
+    /**
+     * @brief Finds the elements associated with a range of values.
+     *
+     * Lookups are performed in batches. The buckets of all the values of a batch
+     * are computed and prefetched first, then the chains are resolved. This
+     * hides the latency of independent cache misses rather than serializing
+     * them.
+     *
+     * @tparam It Type of forward iterator.
+     * @tparam Out Type of output iterator.
+     * @param first An iterator to the first value of the range.
+     * @param last An iterator past the last value of the range.
+     * @param out An output iterator for the results. A past-the-end iterator is
+     * returned for each value that isn't found.
+     * @return The output iterator past the last result.
+     */
+    template<typename It, typename Out>
+    Out find_many(It first, It last, Out out) {
+        batched_find(first, last, [this, &out](const const_iterator it) { *out++ = begin() + (it - cbegin()); });
+        return out;
+    }
+
+    /*! @copydoc find_many */
+    template<typename It, typename Out>
+    Out find_many(It first, It last, Out out) const {
+        batched_find(first, last, [&out](const const_iterator it) { *out++ = it; });
+        return out;
+    }
+
     /**
      * @brief Returns a range containing all elements with a given value.
      * @param value Value of an element to search for.
@@ -902,6 +958,16 @@ public:
         rehash(static_cast<size_type>(std::ceil(static_cast<float>(cnt) / max_load_factor())));
     }
 
+    /**
+     * @brief Requests the removal of unused capacity and regenerates the hash
+     * table with the minimum number of buckets.
+     */
+    void shrink_to_fit() {
+        packed.first().shrink_to_fit();
+        rehash(0u);
+        sparse.first().shrink_to_fit();
+    }
+
     /**
      * @brief Returns the function used to hash the elements.
      * @return The function used to hash the elements.
@@ -1,10 +1,12 @@
 #ifndef ENTT_CONTAINER_FWD_HPP
 #define ENTT_CONTAINER_FWD_HPP
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
+#include "../config/config.h"
 
 namespace entt {
 
@@ -16,6 +18,22 @@ template<
     typename = std::allocator<std::pair<const Key, Type>>>
 class dense_map;
 
+template<
+    typename Key,
+    typename Type,
+    typename = std::hash<Key>,
+    typename = std::equal_to<>,
+    typename = std::allocator<std::pair<const Key, Type>>>
+class dense_hash_map;
+
+template<
+    typename Key,
+    typename Type,
+    typename = std::hash<Key>,
+    typename = std::equal_to<>,
+    typename = std::allocator<std::pair<const Key, Type>>>
+class concurrent_dense_map;
+
 template<
     typename Type,
     typename = std::hash<Type>,
@@ -23,6 +41,21 @@ template<
     typename = std::allocator<Type>>
 class dense_set;
 
+template<
+    typename Key,
+    typename Type,
+    std::size_t N,
+    typename = std::hash<Key>,
+    typename = std::equal_to<>,
+    typename = std::allocator<std::pair<const Key, Type>>>
+class small_dense_map;
+
+template<
+    typename Type,
+    std::size_t = ENTT_PACKED_PAGE,
+    typename = std::allocator<Type>>
+class paged_vector;
+
 template<typename...>
 class basic_table;
 
@@ -0,0 +1,592 @@
+#ifndef ENTT_CONTAINER_PAGED_VECTOR_HPP
+#define ENTT_CONTAINER_PAGED_VECTOR_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/bit.hpp"
+#include "../core/memory.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+template<std::size_t Page, typename Container>
+[[nodiscard]] constexpr auto &paged_vector_element(const Container &pages, const std::size_t pos) noexcept {
+    return pages[pos / Page][fast_mod(pos, Page)];
+}
+
+template<std::size_t Page, typename Container, typename Allocator>
+auto paged_vector_assure(Container &pages, Allocator &allocator, const std::size_t pos) {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    const auto idx = pos / Page;
+
+    if(!(idx < pages.size())) {
+        auto curr = pages.size();
+        pages.resize(idx + 1u, nullptr);
+
+        ENTT_TRY {
+            for(const auto last = pages.size(); curr < last; ++curr) {
+                pages[curr] = alloc_traits::allocate(allocator, Page);
+            }
+        }
+        ENTT_CATCH {
+            pages.resize(curr);
+            ENTT_THROW;
+        }
+    }
+
+    return pages[idx] + fast_mod(pos, Page);
+}
+
+template<std::size_t Page, typename Container, typename Allocator>
+void paged_vector_release(Container &pages, Allocator &allocator, const std::size_t sz) {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    const auto from = (sz + Page - 1u) / Page;
+
+    for(auto pos = from, last = pages.size(); pos < last; ++pos) {
+        alloc_traits::deallocate(allocator, pages[pos], Page);
+    }
+
+    pages.resize(from);
+}
+
+template<typename Container, std::size_t Page>
+class paged_vector_iterator final {
+    friend paged_vector_iterator<const Container, Page>;
+
+    using container_type = std::remove_const_t<Container>;
+    using alloc_traits = std::allocator_traits<typename container_type::allocator_type>;
+
+    using iterator_traits = std::iterator_traits<std::conditional_t<
+        std::is_const_v<Container>,
+        typename alloc_traits::template rebind_traits<typename std::pointer_traits<typename container_type::value_type>::element_type>::const_pointer,
+        typename alloc_traits::template rebind_traits<typename std::pointer_traits<typename container_type::value_type>::element_type>::pointer>>;
+
+public:
+    using value_type = typename iterator_traits::value_type;
+    using pointer = typename iterator_traits::pointer;
+    using reference = typename iterator_traits::reference;
+    using difference_type = typename iterator_traits::difference_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    constexpr paged_vector_iterator() noexcept = default;
+
+    constexpr paged_vector_iterator(Container *ref, const difference_type idx) noexcept
+        : payload{ref},
+          offset{idx} {}
+
+    template<bool Const = std::is_const_v<Container>, typename = std::enable_if_t<Const>>
+    constexpr paged_vector_iterator(const paged_vector_iterator<std::remove_const_t<Container>, Page> &other) noexcept
+        : paged_vector_iterator{other.payload, other.offset} {}
+
+    constexpr paged_vector_iterator &operator++() noexcept {
+        return ++offset, *this;
+    }
+
+    constexpr paged_vector_iterator operator++(int) noexcept {
+        const paged_vector_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    constexpr paged_vector_iterator &operator--() noexcept {
+        return --offset, *this;
+    }
+
+    constexpr paged_vector_iterator operator--(int) noexcept {
+        const paged_vector_iterator orig = *this;
+        return operator--(), orig;
+    }
+
+    constexpr paged_vector_iterator &operator+=(const difference_type value) noexcept {
+        offset += value;
+        return *this;
+    }
+
+    constexpr paged_vector_iterator operator+(const difference_type value) const noexcept {
+        paged_vector_iterator copy = *this;
+        return (copy += value);
+    }
+
+    constexpr paged_vector_iterator &operator-=(const difference_type value) noexcept {
+        return (*this += -value);
+    }
+
+    constexpr paged_vector_iterator operator-(const difference_type value) const noexcept {
+        return (*this + -value);
+    }
+
+    [[nodiscard]] constexpr reference operator[](const difference_type value) const noexcept {
+        return paged_vector_element<Page>(*payload, static_cast<std::size_t>(offset + value));
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept {
+        return std::addressof(operator[](0));
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+        return operator[](0);
+    }
+
+    [[nodiscard]] constexpr difference_type index() const noexcept {
+        return offset;
+    }
+
+private:
+    Container *payload;
+    difference_type offset;
+};
+
+template<typename Lhs, typename Rhs, std::size_t Page>
+[[nodiscard]] constexpr std::ptrdiff_t operator-(const paged_vector_iterator<Lhs, Page> &lhs, const paged_vector_iterator<Rhs, Page> &rhs) noexcept {
+    return lhs.index() - rhs.index();
+}
+
+template<typename Lhs, typename Rhs, std::size_t Page>
+[[nodiscard]] constexpr bool operator==(const paged_vector_iterator<Lhs, Page> &lhs, const paged_vector_iterator<Rhs, Page> &rhs) noexcept {
+    return lhs.index() == rhs.index();
+}
+
+template<typename Lhs, typename Rhs, std::size_t Page>
+[[nodiscard]] constexpr bool operator!=(const paged_vector_iterator<Lhs, Page> &lhs, const paged_vector_iterator<Rhs, Page> &rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template<typename Lhs, typename Rhs, std::size_t Page>
+[[nodiscard]] constexpr bool operator<(const paged_vector_iterator<Lhs, Page> &lhs, const paged_vector_iterator<Rhs, Page> &rhs) noexcept {
+    return lhs.index() < rhs.index();
+}
+
+template<typename Lhs, typename Rhs, std::size_t Page>
+[[nodiscard]] constexpr bool operator>(const paged_vector_iterator<Lhs, Page> &lhs, const paged_vector_iterator<Rhs, Page> &rhs) noexcept {
+    return rhs < lhs;
+}
+
+template<typename Lhs, typename Rhs, std::size_t Page>
+[[nodiscard]] constexpr bool operator<=(const paged_vector_iterator<Lhs, Page> &lhs, const paged_vector_iterator<Rhs, Page> &rhs) noexcept {
+    return !(lhs > rhs);
+}
+
+template<typename Lhs, typename Rhs, std::size_t Page>
+[[nodiscard]] constexpr bool operator>=(const paged_vector_iterator<Lhs, Page> &lhs, const paged_vector_iterator<Rhs, Page> &rhs) noexcept {
+    return !(lhs < rhs);
+}
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Paged vector implementation.
+ *
+ * Elements are stored in fixed size pages that are never reallocated. Growing
+ * the vector only allocates new pages, therefore elements are never moved nor
+ * copied as a result of an insertion and references to them remain valid until
+ * they are removed.<br/>
+ * On the other hand, the elements of a paged vector aren't contiguous in
+ * memory. Only those within the same page are.
+ *
+ * @tparam Type Element type.
+ * @tparam PageSize Number of elements in a page, it must be a power of two.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Type, std::size_t PageSize, typename Allocator>
+class paged_vector {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    static_assert(has_single_bit(PageSize), "Page size must be a power of two");
+    using container_type = std::vector<typename alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>>;
+
+    void destroy_from(const std::size_t sz) {
+        allocator_type allocator{get_allocator()};
+
+        for(auto pos = sz; pos < length; ++pos) {
+            alloc_traits::destroy(allocator, std::addressof(internal::paged_vector_element<PageSize>(pages, pos)));
+        }
+
+        length = sz;
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Element type. */
+    using value_type = Type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Signed integer type. */
+    using difference_type = std::ptrdiff_t;
+    /*! @brief Reference type. */
+    using reference = value_type &;
+    /*! @brief Constant reference type. */
+    using const_reference = const value_type &;
+    /*! @brief Pointer type to contained elements. */
+    using pointer = typename container_type::pointer;
+    /*! @brief Constant pointer type to contained elements. */
+    using const_pointer = typename alloc_traits::template rebind_traits<typename alloc_traits::const_pointer>::const_pointer;
+    /*! @brief Random access iterator type. */
+    using iterator = internal::paged_vector_iterator<container_type, PageSize>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = internal::paged_vector_iterator<const container_type, PageSize>;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    /*! @brief Constant reverse iterator type. */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    /*! @brief Number of elements in a page. */
+    static constexpr size_type page_size = PageSize;
+
+    /*! @brief Default constructor. */
+    paged_vector()
+        : paged_vector{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit paged_vector(const allocator_type &allocator)
+        : pages{allocator},
+          length{} {}
+
+    /**
+     * @brief Copy constructor.
+     * @param other The instance to copy from.
+     */
+    paged_vector(const paged_vector &other)
+        : paged_vector{other, alloc_traits::select_on_container_copy_construction(other.get_allocator())} {}
+
+    /**
+     * @brief Allocator-extended copy constructor.
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    paged_vector(const paged_vector &other, const allocator_type &allocator)
+        : paged_vector{allocator} {
+        reserve(other.length);
+
+        for(auto &&elem: other) {
+            emplace_back(elem);
+        }
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    paged_vector(paged_vector &&other) noexcept
+        : pages{std::move(other.pages)},
+          length{std::exchange(other.length, 0u)} {}
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    paged_vector(paged_vector &&other, const allocator_type &allocator)
+        : pages{std::move(other.pages), allocator},
+          length{std::exchange(other.length, 0u)} {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a paged vector is not allowed");
+    }
+
+    /*! @brief Default destructor. */
+    ~paged_vector() {
+        allocator_type allocator{get_allocator()};
+        destroy_from(0u);
+        internal::paged_vector_release<PageSize>(pages, allocator, 0u);
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The instance to copy from.
+     * @return This container.
+     */
+    paged_vector &operator=(const paged_vector &other) {
+        if(this != &other) {
+            paged_vector copy{other, get_allocator()};
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This container.
+     */
+    paged_vector &operator=(paged_vector &&other) noexcept {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a paged vector is not allowed");
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given paged vector.
+     * @param other Paged vector to exchange the content with.
+     */
+    void swap(paged_vector &other) noexcept {
+        using std::swap;
+        swap(pages, other.pages);
+        swap(length, other.length);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return pages.get_allocator();
+    }
+
+    /**
+     * @brief Increases the capacity of a paged vector.
+     *
+     * If the new capacity is greater than the current capacity, new pages are
+     * allocated, otherwise the method does nothing.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) {
+        if(cap != 0u) {
+            allocator_type allocator{get_allocator()};
+            internal::paged_vector_assure<PageSize>(pages, allocator, cap - 1u);
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements that a paged vector has currently
+     * allocated space for.
+     * @return Capacity of the paged vector.
+     */
+    [[nodiscard]] size_type capacity() const noexcept {
+        return pages.size() * PageSize;
+    }
+
+    /*! @brief Requests the removal of unused pages. */
+    void shrink_to_fit() {
+        allocator_type allocator{get_allocator()};
+        internal::paged_vector_release<PageSize>(pages, allocator, length);
+        pages.shrink_to_fit();
+    }
+
+    /**
+     * @brief Checks whether a paged vector is empty.
+     * @return True if the paged vector is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return (length == 0u);
+    }
+
+    /**
+     * @brief Returns the number of elements in a paged vector.
+     * @return Number of elements.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return length;
+    }
+
+    /**
+     * @brief Returns the maximum possible number of elements.
+     * @return Maximum possible number of elements.
+     */
+    [[nodiscard]] size_type max_size() const noexcept {
+        return pages.max_size();
+    }
+
+    /**
+     * @brief Direct access to the array of pages.
+     * @return A pointer to the array of pages.
+     */
+    [[nodiscard]] const_pointer raw() const noexcept {
+        return pages.data();
+    }
+
+    /*! @copydoc raw */
+    [[nodiscard]] pointer raw() noexcept {
+        return pages.data();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * If the paged vector is empty, the returned iterator will be equal to
+     * `end()`.
+     *
+     * @return An iterator to the first element of the paged vector.
+     */
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        return const_iterator{&pages, {}};
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() noexcept {
+        return iterator{&pages, {}};
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator to the element following the last element of the
+     * paged vector.
+     */
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return const_iterator{&pages, static_cast<difference_type>(length)};
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const noexcept {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() noexcept {
+        return iterator{&pages, static_cast<difference_type>(length)};
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * If the paged vector is empty, the returned iterator will be equal to
+     * `rend()`.
+     *
+     * @return An iterator to the first element of the reversed paged vector.
+     */
+    [[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+        return std::make_reverse_iterator(cend());
+    }
+
+    /*! @copydoc crbegin */
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+        return crbegin();
+    }
+
+    /*! @copydoc rbegin */
+    [[nodiscard]] reverse_iterator rbegin() noexcept {
+        return std::make_reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     * @return An iterator to the element following the last element of the
+     * reversed paged vector.
+     */
+    [[nodiscard]] const_reverse_iterator crend() const noexcept {
+        return std::make_reverse_iterator(cbegin());
+    }
+
+    /*! @copydoc crend */
+    [[nodiscard]] const_reverse_iterator rend() const noexcept {
+        return crend();
+    }
+
+    /*! @copydoc rend */
+    [[nodiscard]] reverse_iterator rend() noexcept {
+        return std::make_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns the element at specified location.
+     * @param pos The position of the element to return.
+     * @return The requested element.
+     */
+    [[nodiscard]] const_reference operator[](const size_type pos) const noexcept {
+        ENTT_ASSERT(pos < length, "Index out of bounds");
+        return internal::paged_vector_element<PageSize>(pages, pos);
+    }
+
+    /*! @copydoc operator[] */
+    [[nodiscard]] reference operator[](const size_type pos) noexcept {
+        ENTT_ASSERT(pos < length, "Index out of bounds");
+        return internal::paged_vector_element<PageSize>(pages, pos);
+    }
+
+    /**
+     * @brief Returns the first element of a paged vector.
+     * @return The first element.
+     */
+    [[nodiscard]] const_reference front() const noexcept {
+        return operator[](0u);
+    }
+
+    /*! @copydoc front */
+    [[nodiscard]] reference front() noexcept {
+        return operator[](0u);
+    }
+
+    /**
+     * @brief Returns the last element of a paged vector.
+     * @return The last element.
+     */
+    [[nodiscard]] const_reference back() const noexcept {
+        return operator[](length - 1u);
+    }
+
+    /*! @copydoc back */
+    [[nodiscard]] reference back() noexcept {
+        return operator[](length - 1u);
+    }
+
+    /**
+     * @brief Constructs an element in-place at the end of a paged vector.
+     *
+     * Existing elements are never moved, a new page is allocated if needed.
+     *
+     * @tparam Args Types of arguments to use to construct the element.
+     * @param args Parameters to use to construct the element.
+     * @return A reference to the newly created element.
+     */
+    template<typename... Args>
+    reference emplace_back(Args &&...args) {
+        allocator_type allocator{get_allocator()};
+        auto *elem = to_address(internal::paged_vector_assure<PageSize>(pages, allocator, length));
+        entt::uninitialized_construct_using_allocator(elem, allocator, std::forward<Args>(args)...);
+        return ++length, *elem;
+    }
+
+    /**
+     * @brief Appends a copy of an element to the end of a paged vector.
+     * @param value The element to copy.
+     */
+    void push_back(const value_type &value) {
+        emplace_back(value);
+    }
+
+    /**
+     * @brief Moves an element to the end of a paged vector.
+     * @param value The element to move.
+     */
+    void push_back(value_type &&value) {
+        emplace_back(std::move(value));
+    }
+
+    /*! @brief Removes the last element of a paged vector. */
+    void pop_back() {
+        ENTT_ASSERT(length != 0u, "Paged vector is empty");
+        destroy_from(length - 1u);
+    }
+
+    /**
+     * @brief Clears a paged vector.
+     *
+     * Pages aren't released. Use `shrink_to_fit` to release them.
+     */
+    void clear() {
+        destroy_from(0u);
+    }
+
+private:
+    container_type pages;
+    size_type length;
+};
+
+} // namespace entt
+
+#endif
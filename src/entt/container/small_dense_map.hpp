@@ -0,0 +1,840 @@
+#ifndef ENTT_CONTAINER_SMALL_DENSE_MAP_HPP
+#define ENTT_CONTAINER_SMALL_DENSE_MAP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/bit.hpp"
+#include "../core/compressed_pair.hpp"
+#include "../core/memory.hpp"
+#include "../core/type_traits.hpp"
+#include "dense_map.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Associative container for key-value pairs with unique keys and inline
+ * storage for a few elements.
+ *
+ * Up to `N` elements are stored within the container itself and looked up
+ * linearly, without touching the heap at all. When more elements are needed,
+ * all of them are moved to a packed array and a hash table like the one of a
+ * dense map is built on top of it.<br/>
+ * The container doesn't go back to its inline storage when elements are
+ * erased, except for when it's cleared.
+ *
+ * @tparam Key Key type of the associative container.
+ * @tparam Type Mapped type of the associative container.
+ * @tparam N Number of elements stored inline.
+ * @tparam Hash Type of function to use to hash the keys.
+ * @tparam KeyEqual Type of function to use to compare the keys for equality.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Key, typename Type, std::size_t N, typename Hash, typename KeyEqual, typename Allocator>
+class small_dense_map {
+    static_assert(N != 0u, "Invalid inline capacity");
+
+    static constexpr float threshold = 0.875f;
+    static constexpr std::size_t minimum_capacity = 8u;
+    static constexpr std::size_t placeholder = (std::numeric_limits<std::size_t>::max)();
+
+    using node_type = internal::dense_map_node<Key, Type>;
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, std::pair<const Key, Type>>, "Invalid value type");
+    using sparse_container_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
+    using packed_container_type = std::vector<node_type, typename alloc_traits::template rebind_alloc<node_type>>;
+
+    [[nodiscard]] node_type *inline_data() noexcept {
+        return std::launder(reinterpret_cast<node_type *>(storage));
+    }
+
+    [[nodiscard]] const node_type *inline_data() const noexcept {
+        return std::launder(reinterpret_cast<const node_type *>(storage));
+    }
+
+    [[nodiscard]] bool spilled() const noexcept {
+        return !sparse.first().empty();
+    }
+
+    [[nodiscard]] node_type *data() noexcept {
+        return spilled() ? packed.first().data() : inline_data();
+    }
+
+    [[nodiscard]] const node_type *data() const noexcept {
+        return spilled() ? packed.first().data() : inline_data();
+    }
+
+    template<typename Other>
+    [[nodiscard]] std::size_t key_to_bucket(const Other &key) const noexcept {
+        return fast_mod(static_cast<size_type>(sparse.second()(key)), sparse.first().size());
+    }
+
+    template<typename Other>
+    [[nodiscard]] std::size_t index_of(const Other &key) const {
+        if(spilled()) {
+            for(auto curr = sparse.first()[key_to_bucket(key)]; curr != placeholder; curr = packed.first()[curr].next) {
+                if(packed.second()(packed.first()[curr].element.first, key)) {
+                    return curr;
+                }
+            }
+        } else {
+            for(size_type pos{}; pos < length; ++pos) {
+                if(packed.second()(inline_data()[pos].element.first, key)) {
+                    return pos;
+                }
+            }
+        }
+
+        return placeholder;
+    }
+
+    template<typename Other>
+    [[nodiscard]] auto constrained_find(const Other &key) {
+        const auto pos = index_of(key);
+        return (pos == placeholder) ? end() : (begin() + static_cast<difference_type>(pos));
+    }
+
+    template<typename Other>
+    [[nodiscard]] auto constrained_find(const Other &key) const {
+        const auto pos = index_of(key);
+        return (pos == placeholder) ? cend() : (cbegin() + static_cast<difference_type>(pos));
+    }
+
+    template<typename... Args>
+    node_type &push_back(Args &&...args) {
+        if(!spilled() && length == N) {
+            spill(2u * N);
+        }
+
+        if(spilled()) {
+            return packed.first().emplace_back(placeholder, std::forward<Args>(args)...);
+        }
+
+        auto &node = *entt::uninitialized_construct_using_allocator(inline_data() + length, packed.first().get_allocator(), placeholder, std::forward<Args>(args)...);
+        ++length;
+        return node;
+    }
+
+    void pop_back() {
+        if(spilled()) {
+            packed.first().pop_back();
+        } else {
+            std::destroy_at(inline_data() + --length);
+        }
+    }
+
+    void link_back() {
+        if(spilled()) {
+            const auto index = key_to_bucket(packed.first().back().element.first);
+            packed.first().back().next = std::exchange(sparse.first()[index], packed.first().size() - 1u);
+            rehash_if_required();
+        }
+    }
+
+    void spill(const std::size_t cnt) {
+        packed.first().reserve(cnt > length ? cnt : length);
+
+        for(size_type pos{}; pos < length; ++pos) {
+            packed.first().emplace_back(std::move(inline_data()[pos]));
+        }
+
+        destroy_inline();
+        rehash(static_cast<size_type>(static_cast<float>(packed.first().capacity()) / threshold));
+    }
+
+    void destroy_inline() noexcept {
+        for(; length; --length) {
+            std::destroy_at(inline_data() + length - 1u);
+        }
+    }
+
+    void move_inline(small_dense_map &other) {
+        for(size_type pos{}; pos < other.length; ++pos) {
+            entt::uninitialized_construct_using_allocator(inline_data() + pos, packed.first().get_allocator(), std::move(other.inline_data()[pos]));
+            ++length;
+        }
+
+        other.destroy_inline();
+    }
+
+    void rehash_if_required() {
+        if(const auto bc = sparse.first().size(); size() > static_cast<size_type>(static_cast<float>(bc) * threshold)) {
+            rehash(bc * 2u);
+        }
+    }
+
+    void rehash(const std::size_t cnt) {
+        auto value = cnt > minimum_capacity ? cnt : minimum_capacity;
+        const auto cap = static_cast<size_type>(static_cast<float>(size()) / threshold);
+        value = value > cap ? value : cap;
+
+        if(const auto sz = next_power_of_two(value); sz != sparse.first().size()) {
+            sparse.first().resize(sz);
+
+            for(auto &&elem: sparse.first()) {
+                elem = placeholder;
+            }
+
+            for(size_type pos{}, last = packed.first().size(); pos < last; ++pos) {
+                const auto index = key_to_bucket(packed.first()[pos].element.first);
+                packed.first()[pos].next = std::exchange(sparse.first()[index], pos);
+            }
+        }
+    }
+
+    template<typename Other, typename... Args>
+    [[nodiscard]] auto insert_or_do_nothing(Other &&key, Args &&...args) {
+        if(auto it = constrained_find(key); it != end()) {
+            return std::make_pair(it, false);
+        }
+
+        push_back(std::piecewise_construct, std::forward_as_tuple(std::forward<Other>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        link_back();
+
+        return std::make_pair(--end(), true);
+    }
+
+    template<typename Other, typename Arg>
+    [[nodiscard]] auto insert_or_overwrite(Other &&key, Arg &&value) {
+        if(auto it = constrained_find(key); it != end()) {
+            it->second = std::forward<Arg>(value);
+            return std::make_pair(it, false);
+        }
+
+        push_back(std::forward<Other>(key), std::forward<Arg>(value));
+        link_back();
+
+        return std::make_pair(--end(), true);
+    }
+
+    void move_and_pop(const std::size_t pos) {
+        if(spilled()) {
+            if(const auto last = size() - 1u; pos != last) {
+                size_type *curr = &sparse.first()[key_to_bucket(packed.first().back().element.first)];
+                packed.first()[pos] = std::move(packed.first().back());
+                for(; *curr != last; curr = &packed.first()[*curr].next) {}
+                *curr = pos;
+            }
+        } else if(const auto last = length - 1u; pos != last) {
+            inline_data()[pos] = std::move(inline_data()[last]);
+        }
+
+        pop_back();
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Key type of the container. */
+    using key_type = Key;
+    /*! @brief Mapped type of the container. */
+    using mapped_type = Type;
+    /*! @brief Key-value type of the container. */
+    using value_type = std::pair<const Key, Type>;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Signed integer type. */
+    using difference_type = std::ptrdiff_t;
+    /*! @brief Type of function to use to hash the keys. */
+    using hasher = Hash;
+    /*! @brief Type of function to use to compare the keys for equality. */
+    using key_equal = KeyEqual;
+    /*! @brief Input iterator type. */
+    using iterator = internal::dense_map_iterator<node_type *>;
+    /*! @brief Constant input iterator type. */
+    using const_iterator = internal::dense_map_iterator<const node_type *>;
+
+    /*! @brief Default constructor. */
+    small_dense_map()
+        : small_dense_map{hasher{}} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit small_dense_map(const allocator_type &allocator)
+        : small_dense_map{hasher{}, key_equal{}, allocator} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator and hash
+     * function.
+     * @param hash Hash function to use.
+     * @param allocator The allocator to use.
+     */
+    small_dense_map(const hasher &hash, const allocator_type &allocator)
+        : small_dense_map{hash, key_equal{}, allocator} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator, hash
+     * function and compare function.
+     * @param hash Hash function to use.
+     * @param equal Compare function to use.
+     * @param allocator The allocator to use.
+     */
+    explicit small_dense_map(const hasher &hash, const key_equal &equal = key_equal{}, const allocator_type &allocator = allocator_type{})
+        : sparse{allocator, hash},
+          packed{allocator, equal} {}
+
+    /**
+     * @brief Copy constructor.
+     * @param other The instance to copy from.
+     */
+    small_dense_map(const small_dense_map &other)
+        : small_dense_map{other, alloc_traits::select_on_container_copy_construction(other.get_allocator())} {}
+
+    /**
+     * @brief Allocator-extended copy constructor.
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    small_dense_map(const small_dense_map &other, const allocator_type &allocator)
+        : sparse{std::piecewise_construct, std::forward_as_tuple(other.sparse.first(), allocator), std::forward_as_tuple(other.sparse.second())},
+          packed{std::piecewise_construct, std::forward_as_tuple(other.packed.first(), allocator), std::forward_as_tuple(other.packed.second())} {
+        for(; length < other.length; ++length) {
+            entt::uninitialized_construct_using_allocator(inline_data() + length, packed.first().get_allocator(), other.inline_data()[length]);
+        }
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    small_dense_map(small_dense_map &&other) noexcept(std::is_nothrow_move_constructible_v<node_type>)
+        : sparse{std::move(other.sparse)},
+          packed{std::move(other.packed)} {
+        move_inline(other);
+        other.sparse.first().clear();
+        other.packed.first().clear();
+    }
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    small_dense_map(small_dense_map &&other, const allocator_type &allocator)
+        : sparse{std::piecewise_construct, std::forward_as_tuple(std::move(other.sparse.first()), allocator), std::forward_as_tuple(std::move(other.sparse.second()))},
+          packed{std::piecewise_construct, std::forward_as_tuple(std::move(other.packed.first()), allocator), std::forward_as_tuple(std::move(other.packed.second()))} {
+        move_inline(other);
+        other.sparse.first().clear();
+        other.packed.first().clear();
+    }
+
+    /*! @brief Default destructor. */
+    ~small_dense_map() {
+        destroy_inline();
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The instance to copy from.
+     * @return This container.
+     */
+    small_dense_map &operator=(const small_dense_map &other) {
+        if(this != &other) {
+            *this = small_dense_map{other};
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This container.
+     */
+    small_dense_map &operator=(small_dense_map &&other) noexcept(std::is_nothrow_move_constructible_v<node_type>) {
+        if(this != &other) {
+            destroy_inline();
+            sparse = std::move(other.sparse);
+            packed = std::move(other.packed);
+            move_inline(other);
+            other.sparse.first().clear();
+            other.packed.first().clear();
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given container.
+     * @param other Container to exchange the content with.
+     */
+    void swap(small_dense_map &other) {
+        small_dense_map temp{std::move(other)};
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return sparse.first().get_allocator();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * If the array is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first instance of the internal array.
+     */
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        return data();
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() noexcept {
+        return data();
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * internal array.
+     */
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return data() + size();
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const noexcept {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() noexcept {
+        return data() + size();
+    }
+
+    /**
+     * @brief Checks whether a container is empty.
+     * @return True if the container is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return (size() == 0u);
+    }
+
+    /**
+     * @brief Returns the number of elements in a container.
+     * @return Number of elements in a container.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return spilled() ? packed.first().size() : length;
+    }
+
+    /**
+     * @brief Returns the maximum possible number of elements.
+     * @return Maximum possible number of elements.
+     */
+    [[nodiscard]] size_type max_size() const noexcept {
+        return packed.first().max_size();
+    }
+
+    /**
+     * @brief Returns the number of elements that a container can store without
+     * allocating memory.
+     * @return Number of elements that can be stored inline.
+     */
+    [[nodiscard]] static constexpr size_type inline_capacity() noexcept {
+        return N;
+    }
+
+    /**
+     * @brief Checks whether the elements are stored inline.
+     * @return True if the elements are stored inline, false otherwise.
+     */
+    [[nodiscard]] bool is_inline() const noexcept {
+        return !spilled();
+    }
+
+    /**
+     * @brief Clears the container.
+     *
+     * The container goes back to its inline storage, although any memory
+     * allocated so far is retained.
+     */
+    void clear() noexcept {
+        destroy_inline();
+        sparse.first().clear();
+        packed.first().clear();
+    }
+
+    /**
+     * @brief Inserts an element into the container, if the key does not exist.
+     * @param value A key-value pair eventually convertible to the value type.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    std::pair<iterator, bool> insert(const value_type &value) {
+        return insert_or_do_nothing(value.first, value.second);
+    }
+
+    /*! @copydoc insert */
+    std::pair<iterator, bool> insert(value_type &&value) {
+        return insert_or_do_nothing(std::move(value.first), std::move(value.second));
+    }
+
+    /**
+     * @copydoc insert
+     * @tparam Arg Type of the key-value pair to insert into the container.
+     */
+    template<typename Arg>
+    std::enable_if_t<std::is_constructible_v<value_type, Arg &&>, std::pair<iterator, bool>>
+    insert(Arg &&value) {
+        return insert_or_do_nothing(std::forward<Arg>(value).first, std::forward<Arg>(value).second);
+    }
+
+    /**
+     * @brief Inserts elements into the container, if their keys do not exist.
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of elements.
+     * @param last An iterator past the last element of the range of elements.
+     */
+    template<typename It>
+    void insert(It first, It last) {
+        for(; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    /**
+     * @brief Inserts an element into the container or assigns to the current
+     * element if the key already exists.
+     * @tparam Arg Type of the value to insert or assign.
+     * @param key A key used both to look up and to insert if not found.
+     * @param value A value to insert or assign.
+     * @return A pair consisting of an iterator to the element and a bool
+     * denoting whether the insertion took place.
+     */
+    template<typename Arg>
+    std::pair<iterator, bool> insert_or_assign(const key_type &key, Arg &&value) {
+        return insert_or_overwrite(key, std::forward<Arg>(value));
+    }
+
+    /*! @copydoc insert_or_assign */
+    template<typename Arg>
+    std::pair<iterator, bool> insert_or_assign(key_type &&key, Arg &&value) {
+        return insert_or_overwrite(std::move(key), std::forward<Arg>(value));
+    }
+
+    /**
+     * @brief Constructs an element in-place, if the key does not exist.
+     *
+     * The element is also constructed when the container already has the key,
+     * in which case the newly constructed object is destroyed immediately.
+     *
+     * @tparam Args Types of arguments to forward to the constructor of the
+     * element.
+     * @param args Arguments to forward to the constructor of the element.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> emplace([[maybe_unused]] Args &&...args) {
+        if constexpr(sizeof...(Args) == 0u) {
+            return insert_or_do_nothing(key_type{});
+        } else if constexpr(sizeof...(Args) == 1u) {
+            return insert_or_do_nothing(std::forward<Args>(args).first..., std::forward<Args>(args).second...);
+        } else if constexpr(sizeof...(Args) == 2u) {
+            return insert_or_do_nothing(std::forward<Args>(args)...);
+        } else {
+            auto &node = push_back(std::forward<Args>(args)...);
+
+            // the new element isn't linked yet, if it's found inline it comes last
+            if(const auto pos = index_of(node.element.first); pos != placeholder && pos != (size() - 1u)) {
+                pop_back();
+                return std::make_pair(begin() + static_cast<difference_type>(pos), false);
+            }
+
+            link_back();
+            return std::make_pair(--end(), true);
+        }
+    }
+
+    /**
+     * @brief Inserts in-place if the key does not exist, does nothing if the
+     * key exists.
+     * @tparam Args Types of arguments to forward to the constructor of the
+     * element.
+     * @param key A key used both to look up and to insert if not found.
+     * @param args Arguments to forward to the constructor of the element.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+        return insert_or_do_nothing(key, std::forward<Args>(args)...);
+    }
+
+    /*! @copydoc try_emplace */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+        return insert_or_do_nothing(std::move(key), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Removes an element from a given position.
+     * @param pos An iterator to the element to remove.
+     * @return An iterator following the removed element.
+     */
+    iterator erase(const_iterator pos) {
+        const auto diff = pos - cbegin();
+        erase(pos->first);
+        return begin() + diff;
+    }
+
+    /**
+     * @brief Removes the given elements from a container.
+     * @param first An iterator to the first element of the range of elements.
+     * @param last An iterator past the last element of the range of elements.
+     * @return An iterator following the last removed element.
+     */
+    iterator erase(const_iterator first, const_iterator last) {
+        const auto dist = first - cbegin();
+
+        for(auto from = last - cbegin(); from != dist; --from) {
+            erase(data()[static_cast<size_type>(from) - 1u].element.first);
+        }
+
+        return (begin() + dist);
+    }
+
+    /**
+     * @brief Removes the element associated with a given key.
+     * @param key A key value of an element to remove.
+     * @return Number of elements removed (either 0 or 1).
+     */
+    size_type erase(const key_type &key) {
+        if(spilled()) {
+            for(size_type *curr = &sparse.first()[key_to_bucket(key)]; *curr != placeholder; curr = &packed.first()[*curr].next) {
+                if(packed.second()(packed.first()[*curr].element.first, key)) {
+                    const auto index = *curr;
+                    *curr = packed.first()[*curr].next;
+                    move_and_pop(index);
+                    return 1u;
+                }
+            }
+        } else if(const auto pos = index_of(key); pos != placeholder) {
+            move_and_pop(pos);
+            return 1u;
+        }
+
+        return 0u;
+    }
+
+    /**
+     * @brief Accesses a given element with bounds checking.
+     * @param key A key of an element to find.
+     * @return A reference to the mapped value of the requested element.
+     */
+    [[nodiscard]] mapped_type &at(const key_type &key) {
+        auto it = find(key);
+        ENTT_ASSERT(it != end(), "Invalid key");
+        return it->second;
+    }
+
+    /*! @copydoc at */
+    [[nodiscard]] const mapped_type &at(const key_type &key) const {
+        auto it = find(key);
+        ENTT_ASSERT(it != cend(), "Invalid key");
+        return it->second;
+    }
+
+    /**
+     * @brief Accesses or inserts a given element.
+     * @param key A key of an element to find or insert.
+     * @return A reference to the mapped value of the requested element.
+     */
+    [[nodiscard]] mapped_type &operator[](const key_type &key) {
+        return insert_or_do_nothing(key).first->second;
+    }
+
+    /**
+     * @brief Accesses or inserts a given element.
+     * @param key A key of an element to find or insert.
+     * @return A reference to the mapped value of the requested element.
+     */
+    [[nodiscard]] mapped_type &operator[](key_type &&key) {
+        return insert_or_do_nothing(std::move(key)).first->second;
+    }
+
+    /**
+     * @brief Returns the number of elements matching a key (either 1 or 0).
+     * @param key Key value of an element to search for.
+     * @return Number of elements matching the key (either 1 or 0).
+     */
+    [[nodiscard]] size_type count(const key_type &key) const {
+        return find(key) != end();
+    }
+
+    /**
+     * @brief Returns the number of elements matching a key (either 1 or 0).
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @return Number of elements matching the key (either 1 or 0).
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, size_type>>
+    count(const Other &key) const {
+        return find(key) != end();
+    }
+
+    /**
+     * @brief Finds an element with a given key.
+     * @param key Key value of an element to search for.
+     * @return An iterator to an element with the given key. If no such element
+     * is found, a past-the-end iterator is returned.
+     */
+    [[nodiscard]] iterator find(const key_type &key) {
+        return constrained_find(key);
+    }
+
+    /*! @copydoc find */
+    [[nodiscard]] const_iterator find(const key_type &key) const {
+        return constrained_find(key);
+    }
+
+    /**
+     * @brief Finds an element with a key that compares _equivalent_ to a given
+     * key.
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @return An iterator to an element with the given key. If no such element
+     * is found, a past-the-end iterator is returned.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, iterator>>
+    find(const Other &key) {
+        return constrained_find(key);
+    }
+
+    /*! @copydoc find */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, const_iterator>>
+    find(const Other &key) const {
+        return constrained_find(key);
+    }
+
+    /**
+     * @brief Returns a range containing all elements with a given key.
+     * @param key Key value of an element to search for.
+     * @return A pair of iterators pointing to the first element and past the
+     * last element of the range.
+     */
+    [[nodiscard]] std::pair<iterator, iterator> equal_range(const key_type &key) {
+        const auto it = find(key);
+        return {it, it + !(it == end())};
+    }
+
+    /*! @copydoc equal_range */
+    [[nodiscard]] std::pair<const_iterator, const_iterator> equal_range(const key_type &key) const {
+        const auto it = find(key);
+        return {it, it + !(it == cend())};
+    }
+
+    /**
+     * @brief Returns a range containing all elements that compare _equivalent_
+     * to a given key.
+     * @tparam Other Type of an element to search for.
+     * @param key Key value of an element to search for.
+     * @return A pair of iterators pointing to the first element and past the
+     * last element of the range.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, std::pair<iterator, iterator>>>
+    equal_range(const Other &key) {
+        const auto it = find(key);
+        return {it, it + !(it == end())};
+    }
+
+    /*! @copydoc equal_range */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, std::pair<const_iterator, const_iterator>>>
+    equal_range(const Other &key) const {
+        const auto it = find(key);
+        return {it, it + !(it == cend())};
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a given key.
+     * @param key Key value of an element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    [[nodiscard]] bool contains(const key_type &key) const {
+        return (find(key) != cend());
+    }
+
+    /**
+     * @brief Checks if the container contains an element with a key that
+     * compares _equivalent_ to a given value.
+     * @tparam Other Type of the key value of an element to search for.
+     * @param key Key value of an element to search for.
+     * @return True if there is such an element, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] std::enable_if_t<is_transparent_v<hasher> && is_transparent_v<key_equal>, std::conditional_t<false, Other, bool>>
+    contains(const Other &key) const {
+        return (find(key) != cend());
+    }
+
+    /**
+     * @brief Reserves space for at least the specified number of elements.
+     *
+     * Elements are moved out of the inline storage if it's too small.
+     *
+     * @param cnt New number of elements.
+     */
+    void reserve(const size_type cnt) {
+        if(spilled()) {
+            packed.first().reserve(cnt);
+            rehash(static_cast<size_type>(static_cast<float>(cnt) / threshold));
+        } else if(cnt > N) {
+            spill(cnt);
+        }
+    }
+
+    /**
+     * @brief Returns the function used to hash the keys.
+     * @return The function used to hash the keys.
+     */
+    [[nodiscard]] hasher hash_function() const {
+        return sparse.second();
+    }
+
+    /**
+     * @brief Returns the function used to compare keys for equality.
+     * @return The function used to compare keys for equality.
+     */
+    [[nodiscard]] key_equal key_eq() const {
+        return packed.second();
+    }
+
+private:
+    compressed_pair<sparse_container_type, hasher> sparse;
+    compressed_pair<packed_container_type, key_equal> packed;
+    alignas(node_type) std::byte storage[sizeof(node_type) * N];
+    size_type length{};
+};
+
+} // namespace entt
+
+#endif
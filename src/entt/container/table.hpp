@@ -1,8 +1,11 @@
 #ifndef ENTT_CONTAINER_TABLE_HPP
 #define ENTT_CONTAINER_TABLE_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <initializer_list>
+#include <limits>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -133,6 +136,285 @@ template<typename... Lhs, typename... Rhs>
     return !(lhs < rhs);
 }
 
+template<typename Type>
+class table_empty_iterator {
+    template<typename>
+    friend class table_empty_iterator;
+
+public:
+    using value_type = std::remove_const_t<Type>;
+    using pointer = Type *;
+    using reference = Type &;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    constexpr table_empty_iterator() noexcept
+        : instance{},
+          offset{} {}
+
+    constexpr table_empty_iterator(Type *elem, const difference_type pos) noexcept
+        : instance{elem},
+          offset{pos} {}
+
+    template<typename Other, typename = std::enable_if_t<!std::is_same_v<Other, Type> && std::is_same_v<const Other, Type>>>
+    constexpr table_empty_iterator(const table_empty_iterator<Other> &other) noexcept
+        : table_empty_iterator{other.instance, other.offset} {}
+
+    constexpr table_empty_iterator &operator++() noexcept {
+        return ++offset, *this;
+    }
+
+    constexpr table_empty_iterator operator++(int) noexcept {
+        const table_empty_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    constexpr table_empty_iterator &operator--() noexcept {
+        return --offset, *this;
+    }
+
+    constexpr table_empty_iterator operator--(int) noexcept {
+        const table_empty_iterator orig = *this;
+        return operator--(), orig;
+    }
+
+    constexpr table_empty_iterator &operator+=(const difference_type value) noexcept {
+        offset += value;
+        return *this;
+    }
+
+    constexpr table_empty_iterator operator+(const difference_type value) const noexcept {
+        table_empty_iterator copy = *this;
+        return (copy += value);
+    }
+
+    constexpr table_empty_iterator &operator-=(const difference_type value) noexcept {
+        return (*this += -value);
+    }
+
+    constexpr table_empty_iterator operator-(const difference_type value) const noexcept {
+        return (*this + -value);
+    }
+
+    [[nodiscard]] constexpr reference operator[](const difference_type) const noexcept {
+        return *instance;
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept {
+        return instance;
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+        return *instance;
+    }
+
+    [[nodiscard]] constexpr difference_type index() const noexcept {
+        return offset;
+    }
+
+private:
+    Type *instance;
+    difference_type offset;
+};
+
+template<typename Lhs, typename Rhs>
+[[nodiscard]] constexpr std::ptrdiff_t operator-(const table_empty_iterator<Lhs> &lhs, const table_empty_iterator<Rhs> &rhs) noexcept {
+    return lhs.index() - rhs.index();
+}
+
+template<typename Lhs, typename Rhs>
+[[nodiscard]] constexpr bool operator==(const table_empty_iterator<Lhs> &lhs, const table_empty_iterator<Rhs> &rhs) noexcept {
+    return lhs.index() == rhs.index();
+}
+
+template<typename Lhs, typename Rhs>
+[[nodiscard]] constexpr bool operator!=(const table_empty_iterator<Lhs> &lhs, const table_empty_iterator<Rhs> &rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template<typename Lhs, typename Rhs>
+[[nodiscard]] constexpr bool operator<(const table_empty_iterator<Lhs> &lhs, const table_empty_iterator<Rhs> &rhs) noexcept {
+    return lhs.index() < rhs.index();
+}
+
+template<typename Lhs, typename Rhs>
+[[nodiscard]] constexpr bool operator>(const table_empty_iterator<Lhs> &lhs, const table_empty_iterator<Rhs> &rhs) noexcept {
+    return rhs < lhs;
+}
+
+template<typename Lhs, typename Rhs>
+[[nodiscard]] constexpr bool operator<=(const table_empty_iterator<Lhs> &lhs, const table_empty_iterator<Rhs> &rhs) noexcept {
+    return !(lhs > rhs);
+}
+
+template<typename Lhs, typename Rhs>
+[[nodiscard]] constexpr bool operator>=(const table_empty_iterator<Lhs> &lhs, const table_empty_iterator<Rhs> &rhs) noexcept {
+    return !(lhs < rhs);
+}
+
+template<typename Container>
+class table_empty_column {
+    using difference_type = std::ptrdiff_t;
+
+public:
+    using value_type = typename Container::value_type;
+    using size_type = std::size_t;
+    using iterator = table_empty_iterator<value_type>;
+    using const_iterator = table_empty_iterator<const value_type>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    table_empty_column() noexcept
+        : instance{},
+          length{} {}
+
+    template<typename Allocator>
+    explicit table_empty_column(const Allocator &) noexcept
+        : table_empty_column{} {}
+
+    explicit table_empty_column(const Container &container) noexcept
+        : instance{},
+          length{container.size()} {}
+
+    template<typename Allocator>
+    table_empty_column(const Container &container, const Allocator &) noexcept
+        : table_empty_column{container} {}
+
+    template<typename Allocator>
+    table_empty_column(table_empty_column &&other, const Allocator &) noexcept
+        : table_empty_column{std::move(other)} {}
+
+    table_empty_column(const table_empty_column &) noexcept = default;
+
+    table_empty_column(table_empty_column &&other) noexcept
+        : instance{},
+          length{std::exchange(other.length, 0u)} {}
+
+    ~table_empty_column() = default;
+
+    table_empty_column &operator=(const table_empty_column &) noexcept = default;
+
+    table_empty_column &operator=(table_empty_column &&other) noexcept {
+        length = std::exchange(other.length, 0u);
+        return *this;
+    }
+
+    friend void swap(table_empty_column &lhs, table_empty_column &rhs) noexcept {
+        std::swap(lhs.length, rhs.length);
+    }
+
+    void reserve(const size_type) noexcept {}
+
+    [[nodiscard]] size_type capacity() const noexcept {
+        return (std::numeric_limits<size_type>::max)();
+    }
+
+    void shrink_to_fit() noexcept {}
+
+    [[nodiscard]] size_type size() const noexcept {
+        return length;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return (length == 0u);
+    }
+
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        return {&instance, 0};
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] iterator begin() noexcept {
+        return {&instance, 0};
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return {&instance, static_cast<difference_type>(length)};
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] iterator end() noexcept {
+        return {&instance, static_cast<difference_type>(length)};
+    }
+
+    [[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+        return std::make_reverse_iterator(cend());
+    }
+
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+        return crbegin();
+    }
+
+    [[nodiscard]] reverse_iterator rbegin() noexcept {
+        return std::make_reverse_iterator(end());
+    }
+
+    [[nodiscard]] const_reverse_iterator crend() const noexcept {
+        return std::make_reverse_iterator(cbegin());
+    }
+
+    [[nodiscard]] const_reverse_iterator rend() const noexcept {
+        return crend();
+    }
+
+    [[nodiscard]] reverse_iterator rend() noexcept {
+        return std::make_reverse_iterator(begin());
+    }
+
+    template<typename... Args>
+    value_type &emplace_back(Args &&...) noexcept {
+        return ++length, instance;
+    }
+
+    iterator erase(const_iterator pos) noexcept {
+        --length;
+        return begin() + (pos - cbegin());
+    }
+
+    void pop_back() noexcept {
+        --length;
+    }
+
+    [[nodiscard]] value_type &back() noexcept {
+        return instance;
+    }
+
+    [[nodiscard]] const value_type &operator[](const size_type) const noexcept {
+        return instance;
+    }
+
+    [[nodiscard]] value_type &operator[](const size_type) noexcept {
+        return instance;
+    }
+
+    void clear() noexcept {
+        length = 0u;
+    }
+
+private:
+    value_type instance;
+    size_type length;
+};
+
+template<typename Container, typename = void>
+struct table_column {
+    using type = Container;
+};
+
+template<typename Container>
+struct table_column<Container, std::enable_if_t<std::is_empty_v<ENTT_ETO_TYPE(typename Container::value_type)> && std::is_default_constructible_v<typename Container::value_type>>> {
+    using type = table_empty_column<Container>;
+};
+
+template<typename Container>
+using table_column_t = typename table_column<Container>::type;
+
 } // namespace internal
 /*! @endcond */
 
@@ -143,11 +425,14 @@ template<typename... Lhs, typename... Rhs>
  * no guarantees that objects are returned in the insertion order when iterate
  * a table. Do not make assumption on the order in any case.
  *
+ * Columns of empty types aren't backed by their containers. A single instance
+ * is shared by all rows instead and no memory is allocated for them.
+ *
  * @tparam Container Sequence container row types.
  */
 template<typename... Container>
 class basic_table {
-    using container_type = std::tuple<Container...>;
+    using container_type = std::tuple<internal::table_column_t<Container>...>;
 
 public:
     /*! @brief Unsigned integer type. */
@@ -155,13 +440,13 @@ public:
     /*! @brief Signed integer type. */
     using difference_type = std::ptrdiff_t;
     /*! @brief Input iterator type. */
-    using iterator = internal::table_iterator<typename Container::iterator...>;
+    using iterator = internal::table_iterator<typename internal::table_column_t<Container>::iterator...>;
     /*! @brief Constant input iterator type. */
-    using const_iterator = internal::table_iterator<typename Container::const_iterator...>;
+    using const_iterator = internal::table_iterator<typename internal::table_column_t<Container>::const_iterator...>;
     /*! @brief Reverse iterator type. */
-    using reverse_iterator = internal::table_iterator<typename Container::reverse_iterator...>;
+    using reverse_iterator = internal::table_iterator<typename internal::table_column_t<Container>::reverse_iterator...>;
     /*! @brief Constant reverse iterator type. */
-    using const_reverse_iterator = internal::table_iterator<typename Container::const_reverse_iterator...>;
+    using const_reverse_iterator = internal::table_iterator<typename internal::table_column_t<Container>::const_reverse_iterator...>;
 
     /*! @brief Default constructor. */
     basic_table()
@@ -174,7 +459,7 @@ public:
      */
     explicit basic_table(const Container &...container) noexcept
         : payload{container...} {
-        ENTT_ASSERT((((std::get<Container>(payload).size() * sizeof...(Container)) == (std::get<Container>(payload).size() + ...)) && ...), "Unexpected container size");
+        ENTT_ASSERT((((std::get<internal::table_column_t<Container>>(payload).size() * sizeof...(Container)) == (std::get<internal::table_column_t<Container>>(payload).size() + ...)) && ...), "Unexpected container size");
     }
 
     /**
@@ -183,7 +468,7 @@ public:
      */
     explicit basic_table(Container &&...container) noexcept
         : payload{std::move(container)...} {
-        ENTT_ASSERT((((std::get<Container>(payload).size() * sizeof...(Container)) == (std::get<Container>(payload).size() + ...)) && ...), "Unexpected container size");
+        ENTT_ASSERT((((std::get<internal::table_column_t<Container>>(payload).size() * sizeof...(Container)) == (std::get<internal::table_column_t<Container>>(payload).size() + ...)) && ...), "Unexpected container size");
     }
 
     /*! @brief Default copy constructor, deleted on purpose. */
@@ -203,7 +488,7 @@ public:
      */
     template<typename Allocator>
     explicit basic_table(const Allocator &allocator)
-        : payload{Container{allocator}...} {}
+        : payload{internal::table_column_t<Container>{allocator}...} {}
 
     /**
      * @brief Copy constructs the underlying containers using a given allocator.
@@ -213,8 +498,8 @@ public:
      */
     template<class Allocator>
     basic_table(const Container &...container, const Allocator &allocator) noexcept
-        : payload{Container{container, allocator}...} {
-        ENTT_ASSERT((((std::get<Container>(payload).size() * sizeof...(Container)) == (std::get<Container>(payload).size() + ...)) && ...), "Unexpected container size");
+        : payload{internal::table_column_t<Container>{container, allocator}...} {
+        ENTT_ASSERT((((std::get<internal::table_column_t<Container>>(payload).size() * sizeof...(Container)) == (std::get<internal::table_column_t<Container>>(payload).size() + ...)) && ...), "Unexpected container size");
     }
 
     /**
@@ -225,8 +510,8 @@ public:
      */
     template<class Allocator>
     basic_table(Container &&...container, const Allocator &allocator) noexcept
-        : payload{Container{std::move(container), allocator}...} {
-        ENTT_ASSERT((((std::get<Container>(payload).size() * sizeof...(Container)) == (std::get<Container>(payload).size() + ...)) && ...), "Unexpected container size");
+        : payload{internal::table_column_t<Container>{std::move(container), allocator}...} {
+        ENTT_ASSERT((((std::get<internal::table_column_t<Container>>(payload).size() * sizeof...(Container)) == (std::get<internal::table_column_t<Container>>(payload).size() + ...)) && ...), "Unexpected container size");
     }
 
     /**
@@ -237,7 +522,7 @@ public:
      */
     template<class Allocator>
     basic_table(basic_table &&other, const Allocator &allocator)
-        : payload{Container{std::move(std::get<Container>(other.payload)), allocator}...} {}
+        : payload{internal::table_column_t<Container>{std::move(std::get<internal::table_column_t<Container>>(other.payload)), allocator}...} {}
 
     /*! @brief Default destructor. */
     ~basic_table() = default;
@@ -276,7 +561,7 @@ public:
      * @param cap Desired capacity.
      */
     void reserve(const size_type cap) {
-        (std::get<Container>(payload).reserve(cap), ...);
+        (std::get<internal::table_column_t<Container>>(payload).reserve(cap), ...);
     }
 
     /**
@@ -285,12 +570,12 @@ public:
      * @return Capacity of the table.
      */
     [[nodiscard]] size_type capacity() const noexcept {
-        return std::get<0>(payload).capacity();
+        return (std::min)({std::get<internal::table_column_t<Container>>(payload).capacity()...});
     }
 
     /*! @brief Requests the removal of unused capacity. */
     void shrink_to_fit() {
-        (std::get<Container>(payload).shrink_to_fit(), ...);
+        (std::get<internal::table_column_t<Container>>(payload).shrink_to_fit(), ...);
     }
 
     /**
@@ -317,7 +602,7 @@ public:
      * @return An iterator to the first row of the table.
      */
     [[nodiscard]] const_iterator cbegin() const noexcept {
-        return {std::get<Container>(payload).cbegin()...};
+        return {std::get<internal::table_column_t<Container>>(payload).cbegin()...};
     }
 
     /*! @copydoc cbegin */
@@ -327,7 +612,7 @@ public:
 
     /*! @copydoc begin */
     [[nodiscard]] iterator begin() noexcept {
-        return {std::get<Container>(payload).begin()...};
+        return {std::get<internal::table_column_t<Container>>(payload).begin()...};
     }
 
     /**
@@ -335,7 +620,7 @@ public:
      * @return An iterator to the element following the last row of the table.
      */
     [[nodiscard]] const_iterator cend() const noexcept {
-        return {std::get<Container>(payload).cend()...};
+        return {std::get<internal::table_column_t<Container>>(payload).cend()...};
     }
 
     /*! @copydoc cend */
@@ -345,7 +630,7 @@ public:
 
     /*! @copydoc end */
     [[nodiscard]] iterator end() noexcept {
-        return {std::get<Container>(payload).end()...};
+        return {std::get<internal::table_column_t<Container>>(payload).end()...};
     }
 
     /**
@@ -356,7 +641,7 @@ public:
      * @return An iterator to the first row of the reversed table.
      */
     [[nodiscard]] const_reverse_iterator crbegin() const noexcept {
-        return {std::get<Container>(payload).crbegin()...};
+        return {std::get<internal::table_column_t<Container>>(payload).crbegin()...};
     }
 
     /*! @copydoc crbegin */
@@ -366,7 +651,7 @@ public:
 
     /*! @copydoc rbegin */
     [[nodiscard]] reverse_iterator rbegin() noexcept {
-        return {std::get<Container>(payload).rbegin()...};
+        return {std::get<internal::table_column_t<Container>>(payload).rbegin()...};
     }
 
     /**
@@ -375,7 +660,7 @@ public:
      * table.
      */
     [[nodiscard]] const_reverse_iterator crend() const noexcept {
-        return {std::get<Container>(payload).crend()...};
+        return {std::get<internal::table_column_t<Container>>(payload).crend()...};
     }
 
     /*! @copydoc crend */
@@ -385,7 +670,7 @@ public:
 
     /*! @copydoc rend */
     [[nodiscard]] reverse_iterator rend() noexcept {
-        return {std::get<Container>(payload).rend()...};
+        return {std::get<internal::table_column_t<Container>>(payload).rend()...};
     }
 
     /**
@@ -397,9 +682,9 @@ public:
     template<typename... Args>
     std::tuple<typename Container::value_type &...> emplace(Args &&...args) {
         if constexpr(sizeof...(Args) == 0u) {
-            return std::forward_as_tuple(std::get<Container>(payload).emplace_back()...);
+            return std::forward_as_tuple(std::get<internal::table_column_t<Container>>(payload).emplace_back()...);
         } else {
-            return std::forward_as_tuple(std::get<Container>(payload).emplace_back(std::forward<Args>(args))...);
+            return std::forward_as_tuple(std::get<internal::table_column_t<Container>>(payload).emplace_back(std::forward<Args>(args))...);
         }
     }
 
@@ -410,7 +695,7 @@ public:
      */
     iterator erase(const_iterator pos) {
         const auto diff = pos - begin();
-        return {std::get<Container>(payload).erase(std::get<Container>(payload).begin() + diff)...};
+        return {std::get<internal::table_column_t<Container>>(payload).erase(std::get<internal::table_column_t<Container>>(payload).begin() + diff)...};
     }
 
     /**
@@ -422,6 +707,30 @@ public:
         erase(begin() + static_cast<difference_type>(pos));
     }
 
+    /**
+     * @brief Removes a row from a table by swapping it with the last one.
+     *
+     * This is a constant time alternative to `erase` that doesn't preserve the
+     * order of the rows in the table.
+     *
+     * @param pos Index of the row to remove.
+     */
+    void swap_and_pop(const size_type pos) {
+        ENTT_ASSERT(pos < size(), "Index out of bounds");
+
+        if(const auto last = size() - 1u; pos != last) {
+            ((std::get<internal::table_column_t<Container>>(payload)[pos] = std::move(std::get<internal::table_column_t<Container>>(payload)[last])), ...);
+        }
+
+        pop_back();
+    }
+
+    /*! @brief Removes the last row from a table. */
+    void pop_back() {
+        ENTT_ASSERT(!empty(), "Table is empty");
+        (std::get<internal::table_column_t<Container>>(payload).pop_back(), ...);
+    }
+
     /**
      * @brief Returns the row data at specified location.
      * @param pos The row for which to return the data.
@@ -429,18 +738,40 @@ public:
      */
     [[nodiscard]] std::tuple<const typename Container::value_type &...> operator[](const size_type pos) const {
         ENTT_ASSERT(pos < size(), "Index out of bounds");
-        return std::forward_as_tuple(std::get<Container>(payload)[pos]...);
+        return std::forward_as_tuple(std::get<internal::table_column_t<Container>>(payload)[pos]...);
     }
 
     /*! @copydoc operator[] */
     [[nodiscard]] std::tuple<typename Container::value_type &...> operator[](const size_type pos) {
         ENTT_ASSERT(pos < size(), "Index out of bounds");
-        return std::forward_as_tuple(std::get<Container>(payload)[pos]...);
+        return std::forward_as_tuple(std::get<internal::table_column_t<Container>>(payload)[pos]...);
+    }
+
+    /**
+     * @brief Returns an iterable object to visit a single column of a table.
+     *
+     * Columns backed by contiguous containers are returned as contiguous
+     * ranges and are therefore suitable for vectorized kernels.
+     *
+     * @tparam Index Index of the column to return.
+     * @return An iterable object to use to visit the column.
+     */
+    template<std::size_t Index>
+    [[nodiscard]] auto column() const noexcept {
+        const auto &elem = std::get<Index>(payload);
+        return iterable_adaptor{elem.cbegin(), elem.cend()};
+    }
+
+    /*! @copydoc column */
+    template<std::size_t Index>
+    [[nodiscard]] auto column() noexcept {
+        auto &elem = std::get<Index>(payload);
+        return iterable_adaptor{elem.begin(), elem.end()};
     }
 
     /*! @brief Clears a table. */
     void clear() {
-        (std::get<Container>(payload).clear(), ...);
+        (std::get<internal::table_column_t<Container>>(payload).clear(), ...);
     }
 
 private:
@@ -2,8 +2,11 @@
 #define ENTT_CORE_ALGORITHM_HPP
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <functional>
 #include <iterator>
+#include <thread>
 #include <utility>
 #include <vector>
 #include "utility.hpp"
@@ -70,6 +73,52 @@ struct insertion_sort {
     }
 };
 
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+template<std::size_t Bit, typename Getter, typename From>
+void radix_count(const Getter &getter, From from, const std::size_t first, const std::size_t last, const std::size_t start, std::size_t *count) {
+    constexpr auto mask = (1 << Bit) - 1;
+
+    for(auto pos = first; pos < last; ++pos) {
+        ++count[(getter(from[static_cast<typename std::iterator_traits<From>::difference_type>(pos)]) >> start) & mask];
+    }
+}
+
+template<std::size_t Bit, typename Getter, typename From, typename To>
+void radix_scatter(const Getter &getter, From from, To to, const std::size_t first, const std::size_t last, const std::size_t start, std::size_t *index) {
+    constexpr auto mask = (1 << Bit) - 1;
+
+    for(auto pos = first; pos < last; ++pos) {
+        auto &&elem = from[static_cast<typename std::iterator_traits<From>::difference_type>(pos)];
+        to[static_cast<typename std::iterator_traits<To>::difference_type>(index[(getter(elem) >> start) & mask]++)] = std::move(elem);
+    }
+}
+
+struct spin_barrier {
+    explicit spin_barrier(const std::size_t count) noexcept
+        : expected{count} {}
+
+    void arrive_and_wait() noexcept {
+        if(const auto curr = generation.load(std::memory_order_acquire); arrived.fetch_add(1u, std::memory_order_acq_rel) + 1u == expected) {
+            arrived.store(0u, std::memory_order_relaxed);
+            generation.fetch_add(1u, std::memory_order_release);
+        } else {
+            while(generation.load(std::memory_order_acquire) == curr) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    std::size_t expected;
+    std::atomic<std::size_t> arrived{};
+    std::atomic<std::size_t> generation{};
+};
+
+} // namespace internal
+/*! @endcond */
+
 /**
  * @brief Function object for performing LSD radix sort.
  * @tparam Bit Number of bits processed per pass.
@@ -96,23 +145,39 @@ struct radix_sort {
      */
     template<typename It, typename Getter = identity>
     void operator()(It first, It last, Getter getter = Getter{}) const {
+        std::vector<typename std::iterator_traits<It>::value_type> aux{};
+        operator()(std::move(first), std::move(last), std::move(getter), aux);
+    }
+
+    /**
+     * @brief Sorts the elements in a range using a scratch buffer.
+     *
+     * The scratch buffer is grown as needed and never shrunk. Reusing it
+     * across calls avoids allocating a temporary buffer every time.
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Getter Type of _getter_ function object.
+     * @tparam Allocator Type of allocator of the scratch buffer.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param getter A valid _getter_ function object.
+     * @param aux A scratch buffer to use to sort the elements.
+     */
+    template<typename It, typename Getter, typename Allocator>
+    void operator()(It first, It last, Getter getter, std::vector<typename std::iterator_traits<It>::value_type, Allocator> &aux) const {
         if(first < last) {
             constexpr auto passes = N / Bit;
+            constexpr auto buckets = std::size_t{1u} << Bit;
+            const auto len = static_cast<std::size_t>(std::distance(first, last));
 
-            using value_type = typename std::iterator_traits<It>::value_type;
-            using difference_type = typename std::iterator_traits<It>::difference_type;
-            std::vector<value_type> aux(static_cast<std::size_t>(std::distance(first, last)));
-
-            auto part = [getter = std::move(getter)](auto from, auto to, auto out, auto start) {
-                constexpr auto mask = (1 << Bit) - 1;
-                constexpr auto buckets = 1 << Bit;
+            if(aux.size() < len) {
+                aux.resize(len);
+            }
 
+            auto part = [&getter, len](auto from, auto out, auto start) {
                 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays, misc-const-correctness)
                 std::size_t count[buckets]{};
-
-                for(auto it = from; it != to; ++it) {
-                    ++count[(getter(*it) >> start) & mask];
-                }
+                internal::radix_count<Bit>(getter, from, 0u, len, start, count);
 
                 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
                 std::size_t index[buckets]{};
@@ -121,23 +186,157 @@ struct radix_sort {
                     index[pos + 1u] = index[pos] + count[pos];
                 }
 
-                for(auto it = from; it != to; ++it) {
-                    const auto pos = index[(getter(*it) >> start) & mask]++;
-                    out[static_cast<difference_type>(pos)] = std::move(*it);
-                }
+                internal::radix_scatter<Bit>(getter, from, out, 0u, len, start, index);
             };
 
             for(std::size_t pass = 0; pass < (passes & ~1u); pass += 2) {
-                part(first, last, aux.begin(), pass * Bit);
-                part(aux.begin(), aux.end(), first, (pass + 1) * Bit);
+                part(first, aux.begin(), pass * Bit);
+                part(aux.begin(), first, (pass + 1) * Bit);
             }
 
             if constexpr(passes & 1) {
-                part(first, last, aux.begin(), (passes - 1) * Bit);
-                std::move(aux.begin(), aux.end(), first);
+                part(first, aux.begin(), (passes - 1) * Bit);
+                std::move(aux.begin(), aux.begin() + static_cast<typename std::vector<typename std::iterator_traits<It>::value_type, Allocator>::difference_type>(len), first);
+            }
+        }
+    }
+};
+
+/**
+ * @brief Function object for performing parallel LSD radix sort.
+ *
+ * Each pass is split in three phases. Worker threads count the keys of their
+ * own slice of the range first. The resulting histograms are then combined in
+ * a prefix sum, so that each worker knows where to scatter its elements.
+ * Finally, elements are moved to their new positions in parallel.<br/>
+ * The sort is stable and small ranges are sorted on the calling thread.
+ *
+ * @warning
+ * Exceptions escaping the getter or the move assignment operator of the
+ * elements result in a call to `std::terminate`.
+ *
+ * @tparam Bit Number of bits processed per pass.
+ * @tparam N Maximum number of bits to sort.
+ */
+template<std::size_t Bit, std::size_t N>
+struct parallel_radix_sort {
+    static_assert((N % Bit) == 0, "The maximum number of bits to sort must be a multiple of the number of bits processed per pass");
+
+    /*! @brief Minimum number of elements assigned to a thread. */
+    static constexpr std::size_t grain = 1u << 14u;
+
+    /*! @brief Default constructor, one thread per hardware thread. */
+    parallel_radix_sort() noexcept
+        : parallel_radix_sort{std::thread::hardware_concurrency()} {}
+
+    /**
+     * @brief Constructs a sort function object with a given number of threads.
+     * @param count The maximum number of threads to use, calling one included.
+     */
+    explicit parallel_radix_sort(const std::size_t count) noexcept
+        : workers{(std::max)(count, std::size_t{1u})} {}
+
+    /**
+     * @brief Sorts the elements in a range.
+     *
+     * Sorts the elements in a range using the given _getter_ to access the
+     * actual data to be sorted.
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Getter Type of _getter_ function object.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param getter A valid _getter_ function object.
+     */
+    template<typename It, typename Getter = identity>
+    void operator()(It first, It last, Getter getter = Getter{}) const {
+        std::vector<typename std::iterator_traits<It>::value_type> aux{};
+        operator()(std::move(first), std::move(last), std::move(getter), aux);
+    }
+
+    /**
+     * @brief Sorts the elements in a range using a scratch buffer.
+     *
+     * @sa radix_sort
+     *
+     * @tparam It Type of random access iterator.
+     * @tparam Getter Type of _getter_ function object.
+     * @tparam Allocator Type of allocator of the scratch buffer.
+     * @param first An iterator to the first element of the range to sort.
+     * @param last An iterator past the last element of the range to sort.
+     * @param getter A valid _getter_ function object.
+     * @param aux A scratch buffer to use to sort the elements.
+     */
+    template<typename It, typename Getter, typename Allocator>
+    void operator()(It first, It last, Getter getter, std::vector<typename std::iterator_traits<It>::value_type, Allocator> &aux) const {
+        const auto len = static_cast<std::size_t>(first < last ? std::distance(first, last) : 0);
+
+        if(const auto count = (std::min)(workers, len / grain); count < 2u) {
+            radix_sort<Bit, N>{}(std::move(first), std::move(last), std::move(getter), aux);
+        } else {
+            constexpr auto passes = N / Bit;
+            constexpr auto buckets = std::size_t{1u} << Bit;
+
+            if(aux.size() < len) {
+                aux.resize(len);
+            }
+
+            std::vector<std::size_t> histogram(count * buckets);
+            internal::spin_barrier barrier{count};
+
+            auto job = [&, first](const std::size_t slot) {
+                const auto from = len * slot / count;
+                const auto to = len * (slot + 1u) / count;
+                auto *local = histogram.data() + slot * buckets;
+
+                auto part = [&](auto src, auto dst, const std::size_t start) {
+                    std::fill(local, local + buckets, std::size_t{});
+                    internal::radix_count<Bit>(getter, src, from, to, start, local);
+                    barrier.arrive_and_wait();
+
+                    if(slot == 0u) {
+                        // buckets in order, slices in order within a bucket to keep the sort stable
+                        for(std::size_t bucket{}, offset{}; bucket < buckets; ++bucket) {
+                            for(std::size_t pos{}; pos < count; ++pos) {
+                                offset += std::exchange(histogram[pos * buckets + bucket], offset);
+                            }
+                        }
+                    }
+
+                    barrier.arrive_and_wait();
+                    internal::radix_scatter<Bit>(getter, src, dst, from, to, start, local);
+                    barrier.arrive_and_wait();
+                };
+
+                for(std::size_t pass = 0; pass < (passes & ~1u); pass += 2) {
+                    part(first, aux.begin(), pass * Bit);
+                    part(aux.begin(), first, (pass + 1) * Bit);
+                }
+
+                if constexpr(passes & 1) {
+                    using difference_type = typename std::iterator_traits<It>::difference_type;
+                    part(first, aux.begin(), (passes - 1) * Bit);
+                    std::move(aux.begin() + static_cast<difference_type>(from), aux.begin() + static_cast<difference_type>(to), first + static_cast<difference_type>(from));
+                }
+            };
+
+            std::vector<std::thread> threads{};
+            threads.reserve(count - 1u);
+
+            for(std::size_t slot = 1u; slot < count; ++slot) {
+                threads.emplace_back(job, slot);
+            }
+
+            job(0u);
+
+            for(auto &&elem: threads) {
+                elem.join();
             }
         }
     }
+
+    /*! @brief Maximum number of threads to use, calling one included. */
+    std::size_t workers;
 };
 
 } // namespace entt
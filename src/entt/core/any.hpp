@@ -1,10 +1,13 @@
 #ifndef ENTT_CORE_ANY_HPP
 #define ENTT_CORE_ANY_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
 #include "../core/utility.hpp"
 #include "fwd.hpp"
@@ -29,6 +32,289 @@ enum class any_request : std::uint8_t {
 } // namespace internal
 /*! @endcond */
 
+/**
+ * @brief Bump allocator for the elements of any objects.
+ *
+ * When an arena is installed on a thread, any objects created on that thread
+ * that don't fit their small buffer get their elements from the arena rather
+ * than from the heap. These elements are destroyed along with their wrappers
+ * but their memory is only reclaimed all at once, when the arena is cleared or
+ * destroyed.<br/>
+ * Arenas aren't synchronized, each of them should be installed on at most one
+ * thread at a time.
+ *
+ * @warning
+ * All any objects that own elements from an arena must be destroyed before the
+ * arena is cleared or destroyed. Copies are not affected, since they allocate
+ * from the arena installed at the time of the copy, if any.
+ */
+class any_arena final {
+    struct chunk {
+        std::byte *data;
+        std::size_t length;
+    };
+
+    [[nodiscard]] static any_arena *&instance() noexcept {
+        static thread_local any_arena *value{};
+        return value;
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an arena with a given chunk size.
+     * @param length Size of the chunks requested to the system, in bytes.
+     */
+    explicit any_arena(const size_type length = 4096u)
+        : chunks{},
+          page{length},
+          curr{},
+          offset{} {
+        ENTT_ASSERT(length != 0u, "Invalid length");
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    any_arena(const any_arena &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    any_arena(any_arena &&) = delete;
+
+    /*! @brief Uninstalls the arena and returns all chunks to the system. */
+    ~any_arena() {
+        if(instance() == this) {
+            instance() = nullptr;
+        }
+
+        release();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This arena.
+     */
+    any_arena &operator=(const any_arena &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This arena.
+     */
+    any_arena &operator=(any_arena &&) = delete;
+
+    /**
+     * @brief Installs an arena for the calling thread.
+     * @param elem An arena or a null pointer to go back to the heap.
+     * @return The arena previously installed, if any.
+     */
+    static any_arena *install(any_arena *elem) noexcept {
+        return std::exchange(instance(), elem);
+    }
+
+    /**
+     * @brief Returns the arena installed for the calling thread, if any.
+     * @return The installed arena, if any, a null pointer otherwise.
+     */
+    [[nodiscard]] static any_arena *current() noexcept {
+        return instance();
+    }
+
+    /**
+     * @brief Allocates a block of memory.
+     * @param bytes The size of the block in bytes.
+     * @param alignment The alignment of the block.
+     * @return A pointer to the allocated block.
+     */
+    [[nodiscard]] void *allocate(const size_type bytes, const size_type alignment) {
+        for(; curr < chunks.size(); ++curr, offset = 0u) {
+            void *ptr = chunks[curr].data + offset;
+            auto space = chunks[curr].length - offset;
+
+            if(std::align(alignment, bytes, ptr, space)) {
+                offset = chunks[curr].length - space + bytes;
+                return ptr;
+            }
+        }
+
+        const auto length = (std::max)(page, bytes + alignment);
+        chunks.reserve(chunks.size() + 1u);
+        chunks.push_back(chunk{static_cast<std::byte *>(::operator new(length)), length});
+        return allocate(bytes, alignment);
+    }
+
+    /**
+     * @brief Returns the number of chunks obtained from the system.
+     * @return Number of chunks obtained from the system.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return chunks.size();
+    }
+
+    /*! @brief Makes all chunks available again without releasing them. */
+    void clear() noexcept {
+        curr = offset = 0u;
+    }
+
+    /*! @brief Returns all chunks to the system. */
+    void release() noexcept {
+        for(auto &&elem: chunks) {
+            ::operator delete(elem.data);
+        }
+
+        chunks.clear();
+        clear();
+    }
+
+private:
+    std::vector<chunk> chunks;
+    size_type page;
+    size_type curr;
+    size_type offset;
+};
+
+/**
+ * @brief Memory resource for the elements of any objects.
+ *
+ * When a resource is installed on a thread, any objects created on that thread
+ * that don't fit their small buffer get their elements from the resource
+ * rather than from the heap. Unlike arenas, memory is given back to the
+ * resource as soon as elements are destroyed. Each element remembers the
+ * resource it comes from, so that it can be destroyed on any thread and after
+ * the resource has been uninstalled.<br/>
+ * Arenas take precedence over resources when both are installed.
+ *
+ * @warning
+ * Resources must outlive all any objects that own elements allocated from
+ * them. Copies are not affected, since they allocate from the resource
+ * installed at the time of the copy, if any.
+ */
+class any_resource {
+    [[nodiscard]] static any_resource *&instance() noexcept {
+        static thread_local any_resource *value{};
+        return value;
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    any_resource() noexcept = default;
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    any_resource(const any_resource &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    any_resource(any_resource &&) = delete;
+
+    /*! @brief Uninstalls the resource, if needed. */
+    virtual ~any_resource() {
+        if(instance() == this) {
+            instance() = nullptr;
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This resource.
+     */
+    any_resource &operator=(const any_resource &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This resource.
+     */
+    any_resource &operator=(any_resource &&) = delete;
+
+    /**
+     * @brief Installs a resource for the calling thread.
+     * @param elem A resource or a null pointer to go back to the heap.
+     * @return The resource previously installed, if any.
+     */
+    static any_resource *install(any_resource *elem) noexcept {
+        return std::exchange(instance(), elem);
+    }
+
+    /**
+     * @brief Returns the resource installed for the calling thread, if any.
+     * @return The installed resource, if any, a null pointer otherwise.
+     */
+    [[nodiscard]] static any_resource *current() noexcept {
+        return instance();
+    }
+
+    /**
+     * @brief Allocates a block of memory.
+     * @param bytes The size of the block in bytes.
+     * @param alignment The alignment of the block.
+     * @return A pointer to the allocated block.
+     */
+    [[nodiscard]] virtual void *allocate(size_type bytes, size_type alignment) = 0;
+
+    /**
+     * @brief Returns a block of memory to the resource.
+     * @param block A block previously obtained from the resource.
+     * @param bytes The size of the block in bytes.
+     * @param alignment The alignment of the block.
+     */
+    virtual void deallocate(void *block, size_type bytes, size_type alignment) noexcept = 0;
+};
+
+/**
+ * @brief Memory resource that forwards requests to an allocator.
+ *
+ * Blocks are requested to the allocator as arrays of `std::max_align_t`, that
+ * is also the strictest alignment supported.
+ *
+ * @tparam Allocator Type of allocator used to manage memory.
+ */
+template<typename Allocator>
+class any_allocator_resource final: public any_resource {
+    using alloc_traits = typename std::allocator_traits<Allocator>::template rebind_traits<std::max_align_t>;
+    static_assert(std::is_pointer_v<typename alloc_traits::pointer>, "Fancy pointers aren't supported");
+
+    [[nodiscard]] static constexpr size_type length(const size_type bytes) noexcept {
+        return (bytes + sizeof(std::max_align_t) - 1u) / sizeof(std::max_align_t);
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = typename alloc_traits::allocator_type;
+
+    /*! @brief Default constructor. */
+    any_allocator_resource()
+        : any_allocator_resource{allocator_type{}} {}
+
+    /**
+     * @brief Constructs a resource with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit any_allocator_resource(const allocator_type &allocator)
+        : alloc{allocator} {}
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] allocator_type get_allocator() const noexcept {
+        return alloc;
+    }
+
+    /*! @copydoc any_resource::allocate */
+    [[nodiscard]] void *allocate(const size_type bytes, [[maybe_unused]] const size_type alignment) override {
+        ENTT_ASSERT(alignment <= alignof(std::max_align_t), "Unsupported alignment");
+        return alloc_traits::allocate(alloc, length(bytes));
+    }
+
+    /*! @copydoc any_resource::deallocate */
+    void deallocate(void *block, const size_type bytes, const size_type) noexcept override {
+        alloc_traits::deallocate(alloc, static_cast<std::max_align_t *>(block), length(bytes));
+    }
+
+private:
+    allocator_type alloc;
+};
+
 /**
  * @brief A SBO friendly, type-safe container for single values of any type.
  * @tparam Len Size of the storage reserved for the small buffer optimization.
@@ -48,6 +334,13 @@ class basic_any {
     // NOLINTNEXTLINE(bugprone-sizeof-expression)
     static constexpr bool in_situ = (Len != 0u) && alignof(Type) <= Align && sizeof(Type) <= Len && std::is_nothrow_move_constructible_v<Type>;
 
+    // elements allocated from a resource are preceded by a pointer to the resource itself
+    template<typename Type>
+    static constexpr std::size_t resource_offset = ((sizeof(any_resource *) + alignof(Type) - 1u) / alignof(Type)) * alignof(Type);
+
+    template<typename Type>
+    static constexpr std::size_t resource_alignment = (std::max)(alignof(Type), alignof(any_resource *));
+
     template<typename Type>
     static const void *basic_vtable(const request req, const basic_any &value, const void *other) {
         static_assert(!std::is_void_v<Type> && std::is_same_v<std::remove_cv_t<std::remove_reference_t<Type>>, Type>, "Invalid type");
@@ -74,12 +367,17 @@ class basic_any {
             }
             break;
         case request::destroy:
-            if constexpr(in_situ<Type>) {
-                (value.mode == any_policy::embedded) ? elem->~Type() : (delete elem);
-            } else if constexpr(std::is_array_v<Type>) {
+            if constexpr(std::is_array_v<Type>) {
                 delete[] elem;
-            } else {
+            } else if(value.mode == any_policy::dynamic) {
                 delete elem;
+            } else if(value.mode == any_policy::resource && elem != nullptr) {
+                elem->~Type();
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                void *block = const_cast<std::byte *>(reinterpret_cast<const std::byte *>(elem) - resource_offset<Type>);
+                (*static_cast<any_resource **>(block))->deallocate(block, resource_offset<Type> + sizeof(Type), resource_alignment<Type>);
+            } else if(elem != nullptr) {
+                elem->~Type();
             }
             break;
         case request::compare:
@@ -135,6 +433,43 @@ class basic_any {
                     ::new(&storage) plain_type(std::forward<Args>(args)...);
                 }
             } else {
+                if constexpr(!std::is_array_v<plain_type>) {
+                    if(auto *arena = any_arena::current(); arena) {
+                        void *elem = arena->allocate(sizeof(plain_type), alignof(plain_type));
+
+                        if constexpr(std::is_aggregate_v<plain_type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<plain_type>)) {
+                            instance = ::new(elem) plain_type{std::forward<Args>(args)...};
+                        } else {
+                            instance = ::new(elem) plain_type(std::forward<Args>(args)...);
+                        }
+
+                        mode = any_policy::arena;
+                        return;
+                    }
+
+                    if(auto *resource = any_resource::current(); resource) {
+                        void *block = resource->allocate(resource_offset<plain_type> + sizeof(plain_type), resource_alignment<plain_type>);
+                        ::new(block) any_resource *{resource};
+                        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                        void *elem = static_cast<std::byte *>(block) + resource_offset<plain_type>;
+
+                        ENTT_TRY {
+                            if constexpr(std::is_aggregate_v<plain_type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<plain_type>)) {
+                                instance = ::new(elem) plain_type{std::forward<Args>(args)...};
+                            } else {
+                                instance = ::new(elem) plain_type(std::forward<Args>(args)...);
+                            }
+                        }
+                        ENTT_CATCH {
+                            resource->deallocate(block, resource_offset<plain_type> + sizeof(plain_type), resource_alignment<plain_type>);
+                            ENTT_THROW;
+                        }
+
+                        mode = any_policy::resource;
+                        return;
+                    }
+                }
+
                 mode = any_policy::dynamic;
 
                 if constexpr(std::is_aggregate_v<plain_type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<plain_type>)) {
@@ -436,7 +771,7 @@ public:
      * @return True if the wrapper owns its object, false otherwise.
      */
     [[nodiscard]] bool owner() const noexcept {
-        return (mode == any_policy::dynamic || mode == any_policy::embedded);
+        return (mode == any_policy::dynamic || mode == any_policy::embedded || mode == any_policy::arena || mode == any_policy::resource);
     }
 
     /**
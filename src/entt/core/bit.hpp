@@ -20,6 +20,32 @@ template<typename Type>
     return value ? (int(value & 1) + popcount(static_cast<Type>(value >> 1))) : 0;
 }
 
+/**
+ * @brief Returns the number of consecutive zero bits, starting from the least
+ * significant bit (waiting for C++20 and `std::countr_zero`).
+ * @tparam Type Unsigned integer type.
+ * @param value A value of unsigned integer type.
+ * @return The number of trailing zero bits in the value.
+ */
+template<typename Type>
+[[nodiscard]] constexpr std::enable_if_t<std::is_unsigned_v<Type>, int> countr_zero(const Type value) noexcept {
+    if(value == 0u) {
+        return std::numeric_limits<Type>::digits;
+    }
+
+    int count{};
+    Type curr = value;
+
+    for(int shift = std::numeric_limits<Type>::digits / 2; shift != 0; shift = shift / 2) {
+        if(static_cast<Type>(curr & static_cast<Type>((Type{1u} << shift) - 1u)) == 0u) {
+            curr = static_cast<Type>(curr >> shift);
+            count += shift;
+        }
+    }
+
+    return count;
+}
+
 /**
  * @brief Checks whether a value is a power of two or not (waiting for C++20 and
  * `std::has_single_bit`).
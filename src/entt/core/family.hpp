@@ -1,8 +1,11 @@
 #ifndef ENTT_CORE_FAMILY_HPP
 #define ENTT_CORE_FAMILY_HPP
 
+#include <cstddef>
+#include <type_traits>
 #include "../config/config.h"
 #include "fwd.hpp"
+#include "type_traits.hpp"
 
 namespace entt {
 
@@ -28,6 +31,50 @@ public:
     inline static const value_type value = identifier++;
 };
 
+/**
+ * @brief Static identifier generator.
+ *
+ * Utility class template that assigns sequential identifiers to a list of
+ * types registered up front. Identifiers are compile-time constants, so they
+ * don't require any initialization at runtime. Therefore, there is neither
+ * a counter to increment atomically nor a lazily initialized variable to race
+ * on when they are used from multiple threads.<br/>
+ * Types that aren't part of the list are rejected at compile-time.
+ *
+ * @tparam Type Types for which to generate identifiers.
+ */
+template<typename... Type>
+class fixed_family {
+    static_assert(std::is_same_v<type_list_unique_t<type_list<Type...>>, type_list<Type...>>, "Non-unique types");
+
+    template<typename Other>
+    [[nodiscard]] static constexpr id_type index_of() noexcept {
+        static_assert(type_list_contains_v<type_list<Type...>, Other>, "Unregistered type");
+        return static_cast<id_type>(type_list_index_v<Other, type_list<Type...>>);
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using value_type = id_type;
+
+    /*! @brief Number of registered types. */
+    static constexpr std::size_t size = sizeof...(Type);
+
+    /**
+     * @brief Checks whether a type is registered.
+     * @tparam Other Type to look for.
+     */
+    template<typename Other>
+    static constexpr bool contains = type_list_contains_v<type_list<Type...>, Other>;
+
+    /**
+     * @brief Statically generated unique identifier for the given type.
+     * @tparam Other A registered type.
+     */
+    template<typename Other>
+    static constexpr value_type value = index_of<Other>();
+};
+
 } // namespace entt
 
 #endif
@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include "../config/config.h"
 
 namespace entt {
@@ -18,9 +19,20 @@ enum class any_policy : std::uint8_t {
     /*! @brief Aliasing mode, the object _points_ to a non-const element. */
     ref,
     /*! @brief Const aliasing mode, the object _points_ to a const element. */
-    cref
+    cref,
+    /*! @brief Owning mode, the object owns an element allocated from an arena. */
+    arena,
+    /*! @brief Owning mode, the object owns an element allocated from a resource. */
+    resource
 };
 
+class any_arena;
+
+class any_resource;
+
+template<typename = std::allocator<std::max_align_t>>
+class any_allocator_resource;
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
 template<std::size_t Len = sizeof(double[2]), std::size_t = alignof(double[2])>
 class basic_any;
@@ -34,15 +46,48 @@ using any = basic_any<>;
 template<typename, typename>
 class compressed_pair;
 
-template<typename>
+struct fnv1a_hash_policy;
+
+struct word_hash_policy;
+
+template<typename, typename = fnv1a_hash_policy>
 class basic_hashed_string;
 
+template<typename Char, typename = fnv1a_hash_policy, typename = std::allocator<Char>>
+class basic_hashed_string_pool;
+
+class huge_page_pool;
+
+template<typename>
+class huge_page_allocator;
+
+class monotonic_pool;
+
+template<typename>
+class monotonic_pool_allocator;
+
+class page_pool;
+
+template<typename>
+class page_pool_allocator;
+
+class slab_pool;
+
+template<typename>
+class slab_pool_allocator;
+
 /*! @brief Aliases for common character types. */
 using hashed_string = basic_hashed_string<char>;
 
 /*! @brief Aliases for common character types. */
 using hashed_wstring = basic_hashed_string<wchar_t>;
 
+/*! @brief Aliases for common character types. */
+using hashed_string_pool = basic_hashed_string_pool<char>;
+
+/*! @brief Aliases for common character types. */
+using hashed_wstring_pool = basic_hashed_string_pool<wchar_t>;
+
 // NOLINTNEXTLINE(bugprone-forward-declaration-namespace)
 struct type_info;
 
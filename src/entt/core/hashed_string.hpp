@@ -3,6 +3,8 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
+#include <utility>
 #include "fwd.hpp"
 
 namespace entt {
@@ -32,13 +34,135 @@ struct basic_hashed_string {
     using hash_type = id_type;
 
     const value_type *repr{};
-    hash_type hash{fnv_1a_params<>::offset};
+    hash_type hash{};
     size_type length{};
 };
 
+struct word_hash_params {
+    static constexpr std::uint64_t seed = 0xa0761d6478bd642full;
+    static constexpr std::uint64_t secret = 0xe7037ed1a0b428dbull;
+};
+
+[[nodiscard]] constexpr std::uint64_t word_hash_mix(const std::uint64_t lhs, const std::uint64_t rhs) noexcept {
+#if defined(__SIZEOF_INT128__)
+    __extension__ using wide_type = unsigned __int128;
+    const auto value = static_cast<wide_type>(lhs) * rhs;
+    return static_cast<std::uint64_t>(value) ^ static_cast<std::uint64_t>(value >> 64u);
+#else
+    // portable 64x64 to 128 bit multiplication, high and low parts are folded
+    const auto lhs_hi = lhs >> 32u;
+    const auto lhs_lo = lhs & 0xFFFFFFFFull;
+    const auto rhs_hi = rhs >> 32u;
+    const auto rhs_lo = rhs & 0xFFFFFFFFull;
+    const auto mid = lhs_hi * rhs_lo;
+    const auto other = lhs_lo * rhs_hi;
+    const auto partial = lhs_lo * rhs_lo + (mid << 32u);
+    const auto lo = partial + (other << 32u);
+    const auto carry = static_cast<std::uint64_t>(partial < (mid << 32u)) + static_cast<std::uint64_t>(lo < partial);
+    const auto hi = lhs_hi * rhs_hi + (mid >> 32u) + (other >> 32u) + carry;
+    return lo ^ hi;
+#endif
+}
+
+template<typename Char, std::size_t... Index>
+[[nodiscard]] constexpr std::uint64_t word_hash_load(const Char *str, std::index_sequence<Index...>) noexcept {
+    // an unrolled sequence of shifts that compilers turn into a single load
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return ((static_cast<std::uint64_t>(static_cast<std::make_unsigned_t<Char>>(str[Index])) << (Index * sizeof(Char) * 8u)) | ...);
+}
+
+template<typename Char>
+[[nodiscard]] constexpr std::uint64_t word_hash_load(const Char *str) noexcept {
+    return word_hash_load(str, std::make_index_sequence<sizeof(std::uint64_t) / sizeof(Char)>{});
+}
+
+template<typename Char>
+[[nodiscard]] constexpr std::uint64_t word_hash_load(const Char *str, const std::size_t count) noexcept {
+    constexpr auto bits = sizeof(Char) * 8u;
+    std::uint64_t word{};
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for(std::size_t pos{}; pos < count; ++pos) {
+        word |= static_cast<std::uint64_t>(static_cast<std::make_unsigned_t<Char>>(str[pos])) << (pos * bits);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return word;
+}
+
 } // namespace internal
 /*! @endcond */
 
+/**
+ * @brief Byte-at-a-time FNV-1a hash policy for hashed strings.
+ *
+ * This is the default policy. It is cheap for short identifiers and it is
+ * the one used by the literal operators.
+ */
+struct fnv1a_hash_policy {
+    /**
+     * @brief Returns the numeric representation of a string.
+     * @tparam Char Character type.
+     * @param str Human-readable identifier.
+     * @param len Length of the string to hash.
+     * @return The numeric representation of the string.
+     */
+    template<typename Char>
+    [[nodiscard]] static constexpr id_type hash(const Char *str, const std::size_t len) noexcept {
+        using params = internal::fnv_1a_params<>;
+        id_type value{params::offset};
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        for(std::size_t pos{}; pos < len; ++pos) {
+            value = (value ^ static_cast<id_type>(str[pos])) * params::prime;
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        return value;
+    }
+};
+
+/**
+ * @brief Word-at-a-time hash policy for hashed strings.
+ *
+ * Characters are consumed sixteen bytes at a time and mixed with wide
+ * multiplications, in the spirit of _wyhash_. This makes it much faster than
+ * FNV-1a on long strings such as paths.<br/>
+ * Words are assembled from characters rather than read from memory, therefore
+ * the result is the same at compile-time and at runtime, regardless of the
+ * endianness of the target.
+ */
+struct word_hash_policy {
+    /*! @copydoc fnv1a_hash_policy::hash */
+    template<typename Char>
+    [[nodiscard]] static constexpr id_type hash(const Char *str, const std::size_t len) noexcept {
+        using params = internal::word_hash_params;
+        constexpr std::size_t step = (sizeof(std::uint64_t) / sizeof(Char));
+        static_assert(step != 0u, "Unsupported character type");
+
+        auto seed = params::seed ^ internal::word_hash_mix(static_cast<std::uint64_t>(len) ^ params::secret, params::seed);
+        std::size_t pos{};
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        for(; (pos + 2u * step) <= len; pos += 2u * step) {
+            seed = internal::word_hash_mix(internal::word_hash_load(str + pos) ^ params::secret, internal::word_hash_load(str + pos + step) ^ seed);
+        }
+
+        const auto rest = len - pos;
+        const auto lhs = internal::word_hash_load(str + pos, (rest < step) ? rest : step);
+        const auto rhs = (rest > step) ? internal::word_hash_load(str + pos + step, rest - step) : std::uint64_t{};
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        const auto value = internal::word_hash_mix(params::secret ^ static_cast<std::uint64_t>(len), internal::word_hash_mix(lhs ^ params::secret, rhs ^ seed));
+
+        if constexpr(sizeof(id_type) < sizeof(std::uint64_t)) {
+            return static_cast<id_type>(value ^ (value >> 32u));
+        } else {
+            return static_cast<id_type>(value);
+        }
+    }
+};
+
 /**
  * @brief Zero overhead unique identifier.
  *
@@ -53,11 +177,11 @@ struct basic_hashed_string {
  * copy of them.
  *
  * @tparam Char Character type.
+ * @tparam Policy Hash policy used to compute the numeric representation.
  */
-template<typename Char>
+template<typename Char, typename Policy>
 class basic_hashed_string: internal::basic_hashed_string<Char> {
     using base_type = internal::basic_hashed_string<Char>;
-    using params = internal::fnv_1a_params<>;
 
     struct const_wrapper {
         // non-explicit constructor on purpose
@@ -74,6 +198,8 @@ public:
     using size_type = typename base_type::size_type;
     /*! @brief Unsigned integer type. */
     using hash_type = typename base_type::hash_type;
+    /*! @brief Hash policy type. */
+    using policy_type = Policy;
 
     /**
      * @brief Returns directly the numeric representation of a string view.
@@ -117,13 +243,7 @@ public:
      */
     constexpr basic_hashed_string(const value_type *str, const size_type len) noexcept
         // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
-        : base_type{str} {
-        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        for(; base_type::length < len; ++base_type::length) {
-            base_type::hash = (base_type::hash ^ static_cast<id_type>(str[base_type::length])) * params::prime;
-        }
-        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    }
+        : base_type{str, policy_type::hash(str, len), len} {}
 
     /**
      * @brief Constructs a hashed string from an array of const characters.
@@ -135,9 +255,8 @@ public:
     ENTT_CONSTEVAL basic_hashed_string(const value_type (&str)[N]) noexcept
         // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
         : base_type{str} {
-        for(; str[base_type::length]; ++base_type::length) {
-            base_type::hash = (base_type::hash ^ static_cast<id_type>(str[base_type::length])) * params::prime;
-        }
+        for(; str[base_type::length]; ++base_type::length) {}
+        base_type::hash = policy_type::hash(str, base_type::length);
     }
 
     /**
@@ -151,11 +270,9 @@ public:
      */
     explicit constexpr basic_hashed_string(const_wrapper wrapper) noexcept
         : base_type{wrapper.repr} {
-        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        for(; wrapper.repr[base_type::length]; ++base_type::length) {
-            base_type::hash = (base_type::hash ^ static_cast<id_type>(wrapper.repr[base_type::length])) * params::prime;
-        }
-        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        for(; wrapper.repr[base_type::length]; ++base_type::length) {}
+        base_type::hash = policy_type::hash(wrapper.repr, base_type::length);
     }
 
     /**
@@ -218,75 +335,81 @@ basic_hashed_string(const Char (&str)[N]) -> basic_hashed_string<Char>;
 /**
  * @brief Compares two hashed strings.
  * @tparam Char Character type.
+ * @tparam Policy Hash policy type.
  * @param lhs A valid hashed string.
  * @param rhs A valid hashed string.
  * @return True if the two hashed strings are identical, false otherwise.
  */
-template<typename Char>
-[[nodiscard]] constexpr bool operator==(const basic_hashed_string<Char> &lhs, const basic_hashed_string<Char> &rhs) noexcept {
+template<typename Char, typename Policy>
+[[nodiscard]] constexpr bool operator==(const basic_hashed_string<Char, Policy> &lhs, const basic_hashed_string<Char, Policy> &rhs) noexcept {
     return lhs.value() == rhs.value();
 }
 
 /**
  * @brief Compares two hashed strings.
  * @tparam Char Character type.
+ * @tparam Policy Hash policy type.
  * @param lhs A valid hashed string.
  * @param rhs A valid hashed string.
  * @return True if the two hashed strings differ, false otherwise.
  */
-template<typename Char>
-[[nodiscard]] constexpr bool operator!=(const basic_hashed_string<Char> &lhs, const basic_hashed_string<Char> &rhs) noexcept {
+template<typename Char, typename Policy>
+[[nodiscard]] constexpr bool operator!=(const basic_hashed_string<Char, Policy> &lhs, const basic_hashed_string<Char, Policy> &rhs) noexcept {
     return !(lhs == rhs);
 }
 
 /**
  * @brief Compares two hashed strings.
  * @tparam Char Character type.
+ * @tparam Policy Hash policy type.
  * @param lhs A valid hashed string.
  * @param rhs A valid hashed string.
  * @return True if the first element is less than the second, false otherwise.
  */
-template<typename Char>
-[[nodiscard]] constexpr bool operator<(const basic_hashed_string<Char> &lhs, const basic_hashed_string<Char> &rhs) noexcept {
+template<typename Char, typename Policy>
+[[nodiscard]] constexpr bool operator<(const basic_hashed_string<Char, Policy> &lhs, const basic_hashed_string<Char, Policy> &rhs) noexcept {
     return lhs.value() < rhs.value();
 }
 
 /**
  * @brief Compares two hashed strings.
  * @tparam Char Character type.
+ * @tparam Policy Hash policy type.
  * @param lhs A valid hashed string.
  * @param rhs A valid hashed string.
  * @return True if the first element is less than or equal to the second, false
  * otherwise.
  */
-template<typename Char>
-[[nodiscard]] constexpr bool operator<=(const basic_hashed_string<Char> &lhs, const basic_hashed_string<Char> &rhs) noexcept {
+template<typename Char, typename Policy>
+[[nodiscard]] constexpr bool operator<=(const basic_hashed_string<Char, Policy> &lhs, const basic_hashed_string<Char, Policy> &rhs) noexcept {
     return !(rhs < lhs);
 }
 
 /**
  * @brief Compares two hashed strings.
  * @tparam Char Character type.
+ * @tparam Policy Hash policy type.
  * @param lhs A valid hashed string.
  * @param rhs A valid hashed string.
  * @return True if the first element is greater than the second, false
  * otherwise.
  */
-template<typename Char>
-[[nodiscard]] constexpr bool operator>(const basic_hashed_string<Char> &lhs, const basic_hashed_string<Char> &rhs) noexcept {
+template<typename Char, typename Policy>
+[[nodiscard]] constexpr bool operator>(const basic_hashed_string<Char, Policy> &lhs, const basic_hashed_string<Char, Policy> &rhs) noexcept {
     return rhs < lhs;
 }
 
 /**
  * @brief Compares two hashed strings.
  * @tparam Char Character type.
+ * @tparam Policy Hash policy type.
  * @param lhs A valid hashed string.
  * @param rhs A valid hashed string.
  * @return True if the first element is greater than or equal to the second,
  * false otherwise.
  */
-template<typename Char>
-[[nodiscard]] constexpr bool operator>=(const basic_hashed_string<Char> &lhs, const basic_hashed_string<Char> &rhs) noexcept {
+template<typename Char, typename Policy>
+[[nodiscard]] constexpr bool operator>=(const basic_hashed_string<Char, Policy> &lhs, const basic_hashed_string<Char, Policy> &rhs) noexcept {
     return !(lhs < rhs);
 }
 
@@ -0,0 +1,358 @@
+#ifndef ENTT_CORE_HASHED_STRING_POOL_HPP
+#define ENTT_CORE_HASHED_STRING_POOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+#include "hashed_string.hpp"
+#include "memory.hpp"
+
+namespace entt {
+
+/**
+ * @brief Pool of interned strings with reverse lookup.
+ *
+ * Strings are copied into pages owned by the pool and never move afterwards.
+ * Therefore, the hashed strings returned by a pool remain valid for as long as
+ * the pool itself and they are safe to store in place of the original
+ * strings.<br/>
+ * Interning the same string twice returns the same hashed string without
+ * copying it again, while numeric identifiers are mapped back to their strings
+ * in constant time.
+ *
+ * @warning
+ * Interning a string whose numeric representation is already taken by a
+ * different string is a collision. Collisions are detected and reported in
+ * debug mode, while the first interned string wins otherwise.
+ *
+ * @tparam Char Character type.
+ * @tparam Policy Hash policy used to compute the numeric representation.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Char, typename Policy, typename Allocator>
+class basic_hashed_string_pool {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Char>, "Invalid value type");
+    using page_type = std::pair<typename alloc_traits::pointer, std::size_t>;
+    using page_container_type = std::vector<page_type, typename alloc_traits::template rebind_alloc<page_type>>;
+    using slot_container_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
+    using entry_container_type = std::vector<basic_hashed_string<Char, Policy>, typename alloc_traits::template rebind_alloc<basic_hashed_string<Char, Policy>>>;
+
+    static constexpr std::size_t page_size = 4096u;
+    static constexpr std::size_t min_slots = 16u;
+
+    [[nodiscard]] std::size_t slot_of(const id_type id) const noexcept {
+        // identifiers are hashes already, spread them once more to cope with weak policies
+        return static_cast<std::size_t>((static_cast<std::uint64_t>(id) * 0x9E3779B97F4A7C15ull) >> 32u) & (slots.size() - 1u);
+    }
+
+    [[nodiscard]] std::size_t find_slot(const id_type id) const noexcept {
+        auto pos = slot_of(id);
+
+        while(slots[pos] != 0u && entries[slots[pos] - 1u].value() != id) {
+            pos = (pos + 1u) & (slots.size() - 1u);
+        }
+
+        return pos;
+    }
+
+    void rehash(const std::size_t count) {
+        slot_container_type other(count, 0u, slots.get_allocator());
+        slots.swap(other);
+
+        for(std::size_t pos{}, last = entries.size(); pos < last; ++pos) {
+            slots[find_slot(entries[pos].value())] = pos + 1u;
+        }
+    }
+
+    [[nodiscard]] Char *copy(const Char *str, const std::size_t len) {
+        allocator_type allocator{get_allocator()};
+
+        if(pages.empty() || (pages.back().second - offset) < (len + 1u)) {
+            const auto sz = (len < page_size) ? page_size : (len + 1u);
+            pages.reserve(pages.size() + 1u);
+            pages.emplace_back(alloc_traits::allocate(allocator, sz), sz);
+            offset = 0u;
+        }
+
+        Char *elem = to_address(pages.back().first) + offset;
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        for(std::size_t pos{}; pos < len; ++pos) {
+            elem[pos] = str[pos];
+        }
+
+        elem[len] = Char{};
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        offset += len + 1u;
+        return elem;
+    }
+
+    void release() noexcept {
+        allocator_type allocator{get_allocator()};
+
+        for(auto &&elem: pages) {
+            alloc_traits::deallocate(allocator, elem.first, elem.second);
+        }
+
+        pages.clear();
+        offset = 0u;
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Character type. */
+    using value_type = Char;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Hashed string type. */
+    using hashed_string_type = basic_hashed_string<Char, Policy>;
+    /*! @brief Random access iterator type. */
+    using const_iterator = typename entry_container_type::const_iterator;
+    /*! @brief Random access iterator type. */
+    using iterator = const_iterator;
+
+    /*! @brief Default constructor. */
+    basic_hashed_string_pool()
+        : basic_hashed_string_pool{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty pool with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_hashed_string_pool(const allocator_type &allocator)
+        : pages{allocator},
+          entries{allocator},
+          slots{allocator},
+          offset{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_hashed_string_pool(const basic_hashed_string_pool &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_hashed_string_pool(basic_hashed_string_pool &&other) noexcept
+        : pages{std::move(other.pages)},
+          entries{std::move(other.entries)},
+          slots{std::move(other.slots)},
+          offset{std::exchange(other.offset, 0u)} {}
+
+    /*! @brief Default destructor. */
+    ~basic_hashed_string_pool() {
+        release();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    basic_hashed_string_pool &operator=(const basic_hashed_string_pool &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This pool.
+     */
+    basic_hashed_string_pool &operator=(basic_hashed_string_pool &&other) noexcept {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a pool is not allowed");
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given pool.
+     * @param other Pool to exchange the content with.
+     */
+    void swap(basic_hashed_string_pool &other) noexcept {
+        using std::swap;
+        swap(pages, other.pages);
+        swap(entries, other.entries);
+        swap(slots, other.slots);
+        swap(offset, other.offset);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return allocator_type{pages.get_allocator()};
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * Strings are returned in the order in which they were interned.
+     *
+     * @return An iterator to the first interned string.
+     */
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        return entries.cbegin();
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator to the element following the last interned string.
+     */
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return entries.cend();
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const noexcept {
+        return cend();
+    }
+
+    /**
+     * @brief Checks whether a pool is empty.
+     * @return True if the pool is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return entries.empty();
+    }
+
+    /**
+     * @brief Returns the number of interned strings.
+     * @return Number of interned strings.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return entries.size();
+    }
+
+    /**
+     * @brief Increases the number of strings that a pool can hold without
+     * rehashing its lookup table.
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) {
+        entries.reserve(cap);
+
+        auto count = (slots.empty() ? min_slots : slots.size());
+        for(; count < (cap * 2u); count *= 2u) {}
+
+        if(count != slots.size()) {
+            rehash(count);
+        }
+    }
+
+    /**
+     * @brief Clears a pool and releases its pages.
+     *
+     * @warning
+     * All hashed strings returned by the pool are invalidated.
+     */
+    void clear() noexcept {
+        release();
+        entries.clear();
+
+        for(auto &&elem: slots) {
+            elem = 0u;
+        }
+    }
+
+    /**
+     * @brief Interns a string.
+     * @param str Human-readable identifier.
+     * @param len Length of the string to intern.
+     * @return A hashed string that refers to the interned string.
+     */
+    hashed_string_type intern(const value_type *str, const size_type len) {
+        const auto id = Policy::hash(str, len);
+
+        if(slots.empty() || (entries.size() * 2u) >= slots.size()) {
+            reserve(entries.size() + 1u);
+        }
+
+        const auto pos = find_slot(id);
+
+        if(slots[pos] != 0u) {
+            [[maybe_unused]] const auto &elem = entries[slots[pos] - 1u];
+            ENTT_ASSERT(elem.size() == len && std::equal(elem.data(), elem.data() + len, str), "Hash collision");
+            return entries[slots[pos] - 1u];
+        }
+
+        entries.emplace_back(copy(str, len), len);
+        slots[pos] = entries.size();
+        return entries.back();
+    }
+
+    /**
+     * @brief Interns a null-terminated string.
+     * @param str Human-readable identifier.
+     * @return A hashed string that refers to the interned string.
+     */
+    hashed_string_type intern(const value_type *str) {
+        size_type len{};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        for(; str[len]; ++len) {}
+        return intern(str, len);
+    }
+
+    /**
+     * @brief Interns the string referred to by a hashed string.
+     * @param hs A valid hashed string.
+     * @return A hashed string that refers to the interned string.
+     */
+    hashed_string_type intern(const hashed_string_type &hs) {
+        return intern(hs.data(), hs.size());
+    }
+
+    /**
+     * @brief Checks if a pool contains a string for a given identifier.
+     * @param id Numeric representation of a string.
+     * @return True if there is such a string, false otherwise.
+     */
+    [[nodiscard]] bool contains(const id_type id) const noexcept {
+        return !slots.empty() && (slots[find_slot(id)] != 0u);
+    }
+
+    /**
+     * @brief Finds the interned string for a given identifier.
+     * @param id Numeric representation of a string.
+     * @return The interned string, if any, an empty hashed string otherwise.
+     */
+    [[nodiscard]] hashed_string_type find(const id_type id) const noexcept {
+        if(!slots.empty()) {
+            if(const auto pos = slots[find_slot(id)]; pos != 0u) {
+                return entries[pos - 1u];
+            }
+        }
+
+        return hashed_string_type{};
+    }
+
+    /**
+     * @brief Returns the interned string for a given identifier.
+     * @param id Numeric representation of a string.
+     * @return The interned string.
+     */
+    [[nodiscard]] const value_type *operator[](const id_type id) const noexcept {
+        ENTT_ASSERT(contains(id), "Invalid identifier");
+        return find(id).data();
+    }
+
+private:
+    page_container_type pages;
+    entry_container_type entries;
+    slot_container_type slots;
+    size_type offset;
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,404 @@
+#ifndef ENTT_CORE_HUGE_PAGE_POOL_HPP
+#define ENTT_CORE_HUGE_PAGE_POOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+
+#if __has_include(<sys/mman.h>)
+#    include <sys/mman.h>
+#endif
+
+namespace entt {
+
+/**
+ * @brief Pool that carves memory blocks from huge pages.
+ *
+ * Large worlds spread their storage classes over many pages of memory and pay
+ * for it with misses in the translation lookaside buffer. This pool maps its
+ * memory in chunks that are aligned to and multiple of the size of a huge
+ * page and, where supported, asks the system to back them with huge pages
+ * (`madvise` with `MADV_HUGEPAGE`).<br/>
+ * Blocks are carved from the current chunk by bumping a pointer. Deallocated
+ * blocks are kept in a free list for their size and alignment and recycled by
+ * later allocations of the same kind, while blocks larger than a chunk get
+ * their own mapping, that is returned to the system on deallocation.
+ *
+ * Platforms without `mmap` fall back to aligned allocations from the global
+ * operator new, as well as chunks for which a mapping fails.
+ *
+ * @note
+ * Allocations and deallocations are synchronized. Therefore, containers that
+ * share a pool can be safely used from different threads, as long as each of
+ * them is accessed by only one thread at a time.
+ */
+class huge_page_pool final {
+    struct chunk_type {
+        std::byte *data;
+        std::size_t bytes;
+        bool mapped;
+    };
+
+    struct bucket {
+        std::size_t bytes;
+        std::size_t alignment;
+        std::vector<void *> blocks;
+    };
+
+    [[nodiscard]] static std::size_t round_up(const std::size_t bytes) noexcept {
+        return ((bytes + huge_page_size - 1u) / huge_page_size) * huge_page_size;
+    }
+
+    [[nodiscard]] static chunk_type map(const std::size_t bytes) {
+#if __has_include(<sys/mman.h>)
+        // mappings are only aligned to regular pages, exceeding parts are trimmed
+        if(void *addr = ::mmap(nullptr, bytes + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0); addr != MAP_FAILED) {
+            auto *first = static_cast<std::byte *>(addr);
+            auto *data = first + (huge_page_size - (reinterpret_cast<std::uintptr_t>(first) % huge_page_size)) % huge_page_size;
+
+            if(data != first) {
+                ::munmap(first, static_cast<std::size_t>(data - first));
+            }
+
+            if(auto *last = data + bytes, *end = first + bytes + huge_page_size; last != end) {
+                ::munmap(last, static_cast<std::size_t>(end - last));
+            }
+
+#    ifdef MADV_HUGEPAGE
+            ::madvise(data, bytes, MADV_HUGEPAGE);
+#    endif
+
+            return chunk_type{data, bytes, true};
+        }
+#endif
+
+        return chunk_type{static_cast<std::byte *>(::operator new(bytes, std::align_val_t{huge_page_size})), bytes, false};
+    }
+
+    static void unmap(const chunk_type &elem) noexcept {
+#if __has_include(<sys/mman.h>)
+        if(elem.mapped) {
+            ::munmap(elem.data, elem.bytes);
+            return;
+        }
+#endif
+
+        ::operator delete(elem.data, std::align_val_t{huge_page_size});
+    }
+
+    [[nodiscard]] bucket *bucket_for(const std::size_t bytes, const std::size_t alignment) noexcept {
+        for(auto &&curr: buckets) {
+            if(curr.bytes == bytes && curr.alignment == alignment) {
+                return &curr;
+            }
+        }
+
+        return nullptr;
+    }
+
+    [[nodiscard]] void *carve(const std::size_t bytes, const std::size_t alignment) noexcept {
+        if(!buffers.empty()) {
+            void *ptr = buffers.back().data + offset;
+
+            if(auto space = buffers.back().bytes - offset; std::align(alignment, bytes, ptr, space)) {
+                offset = buffers.back().bytes - space + bytes;
+                return ptr;
+            }
+        }
+
+        return nullptr;
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Size of a huge page in bytes. */
+    static constexpr size_type huge_page_size = 2u * 1024u * 1024u;
+
+    /**
+     * @brief Constructs a pool with a given size for its chunks.
+     * @param bytes Size in bytes of the chunks, rounded up to the size of a
+     * huge page.
+     */
+    explicit huge_page_pool(const size_type bytes = huge_page_size)
+        : length{round_up(bytes)} {
+        ENTT_ASSERT(length != 0u, "Invalid chunk length");
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    huge_page_pool(const huge_page_pool &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    huge_page_pool(huge_page_pool &&) = delete;
+
+    /*! @brief Returns all chunks to the system. */
+    ~huge_page_pool() {
+        release();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    huge_page_pool &operator=(const huge_page_pool &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    huge_page_pool &operator=(huge_page_pool &&) = delete;
+
+    /**
+     * @brief Allocates a block, possibly recycling a cached one.
+     * @param bytes The size of the block in bytes.
+     * @param alignment The alignment of the block, at most a huge page.
+     * @return A pointer to the allocated block.
+     */
+    [[nodiscard]] void *allocate(const size_type bytes, const size_type alignment) {
+        ENTT_ASSERT(alignment <= huge_page_size, "Invalid alignment");
+        const std::lock_guard guard{mutex};
+
+        if(bytes > length) {
+            large.reserve(large.size() + 1u);
+            return large.emplace_back(map(round_up(bytes))).data;
+        }
+
+        if(auto *curr = bucket_for(bytes, alignment); curr && !curr->blocks.empty()) {
+            void *block = curr->blocks.back();
+            curr->blocks.pop_back();
+            return block;
+        }
+
+        if(void *ptr = carve(bytes, alignment); ptr) {
+            return ptr;
+        }
+
+        buffers.reserve(buffers.size() + 1u);
+        buffers.emplace_back(map(length));
+        offset = 0u;
+
+        return carve(bytes, alignment);
+    }
+
+    /**
+     * @brief Puts a block back in the pool for later reuse or returns it to
+     * the system if it has its own mapping.
+     * @param block A block previously obtained from the pool.
+     * @param bytes The size of the block in bytes.
+     * @param alignment The alignment of the block.
+     */
+    void deallocate(void *block, const size_type bytes, const size_type alignment) noexcept {
+        const std::lock_guard guard{mutex};
+
+        if(bytes > length) {
+            const auto it = std::find_if(large.begin(), large.end(), [block](const chunk_type &elem) { return elem.data == block; });
+            ENTT_ASSERT(it != large.end(), "Invalid block");
+            unmap(*it);
+            large.erase(it);
+            return;
+        }
+
+        ENTT_TRY {
+            auto *curr = bucket_for(bytes, alignment);
+
+            if(curr == nullptr) {
+                curr = &buckets.emplace_back(bucket{bytes, alignment, {}});
+            }
+
+            curr->blocks.push_back(block);
+        }
+        ENTT_CATCH {
+            // the block is lost until the pool is released
+        }
+    }
+
+    /**
+     * @brief Returns all chunks to the system.
+     *
+     * @warning
+     * All blocks allocated so far are invalidated, including those with their
+     * own mapping.
+     */
+    void release() noexcept {
+        const std::lock_guard guard{mutex};
+
+        for(auto &&elem: buffers) {
+            unmap(elem);
+        }
+
+        for(auto &&elem: large) {
+            unmap(elem);
+        }
+
+        buffers.clear();
+        large.clear();
+        buckets.clear();
+        offset = 0u;
+    }
+
+    /**
+     * @brief Returns the number of chunks mapped so far.
+     * @return Number of chunks mapped so far.
+     */
+    [[nodiscard]] size_type chunks() const {
+        const std::lock_guard guard{mutex};
+        return buffers.size();
+    }
+
+    /**
+     * @brief Returns the total size of the memory currently mapped.
+     * @return Total size in bytes of the memory currently mapped.
+     */
+    [[nodiscard]] size_type capacity() const {
+        const std::lock_guard guard{mutex};
+        size_type total{};
+
+        for(auto &&elem: buffers) {
+            total += elem.bytes;
+        }
+
+        for(auto &&elem: large) {
+            total += elem.bytes;
+        }
+
+        return total;
+    }
+
+private:
+    mutable std::mutex mutex{};
+    std::vector<chunk_type> buffers{};
+    std::vector<chunk_type> large{};
+    std::vector<bucket> buckets{};
+    size_type length;
+    size_type offset{};
+};
+
+/**
+ * @brief Allocator that draws memory from a shared huge page pool.
+ *
+ * All copies of an allocator, including rebound ones, share the same pool.
+ * Therefore, a registry that uses this allocator gets its sparse and packed
+ * pages from the same huge pages.
+ *
+ * @tparam Type Type of elements to allocate.
+ */
+template<typename Type>
+class huge_page_allocator {
+    template<typename>
+    friend class huge_page_allocator;
+
+public:
+    /*! @brief Type of elements to allocate. */
+    using value_type = Type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Allocators are propagated on copy assignment. */
+    using propagate_on_container_copy_assignment = std::true_type;
+    /*! @brief Allocators are propagated on move assignment. */
+    using propagate_on_container_move_assignment = std::true_type;
+    /*! @brief Allocators are propagated on swap. */
+    using propagate_on_container_swap = std::true_type;
+
+    /*! @brief Default constructor, creates a new pool. */
+    huge_page_allocator()
+        : pool{std::make_shared<huge_page_pool>()} {}
+
+    /**
+     * @brief Constructs an allocator that uses a given pool.
+     * @param ref A valid pool.
+     */
+    explicit huge_page_allocator(std::shared_ptr<huge_page_pool> ref) noexcept
+        : pool{std::move(ref)} {
+        ENTT_ASSERT(pool, "Invalid pool");
+    }
+
+    /**
+     * @brief Copy constructor. Moving an allocator copies it instead, so that
+     * moved-from containers remain usable.
+     * @param other The instance to copy from.
+     */
+    huge_page_allocator(const huge_page_allocator &other) noexcept = default;
+
+    /**
+     * @brief Converting constructor.
+     * @tparam Other Type of elements of the other allocator.
+     * @param other The instance to copy from.
+     */
+    template<typename Other>
+    huge_page_allocator(const huge_page_allocator<Other> &other) noexcept
+        : pool{other.pool} {}
+
+    /*! @brief Default destructor. */
+    ~huge_page_allocator() = default;
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The instance to copy from.
+     * @return This allocator.
+     */
+    huge_page_allocator &operator=(const huge_page_allocator &other) noexcept = default;
+
+    /**
+     * @brief Allocates uninitialized storage for a number of elements.
+     * @param length Number of elements to allocate.
+     * @return A pointer to the allocated storage.
+     */
+    [[nodiscard]] Type *allocate(const size_type length) {
+        return static_cast<Type *>(pool->allocate(length * sizeof(Type), alignof(Type)));
+    }
+
+    /**
+     * @brief Gives the storage back to the pool.
+     * @param ptr A pointer previously obtained from the allocator.
+     * @param length Number of elements of the allocation.
+     */
+    void deallocate(Type *ptr, const size_type length) noexcept {
+        pool->deallocate(ptr, length * sizeof(Type), alignof(Type));
+    }
+
+    /**
+     * @brief Returns the underlying pool.
+     * @return The underlying pool.
+     */
+    [[nodiscard]] std::shared_ptr<huge_page_pool> resource() const noexcept {
+        return pool;
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of elements of the other allocator.
+     * @param other Allocator with which to compare.
+     * @return True if the two allocators share the same pool, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] bool operator==(const huge_page_allocator<Other> &other) const noexcept {
+        return (pool == other.pool);
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of elements of the other allocator.
+     * @param other Allocator with which to compare.
+     * @return True if the two allocators use different pools, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] bool operator!=(const huge_page_allocator<Other> &other) const noexcept {
+        return !(*this == other);
+    }
+
+private:
+    std::shared_ptr<huge_page_pool> pool;
+};
+
+} // namespace entt
+
+#endif
@@ -177,7 +177,7 @@ struct uses_allocator_construction<std::pair<Type, Other>> {
 
     template<typename Allocator, typename First, typename Second>
     static constexpr auto args(const Allocator &allocator, std::pair<First, Second> &&value) noexcept {
-        return uses_allocator_construction<type>::args(allocator, std::piecewise_construct, std::forward_as_tuple(std::move(value.first)), std::forward_as_tuple(std::move(value.second)));
+        return uses_allocator_construction<type>::args(allocator, std::piecewise_construct, std::forward_as_tuple(std::get<0u>(std::move(value))), std::forward_as_tuple(std::get<1u>(std::move(value))));
     }
 };
 
@@ -0,0 +1,280 @@
+#ifndef ENTT_CORE_MONOTONIC_POOL_HPP
+#define ENTT_CORE_MONOTONIC_POOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Pool that hands out memory by bumping a pointer.
+ *
+ * Memory is carved from chunks of growing size and deallocations don't return
+ * it to the pool, except for the last allocation that is rolled back instead.
+ * This makes allocations nearly free and is meant for short-lived objects (such
+ * as whole registries) that are destroyed all at once.<br/>
+ * Once all objects that use the pool are gone, the `reset` function makes all
+ * chunks available again for the next round of allocations, while `release`
+ * returns them to the system.
+ *
+ * @warning
+ * Allocations and deallocations aren't synchronized. A pool must not be used
+ * by multiple threads at the same time.
+ */
+class monotonic_pool final {
+    using chunk_type = std::pair<std::byte *, std::size_t>;
+
+    [[nodiscard]] void *carve(const std::size_t bytes, const std::size_t alignment) noexcept {
+        void *ptr = buffers[current].first + offset;
+
+        if(auto space = buffers[current].second - offset; std::align(alignment, bytes, ptr, space)) {
+            offset = buffers[current].second - space + bytes;
+            return ptr;
+        }
+
+        return nullptr;
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a pool with a given size for its first chunk.
+     * @param bytes Size in bytes of the first chunk, at least one.
+     */
+    explicit monotonic_pool(const size_type bytes = 65536u)
+        : length{bytes} {
+        ENTT_ASSERT(length != 0u, "Invalid chunk length");
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    monotonic_pool(const monotonic_pool &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    monotonic_pool(monotonic_pool &&) = delete;
+
+    /*! @brief Returns all chunks to the system. */
+    ~monotonic_pool() {
+        release();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    monotonic_pool &operator=(const monotonic_pool &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    monotonic_pool &operator=(monotonic_pool &&) = delete;
+
+    /**
+     * @brief Allocates a block from the current chunk or from a new one.
+     * @param bytes The size of the block in bytes.
+     * @param alignment The alignment of the block.
+     * @return A pointer to the allocated block.
+     */
+    [[nodiscard]] void *allocate(const size_type bytes, const size_type alignment) {
+        for(; current < buffers.size(); ++current, offset = 0u) {
+            if(void *ptr = carve(bytes, alignment); ptr) {
+                return ptr;
+            }
+        }
+
+        const auto sz = (std::max)(buffers.empty() ? length : (buffers.back().second * 2u), bytes + alignment);
+        buffers.reserve(buffers.size() + 1u);
+        buffers.emplace_back(static_cast<std::byte *>(::operator new(sz)), sz);
+        current = buffers.size() - 1u;
+        offset = 0u;
+
+        return carve(bytes, alignment);
+    }
+
+    /**
+     * @brief Rolls back the last allocation, if any, does nothing otherwise.
+     * @param block A block previously obtained from the pool.
+     * @param bytes The size of the block in bytes.
+     */
+    void deallocate(void *block, const size_type bytes, const size_type) noexcept {
+        if(current < buffers.size() && (static_cast<std::byte *>(block) + bytes) == (buffers[current].first + offset)) {
+            offset -= bytes;
+        }
+    }
+
+    /**
+     * @brief Makes all chunks available again for later allocations.
+     *
+     * @warning
+     * All blocks allocated so far are invalidated.
+     */
+    void reset() noexcept {
+        current = 0u;
+        offset = 0u;
+    }
+
+    /*! @brief Returns all chunks to the system. */
+    void release() noexcept {
+        for(auto &&curr: buffers) {
+            ::operator delete(curr.first);
+        }
+
+        buffers.clear();
+        reset();
+    }
+
+    /**
+     * @brief Returns the number of chunks allocated so far.
+     * @return Number of chunks allocated so far.
+     */
+    [[nodiscard]] size_type chunks() const noexcept {
+        return buffers.size();
+    }
+
+    /**
+     * @brief Returns the total size of the chunks allocated so far.
+     * @return Total size in bytes of the chunks allocated so far.
+     */
+    [[nodiscard]] size_type capacity() const noexcept {
+        size_type total{};
+
+        for(auto &&curr: buffers) {
+            total += curr.second;
+        }
+
+        return total;
+    }
+
+private:
+    std::vector<chunk_type> buffers{};
+    size_type length;
+    size_type current{};
+    size_type offset{};
+};
+
+/**
+ * @brief Allocator that draws memory from a shared monotonic pool.
+ *
+ * All copies of an allocator, including rebound ones, share the same pool.
+ * Therefore, a registry that uses this allocator gets its pools, storage
+ * classes, sparse pages and signals from the same chunks of memory.<br/>
+ * Pools aren't owned by their allocators, so that copying an allocator is as
+ * cheap as copying a pointer. It's up to the user to make sure that a pool
+ * outlives all the containers that use it.
+ *
+ * @tparam Type Type of elements to allocate.
+ */
+template<typename Type>
+class monotonic_pool_allocator {
+    template<typename>
+    friend class monotonic_pool_allocator;
+
+public:
+    /*! @brief Type of elements to allocate. */
+    using value_type = Type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Allocators are propagated on copy assignment. */
+    using propagate_on_container_copy_assignment = std::true_type;
+    /*! @brief Allocators are propagated on move assignment. */
+    using propagate_on_container_move_assignment = std::true_type;
+    /*! @brief Allocators are propagated on swap. */
+    using propagate_on_container_swap = std::true_type;
+
+    /**
+     * @brief Constructs an allocator that uses a given pool.
+     * @param ref A valid pool.
+     */
+    explicit monotonic_pool_allocator(monotonic_pool &ref) noexcept
+        : pool{&ref} {}
+
+    /**
+     * @brief Copy constructor. Moving an allocator copies it instead, so that
+     * moved-from containers remain usable.
+     * @param other The instance to copy from.
+     */
+    monotonic_pool_allocator(const monotonic_pool_allocator &other) noexcept = default;
+
+    /**
+     * @brief Converting constructor.
+     * @tparam Other Type of elements of the other allocator.
+     * @param other The instance to copy from.
+     */
+    template<typename Other>
+    monotonic_pool_allocator(const monotonic_pool_allocator<Other> &other) noexcept
+        : pool{other.pool} {}
+
+    /*! @brief Default destructor. */
+    ~monotonic_pool_allocator() = default;
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The instance to copy from.
+     * @return This allocator.
+     */
+    monotonic_pool_allocator &operator=(const monotonic_pool_allocator &other) noexcept = default;
+
+    /**
+     * @brief Allocates uninitialized storage for a number of elements.
+     * @param length Number of elements to allocate.
+     * @return A pointer to the allocated storage.
+     */
+    [[nodiscard]] Type *allocate(const size_type length) {
+        return static_cast<Type *>(pool->allocate(length * sizeof(Type), alignof(Type)));
+    }
+
+    /**
+     * @brief Gives the storage back to the pool.
+     * @param ptr A pointer previously obtained from the allocator.
+     * @param length Number of elements of the allocation.
+     */
+    void deallocate(Type *ptr, const size_type length) noexcept {
+        pool->deallocate(ptr, length * sizeof(Type), alignof(Type));
+    }
+
+    /**
+     * @brief Returns the underlying pool.
+     * @return The underlying pool.
+     */
+    [[nodiscard]] monotonic_pool *resource() const noexcept {
+        return pool;
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of elements of the other allocator.
+     * @param other Allocator with which to compare.
+     * @return True if the two allocators share the same pool, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] bool operator==(const monotonic_pool_allocator<Other> &other) const noexcept {
+        return (pool == other.pool);
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of elements of the other allocator.
+     * @param other Allocator with which to compare.
+     * @return True if the two allocators use different pools, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] bool operator!=(const monotonic_pool_allocator<Other> &other) const noexcept {
+        return !(*this == other);
+    }
+
+private:
+    monotonic_pool *pool;
+};
+
+} // namespace entt
+
+#endif
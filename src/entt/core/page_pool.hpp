@@ -0,0 +1,273 @@
+#ifndef ENTT_CORE_PAGE_POOL_HPP
+#define ENTT_CORE_PAGE_POOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Shared pool of memory blocks.
+ *
+ * Deallocated blocks aren't returned to the system. Instead, they are kept in a
+ * free list for their size and alignment and recycled by later allocations of
+ * the same kind.<br/>
+ * This is meant for page-based containers such as sparse sets and storage
+ * classes, where many instances allocate and release blocks of the same size.
+ * Blocks are only returned to the system on destruction or when explicitly
+ * requested by means of the `release` function.
+ *
+ * @note
+ * Allocations and deallocations are synchronized. Therefore, containers that
+ * share a pool can be safely used from different threads, as long as each of
+ * them is accessed by only one thread at a time.
+ */
+class page_pool final {
+    struct bucket {
+        std::size_t bytes;
+        std::size_t alignment;
+        std::vector<void *> blocks;
+    };
+
+    [[nodiscard]] bucket *bucket_for(const std::size_t bytes, const std::size_t alignment) noexcept {
+        for(auto &&curr: buckets) {
+            if(curr.bytes == bytes && curr.alignment == alignment) {
+                return &curr;
+            }
+        }
+
+        return nullptr;
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    page_pool() = default;
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    page_pool(const page_pool &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    page_pool(page_pool &&) = delete;
+
+    /*! @brief Returns all cached blocks to the system. */
+    ~page_pool() {
+        release();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    page_pool &operator=(const page_pool &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    page_pool &operator=(page_pool &&) = delete;
+
+    /**
+     * @brief Allocates a block, possibly recycling a cached one.
+     * @param bytes The size of the block in bytes.
+     * @param alignment The alignment of the block.
+     * @return A pointer to the allocated block.
+     */
+    [[nodiscard]] void *allocate(const size_type bytes, const size_type alignment) {
+        {
+            const std::lock_guard guard{mutex};
+
+            if(auto *curr = bucket_for(bytes, alignment); curr && !curr->blocks.empty()) {
+                void *block = curr->blocks.back();
+                curr->blocks.pop_back();
+                return block;
+            }
+        }
+
+        return ::operator new(bytes, std::align_val_t{alignment});
+    }
+
+    /**
+     * @brief Puts a block back in the pool for later reuse.
+     * @param block A block previously obtained from the pool.
+     * @param bytes The size of the block in bytes.
+     * @param alignment The alignment of the block.
+     */
+    void deallocate(void *block, const size_type bytes, const size_type alignment) noexcept {
+        const std::lock_guard guard{mutex};
+
+        ENTT_TRY {
+            auto *curr = bucket_for(bytes, alignment);
+
+            if(curr == nullptr) {
+                curr = &buckets.emplace_back(bucket{bytes, alignment, {}});
+            }
+
+            curr->blocks.push_back(block);
+        }
+        ENTT_CATCH {
+            ::operator delete(block, std::align_val_t{alignment});
+        }
+    }
+
+    /**
+     * @brief Returns the number of cached blocks.
+     * @return Number of cached blocks.
+     */
+    [[nodiscard]] size_type size() const {
+        const std::lock_guard guard{mutex};
+        size_type count{};
+
+        for(auto &&curr: buckets) {
+            count += curr.blocks.size();
+        }
+
+        return count;
+    }
+
+    /*! @brief Returns all cached blocks to the system. */
+    void release() noexcept {
+        const std::lock_guard guard{mutex};
+
+        for(auto &&curr: buckets) {
+            for(auto *block: curr.blocks) {
+                ::operator delete(block, std::align_val_t{curr.alignment});
+            }
+        }
+
+        buckets.clear();
+    }
+
+private:
+    mutable std::mutex mutex{};
+    std::vector<bucket> buckets{};
+};
+
+/**
+ * @brief Allocator that draws memory from a shared page pool.
+ *
+ * All copies of an allocator, including rebound ones, share the same pool.
+ * Therefore, a registry that uses this allocator makes all its storage classes
+ * recycle sparse and packed pages among themselves.
+ *
+ * @tparam Type Type of elements to allocate.
+ */
+template<typename Type>
+class page_pool_allocator {
+    template<typename>
+    friend class page_pool_allocator;
+
+public:
+    /*! @brief Type of elements to allocate. */
+    using value_type = Type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Allocators are propagated on copy assignment. */
+    using propagate_on_container_copy_assignment = std::true_type;
+    /*! @brief Allocators are propagated on move assignment. */
+    using propagate_on_container_move_assignment = std::true_type;
+    /*! @brief Allocators are propagated on swap. */
+    using propagate_on_container_swap = std::true_type;
+
+    /*! @brief Default constructor, creates a new pool. */
+    page_pool_allocator()
+        : pool{std::make_shared<page_pool>()} {}
+
+    /**
+     * @brief Constructs an allocator that uses a given pool.
+     * @param ref A valid pool.
+     */
+    explicit page_pool_allocator(std::shared_ptr<page_pool> ref) noexcept
+        : pool{std::move(ref)} {
+        ENTT_ASSERT(pool, "Invalid pool");
+    }
+
+    /**
+     * @brief Copy constructor. Moving an allocator copies it instead, so that
+     * moved-from containers remain usable.
+     * @param other The instance to copy from.
+     */
+    page_pool_allocator(const page_pool_allocator &other) noexcept = default;
+
+    /**
+     * @brief Converting constructor.
+     * @tparam Other Type of elements of the other allocator.
+     * @param other The instance to copy from.
+     */
+    template<typename Other>
+    page_pool_allocator(const page_pool_allocator<Other> &other) noexcept
+        : pool{other.pool} {}
+
+    /*! @brief Default destructor. */
+    ~page_pool_allocator() = default;
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The instance to copy from.
+     * @return This allocator.
+     */
+    page_pool_allocator &operator=(const page_pool_allocator &other) noexcept = default;
+
+    /**
+     * @brief Allocates uninitialized storage for a number of elements.
+     * @param length Number of elements to allocate.
+     * @return A pointer to the allocated storage.
+     */
+    [[nodiscard]] Type *allocate(const size_type length) {
+        return static_cast<Type *>(pool->allocate(length * sizeof(Type), alignof(Type)));
+    }
+
+    /**
+     * @brief Puts the storage back in the pool.
+     * @param ptr A pointer previously obtained from the allocator.
+     * @param length Number of elements of the allocation.
+     */
+    void deallocate(Type *ptr, const size_type length) noexcept {
+        pool->deallocate(ptr, length * sizeof(Type), alignof(Type));
+    }
+
+    /**
+     * @brief Returns the underlying pool.
+     * @return The underlying pool.
+     */
+    [[nodiscard]] std::shared_ptr<page_pool> resource() const noexcept {
+        return pool;
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of elements of the other allocator.
+     * @param other Allocator with which to compare.
+     * @return True if the two allocators share the same pool, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] bool operator==(const page_pool_allocator<Other> &other) const noexcept {
+        return (pool == other.pool);
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of elements of the other allocator.
+     * @param other Allocator with which to compare.
+     * @return True if the two allocators use different pools, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] bool operator!=(const page_pool_allocator<Other> &other) const noexcept {
+        return !(*this == other);
+    }
+
+private:
+    std::shared_ptr<page_pool> pool;
+};
+
+} // namespace entt
+
+#endif
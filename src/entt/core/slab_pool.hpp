@@ -0,0 +1,300 @@
+#ifndef ENTT_CORE_SLAB_POOL_HPP
+#define ENTT_CORE_SLAB_POOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Pool of fixed size blocks carved from larger chunks.
+ *
+ * Blocks of the same size and alignment are allocated in chunks and are handed
+ * out from a free list. Released blocks go back to the free list and are reused
+ * by later allocations of the same kind.<br/>
+ * This is meant for many small, short-lived objects of a few types (such as
+ * processes), that end up next to each other in memory and don't pay for a
+ * call to the global allocator every time they are created or destroyed.
+ *
+ * @warning
+ * Allocations and deallocations aren't synchronized. A pool must not be used
+ * by multiple threads at the same time.
+ */
+class slab_pool final {
+    struct free_block {
+        free_block *next;
+    };
+
+    struct bucket {
+        std::size_t bytes;
+        std::size_t alignment;
+        free_block *head;
+        std::vector<void *> chunks;
+    };
+
+    [[nodiscard]] bucket &bucket_for(const std::size_t bytes, const std::size_t alignment) {
+        for(auto &&curr: buckets) {
+            if(curr.bytes == bytes && curr.alignment == alignment) {
+                return curr;
+            }
+        }
+
+        return buckets.emplace_back(bucket{bytes, alignment, nullptr, {}});
+    }
+
+    void grow(bucket &curr) {
+        const auto stride = curr.bytes;
+        curr.chunks.reserve(curr.chunks.size() + 1u);
+        auto *chunk = static_cast<std::byte *>(::operator new(stride * length, std::align_val_t{curr.alignment}));
+        curr.chunks.push_back(chunk);
+
+        // linked in reverse, so that blocks are handed out in address order
+        for(auto pos = length; pos; --pos) {
+            curr.head = ::new(chunk + stride * (pos - 1u)) free_block{curr.head};
+        }
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a pool with a given number of blocks per chunk.
+     * @param blocks Number of blocks per chunk, at least one.
+     */
+    explicit slab_pool(const size_type blocks = 64u)
+        : length{blocks} {
+        ENTT_ASSERT(length != 0u, "Invalid chunk length");
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    slab_pool(const slab_pool &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    slab_pool(slab_pool &&) = delete;
+
+    /*! @brief Returns all chunks to the system. */
+    ~slab_pool() {
+        for(auto &&curr: buckets) {
+            for(auto *chunk: curr.chunks) {
+                ::operator delete(chunk, std::align_val_t{curr.alignment});
+            }
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    slab_pool &operator=(const slab_pool &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This pool.
+     */
+    slab_pool &operator=(slab_pool &&) = delete;
+
+    /**
+     * @brief Allocates a block, possibly recycling a released one.
+     * @param bytes The size of the block in bytes.
+     * @param alignment The alignment of the block.
+     * @return A pointer to the allocated block.
+     */
+    [[nodiscard]] void *allocate(const size_type bytes, const size_type alignment) {
+        const auto align = (std::max)(alignment, alignof(free_block));
+        auto &curr = bucket_for((((std::max)(bytes, sizeof(free_block)) + align - 1u) / align) * align, align);
+
+        if(curr.head == nullptr) {
+            grow(curr);
+        }
+
+        auto *block = curr.head;
+        curr.head = block->next;
+        ++count;
+
+        return block;
+    }
+
+    /**
+     * @brief Puts a block back in the pool for later reuse.
+     * @param block A block previously obtained from the pool.
+     * @param bytes The size of the block in bytes.
+     * @param alignment The alignment of the block.
+     */
+    void deallocate(void *block, const size_type bytes, const size_type alignment) noexcept {
+        const auto align = (std::max)(alignment, alignof(free_block));
+        const auto stride = (((std::max)(bytes, sizeof(free_block)) + align - 1u) / align) * align;
+
+        for(auto &&curr: buckets) {
+            if(curr.bytes == stride && curr.alignment == align) {
+                curr.head = ::new(block) free_block{curr.head};
+                --count;
+                return;
+            }
+        }
+
+        ENTT_ASSERT(false, "Unknown block");
+    }
+
+    /**
+     * @brief Returns the number of blocks in use.
+     * @return Number of blocks in use.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return count;
+    }
+
+    /**
+     * @brief Returns the number of chunks allocated so far.
+     * @return Number of chunks allocated so far.
+     */
+    [[nodiscard]] size_type chunks() const noexcept {
+        size_type total{};
+
+        for(auto &&curr: buckets) {
+            total += curr.chunks.size();
+        }
+
+        return total;
+    }
+
+private:
+    std::vector<bucket> buckets{};
+    size_type length;
+    size_type count{};
+};
+
+/**
+ * @brief Allocator that draws single elements from a shared slab pool.
+ *
+ * All copies of an allocator, including rebound ones, share the same pool.
+ * Single elements are carved from the chunks of the pool, while arrays of
+ * elements are forwarded to the global allocator.
+ *
+ * @tparam Type Type of elements to allocate.
+ */
+template<typename Type>
+class slab_pool_allocator {
+    template<typename>
+    friend class slab_pool_allocator;
+
+public:
+    /*! @brief Type of elements to allocate. */
+    using value_type = Type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Allocators are propagated on copy assignment. */
+    using propagate_on_container_copy_assignment = std::true_type;
+    /*! @brief Allocators are propagated on move assignment. */
+    using propagate_on_container_move_assignment = std::true_type;
+    /*! @brief Allocators are propagated on swap. */
+    using propagate_on_container_swap = std::true_type;
+
+    /*! @brief Default constructor, creates a new pool. */
+    slab_pool_allocator()
+        : pool{std::make_shared<slab_pool>()} {}
+
+    /**
+     * @brief Constructs an allocator that uses a given pool.
+     * @param ref A valid pool.
+     */
+    explicit slab_pool_allocator(std::shared_ptr<slab_pool> ref) noexcept
+        : pool{std::move(ref)} {
+        ENTT_ASSERT(pool, "Invalid pool");
+    }
+
+    /**
+     * @brief Copy constructor. Moving an allocator copies it instead, so that
+     * moved-from containers remain usable.
+     * @param other The instance to copy from.
+     */
+    slab_pool_allocator(const slab_pool_allocator &other) noexcept = default;
+
+    /**
+     * @brief Converting constructor.
+     * @tparam Other Type of elements of the other allocator.
+     * @param other The instance to copy from.
+     */
+    template<typename Other>
+    slab_pool_allocator(const slab_pool_allocator<Other> &other) noexcept
+        : pool{other.pool} {}
+
+    /*! @brief Default destructor. */
+    ~slab_pool_allocator() = default;
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The instance to copy from.
+     * @return This allocator.
+     */
+    slab_pool_allocator &operator=(const slab_pool_allocator &other) noexcept = default;
+
+    /**
+     * @brief Allocates uninitialized storage for a number of elements.
+     * @param length Number of elements to allocate.
+     * @return A pointer to the allocated storage.
+     */
+    [[nodiscard]] Type *allocate(const size_type length) {
+        if(length == 1u) {
+            return static_cast<Type *>(pool->allocate(sizeof(Type), alignof(Type)));
+        }
+
+        return static_cast<Type *>(::operator new(length * sizeof(Type), std::align_val_t{alignof(Type)}));
+    }
+
+    /**
+     * @brief Returns the storage to the pool or to the system.
+     * @param ptr A pointer previously obtained from the allocator.
+     * @param length Number of elements of the allocation.
+     */
+    void deallocate(Type *ptr, const size_type length) noexcept {
+        if(length == 1u) {
+            pool->deallocate(ptr, sizeof(Type), alignof(Type));
+        } else {
+            ::operator delete(ptr, std::align_val_t{alignof(Type)});
+        }
+    }
+
+    /**
+     * @brief Returns the underlying pool.
+     * @return The underlying pool.
+     */
+    [[nodiscard]] std::shared_ptr<slab_pool> resource() const noexcept {
+        return pool;
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of elements of the other allocator.
+     * @param other Allocator with which to compare.
+     * @return True if the two allocators share the same pool, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] bool operator==(const slab_pool_allocator<Other> &other) const noexcept {
+        return (pool == other.pool);
+    }
+
+    /**
+     * @brief Compares two allocators.
+     * @tparam Other Type of elements of the other allocator.
+     * @param other Allocator with which to compare.
+     * @return True if the two allocators use different pools, false otherwise.
+     */
+    template<typename Other>
+    [[nodiscard]] bool operator!=(const slab_pool_allocator<Other> &other) const noexcept {
+        return !(*this == other);
+    }
+
+private:
+    std::shared_ptr<slab_pool> pool;
+};
+
+} // namespace entt
+
+#endif
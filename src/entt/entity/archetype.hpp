@@ -0,0 +1,469 @@
+#ifndef ENTT_ENTITY_ARCHETYPE_HPP
+#define ENTT_ENTITY_ARCHETYPE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/bit.hpp"
+#include "../core/type_traits.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "sparse_set.hpp"
+
+namespace entt {
+
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+[[nodiscard]] constexpr std::size_t archetype_chunk_rows(const std::size_t bytes, const std::size_t row) noexcept {
+    std::size_t rows = 1u;
+
+    for(; (rows * 2u * row) <= bytes; rows *= 2u) {}
+
+    return rows;
+}
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Chunked storage for entities that share the same set of elements.
+ *
+ * Entities are assigned all the elements of an archetype at once. Elements are
+ * stored in chunks of `chunk_bytes` bytes, one contiguous array per type within
+ * each chunk. Iterating the chunks turns wide queries into linear streams, with
+ * no lookups and no filtering.<br/>
+ * Rows are kept tightly packed, removing an entity moves the last one in its
+ * place. An archetype doesn't notify the registry and isn't a storage of the
+ * latter, although it's common to keep it in the context of a registry.
+ *
+ * @tparam Type Types of elements assigned to entities.
+ * @tparam Entity A valid entity type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename... Type, typename Entity, typename Allocator>
+class basic_archetype<type_list<Type...>, Entity, Allocator> {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Entity>, "Invalid value type");
+    static_assert(sizeof...(Type) != 0u && ((std::is_same_v<Type, std::decay_t<Type>> && !std::is_same_v<Type, Entity>) && ...), "Invalid element types");
+
+    template<typename Elem>
+    using allocator_for = typename alloc_traits::template rebind_alloc<Elem>;
+
+    template<typename Elem>
+    using column_type = std::vector<Elem *, allocator_for<Elem *>>;
+
+    using container_type = std::tuple<column_type<Type>...>;
+
+    template<typename Elem>
+    static constexpr std::size_t index_of = type_list_index_v<Elem, type_list<Type...>>;
+
+    [[nodiscard]] auto chunk_count() const noexcept {
+        return std::get<0u>(chunks).size();
+    }
+
+    template<typename Elem>
+    [[nodiscard]] Elem &element_at(const std::size_t pos) const noexcept {
+        return std::get<index_of<Elem>>(chunks)[pos / chunk_size][fast_mod(pos, chunk_size)];
+    }
+
+    void grow() {
+        // columns grow in lockstep, a failure leaves them as they were
+        (std::get<index_of<Type>>(chunks).reserve(chunk_count() + 1u), ...);
+        std::tuple<Type *...> page{};
+
+        ENTT_TRY {
+            ((std::get<index_of<Type>>(page) = std::allocator_traits<allocator_for<Type>>::allocate(std::get<index_of<Type>>(allocators), chunk_size)), ...);
+        }
+        ENTT_CATCH {
+            (((std::get<index_of<Type>>(page) != nullptr) ? std::allocator_traits<allocator_for<Type>>::deallocate(std::get<index_of<Type>>(allocators), std::get<index_of<Type>>(page), chunk_size) : void()), ...);
+            ENTT_THROW;
+        }
+
+        (std::get<index_of<Type>>(chunks).push_back(std::get<index_of<Type>>(page)), ...);
+    }
+
+    template<typename Elem, typename... Args>
+    void construct_at(const std::size_t pos, Args &&...args) {
+        auto &allocator = std::get<index_of<Elem>>(allocators);
+
+        if constexpr(std::is_aggregate_v<Elem> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<Elem>)) {
+            std::allocator_traits<allocator_for<Elem>>::construct(allocator, std::addressof(element_at<Elem>(pos)), Elem{std::forward<Args>(args)...});
+        } else {
+            std::allocator_traits<allocator_for<Elem>>::construct(allocator, std::addressof(element_at<Elem>(pos)), std::forward<Args>(args)...);
+        }
+    }
+
+    template<typename Elem>
+    void destroy_at(const std::size_t pos) {
+        std::allocator_traits<allocator_for<Elem>>::destroy(std::get<index_of<Elem>>(allocators), std::addressof(element_at<Elem>(pos)));
+    }
+
+    template<typename Elem>
+    void move_row(const std::size_t from, const std::size_t to) {
+        element_at<Elem>(to) = std::move(element_at<Elem>(from));
+    }
+
+    template<typename... Args>
+    void construct_row(const std::size_t pos, Args &&...args) {
+        [[maybe_unused]] std::size_t count{};
+
+        ENTT_TRY {
+            if constexpr(sizeof...(Args) == 0u) {
+                ((construct_at<Type>(pos), ++count), ...);
+            } else {
+                ((construct_at<Type>(pos, std::forward<Args>(args)), ++count), ...);
+            }
+        }
+        ENTT_CATCH {
+            // only the elements constructed so far are destroyed
+            std::size_t curr{};
+            (((curr++ < count) ? destroy_at<Type>(pos) : void()), ...);
+            ENTT_THROW;
+        }
+    }
+
+    void release_chunks() {
+        (std::for_each(std::get<index_of<Type>>(chunks).begin(), std::get<index_of<Type>>(chunks).end(), [this](auto *page) { std::allocator_traits<allocator_for<Type>>::deallocate(std::get<index_of<Type>>(allocators), page, chunk_size); }), ...);
+        (std::get<index_of<Type>>(chunks).clear(), ...);
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Types of elements assigned to entities. */
+    using element_list = type_list<Type...>;
+
+    /*! @brief Size in bytes of the chunks of elements. */
+    static constexpr size_type chunk_bytes = 16384u;
+    /*! @brief Number of entities per chunk, always a power of two. */
+    static constexpr size_type chunk_size = internal::archetype_chunk_rows(chunk_bytes, (sizeof(Type) + ...));
+
+    /*! @brief Default constructor. */
+    basic_archetype()
+        : basic_archetype{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty archetype with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_archetype(const allocator_type &allocator)
+        : entities{deletion_policy::swap_and_pop, allocator},
+          chunks{column_type<Type>{allocator}...},
+          allocators{allocator_for<Type>{allocator}...} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_archetype(const basic_archetype &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_archetype(basic_archetype &&other) noexcept
+        : entities{std::move(other.entities)},
+          chunks{std::move(other.chunks)},
+          allocators{std::move(other.allocators)} {
+        (std::get<index_of<Type>>(other.chunks).clear(), ...);
+    }
+
+    /*! @brief Destroys all elements and releases the chunks. */
+    ~basic_archetype() {
+        clear();
+        release_chunks();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This archetype.
+     */
+    basic_archetype &operator=(const basic_archetype &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This archetype.
+     */
+    basic_archetype &operator=(basic_archetype &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given archetype.
+     * @param other Archetype to exchange the content with.
+     */
+    void swap(basic_archetype &other) noexcept {
+        using std::swap;
+        swap(entities, other.entities);
+        swap(chunks, other.chunks);
+        swap(allocators, other.allocators);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return entities.get_allocator();
+    }
+
+    /**
+     * @brief Returns the number of entities in an archetype.
+     * @return Number of entities in the archetype.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return entities.size();
+    }
+
+    /**
+     * @brief Checks whether an archetype is empty.
+     * @return True if the archetype is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return entities.empty();
+    }
+
+    /**
+     * @brief Returns the number of entities that an archetype has currently
+     * allocated space for.
+     * @return Capacity of the archetype.
+     */
+    [[nodiscard]] size_type capacity() const noexcept {
+        return chunk_count() * chunk_size;
+    }
+
+    /**
+     * @brief Increases the capacity of an archetype.
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) {
+        entities.reserve(cap);
+
+        while(capacity() < cap) {
+            grow();
+        }
+    }
+
+    /*! @brief Releases the chunks that are no longer in use. */
+    void shrink_to_fit() {
+        const auto count = (size() + chunk_size - 1u) / chunk_size;
+
+        for(auto pos = chunk_count(); pos > count; --pos) {
+            ((std::allocator_traits<allocator_for<Type>>::deallocate(std::get<index_of<Type>>(allocators), std::get<index_of<Type>>(chunks)[pos - 1u], chunk_size), std::get<index_of<Type>>(chunks).pop_back()), ...);
+        }
+
+        (std::get<index_of<Type>>(chunks).shrink_to_fit(), ...);
+        entities.shrink_to_fit();
+    }
+
+    /**
+     * @brief Returns the entities of an archetype, in the order of the rows.
+     * @return The entities of the archetype.
+     */
+    [[nodiscard]] const entity_type *data() const noexcept {
+        return entities.data();
+    }
+
+    /**
+     * @brief Checks if an archetype contains an entity.
+     * @param entt A valid identifier.
+     * @return True if the archetype contains the entity, false otherwise.
+     */
+    [[nodiscard]] bool contains(const entity_type entt) const noexcept {
+        return entities.contains(entt);
+    }
+
+    /**
+     * @brief Returns the row of an entity.
+     * @param entt A valid identifier.
+     * @return The row of the entity.
+     */
+    [[nodiscard]] size_type index(const entity_type entt) const noexcept {
+        return entities.index(entt);
+    }
+
+    /**
+     * @brief Assigns an entity to an archetype and constructs its elements.
+     *
+     * Either no arguments or one argument per type of element are accepted.
+     * In the first case, the elements are value initialized.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the archetype
+     * results in undefined behavior.
+     *
+     * @tparam Args Types of arguments to use to construct the elements.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to construct the elements.
+     * @return References to the newly created elements.
+     */
+    template<typename... Args>
+    std::tuple<Type &...> emplace(const entity_type entt, Args &&...args) {
+        static_assert(sizeof...(Args) == 0u || sizeof...(Args) == sizeof...(Type), "Invalid arguments");
+        ENTT_ASSERT(!contains(entt), "Entity already in archetype");
+        const auto pos = size();
+
+        if(pos == capacity()) {
+            grow();
+        }
+
+        construct_row(pos, std::forward<Args>(args)...);
+
+        ENTT_TRY {
+            entities.push(entt);
+        }
+        ENTT_CATCH {
+            (destroy_at<Type>(pos), ...);
+            ENTT_THROW;
+        }
+
+        return std::forward_as_tuple(element_at<Type>(pos)...);
+    }
+
+    /**
+     * @brief Removes an entity from an archetype and destroys its elements.
+     *
+     * The last entity is moved to the row of the removed one.
+     *
+     * @warning
+     * Attempting to erase an entity that doesn't belong to the archetype
+     * results in undefined behavior.
+     *
+     * @param entt A valid identifier.
+     */
+    void erase(const entity_type entt) {
+        const auto pos = index(entt);
+
+        if(const auto last = size() - 1u; pos != last) {
+            (move_row<Type>(last, pos), ...);
+            (destroy_at<Type>(last), ...);
+        } else {
+            (destroy_at<Type>(pos), ...);
+        }
+
+        entities.erase(entt);
+    }
+
+    /**
+     * @brief Removes an entity from an archetype, if any.
+     * @param entt A valid identifier.
+     * @return True if the entity is actually removed, false otherwise.
+     */
+    bool remove(const entity_type entt) {
+        return contains(entt) && (erase(entt), true);
+    }
+
+    /*! @brief Removes all entities from an archetype. */
+    void clear() {
+        if constexpr(!(std::is_trivially_destructible_v<Type> && ...)) {
+            for(auto pos = size(); pos != 0u; --pos) {
+                (destroy_at<Type>(pos - 1u), ...);
+            }
+        }
+
+        entities.clear();
+    }
+
+    /**
+     * @brief Returns the elements assigned to an entity.
+     *
+     * @warning
+     * Attempting to get the elements of an entity that doesn't belong to the
+     * archetype results in undefined behavior.
+     *
+     * @tparam Elem Types of elements to get.
+     * @param entt A valid identifier.
+     * @return References to the elements of the entity.
+     */
+    template<typename... Elem>
+    [[nodiscard]] decltype(auto) get(const entity_type entt) const {
+        static_assert(sizeof...(Elem) != 0u, "Empty type list");
+        const auto pos = index(entt);
+
+        if constexpr(sizeof...(Elem) == 1u) {
+            return std::as_const(element_at<Elem...>(pos));
+        } else {
+            return std::forward_as_tuple(static_cast<const Elem &>(element_at<Elem>(pos))...);
+        }
+    }
+
+    /*! @copydoc get */
+    template<typename... Elem>
+    [[nodiscard]] decltype(auto) get(const entity_type entt) {
+        static_assert(sizeof...(Elem) != 0u, "Empty type list");
+        const auto pos = index(entt);
+
+        if constexpr(sizeof...(Elem) == 1u) {
+            return (element_at<Elem...>(pos));
+        } else {
+            return std::forward_as_tuple(element_at<Elem>(pos)...);
+        }
+    }
+
+    /**
+     * @brief Iterates the chunks of an archetype.
+     *
+     * The function object is invoked once per chunk in use. Its signature is
+     * equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type *, size_type, Type *...);
+     * @endcode
+     *
+     * The arguments are the entities of the chunk, their number and one array
+     * of elements per type, all of the same length.
+     *
+     * @warning
+     * Adding or removing entities while iterating the chunks results in
+     * undefined behavior.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_chunk(Func func) {
+        for(size_type pos{}, len = size(); pos < len; pos += chunk_size) {
+            func(data() + pos, (std::min)(chunk_size, len - pos), std::get<index_of<Type>>(chunks)[pos / chunk_size]...);
+        }
+    }
+
+    /**
+     * @brief Iterates the entities of an archetype and their elements.
+     *
+     * The function object is invoked for each entity, in the order of the
+     * rows. It receives the entity and references to its elements.
+     *
+     * @warning
+     * Adding or removing entities while iterating results in undefined
+     * behavior.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) {
+        each_chunk([&func](const entity_type *entt, const size_type len, Type *...elem) {
+            for(size_type pos{}; pos < len; ++pos) {
+                func(entt[pos], elem[pos]...);
+            }
+        });
+    }
+
+private:
+    basic_sparse_set<Entity, Allocator> entities;
+    container_type chunks;
+    std::tuple<allocator_for<Type>...> allocators;
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,397 @@
+#ifndef ENTT_ENTITY_CACHED_QUERY_HPP
+#define ENTT_ENTITY_CACHED_QUERY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "../core/iterator.hpp"
+#include "../core/type_traits.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "group.hpp"
+
+namespace entt {
+
+/**
+ * @brief Cached query.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error, but for a few reasonable cases.
+ */
+template<typename, typename>
+class basic_cached_query;
+
+/**
+ * @brief Cached query.
+ *
+ * A cached query keeps track of all entities and only the entities that are at
+ * least in the given storage and not in the excluded ones. The list of
+ * entities is updated incrementally when elements are added or removed and is
+ * tightly packed in memory for fast iterations.<br/>
+ * Unlike groups, cached queries don't belong to the registry. They are created
+ * and destroyed at any time and don't affect the storage they observe in any
+ * way, other than connecting listeners to their signals.
+ *
+ * @b Important
+ *
+ * Iterators aren't invalidated if:
+ *
+ * * New elements are added to the storage.
+ * * The entity currently pointed is modified (for example, elements are added
+ *   or removed from it).
+ * * The entity currently pointed is destroyed.
+ *
+ * In all other cases, modifying the pools observed by the query in any way
+ * invalidates all the iterators.
+ *
+ * @warning
+ * Storage classes must offer construction and destruction signals and must
+ * outlive the cached queries that observe them. Queries can be neither copied
+ * nor moved, since their listeners are bound to their addresses.
+ *
+ * @tparam Get Types of storage _observed_ by the query.
+ * @tparam Exclude Types of storage used to filter the query.
+ */
+template<typename... Get, typename... Exclude>
+class basic_cached_query<get_t<Get...>, exclude_t<Exclude...>> {
+    static_assert(sizeof...(Get) != 0u, "Exclusion-only queries are not supported");
+    using base_type = std::common_type_t<typename Get::base_type..., typename Exclude::base_type...>;
+    using underlying_type = typename base_type::entity_type;
+
+    template<typename Type>
+    static constexpr std::size_t index_of = type_list_index_v<std::remove_const_t<Type>, type_list<typename Get::element_type..., typename Exclude::element_type...>>;
+
+    [[nodiscard]] bool matches(const underlying_type entt) const noexcept {
+        return std::apply([entt](auto *...cpool) { return (cpool->contains(entt) && ...); }, pools);
+    }
+
+    void push_on_construct(const underlying_type entt) {
+        if(!entities.contains(entt) && matches(entt) && std::apply([entt](auto *...cpool) { return (!cpool->contains(entt) && ...); }, filter)) {
+            entities.push(entt);
+        }
+    }
+
+    void push_on_destroy(const underlying_type entt) {
+        if(!entities.contains(entt) && matches(entt) && std::apply([entt](auto *...cpool) { return (0u + ... + cpool->contains(entt)) == 1u; }, filter)) {
+            entities.push(entt);
+        }
+    }
+
+    void remove_if(const underlying_type entt) {
+        entities.remove(entt);
+    }
+
+    [[nodiscard]] auto pools_for() const noexcept {
+        return std::apply([](auto *...cpool) { return std::tuple<Get *...>{cpool...}; }, pools);
+    }
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = underlying_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Signed integer type. */
+    using difference_type = std::ptrdiff_t;
+    /*! @brief Common type among all storage types. */
+    using common_type = base_type;
+    /*! @brief Random access iterator type. */
+    using iterator = typename common_type::iterator;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = typename common_type::reverse_iterator;
+    /*! @brief Iterable query type. */
+    using iterable = iterable_adaptor<internal::extended_group_iterator<iterator, owned_t<>, get_t<Get...>>>;
+
+    /**
+     * @brief Constructs a cached query from a set of storage classes.
+     * @param gpool Storage types to iterate _observed_ by the query.
+     * @param epool Storage types used to filter the query.
+     */
+    basic_cached_query(std::remove_const_t<Get> &...gpool, std::remove_const_t<Exclude> &...epool)
+        : pools{&gpool...},
+          filter{&epool...},
+          entities{} {
+        ((gpool.on_construct().template connect<&basic_cached_query::push_on_construct>(*this), gpool.on_destroy().template connect<&basic_cached_query::remove_if>(*this)), ...);
+        ((epool.on_construct().template connect<&basic_cached_query::remove_if>(*this), epool.on_destroy().template connect<&basic_cached_query::push_on_destroy>(*this)), ...);
+
+        const base_type *lead = (std::min)({static_cast<const base_type *>(&gpool)...}, [](const auto *lhs, const auto *rhs) { return lhs->size() < rhs->size(); });
+        entities.reserve(lead->size());
+
+        for(const auto entt: *lead) {
+            push_on_construct(entt);
+        }
+    }
+
+    /**
+     * @brief Constructs a cached query from the storage of a registry.
+     * @tparam Registry Basic registry type.
+     * @param reg The registry that owns the storage to observe.
+     */
+    template<typename Registry, typename = std::enable_if_t<!std::is_base_of_v<base_type, Registry>>>
+    explicit basic_cached_query(Registry &reg)
+        : basic_cached_query{reg.template storage<typename Get::element_type>()..., reg.template storage<typename Exclude::element_type>()...} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_cached_query(const basic_cached_query &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_cached_query(basic_cached_query &&) = delete;
+
+    /*! @brief Disconnects the query from the storage it observes. */
+    ~basic_cached_query() {
+        std::apply([this](auto *...cpool) { ((cpool->on_construct().disconnect(this), cpool->on_destroy().disconnect(this)), ...); }, pools);
+        std::apply([this](auto *...cpool) { ((cpool->on_construct().disconnect(this), cpool->on_destroy().disconnect(this)), ...); }, filter);
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This query.
+     */
+    basic_cached_query &operator=(const basic_cached_query &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This query.
+     */
+    basic_cached_query &operator=(basic_cached_query &&) = delete;
+
+    /**
+     * @brief Returns the set of entities that are part of the query.
+     * @return The set of entities that are part of the query.
+     */
+    [[nodiscard]] const common_type &handle() const noexcept {
+        return entities;
+    }
+
+    /**
+     * @brief Returns the storage for a given element type.
+     * @tparam Type Type of element of which to return the storage.
+     * @return The storage for the given element type.
+     */
+    template<typename Type>
+    [[nodiscard]] auto *storage() const noexcept {
+        return storage<index_of<Type>>();
+    }
+
+    /**
+     * @brief Returns the storage for a given index.
+     * @tparam Index Index of the storage to return.
+     * @return The storage for the given index.
+     */
+    template<std::size_t Index>
+    [[nodiscard]] auto *storage() const noexcept {
+        using type = type_list_element_t<Index, type_list<Get..., Exclude...>>;
+
+        if constexpr(Index < sizeof...(Get)) {
+            return static_cast<type *>(std::get<Index>(pools));
+        } else {
+            return static_cast<type *>(std::get<Index - sizeof...(Get)>(filter));
+        }
+    }
+
+    /**
+     * @brief Returns the number of entities that are part of the query.
+     * @return Number of entities that are part of the query.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return entities.size();
+    }
+
+    /**
+     * @brief Checks whether a query is empty.
+     * @return True if the query is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return entities.empty();
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() {
+        entities.shrink_to_fit();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity of the query.
+     *
+     * If the query is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first entity of the query.
+     */
+    [[nodiscard]] iterator begin() const noexcept {
+        return entities.begin();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity of the query.
+     * @return An iterator to the entity following the last entity of the
+     * query.
+     */
+    [[nodiscard]] iterator end() const noexcept {
+        return entities.end();
+    }
+
+    /**
+     * @brief Returns an iterator to the first entity of the reversed query.
+     *
+     * If the query is empty, the returned iterator will be equal to `rend()`.
+     *
+     * @return An iterator to the first entity of the reversed query.
+     */
+    [[nodiscard]] reverse_iterator rbegin() const noexcept {
+        return entities.rbegin();
+    }
+
+    /**
+     * @brief Returns an iterator that is past the last entity of the reversed
+     * query.
+     * @return An iterator to the entity following the last entity of the
+     * reversed query.
+     */
+    [[nodiscard]] reverse_iterator rend() const noexcept {
+        return entities.rend();
+    }
+
+    /**
+     * @brief Returns the first entity of the query, if any.
+     * @return The first entity of the query if one exists, the null entity
+     * otherwise.
+     */
+    [[nodiscard]] entity_type front() const noexcept {
+        const auto it = begin();
+        return it != end() ? *it : null;
+    }
+
+    /**
+     * @brief Returns the last entity of the query, if any.
+     * @return The last entity of the query if one exists, the null entity
+     * otherwise.
+     */
+    [[nodiscard]] entity_type back() const noexcept {
+        const auto it = rbegin();
+        return it != rend() ? *it : null;
+    }
+
+    /**
+     * @brief Finds an entity.
+     * @param entt A valid identifier.
+     * @return An iterator to the given entity if it's found, past the end
+     * iterator otherwise.
+     */
+    [[nodiscard]] iterator find(const entity_type entt) const noexcept {
+        return entities.find(entt);
+    }
+
+    /**
+     * @brief Returns the identifier that occupies the given position.
+     * @param pos Position of the element to return.
+     * @return The identifier that occupies the given position.
+     */
+    [[nodiscard]] entity_type operator[](const size_type pos) const {
+        return begin()[static_cast<difference_type>(pos)];
+    }
+
+    /**
+     * @brief Checks if a query contains an entity.
+     * @param entt A valid identifier.
+     * @return True if the query contains the given entity, false otherwise.
+     */
+    [[nodiscard]] bool contains(const entity_type entt) const noexcept {
+        return entities.contains(entt);
+    }
+
+    /**
+     * @brief Returns the elements assigned to the given entity.
+     * @tparam Type Type of the element to get.
+     * @tparam Other Other types of elements to get.
+     * @param entt A valid identifier.
+     * @return The elements assigned to the entity.
+     */
+    template<typename Type, typename... Other>
+    [[nodiscard]] decltype(auto) get(const entity_type entt) const {
+        return get<index_of<Type>, index_of<Other>...>(entt);
+    }
+
+    /**
+     * @brief Returns the elements assigned to the given entity.
+     * @tparam Index Indexes of the elements to get.
+     * @param entt A valid identifier.
+     * @return The elements assigned to the entity.
+     */
+    template<std::size_t... Index>
+    [[nodiscard]] decltype(auto) get(const entity_type entt) const {
+        const auto cpools = pools_for();
+
+        if constexpr(sizeof...(Index) == 0) {
+            return std::apply([entt](auto *...curr) { return std::tuple_cat(curr->get_as_tuple(entt)...); }, cpools);
+        } else if constexpr(sizeof...(Index) == 1) {
+            return (std::get<Index>(cpools)->get(entt), ...);
+        } else {
+            return std::tuple_cat(std::get<Index>(cpools)->get_as_tuple(entt)...);
+        }
+    }
+
+    /**
+     * @brief Iterates entities and elements and applies the given function
+     * object to them.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and a set of references to non-empty elements. The
+     * _constness_ of the elements is as requested.<br/>
+     * The signature of the function must be equivalent to one of the following
+     * forms:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Type &...);
+     * void(Type &...);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        for(const auto entt: *this) {
+            if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_cached_query>().get({})))>) {
+                std::apply(func, std::tuple_cat(std::make_tuple(entt), get(entt)));
+            } else {
+                std::apply(func, get(entt));
+            }
+        }
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a query.
+     *
+     * The iterable object returns tuples that contain the current entity and a
+     * set of references to its non-empty elements. The _constness_ of the
+     * elements is as requested.
+     *
+     * @return An iterable object to use to _visit_ the query.
+     */
+    [[nodiscard]] iterable each() const noexcept {
+        const auto cpools = pools_for();
+        return iterable{{begin(), cpools}, {end(), cpools}};
+    }
+
+    /**
+     * @brief Sort entities according to their order in a range.
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    void sort_as(It first, It last) {
+        entities.sort_as(first, last);
+    }
+
+private:
+    std::tuple<std::remove_const_t<Get> *...> pools;
+    std::tuple<std::remove_const_t<Exclude> *...> filter;
+    common_type entities;
+};
+
+} // namespace entt
+
+#endif
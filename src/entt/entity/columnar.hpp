@@ -0,0 +1,190 @@
+#ifndef ENTT_ENTITY_COLUMNAR_HPP
+#define ENTT_ENTITY_COLUMNAR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/type_traits.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+template<typename Type, typename = void>
+struct columnar_layout {
+    static_assert(std::is_trivially_copyable_v<Type> && !std::is_empty_v<Type>, "Invalid element type");
+    static constexpr bool soa = false;
+    using type = std::tuple<const Type *>;
+};
+
+template<typename Type>
+struct columnar_layout<Type, std::void_t<typename Type::soa_columns>> {
+    template<typename>
+    struct columns_of;
+
+    template<auto... Member>
+    struct columns_of<value_list<Member...>> {
+        static_assert((std::is_trivially_copyable_v<std::remove_reference_t<decltype(std::declval<Type &>().*Member)>> && ...), "Invalid column type");
+        using type = std::tuple<const std::remove_reference_t<decltype(std::declval<Type &>().*Member)> *...>;
+    };
+
+    static constexpr bool soa = true;
+    using type = typename columns_of<typename Type::soa_columns>::type;
+};
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Columnar export of a storage.
+ *
+ * Describes the contents of a storage as a sequence of batches of contiguous
+ * buffers, laid out as required by columnar formats such as Apache Arrow.
+ * Entities and elements aren't copied. Each batch contains:
+ *
+ * * The entity column, that is the packed array of the storage.
+ * * A validity bitmap, one bit per row in least significant bit order, that is
+ *   set for rows that contain an element. The bitmap is a null pointer if all
+ *   rows are valid.
+ * * One value column for the element type or, for storage classes that declare
+ *   their columns through `soa_columns`, one for each data member.
+ *
+ * Paginated storage classes produce one batch per page, while structure of
+ * arrays storage classes produce a single batch. Element types must be
+ * trivially copyable, as well as all the columns of structure of arrays types.
+ *
+ * @warning
+ * Buffers are invalidated as soon as the storage is modified. Validity bitmaps
+ * belong to the exporter and are also invalidated by the next export.
+ *
+ * @tparam Type Type of storage to export.
+ */
+template<typename Type>
+class columnar_export {
+    using alloc_traits = std::allocator_traits<typename Type::allocator_type>;
+    using bitmap_type = std::vector<std::uint8_t, typename alloc_traits::template rebind_alloc<std::uint8_t>>;
+    using layout_type = internal::columnar_layout<typename Type::value_type>;
+    using values_type = typename layout_type::type;
+
+    template<auto... Member>
+    [[nodiscard]] values_type columns(value_list<Member...>) const noexcept {
+        return values_type{storage->template column<Member>()...};
+    }
+
+    [[nodiscard]] static std::size_t bitmap_size(const std::size_t len) noexcept {
+        return (len + 7u) / 8u;
+    }
+
+    template<typename Batch>
+    void validate(Batch &curr) {
+        const auto first = bitmap.size();
+        bitmap.resize(first + bitmap_size(curr.length), 0u);
+
+        for(std::size_t pos{}; pos < curr.length; ++pos) {
+            if(curr.entity[pos] == tombstone) {
+                ++curr.null_count;
+            } else {
+                bitmap[first + pos / 8u] |= static_cast<std::uint8_t>(1u << (pos % 8u));
+            }
+        }
+
+        if(curr.null_count != 0u) {
+            curr.validity = bitmap.data() + first;
+        }
+    }
+
+public:
+    /*! @brief Storage type. */
+    using storage_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename storage_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Batch of contiguous buffers. */
+    struct batch {
+        /*! @brief Position of the first row in the storage. */
+        size_type offset;
+        /*! @brief Number of rows. */
+        size_type length;
+        /*! @brief Number of rows without an element. */
+        size_type null_count;
+        /*! @brief Validity bitmap, if any. */
+        const std::uint8_t *validity;
+        /*! @brief Entity column. */
+        const entity_type *entity;
+        /*! @brief Value columns, in the order in which they are declared. */
+        values_type values;
+    };
+
+    /*! @brief Number of value columns. */
+    static constexpr size_type column_count = std::tuple_size_v<values_type>;
+
+    /**
+     * @brief Constructs an exporter for a given storage.
+     * @param source A valid storage.
+     */
+    columnar_export(const storage_type &source)
+        : storage{&source},
+          bitmap{source.get_allocator()} {}
+
+    /**
+     * @brief Visits the batches of the storage in memory order.
+     *
+     * The function object is invoked once per batch. Its signature is
+     * equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const batch &);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) {
+        bitmap.clear();
+
+        if constexpr(layout_type::soa) {
+            if(const auto len = storage->size(); len != 0u) {
+                const batch curr{0u, len, 0u, nullptr, storage->data(), columns(typename storage_type::value_type::soa_columns{})};
+                func(curr);
+            }
+        } else {
+            const bool stable = (storage->policy() == deletion_policy::in_place);
+
+            if(stable) {
+                size_type sz{};
+                // bitmaps never reallocate while batches are visited
+                storage->each_chunk([&sz](const entity_type *, const size_type len, const auto *) { sz += bitmap_size(len); });
+                bitmap.reserve(sz);
+            }
+
+            storage->each_chunk([this, stable, &func](const entity_type *entt, const size_type len, const auto *elem) {
+                batch curr{static_cast<size_type>(entt - storage->data()), len, 0u, nullptr, entt, values_type{elem}};
+
+                if(stable) {
+                    validate(curr);
+                }
+
+                func(std::as_const(curr));
+            });
+        }
+    }
+
+private:
+    const storage_type *storage;
+    bitmap_type bitmap;
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,254 @@
+#ifndef ENTT_ENTITY_COMMAND_BUFFER_HPP
+#define ENTT_ENTITY_COMMAND_BUFFER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/type_info.hpp"
+#include "../core/utility.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+template<typename Registry>
+[[nodiscard]] typename Registry::entity_type resolve(const typename Registry::entity_type entt, const std::vector<typename Registry::entity_type> &created) noexcept {
+    using traits_type = entt::entt_traits<typename Registry::entity_type>;
+    // placeholders carry the version of the tombstone, real identifiers don't
+    return (traits_type::to_version(entt) == traits_type::to_version(tombstone)) ? created[traits_type::to_entity(entt)] : entt;
+}
+
+template<typename Registry>
+struct basic_command_pool {
+    using entity_type = typename Registry::entity_type;
+
+    virtual ~basic_command_pool() = default;
+    virtual void apply(Registry &, const std::vector<entity_type> &) = 0;
+    [[nodiscard]] virtual std::size_t size() const noexcept = 0;
+    virtual void clear() noexcept = 0;
+};
+
+template<typename Registry, typename Type>
+struct command_pool final: basic_command_pool<Registry> {
+    using entity_type = typename Registry::entity_type;
+
+    void apply(Registry &reg, const std::vector<entity_type> &created) override {
+        auto &cpool = reg.template storage<Type>();
+
+        // commands are replayed in order, one storage at a time
+        for(auto &&[entt, value]: commands) {
+            if(value) {
+                cpool.emplace(resolve<Registry>(entt, created), std::move(*value));
+            } else {
+                cpool.remove(resolve<Registry>(entt, created));
+            }
+        }
+
+        commands.clear();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept override {
+        return commands.size();
+    }
+
+    void clear() noexcept override {
+        commands.clear();
+    }
+
+    std::vector<std::pair<entity_type, std::optional<Type>>> commands{};
+};
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Deferred structural changes for a registry.
+ *
+ * A command buffer records the creation and destruction of entities and the
+ * assignment and removal of elements, so that they are applied later at once
+ * through the `flush` function.<br/>
+ * During a flush, entities are created first. Then each storage receives all
+ * the commands that target it in a single batch, in the order in which they
+ * were recorded. Finally, entities are destroyed.
+ *
+ * Entities returned by the `create` function are placeholders. They are valid
+ * arguments for the other functions of the buffer that created them and are
+ * replaced with actual entities during a flush.
+ *
+ * @warning
+ * Command buffers aren't thread safe. Each thread is meant to record commands
+ * in its own buffer, while buffers are flushed one at a time, when no other
+ * thread accesses the registry (such as a synchronization point of an
+ * organizer).
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_command_buffer final {
+    using traits_type = entt_traits<typename Registry::entity_type>;
+    using pool_type = internal::basic_command_pool<Registry>;
+
+    static_assert(traits_type::version_mask != 0u, "Placeholders require versioned identifiers");
+
+    template<typename Type>
+    [[nodiscard]] auto &assure() {
+        static_assert(std::is_same_v<Type, std::decay_t<Type>>, "Non-decayed types not allowed");
+        auto &elem = pools[type_hash<Type>::value()];
+
+        if(!elem) {
+            elem = std::make_unique<internal::command_pool<Registry, Type>>();
+        }
+
+        return static_cast<internal::command_pool<Registry, Type> &>(*elem).commands;
+    }
+
+public:
+    /*! @brief Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    basic_command_buffer()
+        : pools{},
+          created{},
+          destroyed{},
+          placeholders{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_command_buffer(const basic_command_buffer &) = delete;
+
+    /*! @brief Default move constructor. */
+    basic_command_buffer(basic_command_buffer &&) noexcept = default;
+
+    /*! @brief Default destructor. */
+    ~basic_command_buffer() = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This command buffer.
+     */
+    basic_command_buffer &operator=(const basic_command_buffer &) = delete;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This command buffer.
+     */
+    basic_command_buffer &operator=(basic_command_buffer &&) noexcept = default;
+
+    /**
+     * @brief Records the creation of an entity.
+     * @return A placeholder for the entity to create.
+     */
+    [[nodiscard]] entity_type create() {
+        ENTT_ASSERT(placeholders < traits_type::entity_mask, "No placeholders available");
+        return traits_type::construct(static_cast<typename traits_type::entity_type>(placeholders++), traits_type::to_version(tombstone));
+    }
+
+    /**
+     * @brief Records the destruction of an entity.
+     * @param entt A valid identifier or a placeholder.
+     */
+    void destroy(const entity_type entt) {
+        destroyed.push_back(entt);
+    }
+
+    /**
+     * @brief Records the assignment of an element to an entity.
+     * @tparam Type Type of element to create.
+     * @tparam Args Types of arguments to use to construct the element.
+     * @param entt A valid identifier or a placeholder.
+     * @param args Parameters to use to initialize the element.
+     */
+    template<typename Type, typename... Args>
+    void emplace(const entity_type entt, Args &&...args) {
+        if constexpr(std::is_aggregate_v<Type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<Type>)) {
+            assure<Type>().emplace_back(entt, Type{std::forward<Args>(args)...});
+        } else {
+            assure<Type>().emplace_back(entt, std::optional<Type>{std::in_place, std::forward<Args>(args)...});
+        }
+    }
+
+    /**
+     * @brief Records the removal of the given elements from an entity.
+     * @tparam Type Types of elements to remove.
+     * @param entt A valid identifier or a placeholder.
+     */
+    template<typename... Type>
+    void remove(const entity_type entt) {
+        (assure<Type>().emplace_back(entt, std::nullopt), ...);
+    }
+
+    /**
+     * @brief Checks whether a command buffer is empty.
+     * @return True if the command buffer is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return (placeholders == 0u) && destroyed.empty() && (commands() == 0u);
+    }
+
+    /**
+     * @brief Applies all the recorded commands to a registry.
+     *
+     * The command buffer is empty and ready for reuse after a flush.
+     * Allocated memory is retained to avoid further allocations.
+     *
+     * @param reg The registry to which to apply the commands.
+     */
+    void flush(registry_type &reg) {
+        created.resize(placeholders);
+        reg.create(created.begin(), created.end());
+
+        for(auto &&elem: pools) {
+            elem.second->apply(reg, created);
+        }
+
+        for(auto entt: destroyed) {
+            reg.destroy(internal::resolve<Registry>(entt, created));
+        }
+
+        created.clear();
+        destroyed.clear();
+        placeholders = 0u;
+    }
+
+    /*! @brief Discards all the recorded commands. */
+    void clear() noexcept {
+        for(auto &&elem: pools) {
+            elem.second->clear();
+        }
+
+        destroyed.clear();
+        placeholders = 0u;
+    }
+
+private:
+    [[nodiscard]] size_type commands() const noexcept {
+        size_type count{};
+
+        for(auto &&elem: pools) {
+            count += elem.second->size();
+        }
+
+        return count;
+    }
+
+    dense_map<id_type, std::unique_ptr<pool_type>, identity> pools;
+    std::vector<entity_type> created;
+    std::vector<entity_type> destroyed;
+    size_type placeholders;
+};
+
+} // namespace entt
+
+#endif
@@ -2,8 +2,10 @@
 #define ENTT_ENTITY_COMPONENT_HPP
 
 #include <cstddef>
+#include <limits>
 #include <type_traits>
 #include "../config/config.h"
+#include "entity.hpp"
 #include "fwd.hpp"
 
 namespace entt {
@@ -21,8 +23,22 @@ template<typename Type>
 struct in_place_delete<Type, std::enable_if_t<Type::in_place_delete>>
     : std::true_type {};
 
+[[nodiscard]] constexpr std::size_t page_size_for(const std::size_t bytes, const std::size_t size) noexcept {
+    // largest power of two that fits the given number of bytes, one at least
+    std::size_t page{1u};
+    for(; (page * 2u * size) <= bytes; page *= 2u) {}
+    return page;
+}
+
 template<typename Type, typename = void>
-struct page_size: std::integral_constant<std::size_t, !std::is_empty_v<ENTT_ETO_TYPE(Type)> * ENTT_PACKED_PAGE> {};
+struct page_bytes: std::integral_constant<std::size_t, ENTT_PACKED_PAGE_BYTES> {};
+
+template<typename Type>
+struct page_bytes<Type, std::void_t<decltype(Type::page_bytes)>>
+    : std::integral_constant<std::size_t, Type::page_bytes> {};
+
+template<typename Type, typename = void>
+struct page_size: std::integral_constant<std::size_t, !std::is_empty_v<ENTT_ETO_TYPE(Type)> * ((page_bytes<Type>::value == 0u) ? ENTT_PACKED_PAGE : page_size_for(page_bytes<Type>::value, sizeof(Type)))> {};
 
 template<>
 struct page_size<void>: std::integral_constant<std::size_t, 0u> {};
@@ -31,9 +47,34 @@ template<typename Type>
 struct page_size<Type, std::void_t<decltype(Type::page_size)>>
     : std::integral_constant<std::size_t, Type::page_size> {};
 
+template<typename Type, typename Entity, typename = void>
+struct sparse_page_size: std::integral_constant<std::size_t, entt::entt_traits<Entity>::page_size> {};
+
+template<typename Type, typename Entity>
+struct sparse_page_size<Type, Entity, std::void_t<decltype(Type::sparse_page_size)>>
+    : std::integral_constant<std::size_t, Type::sparse_page_size> {};
+
+template<typename Type, typename Element, typename = void>
+struct page_alignment: std::integral_constant<std::size_t, alignof(Element)> {};
+
+template<typename Type>
+struct page_alignment<Type, void>: std::integral_constant<std::size_t, 1u> {};
+
+template<typename Type, typename Element>
+struct page_alignment<Type, Element, std::void_t<decltype(Type::page_alignment)>>
+    : std::integral_constant<std::size_t, Type::page_alignment> {};
+
 } // namespace internal
 /*! @endcond */
 
+/**
+ * @brief Page size to use to store components in a single contiguous array.
+ *
+ * Storage classes for components with this page size aren't paginated. Their
+ * elements are kept in a single buffer that is reallocated on growth.
+ */
+inline constexpr std::size_t no_pagination = (std::numeric_limits<std::size_t>::max)();
+
 /**
  * @brief Common way to access various properties of components.
  * @tparam Type Element type.
@@ -50,8 +91,15 @@ struct component_traits {
 
     /*! @brief Pointer stability, default is `false`. */
     static constexpr bool in_place_delete = internal::in_place_delete<Type>::value;
-    /*! @brief Page size, default is `ENTT_PACKED_PAGE` for non-empty types. */
+    /**
+     * @brief Page size, default is `ENTT_PACKED_PAGE` for non-empty types or
+     * as many elements as fit `ENTT_PACKED_PAGE_BYTES` bytes, if set.
+     */
     static constexpr std::size_t page_size = internal::page_size<Type>::value;
+    /*! @brief Sparse page size, default is the one of the entity type. */
+    static constexpr std::size_t sparse_page_size = internal::sparse_page_size<Type, Entity>::value;
+    /*! @brief Alignment of the pages of elements, default is the one of the type. */
+    static constexpr std::size_t page_alignment = internal::page_alignment<Type, Type>::value;
 };
 
 } // namespace entt
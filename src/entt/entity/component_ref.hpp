@@ -0,0 +1,134 @@
+#ifndef ENTT_ENTITY_COMPONENT_REF_HPP
+#define ENTT_ENTITY_COMPONENT_REF_HPP
+
+#include <memory>
+#include <type_traits>
+#include "../config/config.h"
+#include "../core/type_traits.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Reference to the element of an entity that caches its address.
+ *
+ * The address of the element is cached along with the epoch of the storage in
+ * which it was found. As long as the storage doesn't change structurally, the
+ * element is returned after a single comparison. Otherwise, it's looked up
+ * again and the version of the entity is checked as usual.<br/>
+ * This is meant for references that are dereferenced over and over, such as
+ * the targets of an AI, especially when elements are pointer stable.
+ *
+ * @warning
+ * The storage must outlive the reference.
+ *
+ * @tparam Type Storage type, possibly const.
+ */
+template<typename Type>
+class basic_component_ref {
+    using storage_type = std::remove_const_t<Type>;
+
+public:
+    /*! @brief Type of storage that contains the element. */
+    using base_type = Type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename storage_type::entity_type;
+    /*! @brief Type of element referenced. */
+    using value_type = constness_as_t<typename storage_type::value_type, Type>;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename storage_type::size_type;
+
+    /*! @brief Constructs an invalid reference. */
+    basic_component_ref() noexcept
+        : pool{},
+          entt{null},
+          elem{},
+          epoch{} {}
+
+    /**
+     * @brief Constructs a reference to the element of an entity.
+     * @param storage A valid storage.
+     * @param value A valid identifier.
+     */
+    basic_component_ref(base_type &storage, const entity_type value) noexcept
+        : pool{&storage},
+          entt{value},
+          elem{},
+          epoch{} {
+        refresh();
+    }
+
+    /**
+     * @brief Returns the entity associated with a reference.
+     * @return The entity associated with the reference.
+     */
+    [[nodiscard]] entity_type entity() const noexcept {
+        return entt;
+    }
+
+    /**
+     * @brief Returns a pointer to the element, if any.
+     * @return A pointer to the element if it exists, a null pointer otherwise.
+     */
+    [[nodiscard]] value_type *get() const noexcept {
+        if(pool != nullptr && pool->epoch() != epoch) {
+            refresh();
+        }
+
+        return elem;
+    }
+
+    /**
+     * @brief Checks if a reference refers to an existing element.
+     * @return True if the reference refers to an existing element, false
+     * otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return (get() != nullptr);
+    }
+
+    /**
+     * @brief Returns the element referenced.
+     *
+     * @warning
+     * Attempting to dereference a reference to an element that doesn't exist
+     * results in undefined behavior.
+     *
+     * @return The element referenced.
+     */
+    [[nodiscard]] value_type &operator*() const noexcept {
+        auto *value = get();
+        ENTT_ASSERT(value != nullptr, "Invalid element");
+        return *value;
+    }
+
+    /**
+     * @brief Returns a pointer to the element referenced.
+     *
+     * @warning
+     * Attempting to dereference a reference to an element that doesn't exist
+     * results in undefined behavior.
+     *
+     * @return A pointer to the element referenced.
+     */
+    [[nodiscard]] value_type *operator->() const noexcept {
+        return std::addressof(operator*());
+    }
+
+private:
+    void refresh() const noexcept {
+        // the version of the entity is checked by the lookup
+        elem = pool->contains(entt) ? std::addressof(pool->get(entt)) : nullptr;
+        epoch = pool->epoch();
+    }
+
+    base_type *pool;
+    entity_type entt;
+    mutable value_type *elem;
+    mutable size_type epoch;
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,560 @@
+#ifndef ENTT_ENTITY_DYNAMIC_STORAGE_HPP
+#define ENTT_ENTITY_DYNAMIC_STORAGE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/bit.hpp"
+#include "../core/memory.hpp"
+#include "../core/type_info.hpp"
+#include "component.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "sparse_set.hpp"
+
+namespace entt {
+
+/**
+ * @brief Descriptor of a type defined at runtime.
+ *
+ * Lifecycle functions are invoked on uninitialized memory for construction
+ * and on live objects for destruction. Null functions stand for trivial
+ * operations, that is, elements are zero-initialized, copied and relocated with
+ * `std::memcpy` and never destroyed.
+ *
+ * @warning
+ * Move and destroy functions must not throw.
+ */
+struct dynamic_type {
+    /*! @brief Size of an element in bytes, a multiple of its alignment. */
+    std::size_t size{};
+    /*! @brief Alignment of an element, at most that of `std::max_align_t`. */
+    std::size_t alignment{1u};
+    /*! @brief Default constructs an element. */
+    void (*construct)(void *){};
+    /*! @brief Copy constructs an element from another one. */
+    void (*copy)(void *, const void *){};
+    /*! @brief Move constructs an element from another one. */
+    void (*move)(void *, void *){};
+    /*! @brief Destroys an element. */
+    void (*destroy)(void *){};
+
+    /**
+     * @brief Returns the descriptor of a native type.
+     * @tparam Type Type for which to return the descriptor.
+     * @return The descriptor of the given type.
+     */
+    template<typename Type>
+    [[nodiscard]] static dynamic_type of() noexcept {
+        static_assert(std::is_copy_constructible_v<Type> && std::is_nothrow_move_constructible_v<Type>, "Invalid type");
+        dynamic_type elem{sizeof(Type), alignof(Type)};
+
+        if constexpr(!std::is_trivially_default_constructible_v<Type>) {
+            elem.construct = [](void *value) { ::new(value) Type{}; };
+        }
+
+        if constexpr(!std::is_trivially_copyable_v<Type>) {
+            elem.copy = [](void *value, const void *other) { ::new(value) Type(*static_cast<const Type *>(other)); };
+            elem.move = [](void *value, void *other) { ::new(value) Type(std::move(*static_cast<Type *>(other))); };
+        }
+
+        if constexpr(!std::is_trivially_destructible_v<Type>) {
+            elem.destroy = [](void *value) { static_cast<Type *>(value)->~Type(); };
+        }
+
+        return elem;
+    }
+};
+
+/**
+ * @brief Storage implementation for types defined at runtime.
+ *
+ * Elements are stored inline in packed pages, as it happens with the default
+ * storage. Their size, alignment and lifecycle are described by a
+ * `dynamic_type` rather than by a native type, therefore elements are only
+ * available as opaque pointers. The type-erased `value` function of the
+ * underlying sparse set returns them as well, so that runtime views and all
+ * other type-erased tools just work.
+ *
+ * The storage is assigned to the registry through `entt::dynamic_element`:
+ *
+ * @code{.cpp}
+ * auto &&storage = registry.storage<entt::dynamic_element>("health"_hs);
+ * storage.descriptor(health);
+ * @endcode
+ *
+ * @warning
+ * Only the swap-and-pop deletion policy is supported. Moreover, the descriptor
+ * can only be changed while the storage is empty.
+ *
+ * @tparam Entity A valid entity type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Entity, typename Allocator>
+class basic_dynamic_storage: public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, dynamic_element>, "Invalid value type");
+    using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
+    using underlying_iterator = typename underlying_type::basic_iterator;
+    using block_type = std::max_align_t;
+    using block_alloc_traits = typename alloc_traits::template rebind_traits<block_type>;
+    using block_pointer = typename block_alloc_traits::pointer;
+    using container_type = std::vector<block_pointer, typename alloc_traits::template rebind_alloc<block_pointer>>;
+    using scratch_type = std::vector<block_type, typename alloc_traits::template rebind_alloc<block_type>>;
+
+    static constexpr std::size_t packed_page_size = ENTT_PACKED_PAGE;
+
+    [[nodiscard]] static std::size_t blocks_for(const std::size_t bytes) noexcept {
+        return (bytes + sizeof(block_type) - 1u) / sizeof(block_type);
+    }
+
+    [[nodiscard]] std::size_t page_blocks() const noexcept {
+        return blocks_for(packed_page_size * layout.size);
+    }
+
+    [[nodiscard]] std::byte *element_at(const std::size_t pos) const noexcept {
+        return reinterpret_cast<std::byte *>(to_address(payload[pos / packed_page_size])) + fast_mod(pos, packed_page_size) * layout.size;
+    }
+
+    std::byte *assure_at_least(const std::size_t pos) {
+        if(const auto idx = pos / packed_page_size; !(idx < payload.size())) {
+            typename block_alloc_traits::allocator_type allocator{get_allocator()};
+            auto curr = payload.size();
+            payload.resize(idx + 1u, nullptr);
+
+            ENTT_TRY {
+                for(const auto last = payload.size(); curr < last; ++curr) {
+                    payload[curr] = block_alloc_traits::allocate(allocator, page_blocks());
+                }
+            }
+            ENTT_CATCH {
+                payload.resize(curr);
+                ENTT_THROW;
+            }
+        }
+
+        return element_at(pos);
+    }
+
+    void release_pages(const std::size_t count) {
+        typename block_alloc_traits::allocator_type allocator{get_allocator()};
+
+        for(auto pos = count, last = payload.size(); pos < last; ++pos) {
+            block_alloc_traits::deallocate(allocator, payload[pos], page_blocks());
+        }
+
+        payload.resize(count);
+    }
+
+    void construct_at(std::byte *elem, const void *value) {
+        if(value == nullptr) {
+            if(layout.construct == nullptr) {
+                std::memset(elem, 0, layout.size);
+            } else {
+                layout.construct(elem);
+            }
+        } else if(layout.copy == nullptr) {
+            std::memcpy(elem, value, layout.size);
+        } else {
+            layout.copy(elem, value);
+        }
+    }
+
+    void destroy_at(std::byte *elem) noexcept {
+        if(layout.destroy != nullptr) {
+            layout.destroy(elem);
+        }
+    }
+
+    void relocate(std::byte *to, std::byte *from) noexcept {
+        if(layout.move == nullptr) {
+            std::memcpy(to, from, layout.size);
+        } else {
+            layout.move(to, from);
+            destroy_at(from);
+        }
+    }
+
+    void shrink_to_size(const std::size_t sz) {
+        for(auto pos = sz, length = base_type::size(); pos < length; ++pos) {
+            destroy_at(element_at(pos));
+        }
+
+        release_pages((sz + packed_page_size - 1u) / packed_page_size);
+    }
+
+    auto emplace_element(const Entity entt, const bool force_back, const void *value) {
+        ENTT_ASSERT(layout.size != 0u, "Undefined type");
+        const auto it = base_type::try_emplace(entt, force_back);
+
+        ENTT_TRY {
+            construct_at(assure_at_least(static_cast<size_type>(it.index())), value);
+        }
+        ENTT_CATCH {
+            base_type::pop(it, it + 1u);
+            ENTT_THROW;
+        }
+
+        return it;
+    }
+
+private:
+    [[nodiscard]] const void *get_at(const std::size_t pos) const override {
+        return element_at(pos);
+    }
+
+    void swap_or_move(const std::size_t from, const std::size_t to) override {
+        if(auto *lhs = element_at(from), *rhs = element_at(to); lhs != rhs) {
+            if(layout.move == nullptr) {
+                std::swap_ranges(lhs, lhs + layout.size, rhs);
+            } else {
+                auto *tmp = reinterpret_cast<std::byte *>(scratch.data());
+                relocate(tmp, lhs);
+                relocate(lhs, rhs);
+                relocate(rhs, tmp);
+            }
+        }
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        for(; first != last; ++first) {
+            // cannot use first.index() because it would break with cross iterators
+            const auto pos = base_type::index(*first);
+            auto *elem = element_at(pos);
+            destroy_at(elem);
+
+            if(const auto back = base_type::size() - 1u; pos != back) {
+                relocate(elem, element_at(back));
+            }
+
+            base_type::swap_and_pop(first);
+        }
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        for(size_type pos{}, last = base_type::size(); pos < last; ++pos) {
+            destroy_at(element_at(pos));
+        }
+
+        base_type::pop_all();
+    }
+
+    /**
+     * @brief Copies entities and elements from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from(const underlying_type &other) override {
+        const auto &source = static_cast<const basic_dynamic_storage &>(other);
+
+        shrink_to_size(0u);
+        base_type::pop_all();
+        scratch.resize(blocks_for(source.layout.size));
+        layout = source.layout;
+        base_type::copy_from(other);
+
+        size_type pos{};
+
+        ENTT_TRY {
+            for(const auto last = base_type::size(); pos < last; ++pos) {
+                construct_at(assure_at_least(pos), source.element_at(pos));
+            }
+        }
+        ENTT_CATCH {
+            while(pos != 0u) {
+                destroy_at(element_at(--pos));
+            }
+
+            base_type::pop_all();
+            ENTT_THROW;
+        }
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param value Optional opaque value.
+     * @param force_back Force back insertion.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace(const Entity entt, const bool force_back, const void *value) override {
+        return emplace_element(entt, force_back, value);
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Base type. */
+    using base_type = underlying_type;
+    /*! @brief Element type. */
+    using element_type = dynamic_element;
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = element_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Signed integer type. */
+    using difference_type = std::ptrdiff_t;
+    /*! @brief Storage deletion policy. */
+    static constexpr deletion_policy storage_policy{deletion_policy::swap_and_pop};
+
+    /*! @brief Default constructor. */
+    basic_dynamic_storage()
+        : basic_dynamic_storage{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_dynamic_storage(const allocator_type &allocator)
+        : base_type{type_id<element_type>(), storage_policy, internal::sparse_page_size<component_traits<element_type, Entity>, Entity>::value, allocator},
+          payload{allocator},
+          scratch{allocator} {}
+
+    /**
+     * @brief Constructs an empty storage for a given type.
+     * @param elem The descriptor of the type of the elements.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_dynamic_storage(const dynamic_type &elem, const allocator_type &allocator = allocator_type{})
+        : basic_dynamic_storage{allocator} {
+        descriptor(elem);
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_dynamic_storage(const basic_dynamic_storage &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    basic_dynamic_storage(basic_dynamic_storage &&other) noexcept
+        : base_type{std::move(other)},
+          layout{other.layout},
+          payload{std::move(other.payload)},
+          scratch{std::move(other.scratch)} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /*! @brief Default destructor. */
+    ~basic_dynamic_storage() override {
+        shrink_to_size(0u);
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This storage.
+     */
+    basic_dynamic_storage &operator=(const basic_dynamic_storage &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_dynamic_storage &operator=(basic_dynamic_storage &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(basic_dynamic_storage &other) noexcept {
+        using std::swap;
+        swap(layout, other.layout);
+        swap(payload, other.payload);
+        swap(scratch, other.scratch);
+        base_type::swap(other);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return allocator_type{base_type::get_allocator()};
+    }
+
+    /**
+     * @brief Returns the descriptor of the type of the elements.
+     * @return The descriptor of the type of the elements.
+     */
+    [[nodiscard]] const dynamic_type &descriptor() const noexcept {
+        return layout;
+    }
+
+    /**
+     * @brief Sets the descriptor of the type of the elements.
+     *
+     * @warning
+     * Attempting to change the descriptor of a non-empty storage results in
+     * undefined behavior.
+     *
+     * @param elem The descriptor of the type of the elements.
+     */
+    void descriptor(const dynamic_type &elem) {
+        ENTT_ASSERT(base_type::empty(), "Storage not empty");
+        ENTT_ASSERT(elem.size != 0u && elem.alignment != 0u && elem.alignment <= alignof(block_type) && (elem.size % elem.alignment) == 0u, "Invalid type");
+        release_pages(0u);
+        scratch.resize(blocks_for(elem.size));
+        layout = elem;
+    }
+
+    /**
+     * @brief Increases the capacity of a storage.
+     *
+     * If the new capacity is greater than the current capacity, new storage is
+     * allocated, otherwise the method does nothing.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) override {
+        base_type::reserve(cap);
+
+        if(cap != 0u && layout.size != 0u) {
+            assure_at_least(cap - 1u);
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements that a storage has currently
+     * allocated space for.
+     * @return Capacity of the storage.
+     */
+    [[nodiscard]] size_type capacity() const noexcept override {
+        return payload.size() * packed_page_size;
+    }
+
+    /**
+     * @brief Returns the memory used by a storage.
+     * @return The memory used by the storage.
+     */
+    [[nodiscard]] memory_report memory_usage() const noexcept override {
+        auto report = base_type::memory_usage();
+        report.element_pages = payload.size();
+        report.element_bytes = payload.capacity() * sizeof(block_pointer) + payload.size() * page_blocks() * sizeof(block_type);
+        return report;
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() override {
+        base_type::shrink_to_fit();
+        shrink_to_size(base_type::size());
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return An opaque pointer to the object assigned to the entity.
+     */
+    [[nodiscard]] const void *get(const entity_type entt) const noexcept {
+        return element_at(base_type::index(entt));
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] void *get(const entity_type entt) noexcept {
+        return element_at(base_type::index(entt));
+    }
+
+    /**
+     * @brief Returns the object at a given position in the storage.
+     *
+     * @warning
+     * Attempting to use a position that is out of bounds results in undefined
+     * behavior.
+     *
+     * @param pos A valid position.
+     * @return An opaque pointer to the object at the given position.
+     */
+    [[nodiscard]] const void *at(const size_type pos) const noexcept {
+        ENTT_ASSERT(pos < base_type::size(), "Index out of bounds");
+        return element_at(pos);
+    }
+
+    /*! @copydoc at */
+    [[nodiscard]] void *at(const size_type pos) noexcept {
+        ENTT_ASSERT(pos < base_type::size(), "Index out of bounds");
+        return element_at(pos);
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @param value An optional instance to copy, default construct otherwise.
+     * @return An opaque pointer to the newly created object.
+     */
+    void *emplace(const entity_type entt, const void *value = nullptr) {
+        return element_at(static_cast<size_type>(emplace_element(entt, false, value).index()));
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     *
+     * Function objects are invoked with an opaque pointer to the instance.
+     *
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return An opaque pointer to the updated instance.
+     */
+    template<typename... Func>
+    void *patch(const entity_type entt, Func &&...func) {
+        void *elem = get(entt);
+        (std::forward<Func>(func)(elem), ...);
+        return elem;
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the storage
+     * results in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An optional instance to copy, default construct otherwise.
+     */
+    template<typename It>
+    void insert(It first, It last, const void *value = nullptr) {
+        for(; first != last; ++first) {
+            emplace_element(*first, true, value);
+        }
+    }
+
+private:
+    dynamic_type layout;
+    container_type payload;
+    scratch_type scratch;
+};
+
+} // namespace entt
+
+#endif
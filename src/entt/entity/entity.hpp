@@ -50,11 +50,22 @@ struct entt_traits<std::uint64_t> {
     static constexpr entity_type version_mask = 0xFFFFFFFF;
 };
 
+template<typename, typename = void>
+struct entt_disabled_mask: std::integral_constant<std::size_t, 0u> {};
+
+template<typename Traits>
+struct entt_disabled_mask<Traits, std::void_t<decltype(Traits::disabled_mask)>>: std::integral_constant<std::size_t, static_cast<std::size_t>(Traits::disabled_mask)> {};
+
 } // namespace internal
 /*! @endcond */
 
 /**
  * @brief Common basic entity traits implementation.
+ *
+ * Traits can optionally declare a `disabled_mask` made of bits that are
+ * neither part of the entity nor of the version. These bits are used to mark
+ * entities as disabled and are considered when comparing identifiers.
+ *
  * @tparam Traits Actual entity traits to use.
  */
 template<typename Traits>
@@ -76,6 +87,10 @@ public:
     static constexpr entity_type entity_mask = Traits::entity_mask;
     /*! @brief Version mask size */
     static constexpr entity_type version_mask = Traits::version_mask;
+    /*! @brief Mask of the bits used to mark entities as disabled, if any. */
+    static constexpr entity_type disabled_mask = static_cast<entity_type>(internal::entt_disabled_mask<Traits>::value);
+
+    static_assert((disabled_mask & (entity_mask | ((Traits::version_mask == 0u) ? entity_type{} : static_cast<entity_type>(Traits::version_mask << length)))) == 0u, "Invalid disabled mask");
 
     /**
      * @brief Converts an entity to its underlying type.
@@ -140,7 +155,7 @@ public:
      * @brief Combines two identifiers in a single one.
      *
      * The returned identifier is a copy of the first element except for its
-     * version, which is taken from the second element.
+     * version and its disabled bits, which are taken from the second element.
      *
      * @param lhs The identifier from which to take the entity part.
      * @param rhs The identifier from which to take the version part.
@@ -148,9 +163,9 @@ public:
      */
     [[nodiscard]] static constexpr value_type combine(const entity_type lhs, const entity_type rhs) noexcept {
         if constexpr(Traits::version_mask == 0u) {
-            return value_type{lhs & entity_mask};
+            return value_type{(lhs & entity_mask) | (rhs & disabled_mask)};
         } else {
-            return value_type{(lhs & entity_mask) | (rhs & (version_mask << length))};
+            return value_type{(lhs & entity_mask) | (rhs & ((version_mask << length) | disabled_mask))};
         }
     }
 };
@@ -0,0 +1,691 @@
+#ifndef ENTT_ENTITY_ENTITY_BITSET_HPP
+#define ENTT_ENTITY_ENTITY_BITSET_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/bit.hpp"
+#include "../core/iterator.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+template<typename Allocator>
+struct entity_bitset_block {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using array_type = std::vector<std::uint16_t, typename alloc_traits::template rebind_alloc<std::uint16_t>>;
+    using bitmap_type = std::vector<std::uint64_t, typename alloc_traits::template rebind_alloc<std::uint64_t>>;
+
+    static constexpr std::size_t length = 1u << 16u;
+    static constexpr std::size_t words = length / 64u;
+    // past this point a bitmap takes less space than a sorted array
+    static constexpr std::size_t array_limit = 4096u;
+
+    entity_bitset_block(const std::size_t value, const Allocator &allocator)
+        : key{value},
+          count{},
+          array{allocator},
+          bitmap{allocator} {}
+
+    [[nodiscard]] bool is_bitmap() const noexcept {
+        return !bitmap.empty();
+    }
+
+    [[nodiscard]] bool contains(const std::uint16_t low) const noexcept {
+        if(is_bitmap()) {
+            return ((bitmap[low / 64u] >> (low % 64u)) & 1u) != 0u;
+        }
+
+        return std::binary_search(array.cbegin(), array.cend(), low);
+    }
+
+    bool insert(const std::uint16_t low) {
+        if(is_bitmap()) {
+            auto &word = bitmap[low / 64u];
+            const auto mask = std::uint64_t{1u} << (low % 64u);
+
+            if((word & mask) != 0u) {
+                return false;
+            }
+
+            word |= mask;
+        } else {
+            const auto it = std::lower_bound(array.begin(), array.end(), low);
+
+            if(it != array.end() && *it == low) {
+                return false;
+            }
+
+            if(count == array_limit) {
+                to_bitmap();
+                bitmap[low / 64u] |= std::uint64_t{1u} << (low % 64u);
+            } else {
+                array.insert(it, low);
+            }
+        }
+
+        return ++count, true;
+    }
+
+    bool erase(const std::uint16_t low) {
+        if(is_bitmap()) {
+            auto &word = bitmap[low / 64u];
+            const auto mask = std::uint64_t{1u} << (low % 64u);
+
+            if((word & mask) == 0u) {
+                return false;
+            }
+
+            word &= ~mask;
+
+            if(--count == array_limit) {
+                to_array();
+            }
+        } else {
+            const auto it = std::lower_bound(array.begin(), array.end(), low);
+
+            if(it == array.end() || *it != low) {
+                return false;
+            }
+
+            array.erase(it);
+            --count;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] bitmap_type to_words() const {
+        if(is_bitmap()) {
+            return bitmap;
+        }
+
+        bitmap_type other(words, 0u, bitmap.get_allocator());
+
+        for(auto low: array) {
+            other[low / 64u] |= std::uint64_t{1u} << (low % 64u);
+        }
+
+        return other;
+    }
+
+    void to_bitmap() {
+        bitmap = to_words();
+        array.clear();
+        array.shrink_to_fit();
+    }
+
+    void to_array() {
+        array.clear();
+        array.reserve(count);
+
+        for(std::size_t pos{}; pos < words; ++pos) {
+            for(auto word = bitmap[pos]; word != 0u; word &= word - 1u) {
+                array.push_back(static_cast<std::uint16_t>(pos * 64u + static_cast<std::size_t>(countr_zero(word))));
+            }
+        }
+
+        bitmap.clear();
+        bitmap.shrink_to_fit();
+    }
+
+    void assign(bitmap_type other) {
+        count = 0u;
+
+        for(auto word: other) {
+            count += static_cast<std::size_t>(popcount(word));
+        }
+
+        bitmap = std::move(other);
+
+        if(count <= array_limit) {
+            to_array();
+        } else {
+            array.clear();
+            array.shrink_to_fit();
+        }
+    }
+
+    void assign(array_type other) {
+        count = other.size();
+        array = std::move(other);
+        bitmap.clear();
+        bitmap.shrink_to_fit();
+
+        if(count > array_limit) {
+            to_bitmap();
+        }
+    }
+
+    std::size_t key;
+    std::size_t count;
+    array_type array;
+    bitmap_type bitmap;
+};
+
+template<typename Container, typename Entity>
+class entity_bitset_iterator final {
+    using traits_type = entt::entt_traits<Entity>;
+    using block_type = typename Container::value_type;
+
+    void seek() noexcept {
+        for(const auto last = blocks->size(); block < last; ++block, pos = 0u) {
+            if(const auto &curr = (*blocks)[block]; curr.is_bitmap()) {
+                while(pos < block_type::length) {
+                    if(const auto word = curr.bitmap[pos / 64u] >> (pos % 64u); word != 0u) {
+                        pos += static_cast<std::size_t>(countr_zero(word));
+                        return;
+                    }
+
+                    pos = (pos / 64u + 1u) * 64u;
+                }
+            } else if(pos < curr.array.size()) {
+                return;
+            }
+        }
+    }
+
+public:
+    using value_type = Entity;
+    using pointer = input_iterator_pointer<value_type>;
+    using reference = value_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+
+    constexpr entity_bitset_iterator() noexcept
+        : blocks{},
+          block{},
+          pos{} {}
+
+    entity_bitset_iterator(const Container &ref, const std::size_t idx) noexcept
+        : blocks{&ref},
+          block{idx},
+          pos{} {
+        seek();
+    }
+
+    entity_bitset_iterator &operator++() noexcept {
+        return ++pos, seek(), *this;
+    }
+
+    entity_bitset_iterator operator++(int) noexcept {
+        const entity_bitset_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    [[nodiscard]] reference operator*() const noexcept {
+        const auto &curr = (*blocks)[block];
+        const auto low = curr.is_bitmap() ? pos : static_cast<std::size_t>(curr.array[pos]);
+        return traits_type::construct(static_cast<typename traits_type::entity_type>(curr.key * block_type::length + low), {});
+    }
+
+    [[nodiscard]] pointer operator->() const noexcept {
+        return operator*();
+    }
+
+    [[nodiscard]] friend bool operator==(const entity_bitset_iterator &lhs, const entity_bitset_iterator &rhs) noexcept {
+        return (lhs.block == rhs.block) && (lhs.pos == rhs.pos);
+    }
+
+    [[nodiscard]] friend bool operator!=(const entity_bitset_iterator &lhs, const entity_bitset_iterator &rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+private:
+    const Container *blocks;
+    std::size_t block;
+    std::size_t pos;
+};
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Compact set of entity identifiers.
+ *
+ * Identifiers are split in blocks of 65536 elements. Each block is stored either
+ * as a sorted array of 16 bit values or as a bitmap, depending on which one is
+ * smaller. Therefore, large sets of identifiers take a few bits per element at
+ * most and set operations are performed one word at a time.
+ *
+ * @warning
+ * Only the entity part of an identifier is stored and versions are ignored.
+ * Iterating a bitset returns identifiers with a zero version.
+ *
+ * @tparam Entity A valid entity type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Entity, typename Allocator>
+class basic_entity_bitset {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Entity>, "Invalid value type");
+    using traits_type = entt_traits<Entity>;
+    using block_type = internal::entity_bitset_block<Allocator>;
+    using container_type = std::vector<block_type, typename alloc_traits::template rebind_alloc<block_type>>;
+
+    [[nodiscard]] static auto key_of(const Entity entt) noexcept {
+        return static_cast<std::size_t>(traits_type::to_entity(entt)) / block_type::length;
+    }
+
+    [[nodiscard]] static auto low_of(const Entity entt) noexcept {
+        return static_cast<std::uint16_t>(static_cast<std::size_t>(traits_type::to_entity(entt)) % block_type::length);
+    }
+
+    [[nodiscard]] auto lower_bound(const std::size_t key) const noexcept {
+        return std::lower_bound(blocks.begin(), blocks.end(), key, [](const auto &elem, const auto value) { return elem.key < value; });
+    }
+
+    [[nodiscard]] auto lower_bound(const std::size_t key) noexcept {
+        return std::lower_bound(blocks.begin(), blocks.end(), key, [](const auto &elem, const auto value) { return elem.key < value; });
+    }
+
+    void compact() {
+        blocks.erase(std::remove_if(blocks.begin(), blocks.end(), [](const auto &elem) { return elem.count == 0u; }), blocks.end());
+    }
+
+    void unite(block_type &lhs, const block_type &rhs) {
+        if(!lhs.is_bitmap() && !rhs.is_bitmap() && (lhs.count + rhs.count) <= block_type::array_limit) {
+            typename block_type::array_type other{lhs.array.get_allocator()};
+            other.reserve(lhs.count + rhs.count);
+            std::set_union(lhs.array.cbegin(), lhs.array.cend(), rhs.array.cbegin(), rhs.array.cend(), std::back_inserter(other));
+            lhs.assign(std::move(other));
+        } else {
+            auto other = lhs.to_words();
+
+            if(rhs.is_bitmap()) {
+                for(std::size_t pos{}; pos < block_type::words; ++pos) {
+                    other[pos] |= rhs.bitmap[pos];
+                }
+            } else {
+                for(auto low: rhs.array) {
+                    other[low / 64u] |= std::uint64_t{1u} << (low % 64u);
+                }
+            }
+
+            lhs.assign(std::move(other));
+        }
+    }
+
+    void intersect(block_type &lhs, const block_type &rhs) {
+        if(lhs.is_bitmap() && rhs.is_bitmap()) {
+            auto other = lhs.bitmap;
+
+            for(std::size_t pos{}; pos < block_type::words; ++pos) {
+                other[pos] &= rhs.bitmap[pos];
+            }
+
+            lhs.assign(std::move(other));
+        } else {
+            typename block_type::array_type other{lhs.array.get_allocator()};
+            const auto &small = lhs.is_bitmap() ? rhs : lhs;
+            const auto &large = lhs.is_bitmap() ? lhs : rhs;
+            std::copy_if(small.array.cbegin(), small.array.cend(), std::back_inserter(other), [&large](const auto low) { return large.contains(low); });
+            lhs.assign(std::move(other));
+        }
+    }
+
+    void subtract(block_type &lhs, const block_type &rhs) {
+        if(lhs.is_bitmap()) {
+            auto other = lhs.bitmap;
+
+            if(rhs.is_bitmap()) {
+                for(std::size_t pos{}; pos < block_type::words; ++pos) {
+                    other[pos] &= ~rhs.bitmap[pos];
+                }
+            } else {
+                for(auto low: rhs.array) {
+                    other[low / 64u] &= ~(std::uint64_t{1u} << (low % 64u));
+                }
+            }
+
+            lhs.assign(std::move(other));
+        } else {
+            lhs.array.erase(std::remove_if(lhs.array.begin(), lhs.array.end(), [&rhs](const auto low) { return rhs.contains(low); }), lhs.array.end());
+            lhs.count = lhs.array.size();
+        }
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Input iterator type. */
+    using iterator = internal::entity_bitset_iterator<container_type, Entity>;
+    /*! @brief Constant input iterator type. */
+    using const_iterator = iterator;
+
+    /*! @brief Default constructor. */
+    basic_entity_bitset()
+        : basic_entity_bitset{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty bitset with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_entity_bitset(const allocator_type &allocator)
+        : blocks{allocator},
+          length{} {}
+
+    /*! @brief Default copy constructor. */
+    basic_entity_bitset(const basic_entity_bitset &) = default;
+
+    /**
+     * @brief Allocator-extended copy constructor.
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    basic_entity_bitset(const basic_entity_bitset &other, const allocator_type &allocator)
+        : blocks{other.blocks, allocator},
+          length{other.length} {}
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_entity_bitset(basic_entity_bitset &&other) noexcept
+        : blocks{std::move(other.blocks)},
+          length{std::exchange(other.length, 0u)} {}
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    basic_entity_bitset(basic_entity_bitset &&other, const allocator_type &allocator)
+        : blocks{std::move(other.blocks), allocator},
+          length{std::exchange(other.length, 0u)} {}
+
+    /*! @brief Default destructor. */
+    ~basic_entity_bitset() = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     * @return This bitset.
+     */
+    basic_entity_bitset &operator=(const basic_entity_bitset &) = default;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This bitset.
+     */
+    basic_entity_bitset &operator=(basic_entity_bitset &&other) noexcept {
+        blocks = std::move(other.blocks);
+        length = std::exchange(other.length, 0u);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given bitset.
+     * @param other Bitset to exchange the content with.
+     */
+    void swap(basic_entity_bitset &other) noexcept {
+        using std::swap;
+        swap(blocks, other.blocks);
+        swap(length, other.length);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return allocator_type{blocks.get_allocator()};
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * Identifiers are returned in ascending order.
+     *
+     * @return An iterator to the first identifier of the bitset.
+     */
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        return const_iterator{blocks, 0u};
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator to the element following the last identifier of the
+     * bitset.
+     */
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return const_iterator{blocks, blocks.size()};
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const noexcept {
+        return cend();
+    }
+
+    /**
+     * @brief Checks whether a bitset is empty.
+     * @return True if the bitset is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return (length == 0u);
+    }
+
+    /**
+     * @brief Returns the number of identifiers in a bitset.
+     * @return Number of identifiers.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return length;
+    }
+
+    /**
+     * @brief Returns the number of bytes allocated by a bitset.
+     * @return Number of bytes allocated by the bitset.
+     */
+    [[nodiscard]] size_type memory_usage() const noexcept {
+        size_type bytes = blocks.capacity() * sizeof(block_type);
+
+        for(auto &&elem: blocks) {
+            bytes += elem.array.capacity() * sizeof(std::uint16_t) + elem.bitmap.capacity() * sizeof(std::uint64_t);
+        }
+
+        return bytes;
+    }
+
+    /*! @brief Clears a bitset. */
+    void clear() noexcept {
+        blocks.clear();
+        length = 0u;
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() {
+        for(auto &&elem: blocks) {
+            elem.array.shrink_to_fit();
+        }
+
+        blocks.shrink_to_fit();
+    }
+
+    /**
+     * @brief Checks if a bitset contains an identifier.
+     * @param entt A valid identifier.
+     * @return True if the bitset contains the identifier, false otherwise.
+     */
+    [[nodiscard]] bool contains(const entity_type entt) const noexcept {
+        const auto key = key_of(entt);
+        const auto it = lower_bound(key);
+        return (it != blocks.end()) && (it->key == key) && it->contains(low_of(entt));
+    }
+
+    /**
+     * @brief Inserts an identifier into a bitset, if it does not exist.
+     * @param entt A valid identifier.
+     * @return True if the insertion took place, false otherwise.
+     */
+    bool insert(const entity_type entt) {
+        const auto key = key_of(entt);
+        auto it = lower_bound(key);
+
+        if(it == blocks.end() || it->key != key) {
+            it = blocks.emplace(it, key, get_allocator());
+        }
+
+        const bool added = it->insert(low_of(entt));
+        length += added;
+        return added;
+    }
+
+    /**
+     * @brief Inserts identifiers into a bitset, if they do not exist.
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of
+     * identifiers.
+     * @param last An iterator past the last element of the range of
+     * identifiers.
+     */
+    template<typename It>
+    void insert(It first, It last) {
+        for(; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    /**
+     * @brief Removes an identifier from a bitset, if it exists.
+     * @param entt A valid identifier.
+     * @return Number of identifiers removed (either 0 or 1).
+     */
+    size_type erase(const entity_type entt) {
+        const auto key = key_of(entt);
+
+        if(auto it = lower_bound(key); it != blocks.end() && it->key == key && it->erase(low_of(entt))) {
+            if(it->count == 0u) {
+                blocks.erase(it);
+            }
+
+            return --length, 1u;
+        }
+
+        return 0u;
+    }
+
+    /**
+     * @brief Adds all the identifiers of a given bitset to this one.
+     * @param other The bitset to merge with this one.
+     * @return This bitset.
+     */
+    basic_entity_bitset &operator|=(const basic_entity_bitset &other) {
+        for(auto &&elem: other.blocks) {
+            auto it = lower_bound(elem.key);
+
+            if(it == blocks.end() || it->key != elem.key) {
+                it = blocks.emplace(it, elem);
+            } else {
+                length -= it->count;
+                unite(*it, elem);
+            }
+
+            length += it->count;
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Removes all the identifiers that aren't part of a given bitset.
+     * @param other The bitset to intersect with this one.
+     * @return This bitset.
+     */
+    basic_entity_bitset &operator&=(const basic_entity_bitset &other) {
+        length = 0u;
+
+        for(auto &&elem: blocks) {
+            if(const auto it = other.lower_bound(elem.key); it != other.blocks.end() && it->key == elem.key) {
+                intersect(elem, *it);
+                length += elem.count;
+            } else {
+                elem.count = 0u;
+            }
+        }
+
+        compact();
+        return *this;
+    }
+
+    /**
+     * @brief Removes all the identifiers that are part of a given bitset.
+     * @param other The bitset to subtract from this one.
+     * @return This bitset.
+     */
+    basic_entity_bitset &operator-=(const basic_entity_bitset &other) {
+        length = 0u;
+
+        for(auto &&elem: blocks) {
+            if(const auto it = other.lower_bound(elem.key); it != other.blocks.end() && it->key == elem.key) {
+                subtract(elem, *it);
+            }
+
+            length += elem.count;
+        }
+
+        compact();
+        return *this;
+    }
+
+    /**
+     * @brief Returns the union of two bitsets.
+     * @param lhs A valid bitset.
+     * @param rhs A valid bitset.
+     * @return The union of the two bitsets.
+     */
+    [[nodiscard]] friend basic_entity_bitset operator|(basic_entity_bitset lhs, const basic_entity_bitset &rhs) {
+        lhs |= rhs;
+        return lhs;
+    }
+
+    /**
+     * @brief Returns the intersection of two bitsets.
+     * @param lhs A valid bitset.
+     * @param rhs A valid bitset.
+     * @return The intersection of the two bitsets.
+     */
+    [[nodiscard]] friend basic_entity_bitset operator&(basic_entity_bitset lhs, const basic_entity_bitset &rhs) {
+        lhs &= rhs;
+        return lhs;
+    }
+
+    /**
+     * @brief Returns the difference of two bitsets.
+     * @param lhs A valid bitset.
+     * @param rhs A valid bitset.
+     * @return The identifiers of the first bitset that aren't in the second one.
+     */
+    [[nodiscard]] friend basic_entity_bitset operator-(basic_entity_bitset lhs, const basic_entity_bitset &rhs) {
+        lhs -= rhs;
+        return lhs;
+    }
+
+private:
+    container_type blocks;
+    size_type length;
+};
+
+} // namespace entt
+
+#endif
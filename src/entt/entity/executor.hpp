@@ -0,0 +1,374 @@
+#ifndef ENTT_ENTITY_EXECUTOR_HPP
+#define ENTT_ENTITY_EXECUTOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+#include "organizer.hpp"
+
+namespace entt {
+
+/**
+ * @brief Work-stealing executor for task graphs.
+ *
+ * This class runs the task graphs generated by an organizer on a pool of
+ * worker threads. Each worker has its own queue of ready tasks and steals from
+ * the others when it runs out of work.<br/>
+ * A task is scheduled as soon as all its dependencies have been completed,
+ * therefore independent tasks run concurrently whenever possible.<br/>
+ * The executor measures the duration of the tasks and keeps a moving average
+ * of them from one run to the next. Ready tasks are started in order of upward
+ * rank (the cost of the longest chain of tasks that depend on them), so that
+ * the critical path of a graph is never left behind.<br/>
+ * Data-parallel vertices are split into chunks as soon as they are ready. The
+ * chunks run concurrently and the successors of the vertex are released once
+ * the last one has been completed.<br/>
+ * Vertices that have nothing to do when they are ready are skipped instead.
+ *
+ * @warning
+ * Tasks aren't expected to throw. Exceptions escaping a task running on a
+ * worker thread result in a call to `std::terminate`.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_executor final {
+    using vertex_type = typename basic_organizer<Registry>::vertex;
+
+    static constexpr auto whole = std::numeric_limits<std::size_t>::max();
+
+    struct job_type final {
+        std::size_t task;
+        std::size_t chunk;
+    };
+
+    struct worker_queue final {
+        std::mutex mutex;
+        std::deque<job_type> tasks;
+    };
+
+    void push(const std::size_t slot, const std::size_t task, const std::size_t chunk = whole) {
+        {
+            std::lock_guard guard{queues[slot].mutex};
+            queues[slot].tasks.push_back(job_type{task, chunk});
+        }
+
+        queued.fetch_add(1u, std::memory_order_release);
+
+        {
+            std::lock_guard guard{mutex};
+        }
+
+        cv.notify_one();
+    }
+
+    [[nodiscard]] bool try_pop(const std::size_t slot, job_type &task) {
+        const auto len = queues.size();
+
+        for(std::size_t pos{}; pos < len; ++pos) {
+            auto &curr = queues[(slot + pos) % len];
+            std::lock_guard guard{curr.mutex};
+
+            if(!curr.tasks.empty()) {
+                // lifo on the local queue, fifo when stealing from the others
+                if(pos == 0u) {
+                    task = curr.tasks.back();
+                    curr.tasks.pop_back();
+                } else {
+                    task = curr.tasks.front();
+                    curr.tasks.pop_front();
+                }
+
+                queued.fetch_sub(1u, std::memory_order_acq_rel);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void prioritize(const std::vector<vertex_type> &adjacency_list) {
+        const auto len = adjacency_list.size();
+        std::vector<std::size_t> count(len);
+        std::vector<std::size_t> ready{};
+
+        if(estimate.size() != len) {
+            estimate.assign(len, 0.f);
+        }
+
+        rank.assign(len, 0.f);
+
+        for(std::size_t pos{}; pos < len; ++pos) {
+            if((count[pos] = adjacency_list[pos].out_edges().size()) == 0u) {
+                ready.push_back(pos);
+            }
+        }
+
+        while(!ready.empty()) {
+            const auto curr = ready.back();
+            ready.pop_back();
+            // unmeasured tasks count as one microsecond, as for unit costs
+            rank[curr] += (std::max)(estimate[curr], 1.f);
+
+            for(auto prev: adjacency_list[curr].in_edges()) {
+                rank[prev] = (std::max)(rank[prev], rank[curr]);
+
+                if(--count[prev] == 0u) {
+                    ready.push_back(prev);
+                }
+            }
+        }
+    }
+
+    void execute(const std::size_t slot, const job_type job) {
+        const auto &curr = (*graph)[job.task];
+
+        if(job.chunk == whole && !curr.has_work(*owner)) {
+            // nothing to iterate, successors are released right away
+            release(slot, job.task);
+        } else if(job.chunk != whole) {
+            curr.chunk(*owner, job.chunk);
+
+            if(parts[job.task].fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+                release(slot, job.task);
+            }
+        } else if(const auto count = curr.chunks(*owner); count > 1u) {
+            parts[job.task].store(count, std::memory_order_relaxed);
+
+            // the other chunks are up for grabs, the first one runs right away
+            for(std::size_t pos{1u}; pos < count; ++pos) {
+                push(slot, job.task, pos);
+            }
+
+            const auto from = std::chrono::steady_clock::now();
+            curr.chunk(*owner, 0u);
+            const std::chrono::duration<float, std::micro> elapsed = std::chrono::steady_clock::now() - from;
+            estimate[job.task] += (elapsed.count() * static_cast<float>(count) - estimate[job.task]) * .25f;
+
+            if(parts[job.task].fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+                release(slot, job.task);
+            }
+        } else {
+            const auto from = std::chrono::steady_clock::now();
+            curr.chunk(*owner, 0u);
+            const std::chrono::duration<float, std::micro> elapsed = std::chrono::steady_clock::now() - from;
+            estimate[job.task] += (elapsed.count() - estimate[job.task]) * .25f;
+            release(slot, job.task);
+        }
+    }
+
+    void release(const std::size_t slot, const std::size_t task) {
+        // the local queue is lifo, the most urgent successor goes last
+        auto best = graph->size();
+
+        for(auto next: (*graph)[task].out_edges()) {
+            if(pending[next].fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+                if(best == graph->size()) {
+                    best = next;
+                } else if(rank[best] < rank[next]) {
+                    push(slot, std::exchange(best, next));
+                } else {
+                    push(slot, next);
+                }
+            }
+        }
+
+        if(best != graph->size()) {
+            push(slot, best);
+        }
+
+        if(remaining.fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+            {
+                std::lock_guard guard{mutex};
+            }
+
+            cv.notify_all();
+        }
+    }
+
+    void work(const std::size_t slot) {
+        for(job_type task{};;) {
+            if(try_pop(slot, task)) {
+                execute(slot, task);
+            } else {
+                std::unique_lock lock{mutex};
+                cv.wait_for(lock, std::chrono::milliseconds{1}, [this]() { return stop || (queued.load(std::memory_order_acquire) != 0u); });
+
+                if(stop) {
+                    break;
+                }
+            }
+        }
+    }
+
+public:
+    /*! @brief Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Vertex type of the task graphs run by the executor. */
+    using vertex = vertex_type;
+
+    /*! @brief Default constructor, one worker per hardware thread. */
+    basic_executor()
+        : basic_executor{std::thread::hardware_concurrency()} {}
+
+    /**
+     * @brief Constructs an executor with a given number of workers.
+     *
+     * The calling thread always takes part in the execution of a task graph.
+     * Therefore, zero is a valid number of workers and makes the executor run
+     * tasks sequentially on the calling thread.
+     *
+     * @param count The number of worker threads to spawn.
+     */
+    explicit basic_executor(const size_type count)
+        : queues(count + 1u),
+          workers{} {
+        workers.reserve(count);
+
+        for(size_type pos{}; pos < count; ++pos) {
+            workers.emplace_back(&basic_executor::work, this, pos);
+        }
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_executor(const basic_executor &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_executor(basic_executor &&) = delete;
+
+    /*! @brief Stops and joins all worker threads. */
+    ~basic_executor() {
+        {
+            std::lock_guard guard{mutex};
+            stop = true;
+        }
+
+        cv.notify_all();
+
+        for(auto &&elem: workers) {
+            elem.join();
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This executor.
+     */
+    basic_executor &operator=(const basic_executor &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This executor.
+     */
+    basic_executor &operator=(basic_executor &&) = delete;
+
+    /**
+     * @brief Returns the number of worker threads.
+     * @return The number of worker threads.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return workers.size();
+    }
+
+    /**
+     * @brief Returns the estimated duration of a task of the last graph run.
+     * @param pos Position of the task in the task graph.
+     * @return The moving average of the durations of the task, in
+     * microseconds.
+     */
+    [[nodiscard]] float cost(const size_type pos) const {
+        ENTT_ASSERT(pos < estimate.size(), "Invalid task");
+        return estimate[pos];
+    }
+
+    /**
+     * @brief Runs a task graph and waits for all its tasks to complete.
+     *
+     * All vertices are prepared on the calling thread before running any task,
+     * so that no storage is lazily created while tasks run concurrently.
+     *
+     * @warning
+     * A task graph must be run by only one thread at a time.
+     *
+     * @param adjacency_list The task graph to run.
+     * @param reg A valid registry.
+     */
+    void run(const std::vector<vertex_type> &adjacency_list, registry_type &reg) {
+        const auto len = adjacency_list.size();
+
+        ENTT_ASSERT(remaining.load(std::memory_order_acquire) == 0u, "Executor is already running");
+
+        for(auto &&curr: adjacency_list) {
+            curr.prepare(reg);
+        }
+
+        graph = &adjacency_list;
+        owner = &reg;
+        pending = std::make_unique<std::atomic<size_type>[]>(len);
+        parts = std::make_unique<std::atomic<size_type>[]>(len);
+        remaining.store(len, std::memory_order_release);
+
+        std::vector<size_type> top{};
+        prioritize(adjacency_list);
+
+        for(size_type pos{}; pos < len; ++pos) {
+            pending[pos].store(adjacency_list[pos].in_edges().size(), std::memory_order_relaxed);
+
+            if(adjacency_list[pos].top_level()) {
+                top.push_back(pos);
+            }
+        }
+
+        // lowest ranks first, so that each queue ends with its most urgent task
+        std::stable_sort(top.begin(), top.end(), [this](const auto lhs, const auto rhs) { return rank[lhs] < rank[rhs]; });
+
+        for(size_type pos{}, slot{}; pos < top.size(); ++pos) {
+            push(slot, top[pos]);
+            slot = (slot + 1u) % queues.size();
+        }
+
+        for(job_type task{}; remaining.load(std::memory_order_acquire) != 0u;) {
+            if(try_pop(workers.size(), task)) {
+                execute(workers.size(), task);
+            } else {
+                std::unique_lock lock{mutex};
+                cv.wait_for(lock, std::chrono::milliseconds{1}, [this]() { return (remaining.load(std::memory_order_acquire) == 0u) || (queued.load(std::memory_order_acquire) != 0u); });
+            }
+        }
+
+        graph = nullptr;
+        owner = nullptr;
+    }
+
+private:
+    std::vector<worker_queue> queues;
+    std::vector<std::thread> workers;
+    std::unique_ptr<std::atomic<size_type>[]> pending{};
+    std::unique_ptr<std::atomic<size_type>[]> parts{};
+    std::vector<float> estimate{};
+    std::vector<float> rank{};
+    std::atomic<size_type> remaining{};
+    std::atomic<size_type> queued{};
+    std::mutex mutex{};
+    std::condition_variable cv{};
+    const std::vector<vertex_type> *graph{};
+    registry_type *owner{};
+    bool stop{};
+};
+
+} // namespace entt
+
+#endif
@@ -25,6 +25,22 @@ enum class deletion_policy : std::uint8_t {
     unspecified = swap_and_pop
 };
 
+/*! @brief Recycling policy of entity storage classes. */
+enum class recycling_policy : std::uint8_t {
+    /*! @brief Most recently released identifiers first. */
+    last_in_first_out = 0u,
+    /*! @brief Identifiers with the lowest index first. */
+    lowest_index_first = 1u
+};
+
+/*! @brief Space filling curves used to sort spatial storage classes. */
+enum class space_filling_curve : std::uint8_t {
+    /*! @brief Morton (or Z-order) curve. */
+    morton = 0u,
+    /*! @brief Hilbert curve. */
+    hilbert = 1u
+};
+
 template<typename Type, typename Entity = entity, typename = void>
 struct component_traits;
 
@@ -34,12 +50,71 @@ class basic_sparse_set;
 template<typename Type, typename = entity, typename = std::allocator<Type>, typename = void>
 class basic_storage;
 
+template<typename = entity>
+class basic_entity_block;
+
+template<typename Type, typename = entity, typename = std::allocator<Type>>
+class basic_soa_storage;
+
+struct dynamic_element;
+
+template<typename = entity, typename = std::allocator<dynamic_element>>
+class basic_dynamic_storage;
+
+template<typename Type, typename = entity, typename = std::allocator<Type>>
+class basic_shared_storage;
+
+template<typename, typename = entity, typename = std::allocator<entity>>
+class basic_archetype;
+
+template<typename Type, typename = typename std::remove_const_t<Type>::soa_columns>
+class soa_reference;
+
 template<typename, typename>
 class basic_sigh_mixin;
 
 template<typename, typename>
 class basic_reactive_mixin;
 
+template<typename, typename>
+class basic_buffered_reactive_mixin;
+
+template<typename, auto>
+class index_mixin;
+
+template<typename, auto, auto>
+class spatial_mixin;
+
+template<typename, auto>
+class hierarchy_mixin;
+
+template<typename>
+class sorted_mixin;
+
+template<typename>
+class follow_mixin;
+
+template<typename>
+class changed_mixin;
+
+template<typename>
+class dirty_mixin;
+
+template<typename, typename>
+class checksum_mixin;
+
+template<typename>
+class statistics_mixin;
+
+template<typename, typename>
+class split_mixin;
+
+template<typename>
+class bitset_mixin;
+
+template<typename Entity = entity, typename = std::allocator<Entity>>
+class basic_entity_bitset;
+
 template<typename Entity = entity, typename = std::allocator<Entity>>
 class basic_registry;
 
@@ -49,24 +124,78 @@ class basic_view;
 template<typename Type, typename = std::allocator<Type *>>
 class basic_runtime_view;
 
+template<typename, typename...>
+class basic_poly_view;
+
 template<typename, typename, typename>
 class basic_group;
 
+template<typename, typename>
+class basic_cached_query;
+
+template<typename, typename>
+class basic_view_handle;
+
+template<typename>
+class columnar_export;
+
 template<typename>
 class basic_organizer;
 
+template<typename>
+class basic_executor;
+
+template<typename>
+class basic_command_buffer;
+
+template<typename>
+class basic_rollback;
+
+template<typename>
+class basic_partitioned_registry;
+
 template<typename, typename...>
 class basic_handle;
 
+template<typename, typename...>
+class basic_cached_handle;
+
+template<typename>
+class basic_component_ref;
+
 template<typename>
 class basic_snapshot;
 
+template<typename>
+class basic_snapshot_capture;
+
+template<typename>
+class basic_delta_snapshot;
+
 template<typename>
 class basic_snapshot_loader;
 
 template<typename>
 class basic_continuous_loader;
 
+template<typename>
+class basic_image_writer;
+
+template<typename, typename = void>
+struct snapshot_codec;
+
+template<typename, typename = void>
+class basic_packed_output_archive;
+
+template<typename, typename = void>
+class basic_packed_input_archive;
+
+template<typename>
+class basic_image_loader;
+
+template<typename>
+class basic_entity_pager;
+
 /*! @brief Alias declaration for the most common use case. */
 using sparse_set = basic_sparse_set<>;
 
@@ -77,6 +206,41 @@ using sparse_set = basic_sparse_set<>;
 template<typename Type>
 using storage = basic_storage<Type>;
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Type Element type.
+ */
+template<typename Type>
+using soa_storage = basic_soa_storage<Type>;
+
+/*! @brief Alias declaration for the most common use case. */
+using dynamic_storage = basic_dynamic_storage<>;
+
+/*! @brief Alias declaration for the most common use case. */
+using entity_block = basic_entity_block<>;
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Type Element type.
+ */
+template<typename Type>
+using shared_storage = basic_shared_storage<Type>;
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Type Types of elements assigned to entities.
+ */
+template<typename... Type>
+using archetype = basic_archetype<type_list<Type...>>;
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Hot Type of the hot part of the elements.
+ * @tparam Cold Type of the cold part of the elements.
+ */
+template<typename Hot, typename Cold>
+using split_storage = split_mixin<basic_storage<Hot>, Cold>;
+
 /**
  * @brief Alias declaration for the most common use case.
  * @tparam Type Underlying storage type.
@@ -91,12 +255,34 @@ using sigh_mixin = basic_sigh_mixin<Type, basic_registry<typename Type::entity_t
 template<typename Type>
 using reactive_mixin = basic_reactive_mixin<Type, basic_registry<typename Type::entity_type, typename Type::base_type::allocator_type>>;
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Type Underlying storage type.
+ */
+template<typename Type>
+using buffered_reactive_mixin = basic_buffered_reactive_mixin<Type, basic_registry<typename Type::entity_type, typename Type::base_type::allocator_type>>;
+
+/*! @brief Alias declaration for the most common use case. */
+using entity_bitset = basic_entity_bitset<>;
+
 /*! @brief Alias declaration for the most common use case. */
 using registry = basic_registry<>;
 
 /*! @brief Alias declaration for the most common use case. */
 using organizer = basic_organizer<registry>;
 
+/*! @brief Alias declaration for the most common use case. */
+using executor = basic_executor<registry>;
+
+/*! @brief Alias declaration for the most common use case. */
+using command_buffer = basic_command_buffer<registry>;
+
+/*! @brief Alias declaration for the most common use case. */
+using rollback = basic_rollback<registry>;
+
+/*! @brief Alias declaration for the most common use case. */
+using partitioned_registry = basic_partitioned_registry<registry>;
+
 /*! @brief Alias declaration for the most common use case. */
 using handle = basic_handle<registry>;
 
@@ -117,15 +303,50 @@ using handle_view = basic_handle<registry, Args...>;
 template<typename... Args>
 using const_handle_view = basic_handle<const registry, Args...>;
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Args Types of elements to which to restrict the scope of a handle.
+ */
+template<typename... Args>
+using cached_handle = basic_cached_handle<registry, Args...>;
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Args Types of elements to which to restrict the scope of a handle.
+ */
+template<typename... Args>
+using const_cached_handle = basic_cached_handle<const registry, Args...>;
+
 /*! @brief Alias declaration for the most common use case. */
 using snapshot = basic_snapshot<registry>;
 
+/*! @brief Alias declaration for the most common use case. */
+using snapshot_capture = basic_snapshot_capture<registry>;
+
+/*! @brief Alias declaration for the most common use case. */
+using delta_snapshot = basic_delta_snapshot<registry>;
+
 /*! @brief Alias declaration for the most common use case. */
 using snapshot_loader = basic_snapshot_loader<registry>;
 
 /*! @brief Alias declaration for the most common use case. */
 using continuous_loader = basic_continuous_loader<registry>;
 
+/*! @brief Alias declaration for the most common use case. */
+using image_writer = basic_image_writer<registry>;
+
+/*! @brief Alias declaration for the most common use case. */
+using image_loader = basic_image_loader<registry>;
+
+/*! @brief Alias declaration for the most common use case. */
+using entity_pager = basic_entity_pager<registry>;
+
+/*! @brief Alias declaration for the most common use case. */
+using packed_output_archive = basic_packed_output_archive<entity>;
+
+/*! @brief Alias declaration for the most common use case. */
+using packed_input_archive = basic_packed_input_archive<entity>;
+
 /*! @brief Alias declaration for the most common use case. */
 using runtime_view = basic_runtime_view<sparse_set>;
 
@@ -225,7 +446,11 @@ struct type_list_transform<owned_t<Type...>, Op> {
 template<typename Type, typename Entity = entity, typename Allocator = std::allocator<Type>, typename = void>
 struct storage_type {
     /*! @brief Type-to-storage conversion result. */
+#ifdef ENTT_USE_STATISTICS
+    using type = ENTT_STORAGE(sigh_mixin, statistics_mixin<basic_storage<Type, Entity, Allocator>>);
+#else
     using type = ENTT_STORAGE(sigh_mixin, basic_storage<Type, Entity, Allocator>);
+#endif
 };
 
 /*! @brief Empty value type for reactive storage types. */
@@ -242,6 +467,20 @@ struct storage_type<reactive, Entity, Allocator> {
     using type = ENTT_STORAGE(reactive_mixin, basic_storage<reactive, Entity, Allocator>);
 };
 
+/*! @brief Placeholder value type for storage types of runtime defined types. */
+struct dynamic_element final {};
+
+/**
+ * @ brief Partial specialization for storage types of runtime defined types.
+ * @tparam Entity A valid entity type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Entity, typename Allocator>
+struct storage_type<dynamic_element, Entity, Allocator> {
+    /*! @brief Type-to-storage conversion result. */
+    using type = ENTT_STORAGE(sigh_mixin, basic_dynamic_storage<Entity, Allocator>);
+};
+
 /**
  * @brief Helper type.
  * @tparam Args Arguments to forward.
@@ -276,6 +515,29 @@ using storage_for_t = typename storage_for<Args...>::type;
 template<typename Get, typename Exclude = exclude_t<>>
 using view = basic_view<type_list_transform_t<Get, storage_for>, type_list_transform_t<Exclude, storage_for>>;
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Base Common base type of all elements, possibly const qualified.
+ * @tparam Type Types of elements iterated by the view.
+ */
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Get Types of elements iterated by the view.
+ * @tparam Exclude Types of elements used to filter the view.
+ */
+template<typename Get, typename Exclude = exclude_t<>>
+using view_handle = basic_view_handle<registry, view<Get, Exclude>>;
+
+template<typename Base, typename... Type>
+using poly_view = basic_poly_view<Base, storage_for_t<Type>...>;
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Type Type of element referenced.
+ */
+template<typename Type>
+using component_ref = basic_component_ref<storage_for_t<Type>>;
+
 /**
  * @brief Alias declaration for the most common use case.
  * @tparam Owned Types of storage _owned_ by the group.
@@ -285,6 +547,14 @@ using view = basic_view<type_list_transform_t<Get, storage_for>, type_list_trans
 template<typename Owned, typename Get = get_t<>, typename Exclude = exclude_t<>>
 using group = basic_group<type_list_transform_t<Owned, storage_for>, type_list_transform_t<Get, storage_for>, type_list_transform_t<Exclude, storage_for>>;
 
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Get Types of storage _observed_ by the query.
+ * @tparam Exclude Types of storage used to filter the query.
+ */
+template<typename Get, typename Exclude = exclude_t<>>
+using cached_query = basic_cached_query<type_list_transform_t<Get, storage_for>, type_list_transform_t<Exclude, storage_for>>;
+
 } // namespace entt
 
 #endif
@@ -1,18 +1,23 @@
 #ifndef ENTT_ENTITY_GROUP_HPP
 #define ENTT_ENTITY_GROUP_HPP
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <iterator>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
 #include "../core/algorithm.hpp"
 #include "../core/fwd.hpp"
 #include "../core/iterator.hpp"
+#include "../core/memory.hpp"
 #include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
+#include "component.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 
@@ -97,6 +102,18 @@ struct group_descriptor {
     [[nodiscard]] virtual bool owned(const id_type) const noexcept {
         return false;
     }
+    [[nodiscard]] virtual bool get(const id_type) const noexcept {
+        return false;
+    }
+    [[nodiscard]] virtual bool exclude(const id_type) const noexcept {
+        return false;
+    }
+    [[nodiscard]] virtual size_type size() const noexcept {
+        return 0u;
+    }
+    virtual void nest() noexcept {}
+    virtual void reconnect(const bool) {}
+    virtual void shrink_to_fit() {}
 };
 
 template<typename Type, std::size_t Owned, std::size_t Get, std::size_t Exclude>
@@ -109,54 +126,169 @@ class group_handler final: public group_descriptor {
         }
     }
 
-    void push_on_construct(const entity_type entt) {
-        if(std::apply([entt, pos = len](auto *cpool, auto *...other) { return cpool->contains(entt) && !(cpool->index(entt) < pos) && (other->contains(entt) && ...); }, pools)
-           && std::apply([entt](auto *...cpool) { return (!cpool->contains(entt) && ...); }, filter)) {
-            swap_elements(len++, entt);
+    [[nodiscard]] bool match(const entity_type entt) const {
+        return std::apply([entt, pos = len](auto *cpool, auto *...other) { return cpool->contains(entt) && !(cpool->index(entt) < pos) && (other->contains(entt) && ...); }, pools)
+               && std::apply([entt](auto *...cpool) { return (!cpool->contains(entt) && ...); }, filter);
+    }
+
+    void mark_unsorted() noexcept {
+        // sorting is deferred so that a batch of changes costs a single pass
+        unsorted = static_cast<bool>(sorter);
+    }
+
+    void partition() {
+        if(!pending.empty()) {
+            for(size_type next{}; next < Owned; ++next) {
+                for(size_type pos{}, end = pending.size(); pos < end; ++pos) {
+                    pools[next]->swap_elements((*pools[next])[len + pos], pending[pos]);
+                }
+            }
+
+            len += pending.size();
+            pending.clear();
+            mark_unsorted();
+        }
+    }
+
+    void push_on_construct(const entity_type *first, const std::size_t count) {
+        // ranges can point to packed arrays, collect first and partition owned storages later
+        for(const auto last = first + count; first != last; ++first) {
+            if(match(*first)) {
+                pending.push_back(*first);
+            }
         }
+
+        partition();
     }
 
     void push_on_destroy(const entity_type entt) {
         if(std::apply([entt, pos = len](auto *cpool, auto *...other) { return cpool->contains(entt) && !(cpool->index(entt) < pos) && (other->contains(entt) && ...); }, pools)
            && std::apply([entt](auto *...cpool) { return (0u + ... + cpool->contains(entt)) == 1u; }, filter)) {
             swap_elements(len++, entt);
+            mark_unsorted();
         }
     }
 
     void remove_if(const entity_type entt) {
         if(pools[0u]->contains(entt) && (pools[0u]->index(entt) < len)) {
             swap_elements(--len, entt);
+            mark_unsorted();
         }
     }
 
     void common_setup() {
         // we cannot iterate backwards because we want to leave behind valid entities in case of owned types
-        for(auto first = pools[0u]->rbegin(), last = first + static_cast<typename decltype(pools)::difference_type>(pools[0u]->size()); first != last; ++first) {
-            push_on_construct(*first);
+        push_on_construct(pools[0u]->data(), pools[0u]->size());
+    }
+
+    template<typename Exec>
+    void common_setup(Exec &&exec, const size_type grain) {
+        ENTT_ASSERT(grain != 0u, "Invalid grain size");
+        const auto *data = pools[0u]->data();
+        const auto length = pools[0u]->size();
+
+        // jobs only test entities and write to disjoint slots, swaps happen later on the calling thread
+        pending.assign(length, null);
+
+        std::forward<Exec>(exec)((length + grain - 1u) / grain, [this, data, length, grain](const size_type chunk) {
+            for(auto pos = chunk * grain, last = (std::min)(pos + grain, length); pos < last; ++pos) {
+                if(match(data[pos])) {
+                    pending[pos] = data[pos];
+                }
+            }
+        });
+
+        pending.erase(std::remove(pending.begin(), pending.end(), static_cast<entity_type>(null)), pending.end());
+        partition();
+    }
+
+    template<typename... OGType, typename... EType, std::size_t... OGIndex, std::size_t... EIndex>
+    void connect(const bool push, type_list<OGType...>, type_list<EType...>, std::index_sequence<OGIndex...>, std::index_sequence<EIndex...>) {
+        if(push) {
+            (static_cast<OGType *>(pools[OGIndex])->on_bulk_construct().template connect<&group_handler::push_on_construct>(*this), ...);
+            (static_cast<EType *>(filter[EIndex])->on_destroy().template connect<&group_handler::push_on_destroy>(*this), ...);
+        } else {
+            (static_cast<OGType *>(pools[OGIndex])->on_destroy().template connect<&group_handler::remove_if>(*this), ...);
+            (static_cast<EType *>(filter[EIndex])->on_construct().template connect<&group_handler::remove_if>(*this), ...);
         }
     }
 
+    template<std::size_t Size>
+    [[nodiscard]] static bool contains(const std::array<Type *, Size> &elem, const std::size_t from, const std::size_t to, const id_type hash) noexcept {
+        for(auto pos = from; pos < to; ++pos) {
+            if(elem[pos]->info().hash() == hash) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
 public:
     using common_type = Type;
     using size_type = typename Type::size_type;
 
-    template<typename... OGType, typename... EType>
-    group_handler(std::tuple<OGType &...> ogpool, std::tuple<EType &...> epool)
+    template<typename... OGType, typename... EType, typename... Args>
+    group_handler(std::tuple<OGType &...> ogpool, std::tuple<EType &...> epool, Args &&...args)
         : pools{std::apply([](auto &&...cpool) { return std::array<common_type *, (Owned + Get)>{&cpool...}; }, ogpool)},
-          filter{std::apply([](auto &&...cpool) { return std::array<common_type *, Exclude>{&cpool...}; }, epool)} {
-        std::apply([this](auto &...cpool) { ((cpool.on_construct().template connect<&group_handler::push_on_construct>(*this), cpool.on_destroy().template connect<&group_handler::remove_if>(*this)), ...); }, ogpool);
-        std::apply([this](auto &...cpool) { ((cpool.on_construct().template connect<&group_handler::remove_if>(*this), cpool.on_destroy().template connect<&group_handler::push_on_destroy>(*this)), ...); }, epool);
-        common_setup();
+          filter{std::apply([](auto &&...cpool) { return std::array<common_type *, Exclude>{&cpool...}; }, epool)},
+          bind{[](group_handler &self, const bool push) { self.connect(push, type_list<OGType...>{}, type_list<EType...>{}, std::index_sequence_for<OGType...>{}, std::index_sequence_for<EType...>{}); }},
+          pending{pools[0u]->get_allocator()} {
+        reconnect(true);
+        reconnect(false);
+        common_setup(std::forward<Args>(args)...);
     }
 
     [[nodiscard]] bool owned(const id_type hash) const noexcept override {
-        for(size_type pos{}; pos < Owned; ++pos) {
-            if(pools[pos]->info().hash() == hash) {
-                return true;
-            }
+        return contains(pools, 0u, Owned, hash);
+    }
+
+    [[nodiscard]] bool get(const id_type hash) const noexcept override {
+        return contains(pools, Owned, Owned + Get, hash);
+    }
+
+    [[nodiscard]] bool exclude(const id_type hash) const noexcept override {
+        return contains(filter, 0u, Exclude, hash);
+    }
+
+    [[nodiscard]] size_type size() const noexcept override {
+        return Owned + Get + Exclude;
+    }
+
+    void nest() noexcept override {
+        ENTT_ASSERT(!sorter, "Cannot nest sorted groups");
+        leaf = false;
+    }
+
+    void reconnect(const bool push) override {
+        // listeners connected last are invoked first
+        bind(*this, push);
+    }
+
+    [[nodiscard]] bool sortable() const noexcept {
+        return leaf;
+    }
+
+    [[nodiscard]] bool sorted() const noexcept {
+        return static_cast<bool>(sorter);
+    }
+
+    void sort_with(std::function<void()> func) {
+        sorter = std::move(func);
+        unsorted = false;
+    }
+
+    void sort_pending() {
+        if(unsorted) {
+            unsorted = false;
+            sorter();
         }
+    }
 
-        return false;
+    void update_if(const entity_type entt) {
+        if(pools[0u]->contains(entt) && (pools[0u]->index(entt) < len)) {
+            mark_unsorted();
+        }
     }
 
     [[nodiscard]] size_type length() const noexcept {
@@ -175,7 +307,12 @@ public:
 private:
     std::array<common_type *, (Owned + Get)> pools;
     std::array<common_type *, Exclude> filter;
+    void (*bind)(group_handler &, const bool);
+    std::vector<entity_type, typename Type::allocator_type> pending;
+    std::function<void()> sorter;
     std::size_t len{};
+    bool leaf{true};
+    bool unsorted{};
 };
 
 template<typename Type, std::size_t Get, std::size_t Exclude>
@@ -221,6 +358,10 @@ public:
         common_setup();
     }
 
+    void shrink_to_fit() override {
+        elem.shrink_to_fit();
+    }
+
     [[nodiscard]] common_type &handle() noexcept {
         return elem;
     }
@@ -551,6 +692,42 @@ public:
         }
     }
 
+    /**
+     * @brief Iterates a slice of a group and applies the given function object
+     * to the entities and elements in it.
+     *
+     * Offsets are relative to the beginning of the group. The returned offset
+     * is where the iteration should resume from and equals `size` once the
+     * whole group has been visited.<br/>
+     * The signature of the function is the same required by `each`.
+     *
+     * @warning
+     * Entities can be skipped or visited more than once if the group changes
+     * between calls.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param offset Position of the first entity of the slice.
+     * @param count Maximum number of entities in the slice.
+     * @param func A valid function object.
+     * @return The position past the last entity of the slice.
+     */
+    template<typename Func>
+    size_type each_range(const size_type offset, const size_type count, Func func) const {
+        const auto len = size();
+        const auto from = (std::min)(offset, len);
+        const auto to = from + (std::min)(count, len - from);
+
+        for(auto it = begin() + static_cast<difference_type>(from), last = begin() + static_cast<difference_type>(to); it != last; ++it) {
+            if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_group>().get({})))>) {
+                std::apply(func, std::tuple_cat(std::make_tuple(*it), get(*it)));
+            } else {
+                std::apply(func, get(*it));
+            }
+        }
+
+        return to;
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a group.
      *
@@ -676,6 +853,11 @@ private:
  *
  * The more types of storage are owned, the faster it is to iterate a group.
  *
+ * Owning groups can be nested, as long as the types of one of them are a
+ * subset of those of the other. In this case, the more restrictive group is a
+ * prefix of the less restrictive one in the owned storage and both of them are
+ * still iterated as tightly packed ranges.
+ *
  * @b Important
  *
  * Iterators aren't invalidated if:
@@ -708,6 +890,40 @@ class basic_group<owned_t<Owned...>, get_t<Get...>, exclude_t<Exclude...>> {
         return descriptor ? return_type{static_cast<Owned *>(descriptor->template storage<Index>())..., static_cast<Get *>(descriptor->template storage<sizeof...(Owned) + Other>())...} : return_type{};
     }
 
+    template<typename Type>
+    [[nodiscard]] static std::size_t chunk_end(const std::size_t pos, const std::size_t len) noexcept {
+        if constexpr(std::is_void_v<typename Type::value_type>) {
+            return len;
+        } else {
+            constexpr auto page = component_traits<typename Type::element_type, entity_type>::page_size;
+            return (std::min)(len, (pos / page + 1u) * page);
+        }
+    }
+
+    template<typename Type>
+    [[nodiscard]] static auto chunk_at([[maybe_unused]] Type *cpool, [[maybe_unused]] const std::size_t pos) {
+        if constexpr(std::is_void_v<typename Type::value_type>) {
+            return std::make_tuple();
+        } else {
+            constexpr auto page = component_traits<typename Type::element_type, entity_type>::page_size;
+            return std::make_tuple(to_address(cpool->raw()[pos / page]) + (pos % page));
+        }
+    }
+
+    template<std::size_t... Index, std::size_t... Other>
+    void track(const bool value, std::index_sequence<Index...>, std::index_sequence<Other...>) const {
+        auto cb = [this, value](auto *cpool) {
+            if(value) {
+                cpool->on_update().template connect<&handler::update_if>(*descriptor);
+            } else {
+                cpool->on_update().template disconnect<&handler::update_if>(*descriptor);
+            }
+        };
+
+        (cb(static_cast<std::remove_const_t<Owned> *>(descriptor->template storage<Index>())), ...);
+        (cb(static_cast<std::remove_const_t<Get> *>(descriptor->template storage<sizeof...(Owned) + Other>())), ...);
+    }
+
 public:
     /*! @brief Underlying entity identifier. */
     using entity_type = underlying_type;
@@ -879,6 +1095,18 @@ public:
         return descriptor != nullptr;
     }
 
+    /**
+     * @brief Checks whether a group can be sorted.
+     *
+     * Groups that have other, more restrictive groups nested within them
+     * cannot be sorted, since this would break the latter.
+     *
+     * @return True if the group can be sorted, false otherwise.
+     */
+    [[nodiscard]] bool sortable() const noexcept {
+        return *this && descriptor->sortable();
+    }
+
     /**
      * @brief Checks if a group contains an entity.
      * @param entt A valid identifier.
@@ -952,6 +1180,36 @@ public:
         }
     }
 
+    /**
+     * @brief Iterates a slice of a group and applies the given function object
+     * to the entities and elements in it.
+     *
+     * @sa basic_group<owned_t<>, get_t<Get...>, exclude_t<Exclude...>>::each_range
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param offset Position of the first entity of the slice.
+     * @param count Maximum number of entities in the slice.
+     * @param func A valid function object.
+     * @return The position past the last entity of the slice.
+     */
+    template<typename Func>
+    size_type each_range(const size_type offset, const size_type count, Func func) const {
+        const auto len = size();
+        const auto from = (std::min)(offset, len);
+        const auto to = from + (std::min)(count, len - from);
+        const auto cpools = pools_for(std::index_sequence_for<Owned...>{}, std::index_sequence_for<Get...>{});
+
+        for(auto args: iterable{{begin() + static_cast<difference_type>(from), cpools}, {begin() + static_cast<difference_type>(to), cpools}}) {
+            if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_group>().get({})))>) {
+                std::apply(func, args);
+            } else {
+                std::apply([&func](auto, auto &&...less) { func(std::forward<decltype(less)>(less)...); }, args);
+            }
+        }
+
+        return to;
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a group.
      *
@@ -995,6 +1253,10 @@ public:
      * * An iterator past the last element of the range to sort.
      * * A comparison function to use to compare the elements.
      *
+     * @warning
+     * Attempting to sort a group that isn't sortable results in undefined
+     * behavior.
+     *
      * @tparam Type Optional type of element to compare.
      * @tparam Other Other optional types of elements to compare.
      * @tparam Compare Type of comparison function object.
@@ -1024,6 +1286,7 @@ public:
      */
     template<std::size_t... Index, typename Compare, typename Sort = std_sort, typename... Args>
     void sort(Compare compare, Sort algo = Sort{}, Args &&...args) const {
+        ENTT_ASSERT(sortable(), "Cannot sort nested groups");
         const auto cpools = pools_for(std::index_sequence_for<Owned...>{}, std::index_sequence_for<Get...>{});
 
         if constexpr(sizeof...(Index) == 0) {
@@ -1052,6 +1315,122 @@ public:
         std::apply(cb, cpools);
     }
 
+    /**
+     * @brief Iterates the contiguous chunks of a group.
+     *
+     * Owned elements are arranged in the same order at the beginning of their
+     * storage. Therefore, a group is made of runs of entities whose owned
+     * elements are contiguous in memory, one for each page shared by all the
+     * owned storage.<br/>
+     * The function object is invoked once per run, in memory order. Its
+     * signature is equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type *, size_type, Type *...);
+     * @endcode
+     *
+     * The arguments are the entities of the run, their number and one array of
+     * elements per non-empty owned type, all of the same length. The
+     * _constness_ of the elements is as requested. Observed types are not
+     * contiguous and are never returned.
+     *
+     * @warning
+     * Adding or removing elements while iterating the chunks results in
+     * undefined behavior.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_chunk(Func func) const {
+        if(*this) {
+            const auto cpools = pools_for(std::index_sequence_for<Owned...>{}, std::index_sequence_for<Get...>{});
+            const auto *data = handle().data();
+
+            for(size_type pos{}, len = descriptor->length(), last{}; pos < len; pos = last) {
+                last = (std::min)({chunk_end<Owned>(pos, len)...});
+                std::apply(func, std::tuple_cat(std::make_tuple(data + pos, last - pos), chunk_at(std::get<Owned *>(cpools), pos)...));
+            }
+        }
+    }
+
+    /**
+     * @brief Keeps a group sorted according to the given comparison function.
+     *
+     * The group is sorted immediately, as if by `sort`. From then on, entities
+     * that enter or leave it and elements of the storage iterated by the group
+     * that are updated (for example, by calling `patch` or `replace`) only mark
+     * the group as unsorted. The group is sorted again by means of an insertion
+     * sort when `sort_pending` is invoked, once for all the changes.<br/>
+     * Since only a few elements are usually out of place, this is much cheaper
+     * than sorting the whole group every time.
+     *
+     * The comparison function object is copied and stored within the group. It
+     * must remain valid as long as the group is kept sorted.
+     *
+     * @warning
+     * Attempting to keep sorted a group that isn't sortable results in
+     * undefined behavior. The same applies when a more restrictive group is
+     * created on top of a group that is kept sorted.<br/>
+     * Iterators are invalidated every time the group is sorted again.
+     *
+     * @sa sort
+     *
+     * @tparam Type Optional type of element to compare.
+     * @tparam Other Other optional types of elements to compare.
+     * @tparam Compare Type of comparison function object.
+     * @param compare A valid comparison function object.
+     */
+    template<typename Type, typename... Other, typename Compare>
+    void keep_sorted(Compare compare) const {
+        keep_sorted<index_of<Type>, index_of<Other>...>(std::move(compare));
+    }
+
+    /**
+     * @brief Keeps a group sorted according to the given comparison function.
+     *
+     * @sa keep_sorted
+     *
+     * @tparam Index Optional indexes of elements to compare.
+     * @tparam Compare Type of comparison function object.
+     * @param compare A valid comparison function object.
+     */
+    template<std::size_t... Index, typename Compare>
+    void keep_sorted(Compare compare) const {
+        sort<Index...>(compare);
+        track(true, std::index_sequence_for<Owned...>{}, std::index_sequence_for<Get...>{});
+        descriptor->sort_with([group = *this, compare = std::move(compare)]() { group.template sort<Index...>(compare, insertion_sort{}); });
+    }
+
+    /**
+     * @brief Sorts a group kept sorted again, if anything changed since the
+     * last time it was sorted.
+     *
+     * @warning
+     * Iterators are invalidated if the group is sorted again.
+     */
+    void sort_pending() const {
+        if(*this) {
+            descriptor->sort_pending();
+        }
+    }
+
+    /*! @brief Stops keeping a group sorted, if it was. */
+    void stop_sorting() const {
+        if(*this) {
+            track(false, std::index_sequence_for<Owned...>{}, std::index_sequence_for<Get...>{});
+            descriptor->sort_with(nullptr);
+        }
+    }
+
+    /**
+     * @brief Checks whether a group is kept sorted.
+     * @return True if the group is kept sorted, false otherwise.
+     */
+    [[nodiscard]] bool sorted() const noexcept {
+        return *this && descriptor->sorted();
+    }
+
 private:
     handler *descriptor;
 };
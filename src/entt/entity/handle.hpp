@@ -2,6 +2,7 @@
 #define ENTT_ENTITY_HANDLE_HPP
 
 #include <iterator>
+#include <memory>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -426,6 +427,272 @@ template<typename... Args>
     return (rhs != lhs);
 }
 
+/**
+ * @brief Non-owning handle to an entity with cached storage.
+ *
+ * Like a handle restricted to a given set of types, but the storage for these
+ * types are looked up only once, when the handle is constructed. All accesses
+ * go straight to the storage afterwards, without searching the registry.
+ *
+ * @warning
+ * Storage for the given types must not be replaced or destroyed while the
+ * handle is in use.
+ *
+ * @tparam Registry Basic registry type.
+ * @tparam Type Types of elements to which to restrict the scope of a handle.
+ */
+template<typename Registry, typename... Type>
+class basic_cached_handle {
+    static_assert(sizeof...(Type) != 0u, "Empty scope not allowed");
+
+    using traits_type = entt_traits<typename Registry::entity_type>;
+
+    template<typename Elem>
+    using storage_type = constness_as_t<typename std::remove_const_t<Registry>::template storage_for_type<Elem>, Registry>;
+
+    template<typename Elem>
+    [[nodiscard]] static storage_type<Elem> *assure(Registry &ref) {
+        if constexpr(std::is_const_v<Registry>) {
+            // storage aren't created on const registries, they may not exist
+            return ref.template storage<Elem>();
+        } else {
+            return &ref.template storage<Elem>();
+        }
+    }
+
+    template<typename Elem>
+    [[nodiscard]] auto &pool_or_assert() const noexcept {
+        static_assert(type_list_contains_v<type_list<Type...>, Elem>, "Invalid type");
+        auto *elem = std::get<type_list_index_v<Elem, type_list<Type...>>>(pools);
+        ENTT_ASSERT(elem != nullptr, "Invalid storage");
+        return *elem;
+    }
+
+    template<typename Elem>
+    [[nodiscard]] bool has() const noexcept {
+        static_assert(type_list_contains_v<type_list<Type...>, Elem>, "Invalid type");
+        const auto *elem = std::get<type_list_index_v<Elem, type_list<Type...>>>(pools);
+        return elem != nullptr && elem->contains(entt);
+    }
+
+public:
+    /*! @brief Type of registry accepted by the handle. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename traits_type::value_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Constructs an invalid handle. */
+    basic_cached_handle() noexcept
+        : owner{},
+          entt{null},
+          pools{} {}
+
+    /**
+     * @brief Constructs a handle from a given registry and entity.
+     * @param ref An instance of the registry class.
+     * @param value A valid identifier.
+     */
+    basic_cached_handle(registry_type &ref, entity_type value)
+        : owner{&ref},
+          entt{value},
+          pools{assure<Type>(ref)...} {}
+
+    /*! @copydoc valid */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return owner && owner->valid(entt);
+    }
+
+    /**
+     * @brief Checks if a handle refers to a valid registry and entity.
+     * @return True if the handle refers to a valid registry and entity, false
+     * otherwise.
+     */
+    [[nodiscard]] bool valid() const {
+        return static_cast<bool>(*this);
+    }
+
+    /**
+     * @brief Returns a pointer to the underlying registry, if any.
+     * @return A pointer to the underlying registry, if any.
+     */
+    [[nodiscard]] registry_type *registry() const noexcept {
+        return owner;
+    }
+
+    /**
+     * @brief Returns the entity associated with a handle.
+     * @return The entity associated with the handle.
+     */
+    [[nodiscard]] entity_type entity() const noexcept {
+        return entt;
+    }
+
+    /*! @copydoc entity */
+    [[nodiscard]] operator entity_type() const noexcept {
+        return entity();
+    }
+
+    /**
+     * @brief Returns the storage for a given element type, if any.
+     * @tparam Elem Type of element of which to return the storage.
+     * @return A pointer to the storage for the given element type, if any.
+     */
+    template<typename Elem>
+    [[nodiscard]] storage_type<Elem> *storage() const noexcept {
+        static_assert(type_list_contains_v<type_list<Type...>, Elem>, "Invalid type");
+        return std::get<type_list_index_v<Elem, type_list<Type...>>>(pools);
+    }
+
+    /**
+     * @brief Assigns the given element to a handle.
+     * @tparam Elem Type of element to create.
+     * @tparam Args Types of arguments to use to construct the element.
+     * @param args Parameters to use to initialize the element.
+     * @return A reference to the newly created element.
+     */
+    template<typename Elem, typename... Args>
+    // NOLINTNEXTLINE(modernize-use-nodiscard)
+    decltype(auto) emplace(Args &&...args) const {
+        ENTT_ASSERT(valid(), "Invalid entity");
+        return pool_or_assert<Elem>().emplace(entt, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Assigns or replaces the given element for a handle.
+     * @tparam Elem Type of element to assign or replace.
+     * @tparam Args Types of arguments to use to construct the element.
+     * @param args Parameters to use to initialize the element.
+     * @return A reference to the newly created element.
+     */
+    template<typename Elem, typename... Args>
+    decltype(auto) emplace_or_replace(Args &&...args) const {
+        ENTT_ASSERT(valid(), "Invalid entity");
+        auto &cpool = pool_or_assert<Elem>();
+        return cpool.contains(entt) ? cpool.patch(entt, [&args...](auto &...curr) { ((curr = Elem{std::forward<Args>(args)...}), ...); }) : cpool.emplace(entt, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Patches the given element for a handle.
+     * @tparam Elem Type of element to patch.
+     * @tparam Func Types of the function objects to invoke.
+     * @param func Valid function objects.
+     * @return A reference to the patched element.
+     */
+    template<typename Elem, typename... Func>
+    decltype(auto) patch(Func &&...func) const {
+        return pool_or_assert<Elem>().patch(entt, std::forward<Func>(func)...);
+    }
+
+    /**
+     * @brief Replaces the given element for a handle.
+     * @tparam Elem Type of element to replace.
+     * @tparam Args Types of arguments to use to construct the element.
+     * @param args Parameters to use to initialize the element.
+     * @return A reference to the element being replaced.
+     */
+    template<typename Elem, typename... Args>
+    decltype(auto) replace(Args &&...args) const {
+        return patch<Elem>([&args...](auto &...curr) { ((curr = Elem{std::forward<Args>(args)...}), ...); });
+    }
+
+    /**
+     * @brief Removes the given elements from a handle.
+     * @tparam Elem Types of elements to remove.
+     * @return The number of elements actually removed.
+     */
+    template<typename... Elem>
+    // NOLINTNEXTLINE(modernize-use-nodiscard)
+    size_type remove() const {
+        return (size_type{} + ... + pool_or_assert<Elem>().remove(entt));
+    }
+
+    /**
+     * @brief Erases the given elements from a handle.
+     * @tparam Elem Types of elements to erase.
+     */
+    template<typename... Elem>
+    void erase() const {
+        (pool_or_assert<Elem>().erase(entt), ...);
+    }
+
+    /**
+     * @brief Checks if a handle has all the given elements.
+     * @tparam Elem Elements for which to perform the check.
+     * @return True if the handle has all the elements, false otherwise.
+     */
+    template<typename... Elem>
+    [[nodiscard]] bool all_of() const noexcept {
+        return (has<Elem>() && ...);
+    }
+
+    /**
+     * @brief Checks if a handle has at least one of the given elements.
+     * @tparam Elem Elements for which to perform the check.
+     * @return True if the handle has at least one of the given elements,
+     * false otherwise.
+     */
+    template<typename... Elem>
+    [[nodiscard]] bool any_of() const noexcept {
+        return (has<Elem>() || ...);
+    }
+
+    /**
+     * @brief Returns references to the given elements for a handle.
+     * @tparam Elem Types of elements to get.
+     * @return References to the elements owned by the handle.
+     */
+    template<typename... Elem>
+    [[nodiscard]] decltype(auto) get() const {
+        if constexpr(sizeof...(Elem) == 1u) {
+            return (pool_or_assert<Elem>().get(entt), ...);
+        } else {
+            return std::forward_as_tuple(get<Elem>()...);
+        }
+    }
+
+    /**
+     * @brief Returns a reference to the given element for a handle.
+     * @tparam Elem Type of element to get.
+     * @tparam Args Types of arguments to use to construct the element.
+     * @param args Parameters to use to initialize the element.
+     * @return Reference to the element owned by the handle.
+     */
+    template<typename Elem, typename... Args>
+    [[nodiscard]] decltype(auto) get_or_emplace(Args &&...args) const {
+        auto &cpool = pool_or_assert<Elem>();
+        return cpool.contains(entt) ? cpool.get(entt) : emplace<Elem>(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Returns pointers to the given elements for a handle.
+     * @tparam Elem Types of elements to get.
+     * @return Pointers to the elements owned by the handle.
+     */
+    template<typename... Elem>
+    [[nodiscard]] auto try_get() const {
+        if constexpr(sizeof...(Elem) == 1u) {
+            return has<Elem...>() ? std::addressof(storage<Elem...>()->get(entt)) : nullptr;
+        } else {
+            return std::make_tuple(try_get<Elem>()...);
+        }
+    }
+
+    /**
+     * @brief Returns a plain handle with the same scope.
+     * @return A handle referring to the same registry and the same entity.
+     */
+    [[nodiscard]] basic_handle<Registry, Type...> handle() const noexcept {
+        return owner ? basic_handle<Registry, Type...>{*owner, entt} : basic_handle<Registry, Type...>{};
+    }
+
+private:
+    registry_type *owner;
+    entity_type entt;
+    std::tuple<storage_type<Type> *...> pools;
+};
+
 } // namespace entt
 
 #endif
@@ -4,6 +4,7 @@
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include "../config/config.h"
 #include "../core/fwd.hpp"
 #include "../core/type_traits.hpp"
 #include "component.hpp"
@@ -97,6 +98,96 @@ private:
     registry_type *reg;
 };
 
+/**
+ * @brief Persistent view bound to a registry.
+ *
+ * Building a view requires searching the registry for all the storage it
+ * iterates. A view handle does it once and keeps the result around, so that
+ * the view is returned as is on subsequent requests. The view is rebuilt only
+ * when storage is created or discarded in the meantime.
+ *
+ * @tparam Registry Basic registry type.
+ * @tparam View Type of view returned by the handle.
+ */
+template<typename Registry, typename View>
+class basic_view_handle {
+    void refresh() const {
+        elem = as_view<registry_type>{*reg};
+        epoch = reg->epoch();
+    }
+
+public:
+    /*! @brief Type of registry to which the handle is bound. */
+    using registry_type = Registry;
+    /*! @brief Type of view returned by the handle. */
+    using view_type = View;
+
+    /*! @brief Default constructor. */
+    basic_view_handle() noexcept
+        : reg{},
+          elem{},
+          epoch{} {}
+
+    /**
+     * @brief Constructs a view handle for a given registry.
+     * @param source A valid reference to a registry.
+     */
+    explicit basic_view_handle(registry_type &source)
+        : reg{&source},
+          elem{},
+          epoch{} {
+        refresh();
+    }
+
+    /**
+     * @brief Returns a pointer to the underlying registry, if any.
+     * @return A pointer to the underlying registry, if any.
+     */
+    [[nodiscard]] registry_type *registry() const noexcept {
+        return reg;
+    }
+
+    /**
+     * @brief Returns the view, rebuilding it first if it's stale.
+     * @return A view for the underlying registry.
+     */
+    [[nodiscard]] const view_type &get() const {
+        ENTT_ASSERT(reg != nullptr, "Invalid registry");
+
+        if(epoch != reg->epoch()) {
+            refresh();
+        }
+
+        return elem;
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] const view_type &operator*() const {
+        return get();
+    }
+
+    /**
+     * @brief Returns a pointer to the view, rebuilding it first if it's stale.
+     * @return A pointer to a view for the underlying registry.
+     */
+    [[nodiscard]] const view_type *operator->() const {
+        return &get();
+    }
+
+    /**
+     * @brief Checks if a handle is bound to a registry.
+     * @return True if the handle is bound to a registry, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return (reg != nullptr);
+    }
+
+private:
+    registry_type *reg;
+    mutable view_type elem;
+    mutable typename registry_type::size_type epoch;
+};
+
 /**
  * @brief Helper to create a listener that directly invokes a member function.
  * @tparam Member Member function to invoke on an element of the given type.
@@ -129,9 +220,17 @@ typename basic_storage<Args...>::entity_type to_entity(const basic_storage<Args.
     const auto *page = storage.raw();
 
     // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    for(std::size_t pos{}, count = storage.size(); pos < count; pos += traits_type::page_size, ++page) {
-        if(const auto dist = (std::addressof(instance) - *page); dist >= 0 && dist < static_cast<decltype(dist)>(traits_type::page_size)) {
-            return *(static_cast<const typename basic_storage<Args...>::base_type &>(storage).rbegin() + static_cast<decltype(dist)>(pos) + dist);
+    if constexpr(traits_type::page_size == no_pagination) {
+        if(!storage.empty()) {
+            if(const auto dist = (std::addressof(instance) - *page); dist >= 0 && dist < static_cast<decltype(dist)>(storage.size())) {
+                return *(static_cast<const typename basic_storage<Args...>::base_type &>(storage).rbegin() + dist);
+            }
+        }
+    } else {
+        for(std::size_t pos{}, count = storage.size(); pos < count; pos += traits_type::page_size, ++page) {
+            if(const auto dist = (std::addressof(instance) - *page); dist >= 0 && dist < static_cast<decltype(dist)>(traits_type::page_size)) {
+                return *(static_cast<const typename basic_storage<Args...>::base_type &>(storage).rbegin() + static_cast<decltype(dist)>(pos) + dist);
+            }
         }
     }
     // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -1,14 +1,32 @@
 #ifndef ENTT_ENTITY_MIXIN_HPP
 #define ENTT_ENTITY_MIXIN_HPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/algorithm.hpp"
 #include "../core/any.hpp"
+#include "../core/bit.hpp"
+#include "../core/memory.hpp"
 #include "../core/type_info.hpp"
+#include "../core/type_traits.hpp"
+#include "../core/utility.hpp"
 #include "../signal/sigh.hpp"
+#include "component.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
+#include "sparse_set.hpp"
 
 namespace entt {
 
@@ -36,6 +54,13 @@ template<typename Type, typename Registry>
 struct has_on_destroy<Type, Registry, std::void_t<decltype(Type::on_destroy(std::declval<Registry &>(), std::declval<Registry>().create()))>>
     : std::true_type {};
 
+[[nodiscard]] constexpr std::uint64_t checksum_mix(std::uint64_t value) noexcept {
+    // splitmix64 finalizer, stable across platforms and runs
+    value = (value ^ (value >> 30u)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27u)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31u);
+}
+
 } // namespace internal
 /*! @endcond */
 
@@ -48,7 +73,14 @@ struct has_on_destroy<Type, Registry, std::void_t<decltype(Type::on_destroy(std:
  * void(basic_registry<entity_type> &, entity_type);
  * @endcode
  *
- * This applies to all signals made available.
+ * This applies to all signals made available, except for the bulk ones. The
+ * function type of a bulk listener is equivalent to:
+ *
+ * @code{.cpp}
+ * void(basic_registry<entity_type> &, const entity_type *, std::size_t);
+ * @endcode
+ *
+ * Bulk listeners receive a contiguous range of entities once per operation.
  *
  * @tparam Type Underlying storage type.
  * @tparam Registry Basic registry type.
@@ -60,18 +92,96 @@ class basic_sigh_mixin final: public Type {
 
     using basic_registry_type = basic_registry<typename owner_type::entity_type, typename owner_type::allocator_type>;
     using sigh_type = sigh<void(owner_type &, const typename underlying_type::entity_type), typename underlying_type::allocator_type>;
+    using bulk_sigh_type = sigh<void(owner_type &, const typename underlying_type::entity_type *, const std::size_t), typename underlying_type::allocator_type>;
     using underlying_iterator = typename underlying_type::base_type::basic_iterator;
 
+    using alloc_traits = std::allocator_traits<typename underlying_type::allocator_type>;
+    using field_container_type = dense_map<id_type, sigh_type, identity, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, sigh_type>>>;
+
+    template<auto>
+    struct field_tag {};
+
     static_assert(std::is_base_of_v<basic_registry_type, owner_type>, "Invalid registry type");
 
+#ifdef ENTT_USE_COMPONENT_MASK
+    template<typename, typename>
+    friend class basic_registry;
+
+    void mask(const typename underlying_type::entity_type entt, const bool value) {
+        // only storage classes created by a registry have a slot in its mask
+        if(owner != nullptr && mask_slot != static_cast<std::size_t>(-1)) {
+            const auto index = static_cast<std::size_t>(entt_traits<typename underlying_type::entity_type>::to_entity(entt));
+            value ? owner->mask.set(mask_slot, index) : owner->mask.reset(mask_slot, index);
+        }
+    }
+#endif
+
     [[nodiscard]] auto &owner_or_assert() const noexcept {
         ENTT_ASSERT(owner != nullptr, "Invalid pointer to registry");
         return static_cast<owner_type &>(*owner);
     }
 
+    void publish_construction(const typename underlying_type::entity_type entt) {
+#ifdef ENTT_USE_COMPONENT_MASK
+        mask(entt, true);
+#endif
+
+        // the registry is only looked up when there is someone to notify
+        if(!construction.empty()) {
+            construction.publish(owner_or_assert(), entt);
+        }
+
+        if(!bulk_construction.empty()) {
+            bulk_construction.publish(owner_or_assert(), &entt, 1u);
+        }
+    }
+
+    void publish_update(const typename underlying_type::entity_type entt) {
+        if(!update.empty()) {
+            update.publish(owner_or_assert(), entt);
+        }
+
+        // any field could have changed, all field listeners are notified
+        for(auto &&elem: fields) {
+            if(!elem.second.empty()) {
+                elem.second.publish(owner_or_assert(), entt);
+            }
+        }
+    }
+
+    void publish_construction(const std::size_t from, const std::size_t to) {
+        if(from != to && !(construction.empty() && bulk_construction.empty())) {
+            // listeners (owning groups among others) can reorder the packed array, they all get a stable copy of the range
+            const auto *data = underlying_type::base_type::data();
+            const std::vector<typename underlying_type::entity_type, typename alloc_traits::template rebind_alloc<typename underlying_type::entity_type>> range(data + from, data + to, underlying_type::get_allocator());
+            auto &reg = owner_or_assert();
+
+            if(!construction.empty()) {
+                for(const auto entt: range) {
+                    construction.publish(reg, entt);
+                }
+            }
+
+            if(!bulk_construction.empty()) {
+                bulk_construction.publish(reg, range.data(), range.size());
+            }
+        }
+    }
+
 private:
     void pop(underlying_iterator first, underlying_iterator last) final {
+        if(!bulk_destruction.empty() && first != last) {
+            // iterators are reversed, the last one precedes the range in memory
+            bulk_destruction.publish(owner_or_assert(), first.data() + (last.index() + 1), static_cast<std::size_t>(last - first));
+        }
+
         if(auto &reg = owner_or_assert(); destruction.empty()) {
+#ifdef ENTT_USE_COMPONENT_MASK
+            for(auto it = first; it != last; ++it) {
+                mask(*it, false);
+            }
+#endif
+
             underlying_type::pop(first, last);
         } else {
             for(; first != last; ++first) {
@@ -79,11 +189,39 @@ private:
                 destruction.publish(reg, entt);
                 const auto it = underlying_type::find(entt);
                 underlying_type::pop(it, it + 1u);
+#ifdef ENTT_USE_COMPONENT_MASK
+                mask(entt, false);
+#endif
             }
         }
     }
 
     void pop_all() final {
+        if(auto &reg = owner_or_assert(); !bulk_destruction.empty()) {
+            const auto *data = underlying_type::base_type::data();
+
+            if constexpr(std::is_same_v<typename underlying_type::element_type, entity_type>) {
+                if(const auto len = underlying_type::free_list(); len != 0u) {
+                    bulk_destruction.publish(reg, data, len);
+                }
+            } else if constexpr(underlying_type::storage_policy == deletion_policy::in_place) {
+                // tombstones split the packed array in contiguous runs of entities
+                for(std::size_t pos{}, len = underlying_type::base_type::size(); pos < len;) {
+                    const auto from = pos;
+
+                    for(; pos < len && data[pos] != tombstone; ++pos) {}
+
+                    if(from != pos) {
+                        bulk_destruction.publish(reg, data + from, pos - from);
+                    }
+
+                    for(; pos < len && data[pos] == tombstone; ++pos) {}
+                }
+            } else if(const auto len = underlying_type::base_type::size(); len != 0u) {
+                bulk_destruction.publish(reg, data, len);
+            }
+        }
+
         if(auto &reg = owner_or_assert(); !destruction.empty()) {
             if constexpr(std::is_same_v<typename underlying_type::element_type, entity_type>) {
                 for(typename underlying_type::size_type pos{}, last = underlying_type::free_list(); pos < last; ++pos) {
@@ -102,14 +240,24 @@ private:
             }
         }
 
+#ifdef ENTT_USE_COMPONENT_MASK
+        if constexpr(!std::is_same_v<typename underlying_type::element_type, entity_type>) {
+            for(auto entt: static_cast<typename underlying_type::base_type &>(*this)) {
+                if(entt != tombstone) {
+                    mask(entt, false);
+                }
+            }
+        }
+#endif
+
         underlying_type::pop_all();
     }
 
     underlying_iterator try_emplace(const typename underlying_type::entity_type entt, const bool force_back, const void *value) final {
         const auto it = underlying_type::try_emplace(entt, force_back, value);
 
-        if(auto &reg = owner_or_assert(); it != underlying_type::base_type::end()) {
-            construction.publish(reg, *it);
+        if(it != underlying_type::base_type::end()) {
+            publish_construction(*it);
         }
 
         return it;
@@ -145,10 +293,16 @@ public:
      */
     explicit basic_sigh_mixin(const allocator_type &allocator)
         : underlying_type{allocator},
+#ifdef ENTT_USE_COMPONENT_MASK
+          mask_slot{static_cast<std::size_t>(-1)},
+#endif
           owner{},
           construction{allocator},
           destruction{allocator},
-          update{allocator} {
+          update{allocator},
+          fields{allocator},
+          bulk_construction{allocator},
+          bulk_destruction{allocator} {
         if constexpr(internal::has_on_construct<typename underlying_type::element_type, Registry>::value) {
             entt::sink{construction}.template connect<&underlying_type::element_type::on_construct>();
         }
@@ -172,10 +326,16 @@ public:
     // NOLINTBEGIN(bugprone-use-after-move)
     basic_sigh_mixin(basic_sigh_mixin &&other) noexcept
         : underlying_type{std::move(other)},
+#ifdef ENTT_USE_COMPONENT_MASK
+          mask_slot{other.mask_slot},
+#endif
           owner{other.owner},
           construction{std::move(other.construction)},
           destruction{std::move(other.destruction)},
-          update{std::move(other.update)} {}
+          update{std::move(other.update)},
+          fields{std::move(other.fields)},
+          bulk_construction{std::move(other.bulk_construction)},
+          bulk_destruction{std::move(other.bulk_destruction)} {}
     // NOLINTEND(bugprone-use-after-move)
 
     /**
@@ -186,10 +346,16 @@ public:
     // NOLINTBEGIN(bugprone-use-after-move)
     basic_sigh_mixin(basic_sigh_mixin &&other, const allocator_type &allocator)
         : underlying_type{std::move(other), allocator},
+#ifdef ENTT_USE_COMPONENT_MASK
+          mask_slot{other.mask_slot},
+#endif
           owner{other.owner},
           construction{std::move(other.construction), allocator},
           destruction{std::move(other.destruction), allocator},
-          update{std::move(other.update), allocator} {}
+          update{std::move(other.update), allocator},
+          fields{std::move(other.fields), allocator},
+          bulk_construction{std::move(other.bulk_construction), allocator},
+          bulk_destruction{std::move(other.bulk_destruction), allocator} {}
     // NOLINTEND(bugprone-use-after-move)
 
     /*! @brief Default destructor. */
@@ -217,10 +383,16 @@ public:
      */
     void swap(basic_sigh_mixin &other) noexcept {
         using std::swap;
+#ifdef ENTT_USE_COMPONENT_MASK
+        swap(mask_slot, other.mask_slot);
+#endif
         swap(owner, other.owner);
         swap(construction, other.construction);
         swap(destruction, other.destruction);
         swap(update, other.update);
+        swap(fields, other.fields);
+        swap(bulk_construction, other.bulk_construction);
+        swap(bulk_destruction, other.bulk_destruction);
         underlying_type::swap(other);
     }
 
@@ -254,6 +426,27 @@ public:
         return sink{update};
     }
 
+    /**
+     * @brief Returns a sink object for a given data member.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever a data member of an instance is explicitly updated, either
+     * through a field-aware `patch` or `replace` or because the whole instance
+     * is updated.<br/>
+     * Listeners are invoked after the object has been updated.
+     *
+     * @sa sink
+     *
+     * @tparam Member Data member to observe.
+     * @return A temporary sink object.
+     */
+    template<auto Member>
+    [[nodiscard]] auto on_update() {
+        static_assert(std::is_member_object_pointer_v<decltype(Member)>, "Invalid data member");
+        static_assert(std::is_same_v<member_class_t<decltype(Member)>, typename underlying_type::element_type>, "Invalid data member");
+        return sink{fields.try_emplace(type_hash<field_tag<Member>>::value(), underlying_type::get_allocator()).first->second};
+    }
+
     /**
      * @brief Returns a sink object.
      *
@@ -269,6 +462,77 @@ public:
         return sink{destruction};
     }
 
+    /**
+     * @brief Returns a sink object for bulk notifications.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever new instances are created and assigned to entities.<br/>
+     * Listeners receive all the entities affected by an operation at once, as
+     * a contiguous range. Ranges are only valid for the duration of the call
+     * and listeners shouldn't modify the storage while iterating them.<br/>
+     * Listeners are invoked after the objects have been assigned to the
+     * entities.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_bulk_construct() noexcept {
+        return sink{bulk_construction};
+    }
+
+    /**
+     * @brief Returns a sink object for bulk notifications.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever instances are removed from entities and thus destroyed.<br/>
+     * Listeners receive all the entities affected by an operation at once, as
+     * a contiguous range. Ranges are only valid for the duration of the call
+     * and listeners shouldn't modify the storage while iterating them.<br/>
+     * Listeners are invoked before the objects have been removed from the
+     * entities.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_bulk_destroy() noexcept {
+        return sink{bulk_destruction};
+    }
+
+    /**
+     * @brief Checks if at least a listener is connected to the mixin.
+     *
+     * Storage classes without listeners behave as if they had no mixin, as
+     * long as all checks on signals are cheap. This function allows users to
+     * skip any other work done only to feed listeners, if any.
+     *
+     * @return True if at least a listener is connected, false otherwise.
+     */
+    [[nodiscard]] bool observed() const noexcept {
+        return !(construction.empty() && destruction.empty() && update.empty() && bulk_construction.empty() && bulk_destruction.empty())
+               || std::any_of(fields.cbegin(), fields.cend(), [](auto &&elem) { return !elem.second.empty(); });
+    }
+
+    /**
+     * @brief Returns the operation counters of a storage, if any.
+     *
+     * Counters are those of the underlying storage, if any. The number of
+     * listeners connected to the mixin is always reported.
+     *
+     * @return The operation counters of the storage.
+     */
+    [[nodiscard]] storage_statistics statistics() const noexcept override {
+        auto stats = underlying_type::statistics();
+        stats.listeners = construction.size() + destruction.size() + update.size() + bulk_construction.size() + bulk_destruction.size();
+
+        for(auto &&elem: fields) {
+            stats.listeners += elem.second.size();
+        }
+
+        return stats;
+    }
+
     /**
      * @brief Checks if a mixin refers to a valid registry.
      * @return True if the mixin refers to a valid registry, false otherwise.
@@ -296,7 +560,8 @@ public:
      */
     auto generate() {
         const auto entt = underlying_type::generate();
-        construction.publish(owner_or_assert(), entt);
+        publish_construction(entt);
+
         return entt;
     }
 
@@ -307,7 +572,8 @@ public:
      */
     entity_type generate(const entity_type hint) {
         const auto entt = underlying_type::generate(hint);
-        construction.publish(owner_or_assert(), entt);
+        publish_construction(entt);
+
         return entt;
     }
 
@@ -319,13 +585,37 @@ public:
      */
     template<typename It>
     void generate(It first, It last) {
+        const auto from = underlying_type::free_list();
         underlying_type::generate(first, last);
+        const auto to = underlying_type::free_list();
 
-        if(auto &reg = owner_or_assert(); !construction.empty()) {
-            for(; first != last; ++first) {
-                construction.publish(reg, *first);
-            }
-        }
+        // generated identifiers are contiguous right before the free list
+        publish_construction(from, to);
+    }
+
+    /*! @brief Makes all reserved identifiers valid. */
+    void materialize() {
+        const auto from = underlying_type::free_list();
+        underlying_type::materialize();
+        const auto to = underlying_type::free_list();
+
+        // materialized identifiers are contiguous right before the free list
+        publish_construction(from, to);
+    }
+
+    /**
+     * @brief Makes valid all identifiers created from a block.
+     * @tparam Block Type of block of identifiers.
+     * @param block A block of identifiers handed out by the storage.
+     */
+    template<typename Block>
+    void release_block(Block &block) {
+        const auto from = underlying_type::free_list();
+        underlying_type::release_block(block);
+        const auto to = underlying_type::free_list();
+
+        // released identifiers are contiguous right before the free list
+        publish_construction(from, to);
     }
 
     /**
@@ -338,7 +628,8 @@ public:
     template<typename... Args>
     decltype(auto) emplace(const entity_type entt, Args &&...args) {
         underlying_type::emplace(entt, std::forward<Args>(args)...);
-        construction.publish(owner_or_assert(), entt);
+        publish_construction(entt);
+
         return this->get(entt);
     }
 
@@ -352,10 +643,65 @@ public:
     template<typename... Func>
     decltype(auto) patch(const entity_type entt, Func &&...func) {
         underlying_type::patch(entt, std::forward<Func>(func)...);
-        update.publish(owner_or_assert(), entt);
+        publish_update(entt);
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Updates a data member of the instance assigned to a given entity
+     * in-place.
+     *
+     * Function objects receive a reference to the data member rather than to
+     * the whole instance. Only the listeners of the data member and those of
+     * the instance are notified.
+     *
+     * @tparam Member Data member to update.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<auto Member, typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        static_assert(std::is_member_object_pointer_v<decltype(Member)>, "Invalid data member");
+        underlying_type::patch(entt, [&func...](auto &elem) { (std::forward<Func>(func)(elem.*Member), ...); });
+
+        if(!update.empty()) {
+            update.publish(owner_or_assert(), entt);
+        }
+
+        if(const auto it = fields.find(type_hash<field_tag<Member>>::value()); it != fields.end() && !it->second.empty()) {
+            it->second.publish(owner_or_assert(), entt);
+        }
+
         return this->get(entt);
     }
 
+    /**
+     * @brief Replaces a data member of the instance assigned to a given entity.
+     *
+     * Nothing happens and no listeners are notified if the data member is
+     * equality comparable and already compares equal to the given value.
+     *
+     * @sa patch
+     *
+     * @tparam Member Data member to replace.
+     * @tparam Value Type of value to assign to the data member.
+     * @param entt A valid identifier.
+     * @param value The value to assign to the data member.
+     * @return A reference to the instance.
+     */
+    template<auto Member, typename Value>
+    decltype(auto) replace(const entity_type entt, Value &&value) {
+        if constexpr(is_equality_comparable_v<std::remove_reference_t<decltype(std::declval<typename underlying_type::element_type &>().*Member)>>) {
+            if(this->get(entt).*Member == value) {
+                return this->get(entt);
+            }
+        }
+
+        return patch<Member>(entt, [&value](auto &curr) { curr = std::forward<Value>(value); });
+    }
+
     /**
      * @brief Assigns one or more entities to a storage and constructs their
      * objects from a given instance.
@@ -367,22 +713,47 @@ public:
      */
     template<typename It, typename... Args>
     void insert(It first, It last, Args &&...args) {
-        auto from = underlying_type::size();
+        const auto from = underlying_type::size();
         underlying_type::insert(first, last, std::forward<Args>(args)...);
 
-        if(auto &reg = owner_or_assert(); !construction.empty()) {
-            // fine as long as insert passes force_back true to try_emplace
-            for(const auto to = underlying_type::size(); from != to; ++from) {
-                construction.publish(reg, underlying_type::operator[](from));
-            }
+        const auto to = underlying_type::size();
+
+#ifdef ENTT_USE_COMPONENT_MASK
+        for(auto pos = from; pos != to; ++pos) {
+            mask(underlying_type::base_type::operator[](pos), true);
+        }
+#endif
+
+        // fine as long as insert passes force_back true to try_emplace
+        publish_construction(from, to);
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() override {
+        underlying_type::shrink_to_fit();
+        construction.shrink_to_fit();
+        destruction.shrink_to_fit();
+        update.shrink_to_fit();
+
+        for(auto &&elem: fields) {
+            elem.second.shrink_to_fit();
         }
+
+        bulk_construction.shrink_to_fit();
+        bulk_destruction.shrink_to_fit();
     }
 
 private:
+#ifdef ENTT_USE_COMPONENT_MASK
+    std::size_t mask_slot;
+#endif
     basic_registry_type *owner;
     sigh_type construction;
     sigh_type destruction;
     sigh_type update;
+    field_container_type fields;
+    bulk_sigh_type bulk_construction;
+    bulk_sigh_type bulk_destruction;
 };
 
 /**
@@ -594,6 +965,3516 @@ private:
     container_type conn;
 };
 
+/**
+ * @brief Mixin type used to add double buffered _reactive_ support to storage
+ * types.
+ *
+ * Entities are collected in a buffer that isn't visible through the storage.
+ * Swapping the buffers discards the entities of the storage and replaces them
+ * with those collected in the meantime.<br/>
+ * Therefore, systems can consume the entities of the storage while further
+ * changes are recorded for the next round, without interfering with each
+ * other.
+ *
+ * @tparam Type Underlying storage type.
+ * @tparam Registry Basic registry type.
+ */
+template<typename Type, typename Registry>
+class basic_buffered_reactive_mixin final: public Type {
+    using underlying_type = Type;
+    using underlying_iterator = typename underlying_type::base_type::basic_iterator;
+    using owner_type = Registry;
+
+    using alloc_traits = std::allocator_traits<typename underlying_type::allocator_type>;
+    using basic_registry_type = basic_registry<typename owner_type::entity_type, typename owner_type::allocator_type>;
+    using container_type = std::vector<connection, typename alloc_traits::template rebind_alloc<connection>>;
+
+    static_assert(std::is_base_of_v<basic_registry_type, owner_type>, "Invalid registry type");
+
+    [[nodiscard]] auto &owner_or_assert() const noexcept {
+        ENTT_ASSERT(owner != nullptr, "Invalid pointer to registry");
+        return static_cast<owner_type &>(*owner);
+    }
+
+    static void emplace_element(underlying_type &buffer, const Registry &, typename underlying_type::entity_type entity) {
+        if(!buffer.contains(entity)) {
+            buffer.emplace(entity);
+        }
+    }
+
+private:
+    void bind_any(any value) noexcept final {
+        owner = any_cast<basic_registry_type>(&value);
+
+        if constexpr(!std::is_same_v<registry_type, basic_registry_type>) {
+            if(owner == nullptr) {
+                owner = any_cast<registry_type>(&value);
+            }
+        }
+
+        underlying_type::bind_any(std::move(value));
+    }
+
+protected:
+    /**
+     * @brief Erases entities from both buffers of a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        for(auto it = first; it != last; ++it) {
+            next.remove(*it);
+        }
+
+        underlying_type::pop(first, last);
+    }
+
+    /*! @brief Erases all entities from both buffers of a storage. */
+    void pop_all() override {
+        next.clear();
+        underlying_type::pop_all();
+    }
+
+    /**
+     * @brief Copies entities, elements and the pending buffer from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from(const typename underlying_type::base_type &other) override {
+        const auto &from = static_cast<const basic_buffered_reactive_mixin &>(other);
+        underlying_type::copy_from(other);
+        next.deep_copy_from(from.next);
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = typename underlying_type::allocator_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename underlying_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename underlying_type::size_type;
+    /*! @brief Expected registry type. */
+    using registry_type = owner_type;
+    /*! @brief Type of the buffer that collects entities. */
+    using buffer_type = underlying_type;
+
+    /*! @brief Default constructor. */
+    basic_buffered_reactive_mixin()
+        : basic_buffered_reactive_mixin{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_buffered_reactive_mixin(const allocator_type &allocator)
+        : underlying_type{allocator},
+          owner{},
+          next{allocator},
+          conn{allocator} {
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_buffered_reactive_mixin(const basic_buffered_reactive_mixin &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    basic_buffered_reactive_mixin(basic_buffered_reactive_mixin &&other) noexcept
+        : underlying_type{std::move(other)},
+          owner{other.owner},
+          next{std::move(other.next)},
+          conn{} {
+    }
+    // NOLINTEND(bugprone-use-after-move)
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    basic_buffered_reactive_mixin(basic_buffered_reactive_mixin &&other, const allocator_type &allocator)
+        : underlying_type{std::move(other), allocator},
+          owner{other.owner},
+          next{std::move(other.next), allocator},
+          conn{allocator} {
+    }
+    // NOLINTEND(bugprone-use-after-move)
+
+    /*! @brief Default destructor. */
+    ~basic_buffered_reactive_mixin() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This mixin.
+     */
+    basic_buffered_reactive_mixin &operator=(const basic_buffered_reactive_mixin &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This mixin.
+     */
+    basic_buffered_reactive_mixin &operator=(basic_buffered_reactive_mixin &&other) noexcept {
+        next.swap(other.next);
+        underlying_type::swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Makes storage _react_ to creation of objects of the given type.
+     *
+     * Custom functions receive the buffer that collects entities as their
+     * first argument, rather than the storage itself.
+     *
+     * @tparam Clazz Type of element to _react_ to.
+     * @tparam Candidate Function to use to _react_ to the event.
+     * @param id Optional name used to map the storage within the registry.
+     * @return This mixin.
+     */
+    template<typename Clazz, auto Candidate = &basic_buffered_reactive_mixin::emplace_element>
+    basic_buffered_reactive_mixin &on_construct(const id_type id = type_hash<Clazz>::value()) {
+        auto curr = owner_or_assert().template storage<Clazz>(id).on_construct().template connect<Candidate>(next);
+        conn.push_back(std::move(curr));
+        return *this;
+    }
+
+    /**
+     * @brief Makes storage _react_ to update of objects of the given type.
+     * @sa on_construct
+     * @tparam Clazz Type of element to _react_ to.
+     * @tparam Candidate Function to use to _react_ to the event.
+     * @param id Optional name used to map the storage within the registry.
+     * @return This mixin.
+     */
+    template<typename Clazz, auto Candidate = &basic_buffered_reactive_mixin::emplace_element>
+    basic_buffered_reactive_mixin &on_update(const id_type id = type_hash<Clazz>::value()) {
+        auto curr = owner_or_assert().template storage<Clazz>(id).on_update().template connect<Candidate>(next);
+        conn.push_back(std::move(curr));
+        return *this;
+    }
+
+    /**
+     * @brief Makes storage _react_ to destruction of objects of the given type.
+     * @sa on_construct
+     * @tparam Clazz Type of element to _react_ to.
+     * @tparam Candidate Function to use to _react_ to the event.
+     * @param id Optional name used to map the storage within the registry.
+     * @return This mixin.
+     */
+    template<typename Clazz, auto Candidate = &basic_buffered_reactive_mixin::emplace_element>
+    basic_buffered_reactive_mixin &on_destroy(const id_type id = type_hash<Clazz>::value()) {
+        auto curr = owner_or_assert().template storage<Clazz>(id).on_destroy().template connect<Candidate>(next);
+        conn.push_back(std::move(curr));
+        return *this;
+    }
+
+    /**
+     * @brief Discards the entities of a storage and replaces them with those
+     * collected in the meantime.
+     */
+    void swap_buffers() {
+        // the consumed entities end up in the buffer, that is cleared later
+        underlying_type::swap(next);
+        next.clear();
+    }
+
+    /**
+     * @brief Returns the buffer that collects entities.
+     * @return The buffer that collects entities.
+     */
+    [[nodiscard]] const buffer_type &pending() const noexcept {
+        return next;
+    }
+
+    /**
+     * @brief Checks if a mixin refers to a valid registry.
+     * @return True if the mixin refers to a valid registry, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return (owner != nullptr);
+    }
+
+    /**
+     * @brief Returns a pointer to the underlying registry, if any.
+     * @return A pointer to the underlying registry, if any.
+     */
+    [[nodiscard]] const registry_type &registry() const noexcept {
+        return owner_or_assert();
+    }
+
+    /*! @copydoc registry */
+    [[nodiscard]] registry_type &registry() noexcept {
+        return owner_or_assert();
+    }
+
+    /**
+     * @brief Returns a view that is filtered by the underlying storage.
+     * @tparam Get Types of elements used to construct the view.
+     * @tparam Exclude Types of elements used to filter the view.
+     * @return A newly created view.
+     */
+    template<typename... Get, typename... Exclude>
+    [[nodiscard]] basic_view<get_t<const basic_buffered_reactive_mixin, typename basic_registry_type::template storage_for_type<const Get>...>, exclude_t<typename basic_registry_type::template storage_for_type<const Exclude>...>>
+    view(exclude_t<Exclude...> = exclude_t{}) const {
+        const owner_type &parent = owner_or_assert();
+        basic_view<get_t<const basic_buffered_reactive_mixin, typename basic_registry_type::template storage_for_type<const Get>...>, exclude_t<typename basic_registry_type::template storage_for_type<const Exclude>...>> elem{};
+        [&elem](const auto *...curr) { ((curr ? elem.storage(*curr) : void()), ...); }(parent.template storage<std::remove_const_t<Exclude>>()..., parent.template storage<std::remove_const_t<Get>>()..., this);
+        return elem;
+    }
+
+    /*! @copydoc view */
+    template<typename... Get, typename... Exclude>
+    [[nodiscard]] basic_view<get_t<const basic_buffered_reactive_mixin, typename basic_registry_type::template storage_for_type<Get>...>, exclude_t<typename basic_registry_type::template storage_for_type<Exclude>...>>
+    view(exclude_t<Exclude...> = exclude_t{}) {
+        std::conditional_t<((std::is_const_v<Get> && ...) && (std::is_const_v<Exclude> && ...)), const owner_type, owner_type> &parent = owner_or_assert();
+        return {*this, parent.template storage<std::remove_const_t<Get>>()..., parent.template storage<std::remove_const_t<Exclude>>()...};
+    }
+
+    /*! @brief Releases all connections to the underlying registry, if any. */
+    void reset() {
+        for(auto &&curr: conn) {
+            curr.release();
+        }
+
+        conn.clear();
+    }
+
+private:
+    basic_registry_type *owner;
+    underlying_type next;
+    container_type conn;
+};
+
+/**
+ * @brief Mixin type used to add a secondary index to storage types.
+ *
+ * The index maps the values returned by a projection of the elements to the
+ * entities that own them. It's kept up to date when elements are created,
+ * patched, replaced or destroyed through the storage (or the registry).<br/>
+ * Keys are expected to be unique within a storage. Lookups are performed in
+ * constant time on average.
+ *
+ * @warning
+ * Elements updated without passing through `patch` or `replace` (for example,
+ * when modified directly via `get`) leave the index in an inconsistent state.
+ *
+ * @tparam Type Underlying storage type.
+ * @tparam Member Data member or member function used to extract the key.
+ */
+template<typename Type, auto Member>
+class index_mixin: public Type {
+    using underlying_type = Type;
+    using underlying_iterator = typename underlying_type::base_type::basic_iterator;
+
+    static_assert(!std::is_void_v<typename underlying_type::value_type>, "Invalid value type");
+
+    using key_type = std::remove_const_t<std::remove_reference_t<std::invoke_result_t<decltype(Member), const typename underlying_type::value_type &>>>;
+    using alloc_traits = std::allocator_traits<typename underlying_type::allocator_type>;
+    using container_type = dense_map<key_type, typename underlying_type::entity_type, std::hash<key_type>, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const key_type, typename underlying_type::entity_type>>>;
+
+    [[nodiscard]] static decltype(auto) key_of(const typename underlying_type::value_type &elem) {
+        return std::invoke(Member, elem);
+    }
+
+    void index_element(const typename underlying_type::entity_type entt) {
+        decltype(auto) key = key_of(underlying_type::get(entt));
+        ENTT_ASSERT(lookup.find(key) == lookup.end() || lookup.find(key)->second == entt, "Duplicate key");
+        lookup.insert_or_assign(key, entt);
+    }
+
+    void drop_element(const typename underlying_type::entity_type entt) {
+        // keys reassigned to other entities must survive
+        if(const auto it = lookup.find(key_of(underlying_type::get(entt))); it != lookup.end() && it->second == entt) {
+            lookup.erase(it);
+        }
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        for(auto it = first; it != last; ++it) {
+            drop_element(*it);
+        }
+
+        underlying_type::pop(first, last);
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        lookup.clear();
+        underlying_type::pop_all();
+    }
+
+    /**
+     * @brief Copies entities, elements and the lookup table from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from(const typename underlying_type::base_type &other) override {
+        const auto &from = static_cast<const index_mixin &>(other);
+        underlying_type::copy_from(other);
+        lookup = from.lookup;
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param force_back Force back insertion.
+     * @param value Optional opaque value.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace(const typename underlying_type::entity_type entt, const bool force_back, const void *value) override {
+        const auto it = underlying_type::try_emplace(entt, force_back, value);
+
+        if(it != underlying_type::base_type::end()) {
+            index_element(*it);
+        }
+
+        return it;
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = typename underlying_type::allocator_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename underlying_type::entity_type;
+    /*! @brief Type of keys used by the index. */
+    using index_key_type = key_type;
+
+    /*! @brief Default constructor. */
+    index_mixin()
+        : index_mixin{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit index_mixin(const allocator_type &allocator)
+        : underlying_type{allocator},
+          lookup{allocator} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    index_mixin(const index_mixin &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    index_mixin(index_mixin &&other) noexcept
+        : underlying_type{std::move(other)},
+          lookup{std::move(other.lookup)} {
+        // moved-from maps have no buckets, clearing them makes them usable again
+        other.lookup.clear();
+    }
+    // NOLINTEND(bugprone-use-after-move)
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    index_mixin(index_mixin &&other, const allocator_type &allocator)
+        : underlying_type{std::move(other), allocator},
+          lookup{std::move(other.lookup), allocator} {
+        // moved-from maps have no buckets, clearing them makes them usable again
+        other.lookup.clear();
+    }
+    // NOLINTEND(bugprone-use-after-move)
+
+    /*! @brief Default destructor. */
+    ~index_mixin() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This mixin.
+     */
+    index_mixin &operator=(const index_mixin &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This mixin.
+     */
+    index_mixin &operator=(index_mixin &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(index_mixin &other) noexcept {
+        using std::swap;
+        swap(lookup, other.lookup);
+        underlying_type::swap(other);
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param entt A valid identifier.
+     * @param args Parameters to forward to the underlying storage.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        underlying_type::emplace(entt, std::forward<Args>(args)...);
+        index_element(entt);
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        drop_element(entt);
+        underlying_type::patch(entt, std::forward<Func>(func)...);
+        index_element(entt);
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to forward to the underlying storage.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = underlying_type::size();
+        underlying_type::insert(first, last, std::forward<Args>(args)...);
+
+        // fine as long as insert passes force_back true to try_emplace
+        for(auto pos = from, to = underlying_type::size(); pos != to; ++pos) {
+            index_element(underlying_type::operator[](pos));
+        }
+    }
+
+    /**
+     * @brief Returns the entity that owns the element with the given key.
+     * @param key The key to look for.
+     * @return The entity that owns the element with the given key, if any, the
+     * null entity otherwise.
+     */
+    [[nodiscard]] entity_type find_by(const index_key_type &key) const {
+        const auto it = lookup.find(key);
+        return (it == lookup.cend()) ? entity_type{null} : it->second;
+    }
+
+    /**
+     * @brief Checks if the index contains a given key.
+     * @param key The key to look for.
+     * @return True if the index contains the given key, false otherwise.
+     */
+    [[nodiscard]] bool contains_key(const index_key_type &key) const {
+        return lookup.contains(key);
+    }
+
+private:
+    container_type lookup;
+};
+
+/**
+ * @brief Mixin type used to add a spatial index to storage types.
+ *
+ * Entities are bucketed in a uniform grid according to the position returned
+ * by a pair of projections of their elements. The grid is kept up to date
+ * when elements are created, patched, replaced or destroyed through the
+ * storage (or the registry), so that region queries only visit the cells that
+ * intersect the region itself.
+ *
+ * @warning
+ * Elements updated without passing through `patch` or `replace` (for example,
+ * when modified directly via `get`) leave the index in an inconsistent state.
+ *
+ * @tparam Type Underlying storage type.
+ * @tparam X Data member or member function used to extract the x coordinate.
+ * @tparam Y Data member or member function used to extract the y coordinate.
+ */
+template<typename Type, auto X, auto Y>
+class spatial_mixin: public Type {
+    using underlying_type = Type;
+    using underlying_iterator = typename underlying_type::base_type::basic_iterator;
+
+    static_assert(!std::is_void_v<typename underlying_type::value_type>, "Invalid value type");
+
+    using coord_type = std::remove_const_t<std::remove_reference_t<std::invoke_result_t<decltype(X), const typename underlying_type::value_type &>>>;
+    using alloc_traits = std::allocator_traits<typename underlying_type::allocator_type>;
+    using bucket_type = std::vector<typename underlying_type::entity_type, typename alloc_traits::template rebind_alloc<typename underlying_type::entity_type>>;
+    using container_type = dense_map<std::uint64_t, bucket_type, std::hash<std::uint64_t>, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const std::uint64_t, bucket_type>>>;
+
+    static_assert(std::is_arithmetic_v<coord_type>, "Invalid coordinate type");
+    static_assert(std::is_same_v<coord_type, std::remove_const_t<std::remove_reference_t<std::invoke_result_t<decltype(Y), const typename underlying_type::value_type &>>>>, "Mismatched coordinate types");
+
+    [[nodiscard]] std::int64_t cell_of(const coord_type value) const noexcept {
+        return static_cast<std::int64_t>(std::floor(static_cast<double>(value) / static_cast<double>(extent)));
+    }
+
+    [[nodiscard]] static std::uint64_t key_of(const std::int64_t cx, const std::int64_t cy) noexcept {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cx)) << 32u) | static_cast<std::uint32_t>(cy);
+    }
+
+    [[nodiscard]] std::uint64_t key_of(const typename underlying_type::value_type &elem) const noexcept {
+        return key_of(cell_of(std::invoke(X, elem)), cell_of(std::invoke(Y, elem)));
+    }
+
+    [[nodiscard]] static std::uint64_t spread(const std::uint64_t value) noexcept {
+        auto bits = value & 0xFFFFFFFFu;
+        bits = (bits | (bits << 16u)) & 0x0000FFFF0000FFFFu;
+        bits = (bits | (bits << 8u)) & 0x00FF00FF00FF00FFu;
+        bits = (bits | (bits << 4u)) & 0x0F0F0F0F0F0F0F0Fu;
+        bits = (bits | (bits << 2u)) & 0x3333333333333333u;
+        return (bits | (bits << 1u)) & 0x5555555555555555u;
+    }
+
+    [[nodiscard]] static std::uint64_t hilbert(std::uint32_t cx, std::uint32_t cy) noexcept {
+        std::uint64_t code{};
+
+        for(std::uint32_t bit = 1u << 31u; bit != 0u; bit >>= 1u) {
+            const std::uint32_t rx = (cx & bit) != 0u;
+            const std::uint32_t ry = (cy & bit) != 0u;
+            code += std::uint64_t{bit} * bit * ((3u * rx) ^ ry);
+
+            if(ry == 0u) {
+                if(rx == 1u) {
+                    cx = ~cx;
+                    cy = ~cy;
+                }
+
+                std::swap(cx, cy);
+            }
+        }
+
+        return code;
+    }
+
+    [[nodiscard]] std::uint64_t code_of(const typename underlying_type::value_type &elem, const space_filling_curve curve) const noexcept {
+        // biased so that negative cells come first along both axes
+        const auto cx = static_cast<std::uint32_t>(cell_of(std::invoke(X, elem))) ^ 0x80000000u;
+        const auto cy = static_cast<std::uint32_t>(cell_of(std::invoke(Y, elem))) ^ 0x80000000u;
+        return (curve == space_filling_curve::morton) ? (spread(cx) | (spread(cy) << 1u)) : hilbert(cx, cy);
+    }
+
+    void index_element(const typename underlying_type::entity_type entt) {
+        ++changed;
+        auto &bucket = grid.try_emplace(key_of(underlying_type::get(entt)), underlying_type::get_allocator()).first->second;
+        bucket.push_back(entt);
+    }
+
+    void drop_element(const std::uint64_t key, const typename underlying_type::entity_type entt) {
+        if(const auto it = grid.find(key); it != grid.end()) {
+            auto &bucket = it->second;
+
+            if(auto elem = std::find(bucket.begin(), bucket.end(), entt); elem != bucket.end()) {
+                *elem = bucket.back();
+                bucket.pop_back();
+            }
+
+            if(bucket.empty()) {
+                grid.erase(it);
+            }
+        }
+    }
+
+    template<typename Func>
+    void visit(const bucket_type &bucket, const std::array<coord_type, 2u> &lhs, const std::array<coord_type, 2u> &rhs, Func &func) const {
+        for(auto entt: bucket) {
+            const auto &elem = underlying_type::get(entt);
+
+            if(const coord_type x = std::invoke(X, elem), y = std::invoke(Y, elem); !(x < lhs[0u]) && !(rhs[0u] < x) && !(y < lhs[1u]) && !(rhs[1u] < y)) {
+                func(entt);
+            }
+        }
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        for(auto it = first; it != last; ++it) {
+            drop_element(key_of(underlying_type::get(*it)), *it);
+            ++changed;
+        }
+
+        underlying_type::pop(first, last);
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        grid.clear();
+        underlying_type::pop_all();
+    }
+
+    /**
+     * @brief Copies entities, elements and the spatial grid from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from(const typename underlying_type::base_type &other) override {
+        const auto &from = static_cast<const spatial_mixin &>(other);
+        underlying_type::copy_from(other);
+        grid = from.grid;
+        extent = from.extent;
+        changed = from.changed;
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param force_back Force back insertion.
+     * @param value Optional opaque value.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace(const typename underlying_type::entity_type entt, const bool force_back, const void *value) override {
+        const auto it = underlying_type::try_emplace(entt, force_back, value);
+
+        if(it != underlying_type::base_type::end()) {
+            index_element(*it);
+        }
+
+        return it;
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = typename underlying_type::allocator_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename underlying_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename underlying_type::size_type;
+    /*! @brief Type of coordinates used by the index. */
+    using coordinate_type = coord_type;
+
+    /*! @brief Default constructor. */
+    spatial_mixin()
+        : spatial_mixin{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit spatial_mixin(const allocator_type &allocator)
+        : underlying_type{allocator},
+          grid{allocator},
+          extent{1},
+          changed{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    spatial_mixin(const spatial_mixin &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    spatial_mixin(spatial_mixin &&other) noexcept
+        : underlying_type{std::move(other)},
+          grid{std::move(other.grid)},
+          extent{other.extent},
+          changed{std::exchange(other.changed, size_type{})} {
+        // moved-from maps have no buckets, clearing them makes them usable again
+        other.grid.clear();
+    }
+    // NOLINTEND(bugprone-use-after-move)
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    spatial_mixin(spatial_mixin &&other, const allocator_type &allocator)
+        : underlying_type{std::move(other), allocator},
+          grid{std::move(other.grid), allocator},
+          extent{other.extent},
+          changed{std::exchange(other.changed, size_type{})} {
+        // moved-from maps have no buckets, clearing them makes them usable again
+        other.grid.clear();
+    }
+    // NOLINTEND(bugprone-use-after-move)
+
+    /*! @brief Default destructor. */
+    ~spatial_mixin() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This mixin.
+     */
+    spatial_mixin &operator=(const spatial_mixin &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This mixin.
+     */
+    spatial_mixin &operator=(spatial_mixin &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(spatial_mixin &other) noexcept {
+        using std::swap;
+        swap(grid, other.grid);
+        swap(extent, other.extent);
+        swap(changed, other.changed);
+        underlying_type::swap(other);
+    }
+
+    /**
+     * @brief Returns the size of the cells of the grid.
+     * @return The size of the cells of the grid.
+     */
+    [[nodiscard]] coordinate_type cell_size() const noexcept {
+        return extent;
+    }
+
+    /**
+     * @brief Sets the size of the cells of the grid and rebuilds the index.
+     *
+     * The size of the cells should be in the order of magnitude of the regions
+     * usually queried. Smaller cells waste time visiting empty buckets, larger
+     * cells waste time discarding entities outside of the region.
+     *
+     * @param value The size of the cells of the grid.
+     */
+    void cell_size(const coordinate_type value) {
+        ENTT_ASSERT(value > coordinate_type{}, "Invalid cell size");
+        extent = value;
+        grid.clear();
+
+        for(auto entt: static_cast<const typename underlying_type::base_type &>(*this)) {
+            if(entt != tombstone) {
+                index_element(entt);
+            }
+        }
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param entt A valid identifier.
+     * @param args Parameters to forward to the underlying storage.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        underlying_type::emplace(entt, std::forward<Args>(args)...);
+        index_element(entt);
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        const auto from = key_of(underlying_type::get(entt));
+
+        if(const auto to = key_of(underlying_type::patch(entt, std::forward<Func>(func)...)); from != to) {
+            drop_element(from, entt);
+            index_element(entt);
+        }
+
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to forward to the underlying storage.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = underlying_type::size();
+        underlying_type::insert(first, last, std::forward<Args>(args)...);
+
+        // fine as long as insert passes force_back true to try_emplace
+        for(auto pos = from, to = underlying_type::size(); pos != to; ++pos) {
+            index_element(underlying_type::operator[](pos));
+        }
+    }
+
+    /**
+     * @brief Iterates the entities whose position lies within a given region.
+     *
+     * Regions are axis-aligned boxes, bounds included. The function object is
+     * invoked for each entity in the region, with the entity as its only
+     * argument. Only the cells of the grid that intersect the region are
+     * visited.
+     *
+     * @warning
+     * The storage shouldn't be modified while it's being queried.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param lhs The lower corner of the region.
+     * @param rhs The upper corner of the region.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void within(const std::array<coordinate_type, 2u> &lhs, const std::array<coordinate_type, 2u> &rhs, Func func) const {
+        const std::array from{cell_of(lhs[0u]), cell_of(lhs[1u])};
+        const std::array to{cell_of(rhs[0u]), cell_of(rhs[1u])};
+
+        if(from[0u] > to[0u] || from[1u] > to[1u]) {
+            return;
+        }
+
+        // large regions are cheaper to resolve by visiting all non-empty cells
+        if(const auto cells = static_cast<double>(to[0u] - from[0u] + 1) * static_cast<double>(to[1u] - from[1u] + 1); cells > static_cast<double>(grid.size())) {
+            for(auto &&elem: grid) {
+                visit(elem.second, lhs, rhs, func);
+            }
+        } else {
+            for(auto cx = from[0u]; cx <= to[0u]; ++cx) {
+                for(auto cy = from[1u]; cy <= to[1u]; ++cy) {
+                    if(const auto it = grid.find(key_of(cx, cy)); it != grid.cend()) {
+                        visit(it->second, lhs, rhs, func);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of changes since the last sort along a curve.
+     *
+     * Entities that are created, destroyed or that cross the border of a cell
+     * count as changes.
+     *
+     * @return The number of changes since the last sort along a curve.
+     */
+    [[nodiscard]] size_type pending() const noexcept {
+        return changed;
+    }
+
+    /**
+     * @brief Sorts a storage along a space filling curve.
+     *
+     * Entities are ordered by the position on the curve of the cell in which
+     * they lie, so that neighbors in space end up close to each other in
+     * memory. Codes are computed once per entity and sorted with a radix sort.
+     * The order of the entities within a cell is unspecified.<br/>
+     * Entities that didn't change cell since the last sort are already in
+     * order. Therefore, the storage is sorted only if the number of changes
+     * reaches the given count.
+     *
+     * @param curve The space filling curve to use.
+     * @param count Minimum number of changes required to sort the storage.
+     * @return True if the storage was sorted, false otherwise.
+     */
+    bool sort_along(const space_filling_curve curve, const size_type count = 0u) {
+        if(changed < count) {
+            return false;
+        }
+
+        const auto &base = static_cast<const typename underlying_type::base_type &>(*this);
+        std::vector<std::uint64_t, typename alloc_traits::template rebind_alloc<std::uint64_t>> codes(base.size(), underlying_type::get_allocator());
+        std::vector<entity_type, typename alloc_traits::template rebind_alloc<entity_type>> aux(underlying_type::get_allocator());
+
+        for(size_type pos{}, last = base.size(); pos < last; ++pos) {
+            if(const auto entt = base.data()[pos]; entt != tombstone) {
+                codes[pos] = code_of(underlying_type::get(entt), curve);
+            }
+        }
+
+        // the sparse array isn't updated until the sort function returns
+        underlying_type::base_type::sort([&codes, &base](const entity_type entt) { return codes[base.index(entt)]; }, radix_sort<8u, 64u>{}, aux);
+        changed = 0u;
+        return true;
+    }
+
+private:
+    container_type grid;
+    coordinate_type extent;
+    size_type changed;
+};
+
+/**
+ * @brief Mixin type used to keep storage types in hierarchical order.
+ *
+ * The elements refer to their parents by means of a data member or a member
+ * function that returns an entity. The packed array is arranged so that
+ * parents always come before their children, which makes it possible to
+ * propagate data down a hierarchy (such as transforms) with a single forward
+ * pass over the packed array.<br/>
+ * The order is checked incrementally when elements are created, patched,
+ * replaced or destroyed through the storage (or the registry). Only changes
+ * that actually break it trigger a full reordering, the next time the storage
+ * is traversed.
+ *
+ * @warning
+ * Elements updated without passing through `patch` or `replace` (for example,
+ * when modified directly via `get`) or storage classes sorted explicitly leave
+ * the order in an inconsistent state. Cycles result in undefined behavior.
+ *
+ * @tparam Type Underlying storage type.
+ * @tparam Member Data member or member function used to extract the parent.
+ */
+template<typename Type, auto Member>
+class hierarchy_mixin: public Type {
+    using underlying_type = Type;
+    using underlying_iterator = typename underlying_type::base_type::basic_iterator;
+
+    static_assert(!std::is_void_v<typename underlying_type::value_type>, "Invalid value type");
+    static_assert(std::is_same_v<std::remove_const_t<std::remove_reference_t<std::invoke_result_t<decltype(Member), const typename underlying_type::value_type &>>>, typename underlying_type::entity_type>, "Invalid parent type");
+
+    using alloc_traits = std::allocator_traits<typename underlying_type::allocator_type>;
+    using container_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
+
+    [[nodiscard]] typename underlying_type::entity_type parent_at(const std::size_t pos) const {
+        return std::invoke(Member, underlying_type::get(underlying_type::base_type::operator[](pos)));
+    }
+
+    void check(const std::size_t pos) {
+        if(const auto elem = parent_at(pos); elem != null) {
+            // parents that don't exist yet can still be created later on
+            if(underlying_type::contains(elem)) {
+                dirty = dirty || (underlying_type::index(elem) > pos);
+            } else {
+                dangling = true;
+            }
+        }
+    }
+
+    void created(const std::size_t pos) {
+        // the new entity could be the parent of existing elements
+        dirty = dirty || dangling;
+        check(pos);
+    }
+
+    void reorder() {
+        if constexpr(underlying_type::storage_policy == deletion_policy::in_place) {
+            underlying_type::compact();
+        }
+
+        const auto len = underlying_type::base_type::size();
+        constexpr auto unknown = static_cast<std::size_t>(-1);
+        container_type depth(len, unknown, underlying_type::get_allocator());
+        container_type chain(underlying_type::get_allocator());
+
+        for(std::size_t pos{}; pos < len; ++pos) {
+            // walks up until it finds a root or a known depth, then unwinds
+            for(auto curr = pos; depth[curr] == unknown;) {
+                ENTT_ASSERT(chain.size() < len, "Cycles not allowed");
+                chain.push_back(curr);
+
+                if(const auto elem = parent_at(curr); elem != null && underlying_type::contains(elem)) {
+                    curr = underlying_type::index(elem);
+                } else {
+                    depth[curr] = 0u;
+                    chain.pop_back();
+                }
+            }
+
+            for(; !chain.empty(); chain.pop_back()) {
+                depth[chain.back()] = depth[underlying_type::index(parent_at(chain.back()))] + 1u;
+            }
+        }
+
+        container_type order(len, 0u, underlying_type::get_allocator());
+        std::iota(order.begin(), order.end(), std::size_t{});
+        std::stable_sort(order.begin(), order.end(), [&depth](const auto lhs, const auto rhs) { return depth[lhs] < depth[rhs]; });
+
+        std::vector<entity_type, typename alloc_traits::template rebind_alloc<entity_type>> entities(underlying_type::get_allocator());
+        entities.reserve(len);
+
+        for(auto pos: order) {
+            entities.push_back(underlying_type::base_type::operator[](pos));
+        }
+
+        // the iteration order of a storage is the reverse of its packed array
+        underlying_type::sort_as(entities.rbegin(), entities.rend());
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        // erased entities could be the parents of other elements
+        dangling = dangling || (first != last);
+
+        if constexpr(underlying_type::storage_policy == deletion_policy::in_place) {
+            underlying_type::pop(first, last);
+        } else {
+            for(; first != last; ++first) {
+                // the last entity of the packed array fills the hole, if any
+                const auto entt = *first;
+                const auto pos = underlying_type::index(entt);
+                const auto it = underlying_type::find(entt);
+                underlying_type::pop(it, it + 1u);
+
+                if(pos < underlying_type::base_type::size()) {
+                    check(pos);
+                }
+            }
+        }
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        dirty = false;
+        dangling = false;
+        underlying_type::pop_all();
+    }
+
+    /**
+     * @brief Copies entities, elements and the order from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from(const typename underlying_type::base_type &other) override {
+        const auto &from = static_cast<const hierarchy_mixin &>(other);
+        underlying_type::copy_from(other);
+        dirty = from.dirty;
+        dangling = from.dangling;
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param force_back Force back insertion.
+     * @param value Optional opaque value.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace(const typename underlying_type::entity_type entt, const bool force_back, const void *value) override {
+        const auto it = underlying_type::try_emplace(entt, force_back, value);
+
+        if(it != underlying_type::base_type::end()) {
+            created(underlying_type::index(*it));
+        }
+
+        return it;
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = typename underlying_type::allocator_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename underlying_type::entity_type;
+
+    /*! @brief Default constructor. */
+    hierarchy_mixin()
+        : hierarchy_mixin{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit hierarchy_mixin(const allocator_type &allocator)
+        : underlying_type{allocator},
+          dirty{},
+          dangling{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    hierarchy_mixin(const hierarchy_mixin &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    hierarchy_mixin(hierarchy_mixin &&other) noexcept
+        : underlying_type{std::move(other)},
+          dirty{std::exchange(other.dirty, false)},
+          dangling{std::exchange(other.dangling, false)} {}
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    hierarchy_mixin(hierarchy_mixin &&other, const allocator_type &allocator)
+        : underlying_type{std::move(other), allocator},
+          dirty{std::exchange(other.dirty, false)},
+          dangling{std::exchange(other.dangling, false)} {}
+
+    /*! @brief Default destructor. */
+    ~hierarchy_mixin() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This mixin.
+     */
+    hierarchy_mixin &operator=(const hierarchy_mixin &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This mixin.
+     */
+    hierarchy_mixin &operator=(hierarchy_mixin &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(hierarchy_mixin &other) noexcept {
+        using std::swap;
+        swap(dirty, other.dirty);
+        swap(dangling, other.dangling);
+        underlying_type::swap(other);
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param entt A valid identifier.
+     * @param args Parameters to forward to the underlying storage.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        underlying_type::emplace(entt, std::forward<Args>(args)...);
+        created(underlying_type::index(entt));
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        underlying_type::patch(entt, std::forward<Func>(func)...);
+        // children always follow the entity, only its parent can be misplaced
+        check(underlying_type::index(entt));
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to forward to the underlying storage.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = underlying_type::size();
+        underlying_type::insert(first, last, std::forward<Args>(args)...);
+
+        // fine as long as insert passes force_back true to try_emplace
+        for(auto pos = from, to = underlying_type::size(); pos != to; ++pos) {
+            created(pos);
+        }
+    }
+
+    /**
+     * @brief Checks if parents are known to precede their children in the
+     * packed array.
+     * @return True if the storage is in hierarchical order, false if it may not
+     * be.
+     */
+    [[nodiscard]] bool ordered() const noexcept {
+        return !dirty;
+    }
+
+    /**
+     * @brief Arranges the packed array in hierarchical order, if needed.
+     *
+     * Entities are ordered by depth. Entities whose parent isn't part of the
+     * storage are roots. The relative order of the entities with the same
+     * depth is preserved.
+     */
+    void refresh() {
+        if(dirty) {
+            bool sorted = true;
+            dangling = false;
+
+            // the order is often still valid, a linear check avoids sorting
+            for(std::size_t pos{}, len = underlying_type::base_type::size(); pos < len; ++pos) {
+                if(underlying_type::base_type::operator[](pos) != tombstone) {
+                    if(const auto elem = parent_at(pos); elem != null) {
+                        if(!underlying_type::contains(elem)) {
+                            dangling = true;
+                        } else if(underlying_type::index(elem) > pos) {
+                            sorted = false;
+                        }
+                    }
+                }
+            }
+
+            if(!sorted) {
+                reorder();
+            }
+
+            dirty = false;
+        }
+    }
+
+    /**
+     * @brief Iterates the elements of a storage in hierarchical order.
+     *
+     * The storage is arranged in hierarchical order first, if needed. The
+     * function object is then invoked for each element, parents before their
+     * children, with the entity and the element as arguments.
+     *
+     * @warning
+     * The storage shouldn't be modified while it's being traversed.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void traverse(Func func) {
+        refresh();
+
+        for(std::size_t pos{}, len = underlying_type::base_type::size(); pos < len; ++pos) {
+            const auto entt = underlying_type::base_type::operator[](pos);
+            func(entt, underlying_type::get(entt));
+        }
+    }
+
+private:
+    bool dirty;
+    bool dangling;
+};
+
+/**
+ * @brief Mixin type used to keep storage types sorted incrementally.
+ *
+ * The mixin tracks the entities whose elements are created or patched, as well
+ * as those moved around when other entities are removed. Sorting a storage
+ * then only sorts these entities and merges them with the others, which are
+ * already in order.<br/>
+ * This is meant for storage classes sorted over and over with the same
+ * comparison function, where only a few elements change between two sorts.
+ *
+ * @warning
+ * The same comparison function must be used for all sorts. Elements updated
+ * without passing through `patch` or `replace` (for example, when modified
+ * directly via `get`) aren't tracked and can break the order.
+ *
+ * @tparam Type Underlying storage type.
+ */
+template<typename Type>
+class sorted_mixin: public Type {
+    using underlying_type = Type;
+    using underlying_iterator = typename underlying_type::base_type::basic_iterator;
+
+    using alloc_traits = std::allocator_traits<typename underlying_type::allocator_type>;
+    using container_type = basic_sparse_set<typename underlying_type::entity_type, typename alloc_traits::template rebind_alloc<typename underlying_type::entity_type>>;
+
+    void track(const typename underlying_type::entity_type entt) {
+        if(!dirty.contains(entt)) {
+            dirty.push(entt);
+        }
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        if constexpr(underlying_type::storage_policy == deletion_policy::in_place) {
+            for(auto it = first; it != last; ++it) {
+                dirty.remove(*it);
+            }
+
+            underlying_type::pop(first, last);
+        } else {
+            for(; first != last; ++first) {
+                // the last entity of the packed array fills the hole, if any
+                const auto entt = *first;
+                const auto back = underlying_type::base_type::operator[](underlying_type::base_type::size() - 1u);
+                const auto it = underlying_type::find(entt);
+                underlying_type::pop(it, it + 1u);
+                dirty.remove(entt);
+
+                if(back != entt) {
+                    track(back);
+                }
+            }
+        }
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        dirty.clear();
+        underlying_type::pop_all();
+    }
+
+    /**
+     * @brief Copies entities, elements and the pending changes from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from(const typename underlying_type::base_type &other) override {
+        const auto &from = static_cast<const sorted_mixin &>(other);
+        underlying_type::copy_from(other);
+        dirty.deep_copy_from(from.dirty);
+        sorted = from.sorted;
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param force_back Force back insertion.
+     * @param value Optional opaque value.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace(const typename underlying_type::entity_type entt, const bool force_back, const void *value) override {
+        const auto it = underlying_type::try_emplace(entt, force_back, value);
+
+        if(it != underlying_type::base_type::end()) {
+            track(*it);
+        }
+
+        return it;
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = typename underlying_type::allocator_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename underlying_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename underlying_type::size_type;
+
+    /*! @brief Default constructor. */
+    sorted_mixin()
+        : sorted_mixin{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit sorted_mixin(const allocator_type &allocator)
+        : underlying_type{allocator},
+          dirty{allocator},
+          sorted{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    sorted_mixin(const sorted_mixin &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    sorted_mixin(sorted_mixin &&other) noexcept
+        : underlying_type{std::move(other)},
+          dirty{std::move(other.dirty)},
+          sorted{std::exchange(other.sorted, false)} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    sorted_mixin(sorted_mixin &&other, const allocator_type &allocator)
+        : underlying_type{std::move(other), allocator},
+          dirty{std::move(other.dirty), allocator},
+          sorted{std::exchange(other.sorted, false)} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /*! @brief Default destructor. */
+    ~sorted_mixin() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This mixin.
+     */
+    sorted_mixin &operator=(const sorted_mixin &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This mixin.
+     */
+    sorted_mixin &operator=(sorted_mixin &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(sorted_mixin &other) noexcept {
+        using std::swap;
+        swap(dirty, other.dirty);
+        swap(sorted, other.sorted);
+        underlying_type::swap(other);
+    }
+
+    /**
+     * @brief Returns the number of entities that are out of order.
+     * @return The number of entities that are out of order.
+     */
+    [[nodiscard]] size_type pending() const noexcept {
+        return dirty.size();
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param entt A valid identifier.
+     * @param args Parameters to forward to the underlying storage.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        underlying_type::emplace(entt, std::forward<Args>(args)...);
+        track(entt);
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        underlying_type::patch(entt, std::forward<Func>(func)...);
+        track(entt);
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to forward to the underlying storage.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = underlying_type::size();
+        underlying_type::insert(first, last, std::forward<Args>(args)...);
+
+        // fine as long as insert passes force_back true to try_emplace
+        for(auto pos = from, to = underlying_type::size(); pos != to; ++pos) {
+            track(underlying_type::operator[](pos));
+        }
+    }
+
+    /**
+     * @brief Sort all elements according to the given comparison function.
+     *
+     * The first sort is a full sort. Later sorts only order the entities
+     * changed in the meantime (using the given sort function object) and merge
+     * them with the others, that are still in order.
+     *
+     * @sa basic_sparse_set::sort
+     *
+     * @tparam Compare Type of comparison function object.
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param compare A valid comparison function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Compare, typename Sort = std_sort, typename... Args>
+    void sort(Compare compare, Sort algo = Sort{}, Args &&...args) {
+        if(!sorted) {
+            underlying_type::sort(std::move(compare), std::move(algo), std::forward<Args>(args)...);
+        } else if(!dirty.empty()) {
+            underlying_type::sort(std::move(compare), [this, &algo, &args...](auto first, auto last, auto comp) {
+                const auto mid = std::stable_partition(first, last, [this](const auto entt) { return !dirty.contains(entt); });
+                algo(mid, last, comp, std::forward<Args>(args)...);
+                std::inplace_merge(first, mid, last, std::move(comp));
+            });
+        }
+
+        dirty.clear();
+        sorted = true;
+    }
+
+    /**
+     * @brief Sort entities according to their order in a range.
+     *
+     * The next sort is a full sort.
+     *
+     * @sa basic_sparse_set::sort_as
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @return An iterator past the last of the elements actually shared.
+     */
+    template<typename It>
+    auto sort_as(It first, It last) {
+        sorted = false;
+        return underlying_type::sort_as(first, last);
+    }
+
+private:
+    container_type dirty;
+    bool sorted;
+};
+
+
+/**
+ * @brief Mixin type used to keep a storage in the same order as another one.
+ *
+ * A storage that _follows_ another one (the leader) keeps the entities it
+ * shares with the leader in the same order and at the beginning of the
+ * storage, as if it were sorted with `sort_as` against it. Non-owning views
+ * that iterate both storages then get a locality close to that of groups,
+ * without their constraints.<br/>
+ * Aligning a storage is incremental. The entities still in order stay where
+ * they are, while those added, moved by a removal or reordered within the
+ * leader in the meantime are sorted and merged with the others. This is meant
+ * to replace a call to `sort_as` on every frame.
+ *
+ * @warning
+ * The leader must outlive the storage that follows it, unless the latter
+ * stops following it first.
+ *
+ * @tparam Type Underlying storage type.
+ */
+template<typename Type>
+class follow_mixin: public Type {
+    using underlying_type = Type;
+
+    using alloc_traits = std::allocator_traits<typename underlying_type::allocator_type>;
+    using container_type = basic_sparse_set<typename underlying_type::entity_type, typename alloc_traits::template rebind_alloc<typename underlying_type::entity_type>>;
+
+    [[nodiscard]] typename underlying_type::size_type rank(const typename underlying_type::entity_type entt) const noexcept {
+        // shared entities come first in iteration order, as they do in the leader
+        return target->contains(entt) ? (target->index(entt) + 1u) : 0u;
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = typename underlying_type::allocator_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename underlying_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename underlying_type::size_type;
+
+    /*! @brief Default constructor. */
+    follow_mixin()
+        : follow_mixin{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit follow_mixin(const allocator_type &allocator)
+        : underlying_type{allocator},
+          dirty{allocator},
+          target{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    follow_mixin(const follow_mixin &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    follow_mixin(follow_mixin &&other) noexcept
+        : underlying_type{std::move(other)},
+          dirty{std::move(other.dirty)},
+          target{std::exchange(other.target, nullptr)} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    follow_mixin(follow_mixin &&other, const allocator_type &allocator)
+        : underlying_type{std::move(other), allocator},
+          dirty{std::move(other.dirty), allocator},
+          target{std::exchange(other.target, nullptr)} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /*! @brief Default destructor. */
+    ~follow_mixin() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This mixin.
+     */
+    follow_mixin &operator=(const follow_mixin &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This mixin.
+     */
+    follow_mixin &operator=(follow_mixin &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(follow_mixin &other) noexcept {
+        using std::swap;
+        swap(dirty, other.dirty);
+        swap(target, other.target);
+        underlying_type::swap(other);
+    }
+
+    /**
+     * @brief Makes a storage follow another one and aligns it.
+     * @param leader The storage to follow.
+     */
+    void follow(const typename underlying_type::base_type &leader) {
+        ENTT_ASSERT(&leader != this, "A storage cannot follow itself");
+        target = &leader;
+        align();
+    }
+
+    /*! @brief Stops following the leader, if any. */
+    void unfollow() noexcept {
+        target = nullptr;
+    }
+
+    /**
+     * @brief Returns the storage followed, if any.
+     * @return The storage followed, if any, a null pointer otherwise.
+     */
+    [[nodiscard]] const typename underlying_type::base_type *leader() const noexcept {
+        return target;
+    }
+
+    /**
+     * @brief Restores the order imposed by the leader, if any.
+     *
+     * Entities are visited once and compared with their neighbors. Those that
+     * are out of order are sorted (using the given sort function object) and
+     * merged with the others. Nothing is moved when the storage is already
+     * aligned.
+     *
+     * @sa basic_sparse_set::sort_as
+     *
+     * @tparam Sort Type of sort function object.
+     * @tparam Args Types of arguments to forward to the sort function object.
+     * @param algo A valid sort function object.
+     * @param args Arguments to forward to the sort function object, if any.
+     */
+    template<typename Sort = std_sort, typename... Args>
+    void align(Sort algo = Sort{}, Args &&...args) {
+        if(target == nullptr) {
+            return;
+        }
+
+        const size_type len = (underlying_type::policy() == deletion_policy::swap_only) ? underlying_type::free_list() : underlying_type::base_type::size();
+        const auto last = underlying_type::base_type::end();
+        auto it = last - static_cast<typename underlying_type::difference_type>(len);
+
+        // keeps a non-increasing run of ranks, everything else is out of order
+        for(auto prev = ~size_type{}, curr = (it == last) ? size_type{} : rank(*it); it != last; ++it) {
+            const auto next = ((it + 1) == last) ? size_type{} : rank(*(it + 1));
+
+            if(curr <= prev && curr >= next) {
+                prev = curr;
+            } else {
+                dirty.push(*it);
+            }
+
+            curr = next;
+        }
+
+        if(!dirty.empty()) {
+            const auto compare = [this](const entity_type lhs, const entity_type rhs) { return rank(lhs) > rank(rhs); };
+
+            underlying_type::base_type::sort(compare, [this, &algo, &args...](auto first, auto end, auto comp) {
+                const auto mid = std::stable_partition(first, end, [this](const auto entt) { return !dirty.contains(entt); });
+                algo(mid, end, comp, std::forward<Args>(args)...);
+                std::inplace_merge(first, mid, end, std::move(comp));
+            });
+
+            dirty.clear();
+        }
+    }
+
+private:
+    container_type dirty;
+    const typename underlying_type::base_type *target;
+};
+
+/**
+ * @brief Mixin type used to track changes to the elements of a storage.
+ *
+ * The mixin keeps a _last changed_ tick for each element, in an array that
+ * follows the packed array of the underlying storage. Elements are stamped with
+ * the current tick when they are created or patched. Finding the elements
+ * changed since a given tick is then a linear scan of the array of ticks.<br/>
+ * This is meant for components that change very often, where recording the
+ * entities on each update would be too expensive.
+ *
+ * @warning
+ * Elements updated without passing through `patch` or `replace` (for example,
+ * when modified directly via `get`) aren't tracked.
+ *
+ * @tparam Type Underlying storage type.
+ */
+template<typename Type>
+class changed_mixin: public Type {
+    using underlying_type = Type;
+    using underlying_iterator = typename underlying_type::base_type::basic_iterator;
+
+    static_assert(component_traits<typename underlying_type::element_type, typename underlying_type::entity_type>::page_size != 0u, "Empty types not supported");
+
+public:
+    /*! @brief Tick type. */
+    using tick_type = std::uint32_t;
+
+private:
+    using alloc_traits = std::allocator_traits<typename underlying_type::allocator_type>;
+    using container_type = std::vector<tick_type, typename alloc_traits::template rebind_alloc<tick_type>>;
+
+    void stamp(const std::size_t pos) {
+        if(!(pos < ticks.size())) {
+            ticks.resize(pos + 1u);
+        }
+
+        ticks[pos] = current;
+    }
+
+protected:
+    /**
+     * @brief Swaps or moves two elements within a storage.
+     * @param from A valid position of an element within a storage.
+     * @param to A valid position of an element within a storage.
+     */
+    void swap_or_move(const std::size_t from, const std::size_t to) override {
+        underlying_type::swap_or_move(from, to);
+        std::swap(ticks[from], ticks[to]);
+    }
+
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        if constexpr(underlying_type::storage_policy == deletion_policy::in_place) {
+            underlying_type::pop(first, last);
+        } else {
+            for(; first != last; ++first) {
+                // the last element of the packed array fills the hole, if any
+                const auto it = underlying_type::find(*first);
+                const auto pos = static_cast<std::size_t>(it.index());
+                underlying_type::pop(it, it + 1u);
+                ticks[pos] = ticks[underlying_type::size()];
+            }
+        }
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        ticks.clear();
+        underlying_type::pop_all();
+    }
+
+    /**
+     * @brief Copies entities, elements and the change ticks from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from(const typename underlying_type::base_type &other) override {
+        const auto &from = static_cast<const changed_mixin &>(other);
+        underlying_type::copy_from(other);
+        ticks = from.ticks;
+        current = from.current;
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param force_back Force back insertion.
+     * @param value Optional opaque value.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace(const typename underlying_type::entity_type entt, const bool force_back, const void *value) override {
+        const auto it = underlying_type::try_emplace(entt, force_back, value);
+
+        if(it != underlying_type::base_type::end()) {
+            stamp(static_cast<std::size_t>(it.index()));
+        }
+
+        return it;
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = typename underlying_type::allocator_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename underlying_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename underlying_type::size_type;
+
+    /*! @brief Default constructor. */
+    changed_mixin()
+        : changed_mixin{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit changed_mixin(const allocator_type &allocator)
+        : underlying_type{allocator},
+          ticks{allocator},
+          current{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    changed_mixin(const changed_mixin &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    changed_mixin(changed_mixin &&other) noexcept
+        : underlying_type{std::move(other)},
+          ticks{std::move(other.ticks)},
+          current{std::exchange(other.current, tick_type{})} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    changed_mixin(changed_mixin &&other, const allocator_type &allocator)
+        : underlying_type{std::move(other), allocator},
+          ticks{std::move(other.ticks), allocator},
+          current{std::exchange(other.current, tick_type{})} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /*! @brief Default destructor. */
+    ~changed_mixin() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This mixin.
+     */
+    changed_mixin &operator=(const changed_mixin &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This mixin.
+     */
+    changed_mixin &operator=(changed_mixin &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(changed_mixin &other) noexcept {
+        using std::swap;
+        swap(ticks, other.ticks);
+        swap(current, other.current);
+        underlying_type::swap(other);
+    }
+
+    /**
+     * @brief Returns the current tick of a storage.
+     * @return The current tick of the storage.
+     */
+    [[nodiscard]] tick_type tick() const noexcept {
+        return current;
+    }
+
+    /**
+     * @brief Moves a storage to the next tick.
+     * @return The new tick of the storage.
+     */
+    tick_type advance() noexcept {
+        return ++current;
+    }
+
+    /**
+     * @brief Returns the tick at which an element was last changed.
+     * @param entt A valid identifier.
+     * @return The tick at which the element was last changed.
+     */
+    [[nodiscard]] tick_type changed(const entity_type entt) const {
+        return ticks[underlying_type::index(entt)];
+    }
+
+    /**
+     * @brief Visits the entities whose elements were changed at or after the
+     * given tick.
+     *
+     * The function object is invoked for each entity. It is provided with the
+     * entity itself and the signature of the function should be equivalent to
+     * the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param value The tick from which to look for changes.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void changed_since(const tick_type value, Func func) const {
+        const auto *data = underlying_type::base_type::data();
+
+        for(size_type pos{}, last = underlying_type::size(); pos < last; ++pos) {
+            if(!(ticks[pos] < value)) {
+                if constexpr(underlying_type::storage_policy == deletion_policy::in_place) {
+                    if(data[pos] == tombstone) {
+                        continue;
+                    }
+                }
+
+                func(data[pos]);
+            }
+        }
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param entt A valid identifier.
+     * @param args Parameters to forward to the underlying storage.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        underlying_type::emplace(entt, std::forward<Args>(args)...);
+        stamp(underlying_type::index(entt));
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        underlying_type::patch(entt, std::forward<Func>(func)...);
+        stamp(underlying_type::index(entt));
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to forward to the underlying storage.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = underlying_type::size();
+        underlying_type::insert(first, last, std::forward<Args>(args)...);
+
+        // fine as long as insert passes force_back true to try_emplace
+        for(auto pos = from, to = underlying_type::size(); pos != to; ++pos) {
+            stamp(pos);
+        }
+    }
+
+private:
+    container_type ticks;
+    tick_type current;
+};
+
+/**
+ * @brief Mixin type used to track the pages of a storage changed since the last
+ * time they were cleaned.
+ *
+ * The mixin keeps a flag for each page of the underlying storage, as well as
+ * the list of pages currently marked as dirty. Pages are marked when elements
+ * are created, patched, replaced, moved around or destroyed.<br/>
+ * This is meant for storage classes that are mirrored elsewhere (for example,
+ * in GPU buffers), so that only the pages that changed are uploaded, straight
+ * from the memory of the storage.
+ *
+ * @warning
+ * Elements updated without passing through `patch` or `replace` (for example,
+ * when modified directly via `get`) aren't tracked.
+ *
+ * @tparam Type Underlying storage type.
+ */
+template<typename Type>
+class dirty_mixin: public Type {
+    using underlying_type = Type;
+    using underlying_iterator = typename underlying_type::base_type::basic_iterator;
+    using traits_type = component_traits<typename underlying_type::element_type, typename underlying_type::entity_type>;
+    using alloc_traits = std::allocator_traits<typename underlying_type::allocator_type>;
+    using flag_container_type = std::vector<bool, typename alloc_traits::template rebind_alloc<bool>>;
+    using page_container_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
+
+    static_assert(traits_type::page_size != 0u, "Empty types not supported");
+
+    void mark(const std::size_t pos) {
+        const auto page = pos / traits_type::page_size;
+
+        if(!(page < flags.size())) {
+            flags.resize(page + 1u);
+        }
+
+        if(!flags[page]) {
+            flags[page] = true;
+            pages.push_back(page);
+        }
+    }
+
+    void mark(const std::size_t from, const std::size_t to) {
+        for(auto pos = from; pos < to; pos = (pos / traits_type::page_size + 1u) * traits_type::page_size) {
+            mark(pos);
+        }
+    }
+
+protected:
+    /**
+     * @brief Swaps or moves two elements within a storage.
+     * @param from A valid position of an element within a storage.
+     * @param to A valid position of an element within a storage.
+     */
+    void swap_or_move(const std::size_t from, const std::size_t to) override {
+        underlying_type::swap_or_move(from, to);
+        mark(from);
+        mark(to);
+    }
+
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        for(; first != last; ++first) {
+            // either the hole is filled by the last element or it's left as a tombstone
+            const auto it = underlying_type::find(*first);
+            const auto pos = static_cast<std::size_t>(it.index());
+            underlying_type::pop(it, it + 1u);
+            mark(pos);
+        }
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        mark(0u, underlying_type::size());
+        underlying_type::pop_all();
+    }
+
+    /**
+     * @brief Copies entities and elements from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from(const typename underlying_type::base_type &other) override {
+        underlying_type::copy_from(other);
+        mark(0u, underlying_type::size());
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param force_back Force back insertion.
+     * @param value Optional opaque value.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace(const typename underlying_type::entity_type entt, const bool force_back, const void *value) override {
+        const auto it = underlying_type::try_emplace(entt, force_back, value);
+
+        if(it != underlying_type::base_type::end()) {
+            mark(static_cast<std::size_t>(it.index()));
+        }
+
+        return it;
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = typename underlying_type::allocator_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename underlying_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename underlying_type::size_type;
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = typename underlying_type::value_type;
+
+    /*! @brief Default constructor. */
+    dirty_mixin()
+        : dirty_mixin{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit dirty_mixin(const allocator_type &allocator)
+        : underlying_type{allocator},
+          flags{allocator},
+          pages{allocator} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    dirty_mixin(const dirty_mixin &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    dirty_mixin(dirty_mixin &&other) noexcept
+        : underlying_type{std::move(other)},
+          flags{std::move(other.flags)},
+          pages{std::move(other.pages)} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    dirty_mixin(dirty_mixin &&other, const allocator_type &allocator)
+        : underlying_type{std::move(other), allocator},
+          flags{std::move(other.flags), allocator},
+          pages{std::move(other.pages), allocator} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /*! @brief Default destructor. */
+    ~dirty_mixin() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This mixin.
+     */
+    dirty_mixin &operator=(const dirty_mixin &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This mixin.
+     */
+    dirty_mixin &operator=(dirty_mixin &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(dirty_mixin &other) noexcept {
+        using std::swap;
+        swap(flags, other.flags);
+        swap(pages, other.pages);
+        underlying_type::swap(other);
+    }
+
+    /**
+     * @brief Checks whether a page is dirty.
+     * @param page A page index.
+     * @return True if the page is dirty, false otherwise.
+     */
+    [[nodiscard]] bool dirty(const size_type page) const noexcept {
+        return (page < flags.size()) && flags[page];
+    }
+
+    /**
+     * @brief Returns the number of dirty pages.
+     * @return Number of dirty pages.
+     */
+    [[nodiscard]] size_type dirty_count() const noexcept {
+        return pages.size();
+    }
+
+    /**
+     * @brief Visits the dirty pages of a storage.
+     *
+     * The function object is invoked once per dirty page, in the order in which
+     * the pages have been marked. Its signature is equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(size_type, const value_type *, size_type);
+     * @endcode
+     *
+     * The arguments are the index of the page, a pointer to its first element
+     * and the number of elements in use within the page. Pages that are no
+     * longer in use are still returned, with no elements in them.<br/>
+     * Pointers refer to the memory of the storage and are meant to be copied
+     * straight to their destination. Entities are available from the packed
+     * array of the storage at the same positions.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_dirty(Func func) const {
+        const auto *raw = underlying_type::raw();
+        const auto len = underlying_type::size();
+
+        for(const auto page: pages) {
+            const auto from = page * traits_type::page_size;
+            const auto *elem = (from < len) ? static_cast<const value_type *>(to_address(raw[page])) : nullptr;
+            func(page, elem, (from < len) ? (std::min)(static_cast<size_type>(traits_type::page_size), len - from) : size_type{});
+        }
+    }
+
+    /*! @brief Marks all pages as clean. */
+    void clean() noexcept {
+        for(const auto page: pages) {
+            flags[page] = false;
+        }
+
+        pages.clear();
+    }
+
+    /**
+     * @brief Copies some pages of entities and elements from another storage.
+     *
+     * All other pages are expected to be the same in both storages, except for
+     * those past the end of the shortest one that are copied in any case. This
+     * is meant to apply page-granular deltas, such as those collected from the
+     * dirty pages of a storage.<br/>
+     * Copied pages are marked as dirty. No listeners are notified, if any.
+     *
+     * @warning
+     * Only trivially copyable elements are supported and storage classes that
+     * use in-place deletion are excluded.
+     *
+     * @tparam It Type of forward iterator.
+     * @param other The storage to copy the contents from.
+     * @param first An iterator to the first element of the range of pages.
+     * @param last An iterator past the last element of the range of pages.
+     */
+    template<typename It>
+    void copy_pages_from(const dirty_mixin &other, It first, It last) {
+        const auto len = underlying_type::size();
+        underlying_type::copy_pages_from(other, first, last);
+
+        for(; first != last; ++first) {
+            mark(*first * traits_type::page_size);
+        }
+
+        mark((std::min)(len, other.size()), (std::max)(len, other.size()));
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param entt A valid identifier.
+     * @param args Parameters to forward to the underlying storage.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        underlying_type::emplace(entt, std::forward<Args>(args)...);
+        mark(underlying_type::index(entt));
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        underlying_type::patch(entt, std::forward<Func>(func)...);
+        mark(underlying_type::index(entt));
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to forward to the underlying storage.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = underlying_type::size();
+        underlying_type::insert(first, last, std::forward<Args>(args)...);
+        // fine as long as insert passes force_back true to try_emplace
+        mark(from, underlying_type::size());
+    }
+
+private:
+    flag_container_type flags;
+    page_container_type pages;
+};
+
+/**
+ * @brief Mixin type used to keep a checksum of the elements of a storage.
+ *
+ * The checksum combines a hash of each pair of entity and element. It doesn't
+ * depend on the order of the elements and is kept up to date when elements are
+ * created, patched, replaced or destroyed through the storage (or the
+ * registry), so that reading it is a constant time operation.<br/>
+ * Two storages with the same entities and elements have the same checksum,
+ * which makes it suitable for desync checks in lockstep simulations.
+ *
+ * @warning
+ * Elements updated without passing through `patch` or `replace` (for example,
+ * when modified directly via `get`) leave the checksum in an inconsistent
+ * state.<br/>
+ * The hash function must return the same values on all the machines to
+ * compare. For example, `std::hash` isn't guaranteed to do so for all types.
+ *
+ * @tparam Type Underlying storage type.
+ * @tparam Hash Type of function to use to hash the elements.
+ */
+template<typename Type, typename Hash = std::hash<typename Type::value_type>>
+class checksum_mixin: public Type {
+    using underlying_type = Type;
+    using underlying_iterator = typename underlying_type::base_type::basic_iterator;
+
+    static_assert(!std::is_void_v<typename underlying_type::value_type>, "Invalid value type");
+
+    [[nodiscard]] std::uint64_t digest(const typename underlying_type::entity_type entt) const {
+        const auto id = static_cast<std::uint64_t>(entt_traits<typename underlying_type::entity_type>::to_integral(entt));
+        return internal::checksum_mix(static_cast<std::uint64_t>(Hash{}(underlying_type::get(entt))) ^ internal::checksum_mix(id));
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        for(auto it = first; it != last; ++it) {
+            state -= digest(*it);
+        }
+
+        underlying_type::pop(first, last);
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        state = {};
+        underlying_type::pop_all();
+    }
+
+    /**
+     * @brief Copies entities, elements and the checksum from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from(const typename underlying_type::base_type &other) override {
+        const auto &from = static_cast<const checksum_mixin &>(other);
+        underlying_type::copy_from(other);
+        state = from.state;
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param force_back Force back insertion.
+     * @param value Optional opaque value.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace(const typename underlying_type::entity_type entt, const bool force_back, const void *value) override {
+        const auto it = underlying_type::try_emplace(entt, force_back, value);
+
+        if(it != underlying_type::base_type::end()) {
+            state += digest(*it);
+        }
+
+        return it;
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = typename underlying_type::allocator_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename underlying_type::entity_type;
+    /*! @brief Checksum type. */
+    using checksum_type = std::uint64_t;
+
+    /*! @brief Default constructor. */
+    checksum_mixin()
+        : checksum_mixin{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit checksum_mixin(const allocator_type &allocator)
+        : underlying_type{allocator},
+          state{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    checksum_mixin(const checksum_mixin &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    checksum_mixin(checksum_mixin &&other) noexcept
+        : underlying_type{std::move(other)},
+          state{std::exchange(other.state, checksum_type{})} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    checksum_mixin(checksum_mixin &&other, const allocator_type &allocator)
+        : underlying_type{std::move(other), allocator},
+          state{std::exchange(other.state, checksum_type{})} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /*! @brief Default destructor. */
+    ~checksum_mixin() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This mixin.
+     */
+    checksum_mixin &operator=(const checksum_mixin &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This mixin.
+     */
+    checksum_mixin &operator=(checksum_mixin &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(checksum_mixin &other) noexcept {
+        using std::swap;
+        swap(state, other.state);
+        underlying_type::swap(other);
+    }
+
+    /**
+     * @brief Returns the checksum of the elements of a storage.
+     * @return The checksum of the elements of the storage.
+     */
+    [[nodiscard]] checksum_type checksum() const noexcept {
+        return state;
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param entt A valid identifier.
+     * @param args Parameters to forward to the underlying storage.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        underlying_type::emplace(entt, std::forward<Args>(args)...);
+        state += digest(entt);
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        state -= digest(entt);
+        underlying_type::patch(entt, std::forward<Func>(func)...);
+        state += digest(entt);
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to forward to the underlying storage.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = underlying_type::size();
+        underlying_type::insert(first, last, std::forward<Args>(args)...);
+
+        // fine as long as insert passes force_back true to try_emplace
+        for(auto pos = from, to = underlying_type::size(); pos != to; ++pos) {
+            state += digest(underlying_type::operator[](pos));
+        }
+    }
+
+private:
+    checksum_type state;
+};
+
+/**
+ * @brief Mixin type used to count the operations performed on a storage.
+ *
+ * The mixin counts the elements created, destroyed, patched and fetched, the
+ * iterations started directly on the storage (for example, by means of `each`
+ * or range-for loops) and the largest number of entities contained at once.
+ * Counters are available through the `statistics` member function of the
+ * sparse set, also when iterating the storage classes of a registry.<br/>
+ * Elements fetched by views are counted as gets, while iterations of views
+ * aren't counted as iterations of the storage.
+ *
+ * The `ENTT_USE_STATISTICS` macro makes all default storage classes use this
+ * mixin. Otherwise, it has no cost at all.
+ *
+ * @tparam Type Underlying storage type.
+ */
+template<typename Type>
+class statistics_mixin: public Type {
+    using underlying_type = Type;
+    using underlying_iterator = typename underlying_type::base_type::basic_iterator;
+    // const member functions can be invoked concurrently
+    using counter_type = std::atomic<std::size_t>;
+
+    void track() noexcept {
+        peak = (std::max)(peak, underlying_type::base_type::size());
+    }
+
+    void count(counter_type &counter) const noexcept {
+        counter.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        erased += static_cast<std::size_t>(last - first);
+        underlying_type::pop(first, last);
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        erased += underlying_type::base_type::size();
+        underlying_type::pop_all();
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param force_back Force back insertion.
+     * @param value Optional opaque value.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace(const typename underlying_type::entity_type entt, const bool force_back, const void *value) override {
+        const auto it = underlying_type::try_emplace(entt, force_back, value);
+
+        if(it != underlying_type::base_type::end()) {
+            ++emplaced;
+            track();
+        }
+
+        return it;
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = typename underlying_type::allocator_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename underlying_type::entity_type;
+
+    /*! @brief Default constructor. */
+    statistics_mixin()
+        : statistics_mixin{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit statistics_mixin(const allocator_type &allocator)
+        : underlying_type{allocator} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    statistics_mixin(const statistics_mixin &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    statistics_mixin(statistics_mixin &&other) noexcept
+        : underlying_type{std::move(other)} {
+        take(other);
+    }
+    // NOLINTEND(bugprone-use-after-move)
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    statistics_mixin(statistics_mixin &&other, const allocator_type &allocator)
+        : underlying_type{std::move(other), allocator} {
+        take(other);
+    }
+    // NOLINTEND(bugprone-use-after-move)
+
+    /*! @brief Default destructor. */
+    ~statistics_mixin() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This mixin.
+     */
+    statistics_mixin &operator=(const statistics_mixin &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This mixin.
+     */
+    statistics_mixin &operator=(statistics_mixin &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(statistics_mixin &other) noexcept {
+        const auto lhs = statistics();
+        const auto rhs = other.statistics();
+        assign(rhs);
+        other.assign(lhs);
+        underlying_type::swap(other);
+    }
+
+    /**
+     * @brief Returns the operation counters of a storage.
+     * @return The operation counters of the storage.
+     */
+    [[nodiscard]] storage_statistics statistics() const noexcept override {
+        return storage_statistics{emplaced, erased, patched, gets.load(std::memory_order_relaxed), iterations.load(std::memory_order_relaxed), peak};
+    }
+
+    /*! @brief Resets all the operation counters of a storage. */
+    void reset_statistics() noexcept {
+        assign({});
+        track();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     * @return An iterator to the first instance of the internal array.
+     */
+    [[nodiscard]] auto begin() const noexcept {
+        count(iterations);
+        return underlying_type::begin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] auto begin() noexcept {
+        count(iterations);
+        return underlying_type::begin();
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a storage.
+     * @return An iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] auto each() const noexcept {
+        count(iterations);
+        return underlying_type::each();
+    }
+
+    /*! @copydoc each */
+    [[nodiscard]] auto each() noexcept {
+        count(iterations);
+        return underlying_type::each();
+    }
+
+    /**
+     * @brief Returns a reverse iterable object to use to _visit_ a storage.
+     * @return A reverse iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] auto reach() const noexcept {
+        count(iterations);
+        return underlying_type::reach();
+    }
+
+    /*! @copydoc reach */
+    [[nodiscard]] auto reach() noexcept {
+        count(iterations);
+        return underlying_type::reach();
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity.
+     * @param entt A valid identifier.
+     * @return The object assigned to the entity.
+     */
+    [[nodiscard]] decltype(auto) get(const entity_type entt) const noexcept {
+        count(gets);
+        return underlying_type::get(entt);
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] decltype(auto) get(const entity_type entt) noexcept {
+        count(gets);
+        return underlying_type::get(entt);
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity as a tuple.
+     * @param entt A valid identifier.
+     * @return The object assigned to the entity as a tuple.
+     */
+    [[nodiscard]] auto get_as_tuple(const entity_type entt) const noexcept {
+        count(gets);
+        return underlying_type::get_as_tuple(entt);
+    }
+
+    /*! @copydoc get_as_tuple */
+    [[nodiscard]] auto get_as_tuple(const entity_type entt) noexcept {
+        count(gets);
+        return underlying_type::get_as_tuple(entt);
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param args Parameters to forward to the underlying storage.
+     * @return A reference to the newly created object, if any.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(Args &&...args) {
+        if constexpr(std::is_void_v<decltype(underlying_type::emplace(std::forward<Args>(args)...))>) {
+            underlying_type::emplace(std::forward<Args>(args)...);
+            ++emplaced;
+            track();
+        } else {
+            decltype(auto) elem = underlying_type::emplace(std::forward<Args>(args)...);
+            ++emplaced;
+            track();
+            return elem;
+        }
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched instance.
+     */
+    template<typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        ++patched;
+        return underlying_type::patch(entt, std::forward<Func>(func)...);
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to forward to the underlying storage.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = underlying_type::base_type::size();
+        underlying_type::insert(first, last, std::forward<Args>(args)...);
+        emplaced += underlying_type::base_type::size() - from;
+        track();
+    }
+
+private:
+    void assign(const storage_statistics &other) noexcept {
+        emplaced = other.emplaced;
+        erased = other.erased;
+        patched = other.patched;
+        gets.store(other.gets, std::memory_order_relaxed);
+        iterations.store(other.iterations, std::memory_order_relaxed);
+        peak = other.peak;
+    }
+
+    void take(statistics_mixin &other) noexcept {
+        assign(other.statistics());
+        other.assign({});
+    }
+
+    std::size_t emplaced{};
+    std::size_t erased{};
+    std::size_t patched{};
+    mutable counter_type gets{};
+    mutable counter_type iterations{};
+    std::size_t peak{};
+};
+
+/**
+ * @brief Mixin type used to split the elements of a storage in a hot and a cold
+ * part.
+ *
+ * The underlying storage contains the _hot_ part of the elements, the one that
+ * is accessed every frame. The mixin keeps the _cold_ part in a separate array
+ * that follows the packed array of the underlying storage, so that the two move
+ * in lock-step with a single sparse lookup.<br/>
+ * Iterating the storage only streams the hot part through the cache, while the
+ * cold part of an element is still returned in constant time.
+ *
+ * @note
+ * The cold part of an element is value-initialized when the entity is assigned
+ * to the storage and reset when the entity is erased.
+ *
+ * @tparam Type Underlying storage type.
+ * @tparam Cold Type of the cold part of the elements.
+ */
+template<typename Type, typename Cold>
+class split_mixin: public Type {
+    using underlying_type = Type;
+    using underlying_iterator = typename underlying_type::base_type::basic_iterator;
+    using alloc_traits = std::allocator_traits<typename underlying_type::allocator_type>;
+    using container_type = std::vector<Cold, typename alloc_traits::template rebind_alloc<Cold>>;
+
+    static_assert(component_traits<typename underlying_type::element_type, typename underlying_type::entity_type>::page_size != 0u, "Empty types not supported");
+    static_assert(std::is_same_v<Cold, std::decay_t<Cold>>, "Non-decayed types not allowed");
+    static_assert(std::is_default_constructible_v<Cold>, "Default constructible type required");
+
+    void reset_at(const std::size_t pos) {
+        if(pos < parts.size()) {
+            parts[pos] = Cold{};
+        } else {
+            parts.resize(pos + 1u);
+        }
+    }
+
+    template<typename It>
+    void bind_at(const It it) {
+        ENTT_TRY {
+            reset_at(static_cast<std::size_t>(it.index()));
+        }
+        ENTT_CATCH {
+            underlying_type::pop(it, it + 1u);
+            ENTT_THROW;
+        }
+    }
+
+protected:
+    /**
+     * @brief Swaps or moves two elements within a storage.
+     * @param from A valid position of an element within a storage.
+     * @param to A valid position of an element within a storage.
+     */
+    void swap_or_move(const std::size_t from, const std::size_t to) override {
+        underlying_type::swap_or_move(from, to);
+        std::swap(parts[from], parts[to]);
+    }
+
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        for(; first != last; ++first) {
+            const auto it = underlying_type::find(*first);
+            const auto pos = static_cast<std::size_t>(it.index());
+            underlying_type::pop(it, it + 1u);
+
+            if constexpr(underlying_type::storage_policy == deletion_policy::in_place) {
+                parts[pos] = Cold{};
+            } else {
+                // the last element of the packed array fills the hole, if any
+                parts[pos] = std::move(parts[underlying_type::size()]);
+                parts.pop_back();
+            }
+        }
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        underlying_type::pop_all();
+        parts.clear();
+    }
+
+    /**
+     * @brief Copies entities, elements and the cold parts from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from(const typename underlying_type::base_type &other) override {
+        const auto &from = static_cast<const split_mixin &>(other);
+        underlying_type::copy_from(other);
+        parts = from.parts;
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param force_back Force back insertion.
+     * @param value Optional opaque value.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace(const typename underlying_type::entity_type entt, const bool force_back, const void *value) override {
+        const auto it = underlying_type::try_emplace(entt, force_back, value);
+
+        if(it != underlying_type::base_type::end()) {
+            bind_at(it);
+        }
+
+        return it;
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = typename underlying_type::allocator_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename underlying_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename underlying_type::size_type;
+    /*! @brief Type of the cold part of the elements. */
+    using cold_type = Cold;
+
+    /*! @brief Default constructor. */
+    split_mixin()
+        : split_mixin{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit split_mixin(const allocator_type &allocator)
+        : underlying_type{allocator},
+          parts{allocator} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    split_mixin(const split_mixin &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    split_mixin(split_mixin &&other) noexcept
+        : underlying_type{std::move(other)},
+          parts{std::move(other.parts)} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    split_mixin(split_mixin &&other, const allocator_type &allocator)
+        : underlying_type{std::move(other), allocator},
+          parts{std::move(other.parts), allocator} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /*! @brief Default destructor. */
+    ~split_mixin() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This mixin.
+     */
+    split_mixin &operator=(const split_mixin &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This mixin.
+     */
+    split_mixin &operator=(split_mixin &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(split_mixin &other) noexcept {
+        using std::swap;
+        swap(parts, other.parts);
+        underlying_type::swap(other);
+    }
+
+    /**
+     * @brief Increases the capacity of a storage.
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) override {
+        underlying_type::reserve(cap);
+        parts.reserve(cap);
+    }
+
+    /**
+     * @brief Returns the memory used by a storage.
+     * @return The memory used by the storage.
+     */
+    [[nodiscard]] memory_report memory_usage() const noexcept override {
+        auto report = underlying_type::memory_usage();
+        report.element_bytes += parts.capacity() * sizeof(cold_type);
+        return report;
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() override {
+        underlying_type::shrink_to_fit();
+        // compacting a storage leaves values past the end of the packed array
+        parts.resize((std::min)(parts.size(), underlying_type::size()));
+        parts.shrink_to_fit();
+    }
+
+    /**
+     * @brief Returns the cold part of the element assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return The cold part of the element assigned to the entity.
+     */
+    [[nodiscard]] const cold_type &cold(const entity_type entt) const noexcept {
+        return parts[underlying_type::index(entt)];
+    }
+
+    /*! @copydoc cold */
+    [[nodiscard]] cold_type &cold(const entity_type entt) noexcept {
+        return parts[underlying_type::index(entt)];
+    }
+
+    /**
+     * @brief Direct access to the array of cold parts.
+     *
+     * The array contains the cold parts of the elements in the same order as
+     * the packed array of entities.
+     *
+     * @return A pointer to the array of cold parts.
+     */
+    [[nodiscard]] const cold_type *cold_data() const noexcept {
+        return parts.data();
+    }
+
+    /*! @copydoc cold_data */
+    [[nodiscard]] cold_type *cold_data() noexcept {
+        return parts.data();
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param entt A valid identifier.
+     * @param args Parameters to forward to the underlying storage.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        underlying_type::emplace(entt, std::forward<Args>(args)...);
+        bind_at(underlying_type::base_type::find(entt));
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to forward to the underlying storage.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = underlying_type::size();
+        underlying_type::insert(first, last, std::forward<Args>(args)...);
+
+        // fine as long as insert passes force_back true to try_emplace
+        for(auto pos = from, to = underlying_type::size(); pos != to; ++pos) {
+            reset_at(pos);
+        }
+    }
+
+private:
+    container_type parts;
+};
+
+/**
+ * @brief Mixin type used to keep a hierarchical bitset of the entities of a
+ * storage.
+ *
+ * The bottom level of the bitset has a bit for each entity index. Each of the
+ * levels above it has a bit for each word of the level below, set when the
+ * word isn't empty. The top level is a single word that summarizes the whole
+ * entity index space.<br/>
+ * Storage classes that use this mixin can be intersected one word at a time,
+ * from the top level down. Whole ranges of indexes that aren't in all the
+ * storage classes are skipped at once, regardless of their size. This is
+ * especially useful when many storage classes are involved and few entities
+ * are common to all of them.
+ *
+ * @tparam Type Underlying storage type.
+ */
+template<typename Type>
+class bitset_mixin: public Type {
+    using underlying_type = Type;
+    using underlying_iterator = typename underlying_type::base_type::basic_iterator;
+    using traits_type = entt_traits<typename underlying_type::entity_type>;
+    using alloc_traits = std::allocator_traits<typename underlying_type::allocator_type>;
+    using word_container_type = std::vector<std::uint64_t, typename alloc_traits::template rebind_alloc<std::uint64_t>>;
+
+    static constexpr std::size_t shift = 6u;
+    static constexpr std::size_t length = std::size_t{1u} << shift;
+    // enough levels for the top one to fit in a single word
+    static constexpr std::size_t depth = (static_cast<std::size_t>(popcount(traits_type::entity_mask)) + shift - 1u) / shift;
+
+    using level_container_type = std::array<word_container_type, depth>;
+
+    template<std::size_t... Index>
+    [[nodiscard]] static level_container_type make_levels(const typename underlying_type::allocator_type &allocator, std::index_sequence<Index...>) {
+        return {((void)Index, word_container_type{allocator})...};
+    }
+
+    template<std::size_t... Index>
+    [[nodiscard]] static level_container_type move_levels(level_container_type &other, const typename underlying_type::allocator_type &allocator, std::index_sequence<Index...>) {
+        return {word_container_type{std::move(other[Index]), allocator}...};
+    }
+
+    void set(const typename underlying_type::entity_type entt) {
+        for(std::size_t level{}, pos = static_cast<std::size_t>(traits_type::to_entity(entt)); level < depth; ++level, pos >>= shift) {
+            auto &words = levels[level];
+
+            if(const auto elem = pos >> shift; !(elem < words.size())) {
+                words.resize(elem + 1u);
+            }
+
+            auto &word = words[pos >> shift];
+            const bool done = (word != 0u);
+            word |= std::uint64_t{1u} << (pos & (length - 1u));
+
+            if(done) {
+                // upper levels already know about this word
+                break;
+            }
+        }
+    }
+
+    void reset(const typename underlying_type::entity_type entt) noexcept {
+        for(std::size_t level{}, pos = static_cast<std::size_t>(traits_type::to_entity(entt)); level < depth; ++level, pos >>= shift) {
+            auto &words = levels[level];
+
+            if(!((pos >> shift) < words.size())) {
+                break;
+            }
+
+            auto &word = words[pos >> shift];
+            word &= ~(std::uint64_t{1u} << (pos & (length - 1u)));
+
+            if(word != 0u) {
+                break;
+            }
+        }
+    }
+
+    void rebuild() {
+        for(auto &&words: levels) {
+            words.clear();
+        }
+
+        for(auto first = underlying_type::base_type::begin(), last = underlying_type::base_type::end(); first != last; ++first) {
+            if(*first != tombstone) {
+                set(*first);
+            }
+        }
+    }
+
+    template<typename Func, typename... Other>
+    void descend(const std::size_t level, const std::size_t pos, Func &func, const Other &...other) const {
+        // words are copied, the current entity can be removed while visiting
+        for(auto word = (this->word(level, pos) & ... & other.word(level, pos)); word != 0u; word &= word - 1u) {
+            const auto next = (pos << shift) | static_cast<std::size_t>(countr_zero(word));
+
+            if(level == 0u) {
+                const auto entt = traits_type::construct(static_cast<typename traits_type::entity_type>(next), {});
+                func(traits_type::construct(static_cast<typename traits_type::entity_type>(next), underlying_type::base_type::current(entt)));
+            } else {
+                descend(level - 1u, next, func, other...);
+            }
+        }
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        for(auto it = first; it != last; ++it) {
+            reset(*it);
+        }
+
+        underlying_type::pop(first, last);
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        for(auto &&words: levels) {
+            words.clear();
+        }
+
+        underlying_type::pop_all();
+    }
+
+    /**
+     * @brief Copies entities and elements from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from(const typename underlying_type::base_type &other) override {
+        underlying_type::copy_from(other);
+        rebuild();
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param force_back Force back insertion.
+     * @param value Optional opaque value.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace(const typename underlying_type::entity_type entt, const bool force_back, const void *value) override {
+        const auto it = underlying_type::try_emplace(entt, force_back, value);
+
+        if(it != underlying_type::base_type::end()) {
+            set(entt);
+        }
+
+        return it;
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = typename underlying_type::allocator_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename underlying_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = typename underlying_type::size_type;
+    /*! @brief Type of words of the bitset. */
+    using word_type = std::uint64_t;
+
+    /*! @brief Default constructor. */
+    bitset_mixin()
+        : bitset_mixin{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit bitset_mixin(const allocator_type &allocator)
+        : underlying_type{allocator},
+          levels{make_levels(allocator, std::make_index_sequence<depth>{})} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    bitset_mixin(const bitset_mixin &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    bitset_mixin(bitset_mixin &&other) noexcept
+        : underlying_type{std::move(other)},
+          levels{std::move(other.levels)} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    bitset_mixin(bitset_mixin &&other, const allocator_type &allocator)
+        : underlying_type{std::move(other), allocator},
+          levels{move_levels(other.levels, allocator, std::make_index_sequence<depth>{})} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /*! @brief Default destructor. */
+    ~bitset_mixin() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This mixin.
+     */
+    bitset_mixin &operator=(const bitset_mixin &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This mixin.
+     */
+    bitset_mixin &operator=(bitset_mixin &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(bitset_mixin &other) noexcept {
+        using std::swap;
+        swap(levels, other.levels);
+        underlying_type::swap(other);
+    }
+
+    /**
+     * @brief Returns the number of levels of the bitset.
+     * @return The number of levels of the bitset.
+     */
+    [[nodiscard]] static constexpr size_type levels_count() noexcept {
+        return depth;
+    }
+
+    /**
+     * @brief Returns a word of the bitset.
+     *
+     * Bits of the bottom level refer to entity indexes. Bits of the other
+     * levels refer to the words of the level below them that aren't empty.
+     *
+     * @param level The level of the word, zero being the bottom level.
+     * @param pos The position of the word within its level.
+     * @return The requested word, zero if it's out of bounds.
+     */
+    [[nodiscard]] word_type word(const size_type level, const size_type pos) const noexcept {
+        ENTT_ASSERT(level < depth, "Invalid level");
+        return (pos < levels[level].size()) ? levels[level][pos] : word_type{};
+    }
+
+    /**
+     * @brief Iterates the entities common to this and the other storage
+     * classes.
+     *
+     * Entities are returned in ascending order of their indexes. The function
+     * object is invoked for each of them with the identifier from this storage.
+     * Its signature is equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(entity_type);
+     * @endcode
+     *
+     * The current entity can be removed from any of the storage classes while
+     * visiting. Other changes to the storage classes aren't reflected
+     * reliably.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @tparam Other Types of the other storage classes, if any.
+     * @param func A valid function object.
+     * @param other Other storage classes to intersect with this one.
+     */
+    template<typename Func, typename... Other>
+    void intersect(Func func, const bitset_mixin<Other> &...other) const {
+        static_assert((std::is_same_v<entity_type, typename bitset_mixin<Other>::entity_type> && ...), "Invalid entity type");
+        descend(depth - 1u, 0u, func, other...);
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param entt A valid identifier.
+     * @param args Parameters to forward to the underlying storage.
+     * @return A reference to the newly created object.
+     */
+    template<typename... Args>
+    decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        underlying_type::emplace(entt, std::forward<Args>(args)...);
+        set(entt);
+        return this->get(entt);
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to forward to the underlying storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param args Parameters to use to forward to the underlying storage.
+     */
+    template<typename It, typename... Args>
+    void insert(It first, It last, Args &&...args) {
+        const auto from = underlying_type::size();
+        underlying_type::insert(first, last, std::forward<Args>(args)...);
+
+        // fine as long as insert passes force_back true to try_emplace
+        for(auto pos = from, to = underlying_type::size(); pos != to; ++pos) {
+            set(underlying_type::base_type::data()[pos]);
+        }
+    }
+
+private:
+    level_container_type levels;
+};
+
 } // namespace entt
 
 #endif
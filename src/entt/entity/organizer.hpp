@@ -1,23 +1,53 @@
 #ifndef ENTT_ENTITY_ORGANIZER_HPP
 #define ENTT_ENTITY_ORGANIZER_HPP
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <type_traits>
 #include <utility>
 #include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/bit.hpp"
+#include "../core/fwd.hpp"
 #include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
 #include "../core/utility.hpp"
-#include "../graph/adjacency_matrix.hpp"
-#include "../graph/flow.hpp"
 #include "fwd.hpp"
 #include "helper.hpp"
 
+#ifdef ENTT_USE_PROFILER
+#    include "../tools/profiler.hpp"
+#endif
+
 namespace entt {
 
+/**
+ * @brief Marks the access to a resource as commutative.
+ *
+ * Tasks that write a resource commutatively (for example, because they only
+ * accumulate damages or forces) can run concurrently with each other. They are
+ * still ordered with respect to all other readers and writers of the resource.
+ *
+ * @tparam Type Type of resource.
+ */
+template<typename Type>
+struct commutative final {
+    /*! @brief Type of resource. */
+    using type = Type;
+};
+
 /*! @cond TURN_OFF_DOXYGEN */
 namespace internal {
 
+enum class access_mode : std::uint8_t {
+    read,
+    write,
+    commutative
+};
+
 template<typename>
 struct is_view: std::false_type {};
 
@@ -38,17 +68,35 @@ inline constexpr bool is_group_v = is_group<Type>::value;
 
 template<typename Type, typename Override>
 struct unpack_type {
+    static constexpr bool shared = type_list_contains_v<Override, commutative<std::remove_const_t<Type>>>;
+
     using ro = std::conditional_t<
-        type_list_contains_v<Override, const Type> || (std::is_const_v<Type> && !type_list_contains_v<Override, std::remove_const_t<Type>>),
+        !shared && (type_list_contains_v<Override, const Type> || (std::is_const_v<Type> && !type_list_contains_v<Override, std::remove_const_t<Type>>)),
         type_list<std::remove_const_t<Type>>,
         type_list<>>;
 
     using rw = std::conditional_t<
-        type_list_contains_v<Override, std::remove_const_t<Type>> || (!std::is_const_v<Type> && !type_list_contains_v<Override, const Type>),
+        shared || type_list_contains_v<Override, std::remove_const_t<Type>> || (!std::is_const_v<Type> && !type_list_contains_v<Override, const Type>),
         type_list<Type>,
         type_list<>>;
 };
 
+template<typename Type, typename... Override>
+struct unpack_type<commutative<Type>, type_list<Override...>> {
+    using ro = type_list<>;
+    using rw = type_list<Type>;
+};
+
+template<typename>
+struct commutative_of {
+    using type = type_list<>;
+};
+
+template<typename Type>
+struct commutative_of<commutative<Type>> {
+    using type = type_list<Type>;
+};
+
 template<typename... Args, typename... Override>
 struct unpack_type<basic_registry<Args...>, type_list<Override...>> {
     using ro = type_list<>;
@@ -87,12 +135,27 @@ struct resource_traits<Registry, type_list<Args...>, type_list<Req...>> {
     using args = type_list<std::remove_const_t<Args>...>;
     using ro = type_list_cat_t<typename unpack_type<Args, type_list<Req...>>::ro..., typename unpack_type<Req, type_list<>>::ro...>;
     using rw = type_list_cat_t<typename unpack_type<Args, type_list<Req...>>::rw..., typename unpack_type<Req, type_list<>>::rw...>;
+    using cw = type_list_cat_t<typename commutative_of<Req>::type...>;
     static constexpr auto sync_point = (std::is_same_v<Args, Registry> || ...);
 };
 
 template<typename Registry, typename... Req, typename Ret, typename... Args>
 resource_traits<Registry, type_list<std::remove_reference_t<Args>...>, type_list<Req...>> free_function_to_resource_traits(Ret (*)(Args...));
 
+template<typename Entity, typename... Args>
+struct chunked_view {
+    using type = basic_view<get_t<storage_for_t<Args, Entity>...>, exclude_t<>>;
+};
+
+template<typename Entity, typename... Args>
+struct chunked_view<Entity, Entity, Args...>: chunked_view<Entity, Args...> {};
+
+template<typename Entity, typename... Args>
+struct chunked_view<Entity, const Entity, Args...>: chunked_view<Entity, Args...> {};
+
+template<typename Registry, typename Ret, typename... Args>
+chunked_view<typename Registry::entity_type, std::remove_reference_t<Args>...> free_function_to_chunked_view(Ret (*)(Args...));
+
 template<typename Registry, typename... Req, typename Ret, typename Type, typename... Args>
 resource_traits<Registry, type_list<std::remove_reference_t<Args>...>, type_list<Req...>> constrained_function_to_resource_traits(Ret (*)(Type &, Args...));
 
@@ -121,6 +184,9 @@ class basic_organizer final {
     using callback_type = void(const void *, Registry &);
     using prepare_type = void(Registry &);
     using dependency_type = std::size_t(const bool, const type_info **, const std::size_t);
+    using count_type = std::size_t(Registry &, const std::size_t);
+    using chunk_type = void(Registry &, const std::size_t, const std::size_t);
+    using work_type = bool(const Registry &);
 
     struct vertex_data final {
         std::size_t ro_count{};
@@ -131,8 +197,29 @@ class basic_organizer final {
         dependency_type *dependency{};
         prepare_type *prepare{};
         const type_info *info{};
+        std::size_t grain{};
+        count_type *count{};
+        chunk_type *chunk{};
+        work_type *work{};
+    };
+
+    struct node_type final {
+        vertex_data data{};
+        std::vector<std::pair<id_type, internal::access_mode>> resources{};
+        std::vector<std::uint64_t> ancestors{};
+        std::vector<std::size_t> in{};
+        std::vector<std::size_t> out{};
     };
 
+    struct resource_state final {
+        std::vector<std::size_t> writers{};
+        std::vector<std::size_t> readers{};
+        std::vector<std::size_t> shared{};
+        bool open{};
+    };
+
+    static constexpr std::size_t word_bits = std::numeric_limits<std::uint64_t>::digits;
+
     template<typename Type>
     [[nodiscard]] static decltype(auto) extract(Registry &reg) {
         if constexpr(std::is_same_v<Type, Registry>) {
@@ -151,6 +238,31 @@ class basic_organizer final {
         return std::tuple<decltype(extract<Args>(reg))...>(extract<Args>(reg)...);
     }
 
+    template<typename... Type>
+    [[nodiscard]] static bool populated(const Registry &reg, type_list<Type...>) {
+        // missing and empty pools alike leave nothing to iterate
+        return ([&reg](const auto *cpool) { return cpool && !cpool->empty(); }(reg.template storage<std::remove_const_t<typename Type::element_type>>()) && ...);
+    }
+
+    template<typename... Get, typename... Exclude>
+    [[nodiscard]] static bool populated(const Registry &reg, basic_view<get_t<Get...>, exclude_t<Exclude...>> *) {
+        return populated(reg, type_list<Get...>{});
+    }
+
+    template<typename... Owned, typename... Get, typename... Exclude>
+    [[nodiscard]] static bool populated(const Registry &reg, basic_group<owned_t<Owned...>, get_t<Get...>, exclude_t<Exclude...>> *) {
+        return populated(reg, type_list<Owned..., Get...>{});
+    }
+
+    template<typename... Args>
+    [[nodiscard]] static bool has_work([[maybe_unused]] const Registry &reg, type_list<Args...>) {
+        if constexpr(sizeof...(Args) != 0u && ((internal::is_view_v<Args> || internal::is_group_v<Args>) && ...)) {
+            return (populated(reg, static_cast<Args *>(nullptr)) && ...);
+        } else {
+            return true;
+        }
+    }
+
     template<typename... Type>
     [[nodiscard]] static std::size_t fill_dependencies(type_list<Type...>, [[maybe_unused]] const type_info **buffer, [[maybe_unused]] const std::size_t count) {
         if constexpr(sizeof...(Type) == 0u) {
@@ -169,12 +281,104 @@ class basic_organizer final {
         }
     }
 
-    template<typename... RO, typename... RW>
-    void track_dependencies(std::size_t index, const bool sync_point, type_list<RO...>, type_list<RW...>) {
-        builder.bind(static_cast<id_type>(index));
-        builder.set(type_hash<Registry>::value(), sync_point || (sizeof...(RO) + sizeof...(RW) == 0u));
-        (builder.ro(type_hash<RO>::value()), ...);
-        (builder.rw(type_hash<RW>::value()), ...);
+    template<typename Func>
+    static void access(resource_state &state, const std::size_t curr, const internal::access_mode mode, Func depends_on) {
+        switch(mode) {
+        case internal::access_mode::read:
+            std::for_each(state.writers.cbegin(), state.writers.cend(), depends_on);
+            state.readers.push_back(curr);
+            state.open = false;
+            break;
+        case internal::access_mode::commutative:
+            if(state.open) {
+                // commutative writers only wait for what the first of them waits for
+                std::for_each(state.shared.cbegin(), state.shared.cend(), depends_on);
+                state.writers.push_back(curr);
+                break;
+            }
+
+            state.shared = state.readers.empty() ? state.writers : state.readers;
+            [[fallthrough]];
+        case internal::access_mode::write: {
+            const auto &prev = state.readers.empty() ? state.writers : state.readers;
+            std::for_each(prev.cbegin(), prev.cend(), depends_on);
+            state.open = (mode == internal::access_mode::commutative);
+            state.readers.clear();
+            state.writers.assign(1u, curr);
+        } break;
+        }
+    }
+
+    template<typename... RO, typename... RW, typename CW>
+    void track_dependencies(vertex_data vdata, const bool sync_point, type_list<RO...>, type_list<RW...>, CW) {
+        node_type node{std::move(vdata)};
+        node.resources.emplace_back(type_hash<Registry>::value(), (sync_point || (sizeof...(RO) + sizeof...(RW) == 0u)) ? internal::access_mode::write : internal::access_mode::read);
+        (node.resources.emplace_back(type_hash<RO>::value(), internal::access_mode::read), ...);
+        (node.resources.emplace_back(type_hash<RW>::value(), type_list_contains_v<CW, std::remove_const_t<RW>> ? internal::access_mode::commutative : internal::access_mode::write), ...);
+
+        // a resource that is both read and written counts as written, a
+        // commutative access wins over all the others
+        std::sort(node.resources.begin(), node.resources.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first || (lhs.first == rhs.first && lhs.second > rhs.second); });
+        node.resources.erase(std::unique(node.resources.begin(), node.resources.end(), [](const auto &lhs, const auto &rhs) { return lhs.first == rhs.first; }), node.resources.end());
+
+        nodes.push_back(std::move(node));
+        link(nodes.size() - 1u);
+    }
+
+    void link(const std::size_t curr) {
+        auto &node = nodes[curr];
+        std::vector<std::uint64_t> direct((curr + word_bits - 1u) / word_bits);
+        const auto depends_on = [&direct](const std::size_t other) { direct[other / word_bits] |= std::uint64_t{1u} << (other % word_bits); };
+
+        for(auto [res, mode]: node.resources) {
+            access(resources[res], curr, mode, depends_on);
+        }
+
+        // all the predecessors of a direct dependency are also predecessors of
+        // the vertex, therefore the edges to them are redundant
+        std::vector<std::uint64_t> covered(direct.size());
+
+        for(std::size_t pos{}; pos < direct.size(); ++pos) {
+            for(auto word = direct[pos]; word != 0u; word &= word - 1u) {
+                const auto &other = nodes[pos * word_bits + static_cast<std::size_t>(countr_zero(word))].ancestors;
+
+                for(std::size_t elem{}; elem < other.size(); ++elem) {
+                    covered[elem] |= other[elem];
+                }
+            }
+        }
+
+        node.ancestors.resize(direct.size());
+
+        for(std::size_t pos{}; pos < direct.size(); ++pos) {
+            node.ancestors[pos] = direct[pos] | covered[pos];
+
+            for(auto word = direct[pos] & ~covered[pos]; word != 0u; word &= word - 1u) {
+                const auto other = pos * word_bits + static_cast<std::size_t>(countr_zero(word));
+                nodes[other].out.push_back(curr);
+                node.in.push_back(other);
+            }
+        }
+    }
+
+    void relink(const std::size_t from) {
+        resources.clear();
+
+        for(std::size_t pos{}; pos < from; ++pos) {
+            auto &out = nodes[pos].out;
+            out.erase(std::lower_bound(out.begin(), out.end(), from), out.end());
+
+            for(auto [res, mode]: nodes[pos].resources) {
+                access(resources[res], pos, mode, [](const std::size_t) {});
+            }
+        }
+
+        for(std::size_t pos = from; pos < nodes.size(); ++pos) {
+            nodes[pos].ancestors.clear();
+            nodes[pos].in.clear();
+            nodes[pos].out.clear();
+            link(pos);
+        }
     }
 
 public:
@@ -278,6 +482,55 @@ public:
             return node.payload;
         }
 
+        /**
+         * @brief Returns the maximum number of entities per chunk of a
+         * data-parallel vertex.
+         * @return The grain of a data-parallel vertex, zero otherwise.
+         */
+        [[nodiscard]] size_type grain() const noexcept {
+            return node.grain;
+        }
+
+        /**
+         * @brief Returns the number of chunks into which a vertex splits.
+         *
+         * Vertices that aren't data-parallel are made of a single chunk.
+         *
+         * @param reg A valid registry.
+         * @return The number of chunks of the vertex.
+         */
+        [[nodiscard]] size_type chunks(registry_type &reg) const {
+            return node.count ? node.count(reg, node.grain) : 1u;
+        }
+
+        /**
+         * @brief Runs a single chunk of a vertex.
+         *
+         * Chunks of the same vertex can run concurrently. Vertices that aren't
+         * data-parallel run their callback as a whole instead.
+         *
+         * @param reg A valid registry.
+         * @param pos The chunk to run.
+         */
+        void chunk(registry_type &reg, const size_type pos) const {
+            ENTT_PROFILE_SCOPE(node.name);
+            node.chunk ? node.chunk(reg, node.grain, pos) : node.callback(node.payload, reg);
+        }
+
+        /**
+         * @brief Checks if a vertex has anything to do.
+         *
+         * Free functions without payload that only receive views and groups,
+         * as well as data-parallel vertices, have nothing to do when one of
+         * the pools they iterate is empty. All other vertices always have.
+         *
+         * @param reg A valid registry.
+         * @return False if running the vertex is pointless, true otherwise.
+         */
+        [[nodiscard]] bool has_work(const registry_type &reg) const {
+            return !node.work || node.work(reg);
+        }
+
         /**
          * @brief Returns the list of in-edges of a vertex.
          * @return The list of in-edges of a vertex.
@@ -333,8 +586,8 @@ public:
             +[](registry_type &reg) { void(to_args(reg, typename resource_type::args{})); },
             &type_id<std::integral_constant<decltype(Candidate), Candidate>>()};
 
-        track_dependencies(vertices.size(), resource_type::sync_point, typename resource_type::ro{}, typename resource_type::rw{});
-        vertices.push_back(std::move(vdata));
+        vdata.work = +[](const registry_type &reg) { return has_work(reg, typename resource_type::args{}); };
+        track_dependencies(std::move(vdata), resource_type::sync_point, typename resource_type::ro{}, typename resource_type::rw{}, typename resource_type::cw{});
     }
 
     /**
@@ -365,8 +618,56 @@ public:
             +[](registry_type &reg) { void(to_args(reg, typename resource_type::args{})); },
             &type_id<std::integral_constant<decltype(Candidate), Candidate>>()};
 
-        track_dependencies(vertices.size(), resource_type::sync_point, typename resource_type::ro{}, typename resource_type::rw{});
-        vertices.push_back(std::move(vdata));
+        track_dependencies(std::move(vdata), resource_type::sync_point, typename resource_type::ro{}, typename resource_type::rw{}, typename resource_type::cw{});
+    }
+
+    /**
+     * @brief Adds a data-parallel function to the task list.
+     *
+     * The function is invoked for each entity of the view made of its
+     * arguments, optionally preceded by the entity itself. For example:
+     *
+     * @code{.cpp}
+     * void integrate(position &, const velocity &);
+     * @endcode
+     *
+     * The task can be split into chunks of at most `grain` entities that run
+     * concurrently, while it still respects the dependencies on the other
+     * tasks.
+     *
+     * @tparam Candidate Function to add to the task list.
+     * @tparam Req Additional requirements and/or override resource access mode.
+     * @param grain Maximum number of entities per chunk.
+     * @param name Optional name to associate with the task.
+     */
+    template<auto Candidate, typename... Req>
+    void emplace_chunked(const size_type grain, const char *name = nullptr) {
+        using view_type = typename decltype(internal::free_function_to_chunked_view<registry_type>(Candidate))::type;
+        using resource_type = internal::resource_traits<registry_type, type_list<view_type>, type_list<Req...>>;
+
+        ENTT_ASSERT(grain != 0u, "Invalid grain size");
+
+        vertex_data vdata{
+            resource_type::ro::size,
+            resource_type::rw::size,
+            name,
+            nullptr,
+            +[](const void *, registry_type &reg) { extract<view_type>(reg).each(Candidate); },
+            +[](const bool rw, const type_info **buffer, const std::size_t length) { return rw ? fill_dependencies(typename resource_type::rw{}, buffer, length) : fill_dependencies(typename resource_type::ro{}, buffer, length); },
+            +[](registry_type &reg) { void(to_args(reg, typename resource_type::args{})); },
+            &type_id<std::integral_constant<decltype(Candidate), Candidate>>(),
+            grain,
+            +[](registry_type &reg, const std::size_t size) {
+                std::size_t count{};
+                extract<view_type>(reg).each_chunked([&count](const std::size_t value, auto) { count = value; }, size, Candidate);
+                return count;
+            },
+            +[](registry_type &reg, const std::size_t size, const std::size_t pos) {
+                extract<view_type>(reg).each_chunked([pos](const std::size_t, auto job) { job(pos); }, size, Candidate);
+            },
+            +[](const registry_type &reg) { return has_work(reg, type_list<view_type>{}); }};
+
+        track_dependencies(std::move(vdata), resource_type::sync_point, typename resource_type::ro{}, typename resource_type::rw{}, typename resource_type::cw{});
     }
 
     /**
@@ -380,7 +681,6 @@ public:
     template<typename... Req>
     void emplace(function_type *func, const void *payload = nullptr, const char *name = nullptr) {
         using resource_type = internal::resource_traits<registry_type, type_list<>, type_list<Req...>>;
-        track_dependencies(vertices.size(), true, typename resource_type::ro{}, typename resource_type::rw{});
 
         vertex_data vdata{
             resource_type::ro::size,
@@ -392,31 +692,45 @@ public:
             nullptr,
             &type_id<void>()};
 
-        vertices.push_back(std::move(vdata));
+        track_dependencies(std::move(vdata), true, typename resource_type::ro{}, typename resource_type::rw{}, typename resource_type::cw{});
+    }
+
+    /**
+     * @brief Removes a task from the task list.
+     *
+     * Only the tasks that follow the removed one have their dependencies
+     * computed anew. The positions of these tasks shift down by one.
+     *
+     * @param pos The position of the task to remove.
+     */
+    void erase(const size_type pos) {
+        ENTT_ASSERT(pos < nodes.size(), "Index out of bounds");
+        nodes.erase(nodes.begin() + static_cast<typename std::vector<node_type>::difference_type>(pos));
+        relink(pos);
+    }
+
+    /**
+     * @brief Returns the number of tasks.
+     * @return The number of tasks.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return nodes.size();
     }
 
     /**
      * @brief Generates a task graph for the current content.
+     *
+     * The task graph is updated incrementally when tasks are added or removed.
+     * Therefore, this function only copies it out.
+     *
      * @return The adjacency list of the task graph.
      */
-    [[nodiscard]] std::vector<vertex> graph() {
+    [[nodiscard]] std::vector<vertex> graph() const {
         std::vector<vertex> adjacency_list{};
-        adjacency_list.reserve(vertices.size());
-        auto adjacency_matrix = builder.graph();
-
-        for(auto curr: adjacency_matrix.vertices()) {
-            std::vector<std::size_t> in{};
-            std::vector<std::size_t> out{};
-
-            for(auto &&edge: adjacency_matrix.in_edges(curr)) {
-                in.push_back(edge.first);
-            }
-
-            for(auto &&edge: adjacency_matrix.out_edges(curr)) {
-                out.push_back(edge.second);
-            }
+        adjacency_list.reserve(nodes.size());
 
-            adjacency_list.emplace_back(vertices[curr], std::move(in), std::move(out));
+        for(auto &&node: nodes) {
+            adjacency_list.emplace_back(node.data, node.in, node.out);
         }
 
         return adjacency_list;
@@ -424,13 +738,13 @@ public:
 
     /*! @brief Erases all elements from a container. */
     void clear() {
-        builder.clear();
-        vertices.clear();
+        resources.clear();
+        nodes.clear();
     }
 
 private:
-    std::vector<vertex_data> vertices;
-    flow builder;
+    std::vector<node_type> nodes;
+    dense_map<id_type, resource_state, identity> resources;
 };
 
 } // namespace entt
@@ -0,0 +1,269 @@
+#ifndef ENTT_ENTITY_PARTITION_HPP
+#define ENTT_ENTITY_PARTITION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Registry split into partitions that share the same identifiers.
+ *
+ * Each partition is a registry on its own, with its own pools. Therefore,
+ * partitions (for example, spatial regions of a world) can be updated on
+ * separate threads without any synchronization.<br/>
+ * Identifiers are generated by a _global_ registry, so that an entity is
+ * unique across partitions and keeps its identifier when it moves from one
+ * partition to another. The global registry also contains the pools shared by
+ * all partitions, which are accessed read-only while partitions are updated.
+ *
+ * @warning
+ * Entities are created, destroyed and migrated only when no partition is being
+ * updated. The same applies to the global registry as a whole.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_partitioned_registry final {
+public:
+    /*! @brief Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Allocator type. */
+    using allocator_type = typename registry_type::allocator_type;
+
+    /**
+     * @brief Storage type for a given element type.
+     * @tparam Type Storage value type, eventually const.
+     */
+    template<typename Type>
+    using storage_for_type = typename registry_type::template storage_for_type<Type>;
+
+    /**
+     * @brief Constructs a registry with a given number of partitions.
+     * @param count Number of partitions, at least one.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_partitioned_registry(const size_type count, const allocator_type &allocator = allocator_type{})
+        : shared{allocator},
+          partitions{} {
+        ENTT_ASSERT(count != 0u, "Invalid number of partitions");
+        partitions.reserve(count);
+
+        for(size_type pos{}; pos < count; ++pos) {
+            partitions.emplace_back(allocator);
+        }
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_partitioned_registry(const basic_partitioned_registry &) = delete;
+
+    /*! @brief Default move constructor. */
+    basic_partitioned_registry(basic_partitioned_registry &&) noexcept = default;
+
+    /*! @brief Default destructor. */
+    ~basic_partitioned_registry() = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This registry.
+     */
+    basic_partitioned_registry &operator=(const basic_partitioned_registry &) = delete;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This registry.
+     */
+    basic_partitioned_registry &operator=(basic_partitioned_registry &&) noexcept = default;
+
+    /**
+     * @brief Returns the number of partitions.
+     * @return Number of partitions.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return partitions.size();
+    }
+
+    /**
+     * @brief Returns the global registry.
+     * @return The global registry.
+     */
+    [[nodiscard]] const registry_type &global() const noexcept {
+        return shared;
+    }
+
+    /*! @copydoc global */
+    [[nodiscard]] registry_type &global() noexcept {
+        return shared;
+    }
+
+    /**
+     * @brief Returns a given partition.
+     * @param pos Index of the partition to return.
+     * @return The requested partition.
+     */
+    [[nodiscard]] const registry_type &partition(const size_type pos) const noexcept {
+        ENTT_ASSERT(pos < partitions.size(), "Invalid partition");
+        return partitions[pos];
+    }
+
+    /*! @copydoc partition */
+    [[nodiscard]] registry_type &partition(const size_type pos) noexcept {
+        ENTT_ASSERT(pos < partitions.size(), "Invalid partition");
+        return partitions[pos];
+    }
+
+    /**
+     * @brief Creates in advance the given pools in all partitions.
+     * @tparam Type Types of elements for which to create the pools.
+     */
+    template<typename... Type>
+    void prepare() {
+        for(auto &&elem: partitions) {
+            elem.template prepare<Type...>();
+        }
+    }
+
+    /**
+     * @brief Creates a new entity in a given partition.
+     * @param pos Index of the partition in which to create the entity.
+     * @return A valid identifier.
+     */
+    entity_type create(const size_type pos) {
+        const auto entt = shared.create();
+        [[maybe_unused]] const auto other = partition(pos).create(entt);
+        ENTT_ASSERT(other == entt, "Identifier already in use");
+        return entt;
+    }
+
+    /**
+     * @brief Assigns each element in a range an entity created in a given
+     * partition.
+     * @tparam It Type of forward iterator.
+     * @param pos Index of the partition in which to create the entities.
+     * @param first An iterator to the first element of the range to generate.
+     * @param last An iterator past the last element of the range to generate.
+     */
+    template<typename It>
+    void create(const size_type pos, It first, It last) {
+        auto &target = partition(pos);
+        shared.create(first, last);
+
+        for(; first != last; ++first) {
+            [[maybe_unused]] const auto other = target.create(*first);
+            ENTT_ASSERT(other == *first, "Identifier already in use");
+        }
+    }
+
+    /**
+     * @brief Returns the partition an entity belongs to.
+     * @param entt A valid identifier.
+     * @return The index of the partition if any, the number of partitions
+     * otherwise.
+     */
+    [[nodiscard]] size_type locate(const entity_type entt) const {
+        const auto it = std::find_if(partitions.cbegin(), partitions.cend(), [entt](const auto &elem) { return elem.valid(entt); });
+        return static_cast<size_type>(it - partitions.cbegin());
+    }
+
+    /**
+     * @brief Destroys an entity, its elements in the global registry included.
+     * @param entt A valid identifier.
+     * @return The version of the recycled entity.
+     */
+    auto destroy(const entity_type entt) {
+        const auto pos = locate(entt);
+        ENTT_ASSERT(pos != partitions.size(), "Invalid entity");
+        partitions[pos].destroy(entt);
+        return shared.destroy(entt);
+    }
+
+    /**
+     * @brief Moves the entities in a range and their elements from a partition
+     * to another.
+     *
+     * Entities keep their identifiers. Elements are copied one storage at a
+     * time, then the entities are destroyed in the source partition. The pools
+     * of the two partitions are paired by name.<br/>
+     * Signals are triggered as usual in both partitions. Elements in the
+     * global registry aren't affected.
+     *
+     * @warning
+     * The target partition must contain all the pools the entities belong to,
+     * for example because they were created in advance with `prepare`.<br/>
+     * Elements that aren't copy constructible aren't migrated.
+     *
+     * @tparam It Type of forward iterator.
+     * @param from Index of the partition the entities belong to.
+     * @param to Index of the partition to move the entities to.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    void migrate(const size_type from, const size_type to, It first, It last) {
+        ENTT_ASSERT(from != to, "Same partition");
+        auto &source = partition(from);
+        auto &target = partition(to);
+        ENTT_ASSERT(std::all_of(first, last, [&source](const auto entt) { return source.valid(entt); }), "Invalid entity");
+
+        for(auto it = first; it != last; ++it) {
+            [[maybe_unused]] const auto other = target.create(*it);
+            ENTT_ASSERT(other == *it, "Identifier already in use");
+        }
+
+        for(auto [id, cpool]: source.storage()) {
+            if(const auto len = static_cast<size_type>(std::count_if(first, last, [&cpool = cpool](const auto entt) { return cpool.contains(entt); })); len != 0u) {
+                auto *other = target.storage(id);
+                ENTT_ASSERT(other != nullptr, "Missing storage");
+                ENTT_ASSERT(other->info() == cpool.info(), "Unexpected type");
+                other->reserve(other->size() + len);
+
+                for(auto it = first; it != last; ++it) {
+                    if(cpool.contains(*it)) {
+                        other->push(*it, cpool.value(*it));
+                    }
+                }
+            }
+        }
+
+        source.destroy(first, last);
+    }
+
+    /**
+     * @brief Returns a view for the given elements of a partition, combined
+     * with those of the global registry.
+     *
+     * Pools of the global registry are accessed read-only and never created.
+     * Therefore, the view can be safely used while other partitions are being
+     * updated.
+     *
+     * @tparam Type Type of element used to construct the view.
+     * @tparam Other Other types of elements used to construct the view.
+     * @tparam Global Types of elements of the global registry.
+     * @param pos Index of the partition to iterate.
+     * @return A newly created view.
+     */
+    template<typename Type, typename... Other, typename... Global>
+    [[nodiscard]] basic_view<get_t<storage_for_type<Type>, storage_for_type<Other>..., storage_for_type<const Global>...>, exclude_t<>>
+    view(const size_type pos, get_t<Global...> = get_t{}) {
+        auto &target = partition(pos);
+        basic_view<get_t<storage_for_type<Type>, storage_for_type<Other>..., storage_for_type<const Global>...>, exclude_t<>> elem{};
+        [&elem](auto *...curr) { ((curr ? elem.storage(*curr) : void()), ...); }(&target.template storage<Type>(), &target.template storage<Other>()..., std::as_const(shared).template storage<Global>()...);
+        return elem;
+    }
+
+private:
+    registry_type shared;
+    std::vector<registry_type> partitions;
+};
+
+} // namespace entt
+
+#endif
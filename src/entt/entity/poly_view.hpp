@@ -0,0 +1,217 @@
+#ifndef ENTT_ENTITY_POLY_VIEW_HPP
+#define ENTT_ENTITY_POLY_VIEW_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "../core/type_traits.hpp"
+#include "fwd.hpp"
+#include "view.hpp"
+
+namespace entt {
+
+/**
+ * @brief View over all the storage of the types that share a common base.
+ *
+ * A polymorphic view iterates all the given storage objects one after the
+ * other. Each storage is visited as a whole and with its own element type, so
+ * that function objects are statically dispatched once per storage rather
+ * than once per element. Generic lambdas get a devirtualized inner loop for
+ * each type, while those that accept a reference to the base type work as
+ * with ordinary virtual calls.
+ *
+ * @b Important
+ *
+ * Entities are returned once for each storage that contains them. A
+ * polymorphic view doesn't remove duplicates and doesn't filter out entities
+ * that aren't in all the storage objects.
+ *
+ * @tparam Base Common base type of all elements, possibly const qualified.
+ * @tparam Storage Types of storage iterated by the view.
+ */
+template<typename Base, typename... Storage>
+class basic_poly_view {
+    static_assert(sizeof...(Storage) != 0u, "Invalid view");
+    static_assert((std::is_base_of_v<std::remove_const_t<Base>, typename Storage::value_type> && ...), "Type doesn't derive from the given base");
+
+    template<typename Type>
+    static constexpr std::size_t index_of = type_list_index_v<std::remove_const_t<Type>, type_list<typename Storage::element_type...>>;
+
+    template<std::size_t... Index>
+    [[nodiscard]] bool valid(std::index_sequence<Index...>) const noexcept {
+        return ((std::get<Index>(pools) != nullptr) && ...);
+    }
+
+public:
+    /*! @brief Common base type of all elements. */
+    using base_type = Base;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = std::common_type_t<typename Storage::entity_type...>;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor to use to create empty, invalid views. */
+    basic_poly_view() noexcept
+        : pools{} {}
+
+    /**
+     * @brief Constructs a polymorphic view from a set of storage classes.
+     * @param storage The storage for the types to iterate.
+     */
+    basic_poly_view(Storage &...storage) noexcept
+        : pools{&storage...} {}
+
+    /**
+     * @brief Returns the storage for a given element type, if any.
+     * @tparam Type Type of element of which to return the storage.
+     * @return The storage for the given element type.
+     */
+    template<typename Type>
+    [[nodiscard]] auto *storage() const noexcept {
+        return storage<index_of<Type>>();
+    }
+
+    /**
+     * @brief Returns the storage for a given index, if any.
+     * @tparam Index Index of the storage to return.
+     * @return The storage for the given index.
+     */
+    template<std::size_t Index>
+    [[nodiscard]] auto *storage() const noexcept {
+        return std::get<Index>(pools);
+    }
+
+    /**
+     * @brief Assigns a storage to a view.
+     * @tparam Type Type of storage to assign to the view.
+     * @param elem A storage to assign to the view.
+     */
+    template<typename Type>
+    void storage(Type &elem) noexcept {
+        storage<index_of<typename Type::element_type>>(elem);
+    }
+
+    /**
+     * @brief Assigns a storage to a view.
+     * @tparam Index Index of the storage to assign to the view.
+     * @tparam Type Type of storage to assign to the view.
+     * @param elem A storage to assign to the view.
+     */
+    template<std::size_t Index, typename Type>
+    void storage(Type &elem) noexcept {
+        std::get<Index>(pools) = &elem;
+    }
+
+    /**
+     * @brief Returns the number of elements iterated by the view.
+     * @return Number of elements iterated by the view.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return std::apply([](const auto *...curr) { return ((curr ? curr->size() : size_type{}) + ... + size_type{}); }, pools);
+    }
+
+    /**
+     * @brief Checks whether a view is empty.
+     * @return True if the view is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return std::apply([](const auto *...curr) { return ((!curr || curr->empty()) && ...); }, pools);
+    }
+
+    /**
+     * @brief Checks if a view contains an entity.
+     * @param entt A valid identifier.
+     * @return True if at least one storage contains the entity, false
+     * otherwise.
+     */
+    [[nodiscard]] bool contains(const entity_type entt) const noexcept {
+        return std::apply([entt](const auto *...curr) { return ((curr && curr->contains(entt)) || ...); }, pools);
+    }
+
+    /**
+     * @brief Returns the element assigned to an entity, if any.
+     *
+     * Storage objects are tested in the order in which they were provided and
+     * the element of the first one that contains the entity is returned.
+     *
+     * @param entt A valid identifier.
+     * @return A pointer to the element assigned to the entity, if any.
+     */
+    [[nodiscard]] base_type *try_get(const entity_type entt) const noexcept {
+        base_type *elem{};
+        std::apply([entt, &elem](auto *...curr) { ((curr && curr->contains(entt) && (elem = &curr->get(entt))) || ...); }, pools);
+        return elem;
+    }
+
+    /**
+     * @brief Returns the element assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the view results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return A reference to the element assigned to the entity.
+     */
+    [[nodiscard]] base_type &get(const entity_type entt) const noexcept {
+        auto *elem = try_get(entt);
+        ENTT_ASSERT(elem != nullptr, "Invalid entity");
+        return *elem;
+    }
+
+    /**
+     * @brief Iterates all elements and applies the given function object to
+     * them, one storage at a time.
+     *
+     * The function object is invoked for each element. It is provided with
+     * either the entity and a reference to the element or only the latter, as
+     * with single type views. Elements are returned with their own type, not
+     * as references to the base type.<br/>
+     * The signature of the function must be equivalent to one of the
+     * following, where `Type` is any of the iterated types:
+     *
+     * @code{.cpp}
+     * void(const entity_type, Type &);
+     * void(Type &);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        std::apply([&func](auto *...curr) { ((curr ? basic_view<get_t<std::remove_pointer_t<decltype(curr)>>, exclude_t<>>{*curr}.each(func) : void()), ...); }, pools);
+    }
+
+    /**
+     * @brief Applies the given function object to all storage objects, one at
+     * a time.
+     *
+     * This is meant for algorithms that work on whole storage objects, such
+     * as those that process elements in batches.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void visit(Func func) const {
+        std::apply([&func](auto *...curr) { ((curr ? static_cast<void>(func(*curr)) : void()), ...); }, pools);
+    }
+
+    /**
+     * @brief Checks whether a view is initialized or not.
+     * @return True if the view is initialized, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return valid(std::index_sequence_for<Storage...>{});
+    }
+
+private:
+    std::tuple<Storage *...> pools;
+};
+
+} // namespace entt
+
+#endif
@@ -3,7 +3,9 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <memory>
@@ -15,12 +17,14 @@
 #include "../container/dense_map.hpp"
 #include "../core/algorithm.hpp"
 #include "../core/any.hpp"
+#include "../core/bit.hpp"
 #include "../core/fwd.hpp"
 #include "../core/iterator.hpp"
 #include "../core/memory.hpp"
 #include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
 #include "../core/utility.hpp"
+#include "../signal/sigh.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 #include "group.hpp"
@@ -155,6 +159,105 @@ template<typename Lhs, typename Rhs>
     return !(lhs < rhs);
 }
 
+#ifdef ENTT_USE_COMPONENT_MASK
+template<typename>
+struct is_sigh_mixin: std::false_type {};
+
+template<typename Type, typename Registry>
+struct is_sigh_mixin<basic_sigh_mixin<Type, Registry>>: std::true_type {};
+
+template<typename Allocator>
+class registry_mask {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using word_type = std::uint64_t;
+    using column_type = std::vector<word_type, typename alloc_traits::template rebind_alloc<word_type>>;
+    using container_type = std::vector<column_type, typename alloc_traits::template rebind_alloc<column_type>>;
+
+    static constexpr std::size_t length = 64u;
+
+    template<typename Func>
+    static void bits(const std::size_t column, word_type word, Func &func) {
+        for(; word != 0u; word &= word - 1u) {
+            func(column * length + static_cast<std::size_t>(countr_zero(word)));
+        }
+    }
+
+public:
+    explicit registry_mask(const Allocator &allocator)
+        : columns{allocator} {}
+
+    void set(const std::size_t slot, const std::size_t index) {
+        if(const auto pos = slot / length; pos >= columns.size()) {
+            columns.resize(pos + 1u, column_type{columns.get_allocator()});
+        }
+
+        auto &column = columns[slot / length];
+
+        if(index >= column.size()) {
+            column.resize(index + 1u);
+        }
+
+        column[index] |= word_type{1u} << (slot % length);
+    }
+
+    void reset(const std::size_t slot, const std::size_t index) noexcept {
+        if(const auto pos = slot / length; pos < columns.size() && index < columns[pos].size()) {
+            columns[pos][index] &= ~(word_type{1u} << (slot % length));
+        }
+    }
+
+    void reset(const std::size_t slot) noexcept {
+        if(const auto pos = slot / length; pos < columns.size()) {
+            for(auto &&word: columns[pos]) {
+                word &= ~(word_type{1u} << (slot % length));
+            }
+        }
+    }
+
+    [[nodiscard]] bool test(const std::size_t slot, const std::size_t index) const noexcept {
+        const auto pos = slot / length;
+        return pos < columns.size() && index < columns[pos].size() && ((columns[pos][index] >> (slot % length)) & 1u) != 0u;
+    }
+
+    template<typename Func>
+    void each(const std::size_t index, Func func) const {
+        for(std::size_t pos{}, last = columns.size(); pos < last; ++pos) {
+            // words are copied, listeners can update them while visiting
+            if(index < columns[pos].size()) {
+                bits(pos, columns[pos][index], func);
+            }
+        }
+    }
+
+    template<typename It, typename Func>
+    void each(It first, It last, Func func) const {
+        for(std::size_t pos{}, end = columns.size(); pos < end; ++pos) {
+            word_type word{};
+
+            for(auto it = first; it != last; ++it) {
+                if(const auto index = static_cast<std::size_t>(to_entity(*it)); index < columns[pos].size()) {
+                    word |= columns[pos][index];
+                }
+            }
+
+            bits(pos, word, func);
+        }
+    }
+
+    void clear() noexcept {
+        columns.clear();
+    }
+
+    void swap(registry_mask &other) noexcept {
+        using std::swap;
+        swap(columns, other.columns);
+    }
+
+private:
+    container_type columns;
+};
+#endif
+
 template<typename Allocator>
 class registry_context {
     using alloc_traits = std::allocator_traits<Allocator>;
@@ -168,6 +271,10 @@ public:
         ctx.clear();
     }
 
+    void shrink_to_fit() {
+        ctx.shrink_to_fit();
+    }
+
     template<typename Type, typename... Args>
     Type &emplace_as(const id_type id, Args &&...args) {
         return any_cast<Type &>(ctx.try_emplace(id, std::in_place_type<Type>, std::forward<Args>(args)...).first->second);
@@ -180,7 +287,19 @@ public:
 
     template<typename Type>
     Type &insert_or_assign(const id_type id, Type &&value) {
-        return any_cast<std::remove_cv_t<std::remove_reference_t<Type>> &>(ctx.insert_or_assign(id, std::forward<Type>(value)).first->second);
+        using value_type = std::remove_cv_t<std::remove_reference_t<Type>>;
+
+        if constexpr(std::is_assignable_v<value_type &, Type &&>) {
+            // owned variables are assigned in place so that slots stay valid
+            if(const auto it = ctx.find(id); it != ctx.end() && it->second.owner()) {
+                if(auto *elem = any_cast<value_type>(&it->second); elem) {
+                    *elem = std::forward<Type>(value);
+                    return *elem;
+                }
+            }
+        }
+
+        return any_cast<value_type &>(ctx.insert_or_assign(id, std::forward<Type>(value)).first->second);
     }
 
     template<typename Type>
@@ -216,6 +335,20 @@ public:
         return it != ctx.end() ? any_cast<Type>(&it->second) : nullptr;
     }
 
+    template<typename Type>
+    [[nodiscard]] const Type *slot(const id_type id = type_id<Type>().hash()) const {
+        const auto *elem = find<Type>(id);
+        ENTT_ASSERT(elem != nullptr, "Invalid context variable");
+        return elem;
+    }
+
+    template<typename Type>
+    [[nodiscard]] Type *slot(const id_type id = type_id<Type>().hash()) {
+        auto *elem = find<Type>(id);
+        ENTT_ASSERT(elem != nullptr, "Invalid context variable");
+        return elem;
+    }
+
     template<typename Type>
     [[nodiscard]] bool contains(const id_type id = type_id<Type>().hash()) const {
         const auto it = ctx.find(id);
@@ -243,6 +376,16 @@ class basic_registry {
     using pool_container_type = dense_map<id_type, std::shared_ptr<base_type>, identity, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::shared_ptr<base_type>>>>;
     using group_container_type = dense_map<id_type, std::shared_ptr<internal::group_descriptor>, identity, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::shared_ptr<internal::group_descriptor>>>>;
     using traits_type = entt_traits<Entity>;
+    using sigh_type = sigh<void(basic_registry &, const id_type), Allocator>;
+#ifdef ENTT_USE_TYPE_INDEX
+    using index_container_type = std::vector<base_type *, typename alloc_traits::template rebind_alloc<base_type *>>;
+#endif
+#ifdef ENTT_USE_COMPONENT_MASK
+    using slot_container_type = std::vector<base_type *, typename alloc_traits::template rebind_alloc<base_type *>>;
+
+    template<typename, typename>
+    friend class basic_sigh_mixin;
+#endif
 
     template<typename Type>
     [[nodiscard]] auto &assure([[maybe_unused]] const id_type id = type_hash<Type>::value()) {
@@ -254,11 +397,23 @@ class basic_registry {
         } else {
             using storage_type = storage_for_type<Type>;
 
+#ifdef ENTT_USE_TYPE_INDEX
+            const auto pos = static_cast<size_type>(type_index<Type>::value());
+
+            if(id == type_hash<Type>::value() && pos < indexed.size() && indexed[pos] != nullptr) {
+                return static_cast<storage_type &>(*indexed[pos]);
+            }
+#endif
+
             if(auto it = pools.find(id); it != pools.cend()) {
                 ENTT_ASSERT(it->second->info() == type_id<Type>(), "Unexpected type");
+#ifdef ENTT_USE_TYPE_INDEX
+                index(pos, id == type_hash<Type>::value() ? it->second.get() : nullptr);
+#endif
                 return static_cast<storage_type &>(*it->second);
             }
 
+            ENTT_ASSERT(!readonly, "Frozen registry");
             using alloc_type = typename storage_type::allocator_type;
             typename pool_container_type::mapped_type cpool{};
 
@@ -269,8 +424,24 @@ class basic_registry {
                 cpool = std::allocate_shared<storage_type>(get_allocator(), get_allocator());
             }
 
+#ifdef ENTT_USE_COMPONENT_MASK
+            // cannot fail once the pool is registered
+            internal::is_sigh_mixin<storage_type>::value ? slots.reserve(slots.size() + 1u) : untracked.reserve(untracked.size() + 1u);
+#endif
+            if(paging != 0u) {
+                cpool->sparse_page_size(paging);
+            }
+
             pools.emplace(id, cpool);
+            ++layout;
+#ifdef ENTT_USE_TYPE_INDEX
+            index(pos, id == type_hash<Type>::value() ? cpool.get() : nullptr);
+#endif
+#ifdef ENTT_USE_COMPONENT_MASK
+            track(static_cast<storage_type &>(*cpool));
+#endif
             cpool->bind(*this);
+            created.publish(*this, id);
 
             return static_cast<storage_type &>(*cpool);
         }
@@ -284,6 +455,13 @@ class basic_registry {
             ENTT_ASSERT(id == type_hash<Type>::value(), "User entity storage not allowed");
             return &entities;
         } else {
+#ifdef ENTT_USE_TYPE_INDEX
+            // const lookups never fill the index, so that they don't race when invoked from multiple threads
+            if(const auto pos = static_cast<size_type>(type_index<Type>::value()); id == type_hash<Type>::value() && pos < indexed.size() && indexed[pos] != nullptr) {
+                return static_cast<const storage_for_type<Type> *>(indexed[pos]);
+            }
+#endif
+
             if(const auto it = pools.find(id); it != pools.cend()) {
                 ENTT_ASSERT(it->second->info() == type_id<Type>(), "Unexpected type");
                 return static_cast<const storage_for_type<Type> *>(it->second.get());
@@ -293,6 +471,49 @@ class basic_registry {
         }
     }
 
+#ifdef ENTT_USE_TYPE_INDEX
+    void index(const std::size_t pos, base_type *elem) {
+        if(elem != nullptr) {
+            if(pos >= indexed.size()) {
+                indexed.resize(pos + 1u, nullptr);
+            }
+
+            indexed[pos] = elem;
+        }
+    }
+#endif
+
+#ifdef ENTT_USE_COMPONENT_MASK
+    template<typename Storage>
+    void track(Storage &elem) noexcept {
+        if constexpr(internal::is_sigh_mixin<Storage>::value) {
+            if(const auto it = std::find(slots.begin(), slots.end(), nullptr); it == slots.end()) {
+                elem.mask_slot = slots.size();
+                slots.push_back(&elem);
+            } else {
+                elem.mask_slot = static_cast<size_type>(it - slots.begin());
+                *it = &elem;
+            }
+        } else {
+            untracked.push_back(&elem);
+        }
+    }
+
+    void retrack() {
+        mask.clear();
+
+        for(size_type slot{}, last = slots.size(); slot < last; ++slot) {
+            if(slots[slot] != nullptr) {
+                for(auto entt: *slots[slot]) {
+                    if(entt != tombstone) {
+                        mask.set(slot, static_cast<size_type>(traits_type::to_entity(entt)));
+                    }
+                }
+            }
+        }
+    }
+#endif
+
     void rebind() {
         entities.bind(*this);
 
@@ -301,6 +522,28 @@ class basic_registry {
         }
     }
 
+    [[nodiscard]] static constexpr Entity plain(const Entity entt) noexcept {
+        return Entity{traits_type::to_integral(entt) & ~traits_type::disabled_mask};
+    }
+
+    [[nodiscard]] Entity stored(const Entity entt) const {
+        if constexpr(traits_type::disabled_mask == 0u) {
+            return entt;
+        } else {
+            // disabled bits are only set in the entity storage, never in pools
+            const Entity elem{traits_type::to_integral(entt) | traits_type::disabled_mask};
+            return entities.contains(elem) ? elem : plain(entt);
+        }
+    }
+
+    [[nodiscard]] bool any_disabled() const noexcept {
+        if constexpr(traits_type::disabled_mask == 0u) {
+            return false;
+        } else {
+            return std::any_of(entities.data(), entities.data() + entities.size(), [](const Entity entt) { return (traits_type::to_integral(entt) & traits_type::disabled_mask) != 0u; });
+        }
+    }
+
 public:
     /*! @brief Allocator type. */
     using allocator_type = Allocator;
@@ -345,8 +588,21 @@ public:
     basic_registry(const size_type count, const allocator_type &allocator = allocator_type{})
         : vars{allocator},
           pools{allocator},
+#ifdef ENTT_USE_TYPE_INDEX
+          indexed{allocator},
+#endif
+#ifdef ENTT_USE_COMPONENT_MASK
+          mask{allocator},
+          slots{allocator},
+          untracked{allocator},
+#endif
           groups{allocator},
-          entities{allocator} {
+          entities{allocator},
+          created{allocator},
+          trimmed{},
+          layout{},
+          paging{},
+          readonly{} {
         pools.reserve(count);
         rebind();
     }
@@ -361,8 +617,21 @@ public:
     basic_registry(basic_registry &&other) noexcept
         : vars{std::move(other.vars)},
           pools{std::move(other.pools)},
+#ifdef ENTT_USE_TYPE_INDEX
+          indexed{std::move(other.indexed)},
+#endif
+#ifdef ENTT_USE_COMPONENT_MASK
+          mask{std::move(other.mask)},
+          slots{std::move(other.slots)},
+          untracked{std::move(other.untracked)},
+#endif
           groups{std::move(other.groups)},
-          entities{std::move(other.entities)} {
+          entities{std::move(other.entities)},
+          created{std::move(other.created)},
+          trimmed{std::exchange(other.trimmed, 0u)},
+          layout{std::exchange(other.layout, other.layout + 1u)},
+          paging{other.paging},
+          readonly{other.readonly} {
         rebind();
     }
 
@@ -394,8 +663,22 @@ public:
 
         swap(vars, other.vars);
         swap(pools, other.pools);
+#ifdef ENTT_USE_TYPE_INDEX
+        swap(indexed, other.indexed);
+#endif
+#ifdef ENTT_USE_COMPONENT_MASK
+        mask.swap(other.mask);
+        swap(slots, other.slots);
+        swap(untracked, other.untracked);
+#endif
         swap(groups, other.groups);
         swap(entities, other.entities);
+        swap(created, other.created);
+        swap(trimmed, other.trimmed);
+        swap(paging, other.paging);
+        swap(readonly, other.readonly);
+        // storage changed hands, neither layout is the one seen so far
+        layout = other.layout = (std::max)(layout, other.layout) + 1u;
 
         rebind();
         other.rebind();
@@ -473,8 +756,287 @@ public:
      * @return True in case of success, false otherwise.
      */
     bool reset(const id_type id) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         ENTT_ASSERT(id != type_hash<entity_type>::value(), "Cannot reset entity storage");
-        return !(pools.erase(id) == 0u);
+
+#ifdef ENTT_USE_TYPE_INDEX
+        if(const auto it = pools.find(id); it != pools.cend()) {
+            std::replace(indexed.begin(), indexed.end(), it->second.get(), static_cast<base_type *>(nullptr));
+        }
+#endif
+#ifdef ENTT_USE_COMPONENT_MASK
+        if(const auto it = pools.find(id); it != pools.cend()) {
+            if(const auto slot = std::find(slots.begin(), slots.end(), it->second.get()); slot != slots.end()) {
+                mask.reset(static_cast<size_type>(slot - slots.begin()));
+                *slot = nullptr;
+            } else {
+                untracked.erase(std::remove(untracked.begin(), untracked.end(), it->second.get()), untracked.end());
+            }
+        }
+#endif
+
+        if(pools.erase(id) == 0u) {
+            return false;
+        }
+
+        ++layout;
+        return true;
+    }
+
+    /**
+     * @brief Creates in advance the pools for the given elements, if missing.
+     *
+     * Pools are otherwise created lazily on first access, which is a
+     * structural change to the registry. Preparing them before freezing the
+     * registry allows systems to access them concurrently later on.
+     *
+     * @tparam Type Types of elements for which to create the pools.
+     */
+    template<typename... Type>
+    void prepare() {
+        (static_cast<void>(assure<std::remove_const_t<Type>>()), ...);
+    }
+
+    /**
+     * @brief Replaces the contents of a registry with a copy of those of
+     * another registry.
+     *
+     * Entities and elements are copied one storage at a time, sparse and
+     * packed pages included, and retain their positions. The pools of the two
+     * registries are paired by name. Pools that don't exist in the other
+     * registry are cleared instead.<br/>
+     * The copy doesn't trigger any signal, although listeners are notified as
+     * usual when pools are cleared. The context isn't copied.
+     *
+     * @warning
+     * All the pools of the other registry must also exist in this registry,
+     * for example because they were created in advance with `prepare`.<br/>
+     * Copying into a registry that contains groups results in undefined
+     * behavior.
+     *
+     * @param other The registry to copy the contents from.
+     */
+    void deep_copy_from(const basic_registry &other) {
+        deep_copy_from(other, [](const id_type, common_type &, const common_type &) { return false; });
+    }
+
+    /**
+     * @brief Replaces the contents of a registry with a copy of those of
+     * another registry.
+     *
+     * The function object is invoked for each pair of pools before copying
+     * them. Its signature is equivalent to the following:
+     *
+     * @code{.cpp}
+     * bool(const id_type, common_type &, const common_type &);
+     * @endcode
+     *
+     * The arguments are the name of the pools, the pool to copy to and the one
+     * to copy from. Pools for which the function object returns true are
+     * considered already up to date (for example, because only their changed
+     * pages were copied) and are left untouched.
+     *
+     * @sa deep_copy_from
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param other The registry to copy the contents from.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void deep_copy_from(const basic_registry &other, Func func) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
+        ENTT_ASSERT(groups.empty(), "Groups not supported");
+
+        for([[maybe_unused]] auto &&curr: other.pools) {
+            ENTT_ASSERT(pools.contains(curr.first), "Missing storage");
+        }
+
+        if(&other != this) {
+            entities.deep_copy_from(other.entities);
+
+            for(auto &&curr: pools) {
+                if(const auto it = other.pools.find(curr.first); it == other.pools.cend()) {
+                    curr.second->clear();
+                } else if(!func(curr.first, *curr.second, *it->second)) {
+                    curr.second->deep_copy_from(*it->second);
+                }
+            }
+
+#ifdef ENTT_USE_COMPONENT_MASK
+            // copies don't trigger signals and therefore don't update the mask
+            retrack();
+#endif
+        }
+    }
+
+    /**
+     * @brief Moves the entities in a range and their elements to another
+     * registry.
+     *
+     * New identifiers are generated by the other registry and returned through
+     * the output range, in the same order as the original entities. Elements
+     * are move constructed one storage at a time (or copied, if they can't be
+     * moved), then the original entities are destroyed. The pools of the two
+     * registries are paired by name.<br/>
+     * Signals are triggered as usual in both registries. Elements that refer
+     * to other entities aren't updated.
+     *
+     * All the pools the entities belong to are checked in advance. If any of
+     * them is missing in the other registry or its elements can be neither
+     * moved nor copied, nothing is transferred and neither registry is
+     * modified.
+     *
+     * @tparam It Type of forward iterator.
+     * @tparam Out Type of forward iterator.
+     * @param other The registry to transfer the entities to.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param result An iterator to the first element of the range of new
+     * identifiers.
+     * @return True if the entities are transferred, false otherwise.
+     */
+    template<typename It, typename Out>
+    bool transfer(basic_registry &other, It first, It last, Out result) {
+        ENTT_ASSERT(!readonly && !other.readonly, "Frozen registry");
+        ENTT_ASSERT(&other != this, "Same registry");
+        ENTT_ASSERT(std::all_of(first, last, [this](const auto entt) { return valid(entt); }), "Invalid entity");
+
+        for(auto &&curr: pools) {
+            if(auto &cpool = *curr.second; std::any_of(first, last, [&cpool](const auto entt) { return cpool.contains(entt); })) {
+                if(const auto it = other.pools.find(curr.first); it == other.pools.cend() || it->second->info() != cpool.info() || !it->second->movable()) {
+                    return false;
+                }
+            }
+        }
+
+        other.entities.generate(result, std::next(result, std::distance(first, last)));
+
+        for(auto &&curr: pools) {
+            auto &cpool = *curr.second;
+
+            if(const auto len = static_cast<size_type>(std::count_if(first, last, [&cpool](const auto entt) { return cpool.contains(entt); })); len != 0u) {
+                auto &target = *other.pools.find(curr.first)->second;
+                auto to = result;
+
+                target.reserve(target.size() + len);
+
+                for(auto from = first; from != last; ++from, ++to) {
+                    if(cpool.contains(*from)) {
+                        target.push_move(*to, cpool.value(*from));
+                    }
+                }
+            }
+        }
+
+        destroy(first, last);
+        return true;
+    }
+
+    /**
+     * @brief Freezes or unfreezes a registry.
+     *
+     * A frozen registry doesn't accept structural changes, that is, pools and
+     * groups aren't created, entities aren't created or destroyed and elements
+     * aren't assigned or removed. Any attempt to do so triggers an assertion in
+     * debug mode.<br/>
+     * Instead, views, storage and element access are allowed, as well as
+     * patching or replacing elements. Therefore, systems that don't modify the
+     * same elements can safely run in parallel while a registry is frozen.
+     *
+     * @param value True to freeze the registry, false otherwise.
+     */
+    void freeze(const bool value = true) noexcept {
+        readonly = value;
+    }
+
+    /**
+     * @brief Checks whether a registry is frozen.
+     * @return True if the registry is frozen, false otherwise.
+     */
+    [[nodiscard]] bool frozen() const noexcept {
+        return readonly;
+    }
+
+    /**
+     * @brief Returns the sparse page size imposed on all pools, if any.
+     * @return The sparse page size of all pools, zero if there is none.
+     */
+    [[nodiscard]] size_type sparse_page_size() const noexcept {
+        return paging;
+    }
+
+    /**
+     * @brief Imposes a sparse page size on all pools.
+     *
+     * The sparse arrays of the storage of entities and of all existing pools
+     * are rebuilt with the given page size, as are those of pools created
+     * later on. This overrides the page size of the element types.<br/>
+     * Registries for entities scattered over a wide range of identifiers
+     * benefit from small pages, while dense ranges prefer large ones.
+     *
+     * @param page Number of entries of a sparse page, must be a power of two.
+     */
+    void sparse_page_size(const size_type page) {
+        paging = page;
+        entities.sparse_page_size(page);
+
+        for(auto &&curr: pools) {
+            curr.second->sparse_page_size(page);
+        }
+    }
+
+    /**
+     * @brief Returns a counter that changes whenever the set of pools changes.
+     *
+     * The counter moves forward when a storage is created or discarded, as
+     * well as when the pools change hands between registries. Objects that
+     * cache pointers to the pools of a registry can use it to find out when
+     * their data are stale.
+     *
+     * @return The current layout epoch of the registry.
+     */
+    [[nodiscard]] size_type epoch() const noexcept {
+        return layout;
+    }
+
+    /**
+     * @brief Returns a sink object to be notified when a storage is created.
+     *
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<Entity> &, id_type);
+     * @endcode
+     *
+     * Listeners are invoked after the storage is bound to the registry and
+     * before it's returned to the caller, that is, when it's first touched
+     * through a non-const member function. The storage of entities is created
+     * along with the registry and is never notified.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_storage() noexcept {
+        return sink{created};
+    }
+
+    /**
+     * @brief Returns the memory used by all the pools of a registry.
+     *
+     * The report also includes the storage of entities. To find out how much
+     * memory a single pool uses, refer to its `memory_usage` function instead.
+     *
+     * @return The memory used by all the pools of the registry.
+     */
+    [[nodiscard]] memory_report memory_usage() const noexcept {
+        auto report = entities.memory_usage();
+
+        for(auto &&curr: pools) {
+            report += curr.second->memory_usage();
+        }
+
+        return report;
     }
 
     /**
@@ -483,7 +1045,7 @@ public:
      * @return True if the identifier is valid, false otherwise.
      */
     [[nodiscard]] bool valid(const entity_type entt) const {
-        return static_cast<size_type>(entities.find(entt).index()) < entities.free_list();
+        return static_cast<size_type>(entities.find(stored(entt)).index()) < entities.free_list();
     }
 
     /**
@@ -492,8 +1054,55 @@ public:
      * @return The version for the given identifier if valid, the tombstone
      * version otherwise.
      */
-    [[nodiscard]] version_type current(const entity_type entt) const {
-        return entities.current(entt);
+    [[nodiscard]] version_type current(const entity_type entt) const {
+        return entities.current(entt);
+    }
+
+    /**
+     * @brief Disables an entity without removing its elements.
+     *
+     * The disabled bits of the identifier are set in the entity storage and
+     * nowhere else. Therefore, views that also iterate the entity storage skip
+     * disabled entities, while elements and other pools aren't touched.<br/>
+     * Disabled entities are still valid.
+     *
+     * @warning
+     * Entity traits must provide a non-empty disabled mask.<br/>
+     * Groups don't support disabled entities. Disabling an entity in a
+     * registry that contains groups results in undefined behavior.
+     *
+     * @param entt A valid identifier.
+     */
+    void disable(const entity_type entt) {
+        static_assert(traits_type::disabled_mask != 0u, "Disabled bits not available");
+        ENTT_ASSERT(!readonly, "Frozen registry");
+        ENTT_ASSERT(groups.empty(), "Groups don't support disabled entities");
+        ENTT_ASSERT(valid(entt), "Invalid entity");
+        entities.bump(entity_type{traits_type::to_integral(entt) | traits_type::disabled_mask});
+    }
+
+    /**
+     * @brief Enables a disabled entity.
+     *
+     * @warning
+     * Entity traits must provide a non-empty disabled mask.
+     *
+     * @param entt A valid identifier.
+     */
+    void enable(const entity_type entt) {
+        static_assert(traits_type::disabled_mask != 0u, "Disabled bits not available");
+        ENTT_ASSERT(!readonly, "Frozen registry");
+        ENTT_ASSERT(valid(entt), "Invalid entity");
+        entities.bump(plain(entt));
+    }
+
+    /**
+     * @brief Checks if an entity is valid and enabled.
+     * @param entt An identifier, either valid or not.
+     * @return True if the entity is valid and enabled, false otherwise.
+     */
+    [[nodiscard]] bool enabled(const entity_type entt) const {
+        return valid(entt) && entities.contains(plain(entt));
     }
 
     /**
@@ -501,6 +1110,7 @@ public:
      * @return A valid identifier.
      */
     [[nodiscard]] entity_type create() {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         return entities.generate();
     }
 
@@ -514,6 +1124,7 @@ public:
      * @return A valid identifier.
      */
     [[nodiscard]] entity_type create(const entity_type hint) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         return entities.generate(hint);
     }
 
@@ -528,9 +1139,110 @@ public:
      */
     template<typename It>
     void create(It first, It last) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         entities.generate(std::move(first), std::move(last));
     }
 
+    /**
+     * @brief Assigns each element in a range an identifier and copies the
+     * elements of a given entity to all of them.
+     *
+     * Storage classes are visited once each. They reserve enough space for all
+     * the new entities and then copy the element of the original entity in a
+     * tight loop.
+     *
+     * @warning
+     * Elements that aren't copy constructible aren't assigned to the new
+     * entities.
+     *
+     * @tparam It Type of forward iterator.
+     * @param prefab A valid identifier.
+     * @param first An iterator to the first element of the range to generate.
+     * @param last An iterator past the last element of the range to generate.
+     */
+    template<typename It>
+    void instantiate(const entity_type prefab, It first, It last) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
+        ENTT_ASSERT(valid(prefab), "Invalid entity");
+        const auto len = static_cast<size_type>(std::distance(first, last));
+        const auto copy = [prefab, first, last, len](common_type &cpool) {
+            cpool.reserve(cpool.size() + len);
+            cpool.push(first, last, cpool.value(prefab));
+        };
+
+        entities.generate(first, last);
+
+#ifdef ENTT_USE_COMPONENT_MASK
+        mask.each(static_cast<size_type>(traits_type::to_entity(prefab)), [this, &copy](const size_type slot) { copy(*slots[slot]); });
+
+        for(size_type pos = untracked.size(); pos != 0u; --pos) {
+            if(auto &cpool = *untracked[pos - 1u]; cpool.contains(prefab)) {
+                copy(cpool);
+            }
+        }
+#else
+        // listeners can create pools, new ones don't contain the prefab anyway
+        for(size_type pos{}, end = pools.size(); pos < end; ++pos) {
+            if(auto &cpool = *pools.begin()[static_cast<typename pool_container_type::difference_type>(pos)].second; cpool.contains(prefab)) {
+                copy(cpool);
+            }
+        }
+#endif
+    }
+
+    /**
+     * @brief Reserves an identifier to create later.
+     *
+     * Reserved identifiers are made valid only by the next call to
+     * `materialize`. In the meantime, they can be used with tools such as
+     * command buffers, but not with the registry itself.
+     *
+     * @note
+     * This function is thread safe and can be invoked concurrently from
+     * different threads, as long as entities are neither created nor destroyed
+     * until reserved identifiers are materialized.
+     *
+     * @return A reserved identifier.
+     */
+    [[nodiscard]] entity_type reserve_entity() noexcept {
+        return entities.reserve_entity();
+    }
+
+    /*! @brief Creates all entities whose identifiers have been reserved. */
+    void materialize() {
+        ENTT_ASSERT(!readonly, "Frozen registry");
+        entities.materialize();
+    }
+
+    /**
+     * @brief Hands out a block of new identifiers to create entities from.
+     *
+     * Entities are created from a block without synchronization, so that each
+     * thread can generate its own identifiers with a simple bump. They are
+     * made valid only by releasing the block to the registry.
+     *
+     * @warning
+     * Blocks are acquired and released when no other thread accesses the
+     * registry.
+     *
+     * @param count Number of identifiers to put in the block.
+     * @return A block of identifiers.
+     */
+    [[nodiscard]] auto acquire_block(const size_type count) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
+        return entities.acquire_block(count);
+    }
+
+    /**
+     * @brief Creates the entities generated from a block and gives back the
+     * identifiers that weren't used.
+     * @param block A block of identifiers handed out by the registry.
+     */
+    void release_block(typename storage_for_type<entity_type>::block_type &block) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
+        entities.release_block(block);
+    }
+
     /**
      * @brief Destroys an entity and releases its identifier.
      *
@@ -542,9 +1254,26 @@ public:
      * @return The version of the recycled entity.
      */
     version_type destroy(const entity_type entt) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
+
+        if constexpr(traits_type::disabled_mask != 0u) {
+            if(entt != plain(entt) || !enabled(entt)) {
+                enable(entt);
+                return destroy(plain(entt));
+            }
+        }
+
+#ifdef ENTT_USE_COMPONENT_MASK
+        mask.each(static_cast<size_type>(traits_type::to_entity(entt)), [this, entt](const size_type slot) { slots[slot]->remove(entt); });
+
+        for(size_type pos = untracked.size(); pos != 0u; --pos) {
+            untracked[pos - 1u]->remove(entt);
+        }
+#else
         for(size_type pos = pools.size(); pos != 0u; --pos) {
             pools.begin()[static_cast<typename pool_container_type::difference_type>(pos - 1u)].second->remove(entt);
         }
+#endif
 
         entities.erase(entt);
         return entities.current(entt);
@@ -579,12 +1308,30 @@ public:
      */
     template<typename It>
     void destroy(It first, It last) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
+
+        if constexpr(traits_type::disabled_mask != 0u) {
+            for(auto it = first; it != last; ++it) {
+                if(valid(*it) && !enabled(*it)) {
+                    enable(*it);
+                }
+            }
+        }
+
         const auto to = entities.sort_as(first, last);
         const auto from = entities.cend() - static_cast<typename common_type::difference_type>(entities.free_list());
 
+#ifdef ENTT_USE_COMPONENT_MASK
+        mask.each(from, to, [this, from, to](const size_type slot) { slots[slot]->remove(from, to); });
+
+        for(auto *cpool: untracked) {
+            cpool->remove(from, to);
+        }
+#else
         for(auto &&curr: pools) {
             curr.second->remove(from, to);
         }
+#endif
 
         entities.erase(from, to);
     }
@@ -606,6 +1353,7 @@ public:
      */
     template<typename Type, typename... Args>
     decltype(auto) emplace(const entity_type entt, Args &&...args) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         ENTT_ASSERT(valid(entt), "Invalid entity");
         return assure<Type>().emplace(entt, std::forward<Args>(args)...);
     }
@@ -623,6 +1371,7 @@ public:
      */
     template<typename Type, typename It>
     void insert(It first, It last, const Type &value = {}) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         ENTT_ASSERT(std::all_of(first, last, [this](const auto entt) { return valid(entt); }), "Invalid entity");
         assure<Type>().insert(std::move(first), std::move(last), value);
     }
@@ -641,10 +1390,35 @@ public:
      */
     template<typename Type, typename EIt, typename CIt, typename = std::enable_if_t<std::is_same_v<typename std::iterator_traits<CIt>::value_type, Type>>>
     void insert(EIt first, EIt last, CIt from) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         ENTT_ASSERT(std::all_of(first, last, [this](const auto entt) { return valid(entt); }), "Invalid entity");
         assure<Type>().insert(first, last, from);
     }
 
+    /**
+     * @brief Assigns each entity in a range the element returned by a
+     * generator.
+     *
+     * The generator is invoked once per entity, with the entity as its only
+     * argument. Elements are constructed in place from the returned values.
+     *
+     * @sa emplace
+     *
+     * @tparam Type Type of element to create.
+     * @tparam It Type of input iterator.
+     * @tparam Func Type of generator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param func A valid generator.
+     */
+    template<typename Type, typename It, typename Func>
+    std::enable_if_t<std::is_same_v<std::invoke_result_t<Func &, const entity_type>, Type> || std::is_constructible_v<Type, std::invoke_result_t<Func &, const entity_type>>>
+    insert(It first, It last, Func func) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
+        ENTT_ASSERT(std::all_of(first, last, [this](const auto entt) { return valid(entt); }), "Invalid entity");
+        assure<Type>().insert(std::move(first), std::move(last), std::move(func));
+    }
+
     /**
      * @brief Assigns or replaces the given element for an entity.
      *
@@ -659,6 +1433,7 @@ public:
      */
     template<typename Type, typename... Args>
     decltype(auto) emplace_or_replace(const entity_type entt, Args &&...args) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         auto &cpool = assure<Type>();
         ENTT_ASSERT(valid(entt), "Invalid entity");
         return cpool.contains(entt) ? cpool.patch(entt, [&args...](auto &...curr) { ((curr = Type{std::forward<Args>(args)...}), ...); }) : cpool.emplace(entt, std::forward<Args>(args)...);
@@ -688,6 +1463,33 @@ public:
         return assure<Type>().patch(entt, std::forward<Func>(func)...);
     }
 
+    /**
+     * @brief Patches a data member of the given element for an entity.
+     *
+     * The signature of the function should be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(Member &);
+     * @endcode
+     *
+     * Only the listeners of the data member and those of the whole element are
+     * notified.
+     *
+     * @warning
+     * Attempting to patch an element of an entity that doesn't own it results
+     * in undefined behavior.
+     *
+     * @tparam Member Data member to patch.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the patched element.
+     */
+    template<auto Member, typename... Func>
+    decltype(auto) patch(const entity_type entt, Func &&...func) {
+        return assure<member_class_t<decltype(Member)>>().template patch<Member>(entt, std::forward<Func>(func)...);
+    }
+
     /**
      * @brief Replaces the given element for an entity.
      *
@@ -708,6 +1510,27 @@ public:
         return patch<Type>(entt, [&args...](auto &...curr) { ((curr = Type{std::forward<Args>(args)...}), ...); });
     }
 
+    /**
+     * @brief Replaces a data member of the given element for an entity.
+     *
+     * Listeners aren't notified if the data member is equality comparable and
+     * already compares equal to the given value.
+     *
+     * @warning
+     * Attempting to replace an element of an entity that doesn't own it results
+     * in undefined behavior.
+     *
+     * @tparam Member Data member to replace.
+     * @tparam Value Type of value to assign to the data member.
+     * @param entt A valid identifier.
+     * @param value The value to assign to the data member.
+     * @return A reference to the element.
+     */
+    template<auto Member, typename Value>
+    decltype(auto) replace(const entity_type entt, Value &&value) {
+        return assure<member_class_t<decltype(Member)>>().template replace<Member>(entt, std::forward<Value>(value));
+    }
+
     /**
      * @brief Removes the given elements from an entity.
      * @tparam Type Type of element to remove.
@@ -717,6 +1540,7 @@ public:
      */
     template<typename Type, typename... Other>
     size_type remove(const entity_type entt) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         return (assure<Type>().remove(entt) + ... + assure<Other>().remove(entt));
     }
 
@@ -734,6 +1558,7 @@ public:
      */
     template<typename Type, typename... Other, typename It>
     size_type remove(It first, It last) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         size_type count{};
 
         if constexpr(std::is_same_v<It, typename common_type::iterator>) {
@@ -771,6 +1596,7 @@ public:
      */
     template<typename Type, typename... Other>
     void erase(const entity_type entt) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         (assure<Type>().erase(entt), (assure<Other>().erase(entt), ...));
     }
 
@@ -787,6 +1613,7 @@ public:
      */
     template<typename Type, typename... Other, typename It>
     void erase(It first, It last) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         if constexpr(std::is_same_v<It, typename common_type::iterator>) {
             std::array cpools{static_cast<common_type *>(&assure<Type>()), static_cast<common_type *>(&assure<Other>())...};
 
@@ -823,6 +1650,7 @@ public:
      */
     template<typename Func>
     void erase_if(const entity_type entt, Func func) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         for(auto [id, cpool]: storage()) {
             if(cpool.contains(entt) && func(id, std::as_const(cpool))) {
                 cpool.erase(entt);
@@ -837,6 +1665,7 @@ public:
      */
     template<typename... Type>
     void compact() {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         if constexpr(sizeof...(Type) == 0u) {
             for(auto &&curr: pools) {
                 curr.second->compact();
@@ -846,6 +1675,114 @@ public:
         }
     }
 
+    /**
+     * @brief Renumbers live entities into a compact range of indices.
+     *
+     * Entities are renamed in all pools, elements retain their positions. The
+     * function object is invoked once per renumbered entity, so that the
+     * identifiers held elsewhere can be updated. Its signature is equivalent
+     * to the following:
+     *
+     * @code{.cpp}
+     * void(const Entity from, const Entity to);
+     * @endcode
+     *
+     * Sparse pages that are no longer in use are released by the next call to
+     * `shrink_to_fit` on the storage classes.
+     *
+     * @warning
+     * Storage classes that keep identifiers in their elements or aside from
+     * their sparse sets, such as hierarchies or indexes, aren't updated.
+     *
+     * @sa basic_storage<Entity, Entity, Allocator>::defragment
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void defragment(Func func) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
+        entities.defragment([this, &func](const entity_type from, const entity_type to) {
+            for(auto &&curr: pools) {
+                if(curr.second->contains(from)) {
+                    curr.second->rename(from, to);
+                }
+            }
+
+#ifdef ENTT_USE_COMPONENT_MASK
+            for(size_type slot{}, last = slots.size(); slot < last; ++slot) {
+                if(slots[slot] != nullptr && slots[slot]->contains(to)) {
+                    mask.set(slot, static_cast<size_type>(traits_type::to_entity(to)));
+                    mask.reset(slot, static_cast<size_type>(traits_type::to_entity(from)));
+                }
+            }
+#endif
+
+            func(from, to);
+        });
+    }
+
+    /**
+     * @brief Renumbers live entities into a compact range of indices.
+     * @sa defragment
+     * @return A table that maps renumbered entities to their new identifiers.
+     */
+    [[nodiscard]] auto defragment() {
+        dense_map<entity_type, entity_type, std::hash<entity_type>, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const entity_type, entity_type>>> table{get_allocator()};
+        defragment([&table](const entity_type from, const entity_type to) { table.emplace(from, to); });
+        return table;
+    }
+
+    /**
+     * @brief Releases unused memory, possibly over multiple calls.
+     *
+     * The storage of entities, all pools along with their signals, the groups
+     * and the context are trimmed one by one, starting from where the previous
+     * call left off. At least one of them is trimmed on each call, no matter
+     * the budget. This way, the cost of returning memory is spread over time
+     * and can be paid during idle frames.
+     *
+     * @tparam Rep Type of the number of ticks of the budget.
+     * @tparam Period Type of the tick period of the budget.
+     * @param budget Maximum amount of time to spend trimming the registry.
+     * @return True if the whole registry has been trimmed, false otherwise.
+     */
+    template<typename Rep, typename Period>
+    bool trim(const std::chrono::duration<Rep, Period> budget) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
+        const auto from = std::chrono::steady_clock::now();
+
+        for(auto first = true; trimmed < (pools.size() + groups.size() + 2u); ++trimmed, first = false) {
+            if(!first && (std::chrono::steady_clock::now() - from) >= budget) {
+                return false;
+            }
+
+            if(trimmed == 0u) {
+                entities.shrink_to_fit();
+            } else if(const auto pos = trimmed - 1u; pos < pools.size()) {
+                pools.begin()[static_cast<typename pool_container_type::difference_type>(pos)].second->shrink_to_fit();
+            } else if(const auto elem = pos - pools.size(); elem < groups.size()) {
+                groups.begin()[static_cast<typename group_container_type::difference_type>(elem)].second->shrink_to_fit();
+            } else {
+                vars.shrink_to_fit();
+                pools.shrink_to_fit();
+                groups.shrink_to_fit();
+                created.shrink_to_fit();
+            }
+        }
+
+        trimmed = 0u;
+        return true;
+    }
+
+    /**
+     * @brief Releases all unused memory at once.
+     * @sa trim
+     */
+    void trim() {
+        trim((std::chrono::nanoseconds::max)());
+    }
+
     /**
      * @brief Check if an entity is part of all the given storage.
      * @tparam Type Type of storage to check for.
@@ -856,6 +1793,12 @@ public:
     [[nodiscard]] bool all_of([[maybe_unused]] const entity_type entt) const {
         if constexpr(sizeof...(Type) == 1u) {
             auto *cpool = assure<std::remove_const_t<Type>...>();
+#ifdef ENTT_USE_COMPONENT_MASK
+            if constexpr(internal::is_sigh_mixin<std::remove_const_t<std::remove_pointer_t<decltype(cpool)>>>::value) {
+                // identifiers with the same index share their bits, hits are confirmed by the pool
+                return cpool && mask.test(cpool->mask_slot, static_cast<size_type>(traits_type::to_entity(entt))) && cpool->contains(entt);
+            }
+#endif
             return cpool && cpool->contains(entt);
         } else {
             return (all_of<Type>(entt) && ...);
@@ -921,6 +1864,7 @@ public:
      */
     template<typename Type, typename... Args>
     [[nodiscard]] decltype(auto) get_or_emplace(const entity_type entt, Args &&...args) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         auto &cpool = assure<Type>();
         ENTT_ASSERT(valid(entt), "Invalid entity");
         return cpool.contains(entt) ? cpool.get(entt) : cpool.emplace(entt, std::forward<Args>(args)...);
@@ -962,6 +1906,7 @@ public:
      */
     template<typename... Type>
     void clear() {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         if constexpr(sizeof...(Type) == 0u) {
             for(size_type pos = pools.size(); pos; --pos) {
                 pools.begin()[static_cast<typename pool_container_type::difference_type>(pos - 1u)].second->clear();
@@ -980,7 +1925,13 @@ public:
      * @return True if the entity has no elements assigned, false otherwise.
      */
     [[nodiscard]] bool orphan(const entity_type entt) const {
+#ifdef ENTT_USE_COMPONENT_MASK
+        bool found = std::any_of(untracked.cbegin(), untracked.cend(), [entt](auto *cpool) { return cpool->contains(entt); });
+        mask.each(static_cast<size_type>(traits_type::to_entity(entt)), [this, entt, &found](const size_type slot) { found = found || slots[slot]->contains(entt); });
+        return !found;
+#else
         return std::none_of(pools.cbegin(), pools.cend(), [entt](auto &&curr) { return curr.second->contains(entt); });
+#endif
     }
 
     /**
@@ -1031,6 +1982,22 @@ public:
         return assure<Type>(id).on_update();
     }
 
+    /**
+     * @brief Returns a sink object for the given data member.
+     *
+     * Use this function to receive notifications whenever a data member of an
+     * element is updated, either on its own or along with the whole element.
+     *
+     * @sa on_update
+     *
+     * @tparam Member Data member of which to get the sink.
+     * @return A temporary sink object.
+     */
+    template<auto Member>
+    [[nodiscard]] auto on_update() {
+        return assure<member_class_t<decltype(Member)>>().template on_update<Member>();
+    }
+
     /**
      * @brief Returns a sink object for the given element.
      *
@@ -1055,6 +2022,59 @@ public:
         return assure<Type>(id).on_destroy();
     }
 
+    /**
+     * @brief Returns a sink object for bulk notifications of the given
+     * element.
+     *
+     * Use this function to receive notifications whenever new instances of the
+     * given element are created and assigned to entities. Range operations
+     * result in a single notification for all the entities involved.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<Entity> &, const Entity *, std::size_t);
+     * @endcode
+     *
+     * Listeners are invoked **after** assigning the elements to the entities.
+     *
+     * @sa sink
+     *
+     * @tparam Type Type of element of which to get the sink.
+     * @param id Optional name used to map the storage within the registry.
+     * @return A temporary sink object.
+     */
+    template<typename Type>
+    [[nodiscard]] auto on_bulk_construct(const id_type id = type_hash<Type>::value()) {
+        return assure<Type>(id).on_bulk_construct();
+    }
+
+    /**
+     * @brief Returns a sink object for bulk notifications of the given
+     * element.
+     *
+     * Use this function to receive notifications whenever instances of the
+     * given element are removed from entities and thus destroyed. Range
+     * operations result in a single notification for all the entities
+     * involved.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(basic_registry<Entity> &, const Entity *, std::size_t);
+     * @endcode
+     *
+     * Listeners are invoked **before** removing the elements from the entities.
+     *
+     * @sa sink
+     *
+     * @tparam Type Type of element of which to get the sink.
+     * @param id Optional name used to map the storage within the registry.
+     * @return A temporary sink object.
+     */
+    template<typename Type>
+    [[nodiscard]] auto on_bulk_destroy(const id_type id = type_hash<Type>::value()) {
+        return assure<Type>(id).on_bulk_destroy();
+    }
+
     /**
      * @brief Returns a view for the given elements.
      * @tparam Type Type of element used to construct the view.
@@ -1079,6 +2099,11 @@ public:
 
     /**
      * @brief Returns a group for the given elements.
+     *
+     * @warning
+     * Groups don't support disabled entities. Creating a group while some
+     * entities are disabled results in undefined behavior.
+     *
      * @tparam Owned Types of storage _owned_ by the group.
      * @tparam Get Types of storage _observed_ by the group, if any.
      * @tparam Exclude Types of storage used to filter the group, if any.
@@ -1087,24 +2112,39 @@ public:
     template<typename... Owned, typename... Get, typename... Exclude>
     basic_group<owned_t<storage_for_type<Owned>...>, get_t<storage_for_type<Get>...>, exclude_t<storage_for_type<Exclude>...>>
     group(get_t<Get...> = get_t{}, exclude_t<Exclude...> = exclude_t{}) {
-        using group_type = basic_group<owned_t<storage_for_type<Owned>...>, get_t<storage_for_type<Get>...>, exclude_t<storage_for_type<Exclude>...>>;
-        using handler_type = typename group_type::handler;
-
-        if(auto it = groups.find(group_type::group_id()); it != groups.cend()) {
-            return {*std::static_pointer_cast<handler_type>(it->second)};
-        }
-
-        std::shared_ptr<handler_type> handler{};
-
-        if constexpr(sizeof...(Owned) == 0u) {
-            handler = std::allocate_shared<handler_type>(get_allocator(), get_allocator(), std::forward_as_tuple(assure<std::remove_const_t<Get>>()...), std::forward_as_tuple(assure<std::remove_const_t<Exclude>>()...));
-        } else {
-            handler = std::allocate_shared<handler_type>(get_allocator(), std::forward_as_tuple(assure<std::remove_const_t<Owned>>()..., assure<std::remove_const_t<Get>>()...), std::forward_as_tuple(assure<std::remove_const_t<Exclude>>()...));
-            ENTT_ASSERT(std::all_of(groups.cbegin(), groups.cend(), [](const auto &data) { return !(data.second->owned(type_id<Owned>().hash()) || ...); }), "Conflicting groups");
-        }
+        return group_or_emplace<Owned...>(get_t<Get...>{}, exclude_t<Exclude...>{});
+    }
 
-        groups.emplace(group_type::group_id(), handler);
-        return {*handler};
+    /**
+     * @brief Returns a group for the given elements and splits its initial
+     * construction among the jobs of an executor, if required.
+     *
+     * When the group doesn't exist yet, the range of the leading owned storage
+     * is split in contiguous chunks. The executor is invoked once with the
+     * number of chunks and a job to run for each of them, as it happens with
+     * views:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, Job job);
+     * @endcode
+     *
+     * Jobs only test entities for membership and can run concurrently. The
+     * owned storage are then arranged with a single pass each on the calling
+     * thread, once the executor returns.
+     *
+     * @tparam Owned Types of storage _owned_ by the group.
+     * @tparam Get Types of storage _observed_ by the group, if any.
+     * @tparam Exclude Types of storage used to filter the group, if any.
+     * @tparam Exec Type of the executor to use to run the jobs.
+     * @param exec A valid executor.
+     * @param grain Maximum number of entities per chunk.
+     * @return A newly created group.
+     */
+    template<typename... Owned, typename... Get, typename... Exclude, typename Exec>
+    basic_group<owned_t<storage_for_type<Owned>...>, get_t<storage_for_type<Get>...>, exclude_t<storage_for_type<Exclude>...>>
+    group(Exec &&exec, const size_type grain, get_t<Get...> = get_t{}, exclude_t<Exclude...> = exclude_t{}) {
+        static_assert(sizeof...(Owned) != 0u, "Owned types required");
+        return group_or_emplace<Owned...>(get_t<Get...>{}, exclude_t<Exclude...>{}, std::forward<Exec>(exec), grain);
     }
 
     /*! @copydoc group */
@@ -1167,6 +2207,7 @@ public:
      */
     template<typename Type, typename Compare, typename Sort = std_sort, typename... Args>
     void sort(Compare compare, Sort algo = Sort{}, Args &&...args) {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         ENTT_ASSERT(!owned<Type>(), "Cannot sort owned storage");
         auto &cpool = assure<Type>();
 
@@ -1193,6 +2234,7 @@ public:
      */
     template<typename To, typename From>
     void sort() {
+        ENTT_ASSERT(!readonly, "Frozen registry");
         ENTT_ASSERT(!owned<To>(), "Cannot sort owned storage");
         const base_type &cpool = assure<From>();
         assure<To>().sort_as(cpool.begin(), cpool.end());
@@ -1212,10 +2254,94 @@ public:
     }
 
 private:
+    template<typename... Owned, typename... Get, typename... Exclude, typename... Args>
+    basic_group<owned_t<storage_for_type<Owned>...>, get_t<storage_for_type<Get>...>, exclude_t<storage_for_type<Exclude>...>>
+    group_or_emplace(get_t<Get...>, exclude_t<Exclude...>, [[maybe_unused]] Args &&...args) {
+        using group_type = basic_group<owned_t<storage_for_type<Owned>...>, get_t<storage_for_type<Get>...>, exclude_t<storage_for_type<Exclude>...>>;
+        using handler_type = typename group_type::handler;
+
+        if(auto it = groups.find(group_type::group_id()); it != groups.cend()) {
+            return {*std::static_pointer_cast<handler_type>(it->second)};
+        }
+
+        ENTT_ASSERT(!readonly, "Frozen registry");
+        ENTT_ASSERT(!any_disabled(), "Groups don't support disabled entities");
+        std::shared_ptr<handler_type> handler{};
+
+        if constexpr(sizeof...(Owned) == 0u) {
+            handler = std::allocate_shared<handler_type>(get_allocator(), get_allocator(), std::forward_as_tuple(assure<std::remove_const_t<Get>>()...), std::forward_as_tuple(assure<std::remove_const_t<Exclude>>()...));
+        } else {
+            constexpr auto size = sizeof...(Owned) + sizeof...(Get) + sizeof...(Exclude);
+            size_type depth{size};
+            bool nested{};
+            bool leaf{true};
+
+            for(auto &&data: groups) {
+                const auto curr = data.second->size();
+                depth = (std::max)(depth, curr);
+
+                if(const auto overlap = (0u + ... + data.second->owned(type_id<Owned>().hash())); overlap != 0u) {
+                    [[maybe_unused]] const auto shared = overlap + (0u + ... + data.second->get(type_id<Get>().hash())) + (0u + ... + data.second->exclude(type_id<Exclude>().hash()));
+                    ENTT_ASSERT((shared == size) || (shared == curr), "Conflicting groups");
+                    leaf = leaf && !(size < curr);
+                    nested = true;
+
+                    if(curr < size) {
+                        data.second->nest();
+                    }
+                }
+            }
+
+            handler = std::allocate_shared<handler_type>(get_allocator(), std::forward_as_tuple(assure<std::remove_const_t<Owned>>()..., assure<std::remove_const_t<Get>>()...), std::forward_as_tuple(assure<std::remove_const_t<Exclude>>()...), std::forward<Args>(args)...);
+            groups.emplace(group_type::group_id(), handler);
+
+            if(!leaf) {
+                handler->nest();
+            }
+
+            if(nested) {
+                // less restrictive groups push entities first and remove them last
+                for(auto curr = depth; curr; --curr) {
+                    for(auto &&data: groups) {
+                        if(data.second->size() == curr) {
+                            data.second->reconnect(true);
+                        }
+                    }
+                }
+
+                for(size_type curr{1u}; curr <= depth; ++curr) {
+                    for(auto &&data: groups) {
+                        if(data.second->size() == curr) {
+                            data.second->reconnect(false);
+                        }
+                    }
+                }
+            }
+
+            return {*handler};
+        }
+
+        groups.emplace(group_type::group_id(), handler);
+        return {*handler};
+    }
+
     context vars;
     pool_container_type pools;
+#ifdef ENTT_USE_TYPE_INDEX
+    index_container_type indexed;
+#endif
+#ifdef ENTT_USE_COMPONENT_MASK
+    internal::registry_mask<allocator_type> mask;
+    slot_container_type slots;
+    slot_container_type untracked;
+#endif
     group_container_type groups;
     storage_for_type<entity_type> entities;
+    sigh_type created;
+    size_type trimmed;
+    size_type layout;
+    size_type paging;
+    bool readonly;
 };
 
 } // namespace entt
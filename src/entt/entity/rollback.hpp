@@ -0,0 +1,321 @@
+#ifndef ENTT_ENTITY_ROLLBACK_HPP
+#define ENTT_ENTITY_ROLLBACK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "component.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+template<typename>
+struct is_page_copyable: std::false_type {};
+
+template<typename Type, typename Entity, typename Allocator>
+struct is_page_copyable<dirty_mixin<basic_storage<Type, Entity, Allocator>>>
+    : std::bool_constant<std::is_trivially_copyable_v<Type> && !std::uses_allocator_v<Type, Allocator> && !component_traits<Type, Entity>::in_place_delete> {};
+
+template<typename Type, typename Registry>
+struct is_page_copyable<basic_sigh_mixin<Type, Registry>>: is_page_copyable<Type> {};
+
+template<typename Allocator>
+struct rollback_pages {
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    rollback_pages(const Allocator &allocator)
+        : flags{allocator},
+          pages{allocator} {}
+
+    void mark(const std::size_t page) {
+        if(!(page < flags.size())) {
+            flags.resize(page + 1u);
+        }
+
+        if(!flags[page]) {
+            flags[page] = true;
+            pages.push_back(page);
+        }
+    }
+
+    void clear() noexcept {
+        for(const auto page: pages) {
+            flags[page] = false;
+        }
+
+        pages.clear();
+        full = false;
+    }
+
+    std::vector<bool, typename alloc_traits::template rebind_alloc<bool>> flags;
+    std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>> pages;
+    // states never saved or restored yet require a full copy
+    bool full{true};
+};
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Ring buffer of registry states.
+ *
+ * A rollback keeps the states of a registry for the last frames in a ring
+ * buffer of fixed length, so that the registry can go back in time and replay
+ * frames from there (as it happens with rollback netcode).<br/>
+ * States are copied through the `deep_copy_from` function of the registry. Pages
+ * are reused from one frame to the next and trivially copyable elements are
+ * copied one page at a time.<br/>
+ * Storage classes that track their dirty pages (see `dirty_mixin`) and contain
+ * trivially copyable elements are copied by page-granular deltas instead. Only
+ * the pages changed since a state was last saved or restored are copied, so
+ * that saving and restoring a frame cost in proportion to the changed pages.
+ *
+ * @warning
+ * The pools of the source registry must be prepared in advance through the
+ * `prepare` function. Groups are not supported in the source registry.<br/>
+ * Dirty pages of the storage classes copied by deltas are collected and
+ * cleaned by the rollback on every save and restore. Cleaning them elsewhere
+ * in the meantime results in undefined behavior.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_rollback final {
+    using alloc_traits = std::allocator_traits<typename Registry::allocator_type>;
+    using pages_type = internal::rollback_pages<typename Registry::allocator_type>;
+    using common_type = typename Registry::common_type;
+
+    struct delta_pool {
+        id_type id;
+        void (*collect)(Registry &, std::vector<pages_type, typename alloc_traits::template rebind_alloc<pages_type>> &, const std::size_t);
+        void (*copy)(common_type &, const common_type &, const pages_type &);
+        std::vector<pages_type, typename alloc_traits::template rebind_alloc<pages_type>> pending;
+    };
+
+    template<typename Type>
+    static void collect_pages(Registry &source, std::vector<pages_type, typename alloc_traits::template rebind_alloc<pages_type>> &pending, const std::size_t skip) {
+        auto &pool = source.template storage<Type>();
+
+        // all states (but the one skipped, if any) are now behind the registry on these pages
+        pool.each_dirty([&pending, skip](const std::size_t page, const auto *, const std::size_t) {
+            for(std::size_t pos{}, last = pending.size(); pos < last; ++pos) {
+                if(pos != skip) {
+                    pending[pos].mark(page);
+                }
+            }
+        });
+
+        pool.clean();
+    }
+
+    template<typename Type>
+    static void copy_pages(common_type &to, const common_type &from, const pages_type &delta) {
+        using storage_type = typename Registry::template storage_for_type<Type>;
+        static_cast<storage_type &>(to).copy_pages_from(static_cast<const storage_type &>(from), delta.pages.cbegin(), delta.pages.cend());
+    }
+
+    [[nodiscard]] auto slot(const std::uint64_t frame) const noexcept {
+        return static_cast<std::size_t>(frame % states.size());
+    }
+
+    void copy(Registry &to, const Registry &from, const std::size_t pos) {
+        for(auto &&elem: delta) {
+            elem.collect(*owner, elem.pending, states.size());
+        }
+
+        to.deep_copy_from(from, [this, pos](const id_type id, common_type &lhs, const common_type &rhs) {
+            for(auto &&elem: delta) {
+                if(elem.id == id) {
+                    auto &pages = elem.pending[pos];
+                    pages.full ? lhs.deep_copy_from(rhs) : elem.copy(lhs, rhs, pages);
+                    pages.clear();
+                    return true;
+                }
+            }
+
+            return false;
+        });
+
+        if(&to == owner) {
+            // pages copied into the registry are already up to date in the restored state
+            for(auto &&elem: delta) {
+                elem.collect(*owner, elem.pending, pos);
+            }
+        }
+    }
+
+public:
+    /*! @brief Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Frame identifier type. */
+    using frame_type = std::uint64_t;
+
+    /**
+     * @brief Constructs a rollback for a given registry.
+     * @param source A valid reference to a registry.
+     * @param length Number of frames to keep, at least one.
+     */
+    basic_rollback(registry_type &source, const size_type length)
+        : owner{&source},
+          states{},
+          frames(length),
+          delta{} {
+        ENTT_ASSERT(length != 0u, "Invalid length");
+        states.reserve(length);
+
+        for(size_type pos{}; pos < length; ++pos) {
+            states.emplace_back(source.get_allocator());
+        }
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_rollback(const basic_rollback &) = delete;
+
+    /*! @brief Default move constructor. */
+    basic_rollback(basic_rollback &&) noexcept = default;
+
+    /*! @brief Default destructor. */
+    ~basic_rollback() = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This rollback.
+     */
+    basic_rollback &operator=(const basic_rollback &) = delete;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This rollback.
+     */
+    basic_rollback &operator=(basic_rollback &&) noexcept = default;
+
+    /**
+     * @brief Creates in advance the pools for the given elements in all the
+     * states, if missing.
+     * @tparam Type Types of elements for which to create the pools.
+     * @return A reference to this object.
+     */
+    template<typename... Type>
+    basic_rollback &prepare() {
+        for(auto &&elem: states) {
+            elem.template prepare<Type...>();
+        }
+
+        (track<Type>(), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Returns the number of frames a rollback can keep.
+     * @return Number of frames a rollback can keep.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return states.size();
+    }
+
+    /**
+     * @brief Saves the state of the registry for a given frame.
+     *
+     * The state of the frame that occupied the same slot in the ring buffer,
+     * if any, is discarded.
+     *
+     * @param frame A frame identifier.
+     */
+    void save(const frame_type frame) {
+        const auto pos = slot(frame);
+        frames[pos].reset();
+        copy(states[pos], *owner, pos);
+        frames[pos] = frame;
+    }
+
+    /**
+     * @brief Checks if the state of a given frame is available.
+     * @param frame A frame identifier.
+     * @return True if the state of the frame is available, false otherwise.
+     */
+    [[nodiscard]] bool contains(const frame_type frame) const noexcept {
+        return (frames[slot(frame)] == frame);
+    }
+
+    /**
+     * @brief Restores the state of the registry for a given frame.
+     *
+     * The states of the frames that follow the restored one are discarded,
+     * since they are no longer valid.
+     *
+     * @param frame A frame identifier.
+     */
+    void restore(const frame_type frame) {
+        ENTT_ASSERT(contains(frame), "Frame not available");
+        const auto pos = slot(frame);
+        copy(*owner, states[pos], pos);
+
+        for(auto &&elem: frames) {
+            if(elem && (*elem > frame)) {
+                elem.reset();
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the state of a given frame.
+     *
+     * The state can be persisted with a snapshot, like any other registry.
+     *
+     * @param frame A frame identifier.
+     * @return The state of the given frame.
+     */
+    [[nodiscard]] const registry_type &at(const frame_type frame) const noexcept {
+        ENTT_ASSERT(contains(frame), "Frame not available");
+        return states[slot(frame)];
+    }
+
+    /*! @brief Discards all the saved frames. */
+    void clear() noexcept {
+        for(auto &&elem: frames) {
+            elem.reset();
+        }
+    }
+
+private:
+    template<typename Type>
+    void track() {
+        using storage_type = typename registry_type::template storage_for_type<std::remove_const_t<Type>>;
+
+        if constexpr(internal::is_page_copyable<storage_type>::value) {
+            const auto id = type_hash<std::remove_const_t<Type>>::value();
+            bool found{};
+
+            for(auto &&elem: delta) {
+                found = found || (elem.id == id);
+            }
+
+            if(!found) {
+                auto &elem = delta.emplace_back(delta_pool{id, &collect_pages<std::remove_const_t<Type>>, &copy_pages<std::remove_const_t<Type>>, {}});
+                elem.pending.resize(states.size(), pages_type{owner->get_allocator()});
+            }
+        }
+    }
+
+    registry_type *owner;
+    std::vector<registry_type> states;
+    std::vector<std::optional<frame_type>> frames;
+    std::vector<delta_pool> delta;
+};
+
+} // namespace entt
+
+#endif
@@ -2,6 +2,7 @@
 #define ENTT_ENTITY_RUNTIME_VIEW_HPP
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <iterator>
 #include <utility>
@@ -125,6 +126,7 @@ class basic_runtime_view {
     using alloc_traits = std::allocator_traits<Allocator>;
     static_assert(std::is_same_v<typename alloc_traits::value_type, Type *>, "Invalid value type");
     using container_type = std::vector<Type *, Allocator>;
+    using size_container_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
 
     [[nodiscard]] auto offset() const noexcept {
         ENTT_ASSERT(!pools.empty(), "Invalid view");
@@ -132,6 +134,39 @@ class basic_runtime_view {
         return (leading.policy() == deletion_policy::swap_only) ? leading.free_list() : leading.size();
     }
 
+    template<typename It, typename Func>
+    void each_batch(It first, const It last, Func &func) const {
+        // small enough to live on the stack, large enough to make a pass over a pool worth it
+        static constexpr size_type batch = 64u;
+        const bool tombstone_check = (pools.size() == 1u && pools.front()->policy() == deletion_policy::in_place);
+        std::array<entity_type, batch> buffer{};
+
+        while(first != last) {
+            auto end = buffer.begin();
+
+            for(; first != last && end != buffer.end(); ++first) {
+                if(!tombstone_check || *first != tombstone) {
+                    *(end++) = *first;
+                }
+            }
+
+            // one pool at a time, so as to stay on the same sparse array while filtering
+            for(auto it = ++pools.cbegin(), to = pools.cend(); it != to && end != buffer.begin(); ++it) {
+                end = std::remove_if(buffer.begin(), end, [cpool = *it](const auto entt) { return !cpool->contains(entt); });
+            }
+
+            for(auto it = filter.cbegin(), to = filter.cend(); it != to && end != buffer.begin(); ++it) {
+                if(const auto *cpool = *it; cpool) {
+                    end = std::remove_if(buffer.begin(), end, [cpool](const auto entt) { return cpool->contains(entt); });
+                }
+            }
+
+            for(auto it = buffer.begin(); it != end; ++it) {
+                func(*it);
+            }
+        }
+    }
+
 public:
     /*! @brief Allocator type. */
     using allocator_type = Allocator;
@@ -156,7 +191,8 @@ public:
      */
     explicit basic_runtime_view(const allocator_type &allocator)
         : pools{allocator},
-          filter{allocator} {}
+          filter{allocator},
+          plan{allocator} {}
 
     /*! @brief Default copy constructor. */
     basic_runtime_view(const basic_runtime_view &) = default;
@@ -168,7 +204,8 @@ public:
      */
     basic_runtime_view(const basic_runtime_view &other, const allocator_type &allocator)
         : pools{other.pools, allocator},
-          filter{other.filter, allocator} {}
+          filter{other.filter, allocator},
+          plan{other.plan, allocator} {}
 
     /*! @brief Default move constructor. */
     basic_runtime_view(basic_runtime_view &&) noexcept = default;
@@ -180,7 +217,8 @@ public:
      */
     basic_runtime_view(basic_runtime_view &&other, const allocator_type &allocator)
         : pools{std::move(other.pools), allocator},
-          filter{std::move(other.filter), allocator} {}
+          filter{std::move(other.filter), allocator},
+          plan{std::move(other.plan), allocator} {}
 
     /*! @brief Default destructor. */
     ~basic_runtime_view() = default;
@@ -205,6 +243,7 @@ public:
         using std::swap;
         swap(pools, other.pools);
         swap(filter, other.filter);
+        swap(plan, other.plan);
     }
 
     /**
@@ -219,6 +258,7 @@ public:
     void clear() {
         pools.clear();
         filter.clear();
+        plan.clear();
     }
 
     /**
@@ -246,6 +286,49 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Reorders the storage objects of a view to speed up iterations.
+     *
+     * The smallest storage leads the iteration, while the others are tested
+     * in ascending order of size. Storage objects used as filters are tested
+     * in descending order of size instead. In both cases, those that are more
+     * likely to reject an entity are tested first.<br/>
+     * The sizes of all storage objects are recorded along with the order and
+     * the view isn't reordered again until one of them changes by more than
+     * the given fraction, or storage objects are added to the view.
+     *
+     * @param ratio Relative change in size that requires a reorder.
+     * @return True if the view has been reordered, false otherwise.
+     */
+    bool refresh(const float ratio = 0.f) {
+        const auto length = pools.size() + filter.size();
+        bool dirty = (plan.size() != length);
+
+        for(size_type pos{}; !dirty && pos < length; ++pos) {
+            const auto *elem = (pos < pools.size()) ? pools[pos] : filter[pos - pools.size()];
+            const auto curr = static_cast<float>(elem ? elem->size() : size_type{});
+            const auto prev = static_cast<float>(plan[pos]);
+            dirty = ((curr < prev) ? (prev - curr) : (curr - prev)) > (prev * ratio);
+        }
+
+        if(dirty) {
+            auto size_of = [](const auto *elem) { return elem ? elem->size() : size_type{}; };
+            std::stable_sort(pools.begin(), pools.end(), [&size_of](const auto *lhs, const auto *rhs) { return size_of(lhs) < size_of(rhs); });
+            std::stable_sort(filter.begin(), filter.end(), [&size_of](const auto *lhs, const auto *rhs) { return size_of(rhs) < size_of(lhs); });
+            plan.clear();
+
+            for(const auto *elem: pools) {
+                plan.push_back(size_of(elem));
+            }
+
+            for(const auto *elem: filter) {
+                plan.push_back(size_of(elem));
+            }
+        }
+
+        return dirty;
+    }
+
     /**
      * @brief Estimates the number of entities iterated by the view.
      * @return Estimated number of entities iterated by the view.
@@ -317,9 +400,57 @@ public:
         }
     }
 
+    /**
+     * @brief Splits the range of the leading storage in contiguous chunks and
+     * hands them to an executor, which in turn applies the given function
+     * object to the entities of each chunk.
+     *
+     * The executor is invoked once with the number of chunks and a job to run
+     * for each of them. Its signature must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, Job job);
+     * @endcode
+     *
+     * The executor must invoke `job` once for each value in `[0, count)`,
+     * possibly concurrently, and return only when all the chunks have been
+     * processed.<br/>
+     * Within a chunk, entities are filtered in small batches, one storage at
+     * a time, rather than one entity at a time. Entities are then returned in
+     * the same order as `each` does. The signature of the function is the same
+     * required by `each`.
+     *
+     * @warning
+     * The function object can be invoked concurrently from different threads.
+     * Modifying the storage iterated by the view during iterations results in
+     * undefined behavior.
+     *
+     * @tparam Exec Type of the executor to use to run the jobs.
+     * @tparam Func Type of the function object to invoke.
+     * @param exec A valid executor.
+     * @param grain Maximum number of entities per chunk.
+     * @param func A valid function object.
+     */
+    template<typename Exec, typename Func>
+    void each_chunked(Exec &&exec, const size_type grain, Func func) const {
+        ENTT_ASSERT(grain != 0u, "Invalid grain size");
+
+        if(!pools.empty()) {
+            const auto len = offset();
+            const auto first = pools.front()->end() - static_cast<difference_type>(len);
+
+            std::forward<Exec>(exec)((len + grain - 1u) / grain, [this, &func, first, len, grain](const size_type chunk) {
+                const auto pos = chunk * grain;
+                const auto from = first + static_cast<difference_type>(pos);
+                each_batch(from, from + static_cast<difference_type>((std::min)(grain, len - pos)), func);
+            });
+        }
+    }
+
 private:
     container_type pools;
     container_type filter;
+    size_container_type plan;
 };
 
 } // namespace entt
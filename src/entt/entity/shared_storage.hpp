@@ -0,0 +1,831 @@
+#ifndef ENTT_ENTITY_SHARED_STORAGE_HPP
+#define ENTT_ENTITY_SHARED_STORAGE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/iterator.hpp"
+#include "../core/memory.hpp"
+#include "../core/type_info.hpp"
+#include "../core/utility.hpp"
+#include "component.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "sparse_set.hpp"
+#include "storage.hpp"
+
+namespace entt {
+
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+template<typename Type>
+struct shared_node {
+    template<typename Arg>
+    shared_node(Arg &&elem, const std::size_t key)
+        : value(std::forward<Arg>(elem)),
+          hash{key} {}
+
+    Type value;
+    std::size_t hash;
+    std::size_t count{1u};
+    shared_node *next{};
+};
+
+template<typename Container>
+class shared_storage_iterator final {
+    using node_type = typename std::pointer_traits<typename Container::value_type>::element_type;
+
+public:
+    using value_type = std::remove_const_t<decltype(std::declval<node_type &>().value)>;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    constexpr shared_storage_iterator() noexcept = default;
+
+    constexpr shared_storage_iterator(const Container *ref, const difference_type idx) noexcept
+        : payload{ref},
+          offset{idx} {}
+
+    constexpr shared_storage_iterator &operator++() noexcept {
+        return --offset, *this;
+    }
+
+    constexpr shared_storage_iterator operator++(int) noexcept {
+        const shared_storage_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    constexpr shared_storage_iterator &operator--() noexcept {
+        return ++offset, *this;
+    }
+
+    constexpr shared_storage_iterator operator--(int) noexcept {
+        const shared_storage_iterator orig = *this;
+        return operator--(), orig;
+    }
+
+    constexpr shared_storage_iterator &operator+=(const difference_type value) noexcept {
+        offset -= value;
+        return *this;
+    }
+
+    constexpr shared_storage_iterator operator+(const difference_type value) const noexcept {
+        shared_storage_iterator copy = *this;
+        return (copy += value);
+    }
+
+    constexpr shared_storage_iterator &operator-=(const difference_type value) noexcept {
+        return (*this += -value);
+    }
+
+    constexpr shared_storage_iterator operator-(const difference_type value) const noexcept {
+        return (*this + -value);
+    }
+
+    [[nodiscard]] constexpr reference operator[](const difference_type value) const noexcept {
+        return (*payload)[static_cast<typename Container::size_type>(index() - value)]->value;
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept {
+        return std::addressof(operator[](0));
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+        return operator[](0);
+    }
+
+    [[nodiscard]] constexpr difference_type index() const noexcept {
+        return offset - 1;
+    }
+
+private:
+    const Container *payload{};
+    difference_type offset{};
+};
+
+template<typename Container>
+[[nodiscard]] constexpr std::ptrdiff_t operator-(const shared_storage_iterator<Container> &lhs, const shared_storage_iterator<Container> &rhs) noexcept {
+    return rhs.index() - lhs.index();
+}
+
+template<typename Container>
+[[nodiscard]] constexpr bool operator==(const shared_storage_iterator<Container> &lhs, const shared_storage_iterator<Container> &rhs) noexcept {
+    return lhs.index() == rhs.index();
+}
+
+template<typename Container>
+[[nodiscard]] constexpr bool operator!=(const shared_storage_iterator<Container> &lhs, const shared_storage_iterator<Container> &rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template<typename Container>
+[[nodiscard]] constexpr bool operator<(const shared_storage_iterator<Container> &lhs, const shared_storage_iterator<Container> &rhs) noexcept {
+    return lhs.index() > rhs.index();
+}
+
+template<typename Container>
+[[nodiscard]] constexpr bool operator>(const shared_storage_iterator<Container> &lhs, const shared_storage_iterator<Container> &rhs) noexcept {
+    return rhs < lhs;
+}
+
+template<typename Container>
+[[nodiscard]] constexpr bool operator<=(const shared_storage_iterator<Container> &lhs, const shared_storage_iterator<Container> &rhs) noexcept {
+    return !(lhs > rhs);
+}
+
+template<typename Container>
+[[nodiscard]] constexpr bool operator>=(const shared_storage_iterator<Container> &lhs, const shared_storage_iterator<Container> &rhs) noexcept {
+    return !(lhs < rhs);
+}
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Shared storage implementation.
+ *
+ * Entities that are assigned equal objects share the same instance. Unique
+ * values are kept in a deduplicated pool, while the storage only stores a
+ * reference to them for each entity. This is meant for large objects that
+ * many entities are likely to have in common, such as materials or
+ * configuration data.
+ *
+ * Objects are compared with `operator==` and hashed with `std::hash` when a
+ * specialization exists. Otherwise, all objects fall in the same bucket and
+ * finding an equal instance requires a linear scan of the unique values.
+ *
+ * @warning
+ * Objects are shared and therefore they are only returned as constant
+ * references. Updating the instance of an entity requires a call to `patch`,
+ * that applies the changes to a private copy when the instance is shared with
+ * other entities (copy-on-write). Moreover, only the swap-and-pop deletion
+ * policy is supported.
+ *
+ * @tparam Type Element type.
+ * @tparam Entity A valid entity type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Type, typename Entity, typename Allocator>
+class basic_shared_storage: public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    static_assert(std::is_copy_constructible_v<Type>, "Copy constructible type required");
+    static_assert(!component_traits<Type, Entity>::in_place_delete, "Pointer stability not supported");
+    using node_type = internal::shared_node<Type>;
+    using node_alloc_traits = typename alloc_traits::template rebind_traits<node_type>;
+    using container_type = std::vector<node_type *, typename alloc_traits::template rebind_alloc<node_type *>>;
+    using bucket_type = dense_map<std::size_t, node_type *, identity, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const std::size_t, node_type *>>>;
+    using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
+    using underlying_iterator = typename underlying_type::basic_iterator;
+
+    [[nodiscard]] static std::size_t hash_of([[maybe_unused]] const Type &value) {
+        if constexpr(std::is_default_constructible_v<std::hash<Type>>) {
+            return std::hash<Type>{}(value);
+        } else {
+            return std::size_t{};
+        }
+    }
+
+    [[nodiscard]] node_type *lookup(const Type &value, const std::size_t hash) const {
+        if(const auto it = buckets.find(hash); it != buckets.cend()) {
+            for(auto *curr = it->second; curr; curr = curr->next) {
+                if(curr->value == value) {
+                    return curr;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    void link(node_type *node) {
+        auto &bucket = buckets[node->hash];
+        node->next = std::exchange(bucket, node);
+    }
+
+    void unlink(node_type *node) {
+        const auto it = buckets.find(node->hash);
+        auto **curr = &it->second;
+
+        while(*curr != node) {
+            curr = &(*curr)->next;
+        }
+
+        if(*curr = node->next; it->second == nullptr) {
+            buckets.erase(it);
+        }
+
+        node->next = nullptr;
+    }
+
+    void destroy(node_type *node) {
+        typename node_alloc_traits::allocator_type allocator{get_allocator()};
+        node_alloc_traits::destroy(allocator, node);
+        node_alloc_traits::deallocate(allocator, node, 1u);
+        --unique_count;
+    }
+
+    template<typename Arg>
+    node_type *acquire(Arg &&value) {
+        const auto hash = hash_of(value);
+
+        if(auto *node = lookup(value, hash); node) {
+            ++node->count;
+            return node;
+        }
+
+        typename node_alloc_traits::allocator_type allocator{get_allocator()};
+        auto *node = to_address(node_alloc_traits::allocate(allocator, 1u));
+
+        ENTT_TRY {
+            node_alloc_traits::construct(allocator, node, std::forward<Arg>(value), hash);
+        }
+        ENTT_CATCH {
+            node_alloc_traits::deallocate(allocator, node, 1u);
+            ENTT_THROW;
+        }
+
+        link(node);
+        ++unique_count;
+
+        return node;
+    }
+
+    void release(node_type *node) {
+        if(--node->count == 0u) {
+            unlink(node);
+            destroy(node);
+        }
+    }
+
+    void release_all() {
+        for(auto &&elem: buckets) {
+            for(auto *node = elem.second; node;) {
+                destroy(std::exchange(node, node->next));
+            }
+        }
+
+        buckets.clear();
+    }
+
+    template<typename Arg>
+    auto emplace_element(const Entity entt, const bool force_back, Arg &&value) {
+        const auto it = base_type::try_emplace(entt, force_back);
+
+        ENTT_TRY {
+            payload.push_back(nullptr);
+            payload.back() = acquire(std::forward<Arg>(value));
+        }
+        ENTT_CATCH {
+            payload.resize(base_type::size() - 1u);
+            base_type::pop(it, it + 1u);
+            ENTT_THROW;
+        }
+
+        return it;
+    }
+
+    [[nodiscard]] const void *get_at(const std::size_t pos) const final {
+        return std::addressof(payload[pos]->value);
+    }
+
+    void swap_or_move(const std::size_t from, const std::size_t to) override {
+        using std::swap;
+        swap(payload[from], payload[to]);
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        for(; first != last; ++first) {
+            // cannot use first.index() because it would break with cross iterators
+            auto *node = std::exchange(payload[base_type::index(*first)], payload.back());
+            payload.pop_back();
+            base_type::swap_and_pop(first);
+            // releasing on exit allows reentrant destructors
+            release(node);
+        }
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        base_type::pop_all();
+        payload.clear();
+        release_all();
+    }
+
+    /**
+     * @brief Copies entities and elements from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from(const underlying_type &other) override {
+        const auto &from = static_cast<const basic_shared_storage &>(other);
+
+        basic_shared_storage::pop_all();
+        base_type::copy_from(other);
+
+        ENTT_TRY {
+            payload.reserve(from.payload.size());
+
+            for(auto *node: from.payload) {
+                payload.push_back(acquire(node->value));
+            }
+        }
+        ENTT_CATCH {
+            basic_shared_storage::pop_all();
+            ENTT_THROW;
+        }
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param value Optional opaque value.
+     * @param force_back Force back insertion.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace([[maybe_unused]] const Entity entt, [[maybe_unused]] const bool force_back, const void *value) override {
+        if(value != nullptr) {
+            return emplace_element(entt, force_back, *static_cast<const element_type *>(value));
+        } else {
+            if constexpr(std::is_default_constructible_v<element_type>) {
+                return emplace_element(entt, force_back, element_type{});
+            } else {
+                return base_type::end();
+            }
+        }
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Base type. */
+    using base_type = underlying_type;
+    /*! @brief Element type. */
+    using element_type = Type;
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = element_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Signed integer type. */
+    using difference_type = std::ptrdiff_t;
+    /*! @brief Random access iterator type, objects are always constant. */
+    using iterator = internal::shared_storage_iterator<container_type>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = iterator;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    /*! @brief Constant reverse iterator type. */
+    using const_reverse_iterator = reverse_iterator;
+    /*! @brief Extended iterable storage proxy. */
+    using iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::iterator, iterator>>;
+    /*! @brief Constant extended iterable storage proxy. */
+    using const_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_iterator, const_iterator>>;
+    /*! @brief Extended reverse iterable storage proxy. */
+    using reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::reverse_iterator, reverse_iterator>>;
+    /*! @brief Constant extended reverse iterable storage proxy. */
+    using const_reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_reverse_iterator, const_reverse_iterator>>;
+    /*! @brief Storage deletion policy. */
+    static constexpr deletion_policy storage_policy{deletion_policy::swap_and_pop};
+
+    /*! @brief Default constructor. */
+    basic_shared_storage()
+        : basic_shared_storage{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_shared_storage(const allocator_type &allocator)
+        : base_type{type_id<element_type>(), storage_policy, internal::sparse_page_size<component_traits<Type, Entity>, Entity>::value, allocator},
+          payload{allocator},
+          buckets{allocator} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_shared_storage(const basic_shared_storage &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    basic_shared_storage(basic_shared_storage &&other) noexcept
+        : base_type{std::move(other)},
+          payload{std::move(other.payload)},
+          buckets{std::move(other.buckets)},
+          unique_count{std::exchange(other.unique_count, 0u)} {
+        // moved-from maps have no buckets, clearing them makes them usable again
+        other.buckets.clear();
+    }
+    // NOLINTEND(bugprone-use-after-move)
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    basic_shared_storage(basic_shared_storage &&other, const allocator_type &allocator)
+        : base_type{std::move(other), allocator},
+          payload{std::move(other.payload), allocator},
+          buckets{std::move(other.buckets), allocator},
+          unique_count{std::exchange(other.unique_count, 0u)} {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a storage is not allowed");
+        // moved-from maps have no buckets, clearing them makes them usable again
+        other.buckets.clear();
+    }
+    // NOLINTEND(bugprone-use-after-move)
+
+    /*! @brief Default destructor. */
+    ~basic_shared_storage() override {
+        release_all();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This storage.
+     */
+    basic_shared_storage &operator=(const basic_shared_storage &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_shared_storage &operator=(basic_shared_storage &&other) noexcept {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a storage is not allowed");
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(basic_shared_storage &other) noexcept {
+        using std::swap;
+        swap(payload, other.payload);
+        swap(buckets, other.buckets);
+        swap(unique_count, other.unique_count);
+        base_type::swap(other);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return allocator_type{payload.get_allocator()};
+    }
+
+    /**
+     * @brief Increases the capacity of a storage.
+     *
+     * If the new capacity is greater than the current capacity, new storage is
+     * allocated, otherwise the method does nothing.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) override {
+        base_type::reserve(cap);
+        payload.reserve(cap);
+    }
+
+    /**
+     * @brief Returns the number of elements that a storage has currently
+     * allocated space for.
+     * @return Capacity of the storage.
+     */
+    [[nodiscard]] size_type capacity() const noexcept override {
+        return payload.capacity();
+    }
+
+    /**
+     * @brief Returns the memory used by a storage.
+     *
+     * Each unique value counts once, no matter how many entities share it.
+     *
+     * @return The memory used by the storage.
+     */
+    [[nodiscard]] memory_report memory_usage() const noexcept override {
+        auto report = base_type::memory_usage();
+        report.element_bytes = payload.capacity() * sizeof(node_type *) + unique_count * sizeof(node_type) + buckets.size() * sizeof(typename bucket_type::value_type);
+        return report;
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() override {
+        base_type::shrink_to_fit();
+        payload.shrink_to_fit();
+        buckets.rehash(0u);
+    }
+
+    /**
+     * @brief Returns the number of unique values in a storage.
+     * @return Number of unique values.
+     */
+    [[nodiscard]] size_type unique() const noexcept {
+        return unique_count;
+    }
+
+    /**
+     * @brief Returns the number of entities that share the object of a given
+     * entity, the entity itself included.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return The number of entities that share the object of the entity.
+     */
+    [[nodiscard]] size_type use_count(const entity_type entt) const noexcept {
+        return payload[base_type::index(entt)]->count;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * If the storage is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first instance of the internal array.
+     */
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        const auto pos = static_cast<difference_type>(base_type::size());
+        return const_iterator{&payload, pos};
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return cbegin();
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * internal array.
+     */
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return const_iterator{&payload, {}};
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const noexcept {
+        return cend();
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * If the storage is empty, the returned iterator will be equal to `rend()`.
+     *
+     * @return An iterator to the first instance of the reversed internal array.
+     */
+    [[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+        return std::make_reverse_iterator(cend());
+    }
+
+    /*! @copydoc crbegin */
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+        return crbegin();
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * reversed internal array.
+     */
+    [[nodiscard]] const_reverse_iterator crend() const noexcept {
+        return std::make_reverse_iterator(cbegin());
+    }
+
+    /*! @copydoc crend */
+    [[nodiscard]] const_reverse_iterator rend() const noexcept {
+        return crend();
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return The object assigned to the entity.
+     */
+    [[nodiscard]] const value_type &get(const entity_type entt) const noexcept {
+        return payload[base_type::index(entt)]->value;
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity as a tuple.
+     * @param entt A valid identifier.
+     * @return The object assigned to the entity as a tuple.
+     */
+    [[nodiscard]] std::tuple<const value_type &> get_as_tuple(const entity_type entt) const noexcept {
+        return std::forward_as_tuple(get(entt));
+    }
+
+    /**
+     * @brief Returns the object at a given position in the storage.
+     *
+     * @warning
+     * Attempting to use a position that is out of bounds results in undefined
+     * behavior.
+     *
+     * @param pos A valid position.
+     * @return The object at the given position.
+     */
+    [[nodiscard]] const value_type &at(const size_type pos) const noexcept {
+        ENTT_ASSERT(pos < base_type::size(), "Index out of bounds");
+        return payload[pos]->value;
+    }
+
+    /**
+     * @brief Returns the object at a given position in the storage as a tuple.
+     * @param pos A valid position.
+     * @return The object at the given position as a tuple.
+     */
+    [[nodiscard]] std::tuple<const value_type &> at_as_tuple(const size_type pos) const noexcept {
+        return std::forward_as_tuple(at(pos));
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * The object is shared with the other entities of the storage that already
+     * own an equal instance, if any.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to construct an object for the entity.
+     * @return A reference to the object assigned to the entity.
+     */
+    template<typename... Args>
+    const value_type &emplace(const entity_type entt, Args &&...args) {
+        if constexpr(sizeof...(Args) == 1u && (std::is_same_v<std::remove_cv_t<std::remove_reference_t<Args>>, value_type> && ...)) {
+            const auto it = emplace_element(entt, false, std::forward<Args>(args)...);
+            return payload[static_cast<size_type>(it.index())]->value;
+        } else if constexpr(std::is_aggregate_v<value_type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<value_type>)) {
+            const auto it = emplace_element(entt, false, Type{std::forward<Args>(args)...});
+            return payload[static_cast<size_type>(it.index())]->value;
+        } else {
+            const auto it = emplace_element(entt, false, Type(std::forward<Args>(args)...));
+            return payload[static_cast<size_type>(it.index())]->value;
+        }
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity.
+     *
+     * Function objects receive a non-constant reference to the instance. When
+     * it is shared with other entities, they receive a private copy instead
+     * and the other entities aren't affected by the changes. In both cases,
+     * the updated instance is shared again if it turns out to be equal to
+     * another value in the storage.
+     *
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A reference to the updated instance.
+     */
+    template<typename... Func>
+    const value_type &patch(const entity_type entt, Func &&...func) {
+        auto &node = payload[base_type::index(entt)];
+
+        if(node->count == 1u) {
+            unlink(node);
+
+            ENTT_TRY {
+                (std::forward<Func>(func)(node->value), ...);
+                node->hash = hash_of(node->value);
+            }
+            ENTT_CATCH {
+                node->hash = hash_of(node->value);
+                link(node);
+                ENTT_THROW;
+            }
+
+            if(auto *other = lookup(node->value, node->hash); other) {
+                ++other->count;
+                destroy(std::exchange(node, other));
+            } else {
+                link(node);
+            }
+        } else {
+            value_type elem = node->value;
+            (std::forward<Func>(func)(elem), ...);
+            auto *other = acquire(std::move(elem));
+            --node->count;
+            node = other;
+        }
+
+        return node->value;
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the storage
+     * results in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the object to construct.
+     * @return Iterator pointing to the first element inserted, if any.
+     */
+    template<typename It>
+    iterator insert(It first, It last, const value_type &value = {}) {
+        for(; first != last; ++first) {
+            emplace_element(*first, true, value);
+        }
+
+        return begin();
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given range.
+     *
+     * @tparam EIt Type of input iterator.
+     * @tparam CIt Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param from An iterator to the first element of the range of objects.
+     * @return Iterator pointing to the first element inserted, if any.
+     */
+    template<typename EIt, typename CIt, typename = std::enable_if_t<std::is_same_v<typename std::iterator_traits<CIt>::value_type, value_type>>>
+    iterator insert(EIt first, EIt last, CIt from) {
+        for(; first != last; ++first, ++from) {
+            emplace_element(*first, true, *from);
+        }
+
+        return begin();
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a storage.
+     *
+     * The iterable object returns a tuple that contains the current entity and
+     * a constant reference to its element.
+     *
+     * @return An iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] const_iterable each() const noexcept {
+        return const_iterable{{base_type::cbegin(), cbegin()}, {base_type::cend(), cend()}};
+    }
+
+    /*! @copydoc each */
+    [[nodiscard]] iterable each() noexcept {
+        return iterable{{base_type::begin(), begin()}, {base_type::end(), end()}};
+    }
+
+    /**
+     * @brief Returns a reverse iterable object to use to _visit_ a storage.
+     *
+     * @sa each
+     *
+     * @return A reverse iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] const_reverse_iterable reach() const noexcept {
+        return const_reverse_iterable{{base_type::crbegin(), crbegin()}, {base_type::crend(), crend()}};
+    }
+
+    /*! @copydoc reach */
+    [[nodiscard]] reverse_iterable reach() noexcept {
+        return reverse_iterable{{base_type::rbegin(), rbegin()}, {base_type::rend(), rend()}};
+    }
+
+private:
+    container_type payload;
+    bucket_type buckets;
+    size_type unique_count{};
+};
+
+} // namespace entt
+
+#endif
@@ -1,15 +1,24 @@
 #ifndef ENTT_ENTITY_SNAPSHOT_HPP
 #define ENTT_ENTITY_SNAPSHOT_HPP
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <memory>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 #include "../config/config.h"
 #include "../container/dense_map.hpp"
+#include "../core/any.hpp"
+#include "../core/bit.hpp"
+#include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
+#include "../core/utility.hpp"
+#include "component.hpp"
 #include "entity.hpp"
 #include "fwd.hpp"
 #include "view.hpp"
@@ -30,6 +39,94 @@ void orphans(Registry &registry) {
     }
 }
 
+template<typename, typename = void>
+struct has_bulk_write: std::false_type {};
+
+template<typename Archive>
+struct has_bulk_write<Archive, std::void_t<decltype(std::declval<Archive &>().write(std::declval<const void *>(), std::size_t{}))>>: std::true_type {};
+
+template<typename, typename = void>
+struct has_bulk_read: std::false_type {};
+
+template<typename Archive>
+struct has_bulk_read<Archive, std::void_t<decltype(std::declval<Archive &>().read(std::declval<void *>(), std::size_t{}))>>: std::true_type {};
+
+template<typename, typename = void>
+struct has_tick: std::false_type {};
+
+template<typename Type>
+struct has_tick<Type, std::void_t<decltype(std::declval<Type &>().advance())>>: std::true_type {};
+
+template<typename, typename = void>
+struct is_bulk_storage: std::false_type {};
+
+template<typename Type>
+struct is_bulk_storage<Type, std::void_t<decltype(*std::declval<const Type &>().raw())>>
+    : std::bool_constant<(Type::storage_policy == deletion_policy::swap_and_pop) && std::is_trivially_copyable_v<typename Type::value_type> && (component_traits<typename Type::value_type, typename Type::entity_type>::page_size != 0u)> {};
+
+template<typename Entity, typename Type>
+struct captured_storage {
+    using element_type = Type;
+
+    std::vector<Entity> entities{};
+    std::vector<Type> elements{};
+};
+
+template<typename Entity>
+struct captured_storage<Entity, void> {
+    using element_type = void;
+
+    std::vector<Entity> entities{};
+    std::size_t free_list{};
+};
+
+struct image_header {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t count;
+    std::uint64_t table;
+};
+
+struct image_section {
+    std::uint64_t id;
+    std::uint64_t offset;
+    std::uint64_t length;
+    std::uint64_t extra;
+};
+
+struct no_block_codec {};
+
+inline void encode_varint(std::vector<std::byte> &out, std::uint64_t value) {
+    for(; value >= 0x80u; value >>= 7u) {
+        out.push_back(static_cast<std::byte>((value & 0x7Fu) | 0x80u));
+    }
+
+    out.push_back(static_cast<std::byte>(value));
+}
+
+[[nodiscard]] inline const std::byte *decode_varint(const std::byte *first, [[maybe_unused]] const std::byte *last, std::uint64_t &value) {
+    value = {};
+
+    for(std::uint64_t shift{}, curr = 0x80u; (curr & 0x80u) != 0u; shift += 7u) {
+        ENTT_ASSERT(first != last, "Unexpected end of data");
+        curr = std::to_integer<std::uint64_t>(*first++);
+        value |= (curr & 0x7Fu) << shift;
+    }
+
+    return first;
+}
+
+[[nodiscard]] constexpr std::uint64_t zigzag(const std::int64_t value) noexcept {
+    return (static_cast<std::uint64_t>(value) << 1u) ^ static_cast<std::uint64_t>(value >> 63u);
+}
+
+[[nodiscard]] constexpr std::int64_t unzigzag(const std::uint64_t value) noexcept {
+    return static_cast<std::int64_t>(value >> 1u) ^ -static_cast<std::int64_t>(value & 1u);
+}
+
+inline constexpr std::uint32_t image_magic = 0x54544e45u;
+inline constexpr std::uint32_t image_version = 1u;
+
 } // namespace internal
 /*! @endcond */
 
@@ -93,11 +190,23 @@ public:
     template<typename Type, typename Archive>
     const basic_snapshot &get(Archive &archive, const id_type id = type_hash<Type>::value()) const {
         if(const auto *storage = reg->template storage<Type>(id); storage) {
+            using storage_type = typename registry_type::template storage_for_type<Type>;
             const typename registry_type::common_type &base = *storage;
 
             archive(static_cast<typename traits_type::entity_type>(storage->size()));
 
-            if constexpr(std::is_same_v<Type, entity_type>) {
+            if constexpr(!std::is_same_v<Type, entity_type> && internal::is_bulk_storage<storage_type>::value && internal::has_bulk_write<Archive>::value) {
+                constexpr auto page_size = component_traits<typename storage_type::value_type, entity_type>::page_size;
+                const auto len = storage->size();
+
+                if(len != 0u) {
+                    archive.write(base.data(), len * sizeof(entity_type));
+                }
+
+                for(std::size_t pos{}; pos < len; pos += page_size) {
+                    archive.write(storage->raw()[pos / page_size], (std::min)(page_size, len - pos) * sizeof(typename storage_type::value_type));
+                }
+            } else if constexpr(std::is_same_v<Type, entity_type>) {
                 archive(static_cast<typename traits_type::entity_type>(storage->free_list()));
 
                 for(auto first = base.rbegin(), last = base.rend(); first != last; ++first) {
@@ -141,6 +250,30 @@ public:
         static_assert(!std::is_same_v<Type, entity_type>, "Entity types not supported");
 
         if(const auto *storage = reg->template storage<Type>(id); storage && !storage->empty()) {
+            using storage_type = typename registry_type::template storage_for_type<Type>;
+
+            if constexpr(internal::is_bulk_storage<storage_type>::value && internal::has_bulk_write<Archive>::value) {
+                std::vector<entity_type> entities{};
+                std::vector<typename storage_type::value_type> elements{};
+
+                // bulk archives don't support null entities, missing elements are skipped instead
+                for(; first != last; ++first) {
+                    if(const auto entt = *first; storage->contains(entt)) {
+                        entities.push_back(entt);
+                        elements.push_back(storage->get(entt));
+                    }
+                }
+
+                archive(static_cast<typename traits_type::entity_type>(entities.size()));
+
+                if(!entities.empty()) {
+                    archive.write(entities.data(), entities.size() * sizeof(entity_type));
+                    archive.write(elements.data(), elements.size() * sizeof(typename storage_type::value_type));
+                }
+
+                return *this;
+            }
+
             archive(static_cast<typename traits_type::entity_type>(std::distance(first, last)));
 
             for(; first != last; ++first) {
@@ -162,6 +295,349 @@ private:
     const registry_type *reg;
 };
 
+/**
+ * @brief Utility class to capture the state of a registry and serialize it
+ * later.
+ *
+ * A capture copies the packed arrays of the storage of interest, page by page
+ * for trivially copyable types. Then, it serializes them on request with the
+ * same layout produced by a snapshot, so that the usual loaders apply.<br/>
+ * Since a capture owns its data, serialization doesn't access the registry and
+ * can therefore happen on a different thread, while the registry is updated.
+ *
+ * Memory is retained between captures. Alternating two captures in a sort of
+ * double buffering avoids further allocations at steady state.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_snapshot_capture {
+    static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
+    using traits_type = entt_traits<typename Registry::entity_type>;
+
+    template<typename Type>
+    using storage_type = typename Registry::template storage_for_type<Type>;
+
+    template<typename Type>
+    using section_type = internal::captured_storage<typename Registry::entity_type, std::conditional_t<std::tuple_size_v<decltype(std::declval<const storage_type<Type> &>().get_as_tuple({}))> == 0u, void, typename storage_type<Type>::value_type>>;
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+
+    /**
+     * @brief Constructs an instance that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_snapshot_capture(const registry_type &source) noexcept
+        : reg{&source},
+          sections{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_snapshot_capture(const basic_snapshot_capture &) = delete;
+
+    /*! @brief Default move constructor. */
+    basic_snapshot_capture(basic_snapshot_capture &&) noexcept = default;
+
+    /*! @brief Default destructor. */
+    ~basic_snapshot_capture() = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This capture.
+     */
+    basic_snapshot_capture &operator=(const basic_snapshot_capture &) = delete;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This capture.
+     */
+    basic_snapshot_capture &operator=(basic_snapshot_capture &&) noexcept = default;
+
+    /**
+     * @brief Copies all elements of a type with associated identifiers.
+     *
+     * Any previous capture of the same storage is overwritten.
+     *
+     * @tparam Type Type of elements to capture.
+     * @param id Optional name used to map the storage within the registry.
+     * @return An object of this type to continue capturing the registry.
+     */
+    template<typename Type>
+    basic_snapshot_capture &capture(const id_type id = type_hash<Type>::value()) {
+        using section_t = section_type<Type>;
+        auto &elem = sections[id];
+
+        if(elem.type() != type_id<section_t>()) {
+            elem.template emplace<section_t>();
+        }
+
+        auto &section = any_cast<section_t &>(elem);
+        section.entities.clear();
+
+        if constexpr(std::is_void_v<typename section_t::element_type>) {
+            section.free_list = 0u;
+        } else {
+            section.elements.clear();
+        }
+
+        if(const auto *storage = reg->template storage<Type>(id); storage) {
+            const typename registry_type::common_type &base = *storage;
+
+            if constexpr(std::is_same_v<Type, entity_type>) {
+                section.entities.insert(section.entities.end(), base.data(), base.data() + base.size());
+                section.free_list = storage->free_list();
+            } else if constexpr(internal::is_bulk_storage<storage_type<Type>>::value) {
+                constexpr auto page_size = component_traits<typename storage_type<Type>::value_type, entity_type>::page_size;
+                const auto len = storage->size();
+
+                section.entities.insert(section.entities.end(), base.data(), base.data() + len);
+                section.elements.reserve(len);
+
+                for(std::size_t pos{}; pos < len; pos += page_size) {
+                    const auto *page = storage->raw()[pos / page_size];
+                    section.elements.insert(section.elements.end(), page, page + (std::min)(page_size, len - pos));
+                }
+            } else {
+                for(auto it = base.rbegin(), last = base.rend(); it != last; ++it) {
+                    if(const auto entt = *it; entt != tombstone) {
+                        section.entities.push_back(entt);
+
+                        if constexpr(!std::is_void_v<typename section_t::element_type>) {
+                            section.elements.push_back(storage->get(entt));
+                        }
+                    }
+                }
+            }
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Serializes all captured elements of a type with associated
+     * identifiers.
+     *
+     * Storage that weren't captured are serialized as empty.
+     *
+     * @tparam Type Type of elements to serialize.
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     * @param id Optional name used to map the storage within the registry.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename Type, typename Archive>
+    const basic_snapshot_capture &get(Archive &archive, const id_type id = type_hash<Type>::value()) const {
+        if(const auto it = sections.find(id); it != sections.cend()) {
+            using section_t = section_type<Type>;
+            const auto &section = any_cast<const section_t &>(it->second);
+
+            archive(static_cast<typename traits_type::entity_type>(section.entities.size()));
+
+            if constexpr(std::is_same_v<Type, entity_type>) {
+                archive(static_cast<typename traits_type::entity_type>(section.free_list));
+
+                for(auto entt: section.entities) {
+                    archive(entt);
+                }
+            } else if constexpr(internal::is_bulk_storage<storage_type<Type>>::value && internal::has_bulk_write<Archive>::value) {
+                if(!section.entities.empty()) {
+                    archive.write(section.entities.data(), section.entities.size() * sizeof(entity_type));
+                    archive.write(section.elements.data(), section.elements.size() * sizeof(typename section_t::element_type));
+                }
+            } else {
+                for(std::size_t pos{}, last = section.entities.size(); pos < last; ++pos) {
+                    archive(section.entities[pos]);
+
+                    if constexpr(!std::is_void_v<typename section_t::element_type>) {
+                        archive(section.elements[pos]);
+                    }
+                }
+            }
+        } else {
+            archive(typename traits_type::entity_type{});
+        }
+
+        return *this;
+    }
+
+private:
+    const registry_type *reg;
+    dense_map<id_type, any, identity> sections;
+};
+
+/**
+ * @brief Utility class to create delta snapshots from a registry.
+ *
+ * A _delta snapshot_ contains only what changed since a baseline, that is, the
+ * entities created or destroyed and the elements assigned, updated or removed
+ * in the meantime.<br/>
+ * Storage classes that track changes (see `changed_mixin`) only emit the
+ * elements updated since the baseline. Any other storage emits all its
+ * elements, while removals are detected for all of them.
+ *
+ * Deltas are meant to be applied by a continuous loader, in the same order in
+ * which they are created.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_delta_snapshot {
+    static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
+    using traits_type = entt_traits<typename Registry::entity_type>;
+    using set_type = typename Registry::common_type;
+
+    struct baseline_type {
+        set_type entities{};
+        std::uint64_t tick{};
+    };
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+
+    /**
+     * @brief Constructs an instance that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_delta_snapshot(registry_type &source) noexcept
+        : reg{&source},
+          baselines{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_delta_snapshot(const basic_delta_snapshot &) = delete;
+
+    /*! @brief Default move constructor. */
+    basic_delta_snapshot(basic_delta_snapshot &&) noexcept = default;
+
+    /*! @brief Default destructor. */
+    ~basic_delta_snapshot() = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This snapshot.
+     */
+    basic_delta_snapshot &operator=(const basic_delta_snapshot &) = delete;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This snapshot.
+     */
+    basic_delta_snapshot &operator=(basic_delta_snapshot &&) noexcept = default;
+
+    /**
+     * @brief Records the current state of a storage as its baseline.
+     *
+     * The tick of storage classes that track changes is advanced.
+     *
+     * @tparam Type Type of elements to track.
+     * @param id Optional name used to map the storage within the registry.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename Type>
+    basic_delta_snapshot &baseline(const id_type id = type_hash<Type>::value()) {
+        auto &storage = reg->template storage<Type>(id);
+        auto &elem = baselines[id];
+
+        elem.entities.clear();
+
+        if constexpr(std::is_same_v<Type, entity_type>) {
+            for(auto [entt]: storage.each()) {
+                elem.entities.push(entt);
+            }
+        } else {
+            for(auto entt: static_cast<const set_type &>(storage)) {
+                if(entt != tombstone) {
+                    elem.entities.push(entt);
+                }
+            }
+
+            if constexpr(internal::has_tick<std::remove_reference_t<decltype(storage)>>::value) {
+                elem.tick = storage.advance();
+            }
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Serializes what changed since the baseline of a storage.
+     *
+     * Storage without a baseline are serialized as if their baseline were
+     * empty.
+     *
+     * @tparam Type Type of elements to serialize.
+     * @tparam Archive Type of output archive.
+     * @param archive A valid reference to an output archive.
+     * @param id Optional name used to map the storage within the registry.
+     * @return An object of this type to continue creating the snapshot.
+     */
+    template<typename Type, typename Archive>
+    const basic_delta_snapshot &get(Archive &archive, const id_type id = type_hash<Type>::value()) const {
+        const auto *storage = std::as_const(*reg).template storage<Type>(id);
+        const auto it = baselines.find(id);
+        const set_type *other = (it == baselines.cend()) ? nullptr : &it->second.entities;
+        std::vector<entity_type> added{};
+        std::vector<entity_type> removed{};
+
+        if(other != nullptr) {
+            for(auto entt: *other) {
+                if(storage == nullptr || !storage->contains(entt)) {
+                    // elements of destroyed entities are removed along with them
+                    if(std::is_same_v<Type, entity_type> || reg->valid(entt)) {
+                        removed.push_back(entt);
+                    }
+                }
+            }
+        }
+
+        if(storage != nullptr) {
+            if constexpr(std::is_same_v<Type, entity_type>) {
+                for(auto [entt]: storage->each()) {
+                    if(other == nullptr || !other->contains(entt)) {
+                        added.push_back(entt);
+                    }
+                }
+            } else if constexpr(internal::has_tick<std::remove_const_t<std::remove_pointer_t<decltype(storage)>>>::value) {
+                using tick_type = typename std::remove_const_t<std::remove_pointer_t<decltype(storage)>>::tick_type;
+                storage->changed_since((other == nullptr) ? tick_type{} : static_cast<tick_type>(it->second.tick), [&added](const entity_type entt) { added.push_back(entt); });
+            } else {
+                for(auto entt: static_cast<const set_type &>(*storage)) {
+                    if(entt != tombstone) {
+                        added.push_back(entt);
+                    }
+                }
+            }
+        }
+
+        archive(static_cast<typename traits_type::entity_type>(removed.size()));
+
+        for(auto entt: removed) {
+            archive(entt);
+        }
+
+        archive(static_cast<typename traits_type::entity_type>(added.size()));
+
+        for(auto entt: added) {
+            archive(entt);
+
+            if constexpr(!std::is_same_v<Type, entity_type>) {
+                std::apply([&archive](auto &&...args) { (archive(std::forward<decltype(args)>(args)), ...); }, storage->get_as_tuple(entt));
+            }
+        }
+
+        return *this;
+    }
+
+private:
+    registry_type *reg;
+    dense_map<id_type, baseline_type, identity> baselines;
+};
+
 /**
  * @brief Utility class to restore a snapshot as a whole.
  *
@@ -216,6 +692,12 @@ public:
 
     /**
      * @brief Restores all elements of a type with associated identifiers.
+     *
+     * Once entities are restored, elements of different types can be restored
+     * concurrently, each from its own archive, provided that their storage
+     * classes already exist (see `basic_registry::prepare`) and that no
+     * listeners or groups are attached to them.
+     *
      * @tparam Type Type of elements to restore.
      * @tparam Archive Type of input archive.
      * @param archive A valid reference to an input archive.
@@ -244,6 +726,22 @@ public:
 
             storage.start_from(traits_type::next(placeholder));
             storage.free_list(count);
+        } else if constexpr(internal::is_bulk_storage<std::remove_reference_t<decltype(storage)>>::value && internal::has_bulk_read<Archive>::value) {
+            auto &other = reg->template storage<entity_type>();
+            std::vector<entity_type> entities(length);
+            std::vector<typename std::remove_reference_t<decltype(storage)>::value_type> elements(length);
+
+            if(length != 0u) {
+                archive.read(entities.data(), entities.size() * sizeof(entity_type));
+                archive.read(elements.data(), elements.size() * sizeof(typename decltype(elements)::value_type));
+            }
+
+            for(auto entt: entities) {
+                const auto entity = other.contains(entt) ? entt : other.generate(entt);
+                ENTT_ASSERT(entity == entt, "Entity not available for use");
+            }
+
+            storage.insert(entities.begin(), entities.end(), elements.begin());
         } else {
             auto &other = reg->template storage<entity_type>();
             entity_type entt{null};
@@ -306,14 +804,65 @@ template<typename Registry>
 class basic_continuous_loader {
     static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
     using traits_type = entt_traits<typename Registry::entity_type>;
+    using alloc_traits = std::allocator_traits<typename Registry::allocator_type>;
+    // remote and local identifiers, indexed by the entity part of the former
+    using remote_type = std::pair<typename Registry::entity_type, typename Registry::entity_type>;
+    using page_type = std::vector<remote_type, typename alloc_traits::template rebind_alloc<remote_type>>;
+    using remote_container_type = std::vector<page_type, typename alloc_traits::template rebind_alloc<page_type>>;
+
+    [[nodiscard]] const remote_type *find(const typename Registry::entity_type entt) const noexcept {
+        const auto pos = static_cast<std::size_t>(to_entity(entt));
+        const auto page = pos / traits_type::page_size;
+        return (page < remloc.size() && !remloc[page].empty()) ? &remloc[page][fast_mod(pos, traits_type::page_size)] : nullptr;
+    }
 
-    void restore(typename Registry::entity_type entt) {
-        if(const auto entity = to_entity(entt); remloc.contains(entity) && remloc[entity].first == entt) {
-            if(!reg->valid(remloc[entity].second)) {
-                remloc[entity].second = reg->create();
-            }
-        } else {
-            remloc.insert_or_assign(entity, std::make_pair(entt, reg->create()));
+    [[nodiscard]] remote_type *find(const typename Registry::entity_type entt) noexcept {
+        return const_cast<remote_type *>(std::as_const(*this).find(entt));
+    }
+
+    [[nodiscard]] remote_type &assure(const typename Registry::entity_type entt) {
+        const auto pos = static_cast<std::size_t>(to_entity(entt));
+        const auto page = pos / traits_type::page_size;
+
+        if(!(page < remloc.size())) {
+            remloc.resize(page + 1u, page_type{remloc.get_allocator()});
+        }
+
+        if(remloc[page].empty()) {
+            remloc[page].resize(traits_type::page_size, remote_type{null, null});
+        }
+
+        return remloc[page][fast_mod(pos, traits_type::page_size)];
+    }
+
+    template<typename Func>
+    void each(Func func) const {
+        for(auto &&page: remloc) {
+            for(auto &&elem: page) {
+                if(elem.first != null) {
+                    func(elem.second);
+                }
+            }
+        }
+    }
+
+    void restore(typename Registry::entity_type entt) {
+        if(auto &elem = assure(entt); elem.first == entt) {
+            if(!reg->valid(elem.second)) {
+                elem.second = reg->create();
+            }
+        } else {
+            elem = remote_type{entt, reg->create()};
+        }
+    }
+
+    void release(typename Registry::entity_type entt, const bool exact) {
+        if(auto *elem = find(entt); elem != nullptr && elem->first != null && (!exact || elem->first == entt)) {
+            if(reg->valid(elem->second)) {
+                reg->destroy(elem->second);
+            }
+
+            *elem = remote_type{null, null};
         }
     }
 
@@ -432,19 +981,25 @@ public:
 
             for(std::size_t pos = in_use; pos < length; ++pos) {
                 archive(entt);
+                release(entt, false);
+            }
+        } else if constexpr(internal::is_bulk_storage<std::remove_reference_t<decltype(storage)>>::value && internal::has_bulk_read<Archive>::value) {
+            std::vector<entity_type> entities(length);
+            std::vector<typename std::remove_reference_t<decltype(storage)>::value_type> elements(length);
 
-                if(const auto entity = to_entity(entt); remloc.contains(entity)) {
-                    if(reg->valid(remloc[entity].second)) {
-                        reg->destroy(remloc[entity].second);
-                    }
+            if(length != 0u) {
+                archive.read(entities.data(), entities.size() * sizeof(entity_type));
+                archive.read(elements.data(), elements.size() * sizeof(typename decltype(elements)::value_type));
+            }
 
-                    remloc.erase(entity);
-                }
+            each([&storage](const entity_type local) { storage.remove(local); });
+
+            for(std::size_t pos{}; pos < entities.size(); ++pos) {
+                restore(entities[pos]);
+                storage.emplace(map(entities[pos]), std::move(elements[pos]));
             }
         } else {
-            for(auto &&ref: remloc) {
-                storage.remove(ref.second.second);
-            }
+            each([&storage](const entity_type local) { storage.remove(local); });
 
             while(length--) {
                 if(archive(entt); entt != null) {
@@ -464,6 +1019,67 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Applies a delta of elements of a type with associated identifiers.
+     *
+     * Unlike `get`, elements that aren't part of the delta are left untouched.
+     * Deltas must be applied in the same order in which they were created.
+     *
+     * @sa basic_delta_snapshot
+     *
+     * @tparam Type Type of elements to restore.
+     * @tparam Archive Type of input archive.
+     * @param archive A valid reference to an input archive.
+     * @param id Optional name used to map the storage within the registry.
+     * @return A valid loader to continue restoring data.
+     */
+    template<typename Type, typename Archive>
+    basic_continuous_loader &delta(Archive &archive, const id_type id = type_hash<Type>::value()) {
+        [[maybe_unused]] auto &storage = reg->template storage<Type>(id);
+        typename traits_type::entity_type length{};
+        entity_type entt{null};
+
+        archive(length);
+
+        while(length--) {
+            archive(entt);
+
+            if constexpr(std::is_same_v<Type, entity_type>) {
+                release(entt, true);
+            } else if(const auto local = map(entt); local != null) {
+                storage.remove(local);
+            }
+        }
+
+        archive(length);
+
+        while(length--) {
+            archive(entt);
+            restore(entt);
+
+            if constexpr(!std::is_same_v<Type, entity_type>) {
+                const auto local = map(entt);
+
+                if constexpr(std::tuple_size_v<decltype(storage.get_as_tuple({}))> == 0u) {
+                    if(!storage.contains(local)) {
+                        storage.emplace(local);
+                    }
+                } else {
+                    Type elem{};
+                    archive(elem);
+
+                    if(storage.contains(local)) {
+                        storage.patch(local, [&elem](auto &curr) { curr = std::move(elem); });
+                    } else {
+                        storage.emplace(local, std::move(elem));
+                    }
+                }
+            }
+        }
+
+        return *this;
+    }
+
     /**
      * @brief Destroys those entities that have no elements.
      *
@@ -485,8 +1101,8 @@ public:
      * @return True if `entity` is managed by the loader, false otherwise.
      */
     [[nodiscard]] bool contains(entity_type entt) const noexcept {
-        const auto it = remloc.find(to_entity(entt));
-        return it != remloc.cend() && it->second.first == entt;
+        const auto *elem = find(entt);
+        return elem != nullptr && elem->first == entt;
     }
 
     /**
@@ -495,16 +1111,958 @@ public:
      * @return The local identifier if any, the null entity otherwise.
      */
     [[nodiscard]] entity_type map(entity_type entt) const noexcept {
-        if(const auto it = remloc.find(to_entity(entt)); it != remloc.cend() && it->second.first == entt) {
-            return it->second.second;
+        if(const auto *elem = find(entt); elem != nullptr && elem->first == entt) {
+            return elem->second;
         }
 
         return null;
     }
 
+    /**
+     * @brief Returns the identifiers to which a range of entities refer.
+     * @tparam It Type of input iterator.
+     * @tparam Out Type of output iterator.
+     * @param first An iterator to the first element of the range to map.
+     * @param last An iterator past the last element of the range to map.
+     * @param out An output iterator to write the local identifiers to.
+     * @return An iterator past the last identifier written.
+     */
+    template<typename It, typename Out>
+    Out map(It first, It last, Out out) const {
+        for(; first != last; ++first, ++out) {
+            *out = map(*first);
+        }
+
+        return out;
+    }
+
+    /**
+     * @brief Maps the members of all the elements restored by the loader.
+     *
+     * Members are either entities or containers of entities, both sequence and
+     * map like. Elements of entities not managed by the loader are ignored.
+     *
+     * @warning
+     * Identifiers are mapped in place. Therefore, this function must be invoked
+     * exactly once after restoring the elements of the given type.
+     *
+     * @tparam Type Type of elements to update.
+     * @tparam Member Types of members to update.
+     * @param member Members to update.
+     * @return A valid loader to continue restoring data.
+     */
+    template<typename Type, typename... Member>
+    basic_continuous_loader &remap(Member Type::*...member) {
+        auto &storage = reg->template storage<Type>();
+
+        each([this, &storage, member...](const entity_type local) {
+            if(storage.contains(local)) {
+                auto &instance = storage.get(local);
+                (update(instance, member), ...);
+            }
+        });
+
+        return *this;
+    }
+
+private:
+    remote_container_type remloc;
+    registry_type *reg;
+};
+
+/**
+ * @brief Utility class to create memory images from a registry.
+ *
+ * A memory image is a versioned, position independent binary layout made of a
+ * header, a section per storage and a table of sections at the end.<br/>
+ * Each section contains the identifiers of the entities followed by their
+ * elements, if any. Therefore, only trivially copyable types are supported.
+ *
+ * The image is meant to be written to disk as is and to be mapped in memory
+ * later on, so that its sections are restored on demand by an image loader.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_image_writer {
+    static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
+
+    void append(const void *value, const std::size_t len) {
+        const auto *elem = static_cast<const std::byte *>(value);
+        buffer.insert(buffer.end(), elem, elem + len);
+    }
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an instance that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_image_writer(const registry_type &source)
+        : reg{&source},
+          buffer(sizeof(internal::image_header)),
+          table{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_image_writer(const basic_image_writer &) = delete;
+
+    /*! @brief Default move constructor. */
+    basic_image_writer(basic_image_writer &&) noexcept = default;
+
+    /*! @brief Default destructor. */
+    ~basic_image_writer() = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This writer.
+     */
+    basic_image_writer &operator=(const basic_image_writer &) = delete;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This writer.
+     */
+    basic_image_writer &operator=(basic_image_writer &&) noexcept = default;
+
+    /**
+     * @brief Appends a section for all elements of a type to the image.
+     *
+     * Storage that don't exist are ignored. Each storage is meant to be added
+     * to an image at most once.
+     *
+     * @tparam Type Type of elements to serialize.
+     * @param id Optional name used to map the storage within the registry.
+     * @return An object of this type to continue creating the image.
+     */
+    template<typename Type>
+    basic_image_writer &get(const id_type id = type_hash<Type>::value()) {
+        ENTT_ASSERT(std::none_of(table.cbegin(), table.cend(), [id](const auto &elem) { return elem.id == id; }), "Section already exists");
+
+        if(const auto *storage = reg->template storage<Type>(id); storage) {
+            using storage_type = typename registry_type::template storage_for_type<Type>;
+            const typename registry_type::common_type &base = *storage;
+            internal::image_section section{id, buffer.size(), 0u, 0u};
+
+            if constexpr(std::is_same_v<Type, entity_type>) {
+                section.length = base.size();
+                section.extra = storage->free_list();
+                append(base.data(), base.size() * sizeof(entity_type));
+            } else if constexpr(internal::is_bulk_storage<storage_type>::value) {
+                constexpr auto page_size = component_traits<typename storage_type::value_type, entity_type>::page_size;
+                const auto len = storage->size();
+
+                section.length = len;
+                section.extra = sizeof(typename storage_type::value_type);
+                append(base.data(), len * sizeof(entity_type));
+
+                for(std::size_t pos{}; pos < len; pos += page_size) {
+                    append(storage->raw()[pos / page_size], (std::min)(page_size, len - pos) * sizeof(typename storage_type::value_type));
+                }
+            } else {
+                for(auto it = base.rbegin(), last = base.rend(); it != last; ++it) {
+                    if(const auto entt = *it; entt != tombstone) {
+                        append(&entt, sizeof(entt));
+                        ++section.length;
+                    }
+                }
+
+                if constexpr(std::tuple_size_v<decltype(storage->get_as_tuple({}))> != 0u) {
+                    static_assert(std::is_trivially_copyable_v<typename storage_type::value_type>, "Trivially copyable types required");
+                    section.extra = sizeof(typename storage_type::value_type);
+
+                    for(auto it = base.rbegin(), last = base.rend(); it != last; ++it) {
+                        if(const auto entt = *it; entt != tombstone) {
+                            append(&storage->get(entt), sizeof(typename storage_type::value_type));
+                        }
+                    }
+                }
+            }
+
+            table.push_back(section);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns the image created so far.
+     * @return A copy of the image, header and table of sections included.
+     */
+    [[nodiscard]] std::vector<std::byte> image() const {
+        const internal::image_header header{internal::image_magic, internal::image_version, table.size(), buffer.size()};
+        const auto *first = reinterpret_cast<const std::byte *>(table.data());
+        std::vector<std::byte> result{};
+
+        result.reserve(buffer.size() + table.size() * sizeof(internal::image_section));
+        result.insert(result.end(), buffer.cbegin(), buffer.cend());
+        result.insert(result.end(), first, first + table.size() * sizeof(internal::image_section));
+        std::memcpy(result.data(), &header, sizeof(header));
+
+        return result;
+    }
+
+private:
+    const registry_type *reg;
+    std::vector<std::byte> buffer;
+    std::vector<internal::image_section> table;
+};
+
+/**
+ * @brief Utility class to restore a memory image, eventually on demand.
+ *
+ * An image loader requires that the destination registry be empty and keeps
+ * intact the identifiers that the entities originally had.<br/>
+ * Sections are either restored immediately or attached to the registry, in
+ * which case they are restored the first time the corresponding storage is
+ * created through a non-const member function of the registry.
+ *
+ * @warning
+ * The image is not copied. Its memory (for example, a mapped file) as well as
+ * the registry must outlive the loader. Sections that are still pending when
+ * the loader is destroyed are discarded.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_image_loader {
+    static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
+    using traits_type = entt_traits<typename Registry::entity_type>;
+
+    template<typename Type>
+    void load(const id_type id) {
+        const auto &section = sections.find(id)->second;
+        auto &storage = reg->template storage<Type>(id);
+        const auto length = static_cast<std::size_t>(section.length);
+        std::vector<typename Registry::entity_type> entities(length);
+
+        if(length != 0u) {
+            std::memcpy(entities.data(), image + section.offset, length * sizeof(typename Registry::entity_type));
+        }
+
+        if constexpr(std::is_same_v<Type, entity_type>) {
+            entity_type placeholder{};
+
+            storage.reserve(length);
+
+            for(auto entity: entities) {
+                storage.generate(entity);
+                placeholder = (entity > placeholder) ? entity : placeholder;
+            }
+
+            storage.start_from(traits_type::next(placeholder));
+            storage.free_list(static_cast<std::size_t>(section.extra));
+        } else {
+            auto &other = reg->template storage<entity_type>();
+
+            for(auto entt: entities) {
+                [[maybe_unused]] const auto entity = other.contains(entt) ? entt : other.generate(entt);
+                ENTT_ASSERT(entity == entt, "Entity not available for use");
+            }
+
+            if constexpr(std::tuple_size_v<decltype(storage.get_as_tuple({}))> == 0u) {
+                storage.insert(entities.begin(), entities.end());
+            } else {
+                using value_type = typename std::remove_reference_t<decltype(storage)>::value_type;
+                static_assert(std::is_trivially_copyable_v<value_type>, "Trivially copyable types required");
+                ENTT_ASSERT(section.extra == sizeof(value_type), "Invalid element size");
+                std::vector<value_type> elements(length);
+
+                if(length != 0u) {
+                    std::memcpy(static_cast<void *>(elements.data()), image + section.offset + length * sizeof(entity_type), length * sizeof(value_type));
+                }
+
+                storage.insert(entities.begin(), entities.end(), elements.begin());
+            }
+        }
+    }
+
+    void attach(Registry &, const id_type id) {
+        if(const auto it = deferred.find(id); it != deferred.end()) {
+            const auto func = it->second;
+            deferred.erase(it);
+            (this->*func)(id);
+        }
+    }
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an instance that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     * @param data A valid pointer to the beginning of an image.
+     * @param len The size of the image in bytes.
+     */
+    basic_image_loader(registry_type &source, const void *data, [[maybe_unused]] const size_type len)
+        : reg{&source},
+          image{static_cast<const std::byte *>(data)},
+          sections{},
+          deferred{} {
+        // restoring an image requires a clean registry
+        ENTT_ASSERT(reg->template storage<entity_type>().free_list() == 0u, "Registry must be empty");
+        ENTT_ASSERT(len >= sizeof(internal::image_header), "Invalid image");
+
+        internal::image_header header{};
+        std::memcpy(&header, image, sizeof(header));
+
+        ENTT_ASSERT((header.magic == internal::image_magic) && (header.version == internal::image_version), "Invalid image");
+        ENTT_ASSERT((header.table + header.count * sizeof(internal::image_section)) <= len, "Invalid image");
+
+        for(std::uint64_t pos{}; pos < header.count; ++pos) {
+            internal::image_section section{};
+            std::memcpy(&section, image + header.table + pos * sizeof(section), sizeof(section));
+            ENTT_ASSERT((section.offset + section.length * (sizeof(entity_type) + section.extra)) <= header.table, "Invalid section");
+            sections.emplace(static_cast<id_type>(section.id), section);
+        }
+
+        reg->on_storage().template connect<&basic_image_loader::attach>(*this);
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_image_loader(const basic_image_loader &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_image_loader(basic_image_loader &&) = delete;
+
+    /*! @brief Destructor, pending sections are discarded. */
+    ~basic_image_loader() {
+        reg->on_storage().disconnect(this);
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This loader.
+     */
+    basic_image_loader &operator=(const basic_image_loader &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This loader.
+     */
+    basic_image_loader &operator=(basic_image_loader &&) = delete;
+
+    /**
+     * @brief Restores all elements of a type with associated identifiers.
+     *
+     * Sections that aren't part of the image are ignored.<br/>
+     * Once entities are restored, sections that aren't pending can be restored
+     * concurrently, provided that their storage classes already exist (see
+     * `basic_registry::prepare`) and that no listeners or groups are attached
+     * to them.
+     *
+     * @tparam Type Type of elements to restore.
+     * @param id Optional name used to map the storage within the registry.
+     * @return A valid loader to continue restoring data.
+     */
+    template<typename Type>
+    basic_image_loader &get(const id_type id = type_hash<Type>::value()) {
+        if(contains(id)) {
+            if(pending(id)) {
+                deferred.erase(id);
+            }
+
+            load<Type>(id);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Restores all elements of a type when their storage is created.
+     *
+     * Sections that aren't part of the image are ignored. If the storage
+     * already exists, the section is restored immediately.
+     *
+     * @tparam Type Type of elements to restore.
+     * @param id Optional name used to map the storage within the registry.
+     * @return A valid loader to continue restoring data.
+     */
+    template<typename Type>
+    basic_image_loader &lazy(const id_type id = type_hash<Type>::value()) {
+        if(contains(id)) {
+            if(std::as_const(*reg).template storage<Type>(id) == nullptr) {
+                deferred.insert_or_assign(id, &basic_image_loader::load<Type>);
+            } else {
+                get<Type>(id);
+            }
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Checks if an image contains a given section.
+     * @param id Name used to map the storage within the registry.
+     * @return True if the section is part of the image, false otherwise.
+     */
+    [[nodiscard]] bool contains(const id_type id) const {
+        return sections.contains(id);
+    }
+
+    /**
+     * @brief Checks if a section is waiting for its storage to be created.
+     * @param id Name used to map the storage within the registry.
+     * @return True if the section is pending, false otherwise.
+     */
+    [[nodiscard]] bool pending(const id_type id) const {
+        return deferred.contains(id);
+    }
+
+private:
+    registry_type *reg;
+    const std::byte *image;
+    dense_map<id_type, internal::image_section, identity> sections;
+    dense_map<id_type, void (basic_image_loader::*)(const id_type), identity> deferred;
+};
+
+/**
+ * @brief Utility class to page out cold entities and to fault them back in.
+ *
+ * Paging out a set of entities moves their elements to a memory image (see
+ * `basic_image_writer`), one section per registered storage plus one with the
+ * identifiers of the entities themselves, and removes them from the
+ * registry.<br/>
+ * Entities remain valid in the meantime. Therefore, their identifiers aren't
+ * recycled and references to them stay meaningful. Only trivially copyable
+ * types can be paged out, just like for memory images.
+ *
+ * An example of use is to keep the memory of a registry proportional to the
+ * active entities, with dormant ones stored on disk.
+ *
+ * @warning
+ * Elements are removed from and returned to their storage as usual. Therefore,
+ * listeners are notified in both cases.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_entity_pager {
+    static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
+
+    using entity_list = std::vector<typename Registry::entity_type>;
+    using write_fn_type = void(basic_entity_pager &, const id_type, const entity_list &, std::vector<std::byte> &, std::vector<internal::image_section> &);
+    using read_fn_type = void(basic_entity_pager &, const std::byte *, const internal::image_section &);
+
+    static void append(std::vector<std::byte> &buffer, const void *value, const std::size_t len) {
+        const auto *elem = static_cast<const std::byte *>(value);
+        buffer.insert(buffer.end(), elem, elem + len);
+    }
+
+    template<typename Type>
+    static void write(basic_entity_pager &pager, const id_type id, const entity_list &entities, std::vector<std::byte> &buffer, std::vector<internal::image_section> &table) {
+        if(std::as_const(*pager.reg).template storage<Type>(id) != nullptr) {
+            auto &storage = pager.reg->template storage<Type>(id);
+            internal::image_section section{id, buffer.size(), 0u, 0u};
+            entity_list paged{};
+
+            for(auto entt: entities) {
+                if(storage.contains(entt)) {
+                    append(buffer, &entt, sizeof(entt));
+                    paged.push_back(entt);
+                }
+            }
+
+            section.length = paged.size();
+
+            if constexpr(std::tuple_size_v<decltype(storage.get_as_tuple({}))> != 0u) {
+                using value_type = typename std::remove_reference_t<decltype(storage)>::value_type;
+                static_assert(std::is_trivially_copyable_v<value_type>, "Trivially copyable types required");
+                section.extra = sizeof(value_type);
+
+                for(auto entt: paged) {
+                    append(buffer, &storage.get(entt), sizeof(value_type));
+                }
+            }
+
+            storage.erase(paged.begin(), paged.end());
+            table.push_back(section);
+        }
+    }
+
+    template<typename Type>
+    static void read(basic_entity_pager &pager, const std::byte *image, const internal::image_section &section) {
+        auto &storage = pager.reg->template storage<Type>(static_cast<id_type>(section.id));
+        const auto length = static_cast<std::size_t>(section.length);
+        entity_list entities(length);
+
+        if(length != 0u) {
+            std::memcpy(entities.data(), image + section.offset, length * sizeof(entity_type));
+        }
+
+        if constexpr(std::tuple_size_v<decltype(storage.get_as_tuple({}))> == 0u) {
+            for(auto entt: entities) {
+                // entities destroyed while paged out are discarded
+                if(pager.reg->valid(entt)) {
+                    storage.emplace(entt);
+                }
+            }
+        } else {
+            using value_type = typename std::remove_reference_t<decltype(storage)>::value_type;
+            ENTT_ASSERT(section.extra == sizeof(value_type), "Invalid element size");
+            const auto *elements = image + section.offset + length * sizeof(entity_type);
+            entity_list valid{};
+            std::vector<value_type> values{};
+
+            for(std::size_t pos{}; pos < length; ++pos) {
+                if(pager.reg->valid(entities[pos])) {
+                    valid.push_back(entities[pos]);
+                    std::memcpy(static_cast<void *>(&values.emplace_back()), elements + pos * sizeof(value_type), sizeof(value_type));
+                }
+            }
+
+            storage.insert(valid.begin(), valid.end(), values.begin());
+        }
+    }
+
+public:
+    /*! Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs an instance that is bound to a given registry.
+     * @param source A valid reference to a registry.
+     */
+    basic_entity_pager(registry_type &source)
+        : reg{&source},
+          kinds{},
+          cold{},
+          pages{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_entity_pager(const basic_entity_pager &) = delete;
+
+    /*! @brief Default move constructor. */
+    basic_entity_pager(basic_entity_pager &&) noexcept = default;
+
+    /*! @brief Default destructor. */
+    ~basic_entity_pager() = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This pager.
+     */
+    basic_entity_pager &operator=(const basic_entity_pager &) = delete;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This pager.
+     */
+    basic_entity_pager &operator=(basic_entity_pager &&) noexcept = default;
+
+    /**
+     * @brief Registers a storage whose elements are paged out with entities.
+     * @tparam Type Type of elements to page out.
+     * @param id Optional name used to map the storage within the registry.
+     * @return A valid pager to continue registering storage.
+     */
+    template<typename Type>
+    basic_entity_pager &get(const id_type id = type_hash<Type>::value()) {
+        static_assert(!std::is_same_v<Type, entity_type>, "Entities are never paged out");
+        ENTT_ASSERT(id != type_hash<entity_type>::value(), "Reserved identifier");
+        kinds.insert_or_assign(id, std::make_pair(&basic_entity_pager::write<Type>, &basic_entity_pager::read<Type>));
+        return *this;
+    }
+
+    /**
+     * @brief Pages out a range of entities.
+     *
+     * Elements of the registered storage are moved to the returned image and
+     * removed from the registry, while entities remain valid.<br/>
+     * The image is meant to be written to disk as is and to be passed back to
+     * this function later on.
+     *
+     * @warning
+     * Entities must be valid and not paged out yet.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @return A memory image with the elements of the entities.
+     */
+    template<typename It>
+    [[nodiscard]] std::vector<std::byte> page_out(It first, It last) {
+        std::vector<std::byte> buffer(sizeof(internal::image_header));
+        std::vector<internal::image_section> table{};
+        entity_list entities{};
+
+        for(; first != last; ++first) {
+            ENTT_ASSERT(reg->valid(*first), "Invalid entity");
+            ENTT_ASSERT(!contains(*first), "Entity already paged out");
+            cold.emplace(*first, pages);
+            entities.push_back(*first);
+        }
+
+        table.push_back(internal::image_section{type_hash<entity_type>::value(), buffer.size(), entities.size(), 0u});
+        append(buffer, entities.data(), entities.size() * sizeof(entity_type));
+
+        for(auto &&elem: kinds) {
+            elem.second.first(*this, elem.first, entities, buffer, table);
+        }
+
+        const internal::image_header header{internal::image_magic, internal::image_version, table.size(), buffer.size()};
+        append(buffer, table.data(), table.size() * sizeof(internal::image_section));
+        std::memcpy(buffer.data(), &header, sizeof(header));
+        ++pages;
+
+        return buffer;
+    }
+
+    /**
+     * @brief Faults back in all the entities of an image returned by a
+     * previous call to `page_out`.
+     *
+     * Sections of storage that aren't registered are ignored. Entities that
+     * were destroyed while paged out are discarded.
+     *
+     * @param data A valid pointer to the beginning of an image.
+     * @param len The size of the image in bytes.
+     * @return A valid pager to continue paging entities.
+     */
+    basic_entity_pager &page_in(const void *data, [[maybe_unused]] const size_type len) {
+        const auto *image = static_cast<const std::byte *>(data);
+        internal::image_header header{};
+
+        ENTT_ASSERT(len >= sizeof(internal::image_header), "Invalid image");
+        std::memcpy(&header, image, sizeof(header));
+        ENTT_ASSERT((header.magic == internal::image_magic) && (header.version == internal::image_version), "Invalid image");
+        ENTT_ASSERT((header.table + header.count * sizeof(internal::image_section)) <= len, "Invalid image");
+
+        for(std::uint64_t pos{}; pos < header.count; ++pos) {
+            internal::image_section section{};
+            std::memcpy(&section, image + header.table + pos * sizeof(section), sizeof(section));
+            ENTT_ASSERT((section.offset + section.length * (sizeof(entity_type) + section.extra)) <= header.table, "Invalid section");
+
+            if(const auto id = static_cast<id_type>(section.id); id == type_hash<entity_type>::value()) {
+                for(std::uint64_t next{}; next < section.length; ++next) {
+                    entity_type entt{};
+                    std::memcpy(&entt, image + section.offset + next * sizeof(entity_type), sizeof(entity_type));
+                    cold.erase(entt);
+                }
+            } else if(const auto it = kinds.find(id); it != kinds.end()) {
+                it->second.second(*this, image, section);
+            }
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Checks if an entity is paged out.
+     * @param entt A valid identifier.
+     * @return True if the entity is paged out, false otherwise.
+     */
+    [[nodiscard]] bool contains(const entity_type entt) const {
+        return cold.contains(entt);
+    }
+
+    /**
+     * @brief Returns the page of an entity, that is, the ordinal number of the
+     * call to `page_out` that paged it out.
+     *
+     * @warning
+     * Attempting to use an entity that isn't paged out results in undefined
+     * behavior.
+     *
+     * @param entt A valid identifier.
+     * @return The page of the given entity.
+     */
+    [[nodiscard]] size_type page(const entity_type entt) const {
+        ENTT_ASSERT(contains(entt), "Entity not paged out");
+        return cold.find(entt)->second;
+    }
+
+    /**
+     * @brief Returns the number of entities paged out.
+     * @return Number of entities paged out.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return cold.size();
+    }
+
 private:
-    dense_map<typename traits_type::entity_type, std::pair<entity_type, entity_type>> remloc;
     registry_type *reg;
+    dense_map<id_type, std::pair<write_fn_type *, read_fn_type *>, identity> kinds;
+    dense_map<entity_type, size_type> cold;
+    size_type pages;
+};
+
+/**
+ * @brief Default codec for packed archives, elements are copied byte by byte.
+ *
+ * Specializations are meant to provide custom encodings for a type, such as
+ * quantized values.
+ *
+ * @tparam Type Element type.
+ */
+template<typename Type, typename>
+struct snapshot_codec {
+    static_assert(std::is_trivially_copyable_v<Type>, "Trivially copyable types required");
+
+    /**
+     * @brief Encodes an element.
+     * @param out The buffer to which to append the encoded element.
+     * @param value The element to encode.
+     */
+    static void encode(std::vector<std::byte> &out, const Type &value) {
+        const auto *first = reinterpret_cast<const std::byte *>(&value);
+        out.insert(out.end(), first, first + sizeof(Type));
+    }
+
+    /**
+     * @brief Decodes an element.
+     * @param first A pointer to the first byte of the encoded element.
+     * @param last A pointer past the last byte of the encoded data.
+     * @param value The element to decode.
+     * @return A pointer past the last byte of the encoded element.
+     */
+    [[nodiscard]] static const std::byte *decode(const std::byte *first, [[maybe_unused]] const std::byte *last, Type &value) {
+        ENTT_ASSERT(static_cast<std::size_t>(last - first) >= sizeof(Type), "Unexpected end of data");
+        std::memcpy(static_cast<void *>(&value), first, sizeof(Type));
+        return first + sizeof(Type);
+    }
+};
+
+/**
+ * @brief Codec for integral types, values are packed as (zigzag) varints.
+ * @tparam Type Element type.
+ */
+template<typename Type>
+struct snapshot_codec<Type, std::enable_if_t<std::is_integral_v<Type>>> {
+    /**
+     * @brief Encodes an element.
+     * @param out The buffer to which to append the encoded element.
+     * @param value The element to encode.
+     */
+    static void encode(std::vector<std::byte> &out, const Type value) {
+        if constexpr(std::is_signed_v<Type>) {
+            internal::encode_varint(out, internal::zigzag(static_cast<std::int64_t>(value)));
+        } else {
+            internal::encode_varint(out, static_cast<std::uint64_t>(value));
+        }
+    }
+
+    /**
+     * @brief Decodes an element.
+     * @param first A pointer to the first byte of the encoded element.
+     * @param last A pointer past the last byte of the encoded data.
+     * @param value The element to decode.
+     * @return A pointer past the last byte of the encoded element.
+     */
+    [[nodiscard]] static const std::byte *decode(const std::byte *first, const std::byte *last, Type &value) {
+        std::uint64_t elem{};
+        first = internal::decode_varint(first, last, elem);
+
+        if constexpr(std::is_signed_v<Type>) {
+            value = static_cast<Type>(internal::unzigzag(elem));
+        } else {
+            value = static_cast<Type>(elem);
+        }
+
+        return first;
+    }
+};
+
+/**
+ * @brief Output archive that packs a snapshot in a buffer of bytes.
+ *
+ * Entities are delta encoded with respect to the previous one and packed as
+ * varints, as well as integral values. Any other element goes through its
+ * codec (see `snapshot_codec`).<br/>
+ * When a block codec is provided, the archive also offers the bulk path of
+ * snapshots and each block (packed arrays of entities or pages of elements)
+ * goes through the block codec. A block codec exposes the following member
+ * function, that appends the encoded block to the given buffer:
+ *
+ * @code{.cpp}
+ * void encode(const std::byte *, std::size_t, std::vector<std::byte> &);
+ * @endcode
+ *
+ * @tparam Entity A valid entity type.
+ * @tparam Block Optional block codec type.
+ */
+template<typename Entity, typename Block>
+class basic_packed_output_archive {
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Block codec type. */
+    using block_codec_type = Block;
+
+    /*! @brief Default constructor. */
+    basic_packed_output_archive()
+        : buffer{},
+          scratch{},
+          block{},
+          last{} {}
+
+    /**
+     * @brief Constructs an archive with a given block codec.
+     * @param codec The block codec to use.
+     */
+    template<typename Codec = block_codec_type, typename = std::enable_if_t<!std::is_void_v<Codec>>>
+    explicit basic_packed_output_archive(Codec codec)
+        : buffer{},
+          scratch{},
+          block{std::move(codec)},
+          last{} {}
+
+    /**
+     * @brief Appends an element to the archive.
+     * @tparam Type Type of element to append.
+     * @param value The element to append.
+     */
+    template<typename Type>
+    void operator()(const Type &value) {
+        if constexpr(std::is_same_v<Type, entity_type>) {
+            const auto curr = static_cast<std::int64_t>(to_integral(value));
+            internal::encode_varint(buffer, internal::zigzag(curr - static_cast<std::int64_t>(to_integral(last))));
+            last = value;
+        } else {
+            snapshot_codec<Type>::encode(buffer, value);
+        }
+    }
+
+    /**
+     * @brief Appends a block of bytes to the archive.
+     * @tparam Codec Block codec type.
+     * @param data A pointer to the first byte of the block.
+     * @param len The size of the block in bytes.
+     */
+    template<typename Codec = block_codec_type>
+    std::enable_if_t<!std::is_void_v<Codec>> write(const void *data, const std::size_t len) {
+        scratch.clear();
+        block.encode(static_cast<const std::byte *>(data), len, scratch);
+        internal::encode_varint(buffer, scratch.size());
+        buffer.insert(buffer.end(), scratch.cbegin(), scratch.cend());
+    }
+
+    /**
+     * @brief Returns the packed data.
+     * @return The packed data.
+     */
+    [[nodiscard]] const std::vector<std::byte> &data() const noexcept {
+        return buffer;
+    }
+
+private:
+    std::vector<std::byte> buffer;
+    std::vector<std::byte> scratch;
+    std::conditional_t<std::is_void_v<block_codec_type>, internal::no_block_codec, block_codec_type> block;
+    entity_type last;
+};
+
+/**
+ * @brief Input archive that unpacks a snapshot from a buffer of bytes.
+ *
+ * This is the counterpart of the packed output archive. When a block codec is
+ * provided, it exposes the following member function, that decodes a block in
+ * place of the output buffer of the given size:
+ *
+ * @code{.cpp}
+ * void decode(const std::byte *, std::size_t, std::byte *, std::size_t);
+ * @endcode
+ *
+ * @warning
+ * The archive doesn't copy the data. The data must outlive the archive.
+ *
+ * @tparam Entity A valid entity type.
+ * @tparam Block Optional block codec type.
+ */
+template<typename Entity, typename Block>
+class basic_packed_input_archive {
+    using traits_type = entt_traits<Entity>;
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Block codec type. */
+    using block_codec_type = Block;
+
+    /**
+     * @brief Constructs an archive from a buffer of bytes.
+     * @param data A pointer to the first byte of the packed data.
+     * @param len The size of the packed data in bytes.
+     */
+    basic_packed_input_archive(const void *data, const std::size_t len)
+        : first{static_cast<const std::byte *>(data)},
+          end{first + len},
+          block{},
+          last{} {}
+
+    /**
+     * @brief Constructs an archive from a buffer of bytes.
+     * @tparam Codec Block codec type.
+     * @param data A pointer to the first byte of the packed data.
+     * @param len The size of the packed data in bytes.
+     * @param codec The block codec to use.
+     */
+    template<typename Codec = block_codec_type, typename = std::enable_if_t<!std::is_void_v<Codec>>>
+    basic_packed_input_archive(const void *data, const std::size_t len, Codec codec)
+        : first{static_cast<const std::byte *>(data)},
+          end{first + len},
+          block{std::move(codec)},
+          last{} {}
+
+    /**
+     * @brief Reads the next element from the archive.
+     * @tparam Type Type of element to read.
+     * @param value The element to read.
+     */
+    template<typename Type>
+    void operator()(Type &value) {
+        if constexpr(std::is_same_v<Type, entity_type>) {
+            std::uint64_t elem{};
+            first = internal::decode_varint(first, end, elem);
+            value = static_cast<entity_type>(static_cast<typename traits_type::entity_type>(static_cast<std::int64_t>(to_integral(last)) + internal::unzigzag(elem)));
+            last = value;
+        } else {
+            first = snapshot_codec<Type>::decode(first, end, value);
+        }
+    }
+
+    /**
+     * @brief Reads the next block of bytes from the archive.
+     * @tparam Codec Block codec type.
+     * @param data A pointer to the first byte of the block to fill.
+     * @param len The size of the block in bytes.
+     */
+    template<typename Codec = block_codec_type>
+    std::enable_if_t<!std::is_void_v<Codec>> read(void *data, const std::size_t len) {
+        std::uint64_t size{};
+        first = internal::decode_varint(first, end, size);
+        ENTT_ASSERT(size <= static_cast<std::uint64_t>(end - first), "Unexpected end of data");
+        block.decode(first, static_cast<std::size_t>(size), static_cast<std::byte *>(data), len);
+        first += size;
+    }
+
+    /**
+     * @brief Returns the number of bytes still to read.
+     * @return The number of bytes still to read.
+     */
+    [[nodiscard]] std::size_t size() const noexcept {
+        return static_cast<std::size_t>(end - first);
+    }
+
+private:
+    const std::byte *first;
+    const std::byte *end;
+    std::conditional_t<std::is_void_v<block_codec_type>, internal::no_block_codec, block_codec_type> block;
+    entity_type last;
 };
 
 } // namespace entt
@@ -0,0 +1,932 @@
+#ifndef ENTT_ENTITY_SOA_STORAGE_HPP
+#define ENTT_ENTITY_SOA_STORAGE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/iterator.hpp"
+#include "../core/type_info.hpp"
+#include "../core/type_traits.hpp"
+#include "component.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+#include "sparse_set.hpp"
+
+namespace entt {
+
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+template<typename Type, auto Member>
+using soa_column_t = std::remove_reference_t<decltype(std::declval<std::remove_const_t<Type> &>().*Member)>;
+
+template<typename Container, typename Reference>
+class soa_storage_iterator final {
+    friend soa_storage_iterator<const Container, typename Reference::const_reference>;
+
+    template<std::size_t... Index>
+    [[nodiscard]] constexpr Reference fetch(const std::size_t pos, std::index_sequence<Index...>) const noexcept {
+        return Reference{std::get<Index>(*payload)[pos]...};
+    }
+
+public:
+    using value_type = typename Reference::value_type;
+    using pointer = input_iterator_pointer<Reference>;
+    using reference = Reference;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+
+    constexpr soa_storage_iterator() noexcept = default;
+
+    constexpr soa_storage_iterator(Container *ref, const difference_type idx) noexcept
+        : payload{ref},
+          offset{idx} {}
+
+    template<typename Other, typename Ref, typename = std::enable_if_t<std::is_same_v<Container, const Other>>>
+    constexpr soa_storage_iterator(const soa_storage_iterator<Other, Ref> &other) noexcept
+        : soa_storage_iterator{other.payload, other.offset} {}
+
+    constexpr soa_storage_iterator &operator++() noexcept {
+        return --offset, *this;
+    }
+
+    constexpr soa_storage_iterator operator++(int) noexcept {
+        const soa_storage_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    constexpr soa_storage_iterator &operator--() noexcept {
+        return ++offset, *this;
+    }
+
+    constexpr soa_storage_iterator operator--(int) noexcept {
+        const soa_storage_iterator orig = *this;
+        return operator--(), orig;
+    }
+
+    constexpr soa_storage_iterator &operator+=(const difference_type value) noexcept {
+        offset -= value;
+        return *this;
+    }
+
+    constexpr soa_storage_iterator operator+(const difference_type value) const noexcept {
+        soa_storage_iterator copy = *this;
+        return (copy += value);
+    }
+
+    constexpr soa_storage_iterator &operator-=(const difference_type value) noexcept {
+        return (*this += -value);
+    }
+
+    constexpr soa_storage_iterator operator-(const difference_type value) const noexcept {
+        return (*this + -value);
+    }
+
+    [[nodiscard]] constexpr reference operator[](const difference_type value) const noexcept {
+        return fetch(static_cast<std::size_t>(index() - value), std::make_index_sequence<std::tuple_size_v<std::remove_const_t<Container>>>{});
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept {
+        return {operator[](0)};
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+        return operator[](0);
+    }
+
+    [[nodiscard]] constexpr difference_type index() const noexcept {
+        return offset - 1;
+    }
+
+private:
+    Container *payload{};
+    difference_type offset{};
+};
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr std::ptrdiff_t operator-(const soa_storage_iterator<Lhs...> &lhs, const soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return rhs.index() - lhs.index();
+}
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr bool operator==(const soa_storage_iterator<Lhs...> &lhs, const soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return lhs.index() == rhs.index();
+}
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr bool operator!=(const soa_storage_iterator<Lhs...> &lhs, const soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr bool operator<(const soa_storage_iterator<Lhs...> &lhs, const soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return lhs.index() > rhs.index();
+}
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr bool operator>(const soa_storage_iterator<Lhs...> &lhs, const soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return rhs < lhs;
+}
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr bool operator<=(const soa_storage_iterator<Lhs...> &lhs, const soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return !(lhs > rhs);
+}
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr bool operator>=(const soa_storage_iterator<Lhs...> &lhs, const soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return !(lhs < rhs);
+}
+
+template<typename It, typename Other>
+class extended_soa_storage_iterator final {
+    template<typename, typename>
+    friend class extended_soa_storage_iterator;
+
+public:
+    using iterator_type = It;
+    using value_type = std::tuple<typename std::iterator_traits<It>::value_type, typename Other::reference>;
+    using pointer = input_iterator_pointer<value_type>;
+    using reference = value_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+
+    constexpr extended_soa_storage_iterator()
+        : it{},
+          other{} {}
+
+    constexpr extended_soa_storage_iterator(iterator_type base, Other elem)
+        : it{base},
+          other{elem} {}
+
+    template<typename Args, typename = std::enable_if_t<!std::is_same_v<Other, Args> && std::is_constructible_v<Other, Args>>>
+    constexpr extended_soa_storage_iterator(const extended_soa_storage_iterator<It, Args> &elem)
+        : it{elem.it},
+          other{elem.other} {}
+
+    constexpr extended_soa_storage_iterator &operator++() noexcept {
+        return ++it, ++other, *this;
+    }
+
+    constexpr extended_soa_storage_iterator operator++(int) noexcept {
+        const extended_soa_storage_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept {
+        return operator*();
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+        return {*it, *other};
+    }
+
+    [[nodiscard]] constexpr iterator_type base() const noexcept {
+        return it;
+    }
+
+    template<typename... Lhs, typename... Rhs>
+    friend constexpr bool operator==(const extended_soa_storage_iterator<Lhs...> &, const extended_soa_storage_iterator<Rhs...> &) noexcept;
+
+private:
+    It it;
+    Other other;
+};
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr bool operator==(const extended_soa_storage_iterator<Lhs...> &lhs, const extended_soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return lhs.it == rhs.it;
+}
+
+template<typename... Lhs, typename... Rhs>
+[[nodiscard]] constexpr bool operator!=(const extended_soa_storage_iterator<Lhs...> &lhs, const extended_soa_storage_iterator<Rhs...> &rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Proxy reference to an element stored as a structure of arrays.
+ *
+ * A proxy reference refers to all the data members of an element at once. It
+ * grants access to the single members and can be converted to or assigned from
+ * an instance of the element type.
+ *
+ * @tparam Type Element type, possibly const qualified.
+ * @tparam Member Pointers to the data members of the element type.
+ */
+template<typename Type, auto... Member>
+class soa_reference<Type, value_list<Member...>> final {
+    template<typename, typename>
+    friend class soa_reference;
+
+    template<auto Candidate>
+    static constexpr std::size_t index_of = value_list_index_v<Candidate, value_list<Member...>>;
+
+    template<typename Other, std::size_t... Index>
+    soa_reference(const Other &other, std::index_sequence<Index...>) noexcept
+        : elem{std::get<Index>(other.elem)...} {}
+
+    template<std::size_t... Index>
+    void assign(const typename std::remove_const_t<Type> &value, std::index_sequence<Index...>) const {
+        ((std::get<Index>(elem) = value.*Member), ...);
+    }
+
+public:
+    /*! @brief Element type. */
+    using value_type = std::remove_const_t<Type>;
+    /*! @brief Constant proxy reference type. */
+    using const_reference = soa_reference<const value_type, value_list<Member...>>;
+
+    /**
+     * @brief Constructs a proxy reference from references to the data members.
+     * @param value References to the data members of an element.
+     */
+    soa_reference(constness_as_t<internal::soa_column_t<Type, Member>, Type> &...value) noexcept
+        : elem{value...} {}
+
+    /**
+     * @brief Constructs a constant proxy reference from a non-constant one.
+     * @tparam Other Non-constant element type.
+     * @param other The proxy reference to copy from.
+     */
+    template<typename Other, typename = std::enable_if_t<std::is_const_v<Type> && std::is_same_v<Other, value_type>>>
+    soa_reference(const soa_reference<Other, value_list<Member...>> &other) noexcept
+        : soa_reference{other, std::index_sequence_for<decltype(Member)...>{}} {}
+
+    /**
+     * @brief Assigns the data members of an element to the referenced ones.
+     * @param value An instance of the element type.
+     * @return This proxy reference.
+     */
+    const soa_reference &operator=(const value_type &value) const {
+        static_assert(!std::is_const_v<Type>, "Invalid assignment to a constant reference");
+        assign(value, std::index_sequence_for<decltype(Member)...>{});
+        return *this;
+    }
+
+    /*! @copydoc operator= */
+    soa_reference &operator=(const value_type &value) {
+        static_cast<const soa_reference &>(*this) = value;
+        return *this;
+    }
+
+    /**
+     * @brief Returns a reference to a given data member.
+     * @tparam Candidate Pointer to the data member to return.
+     * @return A reference to the requested data member.
+     */
+    template<auto Candidate>
+    [[nodiscard]] auto &get() const noexcept {
+        return std::get<index_of<Candidate>>(elem);
+    }
+
+    /**
+     * @brief Returns a copy of the referenced element.
+     * @return A copy of the referenced element.
+     */
+    [[nodiscard]] operator value_type() const {
+        value_type value{};
+        ((value.*Member = get<Member>()), ...);
+        return value;
+    }
+
+private:
+    std::tuple<constness_as_t<internal::soa_column_t<Type, Member>, Type> &...> elem;
+};
+
+/**
+ * @brief Structure of arrays storage implementation.
+ *
+ * Data members of the elements are stored in separate columns rather than as
+ * contiguous objects. The type of the elements must list its data members as
+ * a nested `soa_columns` value list, as in the following example:
+ *
+ * @code{.cpp}
+ * struct position {
+ *     float x;
+ *     float y;
+ *
+ *     using soa_columns = entt::value_list<&position::x, &position::y>;
+ * };
+ * @endcode
+ *
+ * Data members not listed are not stored. Elements are returned in the form of
+ * proxy references. Each column is a contiguous array that follows the order of
+ * the entities in the packed array.
+ *
+ * @warning
+ * Only the swap-and-pop deletion policy is supported. Moreover, elements are
+ * not stored as objects, so the type-erased `value` function of the underlying
+ * sparse set always returns a null pointer.
+ *
+ * @tparam Type Element type.
+ * @tparam Entity A valid entity type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Type, typename Entity, typename Allocator>
+class basic_soa_storage: public basic_sparse_set<Entity, typename std::allocator_traits<Allocator>::template rebind_alloc<Entity>> {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
+    static_assert(!component_traits<Type, Entity>::in_place_delete, "Pointer stability not supported");
+    using underlying_type = basic_sparse_set<Entity, typename alloc_traits::template rebind_alloc<Entity>>;
+    using underlying_iterator = typename underlying_type::basic_iterator;
+    using columns = typename Type::soa_columns;
+
+    template<typename>
+    struct column_for;
+
+    template<auto... Member>
+    struct column_for<value_list<Member...>> {
+        template<auto Candidate>
+        using allocator_for = typename alloc_traits::template rebind_alloc<internal::soa_column_t<Type, Candidate>>;
+
+        using type = std::tuple<std::vector<internal::soa_column_t<Type, Member>, allocator_for<Member>>...>;
+
+        [[nodiscard]] static type make(const Allocator &allocator) {
+            return type{std::vector<internal::soa_column_t<Type, Member>, allocator_for<Member>>{allocator_for<Member>{allocator}}...};
+        }
+    };
+
+    using container_type = typename column_for<columns>::type;
+
+    template<auto... Member>
+    void push_back(Type &&value, value_list<Member...>) {
+        const auto sz = base_type::size() - 1u;
+
+        ENTT_TRY {
+            (std::get<value_list_index_v<Member, columns>>(payload).push_back(std::move(value.*Member)), ...);
+        }
+        ENTT_CATCH {
+            std::apply([sz](auto &...elem) { (elem.erase(elem.begin() + static_cast<difference_type>((std::min)(sz, elem.size())), elem.end()), ...); }, payload);
+            ENTT_THROW;
+        }
+    }
+
+    auto emplace_element(const Entity entt, const bool force_back, Type value) {
+        const auto it = base_type::try_emplace(entt, force_back);
+
+        ENTT_TRY {
+            push_back(std::move(value), columns{});
+        }
+        ENTT_CATCH {
+            base_type::pop(it, it + 1u);
+            ENTT_THROW;
+        }
+
+        return it;
+    }
+
+    template<std::size_t... Index>
+    [[nodiscard]] auto element_at(const std::size_t pos, std::index_sequence<Index...>) const {
+        return const_reference{std::get<Index>(payload)[pos]...};
+    }
+
+    template<std::size_t... Index>
+    [[nodiscard]] auto element_at(const std::size_t pos, std::index_sequence<Index...>) {
+        return reference{std::get<Index>(payload)[pos]...};
+    }
+
+    [[nodiscard]] auto element_at(const std::size_t pos) const {
+        return element_at(pos, std::make_index_sequence<std::tuple_size_v<container_type>>{});
+    }
+
+    [[nodiscard]] auto element_at(const std::size_t pos) {
+        return element_at(pos, std::make_index_sequence<std::tuple_size_v<container_type>>{});
+    }
+
+private:
+    void swap_or_move([[maybe_unused]] const std::size_t from, [[maybe_unused]] const std::size_t to) override {
+        std::apply([from, to](auto &...elem) { using std::swap; (swap(elem[from], elem[to]), ...); }, payload);
+    }
+
+protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        for(; first != last; ++first) {
+            // cannot use first.index() because it would break with cross iterators
+            if(const auto pos = base_type::index(*first); pos != (base_type::size() - 1u)) {
+                std::apply([pos](auto &...elem) { ((elem[pos] = std::move(elem.back())), ...); }, payload);
+            }
+
+            std::apply([](auto &...elem) { (elem.pop_back(), ...); }, payload);
+            base_type::swap_and_pop(first);
+        }
+    }
+
+    /*! @brief Erases all entities of a storage. */
+    void pop_all() override {
+        base_type::pop_all();
+        std::apply([](auto &...elem) { (elem.clear(), ...); }, payload);
+    }
+
+    /**
+     * @brief Copies entities and elements from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from(const underlying_type &other) override {
+        base_type::copy_from(other);
+        payload = static_cast<const basic_soa_storage &>(other).payload;
+    }
+
+    /**
+     * @brief Assigns an entity to a storage.
+     * @param entt A valid identifier.
+     * @param value Optional opaque value.
+     * @param force_back Force back insertion.
+     * @return Iterator pointing to the emplaced element.
+     */
+    underlying_iterator try_emplace([[maybe_unused]] const Entity entt, [[maybe_unused]] const bool force_back, const void *value) override {
+        if(value != nullptr) {
+            if constexpr(std::is_copy_constructible_v<element_type>) {
+                return emplace_element(entt, force_back, *static_cast<const element_type *>(value));
+            } else {
+                return base_type::end();
+            }
+        } else {
+            if constexpr(std::is_default_constructible_v<element_type>) {
+                return emplace_element(entt, force_back, element_type{});
+            } else {
+                return base_type::end();
+            }
+        }
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Base type. */
+    using base_type = underlying_type;
+    /*! @brief Element type. */
+    using element_type = Type;
+    /*! @brief Type of the objects assigned to entities. */
+    using value_type = element_type;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Signed integer type. */
+    using difference_type = std::ptrdiff_t;
+    /*! @brief Proxy reference type to contained elements. */
+    using reference = soa_reference<element_type>;
+    /*! @brief Constant proxy reference type to contained elements. */
+    using const_reference = soa_reference<const element_type>;
+    /*! @brief Random access iterator type. */
+    using iterator = internal::soa_storage_iterator<container_type, reference>;
+    /*! @brief Constant random access iterator type. */
+    using const_iterator = internal::soa_storage_iterator<const container_type, const_reference>;
+    /*! @brief Reverse iterator type. */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    /*! @brief Constant reverse iterator type. */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    /*! @brief Extended iterable storage proxy. */
+    using iterable = iterable_adaptor<internal::extended_soa_storage_iterator<typename base_type::iterator, iterator>>;
+    /*! @brief Constant extended iterable storage proxy. */
+    using const_iterable = iterable_adaptor<internal::extended_soa_storage_iterator<typename base_type::const_iterator, const_iterator>>;
+    /*! @brief Extended reverse iterable storage proxy. */
+    using reverse_iterable = iterable_adaptor<internal::extended_soa_storage_iterator<typename base_type::reverse_iterator, reverse_iterator>>;
+    /*! @brief Constant extended reverse iterable storage proxy. */
+    using const_reverse_iterable = iterable_adaptor<internal::extended_soa_storage_iterator<typename base_type::const_reverse_iterator, const_reverse_iterator>>;
+    /*! @brief Storage deletion policy. */
+    static constexpr deletion_policy storage_policy{deletion_policy::swap_and_pop};
+
+    /*! @brief Default constructor. */
+    basic_soa_storage()
+        : basic_soa_storage{allocator_type{}} {}
+
+    /**
+     * @brief Constructs an empty storage with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_soa_storage(const allocator_type &allocator)
+        : base_type{type_id<element_type>(), storage_policy, internal::sparse_page_size<component_traits<Type, Entity>, Entity>::value, allocator},
+          payload{column_for<columns>::make(allocator)} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_soa_storage(const basic_soa_storage &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    // NOLINTBEGIN(bugprone-use-after-move)
+    basic_soa_storage(basic_soa_storage &&other) noexcept
+        : base_type{std::move(other)},
+          payload{std::move(other.payload)} {}
+    // NOLINTEND(bugprone-use-after-move)
+
+    /*! @brief Default destructor. */
+    ~basic_soa_storage() override = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This storage.
+     */
+    basic_soa_storage &operator=(const basic_soa_storage &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This storage.
+     */
+    basic_soa_storage &operator=(basic_soa_storage &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given storage.
+     * @param other Storage to exchange the content with.
+     */
+    void swap(basic_soa_storage &other) noexcept {
+        using std::swap;
+        swap(payload, other.payload);
+        base_type::swap(other);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return allocator_type{base_type::get_allocator()};
+    }
+
+    /**
+     * @brief Increases the capacity of a storage.
+     *
+     * If the new capacity is greater than the current capacity, new storage is
+     * allocated, otherwise the method does nothing.
+     *
+     * @param cap Desired capacity.
+     */
+    void reserve(const size_type cap) override {
+        base_type::reserve(cap);
+        std::apply([cap](auto &...elem) { (elem.reserve(cap), ...); }, payload);
+    }
+
+    /**
+     * @brief Returns the number of elements that a storage has currently
+     * allocated space for.
+     * @return Capacity of the storage.
+     */
+    [[nodiscard]] size_type capacity() const noexcept override {
+        return std::get<0>(payload).capacity();
+    }
+
+    /**
+     * @brief Returns the memory used by a storage.
+     * @return The memory used by the storage.
+     */
+    [[nodiscard]] memory_report memory_usage() const noexcept override {
+        auto report = base_type::memory_usage();
+        std::apply([&report](const auto &...elem) { ((report.element_bytes += elem.capacity() * sizeof(typename std::decay_t<decltype(elem)>::value_type)), ...); }, payload);
+        return report;
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() override {
+        base_type::shrink_to_fit();
+        std::apply([](auto &...elem) { (elem.shrink_to_fit(), ...); }, payload);
+    }
+
+    /**
+     * @brief Direct access to the array of a given data member.
+     *
+     * The array contains one value for each entity in the storage, in the same
+     * order as the packed array of entities.
+     *
+     * @tparam Member Pointer to the data member of interest.
+     * @return A pointer to the array of values for the given data member.
+     */
+    template<auto Member>
+    [[nodiscard]] const auto *column() const noexcept {
+        return std::get<value_list_index_v<Member, columns>>(payload).data();
+    }
+
+    /*! @copydoc column */
+    template<auto Member>
+    [[nodiscard]] auto *column() noexcept {
+        return std::get<value_list_index_v<Member, columns>>(payload).data();
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * If the storage is empty, the returned iterator will be equal to `end()`.
+     *
+     * @return An iterator to the first instance of the internal array.
+     */
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        const auto pos = static_cast<difference_type>(base_type::size());
+        return const_iterator{&payload, pos};
+    }
+
+    /*! @copydoc cbegin */
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return cbegin();
+    }
+
+    /*! @copydoc begin */
+    [[nodiscard]] iterator begin() noexcept {
+        const auto pos = static_cast<difference_type>(base_type::size());
+        return iterator{&payload, pos};
+    }
+
+    /**
+     * @brief Returns an iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * internal array.
+     */
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return const_iterator{&payload, {}};
+    }
+
+    /*! @copydoc cend */
+    [[nodiscard]] const_iterator end() const noexcept {
+        return cend();
+    }
+
+    /*! @copydoc end */
+    [[nodiscard]] iterator end() noexcept {
+        return iterator{&payload, {}};
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * If the storage is empty, the returned iterator will be equal to `rend()`.
+     *
+     * @return An iterator to the first instance of the reversed internal array.
+     */
+    [[nodiscard]] const_reverse_iterator crbegin() const noexcept {
+        return std::make_reverse_iterator(cend());
+    }
+
+    /*! @copydoc crbegin */
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept {
+        return crbegin();
+    }
+
+    /*! @copydoc rbegin */
+    [[nodiscard]] reverse_iterator rbegin() noexcept {
+        return std::make_reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     * @return An iterator to the element following the last instance of the
+     * reversed internal array.
+     */
+    [[nodiscard]] const_reverse_iterator crend() const noexcept {
+        return std::make_reverse_iterator(cbegin());
+    }
+
+    /*! @copydoc crend */
+    [[nodiscard]] const_reverse_iterator rend() const noexcept {
+        return crend();
+    }
+
+    /*! @copydoc rend */
+    [[nodiscard]] reverse_iterator rend() noexcept {
+        return std::make_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity.
+     *
+     * @warning
+     * Attempting to use an entity that doesn't belong to the storage results in
+     * undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @return A proxy reference to the object assigned to the entity.
+     */
+    [[nodiscard]] const_reference get(const entity_type entt) const noexcept {
+        return element_at(base_type::index(entt));
+    }
+
+    /*! @copydoc get */
+    [[nodiscard]] reference get(const entity_type entt) noexcept {
+        return element_at(base_type::index(entt));
+    }
+
+    /**
+     * @brief Returns the object assigned to an entity as a tuple.
+     * @param entt A valid identifier.
+     * @return A proxy reference to the object assigned to the entity as a
+     * tuple.
+     */
+    [[nodiscard]] std::tuple<const_reference> get_as_tuple(const entity_type entt) const noexcept {
+        return std::make_tuple(get(entt));
+    }
+
+    /*! @copydoc get_as_tuple */
+    [[nodiscard]] std::tuple<reference> get_as_tuple(const entity_type entt) noexcept {
+        return std::make_tuple(get(entt));
+    }
+
+    /**
+     * @brief Returns the object at a given position in the storage.
+     *
+     * @warning
+     * Attempting to use a position that is out of bounds results in undefined
+     * behavior.
+     *
+     * @param pos A valid position.
+     * @return A proxy reference to the object at the given position.
+     */
+    [[nodiscard]] const_reference at(const size_type pos) const noexcept {
+        ENTT_ASSERT(pos < base_type::size(), "Index out of bounds");
+        return element_at(pos);
+    }
+
+    /*! @copydoc at */
+    [[nodiscard]] reference at(const size_type pos) noexcept {
+        ENTT_ASSERT(pos < base_type::size(), "Index out of bounds");
+        return element_at(pos);
+    }
+
+    /**
+     * @brief Returns the object at a given position in the storage as a tuple.
+     * @param pos A valid position.
+     * @return A proxy reference to the object at the given position as a
+     * tuple.
+     */
+    [[nodiscard]] std::tuple<const_reference> at_as_tuple(const size_type pos) const noexcept {
+        return std::make_tuple(at(pos));
+    }
+
+    /*! @copydoc at_as_tuple */
+    [[nodiscard]] std::tuple<reference> at_as_tuple(const size_type pos) noexcept {
+        return std::make_tuple(at(pos));
+    }
+
+    /**
+     * @brief Assigns an entity to a storage and constructs its object.
+     *
+     * @warning
+     * Attempting to use an entity that already belongs to the storage results
+     * in undefined behavior.
+     *
+     * @tparam Args Types of arguments to use to construct the object.
+     * @param entt A valid identifier.
+     * @param args Parameters to use to construct an object for the entity.
+     * @return A proxy reference to the newly created object.
+     */
+    template<typename... Args>
+    reference emplace(const entity_type entt, Args &&...args) {
+        if constexpr(std::is_aggregate_v<value_type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<value_type>)) {
+            const auto it = emplace_element(entt, false, Type{std::forward<Args>(args)...});
+            return element_at(static_cast<size_type>(it.index()));
+        } else {
+            const auto it = emplace_element(entt, false, Type(std::forward<Args>(args)...));
+            return element_at(static_cast<size_type>(it.index()));
+        }
+    }
+
+    /**
+     * @brief Updates the instance assigned to a given entity in-place.
+     * @tparam Func Types of the function objects to invoke.
+     * @param entt A valid identifier.
+     * @param func Valid function objects.
+     * @return A proxy reference to the updated instance.
+     */
+    template<typename... Func>
+    reference patch(const entity_type entt, Func &&...func) {
+        auto elem = get(entt);
+        (std::forward<Func>(func)(elem), ...);
+        return elem;
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given instance.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the storage
+     * results in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param value An instance of the object to construct.
+     * @return Iterator pointing to the first element inserted, if any.
+     */
+    template<typename It>
+    iterator insert(It first, It last, const value_type &value = {}) {
+        for(; first != last; ++first) {
+            emplace_element(*first, true, value);
+        }
+
+        return begin();
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from a given range.
+     *
+     * @tparam EIt Type of input iterator.
+     * @tparam CIt Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param from An iterator to the first element of the range of objects.
+     * @return Iterator pointing to the first element inserted, if any.
+     */
+    template<typename EIt, typename CIt, typename = std::enable_if_t<std::is_same_v<typename std::iterator_traits<CIt>::value_type, value_type>>>
+    iterator insert(EIt first, EIt last, CIt from) {
+        for(; first != last; ++first, ++from) {
+            emplace_element(*first, true, *from);
+        }
+
+        return begin();
+    }
+
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from the values returned by a generator.
+     *
+     * @tparam It Type of input iterator.
+     * @tparam Func Type of generator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param func A valid generator invoked once per entity.
+     * @return Iterator pointing to the first element inserted, if any.
+     */
+    template<typename It, typename Func>
+    std::enable_if_t<std::is_same_v<std::invoke_result_t<Func &, const entity_type>, value_type> || std::is_constructible_v<value_type, std::invoke_result_t<Func &, const entity_type>>, iterator>
+    insert(It first, It last, Func func) {
+        for(; first != last; ++first) {
+            emplace_element(*first, true, value_type(std::invoke(func, *first)));
+        }
+
+        return begin();
+    }
+
+    /**
+     * @brief Returns an iterable object to use to _visit_ a storage.
+     *
+     * The iterable object returns a tuple that contains the current entity and
+     * a proxy reference to its element.
+     *
+     * @return An iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] iterable each() noexcept {
+        return iterable{{base_type::begin(), begin()}, {base_type::end(), end()}};
+    }
+
+    /*! @copydoc each */
+    [[nodiscard]] const_iterable each() const noexcept {
+        return const_iterable{{base_type::cbegin(), cbegin()}, {base_type::cend(), cend()}};
+    }
+
+    /**
+     * @brief Returns a reverse iterable object to use to _visit_ a storage.
+     *
+     * @sa each
+     *
+     * @return A reverse iterable object to use to _visit_ the storage.
+     */
+    [[nodiscard]] reverse_iterable reach() noexcept {
+        return reverse_iterable{{base_type::rbegin(), rbegin()}, {base_type::rend(), rend()}};
+    }
+
+    /*! @copydoc reach */
+    [[nodiscard]] const_reverse_iterable reach() const noexcept {
+        return const_reverse_iterable{{base_type::crbegin(), crbegin()}, {base_type::crend(), crend()}};
+    }
+
+private:
+    container_type payload;
+};
+
+/**
+ * @brief Routes types that declare their columns to structure of arrays
+ * storage classes.
+ * @tparam Type Storage value type.
+ * @tparam Entity A valid entity type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Type, typename Entity, typename Allocator>
+struct storage_type<Type, Entity, Allocator, std::void_t<typename Type::soa_columns>> {
+    /*! @brief Type-to-storage conversion result. */
+    using type = ENTT_STORAGE(sigh_mixin, basic_soa_storage<Type, Entity, Allocator>);
+};
+
+} // namespace entt
+
+#endif
@@ -1,8 +1,10 @@
 #ifndef ENTT_ENTITY_SPARSE_SET_HPP
 #define ENTT_ENTITY_SPARSE_SET_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -135,6 +137,85 @@ template<typename Container>
 } // namespace internal
 /*! @endcond */
 
+/*! @brief Memory usage of a sparse set or a storage, in pages and bytes. */
+struct memory_report {
+    /*! @brief Number of pages allocated for the sparse array. */
+    std::size_t sparse_pages{};
+    /*! @brief Bytes allocated for the sparse array and its pages. */
+    std::size_t sparse_bytes{};
+    /*! @brief Bytes allocated for the packed array. */
+    std::size_t packed_bytes{};
+    /*! @brief Number of pages allocated for the elements, if any. */
+    std::size_t element_pages{};
+    /*! @brief Bytes allocated for the elements, if any. */
+    std::size_t element_bytes{};
+    /*! @brief Number of tombstones in the packed array. */
+    std::size_t tombstones{};
+    /*! @brief Number of entities in the free list. */
+    std::size_t free_list{};
+
+    /**
+     * @brief Returns the total number of bytes allocated.
+     * @return The total number of bytes allocated.
+     */
+    [[nodiscard]] constexpr std::size_t bytes() const noexcept {
+        return sparse_bytes + packed_bytes + element_bytes;
+    }
+
+    /**
+     * @brief Accumulates the values of another report.
+     * @param other The report to accumulate.
+     * @return This report.
+     */
+    constexpr memory_report &operator+=(const memory_report &other) noexcept {
+        sparse_pages += other.sparse_pages;
+        sparse_bytes += other.sparse_bytes;
+        packed_bytes += other.packed_bytes;
+        element_pages += other.element_pages;
+        element_bytes += other.element_bytes;
+        tombstones += other.tombstones;
+        free_list += other.free_list;
+        return *this;
+    }
+};
+
+/*! @brief Operation counters of a storage, see `statistics_mixin`. */
+struct storage_statistics {
+    /*! @brief Number of elements created. */
+    std::size_t emplaced{};
+    /*! @brief Number of elements destroyed. */
+    std::size_t erased{};
+    /*! @brief Number of elements patched or replaced. */
+    std::size_t patched{};
+    /*! @brief Number of elements fetched. */
+    std::size_t gets{};
+    /*! @brief Number of iterations started directly on the storage. */
+    std::size_t iterations{};
+    /*! @brief Largest number of entities contained at once. */
+    std::size_t peak{};
+    /*! @brief Number of listeners connected to the signals of the storage. */
+    std::size_t listeners{};
+};
+
+/**
+ * @brief Suggests a deletion policy given the counters of a storage.
+ *
+ * Storage that destroy fewer elements than the largest number of entities they
+ * contained at once are best served by swap-and-pop deletion. Churning storage
+ * that are mostly accessed by entity rather than iterated benefit from in-place
+ * deletion instead, since elements aren't moved around and free slots are
+ * reused.<br/>
+ * Whether pointer stability is required isn't something counters can tell.
+ *
+ * @param stats Counters of a storage, see `statistics_mixin`.
+ * @return The suggested deletion policy.
+ */
+[[nodiscard]] constexpr deletion_policy suggested_policy(const storage_statistics &stats) noexcept {
+    const bool churn = stats.erased > stats.peak;
+    const bool random_access = (stats.iterations == 0u) || (stats.gets / stats.iterations > stats.peak);
+    return (churn && random_access) ? deletion_policy::in_place : deletion_policy::swap_and_pop;
+}
+
 /**
  * @brief Sparse set implementation.
  *
@@ -160,9 +241,11 @@ class basic_sparse_set {
     static_assert(std::is_same_v<typename alloc_traits::value_type, Entity>, "Invalid value type");
     using sparse_container_type = std::vector<typename alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>>;
     using packed_container_type = std::vector<Entity, Allocator>;
+    using bitmap_container_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
     using traits_type = entt_traits<Entity>;
 
     static constexpr auto max_size = static_cast<std::size_t>(traits_type::to_entity(null));
+    static constexpr auto bitmap_digits = static_cast<std::size_t>(std::numeric_limits<std::size_t>::digits);
 
     // it could be auto but gcc complains and emits a warning due to a false positive
     [[nodiscard]] std::size_t policy_to_head() const noexcept {
@@ -174,19 +257,50 @@ class basic_sparse_set {
     }
 
     [[nodiscard]] auto pos_to_page(const std::size_t pos) const noexcept {
-        return static_cast<size_type>(pos / traits_type::page_size);
+        return static_cast<size_type>(pos >> page_shift);
     }
 
     [[nodiscard]] auto sparse_ptr(const Entity entt) const {
         const auto pos = entity_to_pos(entt);
         const auto page = pos_to_page(pos);
-        return (page < sparse.size() && sparse[page]) ? (sparse[page] + fast_mod(pos, traits_type::page_size)) : nullptr;
+        return (page < sparse.size() && sparse[page]) ? (sparse[page] + fast_mod(pos, sparse_page_size())) : nullptr;
     }
 
     [[nodiscard]] auto &sparse_ref(const Entity entt) const {
         ENTT_ASSERT(sparse_ptr(entt), "Invalid element");
         const auto pos = entity_to_pos(entt);
-        return sparse[pos_to_page(pos)][fast_mod(pos, traits_type::page_size)];
+        return sparse[pos_to_page(pos)][fast_mod(pos, sparse_page_size())];
+    }
+
+    [[nodiscard]] static constexpr std::size_t pos_to_bit(const std::size_t pos) noexcept {
+        // bits are reversed within a word to follow the iteration order
+        return std::size_t{1u} << (bitmap_digits - 1u - fast_mod(pos, bitmap_digits));
+    }
+
+    void assure_bitmap(const std::size_t len) {
+        // the bitmap grows with the packed array, erasing entities never allocates
+        if(const auto words = (len + bitmap_digits - 1u) / bitmap_digits; mode == deletion_policy::in_place && bitmap.size() < words) {
+            bitmap.resize(words, 0u);
+        }
+    }
+
+    void mark_tombstone(const std::size_t pos) noexcept {
+        ENTT_ASSERT(pos / bitmap_digits < bitmap.size(), "Bitmap out of sync");
+        bitmap[pos / bitmap_digits] |= pos_to_bit(pos);
+    }
+
+    void unmark_tombstone(const std::size_t pos) noexcept {
+        bitmap[pos / bitmap_digits] &= ~pos_to_bit(pos);
+    }
+
+    void trim_bitmap(const std::size_t len) {
+        if(const auto word = len / bitmap_digits, rem = fast_mod(len, bitmap_digits); word < bitmap.size()) {
+            bitmap.resize(word + (rem != 0u));
+
+            if(rem != 0u) {
+                bitmap.back() &= ~((std::size_t{1u} << (bitmap_digits - rem)) - 1u);
+            }
+        }
     }
 
     [[nodiscard]] auto to_iterator(const Entity entt) const {
@@ -204,11 +318,11 @@ class basic_sparse_set {
         if(!sparse[page]) {
             constexpr entity_type init = null;
             auto page_allocator{packed.get_allocator()};
-            sparse[page] = alloc_traits::allocate(page_allocator, traits_type::page_size);
-            std::uninitialized_fill(sparse[page], sparse[page] + traits_type::page_size, init);
+            sparse[page] = alloc_traits::allocate(page_allocator, sparse_page_size());
+            std::uninitialized_fill(sparse[page], sparse[page] + sparse_page_size(), init);
         }
 
-        return sparse[page][fast_mod(pos, traits_type::page_size)];
+        return sparse[page][fast_mod(pos, sparse_page_size())];
     }
 
     void release_sparse_pages() {
@@ -216,8 +330,8 @@ class basic_sparse_set {
 
         for(auto &&page: sparse) {
             if(page != nullptr) {
-                std::destroy(page, page + traits_type::page_size);
-                alloc_traits::deallocate(page_allocator, page, traits_type::page_size);
+                std::destroy(page, page + sparse_page_size());
+                alloc_traits::deallocate(page_allocator, page, sparse_page_size());
                 page = nullptr;
             }
         }
@@ -242,6 +356,12 @@ private:
         ENTT_ASSERT((mode != deletion_policy::swap_only) || ((lhs < head) == (rhs < head)), "Cross swapping is not supported");
     }
 
+    void compact_on_demand() {
+        if(budget != 0u && static_cast<float>(holes) > threshold * static_cast<float>(packed.size())) {
+            compact(budget);
+        }
+    }
+
 protected:
     /*! @brief Random access iterator type. */
     using basic_iterator = internal::sparse_set_iterator<packed_container_type>;
@@ -279,10 +399,13 @@ protected:
      * @brief Erases an entity from a sparse set.
      * @param it An iterator to the element to pop.
      */
-    void in_place_pop(const basic_iterator it) {
+    void in_place_pop(const basic_iterator it) noexcept {
         ENTT_ASSERT(mode == deletion_policy::in_place, "Deletion policy mismatch");
-        const auto pos = entity_to_pos(std::exchange(sparse_ref(*it), null));
+        const auto pos = index(*it);
+        mark_tombstone(pos);
+        sparse_ref(*it) = null;
         packed[pos] = traits_type::combine(static_cast<typename traits_type::entity_type>(std::exchange(head, pos)), tombstone);
+        ++holes;
     }
 
     /**
@@ -312,26 +435,39 @@ protected:
 
     /*! @brief Erases all entities of a sparse set. */
     virtual void pop_all() {
-        switch(mode) {
-        case deletion_policy::in_place:
-            if(head != max_size) {
-                for(auto &&elem: packed) {
-                    if(elem != tombstone) {
-                        sparse_ref(elem) = null;
+        if(packed.size() >= (sparse.size() * sparse_page_size()) / 2u) {
+            // filling whole pages is cheaper than visiting the sparse array at random
+            constexpr entity_type init = null;
+
+            for(auto &&page: sparse) {
+                if(page) {
+                    std::fill(page, page + sparse_page_size(), init);
+                }
+            }
+        } else {
+            switch(mode) {
+            case deletion_policy::in_place:
+                if(head != max_size) {
+                    for(auto &&elem: packed) {
+                        if(elem != tombstone) {
+                            sparse_ref(elem) = null;
+                        }
                     }
+                    break;
+                }
+                [[fallthrough]];
+            case deletion_policy::swap_only:
+            case deletion_policy::swap_and_pop:
+                for(auto &&elem: packed) {
+                    sparse_ref(elem) = null;
                 }
                 break;
             }
-            [[fallthrough]];
-        case deletion_policy::swap_only:
-        case deletion_policy::swap_and_pop:
-            for(auto &&elem: packed) {
-                sparse_ref(elem) = null;
-            }
-            break;
         }
 
         head = policy_to_head();
+        holes = 0u;
+        bitmap.clear();
         packed.clear();
     }
 
@@ -353,10 +489,13 @@ protected:
                 ENTT_ASSERT(elem == null, "Slot not available");
                 elem = traits_type::combine(static_cast<typename traits_type::entity_type>(head), traits_type::to_integral(entt));
                 head = entity_to_pos(std::exchange(packed[pos], entt));
+                unmark_tombstone(pos);
+                --holes;
                 break;
             }
             [[fallthrough]];
         case deletion_policy::swap_and_pop:
+            assure_bitmap(packed.size() + 1u);
             packed.push_back(entt);
             ENTT_ASSERT(elem == null, "Slot not available");
             elem = traits_type::combine(static_cast<typename traits_type::entity_type>(packed.size() - 1u), traits_type::to_integral(entt));
@@ -378,10 +517,180 @@ protected:
         return --(end() - static_cast<difference_type>(pos));
     }
 
+    /**
+     * @brief Appends a range of entities to a sparse set in a single pass.
+     *
+     * Entities are copied at once at the end of the packed array and sparse
+     * pages are looked up only once per run of entities sharing a page.<br/>
+     * Derived classes are not notified through `try_emplace`.
+     *
+     * @warning
+     * Attempting to append an entity that already belongs to the sparse set
+     * results in undefined behavior.<br/>
+     * In swap-only mode, the free list must be empty.
+     *
+     * @tparam It Type of forward iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    void push_back_range(It first, It last) {
+        const auto from = packed.size();
+        auto pos = from;
+
+        ENTT_ASSERT((mode != deletion_policy::swap_only) || (head == from), "Free list not empty");
+        assure_bitmap(from + static_cast<size_type>(std::distance(first, last)));
+        packed.insert(packed.end(), first, last);
+
+        ENTT_TRY {
+            for(auto page = ~size_type{}, len = packed.size(); pos < len; ++pos) {
+                const auto entt = packed[pos];
+                ENTT_ASSERT(entt != null && entt != tombstone, "Invalid element");
+
+                if(const auto curr = pos_to_page(entity_to_pos(entt)); curr != page) {
+                    static_cast<void>(assure_at_least(entt));
+                    page = curr;
+                }
+
+                auto &elem = sparse[page][fast_mod(entity_to_pos(entt), sparse_page_size())];
+                ENTT_ASSERT(elem == null, "Slot not available");
+                elem = traits_type::combine(static_cast<typename traits_type::entity_type>(pos), traits_type::to_integral(entt));
+            }
+        }
+        ENTT_CATCH {
+            while(pos != from) {
+                sparse_ref(packed[--pos]) = null;
+            }
+
+            packed.erase(packed.begin() + static_cast<difference_type>(from), packed.end());
+            ENTT_THROW;
+        }
+
+        if(mode == deletion_policy::swap_only) {
+            head = packed.size();
+        }
+    }
+
+    /**
+     * @brief Copies entities and sparse pages from another sparse set.
+     *
+     * Pages are reused when possible and entities retain their positions,
+     * tombstones and free list included.
+     *
+     * @param other The sparse set to copy the contents from.
+     */
+    virtual void copy_from(const basic_sparse_set &other) {
+        auto page_allocator{packed.get_allocator()};
+
+        if(page_shift != other.page_shift) {
+            release_sparse_pages();
+            page_shift = other.page_shift;
+        }
+
+        for(auto pos = other.sparse.size(), last = sparse.size(); pos < last; ++pos) {
+            if(sparse[pos] != nullptr) {
+                alloc_traits::deallocate(page_allocator, sparse[pos], sparse_page_size());
+            }
+        }
+
+        sparse.resize(other.sparse.size(), nullptr);
+
+        for(size_type pos{}, last = sparse.size(); pos < last; ++pos) {
+            if(other.sparse[pos] == nullptr) {
+                if(sparse[pos] != nullptr) {
+                    alloc_traits::deallocate(page_allocator, std::exchange(sparse[pos], nullptr), sparse_page_size());
+                }
+            } else if(sparse[pos] == nullptr) {
+                sparse[pos] = alloc_traits::allocate(page_allocator, sparse_page_size());
+                std::uninitialized_copy(other.sparse[pos], other.sparse[pos] + sparse_page_size(), sparse[pos]);
+            } else {
+                std::copy(other.sparse[pos], other.sparse[pos] + sparse_page_size(), sparse[pos]);
+            }
+        }
+
+        packed = other.packed;
+        head = other.head;
+        holes = other.holes;
+        bitmap = other.bitmap;
+        budget = other.budget;
+        threshold = other.threshold;
+    }
+
+    /**
+     * @brief Copies some pages of entities from another sparse set.
+     *
+     * The packed array is split in pages of the given size. Positions outside
+     * of the given pages are expected to be the same in both sparse sets,
+     * except for those past the end of the shortest one, which are copied in
+     * any case. The function object is invoked for all the copied ranges of
+     * positions that exist in the other sparse set, so that derived classes
+     * can copy their elements.
+     *
+     * @tparam It Type of input iterator.
+     * @tparam Func Type of function object to invoke.
+     * @param other The sparse set to copy the contents from.
+     * @param length Number of entities in a page.
+     * @param first An iterator to the first element of the range of pages.
+     * @param last An iterator past the last element of the range of pages.
+     * @param func A valid function object.
+     */
+    template<typename It, typename Func>
+    void copy_pages_from(const basic_sparse_set &other, const std::size_t length, It first, It last, Func func) {
+        const auto len = other.packed.size();
+        const auto tail = (std::min)(packed.size(), len);
+
+        const auto copy = [this, &other, len, &func](const size_type from, const size_type to) {
+            for(auto pos = from; pos < to; ++pos) {
+                // entities moved elsewhere are bound again when their new position is copied
+                if(const auto entt = packed[pos]; entt != null && entt != tombstone) {
+                    if(auto *elem = sparse_ptr(entt); elem && *elem != null && entity_to_pos(*elem) == pos) {
+                        *elem = null;
+                    }
+                }
+
+                if(pos < len) {
+                    if(const auto entt = (packed[pos] = other.packed[pos]); entt != tombstone) {
+                        assure_at_least(entt) = traits_type::combine(static_cast<typename traits_type::entity_type>(pos), traits_type::to_integral(entt));
+                    }
+                }
+            }
+
+            if(from < len) {
+                func(from, (std::min)(to, len));
+            }
+        };
+
+        packed.resize((std::max)(packed.size(), len), null);
+
+        for(; first != last; ++first) {
+            if(const auto from = *first * length; from < tail) {
+                copy(from, (std::min)(from + length, tail));
+            }
+        }
+
+        copy(tail, packed.size());
+        packed.resize(len);
+        head = other.head;
+        holes = other.holes;
+
+        if(mode == deletion_policy::in_place) {
+            bitmap = other.bitmap;
+        }
+    }
+
     /*! @brief Forwards variables to derived classes, if any. */
     // NOLINTNEXTLINE(performance-unnecessary-value-param)
     virtual void bind_any(any) noexcept {}
 
+    /**
+     * @brief Checks whether the element forwarded to `try_emplace` can be
+     * moved from.
+     * @return True if the element can be moved from, false otherwise.
+     */
+    [[nodiscard]] bool movable_value() const noexcept {
+        return moving;
+    }
+
 public:
     /*! @brief Allocator type. */
     using allocator_type = Allocator;
@@ -431,12 +740,37 @@ public:
      * @param allocator The allocator to use (possibly default-constructed).
      */
     explicit basic_sparse_set(const type_info &elem, deletion_policy pol = deletion_policy::swap_and_pop, const allocator_type &allocator = {})
+        : basic_sparse_set{elem, pol, traits_type::page_size, allocator} {}
+
+    /**
+     * @brief Constructs an empty container with the given value type, policy,
+     * sparse page size and allocator.
+     *
+     * Small sparse pages reduce memory usage when entities are scattered over
+     * a wide range of identifiers, at the price of a larger sparse array.
+     *
+     * @param elem Returned value type, if any.
+     * @param pol Type of deletion policy.
+     * @param page Number of entries of a sparse page, must be a power of two.
+     * @param allocator The allocator to use (possibly default-constructed).
+     */
+    explicit basic_sparse_set(const type_info &elem, deletion_policy pol, const size_type page, const allocator_type &allocator = {})
         : sparse{allocator},
           packed{allocator},
           descriptor{&elem},
           mode{pol},
-          head{policy_to_head()} {
+          head{policy_to_head()},
+          holes{},
+          bitmap{allocator},
+          budget{},
+          threshold{},
+          page_shift{} {
         ENTT_ASSERT(traits_type::version_mask || mode != deletion_policy::in_place, "Policy does not support zero-sized versions");
+        ENTT_ASSERT(has_single_bit(page), "Sparse page size must be a power of two");
+
+        while((size_type{1u} << page_shift) < page) {
+            ++page_shift;
+        }
     }
 
     /*! @brief Default copy constructor, deleted on purpose. */
@@ -451,7 +785,12 @@ public:
           packed{std::move(other.packed)},
           descriptor{other.descriptor},
           mode{other.mode},
-          head{std::exchange(other.head, policy_to_head())} {}
+          head{std::exchange(other.head, policy_to_head())},
+          holes{std::exchange(other.holes, size_type{})},
+          bitmap{std::move(other.bitmap)},
+          budget{other.budget},
+          threshold{other.threshold},
+          page_shift{other.page_shift} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -463,7 +802,12 @@ public:
           packed{std::move(other.packed), allocator},
           descriptor{other.descriptor},
           mode{other.mode},
-          head{std::exchange(other.head, policy_to_head())} {
+          head{std::exchange(other.head, policy_to_head())},
+          holes{std::exchange(other.holes, size_type{})},
+          bitmap{std::move(other.bitmap), allocator},
+          budget{other.budget},
+          threshold{other.threshold},
+          page_shift{other.page_shift} {
         ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a sparse set is not allowed");
     }
 
@@ -500,6 +844,35 @@ public:
         swap(descriptor, other.descriptor);
         swap(mode, other.mode);
         swap(head, other.head);
+        swap(holes, other.holes);
+        swap(bitmap, other.bitmap);
+        swap(budget, other.budget);
+        swap(threshold, other.threshold);
+        swap(page_shift, other.page_shift);
+    }
+
+    /**
+     * @brief Replaces the contents of a sparse set with a copy of those of
+     * another sparse set.
+     *
+     * Sparse pages are copied one at a time and entities retain their
+     * positions, including tombstones and the free list. Derived classes copy
+     * their elements and any additional state along with entities.<br/>
+     * This is a full copy, pages aren't shared between sparse sets.<br/>
+     * No listeners are notified, if any.
+     *
+     * @warning
+     * Both sparse sets must be of the same type and have the same value type
+     * and deletion policy. Otherwise, the behavior is undefined.
+     *
+     * @param other The sparse set to copy the contents from.
+     */
+    void deep_copy_from(const basic_sparse_set &other) {
+        ENTT_ASSERT(info() == other.info() && mode == other.mode, "Incompatible sparse sets");
+
+        if(&other != this) {
+            copy_from(other);
+        }
     }
 
     /**
@@ -518,6 +891,41 @@ public:
         return mode;
     }
 
+    /**
+     * @brief Changes the deletion policy of a sparse set.
+     *
+     * Moving away from in-place deletion compacts the sparse set first, while
+     * the entities past the free list of a swap-only sparse set are dropped.
+     *
+     * @warning
+     * Storage classes define their deletion policy at compile-time and don't
+     * support changing it. They don't offer this function and an assertion
+     * will abort the execution at runtime in debug mode if it's called through
+     * a sparse set.
+     *
+     * @param pol Type of deletion policy.
+     */
+    virtual void policy(const deletion_policy pol) {
+        ENTT_ASSERT(traits_type::version_mask || pol != deletion_policy::in_place, "Policy does not support zero-sized versions");
+
+        if(mode == deletion_policy::in_place) {
+            compact();
+        } else if(mode == deletion_policy::swap_only) {
+            for(auto pos = head; pos < packed.size(); ++pos) {
+                sparse_ref(packed[pos]) = null;
+            }
+
+            packed.erase(packed.begin() + static_cast<difference_type>(head), packed.end());
+        }
+
+        if(pol == deletion_policy::in_place) {
+            bitmap.resize((packed.size() + bitmap_digits - 1u) / bitmap_digits, 0u);
+        }
+
+        mode = pol;
+        head = (mode == deletion_policy::swap_only) ? packed.size() : policy_to_head();
+    }
+
     /**
      * @brief Returns data on the free list whose meaning depends on the mode.
      * @return Free list information that is mode dependent.
@@ -544,6 +952,10 @@ public:
      * @param cap Desired capacity.
      */
     virtual void reserve(const size_type cap) {
+        if(mode == deletion_policy::in_place) {
+            bitmap.reserve((cap + bitmap_digits - 1u) / bitmap_digits);
+        }
+
         packed.reserve(cap);
     }
 
@@ -556,6 +968,59 @@ public:
         return packed.capacity();
     }
 
+    /**
+     * @brief Returns the memory used by a sparse set.
+     *
+     * Tombstones are counted for sparse sets that use in-place deletion, while
+     * the free list is that of sparse sets that only swap entities.
+     *
+     * @return The memory used by the sparse set.
+     */
+    [[nodiscard]] virtual memory_report memory_usage() const noexcept {
+        memory_report report{};
+
+        for(auto &&page: sparse) {
+            report.sparse_pages += static_cast<size_type>(page != nullptr);
+        }
+
+        report.sparse_bytes = sparse.capacity() * sizeof(typename sparse_container_type::value_type) + report.sparse_pages * sparse_page_size() * sizeof(entity_type);
+        report.packed_bytes = packed.capacity() * sizeof(entity_type) + bitmap.capacity() * sizeof(typename bitmap_container_type::value_type);
+
+        report.tombstones = holes;
+
+        if(mode == deletion_policy::swap_only) {
+            report.free_list = packed.size() - head;
+        }
+
+        return report;
+    }
+
+    /**
+     * @brief Returns the operation counters of a sparse set, if any.
+     *
+     * Counters are only kept by storage classes that use a statistics mixin,
+     * while listeners are only counted by those that use a signal mixin. All
+     * other sparse sets return empty counters.
+     *
+     * @return The operation counters of the sparse set.
+     */
+    [[nodiscard]] virtual storage_statistics statistics() const noexcept {
+        return {};
+    }
+
+    /**
+     * @brief Checks whether elements can be moved (or at least copied) into a
+     * sparse set through `push_move`.
+     *
+     * Sparse sets that don't contain elements always return true.
+     *
+     * @return True if elements can be moved into the sparse set, false
+     * otherwise.
+     */
+    [[nodiscard]] virtual bool movable() const noexcept {
+        return true;
+    }
+
     /*! @brief Requests the removal of unused capacity. */
     virtual void shrink_to_fit() {
         sparse_container_type other{sparse.get_allocator()};
@@ -586,6 +1051,7 @@ public:
 
         sparse.shrink_to_fit();
         packed.shrink_to_fit();
+        bitmap.shrink_to_fit();
     }
 
     /**
@@ -598,7 +1064,41 @@ public:
      * @return Extent of the sparse set.
      */
     [[nodiscard]] size_type extent() const noexcept {
-        return sparse.size() * traits_type::page_size;
+        return sparse.size() * sparse_page_size();
+    }
+
+    /**
+     * @brief Returns the number of entries of the pages of the sparse array.
+     * @return The number of entries of a sparse page.
+     */
+    [[nodiscard]] size_type sparse_page_size() const noexcept {
+        return static_cast<size_type>(size_type{1u} << page_shift);
+    }
+
+    /**
+     * @brief Changes the number of entries of the pages of the sparse array.
+     *
+     * The sparse array is rebuilt from scratch when the page size changes.
+     * Entities retain their positions in the packed array, tombstones and free
+     * list included.
+     *
+     * @param page Number of entries of a sparse page, must be a power of two.
+     */
+    void sparse_page_size(const size_type page) {
+        ENTT_ASSERT(has_single_bit(page), "Sparse page size must be a power of two");
+
+        if(page != sparse_page_size()) {
+            release_sparse_pages();
+            sparse.clear();
+
+            for(page_shift = 0u; (size_type{1u} << page_shift) < page; ++page_shift) {}
+
+            for(size_type pos{}, last = packed.size(); pos < last; ++pos) {
+                if(const auto entt = packed[pos]; traits_type::to_version(entt) != traits_type::to_version(tombstone)) {
+                    assure_at_least(entt) = traits_type::combine(static_cast<typename traits_type::entity_type>(pos), traits_type::to_integral(entt));
+                }
+            }
+        }
     }
 
     /**
@@ -703,6 +1203,42 @@ public:
         return rend();
     }
 
+    /**
+     * @brief Skips a run of tombstones.
+     *
+     * Sparse sets that use in-place deletion keep track of their tombstones
+     * in a bitmap, so that whole runs of them are skipped at once rather than
+     * checked one at a time. Sets without tombstones return the given
+     * iterator immediately.
+     *
+     * @param it An iterator to an entity of the sparse set or the past-the-end
+     * iterator.
+     * @return An iterator to the first entity that isn't a tombstone, starting
+     * from the given one, or the past-the-end iterator if there is none.
+     */
+    [[nodiscard]] iterator skip_tombstones(const const_iterator it) const noexcept {
+        auto pos = it.index();
+
+        // sets without tombstones have nothing to skip
+        while(holes != 0u && pos >= 0) {
+            const auto word = static_cast<size_type>(pos) / bitmap_digits;
+
+            if(!(word < bitmap.size())) {
+                break;
+            }
+
+            // lower positions are stored in higher bits, hence trailing zeros
+            if(const auto valid = static_cast<std::size_t>(~bitmap[word] >> (bitmap_digits - 1u - fast_mod(static_cast<size_type>(pos), bitmap_digits))); valid != 0u) {
+                pos -= static_cast<difference_type>(countr_zero(valid));
+                break;
+            }
+
+            pos = static_cast<difference_type>(word * bitmap_digits) - 1;
+        }
+
+        return iterator{packed, pos + 1};
+    }
+
     /**
      * @brief Finds an entity.
      * @param entt A valid identifier.
@@ -721,7 +1257,7 @@ public:
     [[nodiscard]] bool contains(const entity_type entt) const noexcept {
         const auto *elem = sparse_ptr(entt);
         constexpr auto cap = traits_type::entity_mask;
-        constexpr auto mask = traits_type::to_integral(null) & ~cap;
+        constexpr auto mask = (traits_type::to_integral(null) & ~cap) | traits_type::disabled_mask;
         // testing versions permits to avoid accessing the packed array
         return elem && (((mask & traits_type::to_integral(entt)) ^ traits_type::to_integral(*elem)) < cap);
     }
@@ -808,20 +1344,53 @@ public:
      * @tparam It Type of input iterator.
      * @param first An iterator to the first element of the range of entities.
      * @param last An iterator past the last element of the range of entities.
+     * @param elem Optional opaque element to forward to mixins, if any.
      * @return Iterator pointing to the first element inserted in case of
      * success, the `end()` iterator otherwise.
      */
     template<typename It>
-    iterator push(It first, It last) {
+    iterator push(It first, It last, const void *elem = nullptr) {
         auto curr = end();
 
         for(; first != last; ++first) {
-            curr = try_emplace(*first, true);
+            curr = try_emplace(*first, true, elem);
         }
 
         return curr;
     }
 
+    /**
+     * @brief Assigns an entity to a sparse set and moves an element into it.
+     *
+     * Same as `push`, except that storage classes move-construct the element
+     * from the given object rather than copying it, if possible. The object is
+     * left in a valid but unspecified state.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the sparse set
+     * results in undefined behavior.
+     *
+     * @param entt A valid identifier.
+     * @param elem Opaque element to move from.
+     * @return Iterator pointing to the emplaced element in case of success, the
+     * `end()` iterator otherwise.
+     */
+    iterator push_move(const entity_type entt, void *elem) {
+        iterator it{};
+        moving = true;
+
+        ENTT_TRY {
+            it = try_emplace(entt, false, elem);
+        }
+        ENTT_CATCH {
+            moving = false;
+            ENTT_THROW;
+        }
+
+        moving = false;
+        return it;
+    }
+
     /**
      * @brief Bump the version number of an entity.
      *
@@ -840,6 +1409,30 @@ public:
         return traits_type::to_version(entt);
     }
 
+    /**
+     * @brief Replaces an entity with another one.
+     *
+     * The new identifier takes the position of the old one, therefore elements
+     * of derived classes are left untouched.
+     *
+     * @warning
+     * Attempting to rename an entity that doesn't belong to the sparse set or
+     * to use an identifier whose index is already taken results in undefined
+     * behavior.
+     *
+     * @param entt A valid identifier.
+     * @param other The identifier that replaces the given one.
+     */
+    void rename(const entity_type entt, const entity_type other) {
+        ENTT_ASSERT(other != null && other != tombstone, "Invalid element");
+        const auto pos = index(entt);
+        auto &elem = assure_at_least(other);
+        ENTT_ASSERT(elem == null, "Slot not available");
+        elem = traits_type::combine(static_cast<typename traits_type::entity_type>(pos), traits_type::to_integral(other));
+        sparse_ref(entt) = null;
+        packed[pos] = other;
+    }
+
     /**
      * @brief Erases an entity from a sparse set.
      *
@@ -852,6 +1445,7 @@ public:
     void erase(const entity_type entt) {
         const auto it = to_iterator(entt);
         pop(it, it + 1u);
+        compact_on_demand();
     }
 
     /**
@@ -867,6 +1461,7 @@ public:
     void erase(It first, It last) {
         if constexpr(std::is_same_v<It, basic_iterator>) {
             pop(first, last);
+            compact_on_demand();
         } else {
             for(; first != last; ++first) {
                 erase(*first);
@@ -920,29 +1515,88 @@ public:
 
     /*! @brief Removes all tombstones from a sparse set. */
     void compact() {
+        compact(packed.size());
+    }
+
+    /**
+     * @brief Removes tombstones from a sparse set, moving at most the given
+     * number of elements.
+     *
+     * Compacting a sparse set a little at a time spreads the cost of the
+     * operation over multiple calls. Tombstones at the end of the packed array
+     * are removed without moving any element.
+     *
+     * @param count Maximum number of elements to move.
+     */
+    void compact(const size_type count) {
         if(mode == deletion_policy::in_place) {
             size_type from = packed.size();
-            size_type pos = std::exchange(head, max_size);
 
             for(; from && packed[from - 1u] == tombstone; --from) {}
 
-            while(pos != max_size) {
-                if(const auto to = std::exchange(pos, entity_to_pos(packed[pos])); to < from) {
+            for(size_type moved{}; head != max_size && moved < count;) {
+                if(const auto to = std::exchange(head, entity_to_pos(packed[head])); to < from) {
                     --from;
                     swap_or_move(from, to);
 
                     packed[to] = packed[from];
+                    unmark_tombstone(to);
                     const auto elem = static_cast<typename traits_type::entity_type>(to);
                     sparse_ref(packed[to]) = traits_type::combine(elem, traits_type::to_integral(packed[to]));
 
                     for(; from && packed[from - 1u] == tombstone; --from) {}
+                    ++moved;
                 }
             }
 
+            holes = 0u;
+
+            // tombstones left behind are linked again, except those about to be erased
+            for(auto pos = std::exchange(head, max_size), prev = max_size; pos != max_size;) {
+                const auto next = entity_to_pos(packed[pos]);
+
+                if(pos < from) {
+                    packed[pos] = traits_type::combine(static_cast<typename traits_type::entity_type>(max_size), tombstone);
+                    if(prev == max_size) {
+                        head = pos;
+                    } else {
+                        packed[prev] = traits_type::combine(static_cast<typename traits_type::entity_type>(pos), tombstone);
+                    }
+
+                    prev = pos;
+                    ++holes;
+                }
+
+                pos = next;
+            }
+
             packed.erase(packed.begin() + static_cast<difference_type>(from), packed.end());
+            trim_bitmap(from);
         }
     }
 
+    /**
+     * @brief Enables or disables the automatic compaction of a sparse set.
+     *
+     * When enabled, sparse sets that use in-place deletion are compacted
+     * incrementally after entities are erased, as long as the ratio between
+     * tombstones and the size of the packed array exceeds the given threshold.
+     *
+     * @warning
+     * Automatic compaction moves elements around when entities are erased.
+     * Therefore, pointer stability is no longer guaranteed upon deletion and
+     * erasing entities while iterating the sparse set results in undefined
+     * behavior.
+     *
+     * @param ratio Ratio of tombstones above which to compact the sparse set.
+     * @param count Maximum number of elements to move per erasure, zero to
+     * disable automatic compaction.
+     */
+    void compaction(const float ratio, const size_type count) noexcept {
+        threshold = ratio;
+        budget = count;
+    }
+
     /**
      * @brief Swaps two entities in a sparse set.
      *
@@ -1075,6 +1729,8 @@ public:
         // sanity check to avoid subtle issues due to storage classes
         ENTT_ASSERT((compact(), size()) == 0u, "Non-empty set");
         head = policy_to_head();
+        holes = 0u;
+        bitmap.clear();
         packed.clear();
     }
 
@@ -1107,8 +1763,18 @@ private:
     const type_info *descriptor;
     deletion_policy mode;
     size_type head;
+    size_type holes;
+    bitmap_container_type bitmap;
+    size_type budget;
+    float threshold;
+    size_type page_shift;
+    bool moving{};
 };
 
+#ifdef ENTT_USE_EXTERN_TEMPLATE
+extern template class basic_sparse_set<entity>;
+#endif
+
 } // namespace entt
 
 #endif
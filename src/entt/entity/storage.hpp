@@ -1,7 +1,11 @@
 #ifndef ENTT_ENTITY_STORAGE_HPP
 #define ENTT_ENTITY_STORAGE_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstring>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <tuple>
@@ -9,6 +13,7 @@
 #include <utility>
 #include <vector>
 #include "../config/config.h"
+#include "../container/paged_vector.hpp"
 #include "../core/bit.hpp"
 #include "../core/iterator.hpp"
 #include "../core/memory.hpp"
@@ -90,7 +95,12 @@ public:
 
     [[nodiscard]] constexpr reference operator[](const difference_type value) const noexcept {
         const auto pos = static_cast<typename Container::size_type>(index() - value);
-        return (*payload)[pos / Page][fast_mod(static_cast<std::size_t>(pos), Page)];
+
+        if constexpr(Page == no_pagination) {
+            return (*payload)[0u][pos];
+        } else {
+            return internal::paged_vector_element<Page>(*payload, static_cast<std::size_t>(pos));
+        }
     }
 
     [[nodiscard]] constexpr pointer operator->() const noexcept {
@@ -207,6 +217,40 @@ template<typename... Lhs, typename... Rhs>
     return !(lhs == rhs);
 }
 
+template<typename Allocator, std::size_t Alignment>
+class aligned_page_allocator {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_pointer_v<typename alloc_traits::pointer>, "Fancy pointers not supported");
+
+    struct alignas(Alignment) block_type {
+        std::byte data[Alignment];
+    };
+
+    using block_alloc_traits = typename alloc_traits::template rebind_traits<block_type>;
+
+    [[nodiscard]] static constexpr std::size_t blocks(const std::size_t count) noexcept {
+        return (count * sizeof(typename alloc_traits::value_type) + Alignment - 1u) / Alignment;
+    }
+
+public:
+    using value_type = typename alloc_traits::value_type;
+
+    aligned_page_allocator(const Allocator &allocator) noexcept
+        : alloc{allocator} {}
+
+    [[nodiscard]] value_type *allocate(const std::size_t count) {
+        // pages fill whole blocks, therefore they never share their blocks with other pages
+        return reinterpret_cast<value_type *>(block_alloc_traits::allocate(alloc, blocks(count)));
+    }
+
+    void deallocate(value_type *elem, const std::size_t count) noexcept {
+        block_alloc_traits::deallocate(alloc, reinterpret_cast<block_type *>(elem), blocks(count));
+    }
+
+private:
+    typename block_alloc_traits::allocator_type alloc;
+};
+
 } // namespace internal
 /*! @endcond */
 
@@ -234,30 +278,64 @@ class basic_storage: public basic_sparse_set<Entity, typename std::allocator_tra
     using underlying_iterator = typename underlying_type::basic_iterator;
     using traits_type = component_traits<Type, Entity>;
 
+    static constexpr bool is_contiguous = (traits_type::page_size == no_pagination);
+    static_assert(!is_contiguous || std::is_nothrow_move_constructible_v<Type>, "Non-paginated storage requires nothrow move constructible types");
+
+    static constexpr std::size_t page_alignment = internal::page_alignment<traits_type, Type>::value;
+    static_assert(has_single_bit(page_alignment) && !(page_alignment < alignof(Type)), "Invalid page alignment");
+
+    using page_allocator_type = std::conditional_t<(page_alignment > alignof(Type)), internal::aligned_page_allocator<Allocator, page_alignment>, Allocator>;
+    using page_alloc_traits = std::allocator_traits<page_allocator_type>;
+
     [[nodiscard]] auto &element_at(const std::size_t pos) const {
-        return payload[pos / traits_type::page_size][fast_mod(pos, traits_type::page_size)];
+        if constexpr(is_contiguous) {
+            return payload[0u][pos];
+        } else {
+            return internal::paged_vector_element<traits_type::page_size>(payload, pos);
+        }
     }
 
-    auto assure_at_least(const std::size_t pos) {
-        const auto idx = pos / traits_type::page_size;
+    void relocate(const std::size_t cap, const std::size_t count) {
+        allocator_type allocator{get_allocator()};
+        page_allocator_type page_allocator{allocator};
+        const auto elem = (cap == 0u) ? nullptr : page_alloc_traits::allocate(page_allocator, cap);
 
-        if(!(idx < payload.size())) {
-            auto curr = payload.size();
-            allocator_type allocator{get_allocator()};
-            payload.resize(idx + 1u, nullptr);
+        if(!payload.empty()) {
+            ++revision;
 
-            ENTT_TRY {
-                for(const auto last = payload.size(); curr < last; ++curr) {
-                    payload[curr] = alloc_traits::allocate(allocator, traits_type::page_size);
+            for(std::size_t pos{}; pos < count; ++pos) {
+                if constexpr(traits_type::in_place_delete) {
+                    if(base_type::data()[pos] == tombstone) {
+                        continue;
+                    }
                 }
+
+                entt::uninitialized_construct_using_allocator(to_address(elem + pos), allocator, std::move(payload[0u][pos]));
+                alloc_traits::destroy(allocator, std::addressof(payload[0u][pos]));
             }
-            ENTT_CATCH {
-                payload.resize(curr);
-                ENTT_THROW;
+
+            page_alloc_traits::deallocate(page_allocator, payload[0u], buffer_size);
+        }
+
+        (cap == 0u) ? payload.clear() : payload.assign(1u, elem);
+        buffer_size = cap;
+    }
+
+    auto assure_at_least(const std::size_t pos) {
+        if constexpr(is_contiguous) {
+            if(!(pos < buffer_size)) {
+                relocate((std::max)(pos + 1u, buffer_size * 2u), (std::min)(base_type::size(), buffer_size));
             }
+
+            return payload[0u] + pos;
+        } else {
+            return assure_page_at_least(pos);
         }
+    }
 
-        return payload[idx] + fast_mod(pos, traits_type::page_size);
+    auto assure_page_at_least(const std::size_t pos) {
+        page_allocator_type page_allocator{get_allocator()};
+        return internal::paged_vector_assure<traits_type::page_size>(payload, page_allocator, pos);
     }
 
     template<typename... Args>
@@ -276,8 +354,29 @@ class basic_storage: public basic_sparse_set<Entity, typename std::allocator_tra
         return it;
     }
 
+    template<typename Func>
+    auto generate_element(const Entity entt, Func &func) {
+        const auto it = base_type::try_emplace(entt, true);
+
+        ENTT_TRY {
+            auto *elem = to_address(assure_at_least(static_cast<size_type>(it.index())));
+
+            if constexpr(std::uses_allocator_v<element_type, allocator_type> || !std::is_same_v<std::invoke_result_t<Func &, const Entity>, element_type>) {
+                entt::uninitialized_construct_using_allocator(elem, get_allocator(), std::invoke(func, entt));
+            } else {
+                // guaranteed copy elision, the element is built directly in place
+                ::new(elem) element_type(std::invoke(func, entt));
+            }
+        }
+        ENTT_CATCH {
+            base_type::pop(it, it + 1u);
+            ENTT_THROW;
+        }
+
+        return it;
+    }
+
     void shrink_to_size(const std::size_t sz) {
-        const auto from = (sz + traits_type::page_size - 1u) / traits_type::page_size;
         allocator_type allocator{get_allocator()};
 
         for(auto pos = sz, length = base_type::size(); pos < length; ++pos) {
@@ -290,11 +389,15 @@ class basic_storage: public basic_sparse_set<Entity, typename std::allocator_tra
             }
         }
 
-        for(auto pos = from, last = payload.size(); pos < last; ++pos) {
-            alloc_traits::deallocate(allocator, payload[pos], traits_type::page_size);
+        if constexpr(is_contiguous) {
+            if(sz < buffer_size) {
+                relocate(sz, sz);
+            }
+        } else {
+            page_allocator_type page_allocator{allocator};
+            internal::paged_vector_release<traits_type::page_size>(payload, page_allocator, sz);
         }
 
-        payload.resize(from);
         payload.shrink_to_fit();
     }
 
@@ -315,12 +418,24 @@ private:
         return std::addressof(element_at(pos));
     }
 
+    void policy([[maybe_unused]] const deletion_policy pol) final {
+        ENTT_ASSERT(pol == storage_policy, "Storage classes cannot change deletion policy");
+    }
+
+protected:
+    /**
+     * @brief Swaps or moves two elements within a storage.
+     * @param from A valid position of an element within a storage.
+     * @param to A valid position of an element within a storage.
+     */
     void swap_or_move([[maybe_unused]] const std::size_t from, [[maybe_unused]] const std::size_t to) override {
         static constexpr bool is_pinned_type = !(std::is_move_constructible_v<Type> && std::is_move_assignable_v<Type>);
         // use a runtime value to avoid compile-time suppression that drives the code coverage tool crazy
         ENTT_ASSERT((from + 1u) && !is_pinned_type, "Pinned type");
 
         if constexpr(!is_pinned_type) {
+            ++revision;
+
             if constexpr(traits_type::in_place_delete) {
                 (base_type::operator[](to) == tombstone) ? move_to(from, to) : swap_at(from, to);
             } else {
@@ -329,13 +444,14 @@ private:
         }
     }
 
-protected:
     /**
      * @brief Erases entities from a storage.
      * @param first An iterator to the first element of the range of entities.
      * @param last An iterator past the last element of the range of entities.
      */
     void pop(underlying_iterator first, underlying_iterator last) override {
+        revision += static_cast<size_type>(first != last);
+
         for(allocator_type allocator{get_allocator()}; first != last; ++first) {
             // cannot use first.index() because it would break with cross iterators
             auto &elem = element_at(base_type::index(*first));
@@ -355,21 +471,115 @@ protected:
 
     /*! @brief Erases all entities of a storage. */
     void pop_all() override {
-        allocator_type allocator{get_allocator()};
+        ++revision;
 
-        for(auto first = base_type::begin(); !(first.index() < 0); ++first) {
-            if constexpr(traits_type::in_place_delete) {
-                if(*first != tombstone) {
-                    base_type::in_place_pop(first);
+        if constexpr(std::is_trivially_destructible_v<Type>) {
+            // nothing to destroy, entities are released all at once
+            base_type::pop_all();
+        } else {
+            allocator_type allocator{get_allocator()};
+
+            for(auto first = base_type::begin(); !(first.index() < 0); ++first) {
+                if constexpr(traits_type::in_place_delete) {
+                    if(*first != tombstone) {
+                        base_type::in_place_pop(first);
+                        alloc_traits::destroy(allocator, std::addressof(element_at(static_cast<size_type>(first.index()))));
+                    }
+                } else {
+                    base_type::swap_and_pop(first);
                     alloc_traits::destroy(allocator, std::addressof(element_at(static_cast<size_type>(first.index()))));
                 }
+            }
+        }
+    }
+
+    /**
+     * @brief Copies entities and elements from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from([[maybe_unused]] const underlying_type &other) override {
+        // use a runtime value to avoid compile-time suppression that drives the code coverage tool crazy
+        ENTT_ASSERT((other.size() + 1u) && std::is_copy_constructible_v<Type>, "Non-copyable type");
+
+        if constexpr(std::is_copy_constructible_v<Type>) {
+            const auto &from = static_cast<const basic_storage &>(other);
+            allocator_type allocator{get_allocator()};
+            const auto len = from.size();
+
+            basic_storage::pop_all();
+            base_type::copy_from(other);
+
+            if constexpr(std::is_trivially_copyable_v<Type> && !std::uses_allocator_v<Type, allocator_type> && !traits_type::in_place_delete) {
+                if(len != 0u) {
+                    static_cast<void>(assure_at_least(len - 1u));
+                }
+
+                // trivially copyable elements are copied one page at a time
+                for(size_type pos{}, step = is_contiguous ? len : traits_type::page_size; pos < len; pos += step) {
+                    std::uninitialized_copy_n(std::addressof(from.element_at(pos)), (std::min)(step, len - pos), std::addressof(element_at(pos)));
+                }
             } else {
-                base_type::swap_and_pop(first);
-                alloc_traits::destroy(allocator, std::addressof(element_at(static_cast<size_type>(first.index()))));
+                size_type pos{};
+
+                ENTT_TRY {
+                    for(; pos < len; ++pos) {
+                        if constexpr(traits_type::in_place_delete) {
+                            if(base_type::data()[pos] == tombstone) {
+                                continue;
+                            }
+                        }
+
+                        entt::uninitialized_construct_using_allocator(to_address(assure_at_least(pos)), allocator, from.element_at(pos));
+                    }
+                }
+                ENTT_CATCH {
+                    for(size_type next{}; next < pos; ++next) {
+                        if constexpr(traits_type::in_place_delete) {
+                            if(base_type::data()[next] == tombstone) {
+                                continue;
+                            }
+                        }
+
+                        alloc_traits::destroy(allocator, std::addressof(element_at(next)));
+                    }
+
+                    base_type::pop_all();
+                    ENTT_THROW;
+                }
             }
         }
     }
 
+    /**
+     * @brief Copies some pages of entities and elements from another storage.
+     *
+     * Only trivially copyable elements are supported and storage classes that
+     * use in-place deletion are excluded.
+     *
+     * @sa basic_sparse_set::copy_pages_from
+     *
+     * @tparam It Type of input iterator.
+     * @param other The storage to copy the contents from.
+     * @param first An iterator to the first element of the range of pages.
+     * @param last An iterator past the last element of the range of pages.
+     */
+    template<typename It>
+    void copy_pages_from(const basic_storage &other, It first, It last) {
+        static_assert(std::is_trivially_copyable_v<Type> && !std::uses_allocator_v<Type, allocator_type> && !traits_type::in_place_delete, "Unsupported element type");
+
+        if(const auto len = other.size(); len != 0u) {
+            static_cast<void>(assure_at_least(len - 1u));
+        }
+
+        base_type::copy_pages_from(other, traits_type::page_size, first, last, [this, &other](size_type from, const size_type to) {
+            // ranges past the end of the shortest storage can span multiple pages
+            for(size_type count{}; from < to; from += count) {
+                count = (std::min)(to, (from / traits_type::page_size + 1u) * traits_type::page_size) - from;
+                std::uninitialized_copy_n(std::addressof(other.element_at(from)), count, std::addressof(element_at(from)));
+            }
+        });
+    }
+
     /**
      * @brief Assigns an entity to a storage.
      * @param entt A valid identifier.
@@ -379,6 +589,13 @@ protected:
      */
     underlying_iterator try_emplace([[maybe_unused]] const Entity entt, [[maybe_unused]] const bool force_back, const void *value) override {
         if(value != nullptr) {
+            if constexpr(std::is_move_constructible_v<element_type>) {
+                if(base_type::movable_value()) {
+                    // push_move hands over a mutable element, constness is only part of the common signature
+                    return emplace_element(entt, force_back, std::move(*static_cast<element_type *>(const_cast<void *>(value))));
+                }
+            }
+
             if constexpr(std::is_copy_constructible_v<element_type>) {
                 return emplace_element(entt, force_back, *static_cast<const element_type *>(value));
             } else {
@@ -430,6 +647,8 @@ public:
     using const_reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_reverse_iterator, const_reverse_iterator>>;
     /*! @brief Storage deletion policy. */
     static constexpr deletion_policy storage_policy{traits_type::in_place_delete};
+    /*! @brief Storage classes only expose the getter of the deletion policy. */
+    using base_type::policy;
 
     /*! @brief Default constructor. */
     basic_storage()
@@ -440,7 +659,7 @@ public:
      * @param allocator The allocator to use.
      */
     explicit basic_storage(const allocator_type &allocator)
-        : base_type{type_id<element_type>(), storage_policy, allocator},
+        : base_type{type_id<element_type>(), storage_policy, internal::sparse_page_size<traits_type, Entity>::value, allocator},
           payload{allocator} {}
 
     /*! @brief Default copy constructor, deleted on purpose. */
@@ -453,7 +672,9 @@ public:
     // NOLINTBEGIN(bugprone-use-after-move)
     basic_storage(basic_storage &&other) noexcept
         : base_type{std::move(other)},
-          payload{std::move(other.payload)} {}
+          payload{std::move(other.payload)},
+          buffer_size{std::exchange(other.buffer_size, 0u)},
+          revision{std::exchange(other.revision, other.revision + 1u)} {}
     // NOLINTEND(bugprone-use-after-move)
 
     /**
@@ -464,7 +685,9 @@ public:
     // NOLINTBEGIN(bugprone-use-after-move)
     basic_storage(basic_storage &&other, const allocator_type &allocator)
         : base_type{std::move(other), allocator},
-          payload{std::move(other.payload), allocator} {
+          payload{std::move(other.payload), allocator},
+          buffer_size{std::exchange(other.buffer_size, 0u)},
+          revision{std::exchange(other.revision, other.revision + 1u)} {
         ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a storage is not allowed");
     }
     // NOLINTEND(bugprone-use-after-move)
@@ -499,6 +722,9 @@ public:
     void swap(basic_storage &other) noexcept {
         using std::swap;
         swap(payload, other.payload);
+        swap(buffer_size, other.buffer_size);
+        // both storages change, their epochs move past the largest of the two
+        revision = other.revision = (std::max)(revision, other.revision) + 1u;
         base_type::swap(other);
     }
 
@@ -521,7 +747,60 @@ public:
     void reserve(const size_type cap) override {
         if(cap != 0u) {
             base_type::reserve(cap);
-            assure_at_least(cap - 1u);
+
+            if constexpr(is_contiguous) {
+                if(buffer_size < cap) {
+                    relocate(cap, (std::min)(base_type::size(), buffer_size));
+                }
+            } else {
+                assure_at_least(cap - 1u);
+            }
+        }
+    }
+
+    /**
+     * @brief Increases the capacity of a storage and hands the new pages to an
+     * executor, which in turn writes to them for the first time.
+     *
+     * Operating systems with a _first touch_ policy place memory on the node of
+     * the thread that writes to it first. New pages are therefore local to the
+     * threads that run their jobs rather than to the calling thread.<br/>
+     * The executor is invoked at most once with the number of new pages and a
+     * job to run for each of them. Its signature must be equivalent to the
+     * following:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, Job job);
+     * @endcode
+     *
+     * The executor must invoke `job` once for each value in `[0, count)`,
+     * possibly concurrently, and return only when all the pages have been
+     * processed. Jobs visit pages starting from the last one, like the chunks
+     * of views iterated with `each_chunked` and a grain equal to the page size
+     * when the storage is full.
+     *
+     * @warning
+     * Storage classes that aren't paginated behave as if the executor were not
+     * provided.
+     *
+     * @tparam Exec Type of the executor to use to run the jobs.
+     * @param cap Desired capacity.
+     * @param exec A valid executor.
+     */
+    template<typename Exec>
+    void reserve(const size_type cap, Exec &&exec) {
+        if constexpr(is_contiguous) {
+            reserve(cap);
+        } else {
+            const auto from = payload.size();
+            reserve(cap);
+
+            if(const auto count = payload.size(); from < count) {
+                std::forward<Exec>(exec)(count - from, [this, count](const size_type job) {
+                    // no elements exist in new pages yet, there is nothing to construct or destroy
+                    std::memset(static_cast<void *>(to_address(payload[count - job - 1u])), 0, traits_type::page_size * sizeof(element_type));
+                });
+            }
         }
     }
 
@@ -531,7 +810,31 @@ public:
      * @return Capacity of the storage.
      */
     [[nodiscard]] size_type capacity() const noexcept override {
-        return payload.size() * traits_type::page_size;
+        if constexpr(is_contiguous) {
+            return buffer_size;
+        } else {
+            return payload.size() * traits_type::page_size;
+        }
+    }
+
+    /**
+     * @brief Returns the memory used by a storage.
+     * @return The memory used by the storage.
+     */
+    [[nodiscard]] memory_report memory_usage() const noexcept override {
+        auto report = base_type::memory_usage();
+        report.element_pages = payload.size();
+        report.element_bytes = payload.capacity() * sizeof(typename container_type::value_type) + capacity() * sizeof(element_type);
+        return report;
+    }
+
+    /**
+     * @brief Checks whether elements can be moved (or at least copied) into a
+     * storage through `push_move`.
+     * @return True if elements can be moved into the storage, false otherwise.
+     */
+    [[nodiscard]] bool movable() const noexcept override {
+        return std::is_move_constructible_v<element_type> || std::is_copy_constructible_v<element_type>;
     }
 
     /*! @brief Requests the removal of unused capacity. */
@@ -540,8 +843,26 @@ public:
         shrink_to_size(base_type::size());
     }
 
+    /**
+     * @brief Returns the structural epoch of a storage.
+     *
+     * The epoch changes whenever elements are moved around or destroyed, for
+     * example when entities are removed, the storage is sorted or compacted or
+     * a storage that isn't paginated grows. Pointers to elements obtained in
+     * the same epoch are still valid.
+     *
+     * @return The structural epoch of the storage.
+     */
+    [[nodiscard]] size_type epoch() const noexcept {
+        return revision;
+    }
+
     /**
      * @brief Direct access to the array of objects.
+     *
+     * Objects are stored in pages. Storage classes that aren't paginated have
+     * at most one page that contains all the objects.
+     *
      * @return A pointer to the array of objects.
      */
     [[nodiscard]] const_pointer raw() const noexcept {
@@ -668,6 +989,40 @@ public:
         return std::forward_as_tuple(get(entt));
     }
 
+    /**
+     * @brief Returns the object at a given position in the storage.
+     *
+     * @warning
+     * Attempting to use a position that is out of bounds or that refers to a
+     * tombstone results in undefined behavior.
+     *
+     * @param pos A valid position.
+     * @return The object at the given position.
+     */
+    [[nodiscard]] const value_type &at(const size_type pos) const noexcept {
+        ENTT_ASSERT(pos < base_type::size(), "Index out of bounds");
+        return element_at(pos);
+    }
+
+    /*! @copydoc at */
+    [[nodiscard]] value_type &at(const size_type pos) noexcept {
+        return const_cast<value_type &>(std::as_const(*this).at(pos));
+    }
+
+    /**
+     * @brief Returns the object at a given position in the storage as a tuple.
+     * @param pos A valid position.
+     * @return The object at the given position as a tuple.
+     */
+    [[nodiscard]] std::tuple<const value_type &> at_as_tuple(const size_type pos) const noexcept {
+        return std::forward_as_tuple(at(pos));
+    }
+
+    /*! @copydoc at_as_tuple */
+    [[nodiscard]] std::tuple<value_type &> at_as_tuple(const size_type pos) noexcept {
+        return std::forward_as_tuple(at(pos));
+    }
+
     /**
      * @brief Assigns an entity to a storage and constructs its object.
      *
@@ -751,6 +1106,37 @@ public:
         return begin();
     }
 
+    /**
+     * @brief Assigns one or more entities to a storage and constructs their
+     * objects from the values returned by a generator.
+     *
+     * The generator is invoked once per entity and in order, with the entity
+     * as its only argument. Objects are constructed in place from the returned
+     * values and no intermediate container is required. When the generator
+     * returns the element type by value and it isn't allocator aware, the
+     * copy is elided and the object is built directly in its page.
+     *
+     * @warning
+     * Attempting to assign an entity that already belongs to the storage
+     * results in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @tparam Func Type of generator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @param func A valid generator.
+     * @return Iterator pointing to the first element inserted, if any.
+     */
+    template<typename It, typename Func>
+    std::enable_if_t<std::is_same_v<std::invoke_result_t<Func &, const entity_type>, value_type> || std::is_constructible_v<value_type, std::invoke_result_t<Func &, const entity_type>>, iterator>
+    insert(It first, It last, Func func) {
+        for(; first != last; ++first) {
+            generate_element(*first, func);
+        }
+
+        return begin();
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a storage.
      *
@@ -784,8 +1170,51 @@ public:
         return const_reverse_iterable{{base_type::crbegin(), crbegin()}, {base_type::crend(), crend()}};
     }
 
+    /**
+     * @brief Iterates the contiguous chunks of a storage.
+     *
+     * The function object is invoked once per page in use, in memory order.
+     * Its signature is equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type *, size_type, value_type *);
+     * @endcode
+     *
+     * The arguments are the entities of the chunk, their number and the array
+     * of their elements, both of the same length. Storage classes that aren't
+     * paginated are made of a single chunk.
+     *
+     * @warning
+     * Storage classes that use in-place deletion may return tombstones among
+     * the entities. In this case, the corresponding elements must not be
+     * accessed.<br/>
+     * Adding or removing elements while iterating the chunks results in
+     * undefined behavior.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_chunk(Func func) {
+        for(size_type pos{}, len = base_type::size(), count{}; pos < len; pos += count) {
+            count = (std::min)(static_cast<size_type>(traits_type::page_size), len - pos);
+            func(base_type::data() + pos, count, to_address(payload[pos / traits_type::page_size]));
+        }
+    }
+
+    /*! @copydoc each_chunk */
+    template<typename Func>
+    void each_chunk(Func func) const {
+        for(size_type pos{}, len = base_type::size(), count{}; pos < len; pos += count) {
+            count = (std::min)(static_cast<size_type>(traits_type::page_size), len - pos);
+            func(base_type::data() + pos, count, static_cast<const value_type *>(to_address(payload[pos / traits_type::page_size])));
+        }
+    }
+
 private:
     container_type payload;
+    size_type buffer_size{};
+    size_type revision{};
 };
 
 /*! @copydoc basic_storage */
@@ -796,6 +1225,10 @@ class basic_storage<Type, Entity, Allocator, std::enable_if_t<component_traits<T
     static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
     using traits_type = component_traits<Type, Entity>;
 
+    void policy([[maybe_unused]] const deletion_policy pol) final {
+        ENTT_ASSERT(pol == storage_policy, "Storage classes cannot change deletion policy");
+    }
+
 public:
     /*! @brief Allocator type. */
     using allocator_type = Allocator;
@@ -821,6 +1254,8 @@ public:
     using const_reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_reverse_iterator>>;
     /*! @brief Storage deletion policy. */
     static constexpr deletion_policy storage_policy{traits_type::in_place_delete};
+    /*! @brief Storage classes only expose the getter of the deletion policy. */
+    using base_type::policy;
 
     /*! @brief Default constructor. */
     basic_storage()
@@ -831,7 +1266,7 @@ public:
      * @param allocator The allocator to use.
      */
     explicit basic_storage(const allocator_type &allocator)
-        : base_type{type_id<element_type>(), storage_policy, allocator} {}
+        : base_type{type_id<element_type>(), storage_policy, internal::sparse_page_size<traits_type, Entity>::value, allocator} {}
 
     /*! @brief Default copy constructor, deleted on purpose. */
     basic_storage(const basic_storage &) = delete;
@@ -902,6 +1337,16 @@ public:
         return std::tuple{};
     }
 
+    /**
+     * @brief Returns an empty tuple.
+     * @param pos A valid position.
+     * @return Returns an empty tuple.
+     */
+    [[nodiscard]] std::tuple<> at_as_tuple([[maybe_unused]] const size_type pos) const noexcept {
+        ENTT_ASSERT(pos < base_type::size(), "Index out of bounds");
+        return std::tuple{};
+    }
+
     /**
      * @brief Assigns an entity to a storage and constructs its object.
      *
@@ -978,6 +1423,71 @@ public:
     }
 };
 
+/**
+ * @brief Block of identifiers handed out by an entity storage.
+ *
+ * Identifiers are generated from a block with a simple bump and without any
+ * synchronization. Therefore, a block is meant to be used by a single thread
+ * at a time.
+ *
+ * @tparam Entity A valid entity type.
+ */
+template<typename Entity>
+class basic_entity_block {
+    using traits_type = entt_traits<Entity>;
+
+    template<typename, typename, typename, typename>
+    friend class basic_storage;
+
+    constexpr basic_entity_block(const std::size_t from, const std::size_t to) noexcept
+        : first{from},
+          cursor{from},
+          last{to} {}
+
+public:
+    /*! @brief Underlying entity identifier. */
+    using entity_type = Entity;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    constexpr basic_entity_block() noexcept = default;
+
+    /**
+     * @brief Generates an identifier from the block.
+     *
+     * The identifier isn't valid until the block is released to the storage
+     * that handed it out.
+     *
+     * @return A new identifier.
+     */
+    [[nodiscard]] entity_type create() noexcept {
+        ENTT_ASSERT(cursor != last, "No more identifiers available");
+        return traits_type::combine(static_cast<typename traits_type::entity_type>(cursor++), {});
+    }
+
+    /**
+     * @brief Returns the number of identifiers left in a block.
+     * @return Number of identifiers left in the block.
+     */
+    [[nodiscard]] constexpr size_type size() const noexcept {
+        return last - cursor;
+    }
+
+    /**
+     * @brief Checks whether a block is exhausted.
+     * @return True if the block is exhausted, false otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return cursor == last;
+    }
+
+private:
+    size_type first{};
+    size_type cursor{};
+    size_type last{};
+};
+
 /**
  * @brief Swap-only entity storage specialization.
  * @tparam Entity A valid entity type.
@@ -991,6 +1501,10 @@ class basic_storage<Entity, Entity, Allocator>
     using underlying_iterator = typename basic_sparse_set<Entity, Allocator>::basic_iterator;
     using traits_type = entt_traits<Entity>;
 
+    void policy([[maybe_unused]] const deletion_policy pol) final {
+        ENTT_ASSERT(pol == storage_policy, "Storage classes cannot change deletion policy");
+    }
+
     auto from_placeholder() noexcept {
         const auto entt = traits_type::combine(static_cast<typename traits_type::entity_type>(placeholder), {});
         ENTT_ASSERT(entt != null, "No more entities available");
@@ -1008,11 +1522,64 @@ class basic_storage<Entity, Entity, Allocator>
         return entt;
     }
 
+    [[nodiscard]] bool ordered_from(const std::size_t from, const std::size_t to) const noexcept {
+        for(auto pos = from + 1u; pos < to; ++pos) {
+            if(traits_type::to_entity(base_type::data()[pos]) < traits_type::to_entity(base_type::data()[pos - 1u])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void sort_free_list() {
+        const auto len = base_type::free_list();
+        std::vector<entity_type, allocator_type> elem{base_type::data() + len, base_type::data() + base_type::size(), base_type::get_allocator()};
+        std::sort(elem.begin(), elem.end(), [](const auto lhs, const auto rhs) { return traits_type::to_entity(lhs) < traits_type::to_entity(rhs); });
+
+        for(size_type pos{}, last = elem.size(); pos < last; ++pos) {
+            base_type::swap_elements(base_type::data()[len + pos], elem[pos]);
+        }
+
+        ordered = true;
+    }
+
 protected:
+    /**
+     * @brief Erases entities from a storage.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    void pop(underlying_iterator first, underlying_iterator last) override {
+        const auto count = static_cast<size_type>(last - first);
+        base_type::pop(first, last);
+
+        if(ordered && order == recycling_policy::lowest_index_first) {
+            // released identifiers are moved to the front of the free list
+            const auto len = base_type::free_list();
+            ordered = ordered_from(len, (std::min)(len + count + 1u, base_type::size()));
+        }
+    }
+
     /*! @brief Erases all entities of a storage. */
     void pop_all() override {
         base_type::pop_all();
         placeholder = {};
+        ordered = true;
+    }
+
+    /**
+     * @brief Copies entities and the free list from another storage.
+     * @param other The storage to copy the contents from.
+     */
+    void copy_from(const basic_sparse_set<Entity, Allocator> &other) override {
+        const auto &from = static_cast<const basic_storage &>(other);
+        base_type::copy_from(other);
+        placeholder = from.placeholder;
+        recycled.store(from.recycled.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        fresh.store(from.fresh.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        order = from.order;
+        ordered = from.ordered;
     }
 
     /**
@@ -1047,8 +1614,12 @@ public:
     using reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::reverse_iterator>>;
     /*! @brief Constant extended reverse iterable storage proxy. */
     using const_reverse_iterable = iterable_adaptor<internal::extended_storage_iterator<typename base_type::const_reverse_iterator>>;
+    /*! @brief Type of blocks of identifiers handed out by the storage. */
+    using block_type = basic_entity_block<Entity>;
     /*! @brief Storage deletion policy. */
     static constexpr deletion_policy storage_policy = deletion_policy::swap_only;
+    /*! @brief Storage classes only expose the getter of the deletion policy. */
+    using base_type::policy;
 
     /*! @brief Default constructor. */
     basic_storage()
@@ -1072,7 +1643,11 @@ public:
     // NOLINTBEGIN(bugprone-use-after-move)
     basic_storage(basic_storage &&other) noexcept
         : base_type{std::move(other)},
-          placeholder{other.placeholder} {}
+          placeholder{other.placeholder},
+          recycled{other.recycled.load(std::memory_order_relaxed)},
+          fresh{other.fresh.load(std::memory_order_relaxed)},
+          order{other.order},
+          ordered{other.ordered} {}
     // NOLINTEND(bugprone-use-after-move)
 
     /**
@@ -1083,7 +1658,11 @@ public:
     // NOLINTBEGIN(bugprone-use-after-move)
     basic_storage(basic_storage &&other, const allocator_type &allocator)
         : base_type{std::move(other), allocator},
-          placeholder{other.placeholder} {}
+          placeholder{other.placeholder},
+          recycled{other.recycled.load(std::memory_order_relaxed)},
+          fresh{other.fresh.load(std::memory_order_relaxed)},
+          order{other.order},
+          ordered{other.ordered} {}
     // NOLINTEND(bugprone-use-after-move)
 
     /*! @brief Default destructor. */
@@ -1102,6 +1681,10 @@ public:
      */
     basic_storage &operator=(basic_storage &&other) noexcept {
         placeholder = other.placeholder;
+        recycled.store(other.recycled.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        fresh.store(other.fresh.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        order = other.order;
+        ordered = other.ordered;
         base_type::operator=(std::move(other));
         return *this;
     }
@@ -1129,12 +1712,27 @@ public:
         return std::tuple{};
     }
 
+    /**
+     * @brief Returns an empty tuple.
+     * @param pos A valid position.
+     * @return Returns an empty tuple.
+     */
+    [[nodiscard]] std::tuple<> at_as_tuple([[maybe_unused]] const size_type pos) const noexcept {
+        ENTT_ASSERT(pos < base_type::free_list(), "The requested entity is not a live one");
+        return std::tuple{};
+    }
+
     /**
      * @brief Creates a new identifier or recycles a destroyed one.
      * @return A valid identifier.
      */
     entity_type generate() {
         const auto len = base_type::free_list();
+
+        if(!ordered && order == recycling_policy::lowest_index_first && len != base_type::size()) {
+            sort_free_list();
+        }
+
         const auto entt = (len == base_type::size()) ? next() : base_type::data()[len];
         return *base_type::try_emplace(entt, true);
     }
@@ -1151,6 +1749,8 @@ public:
     entity_type generate(const entity_type hint) {
         if(hint != null && hint != tombstone) {
             if(const auto curr = traits_type::construct(traits_type::to_entity(hint), base_type::current(hint)); curr == tombstone || !(base_type::index(curr) < base_type::free_list())) {
+                // the hint is swapped with the front of the free list, if any
+                ordered = ordered && (base_type::free_list() == base_type::size());
                 return *base_type::try_emplace(hint, true);
             }
         }
@@ -1166,13 +1766,145 @@ public:
      */
     template<typename It>
     void generate(It first, It last) {
-        for(const auto sz = base_type::size(); first != last && base_type::free_list() != sz; ++first) {
-            *first = *base_type::try_emplace(base_type::data()[base_type::free_list()], true);
+        if(!ordered && order == recycling_policy::lowest_index_first && first != last) {
+            sort_free_list();
         }
 
-        for(; first != last; ++first) {
-            *first = *base_type::try_emplace(next(), true);
+        // recycled identifiers are already in place and have the right version
+        for(auto pos = base_type::free_list(), sz = base_type::size(); first != last && pos != sz; ++first, ++pos) {
+            *first = base_type::data()[pos];
+            base_type::free_list(pos + 1u);
+        }
+
+        if(first != last) {
+            for(auto it = first; it != last; ++it) {
+                *it = next();
+            }
+
+            base_type::push_back_range(first, last);
+        }
+    }
+
+    /**
+     * @brief Reserves an identifier without creating it.
+     *
+     * Reserved identifiers are either recycled or new ones. They are made
+     * valid by the next call to `materialize` and aren't valid until then.
+     *
+     * @note
+     * This function is thread safe and can be invoked concurrently from
+     * different threads, as long as the storage isn't otherwise modified
+     * until reserved identifiers are materialized.
+     *
+     * @return A reserved identifier.
+     */
+    [[nodiscard]] entity_type reserve_entity() noexcept {
+        const auto len = base_type::free_list();
+
+        if(const auto pos = recycled.fetch_add(1u, std::memory_order_relaxed); pos < (base_type::size() - len)) {
+            return base_type::data()[len + pos];
+        }
+
+        for(;;) {
+            const auto entt = traits_type::combine(static_cast<typename traits_type::entity_type>(placeholder + fresh.fetch_add(1u, std::memory_order_relaxed)), {});
+            ENTT_ASSERT(entt != null, "No more entities available");
+
+            // identifiers assigned on request are skipped, as it happens on creation
+            if(base_type::current(entt) == traits_type::to_version(tombstone)) {
+                return entt;
+            }
+        }
+    }
+
+    /**
+     * @brief Makes all reserved identifiers valid.
+     *
+     * Reserved identifiers are contiguous in the storage after this call and
+     * are placed right before the free list.
+     */
+    void materialize() {
+        const auto len = base_type::free_list();
+        base_type::free_list(len + (std::min)(recycled.exchange(0u, std::memory_order_relaxed), base_type::size() - len));
+
+        for(const auto last = placeholder + fresh.exchange(0u, std::memory_order_relaxed); placeholder < last; ++placeholder) {
+            if(const auto entt = traits_type::combine(static_cast<typename traits_type::entity_type>(placeholder), {}); base_type::current(entt) == traits_type::to_version(tombstone)) {
+                base_type::try_emplace(entt, true);
+            }
+        }
+    }
+
+    /**
+     * @brief Hands out a block of new identifiers.
+     *
+     * Identifiers in a block are contiguous and never recycled. They are
+     * created from the block without synchronization and made valid when the
+     * block is released. The block is smaller than requested if one of the
+     * identifiers in the range is already in use.
+     *
+     * @warning
+     * Blocks are acquired and released at synchronization points, that is,
+     * when no other thread accesses the storage. Reserved identifiers must be
+     * materialized first.
+     *
+     * @param count Number of identifiers to put in the block.
+     * @return A block of identifiers.
+     */
+    [[nodiscard]] block_type acquire_block(const size_type count) {
+        ENTT_ASSERT((recycled.load(std::memory_order_relaxed) == 0u) && (fresh.load(std::memory_order_relaxed) == 0u), "Identifiers are still reserved");
+        const auto available = [this](const size_type pos) {
+            const auto entt = traits_type::combine(static_cast<typename traits_type::entity_type>(pos), {});
+            return (entt != null) && (base_type::current(entt) == traits_type::to_version(tombstone));
+        };
+
+        // identifiers assigned on request are skipped, as it happens on creation
+        for(; count != 0u && !available(placeholder) && (traits_type::combine(static_cast<typename traits_type::entity_type>(placeholder), {}) != null); ++placeholder) {}
+
+        ENTT_ASSERT(count == 0u || available(placeholder), "No more entities available");
+        const auto from = placeholder;
+
+        for(; (placeholder - from) < count && available(placeholder); ++placeholder) {}
+
+        return block_type{from, placeholder};
+    }
+
+    /**
+     * @brief Makes valid all identifiers created from a block and returns the
+     * unused ones to the storage.
+     *
+     * Identifiers made valid are contiguous in the storage after this call and
+     * are placed right before the free list. The block is left empty.
+     *
+     * @warning
+     * Blocks are acquired and released at synchronization points, that is,
+     * when no other thread accesses the storage. Reserved identifiers must be
+     * materialized first.
+     *
+     * @param block A block of identifiers handed out by the storage.
+     */
+    void release_block(block_type &block) {
+        ENTT_ASSERT((recycled.load(std::memory_order_relaxed) == 0u) && (fresh.load(std::memory_order_relaxed) == 0u), "Identifiers are still reserved");
+        const auto emplace = [this](const size_type pos) { base_type::try_emplace(traits_type::combine(static_cast<typename traits_type::entity_type>(pos), {}), true); };
+        ordered = ordered && (base_type::free_list() == base_type::size());
+
+        for(auto pos = block.first; pos < block.cursor; ++pos) {
+            emplace(pos);
+        }
+
+        if(block.last == placeholder) {
+            // nothing was handed out in the meantime, unused identifiers are given back
+            placeholder = block.cursor;
+        } else if(block.cursor != block.last) {
+            const auto len = base_type::free_list();
+
+            for(auto pos = block.cursor; pos < block.last; ++pos) {
+                emplace(pos);
+            }
+
+            base_type::free_list(len);
+            ordered = false;
         }
+
+        block = block_type{};
     }
 
     /**
@@ -1234,10 +1966,99 @@ public:
         placeholder = static_cast<size_type>(traits_type::to_entity(hint));
     }
 
+    /**
+     * @brief Returns the recycling policy of a storage.
+     * @return The recycling policy of the storage.
+     */
+    [[nodiscard]] recycling_policy recycling() const noexcept {
+        return order;
+    }
+
+    /**
+     * @brief Sets the recycling policy of a storage.
+     *
+     * Released identifiers are recycled in last in, first out order by default.
+     * Recycling the identifiers with the lowest index first keeps the range of
+     * indices in use as small as possible instead, at the cost of sorting the
+     * free list every now and then, that is, when it's no longer ordered.
+     *
+     * @param policy The recycling policy to use.
+     */
+    void recycling(const recycling_policy policy) noexcept {
+        ordered = ordered && (order == policy);
+        order = policy;
+    }
+
+    /**
+     * @brief Renumbers live identifiers into a compact range of indices.
+     *
+     * Live identifiers with an index greater than or equal to the number of
+     * live identifiers take the lowest indices that aren't in use, in order.
+     * The version of a recycled index is preserved, if any. The free list is
+     * dropped and new identifiers are generated right after the compact range.
+     * Therefore, sparse pages beyond the range are released by the next call
+     * to `shrink_to_fit`.<br/>
+     * The function object is invoked once per renumbered identifier and its
+     * signature is equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type from, const entity_type to);
+     * @endcode
+     *
+     * @warning
+     * Identifiers of released entities are forgotten, so are their versions
+     * for indices that aren't reused. Moreover, reserved identifiers must be
+     * materialized first.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void defragment(Func func) {
+        ENTT_ASSERT(recycled.load(std::memory_order_relaxed) == 0u && fresh.load(std::memory_order_relaxed) == 0u, "Reserved identifiers not materialized");
+        const auto live = base_type::free_list();
+        std::vector<entity_type, allocator_type> elem{base_type::data(), base_type::data() + live, base_type::get_allocator()};
+        std::vector<bool, typename alloc_traits::template rebind_alloc<bool>> used(live, false, base_type::get_allocator());
+
+        for(auto entt: elem) {
+            if(const auto pos = static_cast<size_type>(traits_type::to_entity(entt)); pos < live) {
+                used[pos] = true;
+            }
+        }
+
+        for(size_type pos{}, slot{}; pos < live; ++pos) {
+            if(!(static_cast<size_type>(traits_type::to_entity(elem[pos])) < live)) {
+                for(; used[slot]; ++slot) {}
+
+                auto other = traits_type::combine(static_cast<typename traits_type::entity_type>(slot++), {});
+
+                if(const auto version = base_type::current(other); version != traits_type::to_version(tombstone)) {
+                    other = traits_type::construct(traits_type::to_entity(other), version);
+                }
+
+                func(elem[pos], other);
+                elem[pos] = other;
+            }
+        }
+
+        base_type::pop_all();
+        base_type::push_back_range(elem.begin(), elem.end());
+        placeholder = live;
+        ordered = true;
+    }
+
 private:
     size_type placeholder{};
+    std::atomic<size_type> recycled{};
+    std::atomic<size_type> fresh{};
+    recycling_policy order{};
+    bool ordered{true};
 };
 
+#ifdef ENTT_USE_EXTERN_TEMPLATE
+extern template class basic_storage<entity>;
+#endif
+
 } // namespace entt
 
 #endif
@@ -1,12 +1,17 @@
 #ifndef ENTT_ENTITY_VIEW_HPP
 #define ENTT_ENTITY_VIEW_HPP
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <memory>
+#include <optional>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
 #include "../core/iterator.hpp"
 #include "../core/type_traits.hpp"
@@ -41,6 +46,45 @@ template<typename It, typename Entity>
     return first == last;
 }
 
+inline constexpr std::size_t view_batch_size = 16u;
+
+template<bool Expected, typename Type, typename Entity>
+[[nodiscard]] std::uint32_t contains_mask(const Type *pool, const Entity *elem, const std::size_t len, std::uint32_t mask) noexcept {
+    for(std::size_t pos{}; pos < len; ++pos) {
+        // branchless update, lookups for a batch are independent of each other
+        mask &= ~(static_cast<std::uint32_t>(pool->contains(elem[pos]) != Expected) << pos);
+    }
+
+    return mask;
+}
+
+template<typename Type, typename Entity>
+void prefetch_element([[maybe_unused]] const Type *pool, [[maybe_unused]] const Entity entt) noexcept {
+    if constexpr(std::is_lvalue_reference_v<decltype(pool->get(entt))>) {
+        // sparse entries are already cached by the lookups, elements are not
+        ENTT_PREFETCH(std::addressof(pool->get(entt)));
+    }
+}
+
+template<bool Checked, typename Type>
+[[nodiscard]] typename Type::const_iterator view_seek(typename Type::const_iterator it, const Type *const *pools, const std::size_t get, const std::size_t index, const Type *const *filter, const std::size_t exclude) noexcept {
+    // type-only on purpose, all views with the same common type share this function
+    for(constexpr typename Type::const_iterator sentinel{}; it != sentinel; ++it) {
+        if constexpr(Checked) {
+            // runs of tombstones are skipped at once, the leading pool is the only one
+            if(it = pools[index]->skip_tombstones(it); it == sentinel) {
+                break;
+            }
+        }
+
+        if(const auto entt = *it; internal::all_of(pools, pools + index, entt) && internal::all_of(pools + index + 1u, pools + get, entt) && internal::none_of(filter, filter + exclude, entt)) {
+            break;
+        }
+    }
+
+    return it;
+}
+
 template<typename It>
 [[nodiscard]] bool fully_initialized(It first, const It last, const std::remove_pointer_t<typename std::iterator_traits<It>::value_type> *placeholder) noexcept {
     for(; (first != last) && *first != placeholder; ++first) {}
@@ -66,14 +110,8 @@ class view_iterator final {
     using iterator_type = typename Type::const_iterator;
     using iterator_traits = std::iterator_traits<iterator_type>;
 
-    [[nodiscard]] bool valid(const typename iterator_traits::value_type entt) const noexcept {
-        return (!Checked || (entt != tombstone))
-               && ((Get == 1u) || (internal::all_of(pools.begin(), pools.begin() + index, entt) && internal::all_of(pools.begin() + index + 1, pools.end(), entt)))
-               && ((Exclude == 0u) || internal::none_of(filter.begin(), filter.end(), entt));
-    }
-
     void seek_next() {
-        for(constexpr iterator_type sentinel{}; it != sentinel && !valid(*it); ++it) {}
+        it = internal::view_seek<Checked>(it, pools.data(), Get, static_cast<std::size_t>(index), filter.data(), Exclude);
     }
 
 public:
@@ -197,6 +235,48 @@ template<typename... Lhs, typename... Rhs>
     return !(lhs == rhs);
 }
 
+template<typename Entity, typename Type, typename Func>
+[[nodiscard]] auto reduce_step(Type &acc, Func &func) noexcept {
+    return [&acc, &func](const Entity entt, auto &&...elem) {
+        if constexpr(std::is_invocable_v<Func &, Type &, const Entity, decltype(elem)...>) {
+            func(acc, entt, std::forward<decltype(elem)>(elem)...);
+        } else {
+            func(acc, std::forward<decltype(elem)>(elem)...);
+        }
+    };
+}
+
+template<typename Entity, typename Type, typename Map, typename Combine>
+[[nodiscard]] auto transform_step(Map &map, Combine &combine) noexcept {
+    return [&map, &combine](std::optional<Type> &acc, const Entity entt, auto &&...elem) {
+        Type value = [&]() {
+            if constexpr(std::is_invocable_v<Map &, const Entity, decltype(elem)...>) {
+                return map(entt, std::forward<decltype(elem)>(elem)...);
+            } else {
+                return map(std::forward<decltype(elem)>(elem)...);
+            }
+        }();
+
+        if(acc) {
+            *acc = combine(std::move(*acc), std::move(value));
+        } else {
+            acc.emplace(std::move(value));
+        }
+    };
+}
+
+template<typename Type, typename Combine>
+[[nodiscard]] auto optional_combine(Combine &combine) noexcept {
+    return [&combine](std::optional<Type> lhs, std::optional<Type> rhs) {
+        if(lhs && rhs) {
+            lhs.emplace(combine(std::move(*lhs), std::move(*rhs)));
+            return lhs;
+        }
+
+        return lhs ? lhs : rhs;
+    };
+}
+
 } // namespace internal
 /*! @endcond */
 
@@ -291,6 +371,20 @@ protected:
         return internal::none_of(filter.begin(), filter.end(), entt);
     }
 
+    [[nodiscard]] std::uint32_t batch_mask(const typename Type::entity_type *elem, const std::size_t len, std::uint32_t mask) const noexcept {
+        for(size_type pos{}; (pos < Get) && (mask != 0u); ++pos) {
+            if(pos != index) {
+                mask = internal::contains_mask<true>(pools[pos], elem, len, mask);
+            }
+        }
+
+        for(size_type pos{}; (pos < Exclude) && (mask != 0u); ++pos) {
+            mask = internal::contains_mask<false>(filter[pos], elem, len, mask);
+        }
+
+        return mask;
+    }
+
     void use(const std::size_t pos) noexcept {
         index = (index != Get) ? pos : Get;
     }
@@ -318,6 +412,39 @@ public:
         }
     }
 
+    /**
+     * @brief Updates the internal leading view only if it is worth it.
+     *
+     * The leading storage is replaced by the smallest one only when the latter
+     * is smaller than the former by more than the given fraction of its size.
+     * This avoids switching from one storage to another at every refresh when
+     * their sizes oscillate around the same values.
+     *
+     * @param gain Minimum relative gain required to switch leading storage.
+     * @return True if the leading storage has changed, false otherwise.
+     */
+    bool refresh(const float gain) noexcept {
+        if(index == Get) {
+            refresh();
+            return (index != Get);
+        }
+
+        size_type pos = index;
+
+        for(size_type next{}; next < Get; ++next) {
+            if(pools[next]->size() < pools[pos]->size()) {
+                pos = next;
+            }
+        }
+
+        if(const auto best = static_cast<float>(pools[pos]->size()); (pos != index) && (best < static_cast<float>(pools[index]->size()) * (1.f - gain))) {
+            index = pos;
+            return true;
+        }
+
+        return false;
+    }
+
     /**
      * @brief Returns the leading storage of a view, if any.
      * @return The leading storage of the view.
@@ -444,33 +571,62 @@ class basic_view<get_t<Get...>, exclude_t<Exclude...>, std::enable_if_t<(sizeof.
         return std::tuple_cat(storage<Index>()->get_as_tuple(entt)...);
     }
 
-    template<std::size_t Curr, std::size_t Other, typename... Args>
-    [[nodiscard]] auto dispatch_get(const std::tuple<typename base_type::entity_type, Args...> &curr) const {
+    template<std::size_t Curr, std::size_t Other>
+    [[nodiscard]] auto dispatch_get(const typename base_type::entity_type entt, const std::size_t pos) const {
         if constexpr(Curr == Other) {
-            return std::forward_as_tuple(std::get<Args>(curr)...);
+            // the position within the leading storage is known in advance
+            return storage<Other>()->at_as_tuple(pos);
         } else {
-            return storage<Other>()->get_as_tuple(std::get<0>(curr));
+            return storage<Other>()->get_as_tuple(entt);
+        }
+    }
+
+    template<std::size_t Curr, std::size_t... Index>
+    void prefetch(const typename base_type::entity_type *elem, std::uint32_t mask, std::index_sequence<Index...>) const noexcept {
+        for(std::size_t pos{}; mask != 0u; mask >>= 1u, ++pos) {
+            if((mask & 1u) != 0u) {
+                // the leading storage is accessed sequentially and needs no help
+                ((Curr == Index ? void() : internal::prefetch_element(storage<Index>(), elem[pos])), ...);
+            }
         }
     }
 
     template<std::size_t Curr, typename Func, std::size_t... Index>
-    void each(Func &func, std::index_sequence<Index...>) const {
-        for(const auto curr: storage<Curr>()->each()) {
-            if(const auto entt = std::get<0>(curr); (!internal::tombstone_check_v<Get...> || (entt != tombstone)) && ((Curr == Index || base_type::pool_at(Index)->contains(entt)) && ...) && base_type::none_of(entt)) {
-                if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
-                    std::apply(func, std::tuple_cat(std::make_tuple(entt), dispatch_get<Curr, Index>(curr)...));
-                } else {
-                    std::apply(func, std::tuple_cat(dispatch_get<Curr, Index>(curr)...));
+    void each(Func &func, typename base_type::common_type::const_iterator first, const typename base_type::common_type::const_iterator last, std::index_sequence<Index...>) const {
+        std::array<typename base_type::entity_type, internal::view_batch_size> elem{};
+
+        while(first != last) {
+            const auto base = static_cast<size_type>(first.index());
+            std::uint32_t mask{};
+            std::size_t len{};
+
+            for(; (len < elem.size()) && (first != last); ++len, ++first) {
+                elem[len] = *first;
+                mask |= static_cast<std::uint32_t>(!internal::tombstone_check_v<Get...> || (elem[len] != tombstone)) << len;
+            }
+
+            mask = base_type::batch_mask(elem.data(), len, mask);
+            prefetch<Curr>(elem.data(), mask, std::index_sequence<Index...>{});
+
+            for(std::size_t pos{}; mask != 0u; mask >>= 1u, ++pos) {
+                if(const auto entt = elem[pos]; (mask & 1u) != 0u) {
+                    // positions decrease while iterating a storage
+                    const auto idx = base - pos;
+
+                    if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                        std::apply(func, std::tuple_cat(std::make_tuple(entt), dispatch_get<Curr, Index>(entt, idx)...));
+                    } else {
+                        std::apply(func, std::tuple_cat(dispatch_get<Curr, Index>(entt, idx)...));
+                    }
                 }
             }
         }
     }
 
     template<typename Func, std::size_t... Index>
-    void pick_and_each(Func &func, std::index_sequence<Index...> seq) const {
-        if(const auto *view = base_type::handle(); view != nullptr) {
-            ((view == base_type::pool_at(Index) ? each<Index>(func, seq) : void()), ...);
-        }
+    void pick_and_each(Func &func, const typename base_type::common_type::const_iterator first, const typename base_type::common_type::const_iterator last, std::index_sequence<Index...> seq) const {
+        const auto *view = base_type::handle();
+        ((view == base_type::pool_at(Index) ? each<Index>(func, first, last, seq) : void()), ...);
     }
 
 public:
@@ -632,7 +788,236 @@ public:
      */
     template<typename Func>
     void each(Func func) const {
-        pick_and_each(func, std::index_sequence_for<Get...>{});
+        if(const auto *view = base_type::handle(); view != nullptr) {
+            pick_and_each(func, view->end() - static_cast<difference_type>(base_type::size_hint()), view->end(), std::index_sequence_for<Get...>{});
+        }
+    }
+
+    /**
+     * @brief Iterates entities and elements that satisfy a predicate and
+     * applies the given function object to them.
+     *
+     * The predicate is evaluated on the element of the given type before any
+     * other element is fetched. Its signature must be equivalent to the
+     * following:
+     *
+     * @code{.cpp}
+     * bool(const Type &);
+     * @endcode
+     *
+     * The signature of the function is the same required by `each`.
+     *
+     * @tparam Type Type of element to test.
+     * @tparam Pred Type of the predicate to use to filter entities.
+     * @tparam Func Type of the function object to invoke.
+     * @param pred A valid predicate.
+     * @param func A valid function object.
+     */
+    template<typename Type, typename Pred, typename Func>
+    void each_if(Pred pred, Func func) const {
+        each_if<index_of<Type>>(std::move(pred), std::move(func));
+    }
+
+    /**
+     * @brief Iterates entities and elements that satisfy a predicate and
+     * applies the given function object to them.
+     *
+     * @sa each_if
+     *
+     * @tparam Index Index of the element to test.
+     * @tparam Pred Type of the predicate to use to filter entities.
+     * @tparam Func Type of the function object to invoke.
+     * @param pred A valid predicate.
+     * @param func A valid function object.
+     */
+    template<std::size_t Index, typename Pred, typename Func>
+    void each_if(Pred pred, Func func) const {
+        static_assert(Index < sizeof...(Get), "Index out of bounds");
+
+        for(const auto entt: *this) {
+            if(pred(std::as_const(*storage<Index>()).get(entt))) {
+                if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                    std::apply(func, std::tuple_cat(std::make_tuple(entt), get(entt)));
+                } else {
+                    std::apply(func, get(entt));
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Iterates a slice of the range of the leading storage and applies
+     * the given function object to the entities and elements in it.
+     *
+     * Offsets are relative to the beginning of the range in iteration order.
+     * The returned offset is where the iteration should resume from and equals
+     * `size_hint` once the whole range has been visited. This makes it easy to
+     * amortize the work over several calls or to split it manually:
+     *
+     * @code{.cpp}
+     * cursor = view.each_range(cursor, budget, func);
+     * @endcode
+     *
+     * The signature of the function is the same required by `each`.
+     *
+     * @warning
+     * Entities can be skipped or visited more than once if the storage iterated
+     * by the view are modified between calls.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param offset Position of the first entity of the slice.
+     * @param count Maximum number of entities in the slice.
+     * @param func A valid function object.
+     * @return The position past the last entity of the slice.
+     */
+    template<typename Func>
+    size_type each_range(const size_type offset, const size_type count, Func func) const {
+        if(const auto *view = base_type::handle(); view != nullptr) {
+            const auto len = base_type::size_hint();
+            const auto from = (std::min)(offset, len);
+            const auto to = from + (std::min)(count, len - from);
+            const auto first = view->end() - static_cast<difference_type>(len);
+            pick_and_each(func, first + static_cast<difference_type>(from), first + static_cast<difference_type>(to), std::index_sequence_for<Get...>{});
+            return to;
+        }
+
+        return size_type{};
+    }
+
+    /**
+     * @brief Splits the range of the leading storage in contiguous chunks and
+     * hands them to an executor, which in turn applies the given function
+     * object to the entities and elements of each chunk.
+     *
+     * The executor is invoked once with the number of chunks and a job to run
+     * for each of them. Its signature must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, Job job);
+     * @endcode
+     *
+     * The executor must invoke `job` once for each value in `[0, count)`,
+     * possibly concurrently, and return only when all the chunks have been
+     * processed.<br/>
+     * The signature of the function is the same required by `each`.
+     *
+     * @warning
+     * The function object can be invoked concurrently from different threads.
+     * Modifying the storage iterated by the view during iterations results in
+     * undefined behavior.
+     *
+     * @tparam Exec Type of the executor to use to run the jobs.
+     * @tparam Func Type of the function object to invoke.
+     * @param exec A valid executor.
+     * @param grain Maximum number of entities per chunk.
+     * @param func A valid function object.
+     */
+    template<typename Exec, typename Func>
+    void each_chunked(Exec &&exec, const size_type grain, Func func) const {
+        ENTT_ASSERT(grain != 0u, "Invalid grain size");
+
+        if(const auto *view = base_type::handle(); view != nullptr) {
+            const auto len = base_type::size_hint();
+            const auto first = view->end() - static_cast<difference_type>(len);
+
+            std::forward<Exec>(exec)((len + grain - 1u) / grain, [this, &func, first, len, grain](const size_type chunk) {
+                const auto offset = chunk * grain;
+                const auto from = first + static_cast<difference_type>(offset);
+                pick_and_each(func, from, from + static_cast<difference_type>((std::min)(grain, len - offset)), std::index_sequence_for<Get...>{});
+            });
+        }
+    }
+
+    /**
+     * @brief Folds entities and elements into partial accumulators, one per
+     * chunk, then combines the partial results.
+     *
+     * The range of the leading storage is split in chunks and handed to an
+     * executor, as it happens with `each_chunked`. Each chunk has its own
+     * accumulator, initialized with a copy of the given value. The signatures
+     * of the function objects must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(Type &, const entity_type, Type &...);
+     * void(Type &, Type &...);
+     * Type(Type, Type);
+     * @endcode
+     *
+     * Partial results are combined in chunk order. Therefore, the result is
+     * the same from one run to the next for a given grain size.
+     *
+     * @warning
+     * The initial value must be the identity element of the combine function
+     * (that is, zero for a sum or an empty box for a bounding box), since it's
+     * used once per chunk.
+     *
+     * @tparam Exec Type of the executor to use to run the jobs.
+     * @tparam Type Type of accumulator.
+     * @tparam Func Type of the function object to use to fold elements.
+     * @tparam Combine Type of the function object to use to combine results.
+     * @param exec A valid executor.
+     * @param grain Maximum number of entities per chunk.
+     * @param init Initial value of the accumulators.
+     * @param func A valid function object to use to fold elements.
+     * @param combine A valid function object to use to combine results.
+     * @return The combined result.
+     */
+    template<typename Exec, typename Type, typename Func, typename Combine>
+    [[nodiscard]] Type reduce(Exec &&exec, const size_type grain, Type init, Func func, Combine combine) const {
+        ENTT_ASSERT(grain != 0u, "Invalid grain size");
+
+        if(const auto *view = base_type::handle(); view != nullptr) {
+            const auto len = base_type::size_hint();
+            const auto first = view->end() - static_cast<difference_type>(len);
+            std::vector<Type> partial((len + grain - 1u) / grain, init);
+
+            std::forward<Exec>(exec)(partial.size(), [this, &func, &partial, first, len, grain](const size_type chunk) {
+                const auto offset = chunk * grain;
+                const auto from = first + static_cast<difference_type>(offset);
+                auto step = internal::reduce_step<entity_type>(partial[chunk], func);
+                pick_and_each(step, from, from + static_cast<difference_type>((std::min)(grain, len - offset)), std::index_sequence_for<Get...>{});
+            });
+
+            for(auto &&elem: partial) {
+                init = combine(std::move(init), std::move(elem));
+            }
+        }
+
+        return init;
+    }
+
+    /**
+     * @brief Maps entities and elements to values and combines them, one
+     * chunk at a time and possibly concurrently.
+     *
+     * The signatures of the function objects must be equivalent to the
+     * following:
+     *
+     * @code{.cpp}
+     * Type(const entity_type, Type &...);
+     * Type(Type &...);
+     * Type(Type, Type);
+     * @endcode
+     *
+     * The initial value is combined only once with the partial results.
+     *
+     * @sa reduce
+     *
+     * @tparam Exec Type of the executor to use to run the jobs.
+     * @tparam Type Type of result.
+     * @tparam Map Type of the function object to use to map elements.
+     * @tparam Combine Type of the function object to use to combine values.
+     * @param exec A valid executor.
+     * @param grain Maximum number of entities per chunk.
+     * @param init Initial value.
+     * @param map A valid function object to use to map elements.
+     * @param combine A valid function object to use to combine values.
+     * @return The combined result.
+     */
+    template<typename Exec, typename Type, typename Map, typename Combine>
+    [[nodiscard]] Type transform_reduce(Exec &&exec, const size_type grain, Type init, Map map, Combine combine) const {
+        auto result = reduce(std::forward<Exec>(exec), grain, std::optional<Type>{}, internal::transform_step<entity_type, Type>(map, combine), internal::optional_combine<Type>(combine));
+        return result ? combine(std::move(init), std::move(*result)) : init;
     }
 
     /**
@@ -1075,6 +1460,204 @@ public:
         }
     }
 
+    /**
+     * @brief Iterates entities and elements that satisfy a predicate and
+     * applies the given function object to them.
+     *
+     * The signature of the predicate must be equivalent to the following:
+     *
+     * @code{.cpp}
+     * bool(const Type &);
+     * @endcode
+     *
+     * The signature of the function is the same required by `each`.
+     *
+     * @tparam Pred Type of the predicate to use to filter entities.
+     * @tparam Func Type of the function object to invoke.
+     * @param pred A valid predicate.
+     * @param func A valid function object.
+     */
+    template<typename Pred, typename Func>
+    void each_if(Pred pred, Func func) const {
+        static_assert(!std::is_void_v<typename Get::value_type>, "Invalid element type");
+
+        for(const auto entt: *this) {
+            if(pred(std::as_const(*storage()).get(entt))) {
+                if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                    std::apply(func, std::tuple_cat(std::make_tuple(entt), get(entt)));
+                } else {
+                    std::apply(func, get(entt));
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Iterates a slice of the range of the underlying storage and
+     * applies the given function object to the entities and elements in it.
+     *
+     * @sa basic_view<get_t<Get...>, exclude_t<Exclude...>>::each_range
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param offset Position of the first entity of the slice.
+     * @param count Maximum number of entities in the slice.
+     * @param func A valid function object.
+     * @return The position past the last entity of the slice.
+     */
+    template<typename Func>
+    size_type each_range(const size_type offset, const size_type count, Func func) const {
+        if(const auto *view = base_type::handle(); view != nullptr) {
+            const auto len = (Get::storage_policy == deletion_policy::swap_only) ? view->free_list() : view->size();
+            const auto from = (std::min)(offset, len);
+            const auto to = from + (std::min)(count, len - from);
+            const auto first = view->end() - static_cast<difference_type>(len);
+
+            for(auto it = first + static_cast<difference_type>(from), last = first + static_cast<difference_type>(to); it != last; ++it) {
+                if(const auto entt = *it; (Get::storage_policy != deletion_policy::in_place) || (entt != tombstone)) {
+                    if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                        std::apply(func, std::tuple_cat(std::make_tuple(entt), storage()->at_as_tuple(static_cast<size_type>(it.index()))));
+                    } else {
+                        std::apply(func, storage()->at_as_tuple(static_cast<size_type>(it.index())));
+                    }
+                }
+            }
+
+            return to;
+        }
+
+        return size_type{};
+    }
+
+    /**
+     * @brief Splits the range of the underlying storage in contiguous chunks
+     * and hands them to an executor, which in turn applies the given function
+     * object to the entities and elements of each chunk.
+     *
+     * @sa basic_view<get_t<Get...>, exclude_t<Exclude...>>::each_chunked
+     *
+     * @tparam Exec Type of the executor to use to run the jobs.
+     * @tparam Func Type of the function object to invoke.
+     * @param exec A valid executor.
+     * @param grain Maximum number of entities per chunk.
+     * @param func A valid function object.
+     */
+    template<typename Exec, typename Func>
+    void each_chunked(Exec &&exec, const size_type grain, Func func) const {
+        ENTT_ASSERT(grain != 0u, "Invalid grain size");
+
+        if(const auto *view = base_type::handle(); view != nullptr) {
+            const auto len = (Get::storage_policy == deletion_policy::swap_only) ? view->free_list() : view->size();
+            const auto first = view->end() - static_cast<difference_type>(len);
+
+            std::forward<Exec>(exec)((len + grain - 1u) / grain, [this, &func, first, len, grain](const size_type chunk) {
+                const auto offset = chunk * grain;
+
+                for(auto it = first + static_cast<difference_type>(offset), last = it + static_cast<difference_type>((std::min)(grain, len - offset)); it != last; ++it) {
+                    if(const auto entt = *it; (Get::storage_policy != deletion_policy::in_place) || (entt != tombstone)) {
+                        if constexpr(is_applicable_v<Func, decltype(std::tuple_cat(std::tuple<entity_type>{}, std::declval<basic_view>().get({})))>) {
+                            std::apply(func, std::tuple_cat(std::make_tuple(entt), storage()->at_as_tuple(static_cast<size_type>(it.index()))));
+                        } else {
+                            std::apply(func, storage()->at_as_tuple(static_cast<size_type>(it.index())));
+                        }
+                    }
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Folds entities and elements into partial accumulators, one per
+     * chunk, then combines the partial results.
+     *
+     * @sa basic_view<get_t<Get...>, exclude_t<Exclude...>>::reduce
+     *
+     * @tparam Exec Type of the executor to use to run the jobs.
+     * @tparam Type Type of accumulator.
+     * @tparam Func Type of the function object to use to fold elements.
+     * @tparam Combine Type of the function object to use to combine results.
+     * @param exec A valid executor.
+     * @param grain Maximum number of entities per chunk.
+     * @param init Initial value of the accumulators.
+     * @param func A valid function object to use to fold elements.
+     * @param combine A valid function object to use to combine results.
+     * @return The combined result.
+     */
+    template<typename Exec, typename Type, typename Func, typename Combine>
+    [[nodiscard]] Type reduce(Exec &&exec, const size_type grain, Type init, Func func, Combine combine) const {
+        ENTT_ASSERT(grain != 0u, "Invalid grain size");
+
+        if(const auto *view = base_type::handle(); view != nullptr) {
+            const auto len = (Get::storage_policy == deletion_policy::swap_only) ? view->free_list() : view->size();
+            const auto first = view->end() - static_cast<difference_type>(len);
+            std::vector<Type> partial((len + grain - 1u) / grain, init);
+
+            std::forward<Exec>(exec)(partial.size(), [this, &func, &partial, first, len, grain](const size_type chunk) {
+                const auto offset = chunk * grain;
+                auto step = internal::reduce_step<entity_type>(partial[chunk], func);
+
+                for(auto it = first + static_cast<difference_type>(offset), last = it + static_cast<difference_type>((std::min)(grain, len - offset)); it != last; ++it) {
+                    if(const auto entt = *it; (Get::storage_policy != deletion_policy::in_place) || (entt != tombstone)) {
+                        std::apply(step, std::tuple_cat(std::make_tuple(entt), storage()->at_as_tuple(static_cast<size_type>(it.index()))));
+                    }
+                }
+            });
+
+            for(auto &&elem: partial) {
+                init = combine(std::move(init), std::move(elem));
+            }
+        }
+
+        return init;
+    }
+
+    /**
+     * @brief Maps entities and elements to values and combines them, one
+     * chunk at a time and possibly concurrently.
+     *
+     * @sa basic_view<get_t<Get...>, exclude_t<Exclude...>>::transform_reduce
+     *
+     * @tparam Exec Type of the executor to use to run the jobs.
+     * @tparam Type Type of result.
+     * @tparam Map Type of the function object to use to map elements.
+     * @tparam Combine Type of the function object to use to combine values.
+     * @param exec A valid executor.
+     * @param grain Maximum number of entities per chunk.
+     * @param init Initial value.
+     * @param map A valid function object to use to map elements.
+     * @param combine A valid function object to use to combine values.
+     * @return The combined result.
+     */
+    template<typename Exec, typename Type, typename Map, typename Combine>
+    [[nodiscard]] Type transform_reduce(Exec &&exec, const size_type grain, Type init, Map map, Combine combine) const {
+        auto result = reduce(std::forward<Exec>(exec), grain, std::optional<Type>{}, internal::transform_step<entity_type, Type>(map, combine), internal::optional_combine<Type>(combine));
+        return result ? combine(std::move(init), std::move(*result)) : init;
+    }
+
+    /**
+     * @brief Iterates the contiguous chunks of the underlying storage.
+     *
+     * The function object is invoked once per chunk, in memory order. Its
+     * signature is equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const entity_type *, size_type, Type *);
+     * @endcode
+     *
+     * Where `Type` is the element type, to which the _constness_ of the view is
+     * applied.
+     *
+     * @sa basic_storage::each_chunk
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each_chunk(Func func) const {
+        if(auto *elem = storage(); elem != nullptr) {
+            elem->each_chunk(std::move(func));
+        }
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a view.
      *
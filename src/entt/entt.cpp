@@ -0,0 +1,10 @@
+#include "entity/entity.hpp"
+#include "entity/sparse_set.hpp"
+#include "entity/storage.hpp"
+
+namespace entt {
+
+template class basic_sparse_set<entity>;
+template class basic_storage<entity>;
+
+} // namespace entt
@@ -5,8 +5,12 @@ namespace entt {}
 #include "config/config.h"
 #include "config/macro.h"
 #include "config/version.h"
+#include "container/concurrent_dense_map.hpp"
+#include "container/dense_hash_map.hpp"
 #include "container/dense_map.hpp"
 #include "container/dense_set.hpp"
+#include "container/paged_vector.hpp"
+#include "container/small_dense_map.hpp"
 #include "container/table.hpp"
 #include "core/algorithm.hpp"
 #include "core/any.hpp"
@@ -16,34 +20,55 @@ namespace entt {}
 #include "core/enum.hpp"
 #include "core/family.hpp"
 #include "core/hashed_string.hpp"
+#include "core/hashed_string_pool.hpp"
+#include "core/huge_page_pool.hpp"
 #include "core/ident.hpp"
 #include "core/iterator.hpp"
 #include "core/memory.hpp"
 #include "core/monostate.hpp"
+#include "core/monotonic_pool.hpp"
+#include "core/page_pool.hpp"
 #include "core/ranges.hpp"
+#include "core/slab_pool.hpp"
 #include "core/tuple.hpp"
 #include "core/type_info.hpp"
 #include "core/type_traits.hpp"
 #include "core/utility.hpp"
+#include "entity/archetype.hpp"
+#include "entity/cached_query.hpp"
+#include "entity/columnar.hpp"
+#include "entity/command_buffer.hpp"
 #include "entity/component.hpp"
+#include "entity/component_ref.hpp"
+#include "entity/dynamic_storage.hpp"
 #include "entity/entity.hpp"
+#include "entity/entity_bitset.hpp"
 #include "entity/group.hpp"
 #include "entity/handle.hpp"
 #include "entity/helper.hpp"
 #include "entity/mixin.hpp"
 #include "entity/organizer.hpp"
+#include "entity/partition.hpp"
+#include "entity/poly_view.hpp"
 #include "entity/ranges.hpp"
 #include "entity/registry.hpp"
+#include "entity/rollback.hpp"
 #include "entity/runtime_view.hpp"
+#include "entity/shared_storage.hpp"
 #include "entity/snapshot.hpp"
+#include "entity/soa_storage.hpp"
 #include "entity/sparse_set.hpp"
 #include "entity/storage.hpp"
 #include "entity/view.hpp"
+#include "graph/adjacency_list.hpp"
 #include "graph/adjacency_matrix.hpp"
 #include "graph/dot.hpp"
 #include "graph/flow.hpp"
+#include "locator/concurrent_locator.hpp"
 #include "locator/locator.hpp"
+#include "locator/thread_local_locator.hpp"
 #include "meta/adl_pointer.hpp"
+#include "meta/column.hpp"
 #include "meta/container.hpp"
 #include "meta/context.hpp"
 #include "meta/factory.hpp"
@@ -53,17 +78,21 @@ namespace entt {}
 #include "meta/policy.hpp"
 #include "meta/range.hpp"
 #include "meta/resolve.hpp"
+#include "meta/serializer.hpp"
 #include "meta/template.hpp"
 #include "meta/type_traits.hpp"
 #include "meta/utility.hpp"
 #include "poly/poly.hpp"
+#include "process/coroutine.hpp"
 #include "process/process.hpp"
 #include "process/scheduler.hpp"
 #include "resource/cache.hpp"
 #include "resource/loader.hpp"
 #include "resource/resource.hpp"
+#include "signal/concurrent_sigh.hpp"
 #include "signal/delegate.hpp"
 #include "signal/dispatcher.hpp"
 #include "signal/emitter.hpp"
+#include "signal/event_recorder.hpp"
 #include "signal/sigh.hpp"
 // IWYU pragma: end_exports
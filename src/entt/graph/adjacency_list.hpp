@@ -0,0 +1,372 @@
+#ifndef ENTT_GRAPH_ADJACENCY_LIST_HPP
+#define ENTT_GRAPH_ADJACENCY_LIST_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/iterator.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+template<typename It, bool Inverse>
+class csr_edge_iterator {
+    using size_type = std::size_t;
+
+    void find_next() noexcept {
+        for(; pos != last && pos == offset[static_cast<typename It::difference_type>(vert + 1u)]; ++vert) {}
+    }
+
+public:
+    using value_type = std::pair<size_type, size_type>;
+    using pointer = input_iterator_pointer<value_type>;
+    using reference = value_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+
+    constexpr csr_edge_iterator() noexcept = default;
+
+    // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+    constexpr csr_edge_iterator(It from, It base, const size_type vertex, const size_type first, const size_type to) noexcept
+        : offset{std::move(from)},
+          index{std::move(base)},
+          vert{vertex},
+          pos{first},
+          last{to} {
+        find_next();
+    }
+
+    constexpr csr_edge_iterator &operator++() noexcept {
+        ++pos;
+        find_next();
+        return *this;
+    }
+
+    constexpr csr_edge_iterator operator++(int) noexcept {
+        const csr_edge_iterator orig = *this;
+        return ++(*this), orig;
+    }
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+        return *operator->();
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept {
+        const size_type other = index[static_cast<typename It::difference_type>(pos)];
+
+        if constexpr(Inverse) {
+            return std::make_pair(other, vert);
+        } else {
+            return std::make_pair(vert, other);
+        }
+    }
+
+    template<typename Type, bool Flag>
+    friend constexpr bool operator==(const csr_edge_iterator<Type, Flag> &, const csr_edge_iterator<Type, Flag> &) noexcept;
+
+private:
+    It offset{};
+    It index{};
+    size_type vert{};
+    size_type pos{};
+    size_type last{};
+};
+
+template<typename It, bool Inverse>
+[[nodiscard]] constexpr bool operator==(const csr_edge_iterator<It, Inverse> &lhs, const csr_edge_iterator<It, Inverse> &rhs) noexcept {
+    return lhs.pos == rhs.pos;
+}
+
+template<typename It, bool Inverse>
+[[nodiscard]] constexpr bool operator!=(const csr_edge_iterator<It, Inverse> &lhs, const csr_edge_iterator<It, Inverse> &rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Basic implementation of a compressed sparse row adjacency list.
+ *
+ * Unlike an adjacency matrix, an adjacency list only requires memory for the
+ * edges it contains and visits the out-edges or in-edges of a vertex in time
+ * proportional to their number. This makes it more suitable for large, sparse
+ * graphs.<br/>
+ * Edges are provided once and for all on construction. The container offers
+ * the same read-only interface of an adjacency matrix.
+ *
+ * @tparam Category Either a directed or undirected category tag.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Category, typename Allocator>
+class adjacency_list {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    static_assert(std::is_base_of_v<directed_tag, Category>, "Invalid graph category");
+    static_assert(std::is_same_v<typename alloc_traits::value_type, std::size_t>, "Invalid value type");
+    using container_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
+    using edge_container_type = std::vector<std::pair<std::size_t, std::size_t>, typename alloc_traits::template rebind_alloc<std::pair<std::size_t, std::size_t>>>;
+
+    void build(edge_container_type edge) {
+        if constexpr(std::is_same_v<Category, undirected_tag>) {
+            const auto len = edge.size();
+            edge.reserve(len * 2u);
+
+            for(std::size_t pos{}; pos < len; ++pos) {
+                edge.emplace_back(edge[pos].second, edge[pos].first);
+            }
+        }
+
+        std::sort(edge.begin(), edge.end());
+        edge.erase(std::unique(edge.begin(), edge.end()), edge.end());
+
+        out_index.resize(edge.size());
+        in_index.resize(edge.size());
+
+        for(auto &&elem: edge) {
+            ENTT_ASSERT(elem.first < vert && elem.second < vert, "Invalid vertex");
+            ++out_offset[elem.first + 1u];
+            ++in_offset[elem.second + 1u];
+        }
+
+        for(std::size_t pos{}; pos < vert; ++pos) {
+            out_offset[pos + 1u] += out_offset[pos];
+            in_offset[pos + 1u] += in_offset[pos];
+        }
+
+        container_type next{in_offset.cbegin(), in_offset.cend() - 1u, get_allocator()};
+
+        for(std::size_t pos{}, last = edge.size(); pos < last; ++pos) {
+            out_index[pos] = edge[pos].second;
+            in_index[next[edge[pos].second]++] = edge[pos].first;
+        }
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Vertex type. */
+    using vertex_type = size_type;
+    /*! @brief Edge type. */
+    using edge_type = std::pair<vertex_type, vertex_type>;
+    /*! @brief Vertex iterator type. */
+    using vertex_iterator = iota_iterator<vertex_type>;
+    /*! @brief Edge iterator type. */
+    using edge_iterator = internal::csr_edge_iterator<typename container_type::const_iterator, false>;
+    /*! @brief Out-edge iterator type. */
+    using out_edge_iterator = edge_iterator;
+    /*! @brief In-edge iterator type. */
+    using in_edge_iterator = internal::csr_edge_iterator<typename container_type::const_iterator, true>;
+    /*! @brief Graph category tag. */
+    using graph_category = Category;
+
+    /*! @brief Default constructor. */
+    adjacency_list()
+        : adjacency_list{0u} {
+    }
+
+    /**
+     * @brief Constructs an empty container with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit adjacency_list(const allocator_type &allocator)
+        : adjacency_list{0u, allocator} {}
+
+    /**
+     * @brief Constructs an empty container with a given allocator and user
+     * supplied number of vertices.
+     * @param vertices Number of vertices.
+     * @param allocator The allocator to use.
+     */
+    adjacency_list(const size_type vertices, const allocator_type &allocator = allocator_type{})
+        : out_offset(vertices + 1u, size_type{}, allocator),
+          out_index{allocator},
+          in_offset(vertices + 1u, size_type{}, allocator),
+          in_index{allocator},
+          vert{vertices} {}
+
+    /**
+     * @brief Constructs a container from a range of edges.
+     *
+     * Duplicate edges are discarded. Undirected graphs also get the reverse
+     * of all the edges in the range.
+     *
+     * @tparam It Type of input iterator.
+     * @param vertices Number of vertices.
+     * @param first An iterator to the first edge of the range.
+     * @param last An iterator past the last edge of the range.
+     * @param allocator The allocator to use.
+     */
+    template<typename It>
+    adjacency_list(const size_type vertices, It first, It last, const allocator_type &allocator = allocator_type{})
+        : adjacency_list{vertices, allocator} {
+        build(edge_container_type{first, last, allocator});
+    }
+
+    /*! @brief Default copy constructor. */
+    adjacency_list(const adjacency_list &) = default;
+
+    /**
+     * @brief Allocator-extended copy constructor.
+     * @param other The instance to copy from.
+     * @param allocator The allocator to use.
+     */
+    adjacency_list(const adjacency_list &other, const allocator_type &allocator)
+        : out_offset{other.out_offset, allocator},
+          out_index{other.out_index, allocator},
+          in_offset{other.in_offset, allocator},
+          in_index{other.in_index, allocator},
+          vert{other.vert} {}
+
+    /*! @brief Default move constructor. */
+    adjacency_list(adjacency_list &&) noexcept = default;
+
+    /**
+     * @brief Allocator-extended move constructor.
+     * @param other The instance to move from.
+     * @param allocator The allocator to use.
+     */
+    adjacency_list(adjacency_list &&other, const allocator_type &allocator)
+        : out_offset{std::move(other.out_offset), allocator},
+          out_index{std::move(other.out_index), allocator},
+          in_offset{std::move(other.in_offset), allocator},
+          in_index{std::move(other.in_index), allocator},
+          vert{other.vert} {}
+
+    /*! @brief Default destructor. */
+    ~adjacency_list() = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     * @return This container.
+     */
+    adjacency_list &operator=(const adjacency_list &) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This container.
+     */
+    adjacency_list &operator=(adjacency_list &&) noexcept = default;
+
+    /**
+     * @brief Exchanges the contents with those of a given adjacency list.
+     * @param other Adjacency list to exchange the content with.
+     */
+    void swap(adjacency_list &other) noexcept {
+        using std::swap;
+        swap(out_offset, other.out_offset);
+        swap(out_index, other.out_index);
+        swap(in_offset, other.in_offset);
+        swap(in_index, other.in_index);
+        swap(vert, other.vert);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return out_offset.get_allocator();
+    }
+
+    /*! @brief Clears the adjacency list. */
+    void clear() noexcept {
+        out_offset.clear();
+        out_index.clear();
+        in_offset.clear();
+        in_index.clear();
+        vert = {};
+    }
+
+    /**
+     * @brief Returns true if an adjacency list is empty, false otherwise.
+     * @return True if the adjacency list is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return out_index.empty();
+    }
+
+    /**
+     * @brief Returns the number of vertices.
+     * @return The number of vertices.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return vert;
+    }
+
+    /**
+     * @brief Returns an iterable object to visit all vertices of a list.
+     * @return An iterable object to visit all vertices of a list.
+     */
+    [[nodiscard]] iterable_adaptor<vertex_iterator> vertices() const noexcept {
+        return {0u, vert};
+    }
+
+    /**
+     * @brief Returns an iterable object to visit all edges of a list.
+     * @return An iterable object to visit all edges of a list.
+     */
+    [[nodiscard]] iterable_adaptor<edge_iterator> edges() const noexcept {
+        const auto sz = out_index.size();
+        return {{out_offset.cbegin(), out_index.cbegin(), 0u, 0u, sz}, {out_offset.cbegin(), out_index.cbegin(), vert, sz, sz}};
+    }
+
+    /**
+     * @brief Returns an iterable object to visit all out-edges of a vertex.
+     * @param vertex The vertex of which to return all out-edges.
+     * @return An iterable object to visit all out-edges of a vertex.
+     */
+    [[nodiscard]] iterable_adaptor<out_edge_iterator> out_edges(const vertex_type vertex) const noexcept {
+        const auto from = out_offset[vertex];
+        const auto to = out_offset[vertex + 1u];
+        return {{out_offset.cbegin(), out_index.cbegin(), vertex, from, to}, {out_offset.cbegin(), out_index.cbegin(), vertex, to, to}};
+    }
+
+    /**
+     * @brief Returns an iterable object to visit all in-edges of a vertex.
+     * @param vertex The vertex of which to return all in-edges.
+     * @return An iterable object to visit all in-edges of a vertex.
+     */
+    [[nodiscard]] iterable_adaptor<in_edge_iterator> in_edges(const vertex_type vertex) const noexcept {
+        const auto from = in_offset[vertex];
+        const auto to = in_offset[vertex + 1u];
+        return {{in_offset.cbegin(), in_index.cbegin(), vertex, from, to}, {in_offset.cbegin(), in_index.cbegin(), vertex, to, to}};
+    }
+
+    /**
+     * @brief Checks if an adjacency list contains a given edge.
+     * @param lhs The left hand vertex of the edge.
+     * @param rhs The right hand vertex of the edge.
+     * @return True if there is such an edge, false otherwise.
+     */
+    [[nodiscard]] bool contains(const vertex_type lhs, const vertex_type rhs) const {
+        if(lhs < vert) {
+            const auto first = out_index.cbegin() + static_cast<typename container_type::difference_type>(out_offset[lhs]);
+            const auto last = out_index.cbegin() + static_cast<typename container_type::difference_type>(out_offset[lhs + 1u]);
+            return std::binary_search(first, last, rhs);
+        }
+
+        return false;
+    }
+
+private:
+    container_type out_offset;
+    container_type out_index;
+    container_type in_offset;
+    container_type in_index;
+    size_type vert;
+};
+
+} // namespace entt
+
+#endif
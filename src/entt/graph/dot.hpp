@@ -1,8 +1,11 @@
 #ifndef ENTT_GRAPH_DOT_HPP
 #define ENTT_GRAPH_DOT_HPP
 
+#include <cstddef>
 #include <ostream>
+#include <sstream>
 #include <type_traits>
+#include <vector>
 #include "fwd.hpp"
 
 namespace entt {
@@ -42,6 +45,113 @@ void dot(std::ostream &out, const Graph &graph, Writer writer) {
     out << "}";
 }
 
+/**
+ * @brief Outputs a directed graph in dot format, annotated with the cost of
+ * its vertices.
+ *
+ * Each vertex is labeled with its cost, usually the time it took to execute it
+ * as measured by a profiler. The critical path, that is the most expensive
+ * chain of dependent vertices, is highlighted along with the edges connecting
+ * them. The graph is also labeled with the cost of the critical path and the
+ * total cost of all vertices, their ratio being the maximum parallelism
+ * achievable for the given graph.
+ *
+ * @tparam Graph Graph type, valid as long as it exposes edges and vertices.
+ * @tparam Cost Vertex cost type.
+ * @tparam Writer Vertex decorator type.
+ * @param out A standard output stream.
+ * @param graph The graph to output.
+ * @param cost Vertex cost object, returning a non-negative arithmetic value.
+ * @param writer Vertex decorator object.
+ */
+template<typename Graph, typename Cost, typename Writer>
+void dot(std::ostream &out, const Graph &graph, Cost cost, Writer writer) {
+    static_assert(std::is_same_v<typename Graph::graph_category, directed_tag>, "Invalid graph category");
+    using cost_type = std::decay_t<decltype(cost(std::size_t{}))>;
+    static_assert(std::is_arithmetic_v<cost_type>, "Invalid cost type");
+
+    const auto length = graph.size();
+    std::vector<cost_type> rank(length);
+    std::vector<std::size_t> count(length);
+    std::vector<std::size_t> next(length, length);
+    std::vector<std::size_t> queue{};
+    cost_type work{};
+
+    for(auto [lhs, rhs]: graph.edges()) {
+        ++count[lhs];
+    }
+
+    for(std::size_t pos{}; pos < length; ++pos) {
+        rank[pos] = cost(pos);
+        work += rank[pos];
+
+        if(count[pos] == 0u) {
+            queue.push_back(pos);
+        }
+    }
+
+    // longest path towards a sink, from the sinks backwards
+    for(std::size_t pos{}; pos < queue.size(); ++pos) {
+        const auto curr = queue[pos];
+
+        for(auto &&elem: graph.in_edges(curr)) {
+            if(const auto other = elem.first; next[other] == length || rank[next[other]] < rank[curr]) {
+                next[other] = curr;
+            }
+
+            if(--count[elem.first] == 0u) {
+                rank[elem.first] += rank[next[elem.first]];
+                queue.push_back(elem.first);
+            }
+        }
+    }
+
+    std::vector<bool> critical(length);
+    auto curr = length;
+
+    for(std::size_t pos{}; pos < length; ++pos) {
+        if(graph.in_edges(pos).begin() == graph.in_edges(pos).end() && (curr == length || rank[curr] < rank[pos])) {
+            curr = pos;
+        }
+    }
+
+    const auto span = (curr == length) ? cost_type{} : rank[curr];
+
+    for(; curr != length && !critical[curr]; curr = next[curr]) {
+        critical[curr] = true;
+    }
+
+    out << "digraph{label=\"critical path " << span << " of " << work << "\";";
+
+    for(auto &&vertex: graph.vertices()) {
+        std::ostringstream buffer{};
+        writer(buffer, vertex);
+        out << vertex << "[xlabel=\"" << cost(vertex) << "\"";
+
+        if(critical[vertex]) {
+            out << ",color=\"red\",penwidth=2";
+        }
+
+        if(const auto str = buffer.str(); !str.empty()) {
+            out << "," << str;
+        }
+
+        out << "];";
+    }
+
+    for(auto [lhs, rhs]: graph.edges()) {
+        out << lhs << "->" << rhs;
+
+        if(critical[lhs] && next[lhs] == rhs) {
+            out << "[color=\"red\",penwidth=2]";
+        }
+
+        out << ";";
+    }
+
+    out << "}";
+}
+
 /**
  * @brief Outputs a graph in dot format.
  * @tparam Graph Graph type, valid as long as it exposes edges and vertices.
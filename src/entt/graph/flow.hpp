@@ -3,8 +3,10 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -12,10 +14,12 @@
 #include "../config/config.h"
 #include "../container/dense_map.hpp"
 #include "../container/dense_set.hpp"
+#include "../core/bit.hpp"
 #include "../core/compressed_pair.hpp"
 #include "../core/fwd.hpp"
 #include "../core/iterator.hpp"
 #include "../core/utility.hpp"
+#include "adjacency_list.hpp"
 #include "adjacency_matrix.hpp"
 #include "fwd.hpp"
 
@@ -33,6 +37,11 @@ class basic_flow {
     using ro_rw_container_type = std::vector<std::pair<std::size_t, bool>, typename alloc_traits::template rebind_alloc<std::pair<std::size_t, bool>>>;
     using deps_container_type = dense_map<id_type, ro_rw_container_type, identity, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, ro_rw_container_type>>>;
     using adjacency_matrix_type = adjacency_matrix<directed_tag, typename alloc_traits::template rebind_alloc<std::size_t>>;
+    using adjacency_list_type = adjacency_list<directed_tag, typename alloc_traits::template rebind_alloc<std::size_t>>;
+    using cost_container_type = std::vector<float, typename alloc_traits::template rebind_alloc<float>>;
+    using bitset_type = std::vector<std::uint64_t, typename alloc_traits::template rebind_alloc<std::uint64_t>>;
+
+    static constexpr std::size_t word_bits = std::numeric_limits<std::uint64_t>::digits;
 
     void emplace(const id_type res, const bool is_rw) {
         ENTT_ASSERT(index.first() < vertices.size(), "Invalid node");
@@ -44,7 +53,11 @@ class basic_flow {
         deps[res].emplace_back(index.first(), is_rw);
     }
 
-    void setup_graph(adjacency_matrix_type &matrix) const {
+    void setup_graph(bitset_type &rows, const std::size_t stride) const {
+        const auto insert = [&rows, stride](const std::size_t lhs, const std::size_t rhs) {
+            rows[lhs * stride + rhs / word_bits] |= std::uint64_t{1u} << (rhs % word_bits);
+        };
+
         for(const auto &elem: deps) {
             const auto last = elem.second.cend();
             auto it = elem.second.cbegin();
@@ -54,15 +67,15 @@ class basic_flow {
                     // rw item
                     if(auto curr = it++; it != last) {
                         if(it->second) {
-                            matrix.insert(curr->first, it->first);
+                            insert(curr->first, it->first);
                         } else if(const auto next = std::find_if(it, last, [](const auto &value) { return value.second; }); next != last) {
                             for(; it != next; ++it) {
-                                matrix.insert(curr->first, it->first);
-                                matrix.insert(it->first, next->first);
+                                insert(curr->first, it->first);
+                                insert(it->first, next->first);
                             }
                         } else {
                             for(; it != next; ++it) {
-                                matrix.insert(curr->first, it->first);
+                                insert(curr->first, it->first);
                             }
                         }
                     }
@@ -70,7 +83,7 @@ class basic_flow {
                     // ro item (first iteration only)
                     if(const auto next = std::find_if(it, last, [](const auto &value) { return value.second; }); next != last) {
                         for(; it != next; ++it) {
-                            matrix.insert(it->first, next->first);
+                            insert(it->first, next->first);
                         }
                     } else {
                         it = last;
@@ -80,40 +93,59 @@ class basic_flow {
         }
     }
 
-    void transitive_closure(adjacency_matrix_type &matrix) const {
-        const auto length = matrix.size();
-
+    void transitive_closure(bitset_type &rows, const std::size_t length, const std::size_t stride) const {
         for(std::size_t vk{}; vk < length; ++vk) {
+            const auto word = vk / word_bits;
+            const auto mask = std::uint64_t{1u} << (vk % word_bits);
+
             for(std::size_t vi{}; vi < length; ++vi) {
-                for(std::size_t vj{}; vj < length; ++vj) {
-                    if(matrix.contains(vi, vk) && matrix.contains(vk, vj)) {
-                        matrix.insert(vi, vj);
+                if((rows[vi * stride + word] & mask) != 0u) {
+                    for(std::size_t pos{}; pos < stride; ++pos) {
+                        rows[vi * stride + pos] |= rows[vk * stride + pos];
                     }
                 }
             }
         }
     }
 
-    void transitive_reduction(adjacency_matrix_type &matrix) const {
-        const auto length = matrix.size();
-
+    void transitive_reduction(bitset_type &rows, const std::size_t length, const std::size_t stride) const {
         for(std::size_t vert{}; vert < length; ++vert) {
-            matrix.erase(vert, vert);
+            rows[vert * stride + vert / word_bits] &= ~(std::uint64_t{1u} << (vert % word_bits));
         }
 
         for(std::size_t vj{}; vj < length; ++vj) {
+            const auto word = vj / word_bits;
+            const auto mask = std::uint64_t{1u} << (vj % word_bits);
+
             for(std::size_t vi{}; vi < length; ++vi) {
-                if(matrix.contains(vi, vj)) {
-                    for(std::size_t vk{}; vk < length; ++vk) {
-                        if(matrix.contains(vj, vk)) {
-                            matrix.erase(vi, vk);
-                        }
+                if((rows[vi * stride + word] & mask) != 0u) {
+                    for(std::size_t pos{}; pos < stride; ++pos) {
+                        rows[vi * stride + pos] &= ~rows[vj * stride + pos];
                     }
                 }
             }
         }
     }
 
+    template<typename Func>
+    void reduced_graph(Func func) const {
+        const auto length = vertices.size();
+        const auto stride = (length + word_bits - 1u) / word_bits;
+        bitset_type rows(length * stride, std::uint64_t{}, get_allocator());
+
+        setup_graph(rows, stride);
+        transitive_closure(rows, length, stride);
+        transitive_reduction(rows, length, stride);
+
+        for(std::size_t vi{}; vi < length; ++vi) {
+            for(std::size_t pos{}; pos < stride; ++pos) {
+                for(auto word = rows[vi * stride + pos]; word != 0u; word &= word - 1u) {
+                    func(vi, pos * word_bits + static_cast<std::size_t>(countr_zero(word)));
+                }
+            }
+        }
+    }
+
 public:
     /*! @brief Allocator type. */
     using allocator_type = Allocator;
@@ -123,6 +155,12 @@ public:
     using iterable = iterable_adaptor<typename task_container_type::const_iterator>;
     /*! @brief Adjacency matrix type. */
     using graph_type = adjacency_matrix_type;
+    /*! @brief Adjacency list type. */
+    using sparse_graph_type = adjacency_list_type;
+    /*! @brief Container type for the priorities of the tasks. */
+    using priority_type = cost_container_type;
+    /*! @brief Container type for the critical path of a task graph. */
+    using path_type = std::vector<size_type, typename alloc_traits::template rebind_alloc<size_type>>;
 
     /*! @brief Default constructor. */
     basic_flow()
@@ -135,7 +173,8 @@ public:
     explicit basic_flow(const allocator_type &allocator)
         : index{0u, allocator},
           vertices{allocator},
-          deps{allocator} {}
+          deps{allocator},
+          costs{allocator} {}
 
     /*! @brief Default copy constructor. */
     basic_flow(const basic_flow &) = default;
@@ -149,6 +188,7 @@ public:
         : index{other.index.first(), allocator},
           vertices{other.vertices, allocator},
           deps{other.deps, allocator},
+          costs{other.costs, allocator},
           sync_on{other.sync_on} {}
 
     /*! @brief Default move constructor. */
@@ -163,6 +203,7 @@ public:
         : index{other.index.first(), allocator},
           vertices{std::move(other.vertices), allocator},
           deps{std::move(other.deps), allocator},
+          costs{std::move(other.costs), allocator},
           sync_on{other.sync_on} {}
 
     /*! @brief Default destructor. */
@@ -189,6 +230,7 @@ public:
         std::swap(index, other.index);
         std::swap(vertices, other.vertices);
         std::swap(deps, other.deps);
+        std::swap(costs, other.costs);
         std::swap(sync_on, other.sync_on);
     }
 
@@ -214,6 +256,7 @@ public:
         index.first() = {};
         vertices.clear();
         deps.clear();
+        costs.clear();
         sync_on = {};
     }
 
@@ -260,6 +303,60 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Assigns an estimated cost to the current task.
+     *
+     * Costs are arbitrary positive values (for example, the expected duration
+     * of a task in microseconds). Tasks are given a unit cost by default.
+     *
+     * @param value The estimated cost of the current task.
+     * @return This flow builder.
+     */
+    basic_flow &cost(const float value) {
+        ENTT_ASSERT(index.first() < vertices.size(), "Invalid node");
+
+        if(const auto pos = index.first(); pos < costs.size()) {
+            costs[pos] = value;
+        } else {
+            costs.resize(pos + 1u, 1.f);
+            costs.back() = value;
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Blends a measured cost into the estimate of a given task.
+     *
+     * The estimate is updated as an exponentially weighted moving average, so
+     * that sporadic spikes do not disrupt the priorities of the tasks.
+     *
+     * @param pos Position of the task to update.
+     * @param value The measured cost of the task.
+     * @param factor Weight of the measured cost, in the range `[0, 1]`.
+     * @return This flow builder.
+     */
+    basic_flow &measure(const size_type pos, const float value, const float factor = .25f) {
+        ENTT_ASSERT(pos < vertices.size(), "Invalid node");
+
+        if(pos >= costs.size()) {
+            costs.resize(pos + 1u, 1.f);
+        }
+
+        costs[pos] += (value - costs[pos]) * factor;
+        return *this;
+    }
+
+    /**
+     * @brief Returns the estimated cost of a given task.
+     * @param pos Position of the task to query.
+     * @return The estimated cost of the task.
+     */
+    [[nodiscard]] float cost_of(const size_type pos) const {
+        ENTT_ASSERT(pos < vertices.size(), "Invalid node");
+        return (pos < costs.size()) ? costs[pos] : 1.f;
+    }
+
     /**
      * @brief Assigns a resource to the current task with a given access mode.
      * @param res Resource identifier.
@@ -331,18 +428,122 @@ public:
      */
     [[nodiscard]] graph_type graph() const {
         graph_type matrix{vertices.size(), get_allocator()};
+        reduced_graph([&matrix](const size_type lhs, const size_type rhs) { matrix.insert(lhs, rhs); });
+        return matrix;
+    }
 
-        setup_graph(matrix);
-        transitive_closure(matrix);
-        transitive_reduction(matrix);
+    /**
+     * @brief Generates a sparse task graph for the current content.
+     *
+     * The graph is the same returned by the `graph` function. However, it only
+     * requires memory for its edges. This is the preferred choice for large
+     * task graphs.
+     *
+     * @return The adjacency list of the task graph.
+     */
+    [[nodiscard]] sparse_graph_type sparse_graph() const {
+        std::vector<std::pair<size_type, size_type>, typename alloc_traits::template rebind_alloc<std::pair<size_type, size_type>>> edge(get_allocator());
+        reduced_graph([&edge](const size_type lhs, const size_type rhs) { edge.emplace_back(lhs, rhs); });
+        return sparse_graph_type{vertices.size(), edge.cbegin(), edge.cend(), get_allocator()};
+    }
 
-        return matrix;
+    /**
+     * @brief Computes the priorities of the tasks of a given task graph.
+     *
+     * The priority of a task is its _upward rank_, that is its cost plus the
+     * largest priority among its successors. In other terms, it is the length
+     * of the longest chain of tasks that cannot start until it is completed.
+     * Running ready tasks in order of priority puts long chains first and
+     * shortens the makespan of a graph.<br/>
+     * Tasks that belong to a cycle only get their own cost as a priority.
+     *
+     * @tparam Graph Type of task graph, either dense or sparse.
+     * @param matrix A task graph generated by this flow builder.
+     * @return The priorities of the tasks, one for each vertex of the graph.
+     */
+    template<typename Graph>
+    [[nodiscard]] priority_type priority(const Graph &matrix) const {
+        const auto length = matrix.size();
+        path_type count(length, size_type{}, get_allocator());
+        path_type ready(get_allocator());
+        priority_type rank(length, 0.f, get_allocator());
+
+        for(auto &&elem: matrix.edges()) {
+            ++count[elem.first];
+        }
+
+        for(size_type pos{}; pos < length; ++pos) {
+            if(count[pos] == 0u) {
+                ready.push_back(pos);
+            }
+        }
+
+        while(!ready.empty()) {
+            const auto curr = ready.back();
+            ready.pop_back();
+            rank[curr] += cost_of(curr);
+
+            for(auto &&elem: matrix.in_edges(curr)) {
+                rank[elem.first] = (std::max)(rank[elem.first], rank[curr]);
+
+                if(--count[elem.first] == 0u) {
+                    ready.push_back(elem.first);
+                }
+            }
+        }
+
+        for(size_type pos{}; pos < length; ++pos) {
+            if(count[pos] != 0u) {
+                rank[pos] = cost_of(pos);
+            }
+        }
+
+        return rank;
+    }
+
+    /**
+     * @brief Computes the critical path of a given task graph.
+     *
+     * The critical path is the most expensive chain of dependent tasks. It is
+     * a lower bound for the time required to run the whole graph, no matter
+     * how many threads are available.
+     *
+     * @tparam Graph Type of task graph, either dense or sparse.
+     * @param matrix A task graph generated by this flow builder.
+     * @return The tasks of the critical path, in order of execution.
+     */
+    template<typename Graph>
+    [[nodiscard]] path_type critical_path(const Graph &matrix) const {
+        const auto rank = priority(matrix);
+        path_type path(get_allocator());
+        auto curr = matrix.size();
+
+        for(size_type pos{}; pos < matrix.size(); ++pos) {
+            if(matrix.in_edges(pos).begin() == matrix.in_edges(pos).end() && (curr == matrix.size() || rank[curr] < rank[pos])) {
+                curr = pos;
+            }
+        }
+
+        while(curr != matrix.size() && path.size() < matrix.size()) {
+            path.push_back(curr);
+            const auto from = curr;
+            curr = matrix.size();
+
+            for(auto &&elem: matrix.out_edges(from)) {
+                if(curr == matrix.size() || rank[curr] < rank[elem.second]) {
+                    curr = elem.second;
+                }
+            }
+        }
+
+        return path;
     }
 
 private:
     compressed_pair<size_type, allocator_type> index;
     task_container_type vertices;
     deps_container_type deps;
+    cost_container_type costs;
     size_type sync_on{};
 };
 
@@ -16,6 +16,9 @@ struct undirected_tag: directed_tag {};
 template<typename, typename = std::allocator<std::size_t>>
 class adjacency_matrix;
 
+template<typename, typename = std::allocator<std::size_t>>
+class adjacency_list;
+
 template<typename = std::allocator<id_type>>
 class basic_flow;
 
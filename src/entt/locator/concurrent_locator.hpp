@@ -0,0 +1,212 @@
+#ifndef ENTT_LOCATOR_CONCURRENT_LOCATOR_HPP
+#define ENTT_LOCATOR_CONCURRENT_LOCATOR_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+
+namespace entt {
+
+/**
+ * @brief Service locator for concurrent use.
+ *
+ * It works like the `locator` class but services can be looked up from any
+ * thread while other threads replace them.<br/>
+ * Lookups don't take locks and cost a single atomic load. Replacing a service
+ * doesn't destroy the previous one either. Instead, it's retired and kept
+ * alive until the `reclaim` function is invoked, so that references obtained
+ * by other threads remain valid in the meantime.
+ *
+ * @warning
+ * Users must only reclaim retired services once no thread can still refer to
+ * them, for example at the end of a frame or of a task graph.
+ *
+ * @tparam Service Service type.
+ */
+template<typename Service>
+class concurrent_locator final {
+    class service_handle {
+        friend class concurrent_locator<Service>;
+        std::shared_ptr<Service> value{};
+    };
+
+    static Service *replace(std::shared_ptr<Service> other) {
+        const std::lock_guard<std::mutex> guard{mutex};
+        auto *elem = other.get();
+
+        if(service) {
+            retired.push_back(std::move(service));
+        }
+
+        service = std::move(other);
+        current.store(elem, std::memory_order_release);
+        return elem;
+    }
+
+public:
+    /*! @brief Service type. */
+    using type = Service;
+    /*! @brief Service node type. */
+    using node_type = service_handle;
+
+    /*! @brief Default constructor, deleted on purpose. */
+    concurrent_locator() = delete;
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    concurrent_locator(const concurrent_locator &) = delete;
+
+    /*! @brief Default destructor, deleted on purpose. */
+    ~concurrent_locator() = delete;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This locator.
+     */
+    concurrent_locator &operator=(const concurrent_locator &) = delete;
+
+    /**
+     * @brief Checks whether a service locator contains a value.
+     * @return True if the service locator contains a value, false otherwise.
+     */
+    [[nodiscard]] static bool has_value() noexcept {
+        return (current.load(std::memory_order_acquire) != nullptr);
+    }
+
+    /**
+     * @brief Returns a reference to a valid service, if any.
+     *
+     * @warning
+     * Invoking this function can result in undefined behavior if the service
+     * hasn't been set yet.
+     *
+     * @return A reference to the service currently set, if any.
+     */
+    [[nodiscard]] static Service &value() noexcept {
+        auto *elem = current.load(std::memory_order_acquire);
+        ENTT_ASSERT(elem != nullptr, "Service not available");
+        return *elem;
+    }
+
+    /**
+     * @brief Returns a service if available or sets it from a fallback type.
+     *
+     * Arguments are used only if a service doesn't already exist. In all other
+     * cases, they are discarded.<br/>
+     * When multiple threads race to set the fallback service, only one of them
+     * succeeds and all of them return the same service.
+     *
+     * @tparam Args Types of arguments to use to construct the fallback service.
+     * @tparam Type Fallback service type.
+     * @param args Parameters to use to construct the fallback service.
+     * @return A reference to a valid service.
+     */
+    template<typename Type = Service, typename... Args>
+    [[nodiscard]] static Service &value_or(Args &&...args) {
+        if(auto *elem = current.load(std::memory_order_acquire); elem) {
+            return *elem;
+        }
+
+        const std::lock_guard<std::mutex> guard{mutex};
+
+        if(!service) {
+            service = std::make_shared<Type>(std::forward<Args>(args)...);
+            current.store(service.get(), std::memory_order_release);
+        }
+
+        return *service;
+    }
+
+    /**
+     * @brief Sets or replaces a service.
+     * @tparam Type Service type.
+     * @tparam Args Types of arguments to use to construct the service.
+     * @param args Parameters to use to construct the service.
+     * @return A reference to a valid service.
+     */
+    template<typename Type = Service, typename... Args>
+    static Service &emplace(Args &&...args) {
+        return *replace(std::make_shared<Type>(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Sets or replaces a service using a given allocator.
+     * @tparam Type Service type.
+     * @tparam Allocator Type of allocator used to manage memory and elements.
+     * @tparam Args Types of arguments to use to construct the service.
+     * @param alloc The allocator to use.
+     * @param args Parameters to use to construct the service.
+     * @return A reference to a valid service.
+     */
+    template<typename Type = Service, typename Allocator, typename... Args>
+    static Service &emplace(std::allocator_arg_t, Allocator alloc, Args &&...args) {
+        return *replace(std::allocate_shared<Type>(alloc, std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Returns a handle to the underlying service.
+     * @return A handle to the underlying service.
+     */
+    static node_type handle() {
+        const std::lock_guard<std::mutex> guard{mutex};
+        node_type node{};
+        node.value = service;
+        return node;
+    }
+
+    /**
+     * @brief Resets or replaces a service.
+     * @param other Optional handle with which to replace the service.
+     */
+    static void reset(const node_type &other = {}) {
+        replace(other.value);
+    }
+
+    /**
+     * @brief Resets or replaces a service.
+     * @tparam Type Service type.
+     * @tparam Deleter Deleter type.
+     * @param elem A pointer to a service to manage.
+     * @param deleter A deleter to use to destroy the service.
+     */
+    template<typename Type, typename Deleter = std::default_delete<Type>>
+    static void reset(Type *elem, Deleter deleter = {}) {
+        replace(std::shared_ptr<Service>{elem, std::move(deleter)});
+    }
+
+    /**
+     * @brief Releases all the services retired so far.
+     *
+     * @warning
+     * References to retired services are invalidated, if the services aren't
+     * also owned elsewhere.
+     *
+     * @return Number of retired services released.
+     */
+    static std::size_t reclaim() {
+        decltype(retired) other{};
+
+        {
+            const std::lock_guard<std::mutex> guard{mutex};
+            other.swap(retired);
+        }
+
+        // services are destroyed out of the lock, they can use the locator
+        return other.size();
+    }
+
+private:
+    // NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+    inline static std::atomic<Service *> current{};
+    inline static std::mutex mutex{};
+    inline static std::shared_ptr<Service> service{};
+    inline static std::vector<std::shared_ptr<Service>> retired{};
+    // NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,214 @@
+#ifndef ENTT_LOCATOR_THREAD_LOCAL_LOCATOR_HPP
+#define ENTT_LOCATOR_THREAD_LOCAL_LOCATOR_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+
+namespace entt {
+
+/**
+ * @brief Service locator with one instance per thread.
+ *
+ * Rather than a service, users register a factory. Each thread that looks up
+ * the service lazily gets its own instance, created the first time it's
+ * requested. Lookups from a thread that already has its instance don't take
+ * locks.<br/>
+ * Factories are invoked out of the lock, so that a slow factory doesn't stall
+ * other threads and factories can use the locator themselves. An instance
+ * created while the factory is being replaced is discarded and the new factory
+ * is invoked in its place.<br/>
+ * Instances outlive the threads that created them and can be enumerated at any
+ * time, for example to aggregate their results at a sync point.
+ *
+ * @warning
+ * Registering a new factory or resetting the locator destroys all instances.
+ * Users must only do it once no thread can still refer to them.
+ *
+ * @tparam Service Service type.
+ */
+template<typename Service>
+class thread_local_locator final {
+    struct local_type {
+        Service *instance{};
+        std::size_t epoch{};
+        bool building{};
+    };
+
+    static void replace(std::function<std::shared_ptr<Service>()> other) {
+        decltype(instances) released{};
+
+        {
+            const std::lock_guard<std::mutex> guard{mutex};
+            released.swap(instances);
+            builder = std::move(other);
+            epoch.fetch_add(1u, std::memory_order_release);
+        }
+
+        // instances are destroyed out of the lock, they can use the locator
+    }
+
+public:
+    /*! @brief Service type. */
+    using type = Service;
+
+    /*! @brief Default constructor, deleted on purpose. */
+    thread_local_locator() = delete;
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    thread_local_locator(const thread_local_locator &) = delete;
+
+    /*! @brief Default destructor, deleted on purpose. */
+    ~thread_local_locator() = delete;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This locator.
+     */
+    thread_local_locator &operator=(const thread_local_locator &) = delete;
+
+    /**
+     * @brief Checks whether a service locator contains a factory.
+     * @return True if the service locator contains a factory, false otherwise.
+     */
+    [[nodiscard]] static bool has_value() {
+        const std::lock_guard<std::mutex> guard{mutex};
+        return static_cast<bool>(builder);
+    }
+
+    /**
+     * @brief Returns the instance of the calling thread, after creating it if
+     * required.
+     *
+     * @warning
+     * Invoking this function can result in undefined behavior if a factory
+     * hasn't been set yet or if it's invoked by the factory itself.
+     *
+     * @return A reference to the instance of the calling thread.
+     */
+    [[nodiscard]] static Service &value() {
+        while(local.instance == nullptr || local.epoch != epoch.load(std::memory_order_acquire)) {
+            ENTT_ASSERT(!local.building, "Recursive factory");
+            std::function<std::shared_ptr<Service>()> func{};
+            std::size_t curr{};
+
+            {
+                const std::lock_guard<std::mutex> guard{mutex};
+                ENTT_ASSERT(builder, "Service not available");
+                func = builder;
+                curr = epoch.load(std::memory_order_relaxed);
+            }
+
+            local.building = true;
+            std::shared_ptr<Service> elem{};
+
+            ENTT_TRY {
+                elem = func();
+            }
+            ENTT_CATCH {
+                local.building = false;
+                ENTT_THROW;
+            }
+
+            local.building = false;
+            // released before the instance, discarded instances can use the locator when destroyed
+            const std::lock_guard<std::mutex> guard{mutex};
+
+            if(curr == epoch.load(std::memory_order_relaxed)) {
+                local.instance = instances.emplace_back(std::move(elem)).get();
+                local.epoch = curr;
+            }
+        }
+
+        return *local.instance;
+    }
+
+    /**
+     * @brief Sets or replaces the factory of a service.
+     *
+     * The factory is invoked at most once per thread, unless it's replaced in
+     * the meantime. It returns an object that is convertible to a shared
+     * pointer to the service.
+     *
+     * @tparam Func Type of factory.
+     * @param func A valid factory.
+     */
+    template<typename Func>
+    static void factory(Func func) {
+        static_assert(std::is_convertible_v<std::invoke_result_t<Func &>, std::shared_ptr<Service>>, "Invalid factory");
+        replace([func = std::move(func)]() mutable -> std::shared_ptr<Service> { return func(); });
+    }
+
+    /**
+     * @brief Sets or replaces the factory of a service with one that creates
+     * instances of a given type.
+     * @tparam Type Service type.
+     * @tparam Args Types of arguments to use to construct the instances.
+     * @param args Parameters to use to construct the instances.
+     */
+    template<typename Type = Service, typename... Args>
+    static void emplace(Args &&...args) {
+        factory([params = std::tuple<std::decay_t<Args>...>{std::forward<Args>(args)...}]() {
+            return std::apply([](const auto &...curr) { return std::make_shared<Type>(curr...); }, params);
+        });
+    }
+
+    /**
+     * @brief Iterates all the instances created so far.
+     *
+     * The function type is equivalent to:
+     *
+     * @code{.cpp}
+     * void(Service &);
+     * @endcode
+     *
+     * @warning
+     * Instances can still be in use by their threads. Synchronization is up to
+     * the user.
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    static void each(Func func) {
+        const std::lock_guard<std::mutex> guard{mutex};
+
+        for(auto &&elem: instances) {
+            func(*elem);
+        }
+    }
+
+    /**
+     * @brief Returns the number of instances created so far.
+     * @return Number of instances created so far.
+     */
+    [[nodiscard]] static std::size_t size() {
+        const std::lock_guard<std::mutex> guard{mutex};
+        return instances.size();
+    }
+
+    /*! @brief Removes the factory and destroys all instances. */
+    static void reset() {
+        replace({});
+    }
+
+private:
+    // NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+    inline static thread_local local_type local{};
+    inline static std::atomic<std::size_t> epoch{};
+    inline static std::mutex mutex{};
+    inline static std::function<std::shared_ptr<Service>()> builder{};
+    inline static std::vector<std::shared_ptr<Service>> instances{};
+    // NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+};
+
+} // namespace entt
+
+#endif
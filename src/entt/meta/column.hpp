@@ -0,0 +1,139 @@
+#ifndef ENTT_META_COLUMN_HPP
+#define ENTT_META_COLUMN_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include "../config/config.h"
+#include "../entity/component.hpp"
+#include "fwd.hpp"
+#include "meta.hpp"
+
+namespace entt {
+
+/**
+ * @brief Strided view over a data member across all the elements of a storage.
+ *
+ * Columns don't box elements. The address of the data member is computed once
+ * for the first element and then offset by the size of the elements. Thus, the
+ * data member must be registered as a pointer to member.<br/>
+ * Elements are returned in the order in which they appear in the storage.
+ * Tombstones aren't skipped for storage classes with in-place deletion.
+ *
+ * @warning
+ * Columns are invalidated by any operation that changes the layout or size of
+ * the underlying storage.
+ */
+class meta_column {
+    template<typename Storage>
+    [[nodiscard]] static const std::byte *page_of(const void *storage, const std::size_t pos) noexcept {
+        return reinterpret_cast<const std::byte *>(static_cast<const Storage *>(storage)->raw()[pos]);
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    meta_column() noexcept = default;
+
+    /**
+     * @brief Constructs a column for a given storage and data member.
+     * @tparam Storage Type of storage.
+     * @param storage A valid storage.
+     * @param data A data member of the element type of the storage.
+     */
+    template<typename Storage>
+    meta_column(const Storage &storage, const meta_data &data)
+        : source{&storage},
+          page{&page_of<Storage>},
+          stride{sizeof(typename Storage::value_type)},
+          length{component_traits<typename Storage::value_type, typename Storage::entity_type>::page_size},
+          count{storage.size()},
+          info{data.type()} {
+        static_assert(component_traits<typename Storage::value_type, typename Storage::entity_type>::page_size != 0u, "Empty types aren't supported");
+
+        if(count != 0u) {
+            const auto *first = page(source, 0u);
+            const auto *addr = static_cast<const std::byte *>(data.address(*storage.raw()[0u]));
+            ENTT_ASSERT(addr != nullptr, "Invalid data member");
+            offset = static_cast<size_type>(addr - first);
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements in the column.
+     * @return Number of elements in the column.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return count;
+    }
+
+    /**
+     * @brief Returns the distance in bytes between two consecutive elements.
+     * @return The distance in bytes between two consecutive elements.
+     */
+    [[nodiscard]] size_type step() const noexcept {
+        return stride;
+    }
+
+    /**
+     * @brief Returns the type of the data member.
+     * @return The type of the data member.
+     */
+    [[nodiscard]] meta_type type() const noexcept {
+        return info;
+    }
+
+    /**
+     * @brief Returns the address of the data member of a given element.
+     * @param pos The position of the element to look up.
+     * @return The address of the data member of the requested element.
+     */
+    [[nodiscard]] const void *operator[](const size_type pos) const noexcept {
+        ENTT_ASSERT(pos < count, "Index out of bounds");
+        return page(source, pos / length) + (pos % length) * stride + offset;
+    }
+
+    /**
+     * @brief Iterates all contiguous segments of the column.
+     *
+     * The function object is invoked once per page with the address of the
+     * data member of the first element of the page and the number of elements
+     * in it. Elements are `step()` bytes apart. The signature of the function
+     * is equivalent to the following:
+     *
+     * @code{.cpp}
+     * void(const void *, const meta_column::size_type);
+     * @endcode
+     *
+     * @tparam Func Type of the function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        for(size_type pos{}, idx{}; pos < count; pos += length, ++idx) {
+            func(static_cast<const void *>(page(source, idx) + offset), (std::min)(length, count - pos));
+        }
+    }
+
+    /**
+     * @brief Returns true if a column is valid, false otherwise.
+     * @return True if the column is valid, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return (source != nullptr);
+    }
+
+private:
+    const void *source{};
+    const std::byte *(*page)(const void *, const size_type) noexcept {};
+    size_type offset{};
+    size_type stride{};
+    size_type length{};
+    size_type count{};
+    meta_type info{};
+};
+
+} // namespace entt
+
+#endif
@@ -54,6 +54,15 @@ struct reserve_aware_container<Type, std::void_t<decltype(&Type::reserve)>>: std
 template<typename Type>
 inline constexpr bool reserve_aware_container_v = reserve_aware_container<Type>::value;
 
+template<typename, typename = void>
+struct contiguous_container: std::false_type {};
+
+template<typename Type>
+struct contiguous_container<Type, std::enable_if_t<std::is_same_v<decltype(std::declval<const Type &>().data()), const typename Type::value_type *>>>: std::true_type {};
+
+template<typename Type>
+inline constexpr bool contiguous_container_v = contiguous_container<Type>::value;
+
 } // namespace internal
 /*! @endcond */
 
@@ -84,6 +93,20 @@ struct basic_meta_sequence_container_traits {
         return static_cast<const Type *>(container)->size();
     }
 
+    /**
+     * @brief Returns a pointer to the elements of a contiguous container.
+     * @param container Opaque pointer to a container of the given type.
+     * @return A pointer to the first element if the container is contiguous, a
+     * null pointer otherwise.
+     */
+    [[nodiscard]] static const void *data([[maybe_unused]] const void *container) noexcept {
+        if constexpr(internal::contiguous_container_v<Type>) {
+            return static_cast<const Type *>(container)->data();
+        } else {
+            return nullptr;
+        }
+    }
+
     /**
      * @brief Clears a container.
      * @param container Opaque pointer to a container of the given type.
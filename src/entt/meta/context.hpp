@@ -1,6 +1,11 @@
 #ifndef ENTT_META_CTX_HPP
 #define ENTT_META_CTX_HPP
 
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
 #include "../container/dense_map.hpp"
 #include "../core/fwd.hpp"
 #include "../core/utility.hpp"
@@ -13,8 +18,47 @@ namespace internal {
 
 struct meta_type_node;
 
+struct meta_context_table {
+    dense_map<id_type, const meta_type_node *, identity> type;
+    dense_map<id_type, const meta_type_node *, identity> id;
+};
+
 struct meta_context {
-    dense_map<id_type, meta_type_node, identity> value;
+    // nodes are allocated separately so that meta objects can refer to them
+    dense_map<id_type, std::unique_ptr<meta_type_node>, identity> value;
+    // readers only look at the published table, writers replace it as a whole
+    std::atomic<const meta_context_table *> published{};
+    std::vector<std::unique_ptr<meta_context_table>> tables;
+    std::atomic<std::size_t> generation{};
+    // registrations within a batch are published at once when it ends
+    std::size_t deferred{};
+    bool pending{};
+
+    meta_context() = default;
+
+    meta_context(const meta_context &) = delete;
+
+    meta_context(meta_context &&other) noexcept
+        : value{std::move(other.value)},
+          published{other.published.exchange(nullptr)},
+          tables{std::move(other.tables)},
+          generation{other.generation.load()},
+          deferred{std::exchange(other.deferred, 0u)},
+          pending{std::exchange(other.pending, false)} {}
+
+    ~meta_context() = default;
+
+    meta_context &operator=(const meta_context &) = delete;
+
+    meta_context &operator=(meta_context &&other) noexcept {
+        value = std::move(other.value);
+        published = other.published.exchange(nullptr);
+        tables = std::move(other.tables);
+        generation = other.generation.load();
+        deferred = std::exchange(other.deferred, 0u);
+        pending = std::exchange(other.pending, false);
+        return *this;
+    }
 
     [[nodiscard]] inline static meta_context &from(meta_ctx &ctx);
     [[nodiscard]] inline static const meta_context &from(const meta_ctx &ctx);
@@ -1,6 +1,8 @@
 #ifndef ENTT_META_FACTORY_HPP
 #define ENTT_META_FACTORY_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -52,15 +54,21 @@ class basic_meta_factory {
 protected:
     void type(const id_type id, const char *name) noexcept {
         reset_bucket(parent);
-        auto &&elem = meta_context::from(*ctx).value[parent];
-        ENTT_ASSERT(elem.id == id || !resolve(*ctx, id), "Duplicate identifier");
+        auto &&context = meta_context::from(*ctx);
+        auto &&elem = *context.value[parent];
+        ENTT_ASSERT(elem.id == id || std::none_of(context.value.cbegin(), context.value.cend(), [id](auto &&curr) { return curr.second->id == id; }), "Duplicate identifier");
         elem.name = name;
-        elem.id = id;
+
+        if(elem.id != id) {
+            elem.id = id;
+            publish(context);
+        }
     }
 
     template<typename Type>
     void insert_or_assign(Type node) {
         reset_bucket(parent);
+        ++meta_context::from(*ctx).generation;
 
         if constexpr(std::is_same_v<Type, meta_base_node>) {
             auto *member = find_member<&meta_base_node::type>(details->base, node.type);
@@ -77,11 +85,12 @@ protected:
 
     void dtor(meta_dtor_node node) {
         reset_bucket(parent);
-        meta_context::from(*ctx).value[parent].dtor = node;
+        meta_context::from(*ctx).value[parent]->dtor = node;
     }
 
     void data(meta_data_node node) {
         reset_bucket(node.id);
+        ++meta_context::from(*ctx).generation;
 
         if(auto *member = find_member<&meta_data_node::id>(details->data, node.id); member == nullptr) {
             details->data.emplace_back(std::move(node));
@@ -92,6 +101,7 @@ protected:
 
     void func(meta_func_node node) {
         reset_bucket(node.id, node.invoke);
+        ++meta_context::from(*ctx).generation;
 
         if(auto *member = find_member<&meta_func_node::id>(details->func, node.id); member == nullptr) {
             details->func.emplace_back(std::move(node));
@@ -103,7 +113,7 @@ protected:
 
     void traits(const meta_traits value) {
         if(bucket == parent) {
-            meta_context::from(*ctx).value[bucket].traits |= value;
+            meta_context::from(*ctx).value[bucket]->traits |= value;
         } else if(invoke == nullptr) {
             find_member_or_assert()->traits |= value;
         } else {
@@ -113,7 +123,7 @@ protected:
 
     void custom(meta_custom_node node) {
         if(bucket == parent) {
-            meta_context::from(*ctx).value[bucket].custom = std::move(node);
+            meta_context::from(*ctx).value[bucket]->custom = std::move(node);
         } else if(invoke == nullptr) {
             find_member_or_assert()->custom = std::move(node);
         } else {
@@ -128,9 +138,12 @@ public:
           bucket{parent},
           details{node.details.get()} {
         if(details == nullptr) {
+            auto &&context = meta_context::from(*ctx);
             node.details = std::make_shared<meta_type_descriptor>();
-            meta_context::from(*ctx).value[parent] = node;
             details = node.details.get();
+            context.value[parent] = std::make_unique<meta_type_node>(std::move(node));
+            publish(context);
+            ++context.generation;
         }
     }
 
@@ -166,7 +179,7 @@ public:
      * @param area The context into which to construct meta types.
      */
     meta_factory(meta_ctx &area) noexcept
-        : internal::basic_meta_factory{area, internal::resolve<Type>(internal::meta_context::from(area))} {}
+        : internal::basic_meta_factory{area, internal::meta_factory_node<Type>(internal::meta_context::from(area))} {}
 
     /**
      * @brief Assigns a custom unique identifier to a meta type.
@@ -342,17 +355,23 @@ public:
             using data_type = std::invoke_result_t<decltype(Data), Type &>;
             static_assert(Policy::template value<data_type>, "Invalid return type for the given policy");
 
-            base_type::data(
-                internal::meta_data_node{
-                    id,
-                    name,
-                    /* this is never static */
-                    std::is_const_v<std::remove_reference_t<data_type>> ? internal::meta_traits::is_const : internal::meta_traits::is_none,
-                    1u,
-                    &internal::resolve<std::remove_cv_t<std::remove_reference_t<data_type>>>,
-                    &meta_arg<type_list<std::remove_cv_t<std::remove_reference_t<data_type>>>>,
-                    &meta_setter<Type, Data>,
-                    &meta_getter<Type, Data, Policy>});
+            internal::meta_data_node node{
+                id,
+                name,
+                /* this is never static */
+                std::is_const_v<std::remove_reference_t<data_type>> ? internal::meta_traits::is_const : internal::meta_traits::is_none,
+                1u,
+                &internal::resolve<std::remove_cv_t<std::remove_reference_t<data_type>>>,
+                &meta_arg<type_list<std::remove_cv_t<std::remove_reference_t<data_type>>>>,
+                &meta_setter<Type, Data>,
+                &meta_getter<Type, Data, Policy>};
+
+            node.address = +[](meta_handle instance) -> const void * {
+                const auto *elem = instance->template try_cast<const Type>();
+                return elem ? &(elem->*Data) : nullptr;
+            };
+
+            base_type::data(std::move(node));
         } else {
             using data_type = std::remove_pointer_t<decltype(Data)>;
 
@@ -479,15 +498,23 @@ public:
         using descriptor = meta_function_helper_t<Type, decltype(Candidate)>;
         static_assert(Policy::template value<typename descriptor::return_type>, "Invalid return type for the given policy");
 
-        base_type::func(
-            internal::meta_func_node{
-                id,
-                name,
-                (descriptor::is_const ? internal::meta_traits::is_const : internal::meta_traits::is_none) | (descriptor::is_static ? internal::meta_traits::is_static : internal::meta_traits::is_none),
-                descriptor::args_type::size,
-                &internal::resolve<std::conditional_t<std::is_same_v<Policy, as_void_t>, void, std::remove_cv_t<std::remove_reference_t<typename descriptor::return_type>>>>,
-                &meta_arg<typename descriptor::args_type>,
-                &meta_invoke<Type, Candidate, Policy>});
+        internal::meta_func_node node{
+            id,
+            name,
+            (descriptor::is_const ? internal::meta_traits::is_const : internal::meta_traits::is_none) | (descriptor::is_static ? internal::meta_traits::is_static : internal::meta_traits::is_none),
+            descriptor::args_type::size,
+            &internal::resolve<std::conditional_t<std::is_same_v<Policy, as_void_t>, void, std::remove_cv_t<std::remove_reference_t<typename descriptor::return_type>>>>,
+            &meta_arg<typename descriptor::args_type>,
+            &meta_invoke<Type, Candidate, Policy>};
+
+        if constexpr(is_complete_v<internal::meta_signature<decltype(Candidate)>>) {
+            using signature_type = typename internal::meta_signature<decltype(Candidate)>::type;
+            node.signature = type_id<signature_type>().hash();
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            node.thunk = reinterpret_cast<void (*)()>(&internal::meta_thunk<Candidate, signature_type>::invoke);
+        }
+
+        base_type::func(std::move(node));
 
         return *this;
     }
@@ -522,6 +549,105 @@ public:
     }
 };
 
+/**
+ * @brief Reserves enough space for a given number of meta types.
+ *
+ * Meant to be invoked before registering many types at once, so as to avoid
+ * rehashing the context over and over again during startup.<br/>
+ * Types are still built at runtime by their factories, this function doesn't
+ * offer a static registration path.
+ *
+ * @param ctx The context in which to reserve space.
+ * @param count Number of meta types for which to reserve space.
+ */
+inline void meta_reserve(meta_ctx &ctx, const std::size_t count) {
+    internal::meta_context::from(ctx).value.reserve(count);
+}
+
+/**
+ * @brief Reserves enough space for a given number of meta types.
+ * @param count Number of meta types for which to reserve space.
+ */
+inline void meta_reserve(const std::size_t count) {
+    meta_reserve(locator<meta_ctx>::value_or(), count);
+}
+
+/**
+ * @brief Publishes the types registered in a scope all at once.
+ *
+ * Registering a type publishes a new lookup table rather than modifying the
+ * current one, so that other threads can resolve types in the meantime. Within
+ * the scope of a batch, registrations aren't published until the outermost
+ * batch ends. Therefore, a burst of registrations costs a single table.
+ *
+ * @warning
+ * Types registered within a batch can't be resolved until the batch ends, not
+ * even by the thread that registers them.
+ */
+class meta_batch {
+public:
+    /**
+     * @brief Opens a batch for a given context.
+     * @param area The context for which to defer publications.
+     */
+    meta_batch(meta_ctx &area) noexcept
+        : ctx{&area} {
+        ++internal::meta_context::from(*ctx).deferred;
+    }
+
+    /*! @brief Opens a batch for the default context. */
+    meta_batch() noexcept
+        : meta_batch{locator<meta_ctx>::value_or()} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    meta_batch(const meta_batch &) = delete;
+
+    /*! @brief Closes the batch and publishes pending types, if any. */
+    ~meta_batch() {
+        if(auto &&context = internal::meta_context::from(*ctx); (--context.deferred == 0u) && context.pending) {
+            internal::publish(context);
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This batch.
+     */
+    meta_batch &operator=(const meta_batch &) = delete;
+
+private:
+    meta_ctx *ctx;
+};
+
+/**
+ * @brief Releases the lookup tables retired so far.
+ *
+ * Registering a new type publishes a new lookup table rather than modifying
+ * the current one, so that other threads can resolve types in the meantime.
+ * Old tables are kept alive until this function is invoked.
+ *
+ * @warning
+ * Users must only reclaim retired tables once no thread can still be resolving
+ * types, for example at the end of a frame.
+ *
+ * @param ctx The context from which to release retired tables.
+ * @return Number of retired tables released.
+ */
+inline std::size_t meta_reclaim(meta_ctx &ctx) noexcept {
+    auto &&context = internal::meta_context::from(ctx);
+    const auto len = context.tables.empty() ? 0u : (context.tables.size() - 1u);
+    context.tables.erase(context.tables.begin(), context.tables.begin() + static_cast<std::ptrdiff_t>(len));
+    return len;
+}
+
+/**
+ * @brief Releases the lookup tables retired so far.
+ * @return Number of retired tables released.
+ */
+inline std::size_t meta_reclaim() noexcept {
+    return meta_reclaim(locator<meta_ctx>::value_or());
+}
+
 /**
  * @brief Resets a type and all its parts.
  *
@@ -538,12 +664,15 @@ inline void meta_reset(meta_ctx &ctx, const id_type id) noexcept {
     auto &&context = internal::meta_context::from(ctx);
 
     for(auto it = context.value.begin(); it != context.value.end();) {
-        if(it->second.id == id) {
+        if(it->second->id == id) {
+            internal::unpublish(context, it->first, id);
             it = context.value.erase(it);
         } else {
             ++it;
         }
     }
+
+    ++context.generation;
 }
 
 /**
@@ -571,7 +700,14 @@ inline void meta_reset(const id_type id) noexcept {
  */
 template<typename Type>
 void meta_reset(meta_ctx &ctx) noexcept {
-    internal::meta_context::from(ctx).value.erase(type_id<Type>().hash());
+    auto &&context = internal::meta_context::from(ctx);
+
+    if(auto it = context.value.find(type_id<Type>().hash()); it != context.value.end()) {
+        internal::unpublish(context, it->first, it->second->id);
+        context.value.erase(it);
+    }
+
+    ++context.generation;
 }
 
 /**
@@ -594,7 +730,12 @@ void meta_reset() noexcept {
  * @param ctx The context from which to reset meta types.
  */
 inline void meta_reset(meta_ctx &ctx) noexcept {
-    internal::meta_context::from(ctx).value.clear();
+    auto &&context = internal::meta_context::from(ctx);
+    context.published.store(nullptr, std::memory_order_release);
+    context.tables.clear();
+    context.pending = false;
+    context.value.clear();
+    ++context.generation;
 }
 
 /**
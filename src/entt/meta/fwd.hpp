@@ -24,6 +24,16 @@ struct meta_func;
 
 class meta_type;
 
+class meta_column;
+
+class meta_plan;
+
+class meta_hasher;
+
+class meta_output_archive;
+
+class meta_input_archive;
+
 template<typename>
 class meta_factory;
 
@@ -3,6 +3,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -27,6 +28,22 @@ namespace entt {
 class meta_any;
 class meta_type;
 
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+template<typename Traits, typename = void>
+struct meta_contiguous_data {
+    static constexpr const void *(*value)(const void *) = nullptr;
+};
+
+template<typename Traits>
+struct meta_contiguous_data<Traits, std::void_t<decltype(&Traits::data)>> {
+    static constexpr const void *(*value)(const void *) = &Traits::data;
+};
+
+} // namespace internal
+/*! @endcond */
+
 /*! @brief Proxy object for sequence containers. */
 class meta_sequence_container {
     class meta_iterator;
@@ -49,13 +66,14 @@ public:
     template<typename Type>
     meta_sequence_container(const meta_ctx &area, Type &instance) noexcept
         : ctx{&area},
-          data{&instance},
+          container{&instance},
           value_type_node{&internal::resolve<typename Type::value_type>},
           const_reference_node{&internal::resolve<std::remove_const_t<std::remove_reference_t<typename Type::const_reference>>>},
           size_fn{meta_sequence_container_traits<std::remove_const_t<Type>>::size},
           clear_fn{meta_sequence_container_traits<std::remove_const_t<Type>>::clear},
           reserve_fn{meta_sequence_container_traits<std::remove_const_t<Type>>::reserve},
           resize_fn{meta_sequence_container_traits<std::remove_const_t<Type>>::resize},
+          data_fn{internal::meta_contiguous_data<meta_sequence_container_traits<std::remove_const_t<Type>>>::value},
           begin_fn{meta_sequence_container_traits<std::remove_const_t<Type>>::begin},
           end_fn{meta_sequence_container_traits<std::remove_const_t<Type>>::end},
           insert_fn{meta_sequence_container_traits<std::remove_const_t<Type>>::insert},
@@ -65,6 +83,8 @@ public:
     [[nodiscard]] inline meta_type value_type() const noexcept;
     [[nodiscard]] inline size_type size() const noexcept;
     inline bool resize(size_type);
+    [[nodiscard]] inline const void *data() const noexcept;
+    [[nodiscard]] inline void *data() noexcept;
     inline bool clear();
     inline bool reserve(size_type);
     [[nodiscard]] inline iterator begin();
@@ -76,13 +96,14 @@ public:
 
 private:
     const meta_ctx *ctx{};
-    const void *data{};
-    internal::meta_type_node (*value_type_node)(const internal::meta_context &){};
-    internal::meta_type_node (*const_reference_node)(const internal::meta_context &){};
+    const void *container{};
+    const internal::meta_type_node &(*value_type_node)(const internal::meta_context &){};
+    const internal::meta_type_node &(*const_reference_node)(const internal::meta_context &){};
     size_type (*size_fn)(const void *){};
     bool (*clear_fn)(void *){};
     bool (*reserve_fn)(void *, const size_type){};
     bool (*resize_fn)(void *, const size_type){};
+    const void *(*data_fn)(const void *){};
     iterator (*begin_fn)(const meta_ctx &, void *, const void *){};
     iterator (*end_fn)(const meta_ctx &, void *, const void *){};
     iterator (*insert_fn)(const meta_ctx &, void *, const void *, const void *, const iterator &){};
@@ -145,9 +166,9 @@ public:
 private:
     const meta_ctx *ctx{};
     const void *data{};
-    internal::meta_type_node (*key_type_node)(const internal::meta_context &){};
-    internal::meta_type_node (*mapped_type_node)(const internal::meta_context &){};
-    internal::meta_type_node (*value_type_node)(const internal::meta_context &){};
+    const internal::meta_type_node &(*key_type_node)(const internal::meta_context &){};
+    const internal::meta_type_node &(*mapped_type_node)(const internal::meta_context &){};
+    const internal::meta_type_node &(*value_type_node)(const internal::meta_context &){};
     size_type (*size_fn)(const void *){};
     bool (*clear_fn)(void *){};
     bool (*reserve_fn)(void *, const size_type){};
@@ -161,6 +182,8 @@ private:
 
 /*! @brief Opaque wrapper for values of any type. */
 class meta_any {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+    using any_type = basic_any<ENTT_META_ANY_LENGTH, ENTT_META_ANY_ALIGNMENT>;
     using vtable_type = void(const internal::meta_traits op, const meta_ctx &, const void *, void *);
 
     template<typename Type>
@@ -201,12 +224,12 @@ class meta_any {
     }
 
     void release() {
-        if(storage.owner() && (node.dtor.dtor != nullptr)) {
-            node.dtor.dtor(storage.data());
+        if(storage.owner() && (node->dtor.dtor != nullptr)) {
+            node->dtor.dtor(storage.data());
         }
     }
 
-    meta_any(const meta_any &other, any ref) noexcept
+    meta_any(const meta_any &other, any_type ref) noexcept
         : storage{std::move(ref)},
           ctx{other.ctx} {
         if(storage || !other.storage) {
@@ -247,7 +270,7 @@ public:
     explicit meta_any(const meta_ctx &area, std::in_place_type_t<Type>, Args &&...args)
         : storage{std::in_place_type<Type>, std::forward<Args>(args)...},
           ctx{&area},
-          node{internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx))},
+          node{&internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx))},
           vtable{&basic_vtable<std::remove_cv_t<std::remove_reference_t<Type>>>} {}
 
     /**
@@ -270,7 +293,7 @@ public:
         : storage{std::in_place, value},
           ctx{&area} {
         if(storage) {
-            node = internal::resolve<Type>(internal::meta_context::from(*ctx));
+            node = &internal::resolve<Type>(internal::meta_context::from(*ctx));
             vtable = &basic_vtable<Type>;
         }
     }
@@ -302,7 +325,7 @@ public:
     meta_any(const meta_ctx &area, const meta_any &other)
         : storage{other.storage},
           ctx{&area},
-          node{(other.node.resolve != nullptr) ? other.node.resolve(internal::meta_context::from(*ctx)) : other.node},
+          node{(other.node->resolve != nullptr) ? &other.node->resolve(internal::meta_context::from(*ctx)) : other.node},
           vtable{other.vtable} {}
 
     /**
@@ -313,7 +336,7 @@ public:
     meta_any(const meta_ctx &area, meta_any &&other)
         : storage{std::move(other.storage)},
           ctx{&area},
-          node{(other.node.resolve != nullptr) ? std::exchange(other.node, internal::meta_type_node{}).resolve(internal::meta_context::from(*ctx)) : std::exchange(other.node, internal::meta_type_node{})},
+          node{(other.node->resolve != nullptr) ? &std::exchange(other.node, &internal::meta_null_node())->resolve(internal::meta_context::from(*ctx)) : std::exchange(other.node, &internal::meta_null_node())},
           vtable{std::exchange(other.vtable, nullptr)} {}
 
     /**
@@ -329,7 +352,7 @@ public:
     meta_any(meta_any &&other) noexcept
         : storage{std::move(other.storage)},
           ctx{other.ctx},
-          node{std::exchange(other.node, internal::meta_type_node{})},
+          node{std::exchange(other.node, &internal::meta_null_node())},
           vtable{std::exchange(other.vtable, nullptr)} {}
 
     /*! @brief Frees the internal storage, whatever it means. */
@@ -367,7 +390,7 @@ public:
         reset();
         storage = std::move(other.storage);
         ctx = other.ctx;
-        node = std::exchange(other.node, internal::meta_type_node{});
+        node = std::exchange(other.node, &internal::meta_null_node());
         vtable = std::exchange(other.vtable, nullptr);
         return *this;
     }
@@ -429,7 +452,7 @@ public:
     template<typename Type>
     [[nodiscard]] const Type *try_cast() const {
         const auto &other = type_id<std::remove_cv_t<Type>>();
-        return static_cast<const Type *>(internal::try_cast(internal::meta_context::from(*ctx), node, other, storage.data()));
+        return static_cast<const Type *>(internal::try_cast(internal::meta_context::from(*ctx), *node, other, storage.data()));
     }
 
     /*! @copydoc try_cast */
@@ -440,7 +463,7 @@ public:
         } else {
             const auto &other = type_id<Type>();
             // NOLINTNEXTLINE(bugprone-casting-through-void)
-            return static_cast<Type *>(const_cast<void *>(internal::try_cast(internal::meta_context::from(*ctx), node, other, storage.data())));
+            return static_cast<Type *>(const_cast<void *>(internal::try_cast(internal::meta_context::from(*ctx), *node, other, storage.data())));
         }
     }
 
@@ -502,7 +525,7 @@ public:
             return meta_any{meta_ctx_arg, *ctx};
         } else {
             // also support early return for performance reasons
-            return ((node.info != nullptr) && (*node.info == entt::type_id<Type>())) ? as_ref() : allow_cast(meta_type{*ctx, internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx))});
+            return ((node->info != nullptr) && (*node->info == entt::type_id<Type>())) ? as_ref() : allow_cast(meta_type{*ctx, internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx))});
         }
     }
 
@@ -517,7 +540,7 @@ public:
             return allow_cast<const std::remove_reference_t<Type> &>() && (storage.data() != nullptr);
         } else {
             // also support early return for performance reasons
-            return ((node.info != nullptr) && (*node.info == entt::type_id<Type>())) || allow_cast(meta_type{*ctx, internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx))});
+            return ((node->info != nullptr) && (*node->info == entt::type_id<Type>())) || allow_cast(meta_type{*ctx, internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx))});
         }
     }
 
@@ -526,7 +549,7 @@ public:
     void emplace(Args &&...args) {
         release();
         storage.emplace<Type>(std::forward<Args>(args)...);
-        node = internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx));
+        node = &internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx));
         vtable = &basic_vtable<std::remove_cv_t<std::remove_reference_t<Type>>>;
     }
 
@@ -540,7 +563,7 @@ public:
     void reset() {
         release();
         storage.reset();
-        node = {};
+        node = &internal::meta_null_node();
         vtable = nullptr;
     }
 
@@ -594,12 +617,12 @@ public:
      * @return False if the wrapper is invalid, true otherwise.
      */
     [[nodiscard]] explicit operator bool() const noexcept {
-        return !(node.info == nullptr);
+        return !(node->info == nullptr);
     }
 
     /*! @copydoc any::operator== */
     [[nodiscard]] bool operator==(const meta_any &other) const noexcept {
-        return (ctx == other.ctx) && (((node.info == nullptr) && (other.node.info == nullptr)) || ((node.info != nullptr) && (other.node.info != nullptr) && *node.info == *other.node.info && storage == other.storage));
+        return (ctx == other.ctx) && (((node->info == nullptr) && (other.node->info == nullptr)) || ((node->info != nullptr) && (other.node->info != nullptr) && *node->info == *other.node->info && storage == other.storage));
     }
 
     /*! @copydoc any::operator!= */
@@ -621,7 +644,7 @@ public:
      * @brief Returns the underlying storage.
      * @return The underlyig storage.
      */
-    [[nodiscard]] const any &base() const noexcept {
+    [[nodiscard]] const any_type &base() const noexcept {
         return storage;
     }
 
@@ -634,9 +657,9 @@ public:
     }
 
 private:
-    any storage;
+    any_type storage;
     const meta_ctx *ctx{&locator<meta_ctx>::value_or()};
-    internal::meta_type_node node{};
+    const internal::meta_type_node *node{&internal::meta_null_node()};
     vtable_type *vtable{};
 };
 
@@ -889,6 +912,20 @@ struct meta_data {
         return (node.get != nullptr) ? node.get(meta_handle{*ctx, std::move(instance)}) : meta_any{meta_ctx_arg, *ctx};
     }
 
+    /**
+     * @brief Returns the address of a data member within a given instance.
+     *
+     * Only data members registered as pointers to members offer direct access
+     * to their storage. Setters, getters and static variables don't.
+     *
+     * @param instance An opaque instance of the underlying type.
+     * @return The address of the data member, if available, a null pointer
+     * otherwise.
+     */
+    [[nodiscard]] const void *address(meta_handle instance) const {
+        return (node.address != nullptr) ? node.address(meta_handle{*ctx, std::move(instance)}) : nullptr;
+    }
+
     /**
      * @brief Returns the type accepted by the i-th setter.
      * @param index Index of the setter of which to return the accepted type.
@@ -1051,6 +1088,40 @@ struct meta_func {
         return (node.next != nullptr) ? meta_func{*ctx, *node.next} : meta_func{};
     }
 
+    /**
+     * @brief Returns a pointer to a function that directly invokes the
+     * underlying function or one of its overloads, if any.
+     *
+     * The function type must match exactly that of the underlying function,
+     * where member functions take an instance of their class as the first
+     * argument:
+     *
+     * @code{.cpp}
+     * int(my_type &, int);
+     * int(const my_type &, int);
+     * @endcode
+     *
+     * The resulting function doesn't box arguments nor search for conversions.
+     * Policies aren't applied either and the returned value is that of the
+     * underlying function.
+     *
+     * @tparam Type Function type of the underlying function.
+     * @return A pointer to a function, if any, a null pointer otherwise.
+     */
+    template<typename Type>
+    [[nodiscard]] Type *bind() const noexcept {
+        static_assert(std::is_function_v<Type>, "Invalid function type");
+
+        for(const auto *curr = &node; curr != nullptr; curr = curr->next.get()) {
+            if((curr->thunk != nullptr) && (curr->signature == type_id<Type>().hash())) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                return reinterpret_cast<Type *>(curr->thunk);
+            }
+        }
+
+        return nullptr;
+    }
+
     /**
      * @brief Returns true if an object is valid, false otherwise.
      * @return True if the object is valid, false otherwise.
@@ -1105,7 +1176,7 @@ class meta_type {
 
                     if(const auto &info = other.info(); info == type.info()) {
                         ++match;
-                    } else if(!(type.node.conversion_helper && other.node.conversion_helper) && !(type.node.details && (internal::find_member<&internal::meta_base_node::type>(type.node.details->base, info.hash()) || internal::find_member<&internal::meta_conv_node::type>(type.node.details->conv, info.hash())))) {
+                    } else if(!(type.node->conversion_helper && other.node->conversion_helper) && !(type.node->details && (internal::find_member<&internal::meta_base_node::type>(type.node->details->base, info.hash()) || internal::find_member<&internal::meta_conv_node::type>(type.node->details->conv, info.hash())))) {
                         break;
                     }
                 }
@@ -1146,8 +1217,8 @@ public:
      * @param area The context from which to search for meta types.
      * @param curr The underlying node with which to construct the instance.
      */
-    meta_type(const meta_ctx &area, internal::meta_type_node curr) noexcept
-        : node{std::move(curr)},
+    meta_type(const meta_ctx &area, const internal::meta_type_node &curr) noexcept
+        : node{&curr},
           ctx{&area} {}
 
     /**
@@ -1163,7 +1234,7 @@ public:
      * @return The type info object of the underlying type.
      */
     [[nodiscard]] const type_info &info() const noexcept {
-        return (node.info != nullptr) ? *node.info : type_id<void>();
+        return (node->info != nullptr) ? *node->info : type_id<void>();
     }
 
     /**
@@ -1171,7 +1242,7 @@ public:
      * @return The identifier assigned to the type.
      */
     [[nodiscard]] id_type id() const noexcept {
-        return node.id;
+        return node->id;
     }
 
     /**
@@ -1179,7 +1250,7 @@ public:
      * @return The name assigned to the type, if any.
      */
     [[nodiscard]] const char *name() const noexcept {
-        return node.name;
+        return node->name;
     }
 
     /**
@@ -1187,7 +1258,7 @@ public:
      * @return The size of the underlying type if known, 0 otherwise.
      */
     [[nodiscard]] size_type size_of() const noexcept {
-        return node.size_of;
+        return node->size_of;
     }
 
     /**
@@ -1196,7 +1267,7 @@ public:
      * otherwise.
      */
     [[nodiscard]] bool is_arithmetic() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_arithmetic);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_arithmetic);
     }
 
     /**
@@ -1204,7 +1275,7 @@ public:
      * @return True if the underlying type is an integral type, false otherwise.
      */
     [[nodiscard]] bool is_integral() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_integral);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_integral);
     }
 
     /**
@@ -1212,7 +1283,7 @@ public:
      * @return True if the underlying type is a signed type, false otherwise.
      */
     [[nodiscard]] bool is_signed() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_signed);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_signed);
     }
 
     /**
@@ -1220,7 +1291,7 @@ public:
      * @return True if the underlying type is an array type, false otherwise.
      */
     [[nodiscard]] bool is_array() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_array);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_array);
     }
 
     /**
@@ -1228,7 +1299,7 @@ public:
      * @return True if the underlying type is an enum, false otherwise.
      */
     [[nodiscard]] bool is_enum() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_enum);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_enum);
     }
 
     /**
@@ -1236,7 +1307,16 @@ public:
      * @return True if the underlying type is a class, false otherwise.
      */
     [[nodiscard]] bool is_class() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_class);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_class);
+    }
+
+    /**
+     * @brief Checks whether a type is trivially copyable or not.
+     * @return True if the underlying type is trivially copyable, false
+     * otherwise.
+     */
+    [[nodiscard]] bool is_trivially_copyable() const noexcept {
+        return static_cast<bool>(node->traits & internal::meta_traits::is_trivially_copyable);
     }
 
     /**
@@ -1244,7 +1324,7 @@ public:
      * @return True if the underlying type is a pointer, false otherwise.
      */
     [[nodiscard]] bool is_pointer() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_pointer);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_pointer);
     }
 
     /**
@@ -1253,7 +1333,7 @@ public:
      * doesn't refer to a pointer type.
      */
     [[nodiscard]] meta_type remove_pointer() const noexcept {
-        return (node.remove_pointer != nullptr) ? meta_type{*ctx, node.remove_pointer(internal::meta_context::from(*ctx))} : *this;
+        return (node->remove_pointer != nullptr) ? meta_type{*ctx, node->remove_pointer(internal::meta_context::from(*ctx))} : *this;
     }
 
     /**
@@ -1261,7 +1341,7 @@ public:
      * @return True if the underlying type is pointer-like, false otherwise.
      */
     [[nodiscard]] bool is_pointer_like() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_pointer_like);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_pointer_like);
     }
 
     /**
@@ -1269,7 +1349,7 @@ public:
      * @return True if the type is a sequence container, false otherwise.
      */
     [[nodiscard]] bool is_sequence_container() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_sequence_container);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_sequence_container);
     }
 
     /**
@@ -1277,7 +1357,7 @@ public:
      * @return True if the type is an associative container, false otherwise.
      */
     [[nodiscard]] bool is_associative_container() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_associative_container);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_associative_container);
     }
 
     /**
@@ -1287,7 +1367,7 @@ public:
      * false otherwise.
      */
     [[nodiscard]] bool is_template_specialization() const noexcept {
-        return (node.templ.arity != 0u);
+        return (node->templ.arity != 0u);
     }
 
     /**
@@ -1295,7 +1375,7 @@ public:
      * @return The number of template arguments.
      */
     [[nodiscard]] size_type template_arity() const noexcept {
-        return node.templ.arity;
+        return node->templ.arity;
     }
 
     /**
@@ -1303,7 +1383,7 @@ public:
      * @return The tag for the class template of the underlying type.
      */
     [[nodiscard]] meta_type template_type() const noexcept {
-        return (node.templ.resolve != nullptr) ? meta_type{*ctx, node.templ.resolve(internal::meta_context::from(*ctx))} : meta_type{};
+        return (node->templ.resolve != nullptr) ? meta_type{*ctx, node->templ.resolve(internal::meta_context::from(*ctx))} : meta_type{};
     }
 
     /**
@@ -1312,7 +1392,7 @@ public:
      * @return The type of the i-th template argument of a type.
      */
     [[nodiscard]] meta_type template_arg(const size_type index) const noexcept {
-        return index < template_arity() ? meta_type{*ctx, node.templ.arg(internal::meta_context::from(*ctx), index)} : meta_type{};
+        return index < template_arity() ? meta_type{*ctx, node->templ.arg(internal::meta_context::from(*ctx), index)} : meta_type{};
     }
 
     /**
@@ -1322,7 +1402,7 @@ public:
      */
     [[nodiscard]] bool can_cast(const meta_type &other) const noexcept {
         // casting this is UB in all cases but we aren't going to use the resulting pointer, so...
-        return other && (internal::try_cast(internal::meta_context::from(*ctx), node, *other.node.info, this) != nullptr);
+        return other && (internal::try_cast(internal::meta_context::from(*ctx), *node, *other.node->info, this) != nullptr);
     }
 
     /**
@@ -1331,7 +1411,7 @@ public:
      * @return True if the conversion is allowed, false otherwise.
      */
     [[nodiscard]] bool can_convert(const meta_type &other) const noexcept {
-        return (internal::try_convert(internal::meta_context::from(*ctx), node, other.info(), other.is_arithmetic() || other.is_enum(), nullptr, [](const void *, auto &&...args) { return ((static_cast<void>(args), 1) + ... + 0u); }) != 0u);
+        return (internal::try_convert(internal::meta_context::from(*ctx), *node, other.info(), other.is_arithmetic() || other.is_enum(), nullptr, [](const void *, auto &&...args) { return ((static_cast<void>(args), 1) + ... + 0u); }) != 0u);
     }
 
     /**
@@ -1340,7 +1420,7 @@ public:
      */
     [[nodiscard]] meta_range<meta_type, typename decltype(internal::meta_type_descriptor::base)::const_iterator> base() const noexcept {
         using range_type = meta_range<meta_type, typename decltype(internal::meta_type_descriptor::base)::const_iterator>;
-        return node.details ? range_type{{*ctx, node.details->base.cbegin()}, {*ctx, node.details->base.cend()}} : range_type{};
+        return node->details ? range_type{{*ctx, node->details->base.cbegin()}, {*ctx, node->details->base.cend()}} : range_type{};
     }
 
     /**
@@ -1349,7 +1429,7 @@ public:
      */
     [[nodiscard]] meta_range<meta_data, typename decltype(internal::meta_type_descriptor::data)::const_iterator> data() const noexcept {
         using range_type = meta_range<meta_data, typename decltype(internal::meta_type_descriptor::data)::const_iterator>;
-        return node.details ? range_type{{*ctx, node.details->data.cbegin()}, {*ctx, node.details->data.cend()}} : range_type{};
+        return node->details ? range_type{{*ctx, node->details->data.cbegin()}, {*ctx, node->details->data.cend()}} : range_type{};
     }
 
     /**
@@ -1358,7 +1438,7 @@ public:
      * @return The registered meta data for the given identifier, if any.
      */
     [[nodiscard]] meta_data data(const id_type id) const {
-        const auto *elem = internal::look_for<&internal::meta_type_descriptor::data>(internal::meta_context::from(*ctx), node, id);
+        const auto *elem = internal::look_for<&internal::meta_type_descriptor::data>(internal::meta_context::from(*ctx), *node, id);
         return (elem != nullptr) ? meta_data{*ctx, *elem} : meta_data{};
     }
 
@@ -1368,7 +1448,7 @@ public:
      */
     [[nodiscard]] meta_range<meta_func, typename decltype(internal::meta_type_descriptor::func)::const_iterator> func() const noexcept {
         using return_type = meta_range<meta_func, typename decltype(internal::meta_type_descriptor::func)::const_iterator>;
-        return node.details ? return_type{{*ctx, node.details->func.cbegin()}, {*ctx, node.details->func.cend()}} : return_type{};
+        return node->details ? return_type{{*ctx, node->details->func.cbegin()}, {*ctx, node->details->func.cend()}} : return_type{};
     }
 
     /**
@@ -1377,7 +1457,7 @@ public:
      * @return The registered meta function for the given identifier, if any.
      */
     [[nodiscard]] meta_func func(const id_type id) const {
-        const auto *elem = internal::look_for<&internal::meta_type_descriptor::func>(internal::meta_context::from(*ctx), node, id);
+        const auto *elem = internal::look_for<&internal::meta_type_descriptor::func>(internal::meta_context::from(*ctx), *node, id);
         return (elem != nullptr) ? meta_func{*ctx, *elem} : meta_func{};
     }
 
@@ -1388,14 +1468,14 @@ public:
      * @return A wrapper containing the new instance, if any.
      */
     [[nodiscard]] meta_any construct(meta_any *const args, const size_type sz) const {
-        if(node.details) {
-            if(const auto *candidate = lookup(args, sz, false, [first = node.details->ctor.cbegin(), last = node.details->ctor.cend()]() mutable { return first == last ? nullptr : &*(first++); }); candidate) {
+        if(node->details) {
+            if(const auto *candidate = lookup(args, sz, false, [first = node->details->ctor.cbegin(), last = node->details->ctor.cend()]() mutable { return first == last ? nullptr : &*(first++); }); candidate) {
                 return candidate->invoke(*ctx, args);
             }
         }
 
-        if(sz == 0u && (node.default_constructor != nullptr)) {
-            return node.default_constructor(*ctx);
+        if(sz == 0u && (node->default_constructor != nullptr)) {
+            return node->default_constructor(*ctx);
         }
 
         return meta_any{meta_ctx_arg, *ctx};
@@ -1413,6 +1493,73 @@ public:
         // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
     }
 
+    /**
+     * @brief Constructs a contiguous array of instances of the underlying type
+     * in place, if possible.
+     *
+     * A single instance is created from the given arguments as the `construct`
+     * function does. The elements of the array are then copy constructed from
+     * it. Trivially copyable types are copied with `memcpy` instead.
+     *
+     * @warning
+     * The buffer must be suitably aligned for the underlying type and large
+     * enough to contain the given number of elements.
+     *
+     * @tparam Args Types of arguments to use to construct the instances.
+     * @param buffer A pointer to uninitialized memory.
+     * @param count Number of instances to construct.
+     * @param args Parameters to use to construct the instances.
+     * @return True in case of success, false otherwise.
+     */
+    template<typename... Args>
+    bool construct_n(void *buffer, const size_type count, Args &&...args) const {
+        if(node->copy_n == nullptr) {
+            return false;
+        }
+
+        const auto instance = construct(std::forward<Args>(args)...);
+
+        if(!instance || (instance.type() != *this)) {
+            return false;
+        }
+
+        if(is_trivially_copyable() && (count != 0u)) {
+            const auto length = count * size_of();
+            auto *first = static_cast<std::byte *>(buffer);
+            std::memcpy(first, instance.base().data(), size_of());
+
+            // doubles the copied range at each step
+            for(size_type curr = size_of(); curr < length; curr *= 2u) {
+                std::memcpy(first + curr, first, (curr < (length - curr)) ? curr : (length - curr));
+            }
+        } else {
+            node->copy_n(buffer, instance.base().data(), count);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Destroys a contiguous array of instances of the underlying type.
+     *
+     * The destructor registered with the meta type, if any, is invoked for all
+     * elements before they are destroyed.
+     *
+     * @param buffer A pointer to the first element to destroy.
+     * @param count Number of instances to destroy.
+     */
+    void destroy_n(void *buffer, const size_type count) const {
+        if(node->dtor.dtor != nullptr) {
+            for(size_type pos{}; pos < count; ++pos) {
+                node->dtor.dtor(static_cast<std::byte *>(buffer) + pos * size_of());
+            }
+        }
+
+        if(node->destroy_n != nullptr) {
+            node->destroy_n(buffer, count);
+        }
+    }
+
     /**
      * @brief Wraps an opaque element of the underlying type.
      * @param elem A valid pointer to an element of the underlying type.
@@ -1420,7 +1567,7 @@ public:
      * @return A wrapper that references the given instance.
      */
     [[nodiscard]] meta_any from_void(void *elem, bool transfer_ownership = false) const {
-        return ((elem != nullptr) && (node.from_void != nullptr)) ? node.from_void(*ctx, elem, transfer_ownership ? elem : nullptr) : meta_any{meta_ctx_arg, *ctx};
+        return ((elem != nullptr) && (node->from_void != nullptr)) ? node->from_void(*ctx, elem, transfer_ownership ? elem : nullptr) : meta_any{meta_ctx_arg, *ctx};
     }
 
     /**
@@ -1429,7 +1576,7 @@ public:
      * @return A wrapper that references the given instance.
      */
     [[nodiscard]] meta_any from_void(const void *elem) const {
-        return ((elem != nullptr) && (node.from_void != nullptr)) ? node.from_void(*ctx, nullptr, elem) : meta_any{meta_ctx_arg, *ctx};
+        return ((elem != nullptr) && (node->from_void != nullptr)) ? node->from_void(*ctx, nullptr, elem) : meta_any{meta_ctx_arg, *ctx};
     }
 
     /**
@@ -1442,8 +1589,8 @@ public:
      */
     // NOLINTNEXTLINE(modernize-use-nodiscard)
     meta_any invoke(const id_type id, meta_handle instance, meta_any *const args, const size_type sz) const {
-        if(node.details) {
-            if(auto *elem = internal::find_member<&internal::meta_func_node::id>(node.details->func, id); elem != nullptr) {
+        if(node->details) {
+            if(auto *elem = internal::find_member<&internal::meta_func_node::id>(node->details->func, id); elem != nullptr) {
                 if(const auto *candidate = lookup(args, sz, (instance->base().policy() == any_policy::cref), [curr = elem]() mutable { return (curr != nullptr) ? std::exchange(curr, curr->next.get()) : nullptr; }); candidate) {
                     return candidate->invoke(meta_handle{*ctx, std::move(instance)}, args);
                 }
@@ -1502,12 +1649,12 @@ public:
     /*! @copydoc meta_data::traits */
     template<typename Type>
     [[nodiscard]] Type traits() const noexcept {
-        return internal::meta_to_user_traits<Type>(node.traits);
+        return internal::meta_to_user_traits<Type>(node->traits);
     }
 
     /*! @copydoc meta_data::custom */
     [[nodiscard]] meta_custom custom() const noexcept {
-        return {node.custom};
+        return {node->custom};
     }
 
     /**
@@ -1515,17 +1662,17 @@ public:
      * @return True if the object is valid, false otherwise.
      */
     [[nodiscard]] explicit operator bool() const noexcept {
-        return (node.info != nullptr);
+        return (node->info != nullptr);
     }
 
     /*! @copydoc meta_data::operator== */
     [[nodiscard]] bool operator==(const meta_type &other) const noexcept {
         // NOLINTNEXTLINE(clang-analyzer-core.NonNullParamChecker)
-        return (ctx == other.ctx) && ((node.info == nullptr) == (other.node.info == nullptr)) && (node.info == nullptr || (*node.info == *other.node.info));
+        return (ctx == other.ctx) && ((node->info == nullptr) == (other.node->info == nullptr)) && (node->info == nullptr || (*node->info == *other.node->info));
     }
 
 private:
-    internal::meta_type_node node{};
+    const internal::meta_type_node *node{&internal::meta_null_node()};
     const meta_ctx *ctx{&locator<meta_ctx>::value_or()};
 };
 
@@ -1540,7 +1687,7 @@ private:
 }
 
 [[nodiscard]] inline meta_type meta_any::type() const noexcept {
-    return (node.info != nullptr) ? meta_type{*ctx, node} : meta_type{};
+    return (node->info != nullptr) ? meta_type{*ctx, *node} : meta_type{};
 }
 
 template<typename... Args>
@@ -1568,7 +1715,7 @@ bool meta_any::set(const id_type id, Type &&value) {
 }
 
 [[nodiscard]] inline meta_any meta_any::allow_cast(const meta_type &type) const {
-    return internal::try_convert(internal::meta_context::from(*ctx), node, type.info(), type.is_arithmetic() || type.is_enum(), storage.data(), [this, &type]([[maybe_unused]] const void *instance, [[maybe_unused]] auto &&...args) {
+    return internal::try_convert(internal::meta_context::from(*ctx), *node, type.info(), type.is_arithmetic() || type.is_enum(), storage.data(), [this, &type]([[maybe_unused]] const void *instance, [[maybe_unused]] auto &&...args) {
         if constexpr((std::is_same_v<std::remove_const_t<std::remove_reference_t<decltype(args)>>, internal::meta_type_node> || ...)) {
             return (args.from_void(*ctx, nullptr, instance), ...);
         } else if constexpr((std::is_same_v<std::remove_const_t<std::remove_reference_t<decltype(args)>>, internal::meta_conv_node> || ...)) {
@@ -1577,7 +1724,7 @@ bool meta_any::set(const id_type id, Type &&value) {
             // exploits the fact that arithmetic types and enums are also default constructible
             auto other = type.construct();
             const auto value = (args(nullptr, instance), ...);
-            other.node.conversion_helper(other.storage.data(), &value);
+            other.node->conversion_helper(other.storage.data(), &value);
             return other;
         } else {
             // forwards to force a compile-time error in case of available arguments
@@ -1587,12 +1734,12 @@ bool meta_any::set(const id_type id, Type &&value) {
 }
 
 inline bool meta_any::assign(const meta_any &other) {
-    auto value = other.allow_cast({*ctx, node});
+    auto value = other.allow_cast({*ctx, *node});
     return value && storage.assign(value.storage);
 }
 
 inline bool meta_any::assign(meta_any &&other) {
-    if(*node.info == *other.node.info) {
+    if(*node->info == *other.node->info) {
         return storage.assign(std::move(other.storage));
     }
 
@@ -1781,7 +1928,7 @@ private:
  * @return The size of the container.
  */
 [[nodiscard]] inline meta_sequence_container::size_type meta_sequence_container::size() const noexcept {
-    return size_fn(data);
+    return size_fn(container);
 }
 
 /**
@@ -1790,7 +1937,26 @@ private:
  * @return True in case of success, false otherwise.
  */
 inline bool meta_sequence_container::resize(const size_type sz) {
-    return !const_only && resize_fn(const_cast<void *>(data), sz);
+    return !const_only && resize_fn(const_cast<void *>(container), sz);
+}
+
+/**
+ * @brief Returns a pointer to the elements of a contiguous container.
+ *
+ * Elements are of the type returned by `value_type` and are laid out one after
+ * the other, as many as the size of the container. This allows users to work
+ * with them directly rather than iterating and wrapping them one at a time.
+ *
+ * @return A pointer to the first element of the container if contiguous, a
+ * null pointer otherwise.
+ */
+[[nodiscard]] inline const void *meta_sequence_container::data() const noexcept {
+    return (data_fn != nullptr) ? data_fn(container) : nullptr;
+}
+
+/*! @copydoc data */
+[[nodiscard]] inline void *meta_sequence_container::data() noexcept {
+    return const_only ? nullptr : const_cast<void *>(std::as_const(*this).data());
 }
 
 /**
@@ -1798,7 +1964,7 @@ inline bool meta_sequence_container::resize(const size_type sz) {
  * @return True in case of success, false otherwise.
  */
 inline bool meta_sequence_container::clear() {
-    return !const_only && clear_fn(const_cast<void *>(data));
+    return !const_only && clear_fn(const_cast<void *>(container));
 }
 
 /**
@@ -1807,7 +1973,7 @@ inline bool meta_sequence_container::clear() {
  * @return True in case of success, false otherwise.
  */
 inline bool meta_sequence_container::reserve(const size_type sz) {
-    return !const_only && reserve_fn(const_cast<void *>(data), sz);
+    return !const_only && reserve_fn(const_cast<void *>(container), sz);
 }
 
 /**
@@ -1815,7 +1981,7 @@ inline bool meta_sequence_container::reserve(const size_type sz) {
  * @return An iterator to the first element of the container.
  */
 [[nodiscard]] inline meta_sequence_container::iterator meta_sequence_container::begin() {
-    return begin_fn(*ctx, const_only ? nullptr : const_cast<void *>(data), data);
+    return begin_fn(*ctx, const_only ? nullptr : const_cast<void *>(container), container);
 }
 
 /**
@@ -1823,7 +1989,7 @@ inline bool meta_sequence_container::reserve(const size_type sz) {
  * @return An iterator that is past the last element of the container.
  */
 [[nodiscard]] inline meta_sequence_container::iterator meta_sequence_container::end() {
-    return end_fn(*ctx, const_only ? nullptr : const_cast<void *>(data), data);
+    return end_fn(*ctx, const_only ? nullptr : const_cast<void *>(container), container);
 }
 
 /**
@@ -1834,9 +2000,9 @@ inline bool meta_sequence_container::reserve(const size_type sz) {
  */
 inline meta_sequence_container::iterator meta_sequence_container::insert(const iterator &it, meta_any value) {
     // this abomination is necessary because only on macos value_type and const_reference are different types for std::vector<bool>
-    if(const auto vtype = value_type_node(internal::meta_context::from(*ctx)); !const_only && (value.allow_cast({*ctx, vtype}) || value.allow_cast({*ctx, const_reference_node(internal::meta_context::from(*ctx))}))) {
+    if(const auto &vtype = value_type_node(internal::meta_context::from(*ctx)); !const_only && (value.allow_cast({*ctx, vtype}) || value.allow_cast({*ctx, const_reference_node(internal::meta_context::from(*ctx))}))) {
         const bool is_value_type = (value.type().info() == *vtype.info);
-        return insert_fn(*ctx, const_cast<void *>(data), is_value_type ? value.base().data() : nullptr, is_value_type ? nullptr : value.base().data(), it);
+        return insert_fn(*ctx, const_cast<void *>(container), is_value_type ? value.base().data() : nullptr, is_value_type ? nullptr : value.base().data(), it);
     }
 
     return iterator{};
@@ -1848,7 +2014,7 @@ inline meta_sequence_container::iterator meta_sequence_container::insert(const i
  * @return A possibly invalid iterator following the last removed element.
  */
 inline meta_sequence_container::iterator meta_sequence_container::erase(const iterator &it) {
-    return const_only ? iterator{} : erase_fn(*ctx, const_cast<void *>(data), it);
+    return const_only ? iterator{} : erase_fn(*ctx, const_cast<void *>(container), it);
 }
 
 /**
@@ -1867,7 +2033,7 @@ inline meta_sequence_container::iterator meta_sequence_container::erase(const it
  * @return False if the proxy is invalid, true otherwise.
  */
 [[nodiscard]] inline meta_sequence_container::operator bool() const noexcept {
-    return (data != nullptr);
+    return (container != nullptr);
 }
 
 /**
@@ -1,12 +1,16 @@
 #ifndef ENTT_META_NODE_HPP
 #define ENTT_META_NODE_HPP
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <type_traits>
 #include <utility>
 #include <vector>
 #include "../config/config.h"
+#include "../container/dense_map.hpp"
 #include "../core/attribute.h"
 #include "../core/bit.hpp"
 #include "../core/enum.hpp"
@@ -40,6 +44,7 @@ enum class meta_traits : std::uint32_t {
     is_pointer_like = 0x0200,
     is_sequence_container = 0x0400,
     is_associative_container = 0x0800,
+    is_trivially_copyable = 0x1000,
     _user_defined_traits = 0xFFFF,
     _entt_enum_as_bitmask = 0xFFFF
 };
@@ -69,7 +74,7 @@ struct meta_custom_node {
 
 struct meta_base_node {
     id_type type{};
-    meta_type_node (*resolve)(const meta_context &) noexcept {};
+    const meta_type_node &(*resolve)(const meta_context &) noexcept {};
     const void *(*cast)(const void *) noexcept {};
 };
 
@@ -98,11 +103,12 @@ struct meta_data_node {
     const char *name{};
     meta_traits traits{meta_traits::is_none};
     size_type arity{0u};
-    meta_type_node (*type)(const meta_context &) noexcept {};
+    const meta_type_node &(*type)(const meta_context &) noexcept {};
     meta_type (*arg)(const meta_ctx &, const size_type) noexcept {};
     bool (*set)(meta_handle, meta_any){};
     meta_any (*get)(meta_handle){};
     meta_custom_node custom{};
+    const void *(*address)(meta_handle){};
 };
 
 struct meta_func_node {
@@ -112,19 +118,42 @@ struct meta_func_node {
     const char *name{};
     meta_traits traits{meta_traits::is_none};
     size_type arity{0u};
-    meta_type_node (*ret)(const meta_context &) noexcept {};
+    const meta_type_node &(*ret)(const meta_context &) noexcept {};
     meta_type (*arg)(const meta_ctx &, const size_type) noexcept {};
     meta_any (*invoke)(meta_handle, meta_any *const){};
     std::shared_ptr<meta_func_node> next;
     meta_custom_node custom{};
+    id_type signature{};
+    void (*thunk)(){};
 };
 
 struct meta_template_node {
     using size_type = std::size_t;
 
     size_type arity{0u};
-    meta_type_node (*resolve)(const meta_context &) noexcept {};
-    meta_type_node (*arg)(const meta_context &, const size_type) noexcept {};
+    const meta_type_node &(*resolve)(const meta_context &) noexcept {};
+    const meta_type_node &(*arg)(const meta_context &, const size_type) noexcept {};
+};
+
+template<typename Type>
+struct meta_member_index {
+    std::atomic<std::size_t> generation{};
+    std::shared_mutex mutex{};
+    dense_map<id_type, Type *, identity> value{};
+};
+
+struct meta_cast_node {
+    std::vector<const void *(*)(const void *) noexcept> path;
+    const meta_type_node *type{};
+    const meta_conv_node *conv{};
+    double (*helper)(void *, const void *){};
+};
+
+struct meta_cast_cache {
+    std::size_t generation{};
+    std::shared_mutex mutex{};
+    dense_map<id_type, std::unique_ptr<meta_cast_node>, identity> cast{};
+    dense_map<id_type, std::unique_ptr<meta_cast_node>, identity> conv{};
 };
 
 struct meta_type_descriptor {
@@ -133,6 +162,9 @@ struct meta_type_descriptor {
     std::vector<meta_conv_node> conv;
     std::vector<meta_data_node> data;
     std::vector<meta_func_node> func;
+    meta_member_index<meta_data_node> data_index;
+    meta_member_index<meta_func_node> func_index;
+    meta_cast_cache cache;
 };
 
 struct meta_type_node {
@@ -143,11 +175,13 @@ struct meta_type_node {
     const char *name{};
     meta_traits traits{meta_traits::is_none};
     size_type size_of{0u};
-    meta_type_node (*resolve)(const meta_context &) noexcept {};
-    meta_type_node (*remove_pointer)(const meta_context &) noexcept {};
+    const meta_type_node &(*resolve)(const meta_context &) noexcept {};
+    const meta_type_node &(*remove_pointer)(const meta_context &) noexcept {};
     meta_any (*default_constructor)(const meta_ctx &){};
     double (*conversion_helper)(void *, const void *){};
     meta_any (*from_void)(const meta_ctx &, void *, const void *){};
+    void (*copy_n)(void *, const void *, const size_type){};
+    void (*destroy_n)(void *, const size_type){};
     meta_template_node templ{};
     meta_dtor_node dtor{};
     meta_custom_node custom{};
@@ -170,31 +204,60 @@ template<auto Member, typename Type, typename Value>
     return curr;
 }
 
+template<auto Member, typename Type>
+void flatten_members(const meta_context &context, const meta_type_node &node, dense_map<id_type, Type *, identity> &index) {
+    if(node.details) {
+        // members of derived classes shadow those of their bases
+        for(auto &&elem: node.details.get()->*Member) {
+            index.try_emplace(elem.id, &elem);
+        }
+
+        for(auto &&curr: node.details->base) {
+            flatten_members<Member>(context, curr.resolve(context), index);
+        }
+    }
+}
+
 template<auto Member>
 [[nodiscard]] auto *look_for(const meta_context &context, const meta_type_node &node, const id_type id) {
     using value_type = typename std::remove_reference_t<decltype((node.details.get()->*Member))>::value_type;
 
     if(node.details) {
-        if(auto *member = find_member<&value_type::id>((node.details.get()->*Member), id); member != nullptr) {
-            return member;
+        meta_member_index<value_type> *index{};
+
+        if constexpr(std::is_same_v<value_type, meta_data_node>) {
+            index = &node.details->data_index;
+        } else {
+            index = &node.details->func_index;
         }
 
-        for(auto &&curr: node.details->base) {
-            if(auto *elem = look_for<Member>(context, curr.resolve(context), id); elem) {
-                return elem;
+        // the index is built on first use and rebuilt after any change to the context
+        if(const auto curr = context.generation.load(std::memory_order_acquire); index->generation.load(std::memory_order_acquire) != curr) {
+            const std::lock_guard guard{index->mutex};
+
+            if(index->generation.load(std::memory_order_relaxed) != curr) {
+                index->value.clear();
+                flatten_members<Member>(context, node, index->value);
+                index->generation.store(curr, std::memory_order_release);
             }
         }
+
+        const std::shared_lock guard{index->mutex};
+
+        if(const auto it = index->value.find(id); it != index->value.end()) {
+            return it->second;
+        }
     }
 
     return static_cast<value_type *>(nullptr);
 }
 
 template<typename Type>
-meta_type_node resolve(const meta_context &) noexcept;
+const meta_type_node &resolve(const meta_context &) noexcept;
 
 template<typename... Args>
-[[nodiscard]] auto meta_arg_node(const meta_context &context, type_list<Args...>, [[maybe_unused]] const std::size_t index) noexcept {
-    meta_type_node (*value)(const meta_context &) noexcept = nullptr;
+[[nodiscard]] const meta_type_node &meta_arg_node(const meta_context &context, type_list<Args...>, [[maybe_unused]] const std::size_t index) noexcept {
+    const meta_type_node &(*value)(const meta_context &) noexcept = nullptr;
 
     if constexpr(sizeof...(Args) != 0u) {
         std::size_t pos{};
@@ -205,43 +268,132 @@ template<typename... Args>
     return value(context);
 }
 
-[[nodiscard]] inline const void *try_cast(const meta_context &context, const meta_type_node &from, const type_info &to, const void *instance) noexcept {
+template<auto Member, typename Func>
+[[nodiscard]] const meta_cast_node &find_cast_node(const meta_context &context, meta_cast_cache &cache, const id_type to, Func func) {
+    {
+        const std::shared_lock guard{cache.mutex};
+
+        if(cache.generation == context.generation) {
+            if(const auto it = (cache.*Member).find(to); it != (cache.*Member).end()) {
+                return *it->second;
+            }
+        }
+    }
+
+    auto elem = std::make_unique<meta_cast_node>();
+    func(*elem);
+
+    const std::lock_guard guard{cache.mutex};
+
+    // results depend on the bases and conversion functions registered so far
+    if(cache.generation != context.generation) {
+        cache.cast.clear();
+        cache.conv.clear();
+        cache.generation = context.generation;
+    }
+
+    return *(cache.*Member).try_emplace(to, std::move(elem)).first->second;
+}
+
+[[nodiscard]] inline bool search_cast(const meta_context &context, const meta_type_node &from, const type_info &to, meta_cast_node &elem) {
     if((from.info != nullptr) && *from.info == to) {
-        return instance;
+        elem.type = &from;
+        return true;
     }
 
     if(from.details) {
         for(auto &&curr: from.details->base) {
-            if(const void *elem = try_cast(context, curr.resolve(context), to, curr.cast(instance)); elem) {
-                return elem;
+            elem.path.push_back(curr.cast);
+
+            if(search_cast(context, curr.resolve(context), to, elem)) {
+                return true;
             }
+
+            elem.path.pop_back();
         }
     }
 
-    return nullptr;
+    return false;
 }
 
-template<typename Func>
-[[nodiscard]] inline auto try_convert(const meta_context &context, const meta_type_node &from, const type_info &to, const bool arithmetic_or_enum, const void *instance, Func func) {
+[[nodiscard]] inline bool search_conversion(const meta_context &context, const meta_type_node &from, const type_info &to, const bool arithmetic_or_enum, meta_cast_node &elem) {
     if(from.info && *from.info == to) {
-        return func(instance, from);
+        elem.type = &from;
+        return true;
     }
 
     if(from.details) {
-        for(auto &&elem: from.details->conv) {
-            if(elem.type == to.hash()) {
-                return func(instance, elem);
+        for(auto &&curr: from.details->conv) {
+            if(curr.type == to.hash()) {
+                elem.conv = &curr;
+                return true;
             }
         }
 
         for(auto &&curr: from.details->base) {
-            if(auto other = try_convert(context, curr.resolve(context), to, arithmetic_or_enum, curr.cast(instance), func); other) {
-                return other;
+            elem.path.push_back(curr.cast);
+
+            if(search_conversion(context, curr.resolve(context), to, arithmetic_or_enum, elem)) {
+                return true;
             }
+
+            elem.path.pop_back();
         }
     }
 
     if(from.conversion_helper && arithmetic_or_enum) {
+        elem.helper = from.conversion_helper;
+        return true;
+    }
+
+    return false;
+}
+
+[[nodiscard]] inline const void *try_cast(const meta_context &context, const meta_type_node &from, const type_info &to, const void *instance) noexcept {
+    if((from.info != nullptr) && *from.info == to) {
+        return instance;
+    }
+
+    if(from.details && !from.details->base.empty()) {
+        const auto &elem = find_cast_node<&meta_cast_cache::cast>(context, from.details->cache, to.hash(), [&](meta_cast_node &node) { static_cast<void>(search_cast(context, from, to, node)); });
+
+        if(elem.type != nullptr) {
+            for(auto *cast: elem.path) {
+                instance = cast(instance);
+            }
+
+            return instance;
+        }
+    }
+
+    return nullptr;
+}
+
+template<typename Func>
+[[nodiscard]] inline auto try_convert(const meta_context &context, const meta_type_node &from, const type_info &to, const bool arithmetic_or_enum, const void *instance, Func func) {
+    if(from.info && *from.info == to) {
+        return func(instance, from);
+    }
+
+    if(from.details) {
+        const auto &elem = find_cast_node<&meta_cast_cache::conv>(context, from.details->cache, to.hash(), [&](meta_cast_node &node) { static_cast<void>(search_conversion(context, from, to, arithmetic_or_enum, node)); });
+
+        for(auto *cast: elem.path) {
+            instance = cast(instance);
+        }
+
+        if(elem.type != nullptr) {
+            return func(instance, *elem.type);
+        }
+
+        if(elem.conv != nullptr) {
+            return func(instance, *elem.conv);
+        }
+
+        if(elem.helper != nullptr) {
+            return func(instance, elem.helper);
+        }
+    } else if(from.conversion_helper && arithmetic_or_enum) {
         return func(instance, from.conversion_helper);
     }
 
@@ -249,18 +401,62 @@ template<typename Func>
 }
 
 [[nodiscard]] inline const meta_type_node *try_resolve(const meta_context &context, const type_info &info) noexcept {
-    const auto it = context.value.find(info.hash());
-    return it != context.value.end() ? &it->second : nullptr;
+    if(const auto *table = context.published.load(std::memory_order_acquire); table != nullptr) {
+        const auto it = table->type.find(info.hash());
+        return it != table->type.end() ? it->second : nullptr;
+    }
+
+    return nullptr;
 }
 
-template<typename Type>
-[[nodiscard]] meta_type_node resolve(const meta_context &context) noexcept {
-    static_assert(std::is_same_v<Type, std::remove_const_t<std::remove_reference_t<Type>>>, "Invalid type");
+[[nodiscard]] inline const meta_type_node *try_resolve(const meta_context &context, const id_type id) noexcept {
+    if(const auto *table = context.published.load(std::memory_order_acquire); table != nullptr) {
+        const auto it = table->id.find(id);
+        return it != table->id.end() ? it->second : nullptr;
+    }
 
-    if(auto *elem = try_resolve(context, type_id<Type>()); elem) {
-        return *elem;
+    return nullptr;
+}
+
+inline void publish(meta_context &context) {
+    if(context.deferred != 0u) {
+        context.pending = true;
+        return;
+    }
+
+    auto table = std::make_unique<meta_context_table>();
+    table->type.reserve(context.value.size());
+    table->id.reserve(context.value.size());
+
+    for(auto &&[key, elem]: context.value) {
+        table->type.emplace(key, elem.get());
+        table->id.emplace(elem->id, elem.get());
     }
 
+    // previous tables are retired rather than destroyed, readers may still use them
+    context.tables.push_back(std::move(table));
+    context.published.store(context.tables.back().get(), std::memory_order_release);
+    context.pending = false;
+}
+
+inline void unpublish(meta_context &context, const id_type key, const id_type id) noexcept {
+    // types are reset while no one else uses the context, tables are updated in place
+    for(auto &&table: context.tables) {
+        table->type.erase(key);
+
+        if(const auto it = table->id.find(id); it != table->id.end() && it->second == context.value.find(key)->second.get()) {
+            table->id.erase(it);
+        }
+    }
+}
+
+[[nodiscard]] inline const meta_type_node &meta_null_node() noexcept {
+    static const meta_type_node node{};
+    return node;
+}
+
+template<typename Type>
+[[nodiscard]] meta_type_node make_meta_type_node() noexcept {
     meta_type_node node{
         &type_id<Type>(),
         type_id<Type>().hash(),
@@ -274,7 +470,8 @@ template<typename Type>
             | (std::is_pointer_v<Type> ? meta_traits::is_pointer : meta_traits::is_none)
             | (is_meta_pointer_like_v<Type> ? meta_traits::is_pointer_like : meta_traits::is_none)
             | (is_complete_v<meta_sequence_container_traits<Type>> ? meta_traits::is_sequence_container : meta_traits::is_none)
-            | (is_complete_v<meta_associative_container_traits<Type>> ? meta_traits::is_associative_container : meta_traits::is_none),
+            | (is_complete_v<meta_associative_container_traits<Type>> ? meta_traits::is_associative_container : meta_traits::is_none)
+            | (std::is_trivially_copyable_v<Type> ? meta_traits::is_trivially_copyable : meta_traits::is_none),
         size_of_v<Type>,
         &resolve<Type>,
         &resolve<std::remove_cv_t<std::remove_pointer_t<Type>>>};
@@ -310,16 +507,53 @@ template<typename Type>
         };
     }
 
+    if constexpr(!std::is_array_v<Type> && std::is_copy_constructible_v<Type>) {
+        node.copy_n = +[](void *buffer, const void *value, const std::size_t count) {
+            std::uninitialized_fill_n(static_cast<Type *>(buffer), count, *static_cast<const Type *>(value));
+        };
+    }
+
+    if constexpr(!std::is_array_v<Type> && std::is_destructible_v<Type> && !std::is_trivially_destructible_v<Type>) {
+        node.destroy_n = +[](void *buffer, const std::size_t count) {
+            std::destroy_n(static_cast<Type *>(buffer), count);
+        };
+    }
+
     if constexpr(is_complete_v<meta_template_traits<Type>>) {
         node.templ = meta_template_node{
             meta_template_traits<Type>::args_type::size,
             &resolve<typename meta_template_traits<Type>::class_type>,
-            +[](const meta_context &area, const std::size_t index) noexcept { return meta_arg_node(area, typename meta_template_traits<Type>::args_type{}, index); }};
+            +[](const meta_context &area, const std::size_t index) noexcept -> const meta_type_node & { return meta_arg_node(area, typename meta_template_traits<Type>::args_type{}, index); }};
     }
 
     return node;
 }
 
+template<typename Type>
+[[nodiscard]] const meta_type_node &meta_default_node() noexcept {
+    // types that aren't part of the context share a node that never changes
+    static const meta_type_node node = make_meta_type_node<Type>();
+    return node;
+}
+
+template<typename Type>
+[[nodiscard]] const meta_type_node &resolve(const meta_context &context) noexcept {
+    static_assert(std::is_same_v<Type, std::remove_const_t<std::remove_reference_t<Type>>>, "Invalid type");
+
+    if(auto *elem = try_resolve(context, type_id<Type>()); elem) {
+        return *elem;
+    }
+
+    return meta_default_node<Type>();
+}
+
+template<typename Type>
+[[nodiscard]] const meta_type_node &meta_factory_node(const meta_context &context) noexcept {
+    // factories run on the thread that updates the context and skip lookup tables
+    const auto it = context.value.find(type_id<Type>().hash());
+    return (it != context.value.cend()) ? *it->second : meta_default_node<Type>();
+}
+
 } // namespace internal
 /*! @endcond */
 
@@ -70,7 +70,7 @@ struct meta_range_iterator final {
 
     [[nodiscard]] constexpr reference operator[](const difference_type value) const noexcept {
         if constexpr(std::is_same_v<It, typename decltype(meta_context::value)::const_iterator>) {
-            return {it[value].first, Type{*ctx, it[value].second}};
+            return {it[value].first, Type{*ctx, *it[value].second}};
         } else if constexpr(std::is_same_v<typename std::iterator_traits<It>::value_type, meta_base_node>) {
             return {it[value].type, Type{*ctx, it[value]}};
         } else {
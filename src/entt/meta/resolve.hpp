@@ -58,13 +58,9 @@ template<typename Type>
  * @return The meta type associated with the given identifier, if any.
  */
 [[nodiscard]] inline meta_type resolve(const meta_ctx &ctx, const id_type id) noexcept {
-    for(auto &&curr: resolve(ctx)) {
-        if(curr.second.id() == id) {
-            return curr.second;
-        }
-    }
-
-    return meta_type{};
+    auto &&context = internal::meta_context::from(ctx);
+    const auto *elem = internal::try_resolve(context, id);
+    return (elem != nullptr) ? meta_type{ctx, *elem} : meta_type{};
 }
 
 /**
@@ -0,0 +1,498 @@
+#ifndef ENTT_META_SERIALIZER_HPP
+#define ENTT_META_SERIALIZER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/fwd.hpp"
+#include "../core/hashed_string.hpp"
+#include "../core/type_info.hpp"
+#include "../core/utility.hpp"
+#include "../locator/locator.hpp"
+#include "context.hpp"
+#include "fwd.hpp"
+#include "meta.hpp"
+#include "resolve.hpp"
+
+namespace entt {
+
+/**
+ * @brief Precompiled binary layout of a reflected type.
+ *
+ * Plans are compiled once per type and then used to stream any number of
+ * objects without looking up their data members again:
+ *
+ * * Trivially copyable types are copied as a whole.
+ * * Classes are flattened into their data members, base classes first.
+ *   Adjacent trivially copyable members are merged into a single copy.
+ * * Sequence containers are stored as their size followed by their elements,
+ *   each of them streamed with a nested plan.
+ *
+ * Only non-const data members registered as pointers to members take part in
+ * the layout. Static members, setters and getters are ignored.<br/>
+ * Data are written in the native format of the platform, they aren't meant to
+ * be exchanged between different architectures.
+ *
+ * The same layout is also used to hash and compare objects field-wise.
+ * Trivially copyable runs are hashed and compared as raw bytes. Therefore,
+ * their padding bytes (if any) must be initialized for results to be reliable.
+ */
+class meta_plan {
+    using length_type = std::uint64_t;
+
+    enum class step_kind : std::uint8_t {
+        copy,
+        sequence
+    };
+
+    struct step_type {
+        step_kind kind;
+        std::size_t offset;
+        std::size_t length;
+        std::size_t plan;
+        meta_type type;
+    };
+
+    [[nodiscard]] static std::uint64_t hash_bytes(const std::byte *first, std::size_t length, std::uint64_t seed) noexcept {
+        using params = internal::word_hash_params;
+        std::uint64_t word{};
+
+        for(; length >= sizeof(word); first += sizeof(word), length -= sizeof(word)) {
+            std::memcpy(&word, first, sizeof(word));
+            seed = internal::word_hash_mix(word ^ params::secret, seed);
+        }
+
+        if(length != 0u) {
+            word = {};
+            std::memcpy(&word, first, length);
+            seed = internal::word_hash_mix(word ^ params::secret, seed ^ length);
+        }
+
+        return seed;
+    }
+
+    void append(const std::size_t offset, const std::size_t length) {
+        if(!steps.empty() && steps.back().kind == step_kind::copy && (steps.back().offset + steps.back().length) == offset) {
+            steps.back().length += length;
+        } else {
+            steps.push_back(step_type{step_kind::copy, offset, length, 0u, meta_type{}});
+        }
+    }
+
+    void members(const meta_type &type, const meta_any &instance, const std::byte *root) {
+        for(auto &&base: type.base()) {
+            members(base.second, instance, root);
+        }
+
+        for(auto &&elem: type.data()) {
+            if(const auto &data = elem.second; !data.is_const() && !data.is_static()) {
+                if(const auto *addr = static_cast<const std::byte *>(data.address(instance)); addr) {
+                    flatten(data.type(), addr, root);
+                }
+            }
+        }
+    }
+
+    void flatten(const meta_type &type, const std::byte *instance, const std::byte *root) {
+        const auto offset = static_cast<std::size_t>(instance - root);
+
+        if(type.is_trivially_copyable()) {
+            append(offset, type.size_of());
+        } else if(type.is_sequence_container()) {
+            const auto value_type = type.from_void(static_cast<const void *>(instance)).as_sequence_container().value_type();
+            // contiguous containers of trivially copyable elements are copied in bulk
+            steps.push_back(step_type{step_kind::sequence, offset, value_type.is_trivially_copyable() ? value_type.size_of() : 0u, nested.size(), type});
+
+            if(value_type.is_trivially_copyable()) {
+                nested.emplace_back(value_type, nullptr);
+            } else {
+                const auto sample = value_type.construct();
+                ENTT_ASSERT(sample, "Elements must be default constructible");
+                nested.emplace_back(value_type, sample.base().data());
+            }
+        } else {
+            ENTT_ASSERT(type.data().begin() != type.data().end() || type.base().begin() != type.base().end(), "Unsupported type");
+            members(type, type.from_void(static_cast<const void *>(instance)), root);
+        }
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    meta_plan() = default;
+
+    /**
+     * @brief Compiles the plan for a given type.
+     * @param type A valid meta type.
+     * @param sample A valid instance of the given type, used to find the
+     * offsets of its data members. It can be a null pointer for trivially
+     * copyable types.
+     */
+    meta_plan(const meta_type &type, const void *sample)
+        : steps{},
+          nested{} {
+        ENTT_ASSERT(type, "Invalid type");
+        ENTT_ASSERT(sample != nullptr || type.is_trivially_copyable(), "Invalid sample");
+        const auto *root = static_cast<const std::byte *>(sample);
+        flatten(type, root, root);
+    }
+
+    /**
+     * @brief Returns the number of steps of the plan.
+     * @return Number of steps of the plan.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return steps.size();
+    }
+
+    /**
+     * @brief Hashes an object field-wise.
+     * @param instance A valid instance of the type of the plan.
+     * @param seed Optional seed, for example to chain multiple objects.
+     * @return The hash value of the object.
+     */
+    [[nodiscard]] std::uint64_t hash(const void *instance, std::uint64_t seed = internal::word_hash_params::seed) const {
+        const auto *root = static_cast<const std::byte *>(instance);
+
+        for(auto &&curr: steps) {
+            if(curr.kind == step_kind::copy) {
+                seed = hash_bytes(root + curr.offset, curr.length, seed);
+            } else {
+                auto container = curr.type.from_void(static_cast<const void *>(root + curr.offset)).as_sequence_container();
+                seed = internal::word_hash_mix(static_cast<std::uint64_t>(container.size()) ^ internal::word_hash_params::secret, seed);
+
+                if(const auto *elems = static_cast<const std::byte *>(std::as_const(container).data()); elems && curr.length != 0u) {
+                    seed = hash_bytes(elems, container.size() * curr.length, seed);
+                } else {
+                    for(auto &&elem: container) {
+                        seed = nested[curr.plan].hash(elem.base().data(), seed);
+                    }
+                }
+            }
+        }
+
+        return seed;
+    }
+
+    /**
+     * @brief Compares two objects field-wise.
+     * @param lhs A valid instance of the type of the plan.
+     * @param rhs A valid instance of the type of the plan.
+     * @return True if the objects are equal, false otherwise.
+     */
+    [[nodiscard]] bool equal(const void *lhs, const void *rhs) const {
+        const auto *left = static_cast<const std::byte *>(lhs);
+        const auto *right = static_cast<const std::byte *>(rhs);
+
+        for(auto &&curr: steps) {
+            if(curr.kind == step_kind::copy) {
+                if(std::memcmp(left + curr.offset, right + curr.offset, curr.length) != 0) {
+                    return false;
+                }
+            } else {
+                auto first = curr.type.from_void(static_cast<const void *>(left + curr.offset)).as_sequence_container();
+                auto second = curr.type.from_void(static_cast<const void *>(right + curr.offset)).as_sequence_container();
+
+                if(first.size() != second.size()) {
+                    return false;
+                }
+
+                const auto *lelems = static_cast<const std::byte *>(std::as_const(first).data());
+                const auto *relems = static_cast<const std::byte *>(std::as_const(second).data());
+
+                if(lelems && relems && curr.length != 0u) {
+                    if(first.size() != 0u && std::memcmp(lelems, relems, first.size() * curr.length) != 0) {
+                        return false;
+                    }
+                } else {
+                    for(auto lit = first.begin(), rit = second.begin(), last = first.end(); lit != last; ++lit, ++rit) {
+                        if(!nested[curr.plan].equal((*lit).base().data(), (*rit).base().data())) {
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Appends an object to a buffer.
+     * @param instance A valid instance of the type of the plan.
+     * @param buffer The buffer to which to append the object.
+     */
+    void write(const void *instance, std::vector<std::byte> &buffer) const {
+        const auto *root = static_cast<const std::byte *>(instance);
+
+        for(auto &&curr: steps) {
+            if(curr.kind == step_kind::copy) {
+                buffer.insert(buffer.end(), root + curr.offset, root + curr.offset + curr.length);
+            } else {
+                auto container = curr.type.from_void(static_cast<const void *>(root + curr.offset)).as_sequence_container();
+                const auto length = static_cast<length_type>(container.size());
+                const auto *first = reinterpret_cast<const std::byte *>(&length);
+                buffer.insert(buffer.end(), first, first + sizeof(length));
+
+                if(const auto *elems = static_cast<const std::byte *>(std::as_const(container).data()); elems && curr.length != 0u) {
+                    buffer.insert(buffer.end(), elems, elems + container.size() * curr.length);
+                } else {
+                    for(auto &&elem: container) {
+                        nested[curr.plan].write(elem.base().data(), buffer);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Reads an object from a buffer.
+     * @param instance A valid instance of the type of the plan to overwrite.
+     * @param first Pointer to the first byte to read.
+     * @param last Pointer to one past the last byte available.
+     * @return Pointer to the first byte not consumed.
+     */
+    const std::byte *read(void *instance, const std::byte *first, [[maybe_unused]] const std::byte *last) const {
+        auto *root = static_cast<std::byte *>(instance);
+
+        for(auto &&curr: steps) {
+            if(curr.kind == step_kind::copy) {
+                ENTT_ASSERT(static_cast<size_type>(last - first) >= curr.length, "Not enough data");
+                std::memcpy(root + curr.offset, first, curr.length);
+                first += curr.length;
+            } else {
+                length_type length{};
+                ENTT_ASSERT(static_cast<size_type>(last - first) >= sizeof(length), "Not enough data");
+                std::memcpy(&length, first, sizeof(length));
+                first += sizeof(length);
+
+                auto wrapper = curr.type.from_void(static_cast<void *>(root + curr.offset));
+                auto container = wrapper.as_sequence_container();
+                [[maybe_unused]] const bool resized = container.resize(static_cast<size_type>(length));
+                ENTT_ASSERT(resized || container.size() == length, "Invalid size");
+
+                if(auto *elems = container.data(); elems && curr.length != 0u) {
+                    const auto bytes = container.size() * curr.length;
+                    ENTT_ASSERT(static_cast<size_type>(last - first) >= bytes, "Not enough data");
+                    std::memcpy(elems, first, bytes);
+                    first += bytes;
+                } else {
+                    for(auto &&elem: container) {
+                        ENTT_ASSERT(elem.base().policy() == any_policy::ref, "Unexpected policy");
+                        first = nested[curr.plan].read(const_cast<void *>(elem.base().data()), first, last);
+                    }
+                }
+            }
+        }
+
+        return first;
+    }
+
+private:
+    std::vector<step_type> steps;
+    std::vector<meta_plan> nested;
+};
+
+/**
+ * @brief Field-wise hashing and comparison of objects through their reflected
+ * layout.
+ *
+ * Plans are compiled the first time an object of a given type is met and are
+ * reused for all following objects of the same type. This makes hashers
+ * suitable for detecting changes between snapshots or desyncs between peers.
+ *
+ * @sa meta_plan
+ */
+class meta_hasher {
+    [[nodiscard]] const meta_plan &plan(const meta_any &value) {
+        const auto type = value.type();
+        ENTT_ASSERT(type, "Invalid type");
+
+        if(auto it = plans.find(type.id()); it != plans.end()) {
+            return it->second;
+        }
+
+        return plans.emplace(type.id(), meta_plan{type, value.base().data()}).first->second;
+    }
+
+public:
+    /*! @brief Default constructor. */
+    meta_hasher() = default;
+
+    /**
+     * @brief Hashes an object field-wise.
+     * @param value A valid object.
+     * @param seed Optional seed, for example to chain multiple objects.
+     * @return The hash value of the object.
+     */
+    [[nodiscard]] std::uint64_t hash(const meta_any &value, const std::uint64_t seed = internal::word_hash_params::seed) {
+        return plan(value).hash(value.base().data(), seed);
+    }
+
+    /**
+     * @brief Compares two objects field-wise.
+     * @param lhs A valid object.
+     * @param rhs A valid object.
+     * @return True if the objects have the same type and are equal, false
+     * otherwise.
+     */
+    [[nodiscard]] bool equal(const meta_any &lhs, const meta_any &rhs) {
+        return (lhs.type() == rhs.type()) && plan(lhs).equal(lhs.base().data(), rhs.base().data());
+    }
+
+    /**
+     * @brief Returns the number of plans compiled so far.
+     * @return Number of plans compiled so far.
+     */
+    [[nodiscard]] std::size_t size() const noexcept {
+        return plans.size();
+    }
+
+private:
+    dense_map<id_type, meta_plan, identity> plans;
+};
+
+/**
+ * @brief Output archive that streams objects through their reflected layout.
+ *
+ * Plans are compiled the first time an object of a given type is written and
+ * are reused for all following objects of the same type.<br/>
+ * This class is meant to be used with snapshots, although it's a general
+ * purpose archive.
+ */
+class meta_output_archive {
+public:
+    /**
+     * @brief Constructs an archive for a given buffer.
+     * @param buffer The buffer to which to append objects.
+     */
+    meta_output_archive(std::vector<std::byte> &buffer)
+        : meta_output_archive{locator<meta_ctx>::value_or(), buffer} {}
+
+    /**
+     * @brief Context aware constructor.
+     * @param area The context from which to search for meta types.
+     * @param buffer The buffer to which to append objects.
+     */
+    meta_output_archive(const meta_ctx &area, std::vector<std::byte> &buffer)
+        : plans{},
+          storage{&buffer},
+          ctx{&area} {}
+
+    /**
+     * @brief Appends an object to the buffer.
+     * @tparam Type Type of object to write.
+     * @param value The object to write.
+     */
+    template<typename Type>
+    void operator()(const Type &value) {
+        if(auto it = plans.find(type_id<Type>().hash()); it != plans.end()) {
+            it->second.write(&value, *storage);
+        } else {
+            plans.emplace(type_id<Type>().hash(), meta_plan{resolve<Type>(*ctx), &value}).first->second.write(&value, *storage);
+        }
+    }
+
+    /**
+     * @brief Appends a block of raw bytes to the buffer.
+     *
+     * Snapshots use this function to store trivially copyable elements in
+     * bulk, without going through their plans.
+     *
+     * @param value A pointer to the first byte to write.
+     * @param length The number of bytes to write.
+     */
+    void write(const void *value, const std::size_t length) {
+        const auto *from = static_cast<const std::byte *>(value);
+        storage->insert(storage->end(), from, from + length);
+    }
+
+private:
+    dense_map<id_type, meta_plan, identity> plans;
+    std::vector<std::byte> *storage;
+    const meta_ctx *ctx;
+};
+
+/**
+ * @brief Input archive that streams objects through their reflected layout.
+ *
+ * Objects are overwritten in place. Therefore, they must be valid instances of
+ * their type before they are read.<br/>
+ * This class is meant to be used with snapshot loaders, although it's a
+ * general purpose archive.
+ */
+class meta_input_archive {
+public:
+    /**
+     * @brief Constructs an archive for a given range of bytes.
+     * @param from Pointer to the first byte to read.
+     * @param to Pointer to one past the last byte available.
+     */
+    meta_input_archive(const std::byte *from, const std::byte *to)
+        : meta_input_archive{locator<meta_ctx>::value_or(), from, to} {}
+
+    /**
+     * @brief Context aware constructor.
+     * @param area The context from which to search for meta types.
+     * @param from Pointer to the first byte to read.
+     * @param to Pointer to one past the last byte available.
+     */
+    meta_input_archive(const meta_ctx &area, const std::byte *from, const std::byte *to)
+        : plans{},
+          first{from},
+          last{to},
+          ctx{&area} {}
+
+    /**
+     * @brief Reads an object from the buffer.
+     * @tparam Type Type of object to read.
+     * @param value The object to overwrite.
+     */
+    template<typename Type>
+    void operator()(Type &value) {
+        if(auto it = plans.find(type_id<Type>().hash()); it != plans.end()) {
+            first = it->second.read(&value, first, last);
+        } else {
+            first = plans.emplace(type_id<Type>().hash(), meta_plan{resolve<Type>(*ctx), &value}).first->second.read(&value, first, last);
+        }
+    }
+
+    /**
+     * @brief Reads a block of raw bytes from the buffer.
+     *
+     * Snapshot loaders use this function to restore trivially copyable
+     * elements in bulk, without going through their plans.
+     *
+     * @param value A pointer to the first byte to overwrite.
+     * @param length The number of bytes to read.
+     */
+    void read(void *value, const std::size_t length) {
+        ENTT_ASSERT(size() >= length, "Not enough data");
+        std::memcpy(value, first, length);
+        first += length;
+    }
+
+    /**
+     * @brief Returns the number of bytes not yet read.
+     * @return Number of bytes not yet read.
+     */
+    [[nodiscard]] std::size_t size() const noexcept {
+        return static_cast<std::size_t>(last - first);
+    }
+
+private:
+    dense_map<id_type, meta_plan, identity> plans;
+    const std::byte *first;
+    const std::byte *last;
+    const meta_ctx *ctx;
+};
+
+} // namespace entt
+
+#endif
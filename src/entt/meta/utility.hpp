@@ -226,6 +226,43 @@ template<typename Type, typename Policy, typename Candidate, std::size_t... Inde
     return meta_any{meta_ctx_arg, instance->context()};
 }
 
+template<typename>
+struct meta_signature;
+
+template<typename Ret, typename... Args>
+struct meta_signature<Ret (*)(Args...)> {
+    using type = Ret(Args...);
+};
+
+template<typename Ret, typename... Args>
+struct meta_signature<Ret (*)(Args...) noexcept>: meta_signature<Ret (*)(Args...)> {};
+
+template<typename Ret, typename Class, typename... Args>
+struct meta_signature<Ret (Class::*)(Args...)> {
+    using type = Ret(Class &, Args...);
+};
+
+template<typename Ret, typename Class, typename... Args>
+struct meta_signature<Ret (Class::*)(Args...) noexcept>: meta_signature<Ret (Class::*)(Args...)> {};
+
+template<typename Ret, typename Class, typename... Args>
+struct meta_signature<Ret (Class::*)(Args...) const> {
+    using type = Ret(const Class &, Args...);
+};
+
+template<typename Ret, typename Class, typename... Args>
+struct meta_signature<Ret (Class::*)(Args...) const noexcept>: meta_signature<Ret (Class::*)(Args...) const> {};
+
+template<auto, typename>
+struct meta_thunk;
+
+template<auto Candidate, typename Ret, typename... Args>
+struct meta_thunk<Candidate, Ret(Args...)> {
+    static Ret invoke(Args... args) {
+        return std::invoke(Candidate, std::forward<Args>(args)...);
+    }
+};
+
 template<typename Type, typename... Args, std::size_t... Index>
 [[nodiscard]] meta_any meta_construct(const meta_ctx &ctx, meta_any *const args, std::index_sequence<Index...>) {
     // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) - waiting for C++20 (and std::span)
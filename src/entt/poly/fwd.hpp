@@ -16,6 +16,17 @@ class basic_poly;
 template<typename Concept>
 using poly = basic_poly<Concept>;
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+template<typename, std::size_t Len = sizeof(double[2]), std::size_t = alignof(double[2])>
+class basic_poly_collection;
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Concept Concept descriptor.
+ */
+template<typename Concept>
+using poly_collection = basic_poly_collection<Concept>;
+
 } // namespace entt
 
 #endif
@@ -6,6 +6,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../core/any.hpp"
 #include "../core/type_info.hpp"
 #include "../core/type_traits.hpp"
@@ -13,6 +14,19 @@
 
 namespace entt {
 
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+template<typename Concept, typename = void>
+struct poly_inline_vtable: std::false_type {};
+
+template<typename Concept>
+struct poly_inline_vtable<Concept, std::enable_if_t<Concept::inline_vtable>>
+    : std::true_type {};
+
+} // namespace internal
+/*! @endcond */
+
 /*! @brief Inspector class used to infer the type of the virtual table. */
 struct poly_inspector {
     /**
@@ -39,6 +53,13 @@ struct poly_inspector {
 
 /**
  * @brief Static virtual table factory.
+ *
+ * Virtual tables with a single function are stored as plain function pointers.
+ * Other virtual tables are shared and referred to by pointer, unless the
+ * concept exposes a `static constexpr bool inline_vtable = true;` member. In
+ * this case, poly objects embed a copy of all function pointers and invoking
+ * them requires one indirection less.
+ *
  * @tparam Concept Concept descriptor.
  * @tparam Len Size of the storage reserved for the small buffer optimization.
  * @tparam Align Alignment requirement.
@@ -98,10 +119,11 @@ class poly_vtable {
 
     using vtable_type = decltype(make_vtable(Concept{}));
     static constexpr bool is_mono = std::tuple_size_v<vtable_type> == 1u;
+    static constexpr bool is_inline = internal::poly_inline_vtable<Concept>::value;
 
 public:
     /*! @brief Virtual table type. */
-    using type = std::conditional_t<is_mono, std::tuple_element_t<0u, vtable_type>, const vtable_type *>;
+    using type = std::conditional_t<is_mono, std::tuple_element_t<0u, vtable_type>, std::conditional_t<is_inline, vtable_type, const vtable_type *>>;
 
     /**
      * @brief Returns a static virtual table for a specific concept and type.
@@ -115,6 +137,8 @@ public:
 
         if constexpr(is_mono) {
             return std::get<0>(vtable);
+        } else if constexpr(is_inline) {
+            return vtable;
         } else {
             return &vtable;
         }
@@ -141,8 +165,10 @@ struct poly_base {
 
         if constexpr(std::is_function_v<std::remove_pointer_t<decltype(poly.vtable)>>) {
             return poly.vtable(poly.storage, std::forward<Args>(args)...);
-        } else {
+        } else if constexpr(std::is_pointer_v<decltype(poly.vtable)>) {
             return std::get<Member>(*poly.vtable)(poly.storage, std::forward<Args>(args)...);
+        } else {
+            return std::get<Member>(poly.vtable)(poly.storage, std::forward<Args>(args)...);
         }
     }
 
@@ -154,8 +180,10 @@ struct poly_base {
         if constexpr(std::is_function_v<std::remove_pointer_t<decltype(poly.vtable)>>) {
             static_assert(Member == 0u, "Unknown member");
             return poly.vtable(poly.storage, std::forward<Args>(args)...);
-        } else {
+        } else if constexpr(std::is_pointer_v<decltype(poly.vtable)>) {
             return std::get<Member>(*poly.vtable)(poly.storage, std::forward<Args>(args)...);
+        } else {
+            return std::get<Member>(poly.vtable)(poly.storage, std::forward<Args>(args)...);
         }
     }
 };
@@ -311,6 +339,152 @@ private:
     vtable_type vtable{};
 };
 
+/**
+ * @brief Collection of poly objects grouped by concrete type.
+ *
+ * Objects of the same type are stored next to each other in a dedicated
+ * segment and share a single virtual table. Invoking a function on all of them
+ * runs a tight loop over each segment, with the same target for all elements
+ * of a segment rather than an unpredictable sequence of indirect calls.
+ *
+ * @warning
+ * Objects are stored in place only if they fit the small buffer. Larger objects
+ * are still grouped by type but dynamically allocated.
+ *
+ * @tparam Concept Concept descriptor.
+ * @tparam Len Size of the storage reserved for the small buffer optimization.
+ * @tparam Align Alignment requirement.
+ */
+template<typename Concept, std::size_t Len, std::size_t Align>
+class basic_poly_collection {
+    using any_type = basic_any<Len, Align>;
+
+    template<std::size_t Member, typename Vtable>
+    [[nodiscard]] static auto entry(const Vtable &vtable) noexcept {
+        if constexpr(std::is_function_v<std::remove_pointer_t<Vtable>>) {
+            static_assert(Member == 0u, "Unknown member");
+            return vtable;
+        } else if constexpr(std::is_pointer_v<Vtable>) {
+            return std::get<Member>(*vtable);
+        } else {
+            return std::get<Member>(vtable);
+        }
+    }
+
+    struct segment {
+        const type_info *info;
+        typename poly_vtable<Concept, Len, Align>::type vtable;
+        std::vector<any_type> elements;
+    };
+
+    template<typename Type>
+    [[nodiscard]] segment &assure() {
+        for(auto &&curr: segments) {
+            if(*curr.info == type_id<Type>()) {
+                return curr;
+            }
+        }
+
+        return segments.emplace_back(segment{&type_id<Type>(), poly_vtable<Concept, Len, Align>::template instance<Type>(), {}});
+    }
+
+public:
+    /*! @brief Poly type. */
+    using poly_type = basic_poly<Concept, Len, Align>;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Creates a new object in the segment of its type.
+     * @tparam Type Type of object to create.
+     * @tparam Args Types of arguments to use to construct the new instance.
+     * @param args Parameters to use to construct the instance.
+     * @return A reference to the newly created object.
+     */
+    template<typename Type, typename... Args>
+    Type &emplace(Args &&...args) {
+        static_assert(std::is_same_v<Type, std::decay_t<Type>>, "Type differs from its decayed form");
+        auto &elem = assure<Type>().elements.emplace_back(std::in_place_type<Type>, std::forward<Args>(args)...);
+        return any_cast<Type &>(elem);
+    }
+
+    /**
+     * @brief Invokes a function of the concept on all objects, one segment at
+     * a time.
+     * @tparam Member Index of the function to invoke.
+     * @tparam Args Types of arguments to pass to the function.
+     * @param args The arguments to pass to the function.
+     */
+    template<std::size_t Member, typename... Args>
+    void for_each(Args &&...args) {
+        for(auto &&curr: segments) {
+            const auto func = entry<Member>(curr.vtable);
+
+            for(auto &&elem: curr.elements) {
+                func(elem, args...);
+            }
+        }
+    }
+
+    /*! @copydoc for_each */
+    template<std::size_t Member, typename... Args>
+    void for_each(Args &&...args) const {
+        for(auto &&curr: segments) {
+            const auto func = entry<Member>(curr.vtable);
+
+            for(auto &&elem: curr.elements) {
+                func(elem, args...);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of objects in the collection.
+     * @return Number of objects in the collection.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        size_type len{};
+
+        for(auto &&curr: segments) {
+            len += curr.elements.size();
+        }
+
+        return len;
+    }
+
+    /**
+     * @brief Returns the number of objects of a given type.
+     * @tparam Type Type of objects to count.
+     * @return Number of objects of the given type.
+     */
+    template<typename Type>
+    [[nodiscard]] size_type size() const noexcept {
+        for(auto &&curr: segments) {
+            if(*curr.info == type_id<Type>()) {
+                return curr.elements.size();
+            }
+        }
+
+        return size_type{};
+    }
+
+    /**
+     * @brief Checks whether the collection is empty.
+     * @return True if the collection is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return (size() == 0u);
+    }
+
+    /*! @brief Destroys all objects and releases all segments. */
+    void clear() {
+        segments.clear();
+    }
+
+private:
+    std::vector<segment> segments;
+};
+
 } // namespace entt
 
 #endif
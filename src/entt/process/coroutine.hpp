@@ -0,0 +1,499 @@
+#ifndef ENTT_PROCESS_COROUTINE_HPP
+#define ENTT_PROCESS_COROUTINE_HPP
+
+#include "../config/config.h"
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#    include <cstddef>
+#    include <cstdint>
+#    include <coroutine>
+#    include <exception>
+#    include <memory>
+#    include <new>
+#    include <optional>
+#    include <type_traits>
+#    include <utility>
+#    include "fwd.hpp"
+#    include "process.hpp"
+
+namespace entt {
+
+/**
+ * @brief Awaitable that suspends a coroutine until the next tick.
+ *
+ * Use the `next_frame` constant rather than creating instances of this type.
+ */
+struct next_frame_t {};
+
+/*! @brief Suspends a coroutine until the next tick. */
+inline constexpr next_frame_t next_frame{};
+
+/**
+ * @brief Awaitable that suspends a coroutine for a given amount of time.
+ *
+ * The coroutine is resumed during the tick that exhausts the delay.
+ *
+ * @tparam Delta Type used to provide elapsed time.
+ */
+template<typename Delta>
+struct delay {
+    /*! @brief Time to wait. */
+    Delta value;
+};
+
+/**
+ * @brief Deduction guide.
+ * @tparam Delta Type used to provide elapsed time.
+ */
+template<typename Delta>
+delay(Delta) -> delay<Delta>;
+
+/**
+ * @brief Awaitable that suspends a coroutine until a value is published.
+ *
+ * Waiting coroutines are resumed during the first tick that follows a call to
+ * `publish`. The value is then returned from the `co_await` expression and
+ * consumed, so that only one coroutine receives it.
+ *
+ * @tparam Type Type of values to publish.
+ */
+template<typename Type>
+class co_event {
+public:
+    /*! @brief Type of values to publish. */
+    using value_type = Type;
+
+    /**
+     * @brief Publishes a value, replacing the pending one, if any.
+     * @tparam Args Types of arguments to use to construct the value.
+     * @param args Parameters to use to construct the value.
+     */
+    template<typename... Args>
+    void publish(Args &&...args) {
+        pending.emplace(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Checks if there is a value waiting to be consumed.
+     * @return True if there is a pending value, false otherwise.
+     */
+    [[nodiscard]] bool ready() const noexcept {
+        return pending.has_value();
+    }
+
+    /**
+     * @brief Consumes the pending value.
+     * @return The pending value.
+     */
+    [[nodiscard]] Type take() {
+        ENTT_ASSERT(pending, "No pending value");
+        Type value = std::move(*pending);
+        pending.reset();
+        return value;
+    }
+
+    /*! @brief Discards the pending value, if any. */
+    void reset() noexcept {
+        pending.reset();
+    }
+
+private:
+    std::optional<Type> pending{};
+};
+
+/**
+ * @brief Return type of coroutines to run as processes.
+ *
+ * Coroutines start suspended and are resumed by the process that owns them,
+ * once per tick at most. Frames are allocated with the allocator that follows
+ * an `std::allocator_arg` tag in the parameter list, if any, or with the global
+ * allocator otherwise.
+ *
+ * @tparam Delta Type used to provide elapsed time.
+ */
+template<typename Delta>
+class basic_coroutine {
+    enum class wait_type : std::uint8_t {
+        frame,
+        delay,
+        event
+    };
+
+    struct alignas(std::max_align_t) block_type {
+        std::byte data[alignof(std::max_align_t)];
+    };
+
+    using release_type = void (*)(void *, std::size_t) noexcept;
+
+    [[nodiscard]] static constexpr std::size_t padded(const std::size_t size) noexcept {
+        return ((size + sizeof(block_type) - 1u) / sizeof(block_type)) * sizeof(block_type);
+    }
+
+    template<typename Allocator>
+    [[nodiscard]] static constexpr std::size_t blocks(const std::size_t size) noexcept {
+        return (padded(size) + padded(sizeof(release_type)) + padded(sizeof(Allocator))) / sizeof(block_type);
+    }
+
+    template<typename Allocator>
+    static void release(void *ptr, const std::size_t size) noexcept {
+        auto *allocator = std::launder(reinterpret_cast<Allocator *>(static_cast<std::byte *>(ptr) + padded(size) + padded(sizeof(release_type))));
+        Allocator copy{std::move(*allocator)};
+        allocator->~Allocator();
+        copy.deallocate(static_cast<block_type *>(ptr), blocks<Allocator>(size));
+    }
+
+    template<typename Other>
+    [[nodiscard]] static void *allocate(const std::size_t size, const Other &other) {
+        using allocator_type = typename std::allocator_traits<Other>::template rebind_alloc<block_type>;
+        static_assert(alignof(allocator_type) <= alignof(block_type), "Unsupported allocator");
+
+        allocator_type allocator{other};
+        auto *ptr = reinterpret_cast<std::byte *>(allocator.allocate(blocks<allocator_type>(size)));
+        ::new(ptr + padded(size)) release_type{&release<allocator_type>};
+        ::new(ptr + padded(size) + padded(sizeof(release_type))) allocator_type{std::move(allocator)};
+        return ptr;
+    }
+
+public:
+    /*! @brief Type used to provide elapsed time. */
+    using delta_type = Delta;
+
+    /*! @brief Promise type required by the language. */
+    struct promise_type {
+        /**
+         * @brief Allocates a frame with the global allocator.
+         * @param size The size of the frame in bytes.
+         * @return A pointer to the frame.
+         */
+        [[nodiscard]] static void *operator new(const std::size_t size) {
+            return allocate(size, std::allocator<void>{});
+        }
+
+        /**
+         * @brief Allocates a frame with a given allocator.
+         * @tparam Allocator Type of allocator.
+         * @tparam Args Types of the other parameters of the coroutine.
+         * @param size The size of the frame in bytes.
+         * @param allocator The allocator to use.
+         * @return A pointer to the frame.
+         */
+        template<typename Allocator, typename... Args>
+        [[nodiscard]] static void *operator new(const std::size_t size, std::allocator_arg_t, const Allocator &allocator, const Args &...) {
+            return allocate(size, allocator);
+        }
+
+        /**
+         * @brief Returns a frame to the allocator it was obtained from.
+         * @param ptr A pointer to the frame.
+         * @param size The size of the frame in bytes.
+         */
+        static void operator delete(void *ptr, const std::size_t size) noexcept {
+            (*std::launder(reinterpret_cast<release_type *>(static_cast<std::byte *>(ptr) + padded(size))))(ptr, size);
+        }
+
+        /**
+         * @brief Returns the coroutine object.
+         * @return The coroutine object.
+         */
+        [[nodiscard]] basic_coroutine get_return_object() noexcept {
+            return basic_coroutine{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        /**
+         * @brief Coroutines start suspended.
+         * @return An awaitable that always suspends.
+         */
+        [[nodiscard]] std::suspend_always initial_suspend() const noexcept {
+            return {};
+        }
+
+        /**
+         * @brief Coroutines are destroyed by their owners.
+         * @return An awaitable that always suspends.
+         */
+        [[nodiscard]] std::suspend_always final_suspend() const noexcept {
+            return {};
+        }
+
+        /*! @brief Coroutines don't return values. */
+        void return_void() const noexcept {}
+
+        /*! @brief Exceptions are propagated to the caller of the process. */
+        [[noreturn]] void unhandled_exception() const {
+            std::rethrow_exception(std::current_exception());
+        }
+
+        /**
+         * @brief Suspends a coroutine until the next tick.
+         * @return An awaitable that always suspends.
+         */
+        [[nodiscard]] std::suspend_always await_transform(next_frame_t) noexcept {
+            wait = wait_type::frame;
+            return {};
+        }
+
+        /**
+         * @brief Suspends a coroutine for a given amount of time.
+         * @tparam Type Type used to express the delay.
+         * @param value Time to wait.
+         * @return An awaitable that always suspends.
+         */
+        template<typename Type>
+        [[nodiscard]] std::suspend_always await_transform(const delay<Type> value) noexcept {
+            wait = wait_type::delay;
+            remaining = static_cast<delta_type>(value.value);
+            return {};
+        }
+
+        /**
+         * @brief Suspends a coroutine until a value is published.
+         * @tparam Type Type of values to publish.
+         * @param elem The event to wait for.
+         * @return An awaitable that returns the published value.
+         */
+        template<typename Type>
+        [[nodiscard]] auto await_transform(co_event<Type> &elem) noexcept {
+            struct awaitable {
+                [[nodiscard]] bool await_ready() const noexcept {
+                    return false;
+                }
+
+                void await_suspend(std::coroutine_handle<>) const noexcept {}
+
+                [[nodiscard]] Type await_resume() const {
+                    return target->take();
+                }
+
+                co_event<Type> *target;
+            };
+
+            wait = wait_type::event;
+            event = &elem;
+            check = +[](const void *value) noexcept { return static_cast<const co_event<Type> *>(value)->ready(); };
+
+            return awaitable{&elem};
+        }
+
+        /**
+         * @brief Checks if a coroutine can be resumed.
+         * @param delta Elapsed time.
+         * @return True if the coroutine can be resumed, false otherwise.
+         */
+        [[nodiscard]] bool ready(const delta_type delta) noexcept {
+            switch(wait) {
+            case wait_type::delay:
+                if(remaining > delta) {
+                    remaining -= delta;
+                    return false;
+                }
+
+                remaining = {};
+                return true;
+            case wait_type::event:
+                return check(event);
+            default:
+                return true;
+            }
+        }
+
+        /**
+         * @brief Hands the pending delay, if any, over to the caller.
+         * @return The time left to wait, if any.
+         */
+        [[nodiscard]] delta_type handover() noexcept {
+            if(wait == wait_type::delay) {
+                wait = wait_type::frame;
+                return std::exchange(remaining, delta_type{});
+            }
+
+            return delta_type{};
+        }
+
+    private:
+        wait_type wait{wait_type::frame};
+        delta_type remaining{};
+        const void *event{};
+        bool (*check)(const void *) noexcept {};
+    };
+
+    /*! @brief Default constructor. */
+    basic_coroutine() noexcept = default;
+
+    /**
+     * @brief Constructs a coroutine object from a handle.
+     * @param ref A valid coroutine handle.
+     */
+    explicit basic_coroutine(std::coroutine_handle<promise_type> ref) noexcept
+        : handle{ref} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_coroutine(const basic_coroutine &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_coroutine(basic_coroutine &&other) noexcept
+        : handle{std::exchange(other.handle, nullptr)} {}
+
+    /*! @brief Destroys the coroutine frame, if any. */
+    ~basic_coroutine() {
+        if(handle) {
+            handle.destroy();
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This coroutine object.
+     */
+    basic_coroutine &operator=(const basic_coroutine &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This coroutine object.
+     */
+    basic_coroutine &operator=(basic_coroutine &&other) noexcept {
+        basic_coroutine{std::move(other)}.swap(*this);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given coroutine object.
+     * @param other Coroutine object to exchange the content with.
+     */
+    void swap(basic_coroutine &other) noexcept {
+        std::swap(handle, other.handle);
+    }
+
+    /**
+     * @brief Resumes the coroutine if what it waits for is available.
+     * @param delta Elapsed time.
+     * @return True if the coroutine is done, false otherwise.
+     */
+    bool resume(const delta_type delta) {
+        ENTT_ASSERT(handle, "Invalid coroutine");
+
+        if(!handle.done() && handle.promise().ready(delta)) {
+            handle.resume();
+        }
+
+        return handle.done();
+    }
+
+    /**
+     * @brief Takes over the pending delay of a suspended coroutine, if any.
+     *
+     * The coroutine is resumed during the first call to `resume` that follows,
+     * as if the delay had expired. It's up to the caller to wait for it.
+     *
+     * @return The time left to wait, if any.
+     */
+    [[nodiscard]] delta_type handover() noexcept {
+        ENTT_ASSERT(handle, "Invalid coroutine");
+        return handle.promise().handover();
+    }
+
+    /**
+     * @brief Checks if the coroutine is done.
+     * @return True if the coroutine is done, false otherwise.
+     */
+    [[nodiscard]] bool done() const noexcept {
+        return !handle || handle.done();
+    }
+
+    /**
+     * @brief Checks if a coroutine object refers to a coroutine.
+     * @return True if the object refers to a coroutine, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return static_cast<bool>(handle);
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle{};
+};
+
+/**
+ * @brief Process that runs a coroutine.
+ *
+ * The coroutine is resumed once per tick at most and only when what it waits
+ * for is available. Delays are turned into calls to `sleep`, so that sleeping
+ * coroutines aren't even ticked by a scheduler. The process succeeds when the
+ * coroutine returns.
+ *
+ * @tparam Delta Type used to provide elapsed time.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Delta, typename Allocator>
+class basic_coroutine_process: public basic_process<Delta, Allocator> {
+    using base_type = basic_process<Delta, Allocator>;
+
+    void update(const Delta delta, void *) override {
+        if(func.resume(delta)) {
+            this->succeed();
+        } else if(const auto value = func.handover(); value > Delta{}) {
+            // schedulers park sleeping processes rather than ticking them
+            this->sleep(value);
+        }
+    }
+
+    void aborted() override {
+        func = coroutine_type{};
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Type used to provide elapsed time. */
+    using delta_type = Delta;
+    /*! @brief Coroutine type. */
+    using coroutine_type = basic_coroutine<Delta>;
+
+    /**
+     * @brief Constructs a process from a coroutine object.
+     * @param allocator The allocator to use.
+     * @param coro A valid coroutine object.
+     */
+    basic_coroutine_process(const allocator_type &allocator, coroutine_type coro)
+        : base_type{allocator},
+          func{std::move(coro)} {
+        ENTT_ASSERT(func, "Invalid coroutine");
+    }
+
+    /**
+     * @brief Constructs a process by invoking a coroutine function.
+     *
+     * The coroutine function receives the allocator of the process after an
+     * `std::allocator_arg` tag, if it accepts one. This way, its frame comes
+     * from the same memory as the process.
+     *
+     * @tparam Func Type of coroutine function.
+     * @tparam Args Types of arguments to forward to the coroutine function.
+     * @param allocator The allocator to use.
+     * @param coro A valid coroutine function.
+     * @param args Parameters to forward to the coroutine function.
+     */
+    template<typename Func, typename... Args, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Func>, coroutine_type>>>
+    basic_coroutine_process(const allocator_type &allocator, Func &&coro, Args &&...args)
+        : basic_coroutine_process{allocator, invoke(allocator, std::forward<Func>(coro), std::forward<Args>(args)...)} {}
+
+private:
+    template<typename Func, typename... Args>
+    [[nodiscard]] static coroutine_type invoke(const allocator_type &allocator, Func &&coro, Args &&...args) {
+        if constexpr(std::is_invocable_v<Func, std::allocator_arg_t, const allocator_type &, Args...>) {
+            return std::forward<Func>(coro)(std::allocator_arg, allocator, std::forward<Args>(args)...);
+        } else {
+            return std::forward<Func>(coro)(std::forward<Args>(args)...);
+        }
+    }
+
+    coroutine_type func;
+};
+
+} // namespace entt
+
+#endif
+
+#endif
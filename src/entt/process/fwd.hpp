@@ -18,6 +18,18 @@ class basic_scheduler;
 /*! @brief Alias declaration for the most common use case. */
 using scheduler = basic_scheduler<std::uint32_t>;
 
+template<typename>
+class basic_coroutine;
+
+/*! @brief Alias declaration for the most common use case. */
+using coroutine = basic_coroutine<std::uint32_t>;
+
+template<typename, typename = std::allocator<void>>
+class basic_coroutine_process;
+
+/*! @brief Alias declaration for the most common use case. */
+using coroutine_process = basic_coroutine_process<std::uint32_t>;
+
 } // namespace entt
 
 #endif
@@ -1,6 +1,7 @@
 #ifndef ENTT_PROCESS_PROCESS_HPP
 #define ENTT_PROCESS_PROCESS_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <type_traits>
@@ -70,6 +71,8 @@ struct process_adaptor;
  */
 template<typename Delta, typename Allocator>
 class basic_process: public std::enable_shared_from_this<basic_process<Delta, Allocator>> {
+    friend class basic_scheduler<Delta, Allocator>;
+
     enum class state : std::uint8_t {
         idle = 0,
         running,
@@ -105,7 +108,10 @@ public:
      */
     explicit basic_process(const allocator_type &allocator)
         : next{nullptr, allocator},
-          current{state::idle} {}
+          current{state::idle},
+          remaining{},
+          backlog{},
+          units{1u} {}
 
     /*! @brief Default copy constructor, deleted on purpose. */
     basic_process(const basic_process &) = delete;
@@ -170,6 +176,23 @@ public:
         }
     }
 
+    /**
+     * @brief Suspends a process for a given amount of time, unless it's
+     * already terminated.
+     *
+     * A sleeping process isn't updated until the elapsed times add up to the
+     * given value. Schedulers don't even tick sleeping processes and only wake
+     * them up when their deadline arrives.<br/>
+     * Only arithmetic delta types support sleeping processes.
+     *
+     * @param value Time to sleep.
+     */
+    void sleep(const Delta value) noexcept {
+        if(current == state::idle || alive()) {
+            remaining = value;
+        }
+    }
+
     /*! @brief Restarts a process if it's paused, otherwise does nothing. */
     void unpause() noexcept {
         if(alive()) {
@@ -193,6 +216,39 @@ public:
         return current == state::finished;
     }
 
+    /**
+     * @brief Returns true if a process is currently sleeping.
+     * @return True if the process is sleeping, false otherwise.
+     */
+    [[nodiscard]] bool sleeping() const noexcept {
+        if constexpr(std::is_arithmetic_v<Delta>) {
+            return remaining > Delta{};
+        } else {
+            return false;
+        }
+    }
+
+    /**
+     * @brief Sets the cost of a process.
+     *
+     * The cost of a process is an arbitrary number of units chosen by the
+     * user and only used by schedulers for time-sliced updates. It defaults to
+     * one unit for all processes.
+     *
+     * @param value The cost of the process.
+     */
+    void cost(const std::size_t value) noexcept {
+        units = value;
+    }
+
+    /**
+     * @brief Returns the cost of a process.
+     * @return The cost of the process.
+     */
+    [[nodiscard]] std::size_t cost() const noexcept {
+        return units;
+    }
+
     /**
      * @brief Returns true if a process is currently paused.
      * @return True if the process is paused, false otherwise.
@@ -252,6 +308,15 @@ public:
         switch(current) {
         case state::idle:
         case state::running:
+            if constexpr(std::is_arithmetic_v<Delta>) {
+                if(remaining > delta) {
+                    remaining -= delta;
+                    break;
+                }
+
+                remaining = {};
+            }
+
             current = state::running;
             update(delta, data);
             break;
@@ -283,6 +348,9 @@ public:
 private:
     compressed_pair<std::shared_ptr<basic_process>, allocator_type> next;
     state current;
+    Delta remaining;
+    Delta backlog;
+    std::size_t units;
 };
 
 /*! @cond TURN_OFF_DOXYGEN */
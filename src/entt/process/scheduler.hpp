@@ -1,18 +1,227 @@
 #ifndef ENTT_PROCESS_SCHEDULER_HPP
 #define ENTT_PROCESS_SCHEDULER_HPP
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
 #include "../config/config.h"
+#include "../core/bit.hpp"
 #include "../core/compressed_pair.hpp"
 #include "fwd.hpp"
 #include "process.hpp"
 
+#ifdef ENTT_USE_PROFILER
+#    include "../tools/profiler.hpp"
+#endif
+
 namespace entt {
 
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+template<typename Delta, typename Type, typename Allocator>
+class timer_wheel {
+    static constexpr std::size_t bits = 6u;
+    static constexpr std::size_t slots = std::size_t{1u} << bits;
+    static constexpr std::size_t levels = (std::numeric_limits<std::uint64_t>::digits + bits - 1u) / bits;
+    static constexpr auto null = (std::numeric_limits<std::uint32_t>::max)();
+
+    using time_type = std::conditional_t<std::is_integral_v<Delta>, std::uint64_t, Delta>;
+
+    struct node_type {
+        Type value;
+        time_type deadline;
+        std::uint32_t next;
+    };
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using node_container_type = std::vector<node_type, typename alloc_traits::template rebind_alloc<node_type>>;
+    using head_container_type = std::vector<std::uint32_t, typename alloc_traits::template rebind_alloc<std::uint32_t>>;
+
+    [[nodiscard]] static std::uint64_t prefix(const std::uint64_t tick, const std::size_t level) noexcept {
+        const auto shift = (level + 1u) * bits;
+        return (shift < std::numeric_limits<std::uint64_t>::digits) ? (tick >> shift) : 0u;
+    }
+
+    void link(std::uint32_t &head, const std::uint32_t pos) noexcept {
+        nodes[pos].next = std::exchange(head, pos);
+    }
+
+    void file(const std::uint32_t pos) noexcept {
+        if(const auto tick = static_cast<std::uint64_t>(nodes[pos].deadline); tick <= current) {
+            link(due, pos);
+        } else {
+            std::size_t level{};
+
+            for(auto diff = (tick ^ current) >> bits; diff; diff >>= bits) {
+                ++level;
+            }
+
+            const auto slot = static_cast<std::size_t>(tick >> (level * bits)) & (slots - 1u);
+            link(heads[level * slots + slot], pos);
+            mask[level] |= std::uint64_t{1u} << slot;
+        }
+    }
+
+public:
+    using size_type = std::size_t;
+
+    explicit timer_wheel(const Allocator &allocator)
+        : nodes{allocator},
+          heads{allocator} {}
+
+    timer_wheel(timer_wheel &&other) noexcept
+        : nodes{std::move(other.nodes)},
+          heads{std::move(other.heads)},
+          mask{other.mask},
+          now{other.now},
+          current{other.current},
+          due{std::exchange(other.due, null)},
+          available{std::exchange(other.available, null)},
+          count{std::exchange(other.count, 0u)} {}
+
+    timer_wheel(timer_wheel &&other, const Allocator &allocator)
+        : nodes{std::move(other.nodes), allocator},
+          heads{std::move(other.heads), allocator},
+          mask{other.mask},
+          now{other.now},
+          current{other.current},
+          due{std::exchange(other.due, null)},
+          available{std::exchange(other.available, null)},
+          count{std::exchange(other.count, 0u)} {}
+
+    void swap(timer_wheel &other) noexcept {
+        using std::swap;
+        swap(nodes, other.nodes);
+        swap(heads, other.heads);
+        swap(mask, other.mask);
+        swap(now, other.now);
+        swap(current, other.current);
+        swap(due, other.due);
+        swap(available, other.available);
+        swap(count, other.count);
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return count;
+    }
+
+    void insert(Type value, const Delta delay) {
+        if(heads.empty()) {
+            heads.assign(levels * slots, null);
+        }
+
+        std::uint32_t pos = available;
+
+        if(pos == null) {
+            pos = static_cast<std::uint32_t>(nodes.size());
+            nodes.push_back(node_type{std::move(value), now + static_cast<time_type>(delay), null});
+        } else {
+            available = nodes[pos].next;
+            nodes[pos].value = std::move(value);
+            nodes[pos].deadline = now + static_cast<time_type>(delay);
+        }
+
+        file(pos);
+        ++count;
+    }
+
+    template<typename Func>
+    void advance(const Delta delta, Func func) {
+        if(delta > Delta{}) {
+            now += static_cast<time_type>(delta);
+        }
+
+        if(const auto tick = static_cast<std::uint64_t>(now); tick != current) {
+            std::uint32_t pending = null;
+
+            for(std::size_t level{}; level < levels; ++level) {
+                auto range = ~std::uint64_t{};
+
+                if(prefix(current, level) == prefix(tick, level)) {
+                    const auto from = static_cast<std::size_t>(current >> (level * bits)) & (slots - 1u);
+                    const auto to = static_cast<std::size_t>(tick >> (level * bits)) & (slots - 1u);
+
+                    if(from == to) {
+                        continue;
+                    }
+
+                    // slots in (from, to], the last one is refiled at a lower level
+                    range &= ~((std::uint64_t{1u} << (from + 1u)) - 1u);
+                    range &= (to + 1u == slots) ? ~std::uint64_t{} : ((std::uint64_t{1u} << (to + 1u)) - 1u);
+                }
+
+                for(auto curr = mask[level] & range; curr; curr &= curr - 1u) {
+                    auto &head = heads[level * slots + static_cast<std::size_t>(countr_zero(curr))];
+
+                    while(head != null) {
+                        link(pending, std::exchange(head, nodes[head].next));
+                    }
+                }
+
+                mask[level] &= ~range;
+            }
+
+            current = tick;
+
+            while(pending != null) {
+                file(std::exchange(pending, nodes[pending].next));
+            }
+        }
+
+        for(auto *pos = &due; *pos != null;) {
+            if(auto &node = nodes[*pos]; node.deadline <= now) {
+                func(std::move(node.value));
+                node.value = Type{};
+                link(available, std::exchange(*pos, node.next));
+                --count;
+            } else {
+                pos = &node.next;
+            }
+        }
+    }
+
+    template<typename Func>
+    void release(Func func) {
+        for(auto &&node: nodes) {
+            if(node.value) {
+                func(std::move(node.value));
+            }
+        }
+
+        clear();
+    }
+
+    void clear() noexcept {
+        nodes.clear();
+        heads.clear();
+        mask = {};
+        due = null;
+        available = null;
+        count = 0u;
+    }
+
+private:
+    node_container_type nodes;
+    head_container_type heads;
+    std::array<std::uint64_t, levels> mask{};
+    time_type now{};
+    std::uint64_t current{};
+    std::uint32_t due{null};
+    std::uint32_t available{null};
+    size_type count{};
+};
+
+} // namespace internal
+/*! @endcond */
+
 /**
  * @brief Cooperative scheduler for processes.
  *
@@ -38,6 +247,67 @@ class basic_scheduler {
     using alloc_traits = std::allocator_traits<Allocator>;
     using container_allocator = typename alloc_traits::template rebind_alloc<std::shared_ptr<base_type>>;
     using container_type = std::vector<std::shared_ptr<base_type>, container_allocator>;
+    using timer_type = internal::timer_wheel<Delta, std::shared_ptr<base_type>, Allocator>;
+
+    void wake([[maybe_unused]] const Delta delta) {
+        if constexpr(std::is_arithmetic_v<Delta>) {
+            timers.advance(delta, [this](auto &&elem) { handlers.first().push_back(std::move(elem)); });
+        }
+    }
+
+    void park([[maybe_unused]] std::shared_ptr<base_type> &elem) {
+        if constexpr(std::is_arithmetic_v<Delta>) {
+            const auto value = std::exchange(elem->remaining, Delta{});
+            timers.insert(std::move(elem), value);
+        }
+    }
+
+    template<typename Func>
+    void slice(const Delta delta, void *data, Func next) {
+        auto &container = handlers.first();
+        const auto len = container.size();
+        bool dirty = false;
+
+        if constexpr(std::is_arithmetic_v<Delta>) {
+            for(auto &&elem: container) {
+                elem->backlog += delta;
+            }
+        }
+
+        for(std::size_t count{}; count < len && (next(container[cursor % len]->cost()) || count == 0u); ++count) {
+            const auto pos = (cursor++ % len);
+
+            if constexpr(std::is_arithmetic_v<Delta>) {
+                container[pos]->tick(std::exchange(container[pos]->backlog, Delta{}), data);
+            } else {
+                container[pos]->tick(delta, data);
+            }
+
+            // updating might spawn/reallocate, cannot hold refs until here
+            auto &elem = container[pos];
+
+            if(elem->finished()) {
+                elem = std::shared_ptr<base_type>{std::move(elem->next.first())};
+            }
+
+            if(elem && elem->sleeping() && !elem->rejected()) {
+                park(elem);
+            }
+
+            if(!elem || elem->rejected()) {
+                elem.reset();
+                dirty = true;
+            }
+        }
+
+        cursor = len ? (cursor % len) : 0u;
+
+        if(dirty) {
+            // stable compaction, so that the round-robin order is preserved
+            cursor -= static_cast<size_type>(std::count(container.begin(), container.begin() + static_cast<typename container_type::difference_type>(cursor), nullptr));
+            container.erase(std::remove(container.begin(), container.end(), nullptr), container.end());
+        }
+    }
 
 public:
     /*! @brief Process type. */
@@ -58,7 +328,8 @@ public:
      * @param allocator The allocator to use.
      */
     explicit basic_scheduler(const allocator_type &allocator)
-        : handlers{allocator, allocator} {}
+        : handlers{allocator, allocator},
+          timers{allocator} {}
 
     /*! @brief Default copy constructor, deleted on purpose. */
     basic_scheduler(const basic_scheduler &) = delete;
@@ -68,7 +339,9 @@ public:
      * @param other The instance to move from.
      */
     basic_scheduler(basic_scheduler &&other) noexcept
-        : handlers{std::move(other.handlers)} {}
+        : handlers{std::move(other.handlers)},
+          timers{std::move(other.timers)},
+          cursor{std::exchange(other.cursor, 0u)} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -76,7 +349,9 @@ public:
      * @param allocator The allocator to use.
      */
     basic_scheduler(basic_scheduler &&other, const allocator_type &allocator)
-        : handlers{container_type{std::move(other.handlers.first()), allocator}, allocator} {
+        : handlers{container_type{std::move(other.handlers.first()), allocator}, allocator},
+          timers{std::move(other.timers), allocator},
+          cursor{std::exchange(other.cursor, 0u)} {
         ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a scheduler is not allowed");
     }
 
@@ -107,6 +382,8 @@ public:
     void swap(basic_scheduler &other) noexcept {
         using std::swap;
         swap(handlers, other.handlers);
+        timers.swap(other.timers);
+        swap(cursor, other.cursor);
     }
 
     /**
@@ -118,11 +395,19 @@ public:
     }
 
     /**
-     * @brief Number of processes currently scheduled.
+     * @brief Number of processes currently scheduled, sleeping ones included.
      * @return Number of processes currently scheduled.
      */
     [[nodiscard]] size_type size() const noexcept {
-        return handlers.first().size();
+        return handlers.first().size() + timers.size();
+    }
+
+    /**
+     * @brief Number of processes currently sleeping.
+     * @return Number of processes currently sleeping.
+     */
+    [[nodiscard]] size_type sleeping() const noexcept {
+        return timers.size();
     }
 
     /**
@@ -130,7 +415,7 @@ public:
      * @return True if there are scheduled processes, false otherwise.
      */
     [[nodiscard]] bool empty() const noexcept {
-        return handlers.first().empty();
+        return handlers.first().empty() && (timers.size() == 0u);
     }
 
     /**
@@ -141,6 +426,8 @@ public:
      */
     void clear() {
         handlers.first().clear();
+        timers.clear();
+        cursor = 0u;
     }
 
     /**
@@ -177,10 +464,17 @@ public:
      * any. Otherwise, if a process terminates with an error, it's removed along
      * with its child.
      *
+     * Sleeping processes are parked in a timer wheel and aren't executed at
+     * all. They are woken up and executed during the tick that exhausts their
+     * delay.
+     *
      * @param delta Elapsed time.
      * @param data Optional data.
      */
     void update(const delta_type delta, void *data = nullptr) {
+        ENTT_PROFILE_SCOPE("scheduler::update");
+        wake(delta);
+
         for(auto next = handlers.first().size(); next; --next) {
             const auto pos = next - 1u;
             handlers.first()[pos]->tick(delta, data);
@@ -188,7 +482,11 @@ public:
             auto &elem = handlers.first()[pos];
 
             if(elem->finished()) {
-                elem = elem->peek();
+                elem = std::shared_ptr<base_type>{std::move(elem->next.first())};
+            }
+
+            if(elem && elem->sleeping() && !elem->rejected()) {
+                park(elem);
             }
 
             if(!elem || elem->rejected()) {
@@ -198,6 +496,125 @@ public:
         }
     }
 
+    /**
+     * @brief Updates all scheduled processes with the help of an executor.
+     *
+     * Processes are split in contiguous chunks of at most `grain` elements.
+     * The executor is invoked once with the number of chunks and a job to run
+     * for each of them. It can dispatch them to a thread pool as needed, as
+     * long as it returns only when all the chunks have been processed:
+     *
+     * @code{.cpp}
+     * scheduler.update([&pool](std::size_t count, auto job) { pool.parallel_for(count, job); }, 64u, delta);
+     * @endcode
+     *
+     * A process and its children form a chain that is only ever visited by
+     * one job, therefore continuations still run in order.<br/>
+     * Jobs never touch each other's processes. Terminated chains are only
+     * marked as such and are removed once the executor returns, on the
+     * calling thread, without the need for any synchronization.
+     *
+     * @warning
+     * Processes must not attach new processes to the scheduler nor access the
+     * user data concurrently without proper synchronization.
+     *
+     * @tparam Exec Type of the executor to use to run the jobs.
+     * @param exec A valid executor.
+     * @param grain Maximum number of processes per chunk.
+     * @param delta Elapsed time.
+     * @param data Optional data.
+     */
+    template<typename Exec>
+    void update(Exec &&exec, const size_type grain, const delta_type delta, void *data = nullptr) {
+        ENTT_ASSERT(grain != 0u, "Invalid grain size");
+        ENTT_PROFILE_SCOPE("scheduler::update");
+        wake(delta);
+        auto &container = handlers.first();
+        const auto len = container.size();
+
+        std::forward<Exec>(exec)((len + grain - 1u) / grain, [&container, len, grain, delta, data](const size_type chunk) {
+            ENTT_PROFILE_SCOPE("scheduler::job");
+
+            for(auto pos = chunk * grain, last = (std::min)(pos + grain, len); pos < last; ++pos) {
+                auto &elem = container[pos];
+                elem->tick(delta, data);
+
+                if(elem->finished()) {
+                    elem = std::shared_ptr<base_type>{std::move(elem->next.first())};
+                }
+
+                if(elem && elem->rejected()) {
+                    elem.reset();
+                }
+            }
+        });
+
+        for(auto next = len; next; --next) {
+            if(auto &elem = container[next - 1u]; elem && elem->sleeping()) {
+                park(elem);
+            }
+
+            if(auto &elem = container[next - 1u]; !elem) {
+                elem = std::move(container.back());
+                container.pop_back();
+            }
+        }
+    }
+
+    /**
+     * @brief Updates as many scheduled processes as a budget of costs allows.
+     *
+     * Processes are updated in a round-robin fashion, starting from the first
+     * one not updated during the previous tick. The update stops as soon as
+     * the cost of the next process exceeds what remains of the budget, though
+     * at least one process is updated per tick in any case. Each process is
+     * updated at most once per tick.<br/>
+     * With arithmetic delta types, processes receive all the time elapsed
+     * since they were last updated. Otherwise, they receive the given delta.
+     *
+     * @sa basic_process::cost
+     *
+     * @param budget Maximum cost of the processes to update.
+     * @param delta Elapsed time.
+     * @param data Optional data.
+     */
+    void update_sliced(const size_type budget, const delta_type delta, void *data = nullptr) {
+        ENTT_PROFILE_SCOPE("scheduler::update");
+        wake(delta);
+
+        slice(delta, data, [spent = size_type{}, budget](const size_type cost) mutable {
+            return ((spent += cost) <= budget);
+        });
+    }
+
+    /**
+     * @brief Updates scheduled processes until a time budget is exhausted.
+     *
+     * Processes are updated in a round-robin fashion, starting from the first
+     * one not updated during the previous tick. No other process is started
+     * once the time budget is exhausted, though at least one process is
+     * updated per tick in any case. Each process is updated at most once per
+     * tick.<br/>
+     * With arithmetic delta types, processes receive all the time elapsed
+     * since they were last updated. Otherwise, they receive the given delta.
+     *
+     * @tparam Rep Arithmetic type representing the number of ticks.
+     * @tparam Period Type representing the tick period.
+     * @param budget Maximum time to spend updating processes.
+     * @param delta Elapsed time.
+     * @param data Optional data.
+     */
+    template<typename Rep, typename Period>
+    void update_sliced(const std::chrono::duration<Rep, Period> budget, const delta_type delta, void *data = nullptr) {
+        ENTT_PROFILE_SCOPE("scheduler::update");
+        const auto deadline = std::chrono::steady_clock::now() + budget;
+        wake(delta);
+
+        slice(delta, data, [deadline](const size_type) {
+            return std::chrono::steady_clock::now() < deadline;
+        });
+    }
+
     /**
      * @brief Aborts all scheduled processes.
      *
@@ -209,6 +626,8 @@ public:
      * @param immediate Requests an immediate operation.
      */
     void abort(const bool immediate = false) {
+        timers.release([this](auto &&elem) { handlers.first().push_back(std::move(elem)); });
+
         for(auto &&curr: handlers.first()) {
             curr->abort();
 
@@ -220,6 +639,8 @@ public:
 
 private:
     compressed_pair<container_type, allocator_type> handlers;
+    timer_type timers;
+    size_type cursor{};
 };
 
 } // namespace entt
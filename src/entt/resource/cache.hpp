@@ -1,18 +1,25 @@
 #ifndef ENTT_RESOURCE_RESOURCE_CACHE_HPP
 #define ENTT_RESOURCE_RESOURCE_CACHE_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <iterator>
 #include <memory>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
+#include "../config/config.h"
 #include "../container/dense_map.hpp"
 #include "../core/compressed_pair.hpp"
 #include "../core/fwd.hpp"
 #include "../core/iterator.hpp"
 #include "../core/utility.hpp"
+#include "../signal/sigh.hpp"
 #include "fwd.hpp"
 #include "loader.hpp"
 #include "resource.hpp"
@@ -22,6 +29,27 @@ namespace entt {
 /*! @cond TURN_OFF_DOXYGEN */
 namespace internal {
 
+struct resource_cache_usage {
+    std::size_t cost;
+    std::uint64_t tick;
+};
+
+template<typename Type, typename Result>
+struct resource_cache_slot {
+    id_type id{};
+    std::uint32_t version{};
+    std::uint32_t pins{};
+    std::uint32_t next{};
+    Type *instance{};
+    Result owner{};
+};
+
+template<typename Result>
+struct resource_cache_task {
+    std::atomic<bool> ready{};
+    Result value{};
+};
+
 template<typename Type, typename It>
 class resource_cache_iterator final {
     template<typename, typename>
@@ -143,6 +171,26 @@ template<typename... Lhs, typename... Rhs>
 } // namespace internal
 /*! @endcond */
 
+/**
+ * @brief Returns the cost of a resource for the purpose of eviction.
+ *
+ * The default cost of a resource is its size. Users can specialize this class
+ * for their own types (for example, to account for GPU memory or heap
+ * allocations made by a resource).
+ *
+ * @tparam Type Type of resource.
+ */
+template<typename Type>
+struct resource_cost {
+    /**
+     * @brief Returns the cost of a resource.
+     * @return The cost of the given resource in bytes.
+     */
+    [[nodiscard]] std::size_t operator()(const Type &) const noexcept {
+        return sizeof(Type);
+    }
+};
+
 /**
  * @brief Basic cache for resources of any type.
  * @tparam Type Type of resources managed by a cache.
@@ -155,6 +203,102 @@ class resource_cache {
     static_assert(std::is_same_v<typename alloc_traits::value_type, Type>, "Invalid value type");
     using container_allocator = typename alloc_traits::template rebind_alloc<std::pair<const id_type, typename Loader::result_type>>;
     using container_type = dense_map<id_type, typename Loader::result_type, identity, std::equal_to<>, container_allocator>;
+    using task_type = internal::resource_cache_task<typename Loader::result_type>;
+    using pending_type = std::pair<id_type, std::shared_ptr<task_type>>;
+    using pending_container_type = std::vector<pending_type, typename alloc_traits::template rebind_alloc<pending_type>>;
+    using sigh_type = sigh<void(const id_type, resource<Type>), Allocator>;
+    using usage_type = internal::resource_cache_usage;
+    using usage_container_type = dense_map<id_type, usage_type, identity, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, usage_type>>>;
+    using slot_type = internal::resource_cache_slot<Type, typename Loader::result_type>;
+    static constexpr std::uint32_t null_slot = (std::numeric_limits<std::uint32_t>::max)();
+    using slot_container_type = std::vector<slot_type, typename alloc_traits::template rebind_alloc<slot_type>>;
+    using bound_container_type = dense_map<id_type, std::uint32_t, identity, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::uint32_t>>>;
+
+    void touch(const id_type id) const {
+        if(auto it = usage.find(id); it != usage.end()) {
+            it->second.tick = ++clock;
+        }
+    }
+
+    void track(const id_type id, const typename Loader::result_type &value) {
+        forget(id);
+
+        if(value) {
+            const auto cost = resource_cost<value_type>{}(*value);
+            usage.emplace(id, usage_type{cost, ++clock});
+            memory += cost;
+        }
+    }
+
+    void forget(const id_type id) {
+        if(auto it = usage.find(id); it != usage.end()) {
+            memory -= it->second.cost;
+            usage.erase(it);
+        }
+
+        unbind(id);
+    }
+
+    void unbind(const id_type id) {
+        if(auto it = bound.find(id); it != bound.end()) {
+            auto &elem = slots[it->second];
+            ++elem.version;
+            elem.pins = 0u;
+            elem.instance = nullptr;
+            elem.owner = {};
+            elem.next = std::exchange(released, it->second);
+            bound.erase(it);
+        }
+    }
+
+    [[nodiscard]] bool alive(const resource_slot<Type> elem) const noexcept {
+        return (elem.index < slots.size()) && (slots[elem.index].version == elem.version) && (slots[elem.index].instance != nullptr);
+    }
+
+    template<typename... Args>
+    auto insert(const id_type id, Args &&...args) {
+        auto it = pool.first().insert_or_assign(id, pool.second()(std::forward<Args>(args)...)).first;
+
+        ENTT_TRY {
+            track(id, it->second);
+        }
+        ENTT_CATCH {
+            pool.first().erase(it);
+            ENTT_THROW;
+        }
+
+        return it;
+    }
+
+    template<typename It>
+    void prepare(It first, It last) {
+        if constexpr(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>) {
+            const auto sz = pool.first().size() + static_cast<std::size_t>(std::distance(first, last));
+            pool.first().reserve(sz);
+            usage.reserve(sz);
+        }
+    }
+
+    std::size_t shrink(const id_type *keep) {
+        using candidate_type = std::pair<std::uint64_t, id_type>;
+        std::vector<candidate_type, typename alloc_traits::template rebind_alloc<candidate_type>> candidates(get_allocator());
+
+        for(auto &&[id, elem]: usage) {
+            if((keep == nullptr || id != *keep) && pool.first().find(id)->second.use_count() == 1) {
+                candidates.emplace_back(elem.tick, id);
+            }
+        }
+
+        std::sort(candidates.begin(), candidates.end());
+        std::size_t count{};
+
+        for(auto first = candidates.begin(), last = candidates.end(); first != last && memory > limit; ++first, ++count) {
+            forget(first->second);
+            pool.first().erase(first->second);
+        }
+
+        return count;
+    }
 
 public:
     /*! @brief Allocator type. */
@@ -187,7 +331,12 @@ public:
      * @param allocator The allocator to use.
      */
     explicit resource_cache(const loader_type &callable, const allocator_type &allocator = allocator_type{})
-        : pool{container_type{allocator}, callable} {}
+        : pool{container_type{allocator}, callable},
+          pending{allocator},
+          loaded{allocator},
+          usage{allocator},
+          slots{allocator},
+          bound{allocator} {}
 
     /*! @brief Default copy constructor. */
     resource_cache(const resource_cache &) = default;
@@ -198,7 +347,16 @@ public:
      * @param allocator The allocator to use.
      */
     resource_cache(const resource_cache &other, const allocator_type &allocator)
-        : pool{std::piecewise_construct, std::forward_as_tuple(other.pool.first(), allocator), std::forward_as_tuple(other.pool.second())} {}
+        : pool{std::piecewise_construct, std::forward_as_tuple(other.pool.first(), allocator), std::forward_as_tuple(other.pool.second())},
+          pending{other.pending, allocator},
+          loaded{other.loaded, allocator},
+          usage{other.usage, allocator},
+          slots{other.slots, allocator},
+          bound{other.bound, allocator},
+          released{other.released},
+          clock{other.clock},
+          memory{other.memory},
+          limit{other.limit} {}
 
     /*! @brief Default move constructor. */
     resource_cache(resource_cache &&) noexcept = default;
@@ -209,7 +367,16 @@ public:
      * @param allocator The allocator to use.
      */
     resource_cache(resource_cache &&other, const allocator_type &allocator)
-        : pool{std::piecewise_construct, std::forward_as_tuple(std::move(other.pool.first()), allocator), std::forward_as_tuple(std::move(other.pool.second()))} {}
+        : pool{std::piecewise_construct, std::forward_as_tuple(std::move(other.pool.first()), allocator), std::forward_as_tuple(std::move(other.pool.second()))},
+          pending{std::move(other.pending), allocator},
+          loaded{std::move(other.loaded), allocator},
+          usage{std::move(other.usage), allocator},
+          slots{std::move(other.slots), allocator},
+          bound{std::move(other.bound), allocator},
+          released{std::exchange(other.released, null_slot)},
+          clock{other.clock},
+          memory{std::exchange(other.memory, 0u)},
+          limit{other.limit} {}
 
     /*! @brief Default destructor. */
     ~resource_cache() = default;
@@ -293,6 +460,13 @@ public:
     /*! @brief Clears a cache. */
     void clear() noexcept {
         pool.first().clear();
+        pending.clear();
+        usage.clear();
+        memory = 0u;
+
+        while(!bound.empty()) {
+            unbind(bound.begin()->first);
+        }
     }
 
     /**
@@ -315,10 +489,188 @@ public:
     template<typename... Args>
     std::pair<iterator, bool> load(const id_type id, Args &&...args) {
         if(auto it = pool.first().find(id); it != pool.first().end()) {
+            touch(id);
             return {it, false};
         }
 
-        return pool.first().emplace(id, pool.second()(std::forward<Args>(args)...));
+        auto it = insert(id, std::forward<Args>(args)...);
+
+        if(memory > limit) {
+            shrink(&id);
+            it = pool.first().find(id);
+        }
+
+        return {it, true};
+    }
+
+    /**
+     * @brief Loads all the resources whose identifiers do not exist yet.
+     *
+     * The underlying map is reserved only once. Then, the loader is invoked
+     * with each identifier followed by the given arguments, for each resource
+     * that doesn't already exist. Duplicates in the range are loaded once.
+     *
+     * @tparam It Type of input iterator.
+     * @tparam Args Types of arguments to use to load the resources.
+     * @param first An iterator to the first element of the range of
+     * identifiers.
+     * @param last An iterator past the last element of the range of
+     * identifiers.
+     * @param args Arguments to use to load the resources.
+     * @return Number of resources loaded.
+     */
+    template<typename It, typename... Args>
+    size_type load_many(It first, It last, const Args &...args) {
+        size_type count{};
+        prepare(first, last);
+
+        for(; first != last; ++first) {
+            if(const id_type id = *first; !pool.first().contains(id)) {
+                insert(id, id, args...);
+                ++count;
+            }
+        }
+
+        if(memory > limit) {
+            shrink(nullptr);
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Loads asynchronously all the resources whose identifiers do not
+     * exist yet.
+     *
+     * The underlying map is reserved only once. Then, a task is handed to the
+     * executor for each resource that doesn't already exist. Tasks invoke the
+     * loader with an identifier followed by the given arguments.
+     *
+     * @sa load_async
+     *
+     * @tparam It Type of input iterator.
+     * @tparam Exec Type of the executor to use to run the loader.
+     * @tparam Args Types of arguments to use to load the resources.
+     * @param first An iterator to the first element of the range of
+     * identifiers.
+     * @param last An iterator past the last element of the range of
+     * identifiers.
+     * @param exec A callable object that accepts and eventually invokes a
+     * task of type `void()`.
+     * @param args Arguments to use to load the resources.
+     * @return Number of resources scheduled for loading.
+     */
+    template<typename It, typename Exec, typename... Args>
+    size_type load_many_async(It first, It last, Exec &&exec, const Args &...args) {
+        size_type count{};
+        prepare(first, last);
+
+        for(; first != last; ++first) {
+            const id_type id = *first;
+            count += load_async(id, exec, id, args...).second;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Loads a resource asynchronously, if its identifier does not exist.
+     *
+     * A pending handle is inserted immediately, while the executor receives a
+     * task that invokes a copy of the loader with a copy of the arguments.<br/>
+     * Tasks can run on any thread. However, the cache itself is only updated
+     * when the `update` member function is invoked, which also publishes the
+     * resources loaded so far through the `on_load` signal.
+     *
+     * @warning
+     * If the loader throws an exception or doesn't load the resource correctly,
+     * the pending handle is replaced by an invalid one.
+     *
+     * @tparam Exec Type of the executor to use to run the loader.
+     * @tparam Args Types of arguments to use to load the resource if required.
+     * @param id Unique resource identifier.
+     * @param exec A callable object that accepts and eventually invokes a
+     * task of type `void()`.
+     * @param args Arguments to use to load the resource if required.
+     * @return A pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
+     */
+    template<typename Exec, typename... Args>
+    std::pair<iterator, bool> load_async(const id_type id, Exec &&exec, Args &&...args) {
+        if(auto it = pool.first().find(id); it != pool.first().end()) {
+            return {it, false};
+        }
+
+        auto task = std::allocate_shared<task_type>(get_allocator());
+        pending.emplace_back(id, task);
+        std::pair<iterator, bool> elem{};
+
+        ENTT_TRY {
+            elem = pool.first().emplace(id, std::shared_ptr<value_type>{task, nullptr});
+        }
+        ENTT_CATCH {
+            pending.pop_back();
+            ENTT_THROW;
+        }
+
+        std::forward<Exec>(exec)([task, callable = pool.second(), params = std::tuple<std::decay_t<Args>...>{std::forward<Args>(args)...}]() mutable {
+            ENTT_TRY {
+                task->value = std::apply(callable, std::move(params));
+            }
+            ENTT_CATCH {
+                task->value = {};
+            }
+
+            task->ready.store(true, std::memory_order_release);
+        });
+
+        return elem;
+    }
+
+    /**
+     * @brief Moves the resources loaded asynchronously so far into the cache.
+     *
+     * Resources that were erased or replaced in the meantime are discarded.
+     * All the others are published through the `on_load` signal.
+     */
+    void update() {
+        for(auto pos = pending.size(); pos; --pos) {
+            if(pending[pos - 1u].second->ready.load(std::memory_order_acquire)) {
+                const auto curr = std::move(pending[pos - 1u]);
+                pending[pos - 1u] = std::move(pending.back());
+                pending.pop_back();
+
+                if(auto it = pool.first().find(curr.first); it != pool.first().end() && !it->second.owner_before(curr.second) && !curr.second.owner_before(it->second)) {
+                    it->second = curr.second->value;
+                    track(curr.first, it->second);
+                    loaded.publish(curr.first, resource<value_type>{it->second});
+                }
+            }
+        }
+
+        if(memory > limit) {
+            shrink(nullptr);
+        }
+    }
+
+    /**
+     * @brief Returns a sink object for resources loaded asynchronously.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever a resource loaded asynchronously is moved into the cache.<br/>
+     * The function type for a listener is equivalent to:
+     *
+     * @code{.cpp}
+     * void(const entt::id_type, entt::resource<Type>);
+     * @endcode
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_load() noexcept {
+        return sink{loaded};
     }
 
     /**
@@ -327,7 +679,14 @@ public:
      */
     template<typename... Args>
     std::pair<iterator, bool> force_load(const id_type id, Args &&...args) {
-        return {pool.first().insert_or_assign(id, pool.second()(std::forward<Args>(args)...)).first, true};
+        auto it = insert(id, std::forward<Args>(args)...);
+
+        if(memory > limit) {
+            shrink(&id);
+            it = pool.first().find(id);
+        }
+
+        return {it, true};
     }
 
     /**
@@ -342,6 +701,7 @@ public:
      */
     [[nodiscard]] resource<const value_type> operator[](const id_type id) const {
         if(auto it = pool.first().find(id); it != pool.first().cend()) {
+            touch(id);
             return resource<const value_type>{it->second};
         }
 
@@ -351,12 +711,100 @@ public:
     /*! @copydoc operator[] */
     [[nodiscard]] resource<value_type> operator[](const id_type id) {
         if(auto it = pool.first().find(id); it != pool.first().end()) {
+            touch(id);
             return resource<value_type>{it->second};
         }
 
         return {};
     }
 
+    /**
+     * @brief Returns a slot handle for a given resource identifier.
+     *
+     * All slot handles for the same resource are equal. They are invalidated
+     * when the resource is erased, replaced or evicted, as well as when the
+     * cache is cleared.
+     *
+     * @param id Unique resource identifier.
+     * @return A slot handle for the given resource if it exists and is loaded,
+     * a null handle otherwise.
+     */
+    [[nodiscard]] resource_slot<value_type> slot(const id_type id) {
+        if(auto it = bound.find(id); it != bound.end()) {
+            return resource_slot<value_type>{it->second, slots[it->second].version};
+        }
+
+        auto it = pool.first().find(id);
+
+        if(it == pool.first().end() || !it->second) {
+            return {};
+        }
+
+        auto pos = released;
+
+        if(pos == null_slot) {
+            pos = static_cast<std::uint32_t>(slots.size());
+            slots.emplace_back();
+            slots[pos].next = null_slot;
+        }
+
+        bound.emplace(id, pos);
+        released = slots[pos].next;
+        slots[pos].id = id;
+        slots[pos].instance = it->second.get();
+        return resource_slot<value_type>{pos, slots[pos].version};
+    }
+
+    /**
+     * @brief Returns the resource a slot handle refers to.
+     *
+     * Resolving a slot handle doesn't count as a use for the purpose of
+     * eviction. Pin the resources that must stay alive instead.
+     *
+     * @param elem A slot handle.
+     * @return A pointer to the resource if it's still alive, a null pointer
+     * otherwise.
+     */
+    [[nodiscard]] const value_type *resolve(const resource_slot<value_type> elem) const noexcept {
+        return alive(elem) ? slots[elem.index].instance : nullptr;
+    }
+
+    /*! @copydoc resolve */
+    [[nodiscard]] value_type *resolve(const resource_slot<value_type> elem) noexcept {
+        return alive(elem) ? slots[elem.index].instance : nullptr;
+    }
+
+    /**
+     * @brief Pins the resource a slot handle refers to.
+     *
+     * Pinned resources are never evicted. Pins are counted and each of them
+     * should be released with a call to `unpin`.
+     *
+     * @param elem A slot handle.
+     * @return True if the resource is still alive, false otherwise.
+     */
+    bool pin(const resource_slot<value_type> elem) {
+        if(!alive(elem)) {
+            return false;
+        }
+
+        if(auto &curr = slots[elem.index]; curr.pins++ == 0u) {
+            curr.owner = pool.first().find(curr.id)->second;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Releases a pin on the resource a slot handle refers to.
+     * @param elem A slot handle.
+     */
+    void unpin(const resource_slot<value_type> elem) {
+        if(alive(elem) && slots[elem.index].pins != 0u && --slots[elem.index].pins == 0u) {
+            slots[elem.index].owner = {};
+        }
+    }
+
     /**
      * @brief Checks if a cache contains a given identifier.
      * @param id Unique resource identifier.
@@ -373,6 +821,7 @@ public:
      */
     iterator erase(const_iterator pos) {
         const auto it = pool.first().begin();
+        forget(pos->first);
         return pool.first().erase(it + (pos - const_iterator{it}));
     }
 
@@ -384,6 +833,11 @@ public:
      */
     iterator erase(const_iterator first, const_iterator last) {
         const auto it = pool.first().begin();
+
+        for(auto curr = first; curr != last; ++curr) {
+            forget(curr->first);
+        }
+
         return pool.first().erase(it + (first - const_iterator{it}), it + (last - const_iterator{it}));
     }
 
@@ -393,9 +847,57 @@ public:
      * @return Number of resources erased (either 0 or 1).
      */
     size_type erase(const id_type id) {
+        forget(id);
         return pool.first().erase(id);
     }
 
+    /**
+     * @brief Sets the memory budget of a cache.
+     *
+     * Once the total cost of the resources exceeds the budget, the least
+     * recently used ones that aren't referenced outside of the cache are
+     * evicted until the cache fits its budget again, if possible.
+     *
+     * @sa resource_cost
+     *
+     * @param bytes The memory budget of the cache in bytes.
+     */
+    void budget(const size_type bytes) {
+        limit = bytes;
+
+        if(memory > limit) {
+            shrink(nullptr);
+        }
+    }
+
+    /**
+     * @brief Returns the memory budget of a cache.
+     * @return The memory budget of the cache in bytes, unlimited by default.
+     */
+    [[nodiscard]] size_type budget() const noexcept {
+        return limit;
+    }
+
+    /**
+     * @brief Returns the total cost of the resources of a cache.
+     * @return The total cost in bytes of the resources of the cache.
+     */
+    [[nodiscard]] size_type memory_usage() const noexcept {
+        return memory;
+    }
+
+    /**
+     * @brief Evicts the least recently used resources that aren't referenced
+     * outside of a cache, until the cache fits its budget.
+     *
+     * Loading a resource or accessing it by identifier counts as a use.
+     *
+     * @return Number of resources evicted.
+     */
+    size_type evict() {
+        return shrink(nullptr);
+    }
+
     /**
      * @brief Returns the loader used to create resources.
      * @return The loader used to create resources.
@@ -406,6 +908,15 @@ public:
 
 private:
     compressed_pair<container_type, loader_type> pool;
+    pending_container_type pending;
+    sigh_type loaded;
+    mutable usage_container_type usage;
+    slot_container_type slots;
+    bound_container_type bound;
+    std::uint32_t released{null_slot};
+    mutable std::uint64_t clock{};
+    size_type memory{};
+    size_type limit{(std::numeric_limits<size_type>::max)()};
 };
 
 } // namespace entt
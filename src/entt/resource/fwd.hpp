@@ -8,12 +8,21 @@ namespace entt {
 template<typename>
 struct resource_loader;
 
+template<typename>
+struct slab_resource_loader;
+
+template<typename>
+struct resource_cost;
+
 template<typename Type, typename = resource_loader<Type>, typename = std::allocator<Type>>
 class resource_cache;
 
 template<typename>
 class resource;
 
+template<typename>
+class resource_slot;
+
 } // namespace entt
 
 #endif
@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <utility>
+#include "../core/slab_pool.hpp"
 #include "fwd.hpp"
 
 namespace entt {
@@ -28,6 +29,61 @@ struct resource_loader {
     }
 };
 
+/**
+ * @brief Loader that allocates shared resources from a slab pool.
+ *
+ * Resources and their control blocks are allocated at once from the chunks of
+ * a pool shared by all copies of the loader. Therefore, creating and destroying
+ * a resource doesn't involve the global allocator most of the time and
+ * resources of the same type are next to each other in memory.
+ *
+ * @warning
+ * Slab pools aren't synchronized. A loader must not be used by multiple threads
+ * at the same time, nor can resources be released concurrently.
+ *
+ * @tparam Type Type of resources created by the loader.
+ */
+template<typename Type>
+struct slab_resource_loader {
+    /*! @brief Result type. */
+    using result_type = std::shared_ptr<Type>;
+    /*! @brief Allocator type. */
+    using allocator_type = slab_pool_allocator<Type>;
+
+    /*! @brief Default constructor, creates a new pool. */
+    slab_resource_loader()
+        : allocator{} {}
+
+    /**
+     * @brief Constructs a loader that uses a given allocator.
+     * @param alloc The allocator to use.
+     */
+    explicit slab_resource_loader(const allocator_type &alloc) noexcept
+        : allocator{alloc} {}
+
+    /**
+     * @brief Constructs a shared pointer to a resource from its arguments.
+     * @tparam Args Types of arguments to use to construct the resource.
+     * @param args Parameters to use to construct the resource.
+     * @return A shared pointer to a resource of the given type.
+     */
+    template<typename... Args>
+    result_type operator()(Args &&...args) const {
+        return std::allocate_shared<Type>(allocator, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] allocator_type get_allocator() const noexcept {
+        return allocator;
+    }
+
+private:
+    allocator_type allocator;
+};
+
 } // namespace entt
 
 #endif
@@ -1,6 +1,8 @@
 #ifndef ENTT_RESOURCE_RESOURCE_HPP
 #define ENTT_RESOURCE_RESOURCE_HPP
 
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -158,6 +160,19 @@ public:
         return static_cast<bool>(value);
     }
 
+    /**
+     * @brief Returns true if a handle refers to a resource that is still being
+     * loaded, false otherwise.
+     *
+     * Pending handles don't contain a resource and don't turn into valid ones
+     * once it's loaded. Ask the cache for a new handle instead.
+     *
+     * @return True if the resource is still being loaded, false otherwise.
+     */
+    [[nodiscard]] bool pending() const noexcept {
+        return !value && (value.use_count() != 0);
+    }
+
     /*! @brief Releases the ownership of the managed resource. */
     void reset() {
         value.reset();
@@ -263,6 +278,71 @@ template<typename Lhs, typename Rhs>
     return !(lhs < rhs);
 }
 
+/**
+ * @brief Lightweight resource handle backed by the slots of a cache.
+ *
+ * Slot handles are made of an index and a generation. Unlike resource handles,
+ * they are trivially copyable and don't extend the lifetime of the resources
+ * they refer to. Their cache resolves them to a resource as long as it's still
+ * alive and returns a null pointer otherwise.
+ *
+ * @tparam Type Type of resource referred to by a handle.
+ */
+template<typename Type>
+class resource_slot {
+    template<typename, typename, typename>
+    friend class resource_cache;
+
+    resource_slot(const std::uint32_t pos, const std::uint32_t gen) noexcept
+        : index{pos},
+          version{gen} {}
+
+public:
+    /*! @brief Resource type. */
+    using element_type = Type;
+
+    /*! @brief Default constructor. */
+    constexpr resource_slot() noexcept = default;
+
+    /**
+     * @brief Returns false for default constructed handles, true otherwise.
+     *
+     * @warning
+     * Non-null handles can still refer to resources that don't exist anymore.
+     *
+     * @return False for default constructed handles, true otherwise.
+     */
+    [[nodiscard]] constexpr explicit operator bool() const noexcept {
+        return (index != null);
+    }
+
+    /**
+     * @brief Compares two handles.
+     * @param other A handle to compare with.
+     * @return True if the handles refer to the same slot and generation, false
+     * otherwise.
+     */
+    [[nodiscard]] constexpr bool operator==(const resource_slot &other) const noexcept {
+        return (index == other.index) && (version == other.version);
+    }
+
+    /**
+     * @brief Compares two handles.
+     * @param other A handle to compare with.
+     * @return False if the handles refer to the same slot and generation, true
+     * otherwise.
+     */
+    [[nodiscard]] constexpr bool operator!=(const resource_slot &other) const noexcept {
+        return !(*this == other);
+    }
+
+private:
+    static constexpr std::uint32_t null = (std::numeric_limits<std::uint32_t>::max)();
+
+    std::uint32_t index{null};
+    std::uint32_t version{};
+};
+
 } // namespace entt
 
 #endif
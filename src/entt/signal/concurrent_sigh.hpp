@@ -0,0 +1,491 @@
+#ifndef ENTT_SIGNAL_CONCURRENT_SIGH_HPP
+#define ENTT_SIGNAL_CONCURRENT_SIGH_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/compressed_pair.hpp"
+#include "delegate.hpp"
+#include "fwd.hpp"
+#include "sigh.hpp"
+
+namespace entt {
+
+/**
+ * @brief Unmanaged signal handler for concurrent use.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error unless the template parameter is a function type.
+ *
+ * @tparam Type A valid function type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Type, typename Allocator>
+class concurrent_sigh;
+
+/**
+ * @brief Unmanaged signal handler for concurrent use.
+ *
+ * It works like the `sigh` class but listeners can be connected and
+ * disconnected from any thread while other threads publish the signal.<br/>
+ * Publishing doesn't take locks. Listeners are stored in an immutable array
+ * that publishers read, while connecting or disconnecting a listener replaces
+ * the array with an updated copy. Old arrays are released once all the
+ * publishers that could see them are done with it.
+ *
+ * @warning
+ * Connecting or disconnecting listeners from within a listener of the same
+ * signal results in a deadlock.
+ *
+ * @tparam Ret Return type of a function type.
+ * @tparam Args Types of arguments of a function type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Ret, typename... Args, typename Allocator>
+class concurrent_sigh<Ret(Args...), Allocator> {
+    friend class sink<concurrent_sigh<Ret(Args...), Allocator>>;
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using delegate_type = delegate<Ret(Args...)>;
+    using container_type = std::vector<delegate_type, typename alloc_traits::template rebind_alloc<delegate_type>>;
+    using container_alloc = typename alloc_traits::template rebind_alloc<container_type>;
+    using container_traits = std::allocator_traits<container_alloc>;
+
+    [[nodiscard]] std::size_t lock() const noexcept {
+        for(;;) {
+            const auto slot = epoch.load() & 1u;
+            readers[slot].fetch_add(1u);
+
+            // the writer may have moved to the next epoch in the meantime
+            if((epoch.load() & 1u) == slot) {
+                return slot;
+            }
+
+            readers[slot].fetch_sub(1u);
+        }
+    }
+
+    void unlock(const std::size_t slot) const noexcept {
+        readers[slot].fetch_sub(1u, std::memory_order_release);
+    }
+
+    void release(container_type *curr) {
+        if(curr) {
+            container_alloc alloc{get_allocator()};
+            container_traits::destroy(alloc, curr);
+            container_traits::deallocate(alloc, curr, 1u);
+        }
+    }
+
+    template<typename Func>
+    void modify(Func func) {
+        const std::lock_guard<std::mutex> guard{mutex};
+        container_alloc alloc{get_allocator()};
+        container_type *curr = container_traits::allocate(alloc, 1u);
+
+        ENTT_TRY {
+            if(const auto *prev = snapshot.first().load(std::memory_order_relaxed); prev) {
+                container_traits::construct(alloc, curr, *prev);
+            } else {
+                container_traits::construct(alloc, curr, get_allocator());
+            }
+        }
+        ENTT_CATCH {
+            container_traits::deallocate(alloc, curr, 1u);
+            ENTT_THROW;
+        }
+
+        ENTT_TRY {
+            func(*curr);
+        }
+        ENTT_CATCH {
+            release(curr);
+            ENTT_THROW;
+        }
+
+        if(curr->empty()) {
+            release(std::exchange(curr, nullptr));
+        }
+
+        auto *prev = snapshot.first().exchange(curr);
+        const auto slot = epoch.fetch_add(1u) & 1u;
+
+        // waits for the publishers that could see the previous array
+        while(readers[slot].load(std::memory_order_acquire) != 0u) {
+            std::this_thread::yield();
+        }
+
+        release(prev);
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Sink type. */
+    using sink_type = sink<concurrent_sigh<Ret(Args...), Allocator>>;
+
+    /*! @brief Default constructor. */
+    concurrent_sigh() noexcept(noexcept(allocator_type{}))
+        : concurrent_sigh{allocator_type{}} {}
+
+    /**
+     * @brief Constructs a signal handler with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit concurrent_sigh(const allocator_type &allocator) noexcept
+        : snapshot{nullptr, allocator},
+          epoch{},
+          readers{},
+          mutex{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    concurrent_sigh(const concurrent_sigh &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    concurrent_sigh(concurrent_sigh &&) = delete;
+
+    /*! @brief Destructor. */
+    ~concurrent_sigh() {
+        release(snapshot.first().load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This signal handler.
+     */
+    concurrent_sigh &operator=(const concurrent_sigh &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This signal handler.
+     */
+    concurrent_sigh &operator=(concurrent_sigh &&) = delete;
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return snapshot.second();
+    }
+
+    /**
+     * @brief Number of listeners connected to the signal.
+     * @return Number of listeners currently connected.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        const auto slot = lock();
+        const auto *curr = snapshot.first().load(std::memory_order_acquire);
+        const auto len = curr ? curr->size() : 0u;
+        unlock(slot);
+        return len;
+    }
+
+    /**
+     * @brief Returns false if at least a listener is connected to the signal.
+     * @return True if the signal has no listeners connected, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return snapshot.first().load(std::memory_order_relaxed) == nullptr;
+    }
+
+    /**
+     * @brief Triggers a signal.
+     *
+     * All the listeners connected when the function is invoked are notified.
+     * Order isn't guaranteed.
+     *
+     * @param args Arguments to use to invoke listeners.
+     */
+    void publish(Args... args) const {
+        collect([]() {}, args...);
+    }
+
+    /**
+     * @brief Collects return values from the listeners.
+     *
+     * @sa sigh::collect
+     *
+     * @tparam Func Type of collector to use, if any.
+     * @param func A valid function object.
+     * @param args Arguments to use to invoke listeners.
+     */
+    template<typename Func>
+    void collect(Func func, Args... args) const {
+        if(empty()) {
+            return;
+        }
+
+        struct guard_type {
+            ~guard_type() {
+                self->unlock(slot);
+            }
+
+            const concurrent_sigh *self;
+            std::size_t slot;
+        } guard{this, lock()};
+
+        if(const auto *curr = snapshot.first().load(std::memory_order_acquire); curr) {
+            for(auto pos = curr->size(); pos; --pos) {
+                if constexpr(std::is_void_v<Ret> || !std::is_invocable_v<Func, Ret>) {
+                    (*curr)[pos - 1u](args...);
+
+                    if constexpr(std::is_invocable_r_v<bool, Func>) {
+                        if(func()) {
+                            break;
+                        }
+                    } else {
+                        func();
+                    }
+                } else {
+                    if constexpr(std::is_invocable_r_v<bool, Func, Ret>) {
+                        if(func((*curr)[pos - 1u](args...))) {
+                            break;
+                        }
+                    } else {
+                        func((*curr)[pos - 1u](args...));
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    compressed_pair<std::atomic<container_type *>, allocator_type> snapshot;
+    std::atomic<size_type> epoch;
+    mutable std::array<std::atomic<size_type>, 2u> readers;
+    std::mutex mutex;
+};
+
+/**
+ * @brief Sink class for concurrent signals.
+ *
+ * It offers the same interface of the sink class for the `sigh` class and all
+ * its functions are thread safe.
+ *
+ * @warning
+ * Lifetime of a sink must not overcome that of the signal to which it refers.
+ * In any other case, attempting to use a sink results in undefined behavior.
+ *
+ * @tparam Ret Return type of a function type.
+ * @tparam Args Types of arguments of a function type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Ret, typename... Args, typename Allocator>
+class sink<concurrent_sigh<Ret(Args...), Allocator>> {
+    using signal_type = concurrent_sigh<Ret(Args...), Allocator>;
+    using delegate_type = typename signal_type::delegate_type;
+    using container_type = typename signal_type::container_type;
+
+    template<auto Candidate, typename Type>
+    static void release(Type value_or_instance, void *signal) {
+        sink{*static_cast<signal_type *>(signal)}.disconnect<Candidate>(value_or_instance);
+    }
+
+    template<auto Candidate>
+    static void release(void *signal) {
+        sink{*static_cast<signal_type *>(signal)}.disconnect<Candidate>();
+    }
+
+    template<typename Func>
+    static void disconnect_if(container_type &calls, Func callback) {
+        for(auto pos = calls.size(); pos; --pos) {
+            if(auto &elem = calls[pos - 1u]; callback(elem)) {
+                elem = std::move(calls.back());
+                calls.pop_back();
+            }
+        }
+    }
+
+    void replace(delegate_type call) {
+        signal_or_assert().modify([&call](container_type &calls) {
+            disconnect_if(calls, [&call](const auto &elem) { return elem == call; });
+            calls.push_back(std::move(call));
+        });
+    }
+
+    void remove(delegate_type call) {
+        signal_or_assert().modify([&call](container_type &calls) {
+            disconnect_if(calls, [&call](const auto &elem) { return elem == call; });
+        });
+    }
+
+    [[nodiscard]] auto &signal_or_assert() const noexcept {
+        ENTT_ASSERT(signal != nullptr, "Invalid pointer to signal");
+        return *signal;
+    }
+
+public:
+    /*! @brief Constructs an invalid sink. */
+    sink() noexcept
+        : signal{} {}
+
+    /**
+     * @brief Constructs a sink that is allowed to modify a given signal.
+     * @param ref A valid reference to a signal object.
+     */
+    sink(concurrent_sigh<Ret(Args...), Allocator> &ref) noexcept
+        : signal{&ref} {}
+
+    /**
+     * @brief Returns false if at least a listener is connected to the sink.
+     * @return True if the sink has no listeners connected, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return signal_or_assert().empty();
+    }
+
+    /**
+     * @brief Connects a free function or an unbound member to a signal.
+     * @tparam Candidate Function or member to connect to the signal.
+     * @return A properly initialized connection object.
+     */
+    template<auto Candidate>
+    connection connect() {
+        delegate_type call{};
+        call.template connect<Candidate>();
+        replace(call);
+
+        delegate<void(void *)> conn{};
+        conn.template connect<&release<Candidate>>();
+        return {conn, signal};
+    }
+
+    /**
+     * @brief Connects a free function with payload or a bound member to a
+     * signal.
+     *
+     * @sa sink<sigh<Ret(Args...), Allocator>>::connect(Type &)
+     *
+     * @tparam Candidate Function or member to connect to the signal.
+     * @tparam Type Type of class or type of payload.
+     * @param value_or_instance A valid reference that fits the purpose.
+     * @return A properly initialized connection object.
+     */
+    template<auto Candidate, typename Type>
+    connection connect(Type &value_or_instance) {
+        delegate_type call{};
+        call.template connect<Candidate>(value_or_instance);
+        replace(call);
+
+        delegate<void(void *)> conn{};
+        conn.template connect<&release<Candidate, Type &>>(value_or_instance);
+        return {conn, signal};
+    }
+
+    /**
+     * @brief Connects a free function with payload or a bound member to a
+     * signal.
+     *
+     * @sa sink<sigh<Ret(Args...), Allocator>>::connect(Type *)
+     *
+     * @tparam Candidate Function or member to connect to the signal.
+     * @tparam Type Type of class or type of payload.
+     * @param value_or_instance A valid pointer that fits the purpose.
+     * @return A properly initialized connection object.
+     */
+    template<auto Candidate, typename Type>
+    connection connect(Type *value_or_instance) {
+        delegate_type call{};
+        call.template connect<Candidate>(value_or_instance);
+        replace(call);
+
+        delegate<void(void *)> conn{};
+        conn.template connect<&release<Candidate, Type *>>(value_or_instance);
+        return {conn, signal};
+    }
+
+    /**
+     * @brief Disconnects a free function or an unbound member from a signal.
+     * @tparam Candidate Function or member to disconnect from the signal.
+     */
+    template<auto Candidate>
+    void disconnect() {
+        delegate_type call{};
+        call.template connect<Candidate>();
+        remove(call);
+    }
+
+    /**
+     * @brief Disconnects a free function with payload or a bound member from a
+     * signal.
+     * @tparam Candidate Function or member to disconnect from the signal.
+     * @tparam Type Type of class or type of payload, if any.
+     * @param value_or_instance A valid reference that fits the purpose.
+     */
+    template<auto Candidate, typename Type>
+    void disconnect(Type &value_or_instance) {
+        delegate_type call{};
+        call.template connect<Candidate>(value_or_instance);
+        remove(call);
+    }
+
+    /**
+     * @brief Disconnects a free function with payload or a bound member from a
+     * signal.
+     * @tparam Candidate Function or member to disconnect from the signal.
+     * @tparam Type Type of class or type of payload, if any.
+     * @param value_or_instance A valid pointer that fits the purpose.
+     */
+    template<auto Candidate, typename Type>
+    void disconnect(Type *value_or_instance) {
+        delegate_type call{};
+        call.template connect<Candidate>(value_or_instance);
+        remove(call);
+    }
+
+    /**
+     * @brief Disconnects free functions with payload or bound members from a
+     * signal.
+     * @param value_or_instance A valid object that fits the purpose.
+     */
+    void disconnect(const void *value_or_instance) {
+        ENTT_ASSERT(value_or_instance != nullptr, "Invalid value or instance");
+
+        signal_or_assert().modify([value_or_instance](container_type &calls) {
+            disconnect_if(calls, [value_or_instance](const auto &elem) { return elem.data() == value_or_instance; });
+        });
+    }
+
+    /*! @brief Disconnects all the listeners from a signal. */
+    void disconnect() {
+        signal_or_assert().modify([](container_type &calls) { calls.clear(); });
+    }
+
+    /**
+     * @brief Returns true if a sink is correctly initialized, false otherwise.
+     * @return True if a sink is correctly initialized, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return signal != nullptr;
+    }
+
+private:
+    signal_type *signal;
+};
+
+/**
+ * @brief Deduction guide.
+ *
+ * It allows to deduce the signal handler type of a sink directly from the
+ * signal it refers to.
+ *
+ * @tparam Ret Return type of a function type.
+ * @tparam Args Types of arguments of a function type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Ret, typename... Args, typename Allocator>
+sink(concurrent_sigh<Ret(Args...), Allocator> &) -> sink<concurrent_sigh<Ret(Args...), Allocator>>;
+
+} // namespace entt
+
+#endif
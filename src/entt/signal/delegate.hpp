@@ -2,7 +2,9 @@
 #define ENTT_SIGNAL_DELEGATE_HPP
 
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <new>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -321,6 +323,248 @@ delegate(connect_arg_t<Candidate>, Type &&) -> delegate<std::remove_pointer_t<in
 template<typename Ret, typename... Args>
 delegate(Ret (*)(const void *, Args...), const void * = nullptr) -> delegate<Ret(Args...)>;
 
+/**
+ * @brief Owning delegate implementation.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error unless the template parameter is a function type.
+ */
+template<typename, std::size_t, std::size_t>
+class basic_owning_delegate;
+
+/**
+ * @brief Utility class to use to send around callable objects with state.
+ *
+ * Unlike a delegate, an owning delegate stores a copy of the callable object
+ * it's constructed with, along with its captured state. Small objects are
+ * stored in place, others are allocated on the heap. It makes it easy to attach
+ * stateful lambdas to signals without keeping their state alive elsewhere.
+ *
+ * @tparam Ret Return type of a function type.
+ * @tparam Args Types of arguments of a function type.
+ * @tparam Len Size of the storage reserved for the small buffer optimization.
+ * @tparam Align Optional alignment requirement.
+ */
+template<typename Ret, typename... Args, std::size_t Len, std::size_t Align>
+class basic_owning_delegate<Ret(Args...), Len, Align> {
+    enum class operation : std::uint8_t {
+        copy,
+        move,
+        destroy
+    };
+
+    using function_type = Ret(const void *, Args...);
+    using vtable_type = void(const operation, basic_owning_delegate &, basic_owning_delegate *);
+
+    struct storage_type {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+        alignas(Align) std::byte data[Len + static_cast<std::size_t>(Len == 0u)];
+    };
+
+    template<typename Type>
+    // NOLINTNEXTLINE(bugprone-sizeof-expression)
+    static constexpr bool in_situ = (Len != 0u) && alignof(Type) <= Align && sizeof(Type) <= Len && std::is_nothrow_move_constructible_v<Type>;
+
+    template<typename Type>
+    static Ret invoke(const void *value, Args... args) {
+        // NOLINTNEXTLINE(bugprone-casting-through-void)
+        return static_cast<Ret>(std::invoke(*static_cast<Type *>(const_cast<void *>(value)), std::forward<Args>(args)...));
+    }
+
+    template<typename Type>
+    static void basic_vtable(const operation op, basic_owning_delegate &value, [[maybe_unused]] basic_owning_delegate *other) {
+        auto *elem = static_cast<Type *>(value.instance);
+
+        switch(op) {
+        case operation::copy:
+            if constexpr(std::is_copy_constructible_v<Type>) {
+                other->template initialize<Type>(std::as_const(*elem));
+            }
+            break;
+        case operation::move:
+            if constexpr(in_situ<Type>) {
+                other->instance = ::new(&other->storage) Type{std::move(*elem)};
+                elem->~Type();
+            } else {
+                other->instance = elem;
+            }
+
+            other->fn = value.fn;
+            other->vtable = value.vtable;
+            break;
+        case operation::destroy:
+            if constexpr(in_situ<Type>) {
+                elem->~Type();
+            } else {
+                delete elem;
+            }
+            break;
+        }
+    }
+
+    template<typename Type, typename... Other>
+    void initialize(Other &&...other) {
+        if constexpr(in_situ<Type>) {
+            instance = ::new(&storage) Type(std::forward<Other>(other)...);
+        } else {
+            instance = new Type(std::forward<Other>(other)...);
+        }
+
+        fn = &invoke<Type>;
+        vtable = &basic_vtable<Type>;
+    }
+
+    void release() noexcept {
+        if(vtable) {
+            vtable(operation::destroy, *this, nullptr);
+        }
+    }
+
+public:
+    /*! @brief Default constructor. */
+    basic_owning_delegate() noexcept
+        : storage{},
+          instance{},
+          fn{},
+          vtable{} {}
+
+    /**
+     * @brief Constructs an owning delegate from a callable object.
+     * @tparam Type Type of callable object.
+     * @param value The callable object to copy or move in the delegate.
+     */
+    template<typename Type, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Type>, basic_owning_delegate> && std::is_invocable_r_v<Ret, std::decay_t<Type> &, Args...>>>
+    // NOLINTNEXTLINE(bugprone-forwarding-reference-overload)
+    basic_owning_delegate(Type &&value)
+        : basic_owning_delegate{} {
+        initialize<std::decay_t<Type>>(std::forward<Type>(value));
+    }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * The resulting delegate is empty if the callable object isn't copyable.
+     *
+     * @param other The instance to copy from.
+     */
+    basic_owning_delegate(const basic_owning_delegate &other)
+        : basic_owning_delegate{} {
+        if(other.vtable) {
+            other.vtable(operation::copy, const_cast<basic_owning_delegate &>(other), this);
+        }
+    }
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    basic_owning_delegate(basic_owning_delegate &&other) noexcept
+        : basic_owning_delegate{} {
+        if(other.vtable) {
+            other.vtable(operation::move, other, this);
+            other.instance = nullptr;
+            other.fn = nullptr;
+            other.vtable = nullptr;
+        }
+    }
+
+    /*! @brief Frees the internal storage, whatever it means. */
+    ~basic_owning_delegate() {
+        release();
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     * @param other The instance to copy from.
+     * @return This owning delegate.
+     */
+    basic_owning_delegate &operator=(const basic_owning_delegate &other) {
+        if(this != &other) {
+            basic_owning_delegate copy{other};
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This owning delegate.
+     */
+    basic_owning_delegate &operator=(basic_owning_delegate &&other) noexcept {
+        if(this != &other) {
+            reset();
+
+            if(other.vtable) {
+                other.vtable(operation::move, other, this);
+                other.instance = nullptr;
+                other.fn = nullptr;
+                other.vtable = nullptr;
+            }
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Resets an owning delegate and destroys its callable object.
+     *
+     * After a reset, a delegate cannot be invoked anymore.
+     */
+    void reset() noexcept {
+        release();
+        instance = nullptr;
+        fn = nullptr;
+        vtable = nullptr;
+    }
+
+    /**
+     * @brief Returns an opaque pointer to the stored callable object, if any.
+     * @return An opaque pointer to the stored callable object, if any.
+     */
+    [[nodiscard]] const void *data() const noexcept {
+        return instance;
+    }
+
+    /**
+     * @brief Checks whether the callable object is stored in place.
+     * @return True if the callable object is stored in place, false otherwise.
+     */
+    [[nodiscard]] bool in_place() const noexcept {
+        return (instance == static_cast<const void *>(&storage));
+    }
+
+    /**
+     * @brief Triggers an owning delegate.
+     *
+     * @warning
+     * Attempting to trigger an invalid delegate results in undefined
+     * behavior.
+     *
+     * @param args Arguments to use to invoke the underlying callable object.
+     * @return The value returned by the underlying callable object.
+     */
+    Ret operator()(Args... args) const {
+        ENTT_ASSERT(static_cast<bool>(*this), "Uninitialized delegate");
+        return fn(instance, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Checks whether an owning delegate actually stores a callable.
+     * @return False if the delegate is empty, true otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return !(fn == nullptr);
+    }
+
+private:
+    storage_type storage;
+    void *instance;
+    function_type *fn;
+    vtable_type *vtable;
+};
+
 } // namespace entt
 
 #endif
@@ -1,15 +1,22 @@
 #ifndef ENTT_SIGNAL_DISPATCHER_HPP
 #define ENTT_SIGNAL_DISPATCHER_HPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
+#include "../config/config.h"
 #include "../container/dense_map.hpp"
+#include "../container/dense_set.hpp"
 #include "../core/compressed_pair.hpp"
 #include "../core/fwd.hpp"
+#include "../core/iterator.hpp"
+#include "../core/monotonic_pool.hpp"
 #include "../core/type_info.hpp"
 #include "../core/utility.hpp"
 #include "fwd.hpp"
@@ -26,65 +33,264 @@ struct basic_dispatcher_handler {
     virtual void disconnect(void *) = 0;
     virtual void clear() noexcept = 0;
     [[nodiscard]] virtual std::size_t size() const noexcept = 0;
+    int priority{};
+};
+
+template<typename Type, typename... Args>
+[[nodiscard]] Type make_dispatcher_event(Args &&...args) {
+    if constexpr(std::is_aggregate_v<Type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<Type>)) {
+        return Type{std::forward<Args>(args)...};
+    } else {
+        return Type(std::forward<Args>(args)...);
+    }
+}
+
+template<typename Type>
+struct basic_dispatcher_coalescer {
+    virtual ~basic_dispatcher_coalescer() = default;
+    [[nodiscard]] virtual bool insert(const Type &) = 0;
+    virtual void clear() noexcept = 0;
+};
+
+template<typename Type, auto Key, typename Allocator>
+class dispatcher_coalescer final: public basic_dispatcher_coalescer<Type> {
+    using key_type = std::decay_t<std::invoke_result_t<decltype(Key), const Type &>>;
+    using container_type = dense_set<key_type, std::hash<key_type>, std::equal_to<>, typename std::allocator_traits<Allocator>::template rebind_alloc<key_type>>;
+
+public:
+    dispatcher_coalescer(const Allocator &allocator)
+        : keys{allocator} {}
+
+    [[nodiscard]] bool insert(const Type &value) override {
+        return keys.insert(std::invoke(Key, value)).second;
+    }
+
+    void clear() noexcept override {
+        keys.clear();
+    }
+
+private:
+    container_type keys;
 };
 
 template<typename Type, typename Allocator>
 class dispatcher_handler final: public basic_dispatcher_handler {
     static_assert(std::is_same_v<Type, std::decay_t<Type>>, "Invalid type");
 
+    struct node_type {
+        template<typename... Args>
+        node_type(Args &&...args)
+            : value{make_dispatcher_event<Type>(std::forward<Args>(args)...)} {}
+
+        Type value;
+        node_type *next{};
+    };
+
     using alloc_traits = std::allocator_traits<Allocator>;
     using signal_type = sigh<void(Type &), Allocator>;
+    using batch_type = sigh<void(iterable_adaptor<Type *>), Allocator>;
     using container_type = std::vector<Type, typename alloc_traits::template rebind_alloc<Type>>;
+    using node_allocator = typename alloc_traits::template rebind_alloc<node_type>;
+    using node_traits = std::allocator_traits<node_allocator>;
+    using arena_allocator = monotonic_pool_allocator<std::byte>;
+
+    [[nodiscard]] node_type *acquire(std::size_t &count) noexcept {
+        node_type *prev = nullptr;
+
+        // producers push on top of the stack, newest events come first
+        if(head.load(std::memory_order_relaxed) != nullptr) {
+            for(node_type *curr = head.exchange(nullptr, std::memory_order_acquire); curr; ++count) {
+                std::swap(curr->next, prev);
+                std::swap(curr, prev);
+            }
+
+            pending.fetch_sub(count, std::memory_order_relaxed);
+        }
+
+        return prev;
+    }
+
+    template<typename Func>
+    void release(node_type *curr, Func func) noexcept(std::is_nothrow_invocable_v<Func, Type &>) {
+        node_allocator allocator{events.get_allocator()};
+
+        for(node_type *next{}; curr; curr = next) {
+            next = curr->next;
+            func(curr->value);
+            node_traits::destroy(allocator, curr);
+            node_traits::deallocate(allocator, curr, 1u);
+        }
+    }
+
+    void drain() {
+        std::size_t count{};
+
+        if(auto *curr = acquire(count); curr) {
+            events.reserve(events.size() + count);
+            release(curr, [this](Type &value) {
+                if(!coalescer || coalescer->insert(value)) {
+                    events.push_back(std::move(value));
+                }
+            });
+        }
+    }
+
+    void discard() noexcept {
+        std::size_t count{};
+        release(acquire(count), [](Type &) noexcept {});
+    }
 
 public:
     using allocator_type = Allocator;
 
     dispatcher_handler(const allocator_type &allocator)
         : signal{allocator},
-          events{allocator} {}
+          batch{allocator},
+          events{allocator},
+          spare{allocator},
+          coalescer{} {}
+
+    dispatcher_handler(const dispatcher_handler &) = delete;
+    dispatcher_handler(dispatcher_handler &&) = delete;
+
+    ~dispatcher_handler() override {
+        discard();
+    }
+
+    dispatcher_handler &operator=(const dispatcher_handler &) = delete;
+    dispatcher_handler &operator=(dispatcher_handler &&) = delete;
 
     void publish() override {
-        const auto length = events.size();
+        ENTT_SIGNAL_SCOPE(type_id<Type>(), signal.size() + batch.size());
+        drain();
+
+        // events enqueued by listeners go to the other buffer and wait for the next update
+        container_type curr{std::move(spare)};
+        curr.clear();
+        curr.swap(events);
+        // events enqueued by listeners draw from the other arena
+        const auto used = std::exchange(active, active ^ 1u);
+
+        if(coalescer) {
+            coalescer->clear();
+        }
+
+        if(!batch.empty() && !curr.empty()) {
+            batch.publish(iterable_adaptor<Type *>{curr.data(), curr.data() + curr.size()});
+        }
 
-        for(std::size_t pos{}; pos < length; ++pos) {
-            signal.publish(events[pos]);
+        if(!signal.empty()) {
+            for(auto &&elem: curr) {
+                signal.publish(elem);
+            }
         }
 
-        events.erase(events.cbegin(), events.cbegin() + static_cast<typename container_type::difference_type>(length));
+        curr.clear();
+        arena[used].reset();
+        spare = std::move(curr);
     }
 
     void disconnect(void *instance) override {
         bucket().disconnect(instance);
+        batch_bucket().disconnect(instance);
     }
 
     void clear() noexcept override {
+        discard();
         events.clear();
+        arena[active].reset();
+
+        if(coalescer) {
+            coalescer->clear();
+        }
+    }
+
+    template<auto Key>
+    void coalesce() {
+        ENTT_ASSERT(size() == 0u, "Queue not empty");
+        const auto allocator = events.get_allocator();
+        coalescer = std::allocate_shared<dispatcher_coalescer<Type, Key, typename container_type::allocator_type>>(allocator, allocator);
     }
 
     [[nodiscard]] auto bucket() noexcept {
         return typename signal_type::sink_type{signal};
     }
 
+    [[nodiscard]] auto batch_bucket() noexcept {
+        return typename batch_type::sink_type{batch};
+    }
+
     void trigger(Type event) {
+        batch.publish(iterable_adaptor<Type *>{&event, &event + 1});
         signal.publish(event);
     }
 
     template<typename... Args>
     void enqueue(Args &&...args) {
-        if constexpr(std::is_aggregate_v<Type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<Type>)) {
+        if constexpr(std::uses_allocator_v<Type, arena_allocator> && std::is_constructible_v<Type, std::allocator_arg_t, const arena_allocator &, Args...>) {
+            events.emplace_back(std::allocator_arg, arena_allocator{arena[active]}, std::forward<Args>(args)...);
+        } else if constexpr(std::uses_allocator_v<Type, arena_allocator> && std::is_constructible_v<Type, Args..., const arena_allocator &>) {
+            events.emplace_back(std::forward<Args>(args)..., arena_allocator{arena[active]});
+        } else if constexpr(std::is_aggregate_v<Type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<Type>)) {
             events.push_back(Type{std::forward<Args>(args)...});
         } else {
             events.emplace_back(std::forward<Args>(args)...);
         }
+
+        if(coalescer && !coalescer->insert(events.back())) {
+            events.pop_back();
+        }
+    }
+
+    template<typename... Args>
+    void enqueue_concurrent(Args &&...args) {
+        node_allocator allocator{events.get_allocator()};
+        node_type *node = node_traits::allocate(allocator, 1u);
+
+        ENTT_TRY {
+            node_traits::construct(allocator, node, std::forward<Args>(args)...);
+        }
+        ENTT_CATCH {
+            node_traits::deallocate(allocator, node, 1u);
+            ENTT_THROW;
+        }
+
+        node->next = head.load(std::memory_order_relaxed);
+        while(!head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {}
+        pending.fetch_add(1u, std::memory_order_relaxed);
     }
 
     [[nodiscard]] std::size_t size() const noexcept override {
-        return events.size();
+        return events.size() + pending.load(std::memory_order_relaxed);
     }
 
 private:
     signal_type signal;
+    batch_type batch;
     container_type events;
+    container_type spare;
+    std::shared_ptr<basic_dispatcher_coalescer<Type>> coalescer;
+    std::array<monotonic_pool, 2u> arena;
+    std::size_t active{};
+    std::atomic<node_type *> head{};
+    std::atomic<std::size_t> pending{};
+};
+
+template<typename Type, typename Allocator>
+class dispatcher_producer {
+    using handler_type = dispatcher_handler<Type, Allocator>;
+
+public:
+    dispatcher_producer(handler_type &ref) noexcept
+        : handler{&ref} {}
+
+    template<typename... Args>
+    void enqueue(Args &&...args) const {
+        handler->enqueue_concurrent(std::forward<Args>(args)...);
+    }
+
+private:
+    handler_type *handler;
 };
 
 } // namespace internal
@@ -116,6 +322,13 @@ class basic_dispatcher {
     using alloc_traits = std::allocator_traits<Allocator>;
     using container_allocator = typename alloc_traits::template rebind_alloc<std::pair<const key_type, mapped_type>>;
     using container_type = dense_map<key_type, mapped_type, identity, std::equal_to<>, container_allocator>;
+    using order_type = std::vector<internal::basic_dispatcher_handler *, typename alloc_traits::template rebind_alloc<internal::basic_dispatcher_handler *>>;
+
+    void arrange(internal::basic_dispatcher_handler &handler) {
+        // queues that get a priority last come after those with the same one
+        const auto it = std::upper_bound(order.begin(), order.end(), handler.priority, [](const int value, const auto *other) { return other->priority < value; });
+        order.insert(it, &handler);
+    }
 
     template<typename Type>
     [[nodiscard]] handler_type<Type> &assure(const id_type id) {
@@ -124,7 +337,9 @@ class basic_dispatcher {
 
         if(!ptr) {
             const auto &allocator = get_allocator();
+            order.reserve(order.size() + 1u);
             ptr = std::allocate_shared<handler_type<Type>>(allocator, allocator);
+            arrange(*ptr);
         }
 
         return static_cast<handler_type<Type> &>(*ptr);
@@ -146,6 +361,8 @@ public:
     using allocator_type = Allocator;
     /*! @brief Unsigned integer type. */
     using size_type = std::size_t;
+    /*! @brief Allocator type handed to allocator-aware events. */
+    using arena_allocator_type = monotonic_pool_allocator<std::byte>;
 
     /*! @brief Default constructor. */
     basic_dispatcher()
@@ -156,7 +373,8 @@ public:
      * @param allocator The allocator to use.
      */
     explicit basic_dispatcher(const allocator_type &allocator)
-        : pools{allocator, allocator} {}
+        : pools{allocator, allocator},
+          order{allocator} {}
 
     /*! @brief Default copy constructor, deleted on purpose. */
     basic_dispatcher(const basic_dispatcher &) = delete;
@@ -166,7 +384,8 @@ public:
      * @param other The instance to move from.
      */
     basic_dispatcher(basic_dispatcher &&other) noexcept
-        : pools{std::move(other.pools)} {}
+        : pools{std::move(other.pools)},
+          order{std::move(other.order)} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -174,7 +393,8 @@ public:
      * @param allocator The allocator to use.
      */
     basic_dispatcher(basic_dispatcher &&other, const allocator_type &allocator)
-        : pools{container_type{std::move(other.pools.first()), allocator}, allocator} {
+        : pools{container_type{std::move(other.pools.first()), allocator}, allocator},
+          order{std::move(other.order), allocator} {
         ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a dispatcher is not allowed");
     }
 
@@ -205,6 +425,7 @@ public:
     void swap(basic_dispatcher &other) noexcept {
         using std::swap;
         swap(pools, other.pools);
+        swap(order, other.order);
     }
 
     /**
@@ -265,6 +486,32 @@ public:
         return assure<Type>(id).bucket();
     }
 
+    /**
+     * @brief Returns a sink object for batches of the given event and queue.
+     *
+     * A sink is an opaque object used to connect listeners to events.
+     *
+     * The function type for a batch listener is _compatible_ with:
+     *
+     * @code{.cpp}
+     * void(entt::iterable_adaptor<Type *>);
+     * @endcode
+     *
+     * Batch listeners receive all the events delivered by an update at once,
+     * as a contiguous range, and before any listener for single events.
+     * Triggered events are delivered to them as one-element ranges.
+     *
+     * @sa sink
+     *
+     * @tparam Type Type of event of which to get the sink.
+     * @param id Name used to map the event queue within the dispatcher.
+     * @return A temporary sink object.
+     */
+    template<typename Type>
+    [[nodiscard]] auto batch_sink(const id_type id = type_hash<Type>::value()) {
+        return assure<Type>(id).batch_bucket();
+    }
+
     /**
      * @brief Triggers an immediate event of a given type.
      * @tparam Type Type of event to trigger.
@@ -288,6 +535,17 @@ public:
 
     /**
      * @brief Enqueues an event of the given type.
+     *
+     * Allocator-aware events (that is, types for which `std::uses_allocator`
+     * holds for an `arena_allocator_type`) also receive an allocator, either
+     * after an `std::allocator_arg` tag or as their last argument. It draws
+     * memory from an arena of the queue that is reset once the event has
+     * been delivered.
+     *
+     * @warning
+     * Listeners must not keep memory allocated from the arena beyond the
+     * delivery of an event.
+     *
      * @tparam Type Type of event to enqueue.
      * @tparam Args Types of arguments to use to construct the event.
      * @param args Arguments to use to construct the event.
@@ -330,6 +588,56 @@ public:
         assure<std::decay_t<Type>>(id).enqueue(std::forward<Type>(value));
     }
 
+    /**
+     * @brief Returns a producer object for the given event and queue.
+     *
+     * A producer is an opaque object used to enqueue events from multiple
+     * threads at the same time, without external synchronization:
+     *
+     * @code{.cpp}
+     * producer.enqueue(args...);
+     * @endcode
+     *
+     * Events enqueued this way are delivered by the next call to `update`,
+     * after all those enqueued previously, and are discarded by `clear` like
+     * any other event. They are moved in the queue before delivering them and
+     * events from the same thread keep their relative order.
+     *
+     * @warning
+     * Producers must be created before other threads start using them and they
+     * are valid as long as the dispatcher is not destroyed. The allocator must
+     * be thread safe, since it is used by all the producers at once.<br/>
+     * Delivering or discarding events must still happen on a single thread.
+     *
+     * @tparam Type Type of event to enqueue.
+     * @param id Name used to map the event queue within the dispatcher.
+     * @return A producer object.
+     */
+    template<typename Type>
+    [[nodiscard]] auto producer(const id_type id = type_hash<Type>::value()) {
+        return internal::dispatcher_producer<Type, Allocator>{assure<Type>(id)};
+    }
+
+    /**
+     * @brief Makes a queue collapse duplicate events.
+     *
+     * Events are identified by the key returned by the projection. Once an
+     * event is enqueued, further events with the same key are discarded until
+     * the queue is delivered or cleared. Therefore, each key is delivered at
+     * most once per update. Triggered events aren't affected.
+     *
+     * @warning
+     * The queue must be empty when the policy is set.
+     *
+     * @tparam Type Type of event of the queue.
+     * @tparam Key A data member or a function that returns the key of an event.
+     * @param id Name used to map the event queue within the dispatcher.
+     */
+    template<typename Type, auto Key>
+    void coalesce(const id_type id = type_hash<Type>::value()) {
+        assure<Type>(id).template coalesce<Key>();
+    }
+
     /**
      * @brief Utility function to disconnect everything related to a given value
      * or instance from a dispatcher.
@@ -381,15 +689,36 @@ public:
         assure<Type>(id).publish();
     }
 
-    /*! @brief Delivers all the pending events. */
+    /**
+     * @brief Sets the priority of a given queue.
+     *
+     * Queues with higher priority are delivered first when updating all the
+     * queues at once. Queues with the same priority are delivered in the order
+     * in which they were created or got their priority. The default priority
+     * is zero.
+     *
+     * @tparam Type Type of event of the queue.
+     * @param value The priority of the queue.
+     * @param id Name used to map the event queue within the dispatcher.
+     */
+    template<typename Type>
+    void priority(const int value, const id_type id = type_hash<Type>::value()) {
+        auto &handler = assure<Type>(id);
+        order.erase(std::find(order.begin(), order.end(), &handler));
+        handler.priority = value;
+        arrange(handler);
+    }
+
+    /*! @brief Delivers all the pending events, in order of priority. */
     void update() const {
-        for(auto &&cpool: pools.first()) {
-            cpool.second->publish();
+        for(auto *cpool: order) {
+            cpool->publish();
         }
     }
 
 private:
     compressed_pair<container_type, allocator_type> pools;
+    order_type order;
 };
 
 } // namespace entt
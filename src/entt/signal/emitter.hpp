@@ -1,9 +1,14 @@
 #ifndef ENTT_SIGNAL_EMITTER_HPP
 #define ENTT_SIGNAL_EMITTER_HPP
 
+#include <cstddef>
 #include <functional>
+#include <limits>
+#include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
+#include "../config/config.h"
 #include "../container/dense_map.hpp"
 #include "../core/compressed_pair.hpp"
 #include "../core/fwd.hpp"
@@ -11,6 +16,10 @@
 #include "../core/utility.hpp"
 #include "fwd.hpp"
 
+#ifdef ENTT_USE_SIGNAL_TRACER
+#    include "../tools/signal_tracer.hpp"
+#endif
+
 namespace entt {
 
 /**
@@ -125,6 +134,7 @@ public:
     template<typename Type>
     void publish(Type value) {
         if(const auto id = type_id<Type>().hash(); handlers.first().contains(id)) {
+            ENTT_SIGNAL_SCOPE(type_id<Type>(), 1u);
             handlers.first()[id](&value);
         }
     }
@@ -177,6 +187,357 @@ private:
     compressed_pair<container_type, allocator_type> handlers;
 };
 
+/**
+ * @brief Shared storage for the handlers of pooled emitters.
+ *
+ * Handlers are grouped by type of event and indexed by emitter, so that an
+ * emitter doesn't allocate anything on its own.
+ *
+ * @warning
+ * A context must outlive all the emitters that refer to it.
+ *
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Allocator>
+class basic_emitter_context {
+    template<typename, typename>
+    friend class pooled_emitter;
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using handler_type = std::function<void(void *, void *)>;
+    using pool_allocator = typename alloc_traits::template rebind_alloc<std::pair<const std::size_t, handler_type>>;
+    using pool_type = dense_map<std::size_t, handler_type, identity, std::equal_to<>, pool_allocator>;
+    using container_allocator = typename alloc_traits::template rebind_alloc<std::pair<const id_type, pool_type>>;
+    using container_type = dense_map<id_type, pool_type, identity, std::equal_to<>, container_allocator>;
+    using free_list_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
+    using owner_container_type = std::vector<void *, typename alloc_traits::template rebind_alloc<void *>>;
+
+    [[nodiscard]] std::size_t acquire(void *instance) {
+        std::size_t slot = next;
+
+        if(free_list.empty()) {
+            owners.push_back(instance);
+            ++next;
+        } else {
+            slot = free_list.back();
+            free_list.pop_back();
+            owners[slot] = instance;
+        }
+
+        return slot;
+    }
+
+    void rebind(const std::size_t slot, void *instance) noexcept {
+        owners[slot] = instance;
+    }
+
+    void release(const std::size_t slot) {
+        for(auto &&elem: pools.first()) {
+            elem.second.erase(slot);
+        }
+
+        owners[slot] = nullptr;
+        free_list.push_back(slot);
+    }
+
+    [[nodiscard]] pool_type &assure(const id_type id) {
+        return pools.first().try_emplace(id, get_allocator()).first->second;
+    }
+
+    [[nodiscard]] const handler_type *find(const id_type id, const std::size_t slot) const {
+        if(const auto it = pools.first().find(id); it != pools.first().cend()) {
+            if(const auto other = it->second.find(slot); other != it->second.cend()) {
+                return &other->second;
+            }
+        }
+
+        return nullptr;
+    }
+
+    bool erase(const id_type id, const std::size_t slot) {
+        const auto it = pools.first().find(id);
+        return (it != pools.first().end()) && it->second.erase(slot);
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Default constructor. */
+    basic_emitter_context()
+        : basic_emitter_context{allocator_type{}} {}
+
+    /**
+     * @brief Constructs a context with a given allocator.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_emitter_context(const allocator_type &allocator)
+        : pools{allocator, allocator},
+          free_list{allocator},
+          owners{allocator},
+          next{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_emitter_context(const basic_emitter_context &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_emitter_context(basic_emitter_context &&) = delete;
+
+    /*! @brief Default destructor. */
+    ~basic_emitter_context() = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This context.
+     */
+    basic_emitter_context &operator=(const basic_emitter_context &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This context.
+     */
+    basic_emitter_context &operator=(basic_emitter_context &&) = delete;
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return pools.second();
+    }
+
+    /**
+     * @brief Publishes a given event to all the emitters with a listener for
+     * it.
+     *
+     * Listeners are looked up once per call rather than once per emitter.
+     * Therefore, the cost of a broadcast is proportional to the number of
+     * listeners for the event, regardless of the number of emitters.<br/>
+     * Listeners are invoked in no particular order, each with the emitter it
+     * was registered with.
+     *
+     * @warning
+     * Registering or disconnecting listeners for the same type of event while
+     * broadcasting it results in undefined behavior.
+     *
+     * @tparam Type Type of event to trigger.
+     * @param value An instance of the given type of event.
+     */
+    template<typename Type>
+    void broadcast(Type value) {
+        if(const auto it = pools.first().find(type_hash<Type>::value()); it != pools.first().end()) {
+            ENTT_SIGNAL_SCOPE(type_id<Type>(), it->second.size());
+
+            for(auto &&elem: it->second) {
+                elem.second(&value, owners[elem.first]);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of listeners registered with all emitters.
+     * @return The number of listeners registered with all emitters.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        size_type count{};
+
+        for(auto &&elem: pools.first()) {
+            count += elem.second.size();
+        }
+
+        return count;
+    }
+
+private:
+    compressed_pair<container_type, allocator_type> pools;
+    free_list_type free_list;
+    owner_container_type owners;
+    size_type next;
+};
+
+/**
+ * @brief Event emitter that stores its handlers in a shared context.
+ *
+ * To create an emitter type, derived classes must inherit from the base as:
+ *
+ * @code{.cpp}
+ * struct my_emitter: pooled_emitter<my_emitter> {
+ *     using pooled_emitter::pooled_emitter;
+ * }
+ * @endcode
+ *
+ * It offers the same functionalities of the `emitter` class. However, all its
+ * handlers are stored within the context it refers to. An emitter without
+ * listeners is just a handful of bytes and never allocates memory.
+ *
+ * @tparam Derived Emitter type.
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Derived, typename Allocator>
+class pooled_emitter {
+    static constexpr auto null = (std::numeric_limits<std::size_t>::max)();
+
+    void rebind() noexcept {
+        if(slot != null) {
+            // no downcast here, the derived class doesn't exist yet during a move construction
+            context->rebind(slot, this);
+        }
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+    /*! @brief Context type. */
+    using context_type = basic_emitter_context<Allocator>;
+
+    /**
+     * @brief Constructs an emitter for a given context.
+     * @param ref The context in which to store the handlers.
+     */
+    explicit pooled_emitter(context_type &ref) noexcept
+        : context{&ref},
+          slot{null},
+          count{} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    pooled_emitter(const pooled_emitter &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    pooled_emitter(pooled_emitter &&other) noexcept
+        : context{other.context},
+          slot{std::exchange(other.slot, null)},
+          count{std::exchange(other.count, 0u)} {
+        rebind();
+    }
+
+    /*! @brief Releases all the handlers of the emitter. */
+    virtual ~pooled_emitter() {
+        static_assert(std::is_base_of_v<pooled_emitter<Derived, Allocator>, Derived>, "Invalid emitter type");
+        clear();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This emitter.
+     */
+    pooled_emitter &operator=(const pooled_emitter &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This emitter.
+     */
+    pooled_emitter &operator=(pooled_emitter &&other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * @brief Exchanges the contents with those of a given emitter.
+     * @param other Emitter to exchange the content with.
+     */
+    void swap(pooled_emitter &other) noexcept {
+        using std::swap;
+        swap(context, other.context);
+        swap(slot, other.slot);
+        swap(count, other.count);
+        rebind();
+        other.rebind();
+    }
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return context->get_allocator();
+    }
+
+    /**
+     * @brief Publishes a given event.
+     * @tparam Type Type of event to trigger.
+     * @param value An instance of the given type of event.
+     */
+    template<typename Type>
+    void publish(Type value) {
+        if(count != 0u) {
+            if(const auto *handler = context->find(type_hash<Type>::value(), slot); handler) {
+                ENTT_SIGNAL_SCOPE(type_id<Type>(), 1u);
+                (*handler)(&value, this);
+            }
+        }
+    }
+
+    /**
+     * @brief Registers a listener with the event emitter.
+     * @tparam Type Type of event to which to connect the listener.
+     * @param func The listener to register.
+     */
+    template<typename Type>
+    void on(std::function<void(Type &, Derived &)> func) {
+        if(slot == null) {
+            slot = context->acquire(this);
+        }
+
+        auto &pool = context->assure(type_hash<Type>::value());
+
+        count += pool.insert_or_assign(slot, [func = std::move(func)](void *value, void *instance) {
+                         // contexts store base pointers, emitters are fully constructed by the time they are notified
+                         func(*static_cast<Type *>(value), static_cast<Derived &>(*static_cast<pooled_emitter *>(instance)));
+                     })
+                     .second;
+    }
+
+    /**
+     * @brief Disconnects a listener from the event emitter.
+     * @tparam Type Type of event of the listener.
+     */
+    template<typename Type>
+    void erase() {
+        if(count != 0u && context->erase(type_hash<std::remove_cv_t<std::remove_reference_t<Type>>>::value(), slot)) {
+            --count;
+        }
+    }
+
+    /*! @brief Disconnects all the listeners. */
+    void clear() {
+        if(slot != null) {
+            context->release(std::exchange(slot, null));
+            count = 0u;
+        }
+    }
+
+    /**
+     * @brief Checks if there are listeners registered for the specific event.
+     * @tparam Type Type of event to test.
+     * @return True if there are no listeners registered, false otherwise.
+     */
+    template<typename Type>
+    [[nodiscard]] bool contains() const {
+        return (count != 0u) && (context->find(type_hash<std::remove_cv_t<std::remove_reference_t<Type>>>::value(), slot) != nullptr);
+    }
+
+    /**
+     * @brief Checks if there are listeners registered with the event emitter.
+     * @return True if there are no listeners registered, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return (count == 0u);
+    }
+
+private:
+    context_type *context;
+    size_type slot;
+    size_type count;
+};
+
 } // namespace entt
 
 #endif
@@ -0,0 +1,248 @@
+#ifndef ENTT_SIGNAL_EVENT_RECORDER_HPP
+#define ENTT_SIGNAL_EVENT_RECORDER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/fwd.hpp"
+#include "../core/iterator.hpp"
+#include "../core/type_info.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Records the events delivered by a dispatcher in a binary log.
+ *
+ * Events of the recorded queues are appended to a contiguous log as they are
+ * delivered, one batch at a time and with a single copy per batch. Ticks are
+ * separated by markers added by the user. The log is bounded and the
+ * oldest events are discarded when it runs out of space, as with a ring
+ * buffer.<br/>
+ * The log is replayed later at full speed, by triggering all the events in
+ * the order in which they were delivered.
+ *
+ * @warning
+ * Only trivially copyable events are recorded. The recorder must be stopped
+ * before it's destroyed, unless the dispatcher is destroyed first.
+ *
+ * @tparam Dispatcher Basic dispatcher type.
+ */
+template<typename Dispatcher>
+class basic_event_recorder final {
+    using alloc_traits = std::allocator_traits<typename Dispatcher::allocator_type>;
+    using buffer_type = std::vector<std::byte, typename alloc_traits::template rebind_alloc<std::byte>>;
+    using replay_type = void(Dispatcher &, const id_type, const std::byte *, const std::size_t);
+
+    struct header_type {
+        id_type id;
+        std::uint32_t count;
+        std::uint32_t size;
+    };
+
+    struct channel_type {
+        template<typename Type>
+        void receive(iterable_adaptor<Type *> range) {
+            if(!owner->replaying) {
+                owner->append(header_type{id, static_cast<std::uint32_t>(range.end() - range.begin()), static_cast<std::uint32_t>(sizeof(Type))}, range.begin());
+            }
+        }
+
+        basic_event_recorder *owner;
+        id_type id;
+        replay_type *replay;
+    };
+
+    template<typename Type>
+    static void replay_batch(Dispatcher &target, const id_type id, const std::byte *data, const std::size_t count) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            alignas(Type) std::byte elem[sizeof(Type)];
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            std::memcpy(elem, data + pos * sizeof(Type), sizeof(Type));
+            target.trigger(id, *std::launder(reinterpret_cast<Type *>(elem)));
+        }
+    }
+
+    [[nodiscard]] static header_type peek(const std::byte *data) noexcept {
+        header_type header{};
+        std::memcpy(&header, data, sizeof(header_type));
+        return header;
+    }
+
+    [[nodiscard]] static std::size_t extent(const header_type &header) noexcept {
+        return sizeof(header_type) + std::size_t{header.count} * header.size;
+    }
+
+    void append(const header_type &header, const void *payload) {
+        const auto len = extent(header);
+        ENTT_ASSERT(len <= limit, "Batch exceeds the capacity of the log");
+
+        // the oldest records make room for the new one
+        while(buffer.size() - first + len > limit) {
+            first += extent(peek(buffer.data() + first));
+        }
+
+        if(first != 0u && (first >= (buffer.size() / 2u) || buffer.size() + len > buffer.capacity())) {
+            buffer.erase(buffer.begin(), buffer.begin() + static_cast<typename buffer_type::difference_type>(first));
+            first = 0u;
+        }
+
+        const auto *data = reinterpret_cast<const std::byte *>(&header);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        buffer.insert(buffer.end(), data, data + sizeof(header_type));
+        data = static_cast<const std::byte *>(payload);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        buffer.insert(buffer.end(), data, data + (len - sizeof(header_type)));
+    }
+
+public:
+    /*! @brief Basic dispatcher type. */
+    using dispatcher_type = Dispatcher;
+    /*! @brief Allocator type. */
+    using allocator_type = typename dispatcher_type::allocator_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a recorder with a bounded log.
+     * @param bytes Maximum size of the log in bytes.
+     * @param allocator The allocator to use.
+     */
+    explicit basic_event_recorder(const size_type bytes = 1048576u, const allocator_type &allocator = allocator_type{})
+        : buffer{allocator},
+          channels{},
+          limit{bytes} {
+        ENTT_ASSERT(limit >= sizeof(header_type), "Invalid capacity");
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_event_recorder(const basic_event_recorder &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_event_recorder(basic_event_recorder &&) = delete;
+
+    /*! @brief Default destructor. */
+    ~basic_event_recorder() = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This recorder.
+     */
+    basic_event_recorder &operator=(const basic_event_recorder &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This recorder.
+     */
+    basic_event_recorder &operator=(basic_event_recorder &&) = delete;
+
+    /**
+     * @brief Starts recording the events of a given queue.
+     * @tparam Type Type of event to record.
+     * @param target The dispatcher that owns the queue.
+     * @param id Name used to map the event queue within the dispatcher.
+     */
+    template<typename Type>
+    void record(dispatcher_type &target, const id_type id = type_hash<Type>::value()) {
+        static_assert(std::is_trivially_copyable_v<Type>, "Only trivially copyable events can be recorded");
+        auto &channel = *channels.emplace_back(std::make_unique<channel_type>(channel_type{this, id, &replay_batch<Type>}));
+        target.template batch_sink<Type>(id).template connect<&channel_type::template receive<Type>>(channel);
+    }
+
+    /**
+     * @brief Stops recording the events of a dispatcher.
+     * @param target The dispatcher to stop recording.
+     */
+    void stop(dispatcher_type &target) {
+        for(auto &&channel: channels) {
+            target.disconnect(*channel);
+        }
+    }
+
+    /*! @brief Adds a tick marker to the log. */
+    void tick() {
+        append(header_type{}, nullptr);
+    }
+
+    /*! @brief Discards all the events recorded so far. */
+    void clear() noexcept {
+        buffer.clear();
+        first = 0u;
+    }
+
+    /**
+     * @brief Returns the size of the log.
+     * @return The size of the log in bytes.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return buffer.size() - first;
+    }
+
+    /**
+     * @brief Direct access to the contiguous binary log.
+     * @return A pointer to the first byte of the log.
+     */
+    [[nodiscard]] const std::byte *data() const noexcept {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return buffer.data() + first;
+    }
+
+    /**
+     * @brief Replays the log on a dispatcher.
+     *
+     * Events are triggered in the order in which they were recorded. Events of
+     * queues that aren't recorded by this instance are skipped.
+     *
+     * @tparam Func Type of function to invoke at each tick marker.
+     * @param target The dispatcher on which to trigger the events.
+     * @param func A valid function to invoke at each tick marker.
+     */
+    template<typename Func>
+    void replay(dispatcher_type &target, Func func) {
+        replaying = true;
+
+        for(auto pos = first; pos < buffer.size();) {
+            if(const auto header = peek(buffer.data() + pos); header.count == 0u) {
+                func();
+                pos += sizeof(header_type);
+            } else {
+                for(auto &&channel: channels) {
+                    if(channel->id == header.id) {
+                        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                        channel->replay(target, header.id, buffer.data() + pos + sizeof(header_type), header.count);
+                        break;
+                    }
+                }
+
+                pos += extent(header);
+            }
+        }
+
+        replaying = false;
+    }
+
+    /**
+     * @brief Replays the log on a dispatcher.
+     * @param target The dispatcher on which to trigger the events.
+     */
+    void replay(dispatcher_type &target) {
+        replay(target, []() {});
+    }
+
+private:
+    buffer_type buffer;
+    std::vector<std::unique_ptr<channel_type>> channels;
+    size_type limit;
+    size_type first{};
+    bool replaying{};
+};
+
+} // namespace entt
+
+#endif
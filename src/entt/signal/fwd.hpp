@@ -1,6 +1,7 @@
 #ifndef ENTT_SIGNAL_FWD_HPP
 #define ENTT_SIGNAL_FWD_HPP
 
+#include <cstddef>
 #include <memory>
 
 namespace entt {
@@ -8,12 +9,25 @@ namespace entt {
 template<typename>
 class delegate;
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+template<typename, std::size_t = sizeof(double[2]), std::size_t = alignof(double[2])>
+class basic_owning_delegate;
+
 template<typename = std::allocator<void>>
 class basic_dispatcher;
 
+template<typename>
+class basic_event_recorder;
+
 template<typename, typename = std::allocator<void>>
 class emitter;
 
+template<typename = std::allocator<void>>
+class basic_emitter_context;
+
+template<typename, typename = std::allocator<void>>
+class pooled_emitter;
+
 class connection;
 
 struct scoped_connection;
@@ -24,9 +38,25 @@ class sink;
 template<typename Type, typename = std::allocator<void>>
 class sigh;
 
+template<typename Type, typename = std::allocator<void>>
+class concurrent_sigh;
+
 /*! @brief Alias declaration for the most common use case. */
 using dispatcher = basic_dispatcher<>;
 
+/*! @brief Alias declaration for the most common use case. */
+using event_recorder = basic_event_recorder<dispatcher>;
+
+/**
+ * @brief Alias declaration for the most common use case.
+ * @tparam Type A valid function type.
+ */
+template<typename Type>
+using owning_delegate = basic_owning_delegate<Type>;
+
+/*! @brief Alias declaration for the most common use case. */
+using emitter_context = basic_emitter_context<>;
+
 /*! @brief Disambiguation tag for constructors and the like. */
 template<auto>
 struct connect_arg_t {
@@ -1,14 +1,21 @@
 #ifndef ENTT_SIGNAL_SIGH_HPP
 #define ENTT_SIGNAL_SIGH_HPP
 
+#include <array>
 #include <cstddef>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
+#include "../config/config.h"
 #include "delegate.hpp"
 #include "fwd.hpp"
 
+#ifdef ENTT_USE_SIGNAL_TRACER
+#    include "../core/type_info.hpp"
+#    include "../tools/signal_tracer.hpp"
+#endif
+
 namespace entt {
 
 /**
@@ -46,6 +53,9 @@ class sigh;
  * * Creating signals to use later to notify a bunch of listeners.
  * * Collecting results from a set of functions like in a voting system.
  *
+ * The first `ENTT_SIGH_INLINE` listeners are stored within the signal itself,
+ * the others are allocated on the heap.
+ *
  * @tparam Ret Return type of a function type.
  * @tparam Args Types of arguments of a function type.
  * @tparam Allocator Type of allocator used to manage memory and elements.
@@ -57,6 +67,51 @@ class sigh<Ret(Args...), Allocator> {
     using alloc_traits = std::allocator_traits<Allocator>;
     using delegate_type = delegate<Ret(Args...)>;
     using container_type = std::vector<delegate_type, typename alloc_traits::template rebind_alloc<delegate_type>>;
+    using buffer_type = std::array<delegate_type, ENTT_SIGH_INLINE>;
+
+    [[nodiscard]] delegate_type &at(const std::size_t pos) noexcept {
+        return (pos < buffer.size()) ? buffer[pos] : calls[pos - buffer.size()];
+    }
+
+    void push(delegate_type elem) {
+        if(count < buffer.size()) {
+            buffer[count] = elem;
+        } else {
+            calls.push_back(elem);
+        }
+
+        ++count;
+    }
+
+    void pop() noexcept {
+        if(--count < buffer.size()) {
+            buffer[count].reset();
+        } else {
+            calls.pop_back();
+        }
+    }
+
+    void reset() noexcept {
+        buffer = buffer_type{};
+        calls.clear();
+        count = 0u;
+    }
+
+    template<typename Func>
+    void each(Func func) const {
+        // as if the listeners were stored in a single array, from the last one
+        for(auto pos = calls.size(); pos; --pos) {
+            if(func(calls[pos - 1u])) {
+                return;
+            }
+        }
+
+        for(auto pos = count - calls.size(); pos; --pos) {
+            if(func(buffer[pos - 1u])) {
+                return;
+            }
+        }
+    }
 
 public:
     /*! @brief Allocator type. */
@@ -75,14 +130,18 @@ public:
      * @param allocator The allocator to use.
      */
     explicit sigh(const allocator_type &allocator) noexcept
-        : calls{allocator} {}
+        : buffer{},
+          calls{allocator},
+          count{} {}
 
     /**
      * @brief Copy constructor.
      * @param other The instance to copy from.
      */
     sigh(const sigh &other)
-        : calls{other.calls} {}
+        : buffer{other.buffer},
+          calls{other.calls},
+          count{other.count} {}
 
     /**
      * @brief Allocator-extended copy constructor.
@@ -90,14 +149,18 @@ public:
      * @param allocator The allocator to use.
      */
     sigh(const sigh &other, const allocator_type &allocator)
-        : calls{other.calls, allocator} {}
+        : buffer{other.buffer},
+          calls{other.calls, allocator},
+          count{other.count} {}
 
     /**
      * @brief Move constructor.
      * @param other The instance to move from.
      */
     sigh(sigh &&other) noexcept
-        : calls{std::move(other.calls)} {}
+        : buffer{other.buffer},
+          calls{std::move(other.calls)},
+          count{std::exchange(other.count, 0u)} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -105,7 +168,11 @@ public:
      * @param allocator The allocator to use.
      */
     sigh(sigh &&other, const allocator_type &allocator)
-        : calls{std::move(other.calls), allocator} {}
+        : buffer{other.buffer},
+          calls{std::move(other.calls), allocator},
+          count{other.count} {
+        other.reset();
+    }
 
     /*! @brief Default destructor. */
     ~sigh() = default;
@@ -117,6 +184,8 @@ public:
      */
     sigh &operator=(const sigh &other) {
         calls = other.calls;
+        buffer = other.buffer;
+        count = other.count;
         return *this;
     }
 
@@ -136,7 +205,9 @@ public:
      */
     void swap(sigh &other) noexcept {
         using std::swap;
+        swap(buffer, other.buffer);
         swap(calls, other.calls);
+        swap(count, other.count);
     }
 
     /**
@@ -152,7 +223,7 @@ public:
      * @return Number of listeners currently connected.
      */
     [[nodiscard]] size_type size() const noexcept {
-        return calls.size();
+        return count;
     }
 
     /**
@@ -160,7 +231,12 @@ public:
      * @return True if the signal has no listeners connected, false otherwise.
      */
     [[nodiscard]] bool empty() const noexcept {
-        return calls.empty();
+        return count == 0u;
+    }
+
+    /*! @brief Requests the removal of unused capacity. */
+    void shrink_to_fit() {
+        calls.shrink_to_fit();
     }
 
     /**
@@ -171,9 +247,11 @@ public:
      * @param args Arguments to use to invoke listeners.
      */
     void publish(Args... args) const {
-        for(auto pos = calls.size(); pos; --pos) {
-            calls[pos - 1u](args...);
-        }
+        ENTT_SIGNAL_SCOPE(type_id<Ret(Args...)>(), count);
+        each([&args...](const delegate_type &elem) {
+            elem(args...);
+            return false;
+        });
     }
 
     /**
@@ -192,31 +270,32 @@ public:
      */
     template<typename Func>
     void collect(Func func, Args... args) const {
-        for(auto pos = calls.size(); pos; --pos) {
+        ENTT_SIGNAL_SCOPE(type_id<Ret(Args...)>(), count);
+        each([&func, &args...](const delegate_type &elem) {
             if constexpr(std::is_void_v<Ret> || !std::is_invocable_v<Func, Ret>) {
-                calls[pos - 1u](args...);
+                elem(args...);
 
                 if constexpr(std::is_invocable_r_v<bool, Func>) {
-                    if(func()) {
-                        break;
-                    }
+                    return static_cast<bool>(func());
                 } else {
                     func();
+                    return false;
                 }
             } else {
                 if constexpr(std::is_invocable_r_v<bool, Func, Ret>) {
-                    if(func(calls[pos - 1u](args...))) {
-                        break;
-                    }
+                    return static_cast<bool>(func(elem(args...)));
                 } else {
-                    func(calls[pos - 1u](args...));
+                    func(elem(args...));
+                    return false;
                 }
             }
-        }
+        });
     }
 
 private:
+    buffer_type buffer;
     container_type calls;
+    size_type count;
 };
 
 /**
@@ -360,7 +439,6 @@ template<typename Ret, typename... Args, typename Allocator>
 class sink<sigh<Ret(Args...), Allocator>> {
     using signal_type = sigh<Ret(Args...), Allocator>;
     using delegate_type = typename signal_type::delegate_type;
-    using difference_type = typename signal_type::container_type::difference_type;
 
     template<auto Candidate, typename Type>
     static void release(Type value_or_instance, void *signal) {
@@ -376,10 +454,10 @@ class sink<sigh<Ret(Args...), Allocator>> {
     void disconnect_if(Func callback) {
         auto &ref = signal_or_assert();
 
-        for(auto pos = ref.calls.size(); pos; --pos) {
-            if(auto &elem = ref.calls[pos - 1u]; callback(elem)) {
-                elem = std::move(ref.calls.back());
-                ref.calls.pop_back();
+        for(auto pos = ref.count; pos; --pos) {
+            if(auto &elem = ref.at(pos - 1u); callback(elem)) {
+                elem = ref.at(ref.count - 1u);
+                ref.pop();
             }
         }
     }
@@ -406,7 +484,7 @@ public:
      * @return True if the sink has no listeners connected, false otherwise.
      */
     [[nodiscard]] bool empty() const noexcept {
-        return signal_or_assert().calls.empty();
+        return signal_or_assert().empty();
     }
 
     /**
@@ -420,7 +498,7 @@ public:
 
         delegate_type call{};
         call.template connect<Candidate>();
-        signal_or_assert().calls.push_back(std::move(call));
+        signal_or_assert().push(call);
 
         delegate<void(void *)> conn{};
         conn.template connect<&release<Candidate>>();
@@ -449,7 +527,7 @@ public:
 
         delegate_type call{};
         call.template connect<Candidate>(value_or_instance);
-        signal_or_assert().calls.push_back(std::move(call));
+        signal_or_assert().push(call);
 
         delegate<void(void *)> conn{};
         conn.template connect<&release<Candidate, Type &>>(value_or_instance);
@@ -473,7 +551,7 @@ public:
 
         delegate_type call{};
         call.template connect<Candidate>(value_or_instance);
-        signal_or_assert().calls.push_back(std::move(call));
+        signal_or_assert().push(call);
 
         delegate<void(void *)> conn{};
         conn.template connect<&release<Candidate, Type *>>(value_or_instance);
@@ -542,7 +620,7 @@ public:
 
     /*! @brief Disconnects all the listeners from a signal. */
     void disconnect() {
-        signal_or_assert().calls.clear();
+        signal_or_assert().reset();
     }
 
     /**
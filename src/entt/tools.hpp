@@ -1,3 +1,6 @@
 // IWYU pragma: begin_exports
 #include "tools/davey.hpp"
+#include "tools/profiler.hpp"
+#include "tools/recorder.hpp"
+#include "tools/signal_tracer.hpp"
 // IWYU pragma: end_exports
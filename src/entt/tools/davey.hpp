@@ -1,11 +1,15 @@
 #ifndef ENTT_TOOLS_DAVEY_HPP
 #define ENTT_TOOLS_DAVEY_HPP
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <ios>
 #include <sstream>
 #include <string>
+#include <vector>
 #include <imgui.h>
+#include "../container/dense_map.hpp"
 #include "../entity/mixin.hpp"
 #include "../entity/registry.hpp"
 #include "../entity/sparse_set.hpp"
@@ -16,6 +20,7 @@
 #include "../meta/meta.hpp"
 #include "../meta/pointer.hpp"
 #include "../meta/resolve.hpp"
+#include "profiler.hpp"
 
 namespace entt {
 
@@ -218,6 +223,143 @@ static void present_view(const meta_ctx &ctx, const entt::basic_view<get_t<Get..
     }
 }
 
+struct operation_rates {
+    storage_statistics last{};
+    double time{};
+    double emplaced{};
+    double erased{};
+    double patched{};
+    double gets{};
+    double iterations{};
+};
+
+[[nodiscard]] inline double per_second(const std::size_t curr, const std::size_t prev, const double elapsed) noexcept {
+    return (curr < prev) ? 0. : (static_cast<double>(curr - prev) / elapsed);
+}
+
+template<typename Registry>
+static void present_performance(const meta_ctx &ctx, const Registry &registry) {
+    // rates are refreshed once per second, samples are kept across frames
+    static dense_map<const void *, operation_rates> samples{};
+    const auto now = ImGui::GetTime();
+
+    if(ImGui::BeginTable("#performance", 13, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollX)) {
+        for(const char *header: {"Storage", "Size", "Capacity", "Sparse pages", "Element pages", "Bytes", "Tombstones", "Listeners", "Emplace/s", "Erase/s", "Patch/s", "Get/s", "Iterate/s"}) {
+            ImGui::TableSetupColumn(header);
+        }
+
+        ImGui::TableHeadersRow();
+
+        for([[maybe_unused]] auto [id, storage]: registry.storage()) {
+            const auto report = storage.memory_usage();
+            const auto stats = storage.statistics();
+            auto &rates = samples[&storage];
+
+            if(const auto elapsed = now - rates.time; elapsed >= 1.) {
+                if(rates.time != 0.) {
+                    rates.emplaced = per_second(stats.emplaced, rates.last.emplaced, elapsed);
+                    rates.erased = per_second(stats.erased, rates.last.erased, elapsed);
+                    rates.patched = per_second(stats.patched, rates.last.patched, elapsed);
+                    rates.gets = per_second(stats.gets, rates.last.gets, elapsed);
+                    rates.iterations = per_second(stats.iterations, rates.last.iterations, elapsed);
+                }
+
+                rates.last = stats;
+                rates.time = now;
+            }
+
+            const char *label = entt::resolve(ctx, storage.info()).name();
+            const std::string name{LABEL_OR(storage)};
+
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%s", name.data());
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", storage.size());
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", storage.capacity());
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", report.sparse_pages);
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", report.element_pages);
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", report.bytes());
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f%%", storage.empty() ? 0. : (100. * static_cast<double>(report.tombstones) / static_cast<double>(storage.size())));
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", stats.listeners);
+
+            // storage classes without a statistics mixin never count anything
+            if(const bool counted = (stats.peak != 0u); counted) {
+                for(const auto value: {rates.emplaced, rates.erased, rates.patched, rates.gets, rates.iterations}) {
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.0f", value);
+                }
+            } else {
+                for(std::size_t pos{}; pos < 5u; ++pos) {
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted("-");
+                }
+            }
+        }
+
+        ImGui::EndTable();
+    }
+}
+
+struct timed_scope {
+    const char *name{};
+    std::size_t calls{};
+    std::uint64_t total{};
+    std::uint64_t max{};
+};
+
+inline void present_profiler(const profiler &prof) {
+    std::vector<timed_scope> scopes{};
+
+    prof.each([&scopes](const profiler::event_type &event) {
+        auto it = scopes.begin();
+
+        // names are compared by content, see also profiler::total
+        for(; it != scopes.end() && !(it->name == event.name || (it->name && event.name && std::strcmp(it->name, event.name) == 0)); ++it) {}
+
+        if(it == scopes.end()) {
+            it = scopes.insert(it, timed_scope{event.name, 0u, 0u, 0u});
+        }
+
+        const auto elapsed = event.end - event.begin;
+        it->total += elapsed;
+        it->max = (std::max)(it->max, elapsed);
+        ++it->calls;
+    });
+
+    ImGui::Text("Events: %zu/%zu", prof.size(), prof.capacity());
+
+    if(ImGui::BeginTable("#profiler", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable)) {
+        for(const char *header: {"Scope", "Calls", "Total (ms)", "Average (us)", "Max (us)"}) {
+            ImGui::TableSetupColumn(header);
+        }
+
+        ImGui::TableHeadersRow();
+
+        for(auto &&elem: scopes) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%s", elem.name ? elem.name : "<unnamed>");
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", elem.calls);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", static_cast<double>(elem.total) / 1000000.);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", static_cast<double>(elem.total) / static_cast<double>(elem.calls * 1000u));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", static_cast<double>(elem.max) / 1000.);
+        }
+
+        ImGui::EndTable();
+    }
+}
+
 } // namespace internal
 /*! @endcond */
 
@@ -269,6 +411,19 @@ void davey(const entt::basic_view<get_t<Get...>, exclude_t<Exclude...>> &view) {
     davey(locator<meta_ctx>::value_or(), view);
 }
 
+/**
+ * @brief ImGui-based introspection tool for profilers.
+ *
+ * Events are grouped by name, so that the time spent in each scope is shown
+ * as a whole. Tasks of an organizer are recorded with their names when
+ * `ENTT_USE_PROFILER` is defined.
+ *
+ * @param prof An instance of the profiler type.
+ */
+inline void davey(const profiler &prof) {
+    internal::present_profiler(prof);
+}
+
 /**
  * @brief ImGui-based introspection tool for registry types.
  * @tparam Entity Registry entity type.
@@ -307,6 +462,16 @@ void davey(const meta_ctx &ctx, const entt::basic_registry<Entity, Allocator> &r
         ImGui::EndTabItem();
     }
 
+    if(ImGui::BeginTabItem("Performance")) {
+        internal::present_performance(ctx, registry);
+        ImGui::EndTabItem();
+    }
+
+    if(const auto *prof = profiler::current(); prof && ImGui::BeginTabItem("Timings")) {
+        internal::present_profiler(*prof);
+        ImGui::EndTabItem();
+    }
+
     ImGui::EndTabBar();
 }
 
@@ -0,0 +1,277 @@
+#ifndef ENTT_TOOLS_PROFILER_HPP
+#define ENTT_TOOLS_PROFILER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../config/config.h"
+
+namespace entt {
+
+/**
+ * @brief Ring buffer of timed events.
+ *
+ * Events are recorded by the instrumented parts of the library when
+ * `ENTT_USE_PROFILER` is defined and a profiler is installed. Only the most
+ * recent events are kept, older ones are overwritten.<br/>
+ * Multiple threads can record events at the same time. However, events must
+ * not be read while other threads are recording them.
+ */
+class profiler final {
+    [[nodiscard]] static std::atomic<profiler *> &instance() noexcept {
+        static std::atomic<profiler *> value{};
+        return value;
+    }
+
+    [[nodiscard]] static std::size_t thread() noexcept {
+        static std::atomic<std::size_t> counter{};
+        static thread_local const std::size_t value = counter.fetch_add(1u, std::memory_order_relaxed);
+        return value;
+    }
+
+    static void append(std::string &buffer, const std::uint64_t value) {
+        // microseconds with nanosecond precision, as expected by trace viewers
+        const auto fraction = std::to_string(value % 1000u);
+        buffer += std::to_string(value / 1000u);
+        buffer += '.';
+        buffer.append(3u - fraction.size(), '0');
+        buffer += fraction;
+    }
+
+public:
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Timed event. */
+    struct event_type {
+        /*! @brief Name of the event, if any. */
+        const char *name;
+        /*! @brief Start time in nanoseconds. */
+        std::uint64_t begin;
+        /*! @brief End time in nanoseconds. */
+        std::uint64_t end;
+        /*! @brief Sequential identifier of the recording thread. */
+        size_type thread;
+    };
+
+    /**
+     * @brief Constructs a profiler with a given capacity.
+     * @param length Maximum number of events to keep, at least one.
+     */
+    explicit profiler(const size_type length = 4096u)
+        : events(length),
+          head{} {
+        ENTT_ASSERT(length != 0u, "Invalid length");
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    profiler(const profiler &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    profiler(profiler &&) = delete;
+
+    /*! @brief Uninstalls the profiler, if needed. */
+    ~profiler() {
+        auto *self = this;
+        instance().compare_exchange_strong(self, nullptr);
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This profiler.
+     */
+    profiler &operator=(const profiler &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This profiler.
+     */
+    profiler &operator=(profiler &&) = delete;
+
+    /**
+     * @brief Installs a profiler as the one that receives events.
+     * @param elem A profiler or a null pointer to stop recording events.
+     */
+    static void install(profiler *elem) noexcept {
+        instance().store(elem, std::memory_order_release);
+    }
+
+    /**
+     * @brief Returns the profiler that receives events, if any.
+     * @return The installed profiler, if any, a null pointer otherwise.
+     */
+    [[nodiscard]] static profiler *current() noexcept {
+        return instance().load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Returns the current time in nanoseconds.
+     * @return The current time in nanoseconds.
+     */
+    [[nodiscard]] static std::uint64_t now() noexcept {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /**
+     * @brief Records an event for the calling thread.
+     * @param name Name of the event, if any.
+     * @param begin Start time in nanoseconds.
+     * @param end End time in nanoseconds.
+     */
+    void push(const char *name, const std::uint64_t begin, const std::uint64_t end) noexcept {
+        const auto pos = head.fetch_add(1u, std::memory_order_relaxed);
+        events[pos % events.size()] = event_type{name, begin, end, thread()};
+    }
+
+    /**
+     * @brief Returns the number of events available.
+     * @return Number of events available.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return (std::min)(head.load(std::memory_order_relaxed), events.size());
+    }
+
+    /**
+     * @brief Returns the maximum number of events a profiler can keep.
+     * @return Maximum number of events a profiler can keep.
+     */
+    [[nodiscard]] size_type capacity() const noexcept {
+        return events.size();
+    }
+
+    /*! @brief Discards all events. */
+    void clear() noexcept {
+        head.store(0u, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Visits all events available, from the oldest to the newest.
+     * @tparam Func Type of function object to invoke.
+     * @param func A valid function object.
+     */
+    template<typename Func>
+    void each(Func func) const {
+        const auto last = head.load(std::memory_order_acquire);
+
+        for(auto pos = last - size(); pos < last; ++pos) {
+            func(events[pos % events.size()]);
+        }
+    }
+
+    /**
+     * @brief Returns the time spent in all events with a given name.
+     *
+     * Events are compared by name rather than by address, so that the result is
+     * the same also when names come from different translation units.
+     *
+     * @param name Name of the events of interest.
+     * @return The time spent in the events of interest, in microseconds.
+     */
+    [[nodiscard]] float total(const char *name) const {
+        std::uint64_t value{};
+
+        each([&value, name](const event_type &elem) {
+            if(elem.name == name || (elem.name && name && std::strcmp(elem.name, name) == 0)) {
+                value += elem.end - elem.begin;
+            }
+        });
+
+        return static_cast<float>(value) / 1000.f;
+    }
+
+    /**
+     * @brief Exports all events available in the Chrome trace event format.
+     *
+     * The result can be loaded in `chrome://tracing` and similar tools.
+     *
+     * @return A JSON representation of the events.
+     */
+    [[nodiscard]] std::string chrome_trace() const {
+        std::string buffer{"{\"traceEvents\":["};
+        bool first = true;
+
+        each([&buffer, &first](const event_type &elem) {
+            buffer += first ? "{\"name\":\"" : ",{\"name\":\"";
+            first = false;
+
+            for(const char *curr = elem.name ? elem.name : "unknown"; *curr; ++curr) {
+                if(*curr == '"' || *curr == '\\') {
+                    buffer += '\\';
+                }
+
+                buffer += *curr;
+            }
+
+            buffer += "\",\"ph\":\"X\",\"pid\":0,\"tid\":";
+            buffer += std::to_string(elem.thread);
+            buffer += ",\"ts\":";
+            append(buffer, elem.begin);
+            buffer += ",\"dur\":";
+            append(buffer, elem.end - elem.begin);
+            buffer += '}';
+        });
+
+        buffer += "]}";
+        return buffer;
+    }
+
+private:
+    std::vector<event_type> events;
+    std::atomic<size_type> head;
+};
+
+/**
+ * @brief Records the lifetime of an object as an event.
+ *
+ * The event goes to the profiler installed when the object is destroyed, if
+ * any. The library creates these objects through the `ENTT_PROFILE_SCOPE`
+ * macro when `ENTT_USE_PROFILER` is defined.
+ */
+class profile_scope final {
+public:
+    /**
+     * @brief Starts recording an event.
+     * @param label Name of the event, if any.
+     */
+    explicit profile_scope(const char *label) noexcept
+        : name{label},
+          begin{profiler::now()} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    profile_scope(const profile_scope &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    profile_scope(profile_scope &&) = delete;
+
+    /*! @brief Stops recording and pushes the event, if possible. */
+    ~profile_scope() {
+        if(auto *curr = profiler::current(); curr) {
+            curr->push(name, begin, profiler::now());
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This object.
+     */
+    profile_scope &operator=(const profile_scope &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This object.
+     */
+    profile_scope &operator=(profile_scope &&) = delete;
+
+private:
+    const char *name;
+    std::uint64_t begin;
+};
+
+} // namespace entt
+
+#endif
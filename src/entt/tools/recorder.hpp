@@ -0,0 +1,298 @@
+#ifndef ENTT_TOOLS_RECORDER_HPP
+#define ENTT_TOOLS_RECORDER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/type_info.hpp"
+#include "../entity/component.hpp"
+#include "../entity/entity.hpp"
+#include "../entity/fwd.hpp"
+#include "../signal/sigh.hpp"
+
+namespace entt {
+
+/*! @brief Operations recorded in a trace. */
+enum class trace_op : std::uint8_t {
+    /*! @brief An entity was created. */
+    create,
+    /*! @brief An entity was destroyed. */
+    destroy,
+    /*! @brief An element was assigned to an entity. */
+    emplace,
+    /*! @brief An element was patched or replaced. */
+    patch,
+    /*! @brief An element was removed from an entity. */
+    erase,
+    /*! @brief A frame or a step of the application ended. */
+    frame
+};
+
+/*! @brief Single operation of a trace. */
+struct trace_event {
+    /*! @brief Recorded operation. */
+    trace_op op{};
+    /*! @brief True if the storage is pointer stable, only for emplace. */
+    bool stable{};
+    /*! @brief Identifier of the storage, if any. */
+    id_type type{};
+    /*! @brief Integral representation of the entity, if any. */
+    std::uint64_t entity{};
+    /*! @brief Size of the elements of the storage, only for emplace. */
+    std::uint32_t size{};
+};
+
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+inline constexpr std::uint32_t trace_magic = 0x54544e45u;
+inline constexpr std::uint32_t trace_version = 1u;
+
+template<typename Type>
+void write_trace_value(std::ostream &os, const Type value) {
+    char buffer[sizeof(Type)]{};
+
+    // little endian regardless of the platform
+    for(std::size_t pos{}; pos < sizeof(Type); ++pos) {
+        buffer[pos] = static_cast<char>(static_cast<std::uint64_t>(value) >> (pos * 8u));
+    }
+
+    os.write(buffer, sizeof(Type));
+}
+
+template<typename Type>
+[[nodiscard]] bool read_trace_value(std::istream &is, Type &value) {
+    unsigned char buffer[sizeof(Type)]{};
+    std::uint64_t elem{};
+
+    if(!is.read(reinterpret_cast<char *>(buffer), sizeof(Type))) {
+        return false;
+    }
+
+    for(std::size_t pos{}; pos < sizeof(Type); ++pos) {
+        elem |= static_cast<std::uint64_t>(buffer[pos]) << (pos * 8u);
+    }
+
+    value = static_cast<Type>(elem);
+    return true;
+}
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Writes a trace in binary format.
+ *
+ * The format is fixed and platform independent. It begins with a header that
+ * contains a magic number, the version of the format and the number of
+ * events, followed by the events themselves. All values are in little endian
+ * byte order.
+ *
+ * @param os The stream to which to write the trace.
+ * @param events The events to write.
+ */
+inline void write_trace(std::ostream &os, const std::vector<trace_event> &events) {
+    internal::write_trace_value(os, internal::trace_magic);
+    internal::write_trace_value(os, internal::trace_version);
+    internal::write_trace_value(os, static_cast<std::uint64_t>(events.size()));
+
+    for(auto &&elem: events) {
+        internal::write_trace_value(os, static_cast<std::uint8_t>(elem.op));
+        internal::write_trace_value(os, static_cast<std::uint8_t>(elem.stable));
+        internal::write_trace_value(os, static_cast<std::uint32_t>(elem.type));
+        internal::write_trace_value(os, elem.entity);
+        internal::write_trace_value(os, elem.size);
+    }
+}
+
+/**
+ * @brief Reads a trace in binary format.
+ * @param is The stream from which to read the trace.
+ * @param events The container to which to append the events read.
+ * @return True if the trace is valid and was read entirely, false otherwise.
+ */
+[[nodiscard]] inline bool read_trace(std::istream &is, std::vector<trace_event> &events) {
+    std::uint32_t magic{};
+    std::uint32_t version{};
+    std::uint64_t length{};
+
+    if(!internal::read_trace_value(is, magic) || !internal::read_trace_value(is, version) || !internal::read_trace_value(is, length) || magic != internal::trace_magic || version != internal::trace_version) {
+        return false;
+    }
+
+    for(std::uint64_t pos{}; pos < length; ++pos) {
+        std::uint8_t op{};
+        std::uint8_t stable{};
+        std::uint32_t type{};
+        trace_event elem{};
+
+        if(!internal::read_trace_value(is, op) || !internal::read_trace_value(is, stable) || !internal::read_trace_value(is, type) || !internal::read_trace_value(is, elem.entity) || !internal::read_trace_value(is, elem.size) || op > static_cast<std::uint8_t>(trace_op::frame)) {
+            return false;
+        }
+
+        elem.op = static_cast<trace_op>(op);
+        elem.stable = (stable != 0u);
+        elem.type = static_cast<id_type>(type);
+        events.push_back(elem);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Records the operations performed on a registry.
+ *
+ * The recorder listens to the signals of the storage classes of a registry
+ * and turns the creation and destruction of entities and elements into a
+ * sequence of events. Only the storage classes explicitly tracked are
+ * recorded, while entities are always recorded.<br/>
+ * Traces are meant to be replayed later, for example by benchmarks that want
+ * to reproduce the behavior of a real application.
+ *
+ * @warning
+ * The recorder must not outlive the registry it refers to.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_recorder {
+    using entity_type = typename Registry::entity_type;
+
+    struct pool_node {
+        void on_construct(Registry &, const entity_type entt) {
+            owner->events.push_back(trace_event{trace_op::emplace, stable, id, static_cast<std::uint64_t>(entt::to_integral(entt)), size});
+        }
+
+        void on_update(Registry &, const entity_type entt) {
+            owner->events.push_back(trace_event{trace_op::patch, false, id, static_cast<std::uint64_t>(entt::to_integral(entt)), 0u});
+        }
+
+        void on_destroy(Registry &, const entity_type entt) {
+            owner->events.push_back(trace_event{trace_op::erase, false, id, static_cast<std::uint64_t>(entt::to_integral(entt)), 0u});
+        }
+
+        basic_recorder *owner;
+        id_type id;
+        std::uint32_t size;
+        bool stable;
+    };
+
+    void on_create(Registry &, const entity_type entt) {
+        events.push_back(trace_event{trace_op::create, false, id_type{}, static_cast<std::uint64_t>(entt::to_integral(entt)), 0u});
+    }
+
+    void on_release(Registry &, const entity_type entt) {
+        events.push_back(trace_event{trace_op::destroy, false, id_type{}, static_cast<std::uint64_t>(entt::to_integral(entt)), 0u});
+    }
+
+public:
+    /*! @brief Registry type. */
+    using registry_type = Registry;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a recorder for a given registry.
+     * @param ref A valid reference to a registry.
+     */
+    explicit basic_recorder(registry_type &ref)
+        : reg{&ref},
+          events{},
+          pools{},
+          connections{} {
+        connections.emplace_back(reg->template on_construct<entity_type>().template connect<&basic_recorder::on_create>(*this));
+        connections.emplace_back(reg->template on_destroy<entity_type>().template connect<&basic_recorder::on_release>(*this));
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_recorder(const basic_recorder &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_recorder(basic_recorder &&) = delete;
+
+    /*! @brief Disconnects the recorder from the registry. */
+    ~basic_recorder() {
+        for(auto &&elem: connections) {
+            elem.release();
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This recorder.
+     */
+    basic_recorder &operator=(const basic_recorder &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This recorder.
+     */
+    basic_recorder &operator=(basic_recorder &&) = delete;
+
+    /**
+     * @brief Starts recording the operations on a given storage.
+     * @tparam Type Type of elements of the storage to record.
+     * @param id Optional name used to map the storage within the registry.
+     */
+    template<typename Type>
+    void track(const id_type id = type_hash<Type>::value()) {
+        constexpr auto size = std::is_empty_v<Type> ? 0u : static_cast<std::uint32_t>(sizeof(Type));
+        auto &node = *pools.emplace_back(std::unique_ptr<pool_node>{new pool_node{this, id, size, component_traits<Type, entity_type>::in_place_delete}});
+        connections.emplace_back(reg->template on_construct<Type>(id).template connect<&pool_node::on_construct>(node));
+        connections.emplace_back(reg->template on_update<Type>(id).template connect<&pool_node::on_update>(node));
+        connections.emplace_back(reg->template on_destroy<Type>(id).template connect<&pool_node::on_destroy>(node));
+    }
+
+    /*! @brief Marks the end of a frame or of a step of the application. */
+    void frame() {
+        events.push_back(trace_event{trace_op::frame, false, id_type{}, std::uint64_t{}, 0u});
+    }
+
+    /**
+     * @brief Returns the events recorded so far.
+     * @return The events recorded so far.
+     */
+    [[nodiscard]] const std::vector<trace_event> &trace() const noexcept {
+        return events;
+    }
+
+    /**
+     * @brief Returns the number of events recorded so far.
+     * @return Number of events recorded so far.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return events.size();
+    }
+
+    /*! @brief Discards all events recorded so far. */
+    void clear() noexcept {
+        events.clear();
+    }
+
+    /**
+     * @brief Writes the events recorded so far in binary format.
+     * @param os The stream to which to write the trace.
+     */
+    void write(std::ostream &os) const {
+        write_trace(os, events);
+    }
+
+private:
+    registry_type *reg;
+    std::vector<trace_event> events;
+    std::vector<std::unique_ptr<pool_node>> pools;
+    std::vector<connection> connections;
+};
+
+/*! @brief Alias declaration for the most common use case. */
+using recorder = basic_recorder<registry>;
+
+} // namespace entt
+
+#endif
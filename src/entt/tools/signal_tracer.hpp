@@ -0,0 +1,144 @@
+#ifndef ENTT_TOOLS_SIGNAL_TRACER_HPP
+#define ENTT_TOOLS_SIGNAL_TRACER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include "../config/config.h"
+#include "../core/type_info.hpp"
+
+namespace entt {
+
+/**
+ * @brief Hook interface for tracing the delivery of signals.
+ *
+ * Signals, dispatchers and emitters report the time spent in notifying their
+ * listeners when `ENTT_USE_SIGNAL_TRACER` is defined and a tracer is
+ * installed. Users derive from this class to collect these reports.<br/>
+ * Reports can come from multiple threads at the same time. Moreover, scopes
+ * can nest, for example when a dispatcher delivers its events through a
+ * signal.
+ */
+class signal_tracer {
+    [[nodiscard]] static std::atomic<signal_tracer *> &instance() noexcept {
+        static std::atomic<signal_tracer *> value{};
+        return value;
+    }
+
+public:
+    /*! @brief Default constructor. */
+    signal_tracer() noexcept = default;
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    signal_tracer(const signal_tracer &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    signal_tracer(signal_tracer &&) = delete;
+
+    /*! @brief Uninstalls the tracer, if needed. */
+    virtual ~signal_tracer() {
+        auto *self = this;
+        instance().compare_exchange_strong(self, nullptr, std::memory_order_acq_rel);
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This tracer.
+     */
+    signal_tracer &operator=(const signal_tracer &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This tracer.
+     */
+    signal_tracer &operator=(signal_tracer &&) = delete;
+
+    /**
+     * @brief Installs a tracer as the one that receives reports.
+     * @param elem A tracer or a null pointer to stop tracing signals.
+     */
+    static void install(signal_tracer *elem) noexcept {
+        instance().store(elem, std::memory_order_release);
+    }
+
+    /**
+     * @brief Returns the tracer that receives reports, if any.
+     * @return The installed tracer, if any, a null pointer otherwise.
+     */
+    [[nodiscard]] static signal_tracer *current() noexcept {
+        return instance().load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Receives the report of a signal delivered.
+     *
+     * The type is the function type of a signal or the type of event for
+     * dispatchers and emitters.
+     *
+     * @param info Type of the signal or of the event delivered.
+     * @param listeners Number of listeners notified.
+     * @param duration Time spent in notifying the listeners, in nanoseconds.
+     */
+    virtual void trace(const type_info &info, std::size_t listeners, std::uint64_t duration) noexcept = 0;
+};
+
+/**
+ * @brief Measures the delivery of a signal over the lifetime of an object.
+ *
+ * The report goes to the tracer installed when the object is created, if any.
+ * The library creates these objects through the `ENTT_SIGNAL_SCOPE` macro when
+ * `ENTT_USE_SIGNAL_TRACER` is defined.
+ */
+class signal_scope final {
+    [[nodiscard]] static std::uint64_t now() noexcept {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+public:
+    /**
+     * @brief Starts measuring the delivery of a signal.
+     * @param type Type of the signal or of the event delivered.
+     * @param count Number of listeners notified.
+     */
+    signal_scope(const type_info &type, const std::size_t count) noexcept
+        : tracer{signal_tracer::current()},
+          info{&type},
+          listeners{count},
+          begin{tracer ? now() : std::uint64_t{}} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    signal_scope(const signal_scope &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    signal_scope(signal_scope &&) = delete;
+
+    /*! @brief Stops measuring and reports to the tracer, if any. */
+    ~signal_scope() {
+        if(tracer) {
+            tracer->trace(*info, listeners, now() - begin);
+        }
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This object.
+     */
+    signal_scope &operator=(const signal_scope &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This object.
+     */
+    signal_scope &operator=(signal_scope &&) = delete;
+
+private:
+    signal_tracer *tracer;
+    const type_info *info;
+    std::size_t listeners;
+    std::uint64_t begin;
+};
+
+} // namespace entt
+
+#endif
@@ -1,15 +1,26 @@
-#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/algorithm.hpp>
+#include <entt/core/huge_page_pool.hpp>
+#include <entt/core/monotonic_pool.hpp>
 #include <entt/entity/mixin.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/runtime_view.hpp>
+#include <entt/entity/snapshot.hpp>
 #include <entt/entity/storage.hpp>
 #include <entt/entity/view.hpp>
+#include "harness.hpp"
+
+#ifdef ENTT_BENCHMARK_TRACK_ALLOCATIONS
+using registry_type = entt::basic_registry<entt::entity, test::tracked_allocator<entt::entity>>;
+#else
+using registry_type = entt::registry;
+#endif
 
 struct position {
     std::uint64_t x;
@@ -27,36 +38,41 @@ struct comp {
     int x;
 };
 
-struct timer final {
-    timer()
-        : start{std::chrono::system_clock::now()} {}
-
-    void elapsed() {
-        auto now = std::chrono::system_clock::now();
-        std::cout << std::chrono::duration<double>(now - start).count() << " seconds" << std::endl;
-    }
-
-private:
-    std::chrono::time_point<std::chrono::system_clock> start;
-};
+// the default identifiers aren't enough for more than a million entities
+enum class large_entity : std::uint64_t {};
 
 template<typename Func, typename... Args>
-void generic_with(Func func) {
-    timer timer;
+void generic_with(Func func, const std::size_t operations = 1u) {
+    test::timer timer;
     func();
-    timer.elapsed();
+    timer.elapsed(operations);
 }
 
+template<typename Iterable, typename = void>
+struct has_size_hint: std::false_type {};
+
+template<typename Iterable>
+struct has_size_hint<Iterable, std::void_t<decltype(std::declval<const Iterable &>().size_hint())>>: std::true_type {};
+
 template<typename Iterable, typename Func>
 void iterate_with(Iterable &&iterable, Func func) {
-    timer timer;
+    std::size_t operations{};
+
+    // candidate entities, to report hardware events per entity
+    if constexpr(has_size_hint<std::decay_t<Iterable>>::value) {
+        operations = iterable.size_hint();
+    } else {
+        operations = iterable.size();
+    }
+
+    test::timer timer;
     std::forward<Iterable>(iterable).each(func);
-    timer.elapsed();
+    timer.elapsed(operations);
 }
 
 template<typename Func>
 void pathological_with(Func func) {
-    entt::registry registry;
+    registry_type registry;
     auto view = func(registry);
 
     for(std::uint64_t i = 0; i < 500000L; i++) {
@@ -95,36 +111,36 @@ void pathological_with(Func func) {
         }
     }
 
-    timer timer;
+    test::timer timer;
     view.each([](auto &...comp) { ((comp.x = {}), ...); });
     timer.elapsed();
 }
 
 TEST(Benchmark, Create) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Creating 1000000 entities" << std::endl;
 
     generic_with([&]() {
         for(std::uint64_t i = 0; i < 1000000L; i++) {
-            static_cast<void>(registry.create());
+            test::do_not_optimize(registry.create());
         }
-    });
+    }, 1000000u);
 }
 
 TEST(Benchmark, CreateMany) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
 
     std::cout << "Creating 1000000 entities at once" << std::endl;
 
     generic_with([&]() {
         registry.create(entity.begin(), entity.end());
-    });
+    }, 1000000u);
 }
 
 TEST(Benchmark, CreateManyAndEmplaceComponents) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
 
     std::cout << "Creating 1000000 entities at once and emplace components" << std::endl;
@@ -136,11 +152,40 @@ TEST(Benchmark, CreateManyAndEmplaceComponents) {
             registry.emplace<position>(entt);
             registry.emplace<velocity>(entt);
         }
-    });
+    }, 2000000u);
+}
+
+TEST(Benchmark, CreateManyAndEmplaceComponentsMonotonicPool) {
+    using allocator_type = entt::monotonic_pool_allocator<entt::entity>;
+    entt::monotonic_pool pool{};
+    std::vector<entt::entity> entity(1000000);
+
+    std::cout << "Creating 1000000 entities at once and emplace components (monotonic pool)" << std::endl;
+
+    // the first round only warms up the pool, that is meant to be reused
+    for(auto round = 0; round < 2; ++round) {
+        {
+            entt::basic_registry<entt::entity, allocator_type> registry{allocator_type{pool}};
+            test::timer timer;
+
+            registry.create(entity.begin(), entity.end());
+
+            for(const auto entt: entity) {
+                registry.emplace<position>(entt);
+                registry.emplace<velocity>(entt);
+            }
+
+            if(round != 0) {
+                timer.elapsed();
+            }
+        }
+
+        pool.reset();
+    }
 }
 
 TEST(Benchmark, CreateManyWithComponents) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
 
     std::cout << "Creating 1000000 entities at once with components" << std::endl;
@@ -149,11 +194,11 @@ TEST(Benchmark, CreateManyWithComponents) {
         registry.create(entity.begin(), entity.end());
         registry.insert<position>(entity.begin(), entity.end());
         registry.insert<velocity>(entity.begin(), entity.end());
-    });
+    }, 1000000u);
 }
 
 TEST(Benchmark, Erase) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
     auto view = registry.view<position>();
 
@@ -170,7 +215,7 @@ TEST(Benchmark, Erase) {
 }
 
 TEST(Benchmark, EraseMany) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
     auto view = registry.view<position>();
 
@@ -185,7 +230,7 @@ TEST(Benchmark, EraseMany) {
 }
 
 TEST(Benchmark, EraseManyMulti) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
     auto view = registry.view<position>();
 
@@ -201,7 +246,7 @@ TEST(Benchmark, EraseManyMulti) {
 }
 
 TEST(Benchmark, Remove) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
     auto view = registry.view<position>();
 
@@ -218,7 +263,7 @@ TEST(Benchmark, Remove) {
 }
 
 TEST(Benchmark, RemoveMany) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
     auto view = registry.view<position>();
 
@@ -233,7 +278,7 @@ TEST(Benchmark, RemoveMany) {
 }
 
 TEST(Benchmark, RemoveManyMulti) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
     auto view = registry.view<position>();
 
@@ -249,7 +294,7 @@ TEST(Benchmark, RemoveManyMulti) {
 }
 
 TEST(Benchmark, Clear) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
 
     std::cout << "Clearing 1000000 components from their entities" << std::endl;
@@ -263,7 +308,7 @@ TEST(Benchmark, Clear) {
 }
 
 TEST(Benchmark, ClearMulti) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
 
     std::cout << "Clearing 1000000 components per type from their entities" << std::endl;
@@ -278,7 +323,7 @@ TEST(Benchmark, ClearMulti) {
 }
 
 TEST(Benchmark, ClearStable) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
 
     std::cout << "Clearing 1000000 stable components from their entities" << std::endl;
@@ -292,7 +337,7 @@ TEST(Benchmark, ClearStable) {
 }
 
 TEST(Benchmark, Recycle) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
 
     std::cout << "Recycling 1000000 entities" << std::endl;
@@ -308,7 +353,7 @@ TEST(Benchmark, Recycle) {
 }
 
 TEST(Benchmark, RecycleMany) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
 
     std::cout << "Recycling 1000000 entities" << std::endl;
@@ -322,7 +367,7 @@ TEST(Benchmark, RecycleMany) {
 }
 
 TEST(Benchmark, Destroy) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
     auto view = registry.view<position>();
 
@@ -339,7 +384,7 @@ TEST(Benchmark, Destroy) {
 }
 
 TEST(Benchmark, DestroyMany) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
     auto view = registry.view<position>();
 
@@ -354,7 +399,7 @@ TEST(Benchmark, DestroyMany) {
 }
 
 TEST(Benchmark, DestroyManyMulti) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
     auto view = registry.view<position>();
 
@@ -370,7 +415,7 @@ TEST(Benchmark, DestroyManyMulti) {
 }
 
 TEST(Benchmark, GetFromRegistry) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
 
     std::cout << "Getting data for 1000000 entities from a registry, one component" << std::endl;
@@ -386,7 +431,7 @@ TEST(Benchmark, GetFromRegistry) {
 }
 
 TEST(Benchmark, GetFromRegistryMulti) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
 
     std::cout << "Getting data for 1000000 entities from a registry, multiple components" << std::endl;
@@ -404,7 +449,7 @@ TEST(Benchmark, GetFromRegistryMulti) {
 }
 
 TEST(Benchmark, GetFromView) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
     auto view = registry.view<position>();
 
@@ -421,7 +466,7 @@ TEST(Benchmark, GetFromView) {
 }
 
 TEST(Benchmark, GetFromViewMulti) {
-    entt::registry registry;
+    registry_type registry;
     std::vector<entt::entity> entity(1000000);
     auto view = registry.view<position, velocity>();
 
@@ -440,7 +485,7 @@ TEST(Benchmark, GetFromViewMulti) {
 }
 
 TEST(Benchmark, IterateSingleComponent1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, one component" << std::endl;
 
@@ -455,7 +500,7 @@ TEST(Benchmark, IterateSingleComponent1M) {
 }
 
 TEST(Benchmark, IterateSingleStableComponent1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, one stable component" << std::endl;
 
@@ -470,7 +515,7 @@ TEST(Benchmark, IterateSingleStableComponent1M) {
 }
 
 TEST(Benchmark, IterateSingleComponentRuntime1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, one component, runtime view" << std::endl;
 
@@ -479,7 +524,7 @@ TEST(Benchmark, IterateSingleComponentRuntime1M) {
         registry.emplace<position>(entt);
     }
 
-    entt::runtime_view view{};
+    entt::basic_runtime_view<registry_type::common_type> view{};
     view.iterate(registry.storage<position>());
 
     iterate_with(view, [&](auto entt) {
@@ -488,7 +533,7 @@ TEST(Benchmark, IterateSingleComponentRuntime1M) {
 }
 
 TEST(Benchmark, IterateTwoComponents1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, two components" << std::endl;
 
@@ -504,7 +549,7 @@ TEST(Benchmark, IterateTwoComponents1M) {
 }
 
 TEST(Benchmark, IterateTwoStableComponents1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, two stable components" << std::endl;
 
@@ -520,7 +565,7 @@ TEST(Benchmark, IterateTwoStableComponents1M) {
 }
 
 TEST(Benchmark, IterateTwoComponents1MHalf) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, two components, half of the entities have all the components" << std::endl;
 
@@ -539,7 +584,7 @@ TEST(Benchmark, IterateTwoComponents1MHalf) {
 }
 
 TEST(Benchmark, IterateTwoComponents1MOne) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, two components, only one entity has all the components" << std::endl;
 
@@ -558,7 +603,7 @@ TEST(Benchmark, IterateTwoComponents1MOne) {
 }
 
 TEST(Benchmark, IterateTwoComponentsNonOwningGroup1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, two components, non owning group" << std::endl;
 
@@ -574,7 +619,7 @@ TEST(Benchmark, IterateTwoComponentsNonOwningGroup1M) {
 }
 
 TEST(Benchmark, IterateTwoComponentsFullOwningGroup1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, two components, full owning group" << std::endl;
 
@@ -590,7 +635,7 @@ TEST(Benchmark, IterateTwoComponentsFullOwningGroup1M) {
 }
 
 TEST(Benchmark, IterateTwoComponentsPartialOwningGroup1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, two components, partial owning group" << std::endl;
 
@@ -606,7 +651,7 @@ TEST(Benchmark, IterateTwoComponentsPartialOwningGroup1M) {
 }
 
 TEST(Benchmark, IterateTwoComponentsRuntime1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, two components, runtime view" << std::endl;
 
@@ -616,7 +661,7 @@ TEST(Benchmark, IterateTwoComponentsRuntime1M) {
         registry.emplace<velocity>(entt);
     }
 
-    entt::runtime_view view{};
+    entt::basic_runtime_view<registry_type::common_type> view{};
     view.iterate(registry.storage<position>())
         .iterate(registry.storage<velocity>());
 
@@ -627,7 +672,7 @@ TEST(Benchmark, IterateTwoComponentsRuntime1M) {
 }
 
 TEST(Benchmark, IterateTwoComponentsRuntime1MHalf) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, two components, half of the entities have all the components, runtime view" << std::endl;
 
@@ -640,7 +685,7 @@ TEST(Benchmark, IterateTwoComponentsRuntime1MHalf) {
         }
     }
 
-    entt::runtime_view view{};
+    entt::basic_runtime_view<registry_type::common_type> view{};
     view.iterate(registry.storage<position>())
         .iterate(registry.storage<velocity>());
 
@@ -651,7 +696,7 @@ TEST(Benchmark, IterateTwoComponentsRuntime1MHalf) {
 }
 
 TEST(Benchmark, IterateTwoComponentsRuntime1MOne) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, two components, only one entity has all the components, runtime view" << std::endl;
 
@@ -664,7 +709,7 @@ TEST(Benchmark, IterateTwoComponentsRuntime1MOne) {
         }
     }
 
-    entt::runtime_view view{};
+    entt::basic_runtime_view<registry_type::common_type> view{};
     view.iterate(registry.storage<position>())
         .iterate(registry.storage<velocity>());
 
@@ -675,7 +720,7 @@ TEST(Benchmark, IterateTwoComponentsRuntime1MOne) {
 }
 
 TEST(Benchmark, IterateThreeComponents1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, three components" << std::endl;
 
@@ -692,7 +737,7 @@ TEST(Benchmark, IterateThreeComponents1M) {
 }
 
 TEST(Benchmark, IterateThreeStableComponents1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, three stable components" << std::endl;
 
@@ -709,7 +754,7 @@ TEST(Benchmark, IterateThreeStableComponents1M) {
 }
 
 TEST(Benchmark, IterateThreeComponents1MHalf) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, three components, half of the entities have all the components" << std::endl;
 
@@ -729,7 +774,7 @@ TEST(Benchmark, IterateThreeComponents1MHalf) {
 }
 
 TEST(Benchmark, IterateThreeComponents1MOne) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, three components, only one entity has all the components" << std::endl;
 
@@ -749,7 +794,7 @@ TEST(Benchmark, IterateThreeComponents1MOne) {
 }
 
 TEST(Benchmark, IterateThreeComponentsNonOwningGroup1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, three components, non owning group" << std::endl;
 
@@ -766,7 +811,7 @@ TEST(Benchmark, IterateThreeComponentsNonOwningGroup1M) {
 }
 
 TEST(Benchmark, IterateThreeComponentsFullOwningGroup1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, three components, full owning group" << std::endl;
 
@@ -783,7 +828,7 @@ TEST(Benchmark, IterateThreeComponentsFullOwningGroup1M) {
 }
 
 TEST(Benchmark, IterateThreeComponentsPartialOwningGroup1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, three components, partial owning group" << std::endl;
 
@@ -800,7 +845,7 @@ TEST(Benchmark, IterateThreeComponentsPartialOwningGroup1M) {
 }
 
 TEST(Benchmark, IterateThreeComponentsRuntime1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, three components, runtime view" << std::endl;
 
@@ -811,7 +856,7 @@ TEST(Benchmark, IterateThreeComponentsRuntime1M) {
         registry.emplace<comp<0>>(entt);
     }
 
-    entt::runtime_view view{};
+    entt::basic_runtime_view<registry_type::common_type> view{};
     view.iterate(registry.storage<position>())
         .iterate(registry.storage<velocity>())
         .iterate(registry.storage<comp<0>>());
@@ -824,7 +869,7 @@ TEST(Benchmark, IterateThreeComponentsRuntime1M) {
 }
 
 TEST(Benchmark, IterateThreeComponentsRuntime1MHalf) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, three components, half of the entities have all the components, runtime view" << std::endl;
 
@@ -838,7 +883,7 @@ TEST(Benchmark, IterateThreeComponentsRuntime1MHalf) {
         }
     }
 
-    entt::runtime_view view{};
+    entt::basic_runtime_view<registry_type::common_type> view{};
     view.iterate(registry.storage<position>())
         .iterate(registry.storage<velocity>())
         .iterate(registry.storage<comp<0>>());
@@ -851,7 +896,7 @@ TEST(Benchmark, IterateThreeComponentsRuntime1MHalf) {
 }
 
 TEST(Benchmark, IterateThreeComponentsRuntime1MOne) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, three components, only one entity has all the components, runtime view" << std::endl;
 
@@ -865,7 +910,7 @@ TEST(Benchmark, IterateThreeComponentsRuntime1MOne) {
         }
     }
 
-    entt::runtime_view view{};
+    entt::basic_runtime_view<registry_type::common_type> view{};
     view.iterate(registry.storage<position>())
         .iterate(registry.storage<velocity>())
         .iterate(registry.storage<comp<0>>());
@@ -878,7 +923,7 @@ TEST(Benchmark, IterateThreeComponentsRuntime1MOne) {
 }
 
 TEST(Benchmark, IterateFiveComponents1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, five components" << std::endl;
 
@@ -896,8 +941,46 @@ TEST(Benchmark, IterateFiveComponents1M) {
     });
 }
 
+TEST(Benchmark, IterateFiveComponents10M) {
+    entt::basic_registry<large_entity> registry;
+
+    std::cout << "Iterating over 10000000 entities, five components" << std::endl;
+
+    for(std::uint64_t i = 0; i < 10000000L; i++) {
+        const auto entt = registry.create();
+        registry.emplace<position>(entt);
+        registry.emplace<velocity>(entt);
+        registry.emplace<comp<0>>(entt);
+        registry.emplace<comp<1>>(entt);
+        registry.emplace<comp<2>>(entt);
+    }
+
+    iterate_with(registry.view<position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
+        ((comp.x = {}), ...);
+    });
+}
+
+TEST(Benchmark, IterateFiveComponents10MHugePages) {
+    entt::basic_registry<large_entity, entt::huge_page_allocator<large_entity>> registry{};
+
+    std::cout << "Iterating over 10000000 entities, five components (huge pages)" << std::endl;
+
+    for(std::uint64_t i = 0; i < 10000000L; i++) {
+        const auto entt = registry.create();
+        registry.emplace<position>(entt);
+        registry.emplace<velocity>(entt);
+        registry.emplace<comp<0>>(entt);
+        registry.emplace<comp<1>>(entt);
+        registry.emplace<comp<2>>(entt);
+    }
+
+    iterate_with(registry.view<position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
+        ((comp.x = {}), ...);
+    });
+}
+
 TEST(Benchmark, IterateFiveStableComponents1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, five stable components" << std::endl;
 
@@ -916,7 +999,7 @@ TEST(Benchmark, IterateFiveStableComponents1M) {
 }
 
 TEST(Benchmark, IterateFiveComponents1MHalf) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, five components, half of the entities have all the components" << std::endl;
 
@@ -937,8 +1020,35 @@ TEST(Benchmark, IterateFiveComponents1MHalf) {
     });
 }
 
+TEST(Benchmark, IterateFiveComponents1MHalfShuffled) {
+    registry_type registry;
+
+    std::cout << "Iterating over 1000000 entities, five components, half of the entities have all the components, shuffled" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; i++) {
+        const auto entt = registry.create();
+        registry.emplace<velocity>(entt);
+        registry.emplace<comp<0>>(entt);
+        registry.emplace<comp<1>>(entt);
+        registry.emplace<comp<2>>(entt);
+
+        if(i % 2) {
+            registry.emplace<position>(entt);
+        }
+    }
+
+    // the leading storage visits the other ones in a random-like order
+    registry.sort<position>([](const entt::entity lhs, const entt::entity rhs) {
+        return (entt::to_integral(lhs) * 2654435761u) < (entt::to_integral(rhs) * 2654435761u);
+    });
+
+    iterate_with(registry.view<position, velocity, comp<0>, comp<1>, comp<2>>(), [](auto &...comp) {
+        ((comp.x = {}), ...);
+    });
+}
+
 TEST(Benchmark, IterateFiveComponents1MOne) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, five components, only one entity has all the components" << std::endl;
 
@@ -960,7 +1070,7 @@ TEST(Benchmark, IterateFiveComponents1MOne) {
 }
 
 TEST(Benchmark, IterateFiveComponentsNonOwningGroup1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, five components, non owning group" << std::endl;
 
@@ -979,7 +1089,7 @@ TEST(Benchmark, IterateFiveComponentsNonOwningGroup1M) {
 }
 
 TEST(Benchmark, IterateFiveComponentsFullOwningGroup1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, five components, full owning group" << std::endl;
 
@@ -998,7 +1108,7 @@ TEST(Benchmark, IterateFiveComponentsFullOwningGroup1M) {
 }
 
 TEST(Benchmark, IterateFiveComponentsPartialFourOfFiveOwningGroup1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, five components, partial (4 of 5) owning group" << std::endl;
 
@@ -1017,7 +1127,7 @@ TEST(Benchmark, IterateFiveComponentsPartialFourOfFiveOwningGroup1M) {
 }
 
 TEST(Benchmark, IterateFiveComponentsPartialThreeOfFiveOwningGroup1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, five components, partial (3 of 5) owning group" << std::endl;
 
@@ -1036,7 +1146,7 @@ TEST(Benchmark, IterateFiveComponentsPartialThreeOfFiveOwningGroup1M) {
 }
 
 TEST(Benchmark, IterateFiveComponentsRuntime1M) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, five components, runtime view" << std::endl;
 
@@ -1049,7 +1159,7 @@ TEST(Benchmark, IterateFiveComponentsRuntime1M) {
         registry.emplace<comp<2>>(entt);
     }
 
-    entt::runtime_view view{};
+    entt::basic_runtime_view<registry_type::common_type> view{};
     view.iterate(registry.storage<position>())
         .iterate(registry.storage<velocity>())
         .iterate(registry.storage<comp<0>>())
@@ -1066,7 +1176,7 @@ TEST(Benchmark, IterateFiveComponentsRuntime1M) {
 }
 
 TEST(Benchmark, IterateFiveComponentsRuntime1MHalf) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, five components, half of the entities have all the components, runtime view" << std::endl;
 
@@ -1082,7 +1192,7 @@ TEST(Benchmark, IterateFiveComponentsRuntime1MHalf) {
         }
     }
 
-    entt::runtime_view view{};
+    entt::basic_runtime_view<registry_type::common_type> view{};
     view.iterate(registry.storage<position>())
         .iterate(registry.storage<velocity>())
         .iterate(registry.storage<comp<0>>())
@@ -1099,7 +1209,7 @@ TEST(Benchmark, IterateFiveComponentsRuntime1MHalf) {
 }
 
 TEST(Benchmark, IterateFiveComponentsRuntime1MOne) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Iterating over 1000000 entities, five components, only one entity has all the components, runtime view" << std::endl;
 
@@ -1115,7 +1225,7 @@ TEST(Benchmark, IterateFiveComponentsRuntime1MOne) {
         }
     }
 
-    entt::runtime_view view{};
+    entt::basic_runtime_view<registry_type::common_type> view{};
     view.iterate(registry.storage<position>())
         .iterate(registry.storage<velocity>())
         .iterate(registry.storage<comp<0>>())
@@ -1152,7 +1262,7 @@ TEST(Benchmark, IteratePathologicalPartialOwningGroup) {
 }
 
 TEST(Benchmark, SortSingle) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Sort 150000 entities, one component" << std::endl;
 
@@ -1167,7 +1277,7 @@ TEST(Benchmark, SortSingle) {
 }
 
 TEST(Benchmark, SortMulti) {
-    entt::registry registry;
+    registry_type registry;
 
     std::cout << "Sort 150000 entities, two components" << std::endl;
 
@@ -1185,7 +1295,7 @@ TEST(Benchmark, SortMulti) {
 }
 
 TEST(Benchmark, AlmostSortedStdSort) {
-    entt::registry registry;
+    registry_type registry;
     entt::entity entity[3]{};
 
     std::cout << "Sort 150000 entities, almost sorted, std::sort" << std::endl;
@@ -1211,7 +1321,7 @@ TEST(Benchmark, AlmostSortedStdSort) {
 }
 
 TEST(Benchmark, AlmostSortedInsertionSort) {
-    entt::registry registry;
+    registry_type registry;
     entt::entity entity[3]{};
 
     std::cout << "Sort 150000 entities, almost sorted, insertion sort" << std::endl;
@@ -1235,3 +1345,44 @@ TEST(Benchmark, AlmostSortedInsertionSort) {
         registry.sort<position>([](const auto &lhs, const auto &rhs) { return lhs.x > rhs.x && lhs.y > rhs.y; }, entt::insertion_sort{});
     });
 }
+
+TEST(Benchmark, ContinuousLoader1M) {
+    registry_type source;
+    registry_type registry;
+    entt::basic_continuous_loader<registry_type> loader{registry};
+    std::vector<entt::entity> entity(1000000u);
+    std::vector<entt::entity> data{};
+    std::size_t pos{};
+
+    std::cout << "Restore 1000000 entities, one component, then remap them" << std::endl;
+
+    source.create(entity.begin(), entity.end());
+    source.insert<comp<0>>(entity.begin(), entity.end());
+
+    auto output = [&data](const auto &value) {
+        if constexpr(std::is_same_v<std::decay_t<decltype(value)>, entt::entity>) {
+            data.push_back(value);
+        } else if constexpr(std::is_same_v<std::decay_t<decltype(value)>, comp<0>>) {
+            data.push_back(static_cast<entt::entity>(value.x));
+        } else {
+            data.push_back(static_cast<entt::entity>(value));
+        }
+    };
+
+    auto input = [&data, &pos](auto &value) {
+        if constexpr(std::is_same_v<std::decay_t<decltype(value)>, entt::entity>) {
+            value = data[pos++];
+        } else if constexpr(std::is_same_v<std::decay_t<decltype(value)>, comp<0>>) {
+            value.x = static_cast<int>(data[pos++]);
+        } else {
+            value = static_cast<std::decay_t<decltype(value)>>(data[pos++]);
+        }
+    };
+
+    entt::basic_snapshot<registry_type>{source}.get<entt::entity>(output).get<comp<0>>(output);
+
+    generic_with([&]() {
+        loader.get<entt::entity>(input).get<comp<0>>(input);
+        loader.map(entity.begin(), entity.end(), entity.begin());
+    });
+}
@@ -0,0 +1,61 @@
+#include <cstddef>
+#include <utility>
+#include <entt/core/hashed_string.hpp>
+#include <entt/entity/group.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/view.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+
+// translation unit used to measure the cost of instantiating many distinct
+// views, groups or meta types, see compile_time.cmake
+
+#ifndef ENTT_COMPILE_COUNT
+#    define ENTT_COMPILE_COUNT 10
+#endif
+
+template<std::size_t>
+struct comp {
+    int value;
+
+    [[nodiscard]] int get() const {
+        return value;
+    }
+};
+
+template<std::size_t... Index>
+void views(entt::registry &registry, std::index_sequence<Index...>) {
+    ((registry.view<comp<Index>, comp<Index + 1u>, const comp<Index + 2u>>().each([](auto &lhs, auto &rhs, const auto &other) {
+         lhs.value += rhs.value + other.value;
+     })),
+     ...);
+}
+
+template<std::size_t... Index>
+void groups(entt::registry &registry, std::index_sequence<Index...>) {
+    ((registry.group<comp<3u * Index>>(entt::get<comp<3u * Index + 1u>>, entt::exclude<comp<3u * Index + 2u>>).each([](auto &lhs, auto &rhs) {
+         lhs.value += rhs.value;
+     })),
+     ...);
+}
+
+template<std::size_t... Index>
+void meta(std::index_sequence<Index...>) {
+    using namespace entt::literals;
+
+    ((entt::meta_factory<comp<Index>>{}
+          .type(static_cast<entt::id_type>(Index + 1u))
+          .template data<&comp<Index>::value>("value"_hs)
+          .template func<&comp<Index>::get>("get"_hs)),
+     ...);
+}
+
+void instantiate([[maybe_unused]] entt::registry &registry) {
+#if defined(ENTT_COMPILE_VIEWS)
+    views(registry, std::make_index_sequence<ENTT_COMPILE_COUNT>{});
+#elif defined(ENTT_COMPILE_GROUPS)
+    groups(registry, std::make_index_sequence<ENTT_COMPILE_COUNT>{});
+#elif defined(ENTT_COMPILE_META)
+    meta(std::make_index_sequence<ENTT_COMPILE_COUNT>{});
+#endif
+}
@@ -0,0 +1,66 @@
+# Measures the front-end time and the object size of translation units that
+# instantiate a growing number of distinct views, groups or meta types.
+#
+# Usage:
+#   cmake -DCOMPILER=<c++> -DINCLUDE=<src> -DSOURCE=<compile.cpp> -DOUTPUT=<dir> [-DFLAGS=<flags>] [-DCOUNTS=<list>] -P compile_time.cmake
+
+cmake_minimum_required(VERSION 3.23)
+
+if(NOT DEFINED COUNTS)
+    set(COUNTS 10 20 40)
+endif()
+
+separate_arguments(EXTRA_FLAGS UNIX_COMMAND "${FLAGS}")
+file(MAKE_DIRECTORY ${OUTPUT})
+
+function(NOW RESULT)
+    string(TIMESTAMP seconds "%s")
+    string(TIMESTAMP micro "%f")
+    math(EXPR value "${seconds} * 1000 + ${micro} / 1000")
+    set(${RESULT} ${value} PARENT_SCOPE)
+endfunction()
+
+function(COMPILE KIND COUNT MODE OBJECT RESULT)
+    NOW(start)
+
+    execute_process(
+        COMMAND ${COMPILER} -std=c++17 ${EXTRA_FLAGS} -I${INCLUDE} -DENTT_COMPILE_${KIND} -DENTT_COMPILE_COUNT=${COUNT} ${MODE} ${SOURCE} -o ${OBJECT}
+        RESULT_VARIABLE status
+        ERROR_VARIABLE errors
+    )
+
+    NOW(stop)
+
+    if(NOT status EQUAL 0)
+        message(FATAL_ERROR "Failed to compile ${KIND} x ${COUNT}:\n${errors}")
+    endif()
+
+    math(EXPR elapsed "${stop} - ${start}")
+    set(${RESULT} ${elapsed} PARENT_SCOPE)
+endfunction()
+
+set(json "{\n  \"benchmarks\": [")
+set(separator "")
+
+message(STATUS "kind        count   front-end (ms)   total (ms)   object (bytes)")
+
+foreach(KIND VIEWS GROUPS META)
+    foreach(COUNT ${COUNTS})
+        set(object ${OUTPUT}/${KIND}_${COUNT}.o)
+
+        COMPILE(${KIND} ${COUNT} -fsyntax-only ${object} frontend)
+        COMPILE(${KIND} ${COUNT} -c ${object} total)
+        file(SIZE ${object} size)
+
+        string(TOLOWER ${KIND} name)
+        string(APPEND json "${separator}\n    {\"name\": \"${name}\", \"count\": ${COUNT}, \"frontend_ms\": ${frontend}, \"total_ms\": ${total}, \"object_bytes\": ${size}}")
+        set(separator ",")
+
+        string(SUBSTRING "${name}          " 0 10 label)
+        message(STATUS "${label}  ${COUNT}\t  ${frontend}\t\t   ${total}\t${size}")
+    endforeach()
+endforeach()
+
+string(APPEND json "\n  ]\n}\n")
+file(WRITE ${OUTPUT}/compile_time.json "${json}")
+message(STATUS "Results written to ${OUTPUT}/compile_time.json")
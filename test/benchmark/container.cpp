@@ -0,0 +1,138 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <gtest/gtest.h>
+#include <entt/container/dense_map.hpp>
+#include <entt/container/dense_set.hpp>
+#include "harness.hpp"
+
+TEST(Benchmark, DenseMapInsert) {
+    entt::dense_map<std::uint64_t, std::uint64_t> map;
+
+    std::cout << "Inserting 1000000 elements" << std::endl;
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        map.emplace(i, i);
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(map.size());
+}
+
+TEST(Benchmark, DenseMapInsertReserved) {
+    entt::dense_map<std::uint64_t, std::uint64_t> map;
+
+    std::cout << "Inserting 1000000 elements, capacity reserved" << std::endl;
+
+    map.reserve(1000000L);
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        map.emplace(i, i);
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(map.size());
+}
+
+TEST(Benchmark, DenseMapFind) {
+    entt::dense_map<std::uint64_t, std::uint64_t> map;
+    std::uint64_t total{};
+
+    std::cout << "Looking up 1000000 elements" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        map.emplace(i, i);
+    }
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        total += map.find(i)->second;
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
+
+TEST(Benchmark, DenseMapFindMissing) {
+    entt::dense_map<std::uint64_t, std::uint64_t> map;
+    std::size_t total{};
+
+    std::cout << "Looking up 1000000 missing elements" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        map.emplace(i, i);
+    }
+
+    test::timer timer;
+
+    for(std::uint64_t i = 1000000L; i < 2000000L; ++i) {
+        total += map.contains(i);
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
+
+TEST(Benchmark, DenseMapErase) {
+    entt::dense_map<std::uint64_t, std::uint64_t> map;
+
+    std::cout << "Erasing 1000000 elements" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        map.emplace(i, i);
+    }
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        map.erase(i);
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(map.size());
+}
+
+TEST(Benchmark, DenseMapIterate) {
+    entt::dense_map<std::uint64_t, std::uint64_t> map;
+    std::uint64_t total{};
+
+    std::cout << "Iterating over 1000000 elements" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        map.emplace(i, i);
+    }
+
+    test::timer timer;
+
+    for(auto &&elem: map) {
+        total += elem.second;
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
+
+TEST(Benchmark, DenseSetInsertFind) {
+    entt::dense_set<std::uint64_t> set;
+    std::size_t total{};
+
+    std::cout << "Inserting and looking up 1000000 elements" << std::endl;
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        set.emplace(i);
+    }
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        total += set.contains(i);
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
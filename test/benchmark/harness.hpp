@@ -0,0 +1,484 @@
+#ifndef ENTT_BENCHMARK_HARNESS_HPP
+#define ENTT_BENCHMARK_HARNESS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#ifdef ENTT_BENCHMARK_TRACK_ALLOCATIONS
+#    include "../common/tracked_memory_resource.hpp"
+#
+#    ifndef ENTT_HAS_TRACKED_MEMORY_RESOURCE
+#        error "Tracking allocations requires std::pmr"
+#    endif
+#endif
+
+#ifdef ENTT_BENCHMARK_PERF_COUNTERS
+#    if !defined(__linux__) || !__has_include(<linux/perf_event.h>)
+#        error "Hardware counters require perf_event_open"
+#    endif
+#
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace test {
+
+/*! Hardware events counted for each sample, when supported. */
+inline constexpr std::array<const char *, 5u> perf_events{"cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses"};
+
+/*! Values of the hardware events of a sample. */
+using perf_values = std::array<std::uint64_t, perf_events.size()>;
+
+#ifdef ENTT_BENCHMARK_PERF_COUNTERS
+/**
+ * Hardware performance counters of the calling thread, through
+ * `perf_event_open`.
+ *
+ * Only user space is measured, which works with the default settings of most
+ * systems. Counters that can't be opened (for lack of permissions or support)
+ * always read as zero. Threads other than the calling one aren't counted.
+ */
+class perf_counters final {
+    static int open(const std::uint32_t type, const std::uint64_t config) {
+        perf_event_attr attr{};
+        attr.type = type;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+public:
+    perf_counters()
+        : fd{open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES),
+             open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS),
+             open(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8u) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16u)),
+             open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES),
+             open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES)} {}
+
+    perf_counters(const perf_counters &) = delete;
+    perf_counters &operator=(const perf_counters &) = delete;
+
+    ~perf_counters() {
+        for(auto elem: fd) {
+            if(elem >= 0) {
+                close(elem);
+            }
+        }
+    }
+
+    /**
+     * Checks whether counters are available at all.
+     * @return True if at least cycles are counted, false otherwise.
+     */
+    [[nodiscard]] bool available() const noexcept {
+        return (fd[0u] >= 0);
+    }
+
+    /*! Resets and starts all counters. */
+    void start() noexcept {
+        for(auto elem: fd) {
+            if(elem >= 0) {
+                ioctl(elem, PERF_EVENT_IOC_RESET, 0);
+                ioctl(elem, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+    }
+
+    /**
+     * Stops all counters and returns their values.
+     * @return The values of all counters.
+     */
+    [[nodiscard]] perf_values stop() noexcept {
+        perf_values values{};
+
+        for(std::size_t pos{}; pos < fd.size(); ++pos) {
+            if(fd[pos] >= 0) {
+                ioctl(fd[pos], PERF_EVENT_IOC_DISABLE, 0);
+
+                if(read(fd[pos], &values[pos], sizeof(values[pos])) != static_cast<ssize_t>(sizeof(values[pos]))) {
+                    values[pos] = 0u;
+                }
+            }
+        }
+
+        return values;
+    }
+
+private:
+    std::array<int, perf_events.size()> fd;
+};
+#endif
+
+/**
+ * Prevents the compiler from optimizing away a value.
+ * @tparam Type Type of value to keep alive.
+ * @param value The value to keep alive.
+ */
+template<typename Type>
+inline void do_not_optimize(Type &&value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void *sink{};
+    sink = &value;
+#endif
+}
+
+/*! Prevents the compiler from reordering memory accesses across the call. */
+inline void clobber_memory() {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_acq_rel);
+#endif
+}
+
+/**
+ * Collects the samples of all benchmarks and reports them on exit.
+ *
+ * Each measure is a sample of the running test. Repetitions come from running
+ * the whole program with `--gtest_repeat=N`, so that every sample also
+ * repeats the setup of its test.<br/>
+ * The first `ENTT_BENCHMARK_WARMUP` samples of each benchmark (one by default
+ * when repeating) are discarded. If `ENTT_BENCHMARK_JSON` is set, results are
+ * also written to the file it names, in a machine-readable format.
+ *
+ * When `ENTT_BENCHMARK_TRACK_ALLOCATIONS` is defined, the report owns a
+ * tracking memory resource. Containers that use a `tracked_allocator` draw
+ * from it and the number of allocations per operation and the peak of memory
+ * in use during each sample are reported along with times.
+ *
+ * When `ENTT_BENCHMARK_PERF_COUNTERS` is defined, hardware counters (cycles,
+ * instructions, cache and branch misses) are also collected for each sample on
+ * Linux and reported per operation, along with the instructions per cycle.
+ */
+class benchmark_report final: public testing::EmptyTestEventListener {
+    struct statistics {
+        std::size_t samples{};
+        double min{};
+        double median{};
+        double p90{};
+        double p99{};
+        double max{};
+        double mean{};
+        double stddev{};
+    };
+
+    struct sample {
+        std::vector<double> seconds{};
+        std::vector<double> allocations{};
+        std::vector<double> peak{};
+        std::array<std::vector<double>, perf_events.size()> events{};
+    };
+
+    [[nodiscard]] static std::size_t warmup(const std::size_t count) {
+        if(const char *value = std::getenv("ENTT_BENCHMARK_WARMUP"); value) {
+            return static_cast<std::size_t>(std::strtoul(value, nullptr, 10));
+        }
+
+        return static_cast<std::size_t>(count > 1u);
+    }
+
+    [[nodiscard]] static statistics analyze(std::vector<double> values) {
+        statistics stats{};
+        values.erase(values.begin(), values.begin() + static_cast<std::ptrdiff_t>((std::min)(warmup(values.size()), values.size() - 1u)));
+        std::sort(values.begin(), values.end());
+
+        const auto rank = [&values](const double pct) {
+            // nearest-rank percentile
+            const auto pos = static_cast<std::size_t>(std::ceil(pct * static_cast<double>(values.size())));
+            return values[(std::max)(pos, std::size_t{1u}) - 1u];
+        };
+
+        stats.samples = values.size();
+        stats.min = values.front();
+        stats.max = values.back();
+        stats.median = (values.size() % 2u) ? values[values.size() / 2u] : ((values[values.size() / 2u - 1u] + values[values.size() / 2u]) / 2.);
+        stats.p90 = rank(.9);
+        stats.p99 = rank(.99);
+
+        for(auto elem: values) {
+            stats.mean += elem;
+        }
+
+        stats.mean /= static_cast<double>(values.size());
+
+        for(auto elem: values) {
+            stats.stddev += (elem - stats.mean) * (elem - stats.mean);
+        }
+
+        stats.stddev = (values.size() > 1u) ? std::sqrt(stats.stddev / static_cast<double>(values.size() - 1u)) : 0.;
+
+        return stats;
+    }
+
+    void OnTestStart(const testing::TestInfo &info) override {
+        current = std::string{info.test_suite_name()} + '.' + info.name();
+        count = 0u;
+    }
+
+    void OnTestProgramEnd(const testing::UnitTest &) override {
+        if(samples.empty()) {
+            return;
+        }
+
+        std::cout << '\n'
+                  << std::left << std::setw(56) << "benchmark" << std::right << std::setw(8) << "samples" << std::setw(14) << "median (s)" << std::setw(14) << "p90 (s)" << std::setw(14) << "min (s)" << std::setw(12) << "stddev (%)";
+
+#ifdef ENTT_BENCHMARK_TRACK_ALLOCATIONS
+        std::cout << std::setw(14) << "allocs/op" << std::setw(14) << "peak (bytes)";
+#endif
+
+#ifdef ENTT_BENCHMARK_PERF_COUNTERS
+        std::cout << std::setw(12) << "cycles/op" << std::setw(8) << "IPC" << std::setw(12) << "L1D/op" << std::setw(12) << "LLC/op" << std::setw(12) << "branch/op";
+#endif
+
+        std::cout << '\n';
+
+        std::ofstream json{};
+
+        if(const char *path = std::getenv("ENTT_BENCHMARK_JSON"); path) {
+            json.open(path);
+            json << "{\n  \"benchmarks\": [";
+        }
+
+        bool first = true;
+
+        for(auto &&[name, values]: samples) {
+            const auto stats = analyze(values.seconds);
+
+            std::cout << std::left << std::setw(56) << name << std::right << std::setw(8) << stats.samples << std::fixed << std::setprecision(6) << std::setw(14) << stats.median << std::setw(14) << stats.p90 << std::setw(14) << stats.min << std::setprecision(2) << std::setw(12) << (stats.mean > 0. ? (100. * stats.stddev / stats.mean) : 0.) << std::defaultfloat;
+
+#ifdef ENTT_BENCHMARK_TRACK_ALLOCATIONS
+            const auto allocations = analyze(values.allocations).median;
+            const auto peak = analyze(values.peak).median;
+            std::cout << std::fixed << std::setprecision(4) << std::setw(14) << allocations << std::setprecision(0) << std::setw(14) << peak << std::defaultfloat;
+#endif
+
+#ifdef ENTT_BENCHMARK_PERF_COUNTERS
+            std::array<double, perf_events.size()> events{};
+
+            for(std::size_t pos{}; pos < events.size(); ++pos) {
+                events[pos] = analyze(values.events[pos]).median;
+            }
+
+            const auto ipc = (events[0u] > 0.) ? (events[1u] / events[0u]) : 0.;
+            std::cout << std::fixed << std::setprecision(2) << std::setw(12) << events[0u] << std::setw(8) << ipc << std::setprecision(4) << std::setw(12) << events[2u] << std::setw(12) << events[3u] << std::setw(12) << events[4u] << std::defaultfloat;
+#endif
+
+            std::cout << '\n';
+
+            if(json.is_open()) {
+                json << (std::exchange(first, false) ? "" : ",") << "\n    {\"name\": \"" << name << "\", \"unit\": \"s\", \"samples\": " << stats.samples
+                     << std::setprecision(9) << ", \"min\": " << stats.min << ", \"median\": " << stats.median << ", \"p90\": " << stats.p90 << ", \"p99\": " << stats.p99
+                     << ", \"max\": " << stats.max << ", \"mean\": " << stats.mean << ", \"stddev\": " << stats.stddev;
+
+#ifdef ENTT_BENCHMARK_TRACK_ALLOCATIONS
+                json << ", \"allocations_per_operation\": " << allocations << ", \"peak_bytes\": " << peak;
+#endif
+
+#ifdef ENTT_BENCHMARK_PERF_COUNTERS
+                for(std::size_t pos{}; pos < events.size(); ++pos) {
+                    json << ", \"" << perf_events[pos] << "_per_operation\": " << events[pos];
+                }
+
+                json << ", \"ipc\": " << ipc;
+#endif
+
+                json << "}";
+            }
+        }
+
+        if(json.is_open()) {
+            json << "\n  ]\n}\n";
+        }
+    }
+
+public:
+    /**
+     * Returns the report shared by all benchmarks.
+     * @return The report shared by all benchmarks.
+     */
+    [[nodiscard]] static benchmark_report &instance() {
+        // owned by gtest once appended to the list of listeners
+        static benchmark_report *elem = [] {
+            auto *listener = new benchmark_report{};
+            testing::UnitTest::GetInstance()->listeners().Append(listener);
+#ifdef ENTT_BENCHMARK_PERF_COUNTERS
+            if(!listener->perf.available()) {
+                std::cerr << "hardware counters aren't available, check perf_event_paranoid" << std::endl;
+            }
+#endif
+            return listener;
+        }();
+
+        return *elem;
+    }
+
+    /**
+     * Records a sample for the running test.
+     * @param seconds Duration of the sample, in seconds.
+     * @param operations Number of operations measured by the sample.
+     * @param allocations Number of allocations performed during the sample.
+     * @param peak Peak of memory in use during the sample, in bytes.
+     * @param events Hardware events counted during the sample.
+     */
+    void record(const double seconds, const std::size_t operations = 1u, const std::size_t allocations = 0u, const std::size_t peak = 0u, const perf_values &events = {}) {
+        const auto length = static_cast<double>((std::max)(operations, std::size_t{1u}));
+        auto name = (count++ == 0u) ? current : (current + '#' + std::to_string(count));
+        auto &elem = samples[std::move(name)];
+        elem.seconds.push_back(seconds);
+        elem.allocations.push_back(static_cast<double>(allocations) / length);
+        elem.peak.push_back(static_cast<double>(peak));
+
+        for(std::size_t pos{}; pos < events.size(); ++pos) {
+            elem.events[pos].push_back(static_cast<double>(events[pos]) / length);
+        }
+
+        std::cout << seconds << " seconds" << std::endl;
+    }
+
+#ifdef ENTT_BENCHMARK_TRACK_ALLOCATIONS
+    /**
+     * Returns the memory resource that tracks allocations.
+     * @return The memory resource that tracks allocations.
+     */
+    [[nodiscard]] tracked_memory_resource &resource() noexcept {
+        return tracker;
+    }
+
+private:
+    tracked_memory_resource tracker{};
+#endif
+
+#ifdef ENTT_BENCHMARK_PERF_COUNTERS
+public:
+    /**
+     * Returns the hardware counters of the main thread.
+     * @return The hardware counters of the main thread.
+     */
+    [[nodiscard]] perf_counters &counters() noexcept {
+        return perf;
+    }
+
+private:
+    perf_counters perf{};
+#endif
+
+private:
+    std::map<std::string, sample> samples{};
+    std::string current{};
+    std::size_t count{};
+};
+
+#ifdef ENTT_BENCHMARK_TRACK_ALLOCATIONS
+/**
+ * Allocator that draws memory from the tracking resource of the report.
+ *
+ * Unlike polymorphic allocators, it doesn't propagate itself to the elements
+ * it constructs, so that containers work with it as with any other allocator.
+ *
+ * @tparam Type Type of elements to allocate.
+ */
+template<typename Type>
+struct tracked_allocator {
+    using value_type = Type;
+
+    tracked_allocator() noexcept = default;
+
+    template<typename Other>
+    tracked_allocator(const tracked_allocator<Other> &) noexcept {}
+
+    [[nodiscard]] Type *allocate(const std::size_t length) {
+        return static_cast<Type *>(benchmark_report::instance().resource().allocate(length * sizeof(Type), alignof(Type)));
+    }
+
+    void deallocate(Type *ptr, const std::size_t length) noexcept {
+        benchmark_report::instance().resource().deallocate(ptr, length * sizeof(Type), alignof(Type));
+    }
+
+    template<typename Other>
+    [[nodiscard]] bool operator==(const tracked_allocator<Other> &) const noexcept {
+        return true;
+    }
+
+    template<typename Other>
+    [[nodiscard]] bool operator!=(const tracked_allocator<Other> &) const noexcept {
+        return false;
+    }
+};
+#endif
+
+/*! Measures the time elapsed and the memory allocated since its construction. */
+struct timer final {
+    timer()
+        : allocations{baseline()},
+          start{(clobber_memory(), std::chrono::steady_clock::now())} {
+#ifdef ENTT_BENCHMARK_PERF_COUNTERS
+        benchmark_report::instance().counters().start();
+#endif
+    }
+
+    /**
+     * Records the time elapsed so far as a sample of the running test.
+     * @param operations Number of operations measured, to report allocations
+     * and hardware events per operation.
+     */
+    void elapsed(const std::size_t operations = 1u) {
+        clobber_memory();
+        perf_values events{};
+#ifdef ENTT_BENCHMARK_PERF_COUNTERS
+        events = benchmark_report::instance().counters().stop();
+#endif
+        const auto now = std::chrono::steady_clock::now();
+        const auto seconds = std::chrono::duration<double>(now - start).count();
+#ifdef ENTT_BENCHMARK_TRACK_ALLOCATIONS
+        auto &tracker = benchmark_report::instance().resource();
+        benchmark_report::instance().record(seconds, operations, tracker.do_allocate_counter() - allocations, tracker.peak_bytes() - in_use, events);
+#else
+        benchmark_report::instance().record(seconds, operations, 0u, 0u, events);
+#endif
+    }
+
+private:
+    std::size_t baseline() {
+#ifdef ENTT_BENCHMARK_TRACK_ALLOCATIONS
+        auto &tracker = benchmark_report::instance().resource();
+        tracker.reset_peak();
+        in_use = tracker.bytes_in_use();
+        return tracker.do_allocate_counter();
+#else
+        return 0u;
+#endif
+    }
+
+    std::size_t in_use{};
+    std::size_t allocations;
+    std::chrono::time_point<std::chrono::steady_clock> start;
+};
+
+// registers the report before tests start running
+inline const auto &benchmark_report_instance = benchmark_report::instance();
+
+} // namespace test
+
+#endif
@@ -0,0 +1,161 @@
+#include <cstdint>
+#include <iostream>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+#include <entt/meta/resolve.hpp>
+#include "harness.hpp"
+
+struct base {
+    std::uint64_t value{};
+};
+
+struct derived: base {
+    std::uint64_t other{};
+};
+
+template<auto>
+struct member {};
+
+struct Benchmark: ::testing::Test {
+    void SetUp() override {
+        using namespace entt::literals;
+
+        entt::meta_factory<base>{}
+            .type("base"_hs)
+            .data<&base::value>("value"_hs);
+
+        entt::meta_factory<derived>{}
+            .type("derived"_hs)
+            .base<base>()
+            .data<&derived::other>("other"_hs)
+            .data<&derived::other>("a"_hs)
+            .data<&derived::other>("b"_hs)
+            .data<&derived::other>("c"_hs)
+            .data<&derived::other>("d"_hs)
+            .data<&derived::other>("e"_hs)
+            .data<&derived::other>("f"_hs)
+            .data<&derived::other>("g"_hs);
+    }
+
+    void TearDown() override {
+        entt::meta_reset();
+    }
+};
+
+TEST_F(Benchmark, MetaResolve) {
+    using namespace entt::literals;
+    std::uint64_t total{};
+
+    std::cout << "Resolving 1000000 types by identifier" << std::endl;
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        total += static_cast<bool>(entt::resolve("derived"_hs));
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
+
+TEST_F(Benchmark, MetaTypeData) {
+    using namespace entt::literals;
+    const auto type = entt::resolve<derived>();
+    std::uint64_t total{};
+
+    std::cout << "Looking up 1000000 data members by identifier" << std::endl;
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        total += static_cast<bool>(type.data("other"_hs));
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
+
+TEST_F(Benchmark, MetaTypeDataFromBase) {
+    using namespace entt::literals;
+    const auto type = entt::resolve<derived>();
+    std::uint64_t total{};
+
+    std::cout << "Looking up 1000000 inherited data members by identifier" << std::endl;
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        total += static_cast<bool>(type.data("value"_hs));
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
+
+TEST_F(Benchmark, MetaDataGet) {
+    using namespace entt::literals;
+    const auto data = entt::resolve<derived>().data("other"_hs);
+    derived instance{};
+    std::uint64_t total{};
+
+    std::cout << "Getting 1000000 data members through a meta_any" << std::endl;
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        total += data.get(entt::forward_as_meta(instance)).cast<std::uint64_t>();
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
+
+TEST_F(Benchmark, MetaAnyCast) {
+    entt::meta_any any{derived{}};
+    std::uint64_t total{};
+
+    std::cout << "Casting a meta_any 1000000 times to its own type" << std::endl;
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        total += any.cast<derived &>().other;
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
+
+TEST_F(Benchmark, MetaAnyCastToBase) {
+    entt::meta_any any{derived{}};
+    std::uint64_t total{};
+
+    std::cout << "Casting a meta_any 1000000 times to a base type" << std::endl;
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        total += any.cast<base &>().value;
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
+
+TEST_F(Benchmark, MetaAnyAllowCast) {
+    const entt::meta_any any{std::uint64_t{1u}};
+    std::uint64_t total{};
+
+    std::cout << "Converting a meta_any 1000000 times" << std::endl;
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        total += any.allow_cast<double>().cast<double>() > 0.;
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
@@ -0,0 +1,133 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/type_traits.hpp>
+#include <entt/poly/poly.hpp>
+#include "harness.hpp"
+
+struct Counter: entt::type_list<> {
+    template<typename Base>
+    struct type: Base {
+        void incr(std::uint64_t value) {
+            entt::poly_call<0>(*this, value);
+        }
+
+        [[nodiscard]] std::uint64_t get() const {
+            return entt::poly_call<1>(*this);
+        }
+    };
+
+    template<typename Type>
+    using impl = entt::value_list<&Type::incr, &Type::get>;
+};
+
+struct InlineCounter: Counter {
+    static constexpr bool inline_vtable = true;
+};
+
+struct counter {
+    void incr(std::uint64_t value) {
+        total += value;
+    }
+
+    [[nodiscard]] std::uint64_t get() const {
+        return total;
+    }
+
+    std::uint64_t total{};
+};
+
+struct virtual_counter {
+    virtual ~virtual_counter() = default;
+    virtual void incr(std::uint64_t) = 0;
+    [[nodiscard]] virtual std::uint64_t get() const = 0;
+};
+
+struct virtual_counter_impl final: virtual_counter {
+    void incr(std::uint64_t value) override {
+        total += value;
+    }
+
+    [[nodiscard]] std::uint64_t get() const override {
+        return total;
+    }
+
+    std::uint64_t total{};
+};
+
+template<typename Concept>
+void poly_call_with(const char *label) {
+    std::vector<entt::poly<Concept>> instances(1000u, counter{});
+    std::uint64_t total{};
+
+    std::cout << "Invoking 1000x1000 " << label << " poly calls" << std::endl;
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000L; ++i) {
+        for(auto &&elem: instances) {
+            elem->incr(i);
+        }
+    }
+
+    for(auto &&elem: instances) {
+        total += elem->get();
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
+
+TEST(Benchmark, PolyCall) {
+    poly_call_with<Counter>("indirect");
+}
+
+TEST(Benchmark, PolyCallInlineVtable) {
+    poly_call_with<InlineCounter>("inline");
+}
+
+TEST(Benchmark, VirtualCall) {
+    std::vector<std::unique_ptr<virtual_counter>> instances{};
+    std::uint64_t total{};
+
+    std::cout << "Invoking 1000x1000 virtual calls" << std::endl;
+
+    for(std::size_t i = 0; i < 1000u; ++i) {
+        instances.emplace_back(std::make_unique<virtual_counter_impl>());
+    }
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000L; ++i) {
+        for(auto &&elem: instances) {
+            elem->incr(i);
+        }
+    }
+
+    for(auto &&elem: instances) {
+        total += elem->get();
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
+
+TEST(Benchmark, PolyConstruct) {
+    std::vector<entt::poly<Counter>> instances{};
+
+    std::cout << "Constructing 1000000 poly objects" << std::endl;
+
+    instances.reserve(1000000u);
+
+    test::timer timer;
+
+    for(std::size_t i = 0; i < 1000000u; ++i) {
+        instances.emplace_back(counter{});
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(instances.size());
+}
@@ -0,0 +1,78 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <gtest/gtest.h>
+#include <entt/process/process.hpp>
+#include <entt/process/scheduler.hpp>
+#include "harness.hpp"
+
+struct counter_process: entt::process {
+    using entt::process::process;
+
+    void update(const delta_type delta, void *data) override {
+        *static_cast<std::uint64_t *>(data) += delta;
+    }
+};
+
+TEST(Benchmark, SchedulerUpdate) {
+    entt::scheduler scheduler;
+    std::uint64_t total{};
+
+    std::cout << "Updating 10000 processes 100 times" << std::endl;
+
+    for(std::size_t i = 0; i < 10000u; ++i) {
+        scheduler.attach<counter_process>();
+    }
+
+    test::timer timer;
+
+    for(std::uint32_t i = 0; i < 100u; ++i) {
+        scheduler.update(1u, &total);
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
+
+TEST(Benchmark, SchedulerUpdateLambda) {
+    entt::scheduler scheduler;
+    std::uint64_t total{};
+
+    std::cout << "Updating 10000 lambda processes 100 times" << std::endl;
+
+    for(std::size_t i = 0; i < 10000u; ++i) {
+        scheduler.attach([](entt::process &, const std::uint32_t delta, void *data) { *static_cast<std::uint64_t *>(data) += delta; });
+    }
+
+    test::timer timer;
+
+    for(std::uint32_t i = 0; i < 100u; ++i) {
+        scheduler.update(1u, &total);
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
+
+TEST(Benchmark, SchedulerChurn) {
+    entt::scheduler scheduler;
+    std::uint64_t total{};
+
+    std::cout << "Attaching, running and retiring 1000000 processes" << std::endl;
+
+    test::timer timer;
+
+    for(std::size_t i = 0; i < 1000u; ++i) {
+        for(std::size_t j = 0; j < 1000u; ++j) {
+            scheduler.attach([](entt::process &proc, const std::uint32_t delta, void *data) {
+                *static_cast<std::uint64_t *>(data) += delta;
+                proc.succeed();
+            });
+        }
+
+        scheduler.update(1u, &total);
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
@@ -0,0 +1,271 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/container/dense_map.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/view.hpp>
+#include <entt/tools/recorder.hpp>
+#include "harness.hpp"
+
+// elements are only as large as the recorded ones, their values don't matter
+template<std::size_t Size, bool Stable>
+struct blob {
+    static constexpr auto in_place_delete = Stable;
+    unsigned char data[Size];
+};
+
+struct tag {};
+
+struct position {
+    float x;
+    float y;
+};
+
+struct velocity: position {};
+
+struct health {
+    int value;
+};
+
+struct transform {
+    static constexpr auto in_place_delete = true;
+    float matrix[16u];
+};
+
+struct brain {
+    unsigned char state[128u];
+};
+
+struct burning {};
+
+struct replay_pool {
+    void (*emplace)(entt::registry &, entt::id_type, entt::entity);
+    void (*patch)(entt::registry &, entt::id_type, entt::entity);
+    void (*touch)(entt::registry &, entt::id_type);
+    entt::id_type id;
+};
+
+struct replay_step {
+    entt::trace_op op;
+    std::uint32_t pool;
+    std::uint32_t slot;
+};
+
+template<typename Type>
+replay_pool make_pool(const entt::id_type id) {
+    return replay_pool{
+        +[](entt::registry &registry, const entt::id_type name, const entt::entity entt) { registry.storage<Type>(name).emplace(entt); },
+        +[](entt::registry &registry, const entt::id_type name, const entt::entity entt) { registry.storage<Type>(name).patch(entt); },
+        +[](entt::registry &registry, const entt::id_type name) {
+            entt::basic_view{registry.storage<Type>(name)}.each([](const entt::entity entt, const auto &...elem) {
+                test::do_not_optimize(entt);
+                (test::do_not_optimize(elem.data[0u]), ...);
+            });
+        },
+        id};
+}
+
+template<bool Stable>
+replay_pool make_pool(const entt::id_type id, const std::uint32_t size) {
+    if(size == 0u) {
+        return make_pool<tag>(id);
+    } else if(size <= 8u) {
+        return make_pool<blob<8u, Stable>>(id);
+    } else if(size <= 32u) {
+        return make_pool<blob<32u, Stable>>(id);
+    } else if(size <= 128u) {
+        return make_pool<blob<128u, Stable>>(id);
+    }
+
+    return make_pool<blob<512u, Stable>>(id);
+}
+
+// maps identifiers and storage names to dense indexes, out of the timed loop
+class replay {
+    void prepare(const std::vector<entt::trace_event> &trace) {
+        entt::dense_map<std::uint64_t, std::uint32_t> live{};
+        entt::dense_map<entt::id_type, std::uint32_t> names{};
+        std::vector<std::uint32_t> available{};
+
+        for(auto &&elem: trace) {
+            replay_step step{elem.op, 0u, 0u};
+
+            if(elem.op == entt::trace_op::frame) {
+                ++frames;
+            } else if(elem.op == entt::trace_op::create) {
+                if(available.empty()) {
+                    available.push_back(slots++);
+                }
+
+                step.slot = live.insert_or_assign(elem.entity, available.back()).first->second;
+                available.pop_back();
+            } else if(const auto it = live.find(elem.entity); it == live.end()) {
+                // entities created before the recording started are discarded
+                continue;
+            } else if(step.slot = it->second; elem.op == entt::trace_op::destroy) {
+                available.push_back(it->second);
+                live.erase(it);
+            } else if(const auto curr = names.find(elem.type); curr != names.end()) {
+                step.pool = curr->second;
+            } else if(elem.op == entt::trace_op::emplace) {
+                step.pool = names.insert({elem.type, static_cast<std::uint32_t>(pools.size())}).first->second;
+                pools.push_back(elem.stable ? make_pool<true>(elem.type, elem.size) : make_pool<false>(elem.type, elem.size));
+            } else {
+                continue;
+            }
+
+            steps.push_back(step);
+        }
+    }
+
+public:
+    replay(const std::vector<entt::trace_event> &trace) {
+        prepare(trace);
+    }
+
+    void operator()(entt::registry &registry) const {
+        std::vector<entt::entity> handle(slots);
+
+        for(auto &&step: steps) {
+            switch(step.op) {
+            case entt::trace_op::create:
+                handle[step.slot] = registry.create();
+                break;
+            case entt::trace_op::destroy:
+                registry.destroy(handle[step.slot]);
+                break;
+            case entt::trace_op::emplace:
+                pools[step.pool].emplace(registry, pools[step.pool].id, handle[step.slot]);
+                break;
+            case entt::trace_op::patch:
+                pools[step.pool].patch(registry, pools[step.pool].id, handle[step.slot]);
+                break;
+            case entt::trace_op::erase:
+                registry.storage(pools[step.pool].id)->erase(handle[step.slot]);
+                break;
+            case entt::trace_op::frame:
+                for(auto &&pool: pools) {
+                    pool.touch(registry, pool.id);
+                }
+                break;
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return steps.size();
+    }
+
+    [[nodiscard]] std::size_t frame_count() const noexcept {
+        return frames;
+    }
+
+private:
+    std::vector<replay_pool> pools{};
+    std::vector<replay_step> steps{};
+    std::uint32_t slots{};
+    std::size_t frames{};
+};
+
+// spawns and kills entities every frame, with bursts of short-lived tags
+std::vector<entt::trace_event> record_churn() {
+    entt::registry registry;
+    entt::recorder recorder{registry};
+    std::vector<entt::entity> alive{};
+    std::minstd_rand engine{42u};
+
+    recorder.track<position>();
+    recorder.track<velocity>();
+    recorder.track<health>();
+    recorder.track<transform>();
+    recorder.track<brain>();
+    recorder.track<burning>();
+
+    const auto spawn = [&](const std::size_t count) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            const auto entt = alive.emplace_back(registry.create());
+            registry.emplace<position>(entt);
+            registry.emplace<velocity>(entt);
+            registry.emplace<health>(entt, 100);
+
+            if(const auto roll = engine() % 10u; roll < 5u) {
+                registry.emplace<transform>(entt);
+            } else if(roll == 9u) {
+                registry.emplace<brain>(entt);
+            }
+        }
+    };
+
+    spawn(10000u);
+
+    for(std::size_t frame{}; frame < 500u; ++frame) {
+        spawn(200u);
+
+        for(std::size_t pos{}; pos < 200u && !alive.empty(); ++pos) {
+            const auto index = engine() % alive.size();
+            registry.destroy(alive[index]);
+            alive[index] = alive.back();
+            alive.pop_back();
+        }
+
+        for(std::size_t pos{}; pos < 100u; ++pos) {
+            registry.patch<health>(alive[engine() % alive.size()], [](auto &elem) { --elem.value; });
+        }
+
+        if(frame % 10u == 0u) {
+            for(std::size_t pos{}; pos < 1000u; ++pos) {
+                registry.emplace_or_replace<burning>(alive[engine() % alive.size()]);
+            }
+        } else if(frame % 10u == 3u) {
+            registry.clear<burning>();
+        }
+
+        recorder.frame();
+    }
+
+    std::stringstream buffer{};
+    std::vector<entt::trace_event> trace{};
+
+    // round trip through the binary format, as a real trace would
+    recorder.write(buffer);
+    EXPECT_TRUE(entt::read_trace(buffer, trace));
+
+    return trace;
+}
+
+void replay_with(const std::vector<entt::trace_event> &trace) {
+    const replay func{trace};
+    entt::registry registry;
+
+    std::cout << "Replaying " << func.size() << " operations over " << func.frame_count() << " frames" << std::endl;
+
+    test::timer timer;
+    func(registry);
+    timer.elapsed(func.size());
+}
+
+TEST(Replay, Churn) {
+    static const auto trace = record_churn();
+    replay_with(trace);
+}
+
+TEST(Replay, Trace) {
+    const char *path = std::getenv("ENTT_BENCHMARK_TRACE");
+
+    if(path == nullptr) {
+        GTEST_SKIP() << "ENTT_BENCHMARK_TRACE not set";
+    }
+
+    std::ifstream file{path, std::ios::binary};
+    std::vector<entt::trace_event> trace{};
+
+    ASSERT_TRUE(entt::read_trace(file, trace)) << "Invalid trace: " << path;
+
+    replay_with(trace);
+}
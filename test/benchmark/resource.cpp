@@ -0,0 +1,69 @@
+#include <cstdint>
+#include <iostream>
+#include <gtest/gtest.h>
+#include <entt/core/fwd.hpp>
+#include <entt/resource/cache.hpp>
+#include <entt/resource/loader.hpp>
+#include <entt/resource/resource.hpp>
+#include "harness.hpp"
+
+struct texture {
+    texture(const std::uint64_t elem)
+        : value{elem} {}
+
+    std::uint64_t value;
+};
+
+TEST(Benchmark, ResourceCacheLoad) {
+    entt::resource_cache<texture> cache;
+
+    std::cout << "Loading 1000000 resources" << std::endl;
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        cache.load(static_cast<entt::id_type>(i), i);
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(cache.size());
+}
+
+TEST(Benchmark, ResourceCacheLoadExisting) {
+    entt::resource_cache<texture> cache;
+
+    std::cout << "Loading 1000000 resources that already exist" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        cache.load(static_cast<entt::id_type>(i), i);
+    }
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        cache.load(static_cast<entt::id_type>(i), i);
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(cache.size());
+}
+
+TEST(Benchmark, ResourceCacheGet) {
+    entt::resource_cache<texture> cache;
+    std::uint64_t total{};
+
+    std::cout << "Looking up 1000000 resources" << std::endl;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        cache.load(static_cast<entt::id_type>(i), i);
+    }
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        total += cache[static_cast<entt::id_type>(i)]->value;
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(total);
+}
@@ -0,0 +1,282 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/command_buffer.hpp>
+#include <entt/entity/executor.hpp>
+#include <entt/entity/organizer.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/view.hpp>
+#include <entt/signal/concurrent_sigh.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include "harness.hpp"
+
+struct position {
+    std::uint64_t x;
+    std::uint64_t y;
+};
+
+struct velocity: position {};
+
+struct event {
+    std::uint64_t value;
+};
+
+// minimal fork-join pool, the calling thread takes part in all jobs
+class fork_join {
+    void run() {
+        for(auto pos = next.fetch_add(1u, std::memory_order_relaxed); pos < total; pos = next.fetch_add(1u, std::memory_order_relaxed)) {
+            function(payload, pos);
+        }
+    }
+
+    void work() {
+        std::size_t seen{};
+
+        for(std::unique_lock lock{mutex};; lock.lock()) {
+            cv.wait(lock, [this, &seen] { return stop || (generation != seen); });
+
+            if(stop) {
+                return;
+            }
+
+            seen = generation;
+            lock.unlock();
+            run();
+            lock.lock();
+
+            if(--pending == 0u) {
+                done.notify_one();
+            }
+
+            lock.unlock();
+        }
+    }
+
+public:
+    explicit fork_join(const std::size_t count) {
+        for(std::size_t pos = 1u; pos < count; ++pos) {
+            workers.emplace_back(&fork_join::work, this);
+        }
+    }
+
+    fork_join(const fork_join &) = delete;
+    fork_join &operator=(const fork_join &) = delete;
+
+    ~fork_join() {
+        {
+            const std::lock_guard guard{mutex};
+            stop = true;
+        }
+
+        cv.notify_all();
+
+        for(auto &&elem: workers) {
+            elem.join();
+        }
+    }
+
+    template<typename Job>
+    void operator()(const std::size_t count, Job job) {
+        {
+            const std::lock_guard guard{mutex};
+            payload = &job;
+            function = +[](void *elem, const std::size_t pos) { (*static_cast<Job *>(elem))(pos); };
+            total = count;
+            next.store(0u, std::memory_order_relaxed);
+            pending = workers.size();
+            ++generation;
+        }
+
+        cv.notify_all();
+        run();
+
+        std::unique_lock lock{mutex};
+        done.wait(lock, [this] { return pending == 0u; });
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return workers.size() + 1u;
+    }
+
+private:
+    std::vector<std::thread> workers{};
+    std::mutex mutex{};
+    std::condition_variable cv{};
+    std::condition_variable done{};
+    void (*function)(void *, std::size_t){};
+    void *payload{};
+    std::size_t total{};
+    std::atomic<std::size_t> next{};
+    std::size_t pending{};
+    std::size_t generation{};
+    bool stop{};
+};
+
+void integrate(position &pos, const velocity &vel) {
+    pos.x += vel.x;
+    pos.y += vel.y;
+}
+
+void accelerate(velocity &vel) {
+    vel.x += 1u;
+}
+
+void accumulate(std::atomic<std::uint64_t> &total, const event &ev) {
+    total.fetch_add(ev.value, std::memory_order_relaxed);
+}
+
+struct listener {
+    void receive(const std::uint64_t value) const {
+        test::do_not_optimize(value);
+    }
+};
+
+struct Scaling: ::testing::TestWithParam<std::size_t> {
+    static constexpr std::size_t entities = 1000000u;
+    static constexpr std::size_t grain = 4000u;
+
+    void populate() {
+        for(std::uint64_t i = 0; i < entities; i++) {
+            const auto entt = registry.create();
+            registry.emplace<position>(entt, i, i);
+            registry.emplace<velocity>(entt, i, i);
+        }
+    }
+
+    static void throughput(const std::size_t operations, const double seconds) {
+        std::cout << static_cast<double>(operations) / seconds << " operations per second" << std::endl;
+    }
+
+    entt::registry registry{};
+};
+
+template<typename Func>
+void scale_with(const std::size_t operations, Func func) {
+    test::timer timer;
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    Scaling::throughput(operations, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    timer.elapsed(operations);
+}
+
+TEST_P(Scaling, ReadOnlyIteration) {
+    fork_join pool{GetParam()};
+    auto view = registry.view<const position, const velocity>();
+
+    std::cout << "Iterating 1000000 entities, read-only, " << pool.size() << " threads" << std::endl;
+
+    populate();
+
+    scale_with(entities, [&]() {
+        view.each_chunked(pool, grain, [](const position &pos, const velocity &vel) {
+            test::do_not_optimize(pos.x + vel.x);
+        });
+    });
+}
+
+TEST_P(Scaling, DisjointWrites) {
+    fork_join pool{GetParam()};
+    auto view = registry.view<position, const velocity>();
+
+    std::cout << "Iterating 1000000 entities, disjoint writes, " << pool.size() << " threads" << std::endl;
+
+    populate();
+
+    scale_with(entities, [&]() {
+        view.each_chunked(pool, grain, &integrate);
+    });
+}
+
+TEST_P(Scaling, OrganizerExecutor) {
+    entt::organizer organizer;
+    entt::executor executor{GetParam() - 1u};
+
+    std::cout << "Running two chunked tasks over 1000000 entities, " << (executor.size() + 1u) << " threads" << std::endl;
+
+    organizer.emplace_chunked<&accelerate>(grain, "accelerate");
+    organizer.emplace_chunked<&integrate>(grain, "integrate");
+    populate();
+
+    const auto graph = organizer.graph();
+
+    scale_with(2u * entities, [&]() {
+        executor.run(graph, registry);
+    });
+}
+
+TEST_P(Scaling, EventStorm) {
+    fork_join pool{GetParam()};
+    entt::dispatcher dispatcher;
+    auto producer = dispatcher.producer<event>();
+    std::atomic<std::uint64_t> total{};
+
+    std::cout << "Enqueueing 1000000 events from " << pool.size() << " threads and delivering them" << std::endl;
+
+    dispatcher.sink<event>().connect<&accumulate>(total);
+
+    scale_with(entities, [&]() {
+        pool(entities / grain, [&producer](const std::size_t chunk) {
+            for(std::size_t pos{}; pos < grain; ++pos) {
+                producer.enqueue(event{chunk * grain + pos});
+            }
+        });
+
+        dispatcher.update();
+    });
+
+    test::do_not_optimize(total.load());
+}
+
+TEST_P(Scaling, ConcurrentPublish) {
+    fork_join pool{GetParam()};
+    entt::concurrent_sigh<void(std::uint64_t)> sigh;
+    entt::sink sink{sigh};
+    listener instance[8u]{};
+
+    std::cout << "Publishing 1000000 times to 8 listeners from " << pool.size() << " threads" << std::endl;
+
+    for(auto &&elem: instance) {
+        sink.connect<&listener::receive>(elem);
+    }
+
+    scale_with(entities, [&]() {
+        pool(entities / grain, [&sigh](const std::size_t chunk) {
+            for(std::size_t pos{}; pos < grain; ++pos) {
+                sigh.publish(chunk * grain + pos);
+            }
+        });
+    });
+}
+
+TEST_P(Scaling, CommandBufferFlush) {
+    fork_join pool{GetParam()};
+    std::vector<entt::command_buffer> buffer(pool.size());
+
+    std::cout << "Recording 1000000 entities from " << pool.size() << " threads and flushing them" << std::endl;
+
+    scale_with(entities, [&]() {
+        const auto count = entities / buffer.size();
+
+        pool(buffer.size(), [&buffer, count](const std::size_t slot) {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                const auto entt = buffer[slot].create();
+                buffer[slot].emplace<position>(entt, pos, pos);
+                buffer[slot].emplace<velocity>(entt, pos, pos);
+            }
+        });
+
+        for(auto &&elem: buffer) {
+            elem.flush(registry);
+        }
+    });
+}
+
+INSTANTIATE_TEST_SUITE_P(Threads, Scaling, ::testing::Values(1u, 2u, 4u, 8u, 16u, 32u), [](const ::testing::TestParamInfo<std::size_t> &param) { return ((param.param < 10u) ? "0" : "") + std::to_string(param.param); });
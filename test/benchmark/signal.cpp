@@ -0,0 +1,138 @@
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <gtest/gtest.h>
+#include <entt/signal/dispatcher.hpp>
+#include <entt/signal/sigh.hpp>
+#include "harness.hpp"
+
+struct listener {
+    void receive(const std::uint64_t value) {
+        total += value;
+    }
+
+    void on_event(const std::uint64_t &value) {
+        total += value;
+    }
+
+    std::uint64_t total{};
+};
+
+template<auto>
+struct event {
+    std::uint64_t value;
+};
+
+struct handler {
+    template<typename Type>
+    void on(const Type &ev) {
+        total += ev.value;
+    }
+
+    std::uint64_t total{};
+};
+
+TEST(Benchmark, SighPublish) {
+    entt::sigh<void(std::uint64_t)> sigh;
+    entt::sink sink{sigh};
+    listener instance[32u]{};
+
+    std::cout << "Publishing 1000000 times to 32 listeners" << std::endl;
+
+    for(auto &&elem: instance) {
+        sink.connect<&listener::receive>(elem);
+    }
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        sigh.publish(i);
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(instance[0u].total);
+}
+
+TEST(Benchmark, SighConnectDisconnect) {
+    entt::sigh<void(std::uint64_t)> sigh;
+    entt::sink sink{sigh};
+    listener instance[1000u]{};
+
+    std::cout << "Connecting and disconnecting 1000 listeners 100 times" << std::endl;
+
+    test::timer timer;
+
+    for(std::size_t i = 0; i < 100u; ++i) {
+        for(auto &&elem: instance) {
+            sink.connect<&listener::receive>(elem);
+        }
+
+        for(auto &&elem: instance) {
+            sink.disconnect<&listener::receive>(elem);
+        }
+    }
+
+    timer.elapsed();
+}
+
+TEST(Benchmark, DispatcherTrigger) {
+    entt::dispatcher dispatcher;
+    listener instance{};
+
+    std::cout << "Triggering 1000000 events" << std::endl;
+
+    dispatcher.sink<std::uint64_t>().connect<&listener::on_event>(instance);
+
+    test::timer timer;
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        dispatcher.trigger(i);
+    }
+
+    timer.elapsed();
+    test::do_not_optimize(instance.total);
+}
+
+TEST(Benchmark, DispatcherUpdate) {
+    entt::dispatcher dispatcher;
+    listener instance{};
+
+    std::cout << "Enqueueing and delivering 1000000 events" << std::endl;
+
+    dispatcher.sink<std::uint64_t>().connect<&listener::on_event>(instance);
+
+    for(std::uint64_t i = 0; i < 1000000L; ++i) {
+        dispatcher.enqueue(i);
+    }
+
+    test::timer timer;
+    dispatcher.update();
+    timer.elapsed();
+
+    test::do_not_optimize(instance.total);
+}
+
+TEST(Benchmark, DispatcherUpdateManyTypes) {
+    entt::dispatcher dispatcher;
+    handler instance{};
+
+    std::cout << "Enqueueing and delivering 4x250000 events of different types" << std::endl;
+
+    dispatcher.sink<event<0>>().connect<&handler::on<event<0>>>(instance);
+    dispatcher.sink<event<1>>().connect<&handler::on<event<1>>>(instance);
+    dispatcher.sink<event<2>>().connect<&handler::on<event<2>>>(instance);
+    dispatcher.sink<event<3>>().connect<&handler::on<event<3>>>(instance);
+
+    for(std::uint64_t i = 0; i < 250000L; ++i) {
+        dispatcher.enqueue<event<0>>(i);
+        dispatcher.enqueue<event<1>>(i);
+        dispatcher.enqueue<event<2>>(i);
+        dispatcher.enqueue<event<3>>(i);
+    }
+
+    test::timer timer;
+    dispatcher.update();
+    timer.elapsed();
+
+    test::do_not_optimize(instance.total);
+}
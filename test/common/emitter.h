@@ -9,6 +9,10 @@ struct emitter: entt::emitter<emitter> {
     using entt::emitter<emitter>::emitter;
 };
 
+struct pooled_emitter: entt::pooled_emitter<pooled_emitter> {
+    using entt::pooled_emitter<pooled_emitter>::pooled_emitter;
+};
+
 } // namespace test
 
 #endif
@@ -16,12 +16,15 @@ namespace test {
 class tracked_memory_resource: public std::pmr::memory_resource {
     void *do_allocate(std::size_t bytes, std::size_t alignment) override {
         ++alloc_counter;
-        return std::pmr::get_default_resource()->allocate(bytes, alignment);
+        in_use += bytes;
+        peak = (in_use > peak) ? in_use : peak;
+        return upstream->allocate(bytes, alignment);
     }
 
     void do_deallocate(void *value, std::size_t bytes, std::size_t alignment) override {
         ++dealloc_counter;
-        std::pmr::get_default_resource()->deallocate(value, bytes, alignment);
+        in_use -= bytes;
+        upstream->deallocate(value, bytes, alignment);
     }
 
     bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
@@ -35,8 +38,11 @@ public:
     static constexpr const char *default_value = "a string long enough to force an allocation (hopefully)";
 
     tracked_memory_resource()
-        : alloc_counter{},
-          dealloc_counter{} {}
+        : upstream{std::pmr::get_default_resource()},
+          alloc_counter{},
+          dealloc_counter{},
+          in_use{},
+          peak{} {}
 
     size_type do_allocate_counter() const noexcept {
         return alloc_counter;
@@ -46,14 +52,30 @@ public:
         return dealloc_counter;
     }
 
+    size_type bytes_in_use() const noexcept {
+        return in_use;
+    }
+
+    size_type peak_bytes() const noexcept {
+        return peak;
+    }
+
+    void reset_peak() noexcept {
+        peak = in_use;
+    }
+
     void reset() noexcept {
         alloc_counter = 0u;
         dealloc_counter = 0u;
+        reset_peak();
     }
 
 private:
+    std::pmr::memory_resource *upstream;
     size_type alloc_counter;
     size_type dealloc_counter;
+    size_type in_use;
+    size_type peak;
 };
 
 } // namespace test
@@ -0,0 +1,114 @@
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/container/concurrent_dense_map.hpp>
+#include <entt/core/utility.hpp>
+#include "../../common/config.h"
+#include "../../common/transparent_equal_to.h"
+
+TEST(ConcurrentDenseMap, Functionalities) {
+    entt::concurrent_dense_map<int, int, entt::identity, test::transparent_equal_to> map{3u};
+    const auto &cmap = map;
+
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = map.get_allocator());
+
+    ASSERT_EQ(map.shard_count(), 4u);
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.size(), 0u);
+
+    ASSERT_EQ(map.hash_function()(64), 64);
+    ASSERT_TRUE(map.key_eq()(64, 64));
+
+    ASSERT_TRUE(map.insert({0, 1}));
+    ASSERT_FALSE(map.insert({0, 2}));
+    ASSERT_TRUE(map.try_emplace(1, 3));
+    ASSERT_FALSE(map.try_emplace(1, 4));
+    ASSERT_FALSE(map.insert_or_assign(1, 5));
+    ASSERT_TRUE(map.insert_or_assign(2, 6));
+
+    ASSERT_FALSE(map.empty());
+    ASSERT_EQ(map.size(), 3u);
+
+    ASSERT_TRUE(map.contains(0));
+    ASSERT_TRUE(cmap.contains(1.0));
+    ASSERT_EQ(map.count(2), 1u);
+    ASSERT_EQ(map.count(3), 0u);
+
+    int value{};
+
+    ASSERT_TRUE(cmap.visit(1, [&value](const int &elem) { value = elem; }));
+    ASSERT_EQ(value, 5);
+    ASSERT_FALSE(cmap.visit(3, [&value](const int &) { value = 0; }));
+    ASSERT_EQ(value, 5);
+
+    ASSERT_TRUE(map.visit(0, [](int &elem) { elem = 7; }));
+    ASSERT_TRUE(cmap.visit(0, [&value](const int &elem) { value = elem; }));
+    ASSERT_EQ(value, 7);
+
+    int sum{};
+    map.each([&sum](const int key, const int elem) { sum += key + elem; });
+
+    ASSERT_EQ(sum, 3 + 7 + 5 + 6);
+
+    ASSERT_EQ(map.erase(0), 1u);
+    ASSERT_EQ(map.erase(0), 0u);
+    ASSERT_EQ(map.size(), 2u);
+
+    map.reserve(64u);
+    map.clear();
+
+    ASSERT_TRUE(map.empty());
+}
+
+TEST(ConcurrentDenseMap, Distribution) {
+    entt::concurrent_dense_map<std::size_t, std::size_t, entt::identity> map{};
+
+    for(std::size_t next{}; next < 1024u; ++next) {
+        map.try_emplace(next, next);
+    }
+
+    ASSERT_EQ(map.shard_count(), 16u);
+    ASSERT_EQ(map.size(), 1024u);
+
+    for(std::size_t next{}; next < 1024u; ++next) {
+        ASSERT_TRUE(map.contains(next));
+    }
+}
+
+TEST(ConcurrentDenseMap, Threads) {
+    entt::concurrent_dense_map<std::string, std::size_t> map{};
+    std::vector<std::thread> threads{};
+
+    for(std::size_t index{}; index < 4u; ++index) {
+        threads.emplace_back([&map, index]() {
+            for(std::size_t next{}; next < 256u; ++next) {
+                map.try_emplace(std::to_string(next), 0u);
+                map.visit(std::to_string(next), [](std::size_t &elem) { ++elem; });
+                ASSERT_TRUE(map.contains(std::to_string(next)));
+                map.insert_or_assign(std::to_string(1000u * (index + 1u) + next), next);
+            }
+        });
+    }
+
+    for(auto &&elem: threads) {
+        elem.join();
+    }
+
+    ASSERT_EQ(map.size(), 256u + 4u * 256u);
+
+    for(std::size_t next{}; next < 256u; ++next) {
+        std::size_t value{};
+        ASSERT_TRUE(map.visit(std::to_string(next), [&value](std::size_t &elem) { value = elem; }));
+        ASSERT_EQ(value, 4u);
+    }
+}
+
+ENTT_DEBUG_TEST(ConcurrentDenseMapDeathTest, Shards) {
+    using map_type = entt::concurrent_dense_map<int, int>;
+    ASSERT_DEATH(map_type{0u}, "");
+}
@@ -0,0 +1,444 @@
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/container/dense_hash_map.hpp>
+#include <entt/core/utility.hpp>
+#include "../../common/config.h"
+#include "../../common/linter.hpp"
+#include "../../common/throwing_allocator.hpp"
+#include "../../common/tracked_memory_resource.hpp"
+#include "../../common/transparent_equal_to.h"
+
+struct constant_hash {
+    [[nodiscard]] std::size_t operator()(const std::size_t) const noexcept {
+        return 0u;
+    }
+};
+
+TEST(DenseHashMap, Functionalities) {
+    entt::dense_hash_map<int, int, entt::identity, test::transparent_equal_to> map;
+    const auto &cmap = map;
+
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = map.get_allocator());
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.size(), 0u);
+    ASSERT_EQ(map.load_factor(), 0.f);
+    ASSERT_EQ(map.max_load_factor(), .875f);
+    ASSERT_EQ(map.max_size(), (std::vector<entt::internal::dense_map_node<int, int>>{}.max_size()));
+
+    ASSERT_EQ(map.begin(), map.end());
+    ASSERT_EQ(cmap.begin(), cmap.end());
+    ASSERT_EQ(map.cbegin(), map.cend());
+
+    ASSERT_NE(map.max_bucket_count(), 0u);
+    ASSERT_EQ(map.bucket_count(), 16u);
+
+    ASSERT_FALSE(map.contains(64));
+    ASSERT_FALSE(map.contains(6.4));
+
+    ASSERT_EQ(map.find(64), map.end());
+    ASSERT_EQ(map.find(6.4), map.end());
+    ASSERT_EQ(cmap.find(64), map.cend());
+    ASSERT_EQ(cmap.find(6.4), map.cend());
+
+    ASSERT_EQ(map.hash_function()(64), 64);
+    ASSERT_TRUE(map.key_eq()(64, 64));
+
+    map.emplace(0, 0);
+
+    ASSERT_EQ(map.count(0), 1u);
+    ASSERT_EQ(map.count(6.4), 0u);
+    ASSERT_EQ(cmap.count(0.0), 1u);
+    ASSERT_EQ(cmap.count(64), 0u);
+
+    ASSERT_FALSE(map.empty());
+    ASSERT_EQ(map.size(), 1u);
+    ASSERT_EQ(map.load_factor(), 1.f / 16.f);
+
+    ASSERT_NE(map.begin(), map.end());
+    ASSERT_NE(cmap.begin(), cmap.end());
+    ASSERT_NE(map.cbegin(), map.cend());
+
+    ASSERT_TRUE(map.contains(0));
+    ASSERT_TRUE(map.contains(0.0));
+    ASSERT_EQ(map.find(0)->second, 0);
+    ASSERT_EQ(cmap.find(0.0)->second, 0);
+
+    map.clear();
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.size(), 0u);
+    ASSERT_EQ(map.bucket_count(), 16u);
+    ASSERT_FALSE(map.contains(0));
+}
+
+TEST(DenseHashMap, Constructors) {
+    constexpr std::size_t minimum_bucket_count = 16u;
+    entt::dense_hash_map<int, int> map;
+
+    ASSERT_EQ(map.bucket_count(), minimum_bucket_count);
+
+    map = entt::dense_hash_map<int, int>{std::allocator<int>{}};
+    map = entt::dense_hash_map<int, int>{2u * minimum_bucket_count, std::allocator<float>{}};
+    map = entt::dense_hash_map<int, int>{4u * minimum_bucket_count, std::hash<int>(), std::allocator<double>{}};
+
+    map.emplace(3, 2);
+
+    entt::dense_hash_map<int, int> temp{map, map.get_allocator()};
+    const entt::dense_hash_map<int, int> other{std::move(temp), map.get_allocator()};
+
+    ASSERT_EQ(map.size(), 1u);
+    ASSERT_EQ(other.size(), 1u);
+    ASSERT_EQ(map.bucket_count(), 4u * minimum_bucket_count);
+    ASSERT_EQ(other.bucket_count(), 4u * minimum_bucket_count);
+    ASSERT_EQ(other.at(3), 2);
+}
+
+TEST(DenseHashMap, CopyAndMove) {
+    entt::dense_hash_map<std::size_t, std::size_t, entt::identity> map;
+    map.emplace(3u, 1u);
+
+    entt::dense_hash_map<std::size_t, std::size_t, entt::identity> other{map};
+
+    ASSERT_TRUE(map.contains(3u));
+    ASSERT_TRUE(other.contains(3u));
+
+    map.emplace(0u, 2u);
+    other.emplace(1u, 0u);
+    other = map;
+
+    ASSERT_TRUE(other.contains(3u));
+    ASSERT_TRUE(other.contains(0u));
+    ASSERT_FALSE(other.contains(1u));
+
+    entt::dense_hash_map<std::size_t, std::size_t, entt::identity> moved{std::move(other)};
+
+    test::is_initialized(other);
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(moved[3u], 1u);
+    ASSERT_EQ(moved[0u], 2u);
+
+    other = std::move(moved);
+    test::is_initialized(moved);
+
+    ASSERT_TRUE(moved.empty());
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_EQ(other.at(0u), 2u);
+}
+
+TEST(DenseHashMap, Insert) {
+    entt::dense_hash_map<int, int> map;
+    typename entt::dense_hash_map<int, int>::iterator it;
+    bool result{};
+
+    std::tie(it, result) = map.insert(std::make_pair(1, 2));
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it, --map.end());
+    ASSERT_EQ(it->first, 1);
+    ASSERT_EQ(it->second, 2);
+
+    std::tie(it, result) = map.insert(std::make_pair(1, 4));
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(it->second, 2);
+
+    const std::pair<const int, int> value{3, 4};
+    std::tie(it, result) = map.insert(value);
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_EQ(it->second, 4);
+
+    std::tie(it, result) = map.insert_or_assign(3, 8);
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(it->second, 8);
+
+    std::tie(it, result) = map.insert_or_assign(5, 10);
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(map.size(), 3u);
+
+    std::pair<const int, int> range[2u]{std::make_pair(7, 0), std::make_pair(9, 1)};
+    map.insert(std::begin(range), std::end(range));
+
+    ASSERT_EQ(map.size(), 5u);
+    ASSERT_EQ(map[9], 1);
+    ASSERT_EQ(map[11], 0);
+    ASSERT_EQ(map.size(), 6u);
+}
+
+TEST(DenseHashMap, Emplace) {
+    entt::dense_hash_map<int, std::string> map;
+    typename entt::dense_hash_map<int, std::string>::iterator it;
+    bool result{};
+
+    std::tie(it, result) = map.emplace();
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it->first, 0);
+
+    std::tie(it, result) = map.emplace(std::make_pair(1, "1"));
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it->second, "1");
+
+    std::tie(it, result) = map.emplace(2, "2");
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it->second, "2");
+
+    std::tie(it, result) = map.emplace(std::piecewise_construct, std::make_tuple(3), std::make_tuple(3u, 'a'));
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it->second, "aaa");
+
+    std::tie(it, result) = map.emplace(std::piecewise_construct, std::make_tuple(3), std::make_tuple("b"));
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(it->second, "aaa");
+    ASSERT_EQ(map.size(), 4u);
+
+    std::tie(it, result) = map.try_emplace(3, "c");
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(it->second, "aaa");
+
+    std::tie(it, result) = map.try_emplace(4, 2u, 'd');
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it->second, "dd");
+    ASSERT_EQ(map.size(), 5u);
+}
+
+TEST(DenseHashMap, Erase) {
+    entt::dense_hash_map<std::size_t, std::size_t, entt::identity> map;
+
+    for(std::size_t next{}; next < 10u; ++next) {
+        map.emplace(next, next);
+    }
+
+    auto it = map.erase(++map.begin());
+    it = map.erase(it, it + 1);
+
+    ASSERT_EQ((--map.end())->first, 7u);
+    ASSERT_EQ(map.erase(7u), 1u);
+    ASSERT_EQ(map.erase(7u), 0u);
+
+    ASSERT_EQ(map.size(), 7u);
+    ASSERT_EQ(it, ++map.begin());
+    ASSERT_EQ(it->first, 8u);
+    ASSERT_EQ((--map.end())->first, 6u);
+
+    for(auto &&curr: map) {
+        ASSERT_EQ(map.find(curr.first)->second, curr.second);
+    }
+
+    ASSERT_FALSE(map.contains(1u));
+    ASSERT_FALSE(map.contains(9u));
+    ASSERT_FALSE(map.contains(7u));
+
+    map.erase(map.begin(), map.end());
+
+    for(std::size_t next{}; next < 10u; ++next) {
+        ASSERT_FALSE(map.contains(next));
+    }
+
+    ASSERT_EQ(map.size(), 0u);
+}
+
+TEST(DenseHashMap, Collisions) {
+    entt::dense_hash_map<std::size_t, std::size_t, constant_hash> map;
+
+    for(std::size_t next{}; next < 100u; ++next) {
+        map.emplace(next, next);
+    }
+
+    ASSERT_EQ(map.size(), 100u);
+    ASSERT_EQ(map.bucket_count(), 128u);
+
+    for(std::size_t next{}; next < 100u; ++next) {
+        ASSERT_EQ(map.at(next), next);
+    }
+
+    for(std::size_t next{}; next < 100u; next += 2u) {
+        ASSERT_EQ(map.erase(next), 1u);
+    }
+
+    for(std::size_t next{}; next < 100u; ++next) {
+        ASSERT_EQ(map.contains(next), (next % 2u) != 0u);
+    }
+
+    ASSERT_FALSE(map.contains(100u));
+}
+
+TEST(DenseHashMap, Tombstones) {
+    entt::dense_hash_map<std::size_t, std::size_t, constant_hash> map;
+
+    for(std::size_t next{}; next < 1000u; ++next) {
+        map.emplace(next, next);
+        map.emplace(next + 1000u, next);
+        ASSERT_EQ(map.erase(next), 1u);
+    }
+
+    // slots of removed elements are reused rather than requiring more room
+    ASSERT_EQ(map.size(), 1000u);
+    ASSERT_EQ(map.bucket_count(), 2048u);
+
+    for(std::size_t next{}; next < 1000u; ++next) {
+        ASSERT_FALSE(map.contains(next));
+        ASSERT_EQ(map.at(next + 1000u), next);
+    }
+
+    for(std::size_t next{}; next < 10000u; ++next) {
+        map.emplace(next + 10000u, next);
+        ASSERT_EQ(map.erase(next + 10000u), 1u);
+    }
+
+    ASSERT_EQ(map.size(), 1000u);
+    ASSERT_EQ(map.bucket_count(), 2048u);
+}
+
+TEST(DenseHashMap, Swap) {
+    entt::dense_hash_map<int, int> map;
+    entt::dense_hash_map<int, int> other;
+
+    map.emplace(0, 1);
+
+    ASSERT_FALSE(map.empty());
+    ASSERT_TRUE(other.empty());
+
+    map.swap(other);
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(other.empty());
+    ASSERT_EQ(other[0], 1);
+}
+
+TEST(DenseHashMap, EqualRange) {
+    entt::dense_hash_map<int, int, entt::identity, test::transparent_equal_to> map;
+    const auto &cmap = map;
+
+    map.emplace(1, 2);
+
+    auto [lo, hi] = map.equal_range(1);
+    auto [clo, chi] = cmap.equal_range(1.0);
+
+    ASSERT_NE(lo, hi);
+    ASSERT_NE(clo, chi);
+    ASSERT_EQ(lo->second, 2);
+    ASSERT_EQ(++lo, hi);
+    ASSERT_EQ(++clo, chi);
+
+    auto [elo, ehi] = map.equal_range(3.0);
+
+    ASSERT_EQ(elo, ehi);
+    ASSERT_EQ(elo, map.end());
+}
+
+ENTT_DEBUG_TEST(DenseHashMapDeathTest, Indexing) {
+    entt::dense_hash_map<int, int> map;
+    const auto &cmap = map;
+
+    ASSERT_DEATH([[maybe_unused]] auto value = map.at(0), "");
+    ASSERT_DEATH([[maybe_unused]] auto value = cmap.at(42), "");
+}
+
+TEST(DenseHashMap, Rehash) {
+    entt::dense_hash_map<std::size_t, std::size_t, entt::identity> map;
+
+    for(std::size_t next{}; next < 14u; ++next) {
+        map.emplace(next, next);
+    }
+
+    ASSERT_EQ(map.bucket_count(), 16u);
+
+    map.emplace(14u, 14u);
+
+    ASSERT_EQ(map.bucket_count(), 32u);
+
+    map.rehash(0u);
+
+    ASSERT_EQ(map.bucket_count(), 32u);
+
+    map.rehash(100u);
+
+    ASSERT_EQ(map.bucket_count(), 128u);
+
+    for(std::size_t next{}; next < 15u; ++next) {
+        ASSERT_EQ(map.at(next), next);
+    }
+
+    map.clear();
+    map.rehash(0u);
+
+    ASSERT_EQ(map.bucket_count(), 16u);
+}
+
+TEST(DenseHashMap, Reserve) {
+    entt::dense_hash_map<int, int> map;
+
+    map.reserve(0u);
+
+    ASSERT_EQ(map.bucket_count(), 16u);
+
+    map.reserve(64u);
+
+    ASSERT_EQ(map.bucket_count(), 128u);
+
+    for(int next{}; next < 64; ++next) {
+        map.emplace(next, next);
+    }
+
+    ASSERT_EQ(map.bucket_count(), 128u);
+}
+
+TEST(DenseHashMap, ThrowingAllocator) {
+    using allocator = test::throwing_allocator<std::pair<const std::size_t, std::size_t>>;
+    entt::dense_hash_map<std::size_t, std::size_t, std::hash<std::size_t>, std::equal_to<>, allocator> map{};
+
+    map.get_allocator().throw_counter<entt::internal::dense_map_node<std::size_t, std::size_t>>(0u);
+
+    ASSERT_THROW(map.emplace(0u, 0u), test::throwing_allocator_exception);
+    ASSERT_FALSE(map.contains(0u));
+
+    map.get_allocator().throw_counter<entt::internal::dense_map_node<std::size_t, std::size_t>>(0u);
+
+    ASSERT_THROW(map.emplace(std::piecewise_construct, std::make_tuple(0u), std::make_tuple(0u)), test::throwing_allocator_exception);
+    ASSERT_FALSE(map.contains(0u));
+
+    map.get_allocator().throw_counter<entt::internal::dense_map_node<std::size_t, std::size_t>>(0u);
+
+    ASSERT_THROW(map.insert_or_assign(0u, 0u), test::throwing_allocator_exception);
+    ASSERT_FALSE(map.contains(0u));
+    ASSERT_TRUE(map.empty());
+}
+
+#if defined(ENTT_HAS_TRACKED_MEMORY_RESOURCE)
+#    include <memory_resource>
+
+TEST(DenseHashMap, KeyUsesAllocatorConstruction) {
+    using string_type = typename test::tracked_memory_resource::string_type;
+    using allocator = std::pmr::polymorphic_allocator<std::pair<const string_type, int>>;
+
+    test::tracked_memory_resource memory_resource{};
+    entt::dense_hash_map<string_type, int, std::hash<string_type>, std::equal_to<>, allocator> map{&memory_resource};
+
+    map.reserve(1u);
+    memory_resource.reset();
+    map.emplace(test::tracked_memory_resource::default_value, 0);
+
+    ASSERT_TRUE(map.get_allocator().resource()->is_equal(memory_resource));
+    ASSERT_GT(memory_resource.do_allocate_counter(), 0u);
+    ASSERT_EQ(memory_resource.do_deallocate_counter(), 0u);
+}
+
+#endif
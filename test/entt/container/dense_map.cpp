@@ -959,6 +959,39 @@ TEST(DenseMap, EqualRange) {
     ASSERT_EQ(cmap.equal_range(4.0).second, cmap.cend());
 }
 
+TEST(DenseMap, FindMany) {
+    entt::dense_map<std::size_t, std::size_t, entt::identity> map;
+    const auto &cmap = map;
+
+    for(std::size_t next{}; next < 40u; next += 2u) {
+        map.emplace(next, next * 2u);
+    }
+
+    std::vector<std::size_t> keys{};
+
+    for(std::size_t next{}; next < 40u; ++next) {
+        keys.push_back(next);
+    }
+
+    std::vector<typename decltype(map)::iterator> found{};
+    std::vector<typename decltype(map)::const_iterator> cfound(keys.size());
+
+    map.find_many(keys.begin(), keys.end(), std::back_inserter(found));
+
+    ASSERT_EQ(cmap.find_many(keys.begin(), keys.end(), cfound.begin()), cfound.end());
+    ASSERT_EQ(found.size(), keys.size());
+
+    for(std::size_t pos{}; pos < keys.size(); ++pos) {
+        ASSERT_EQ(found[pos], map.find(keys[pos]));
+        ASSERT_EQ(cfound[pos], cmap.find(keys[pos]));
+    }
+
+    found.front()->second = 1u;
+
+    ASSERT_EQ(map[0u], 1u);
+    ASSERT_EQ(map.find_many(keys.begin(), keys.begin(), found.begin()), found.begin());
+}
+
 TEST(DenseMap, Indexing) {
     entt::dense_map<int, int> map;
     const auto &cmap = map;
@@ -1156,6 +1189,23 @@ TEST(DenseMap, Reserve) {
     ASSERT_EQ(map.bucket_count(), entt::next_power_of_two(static_cast<std::size_t>(std::ceil(minimum_bucket_count / map.max_load_factor()))));
 }
 
+TEST(DenseMap, ShrinkToFit) {
+    constexpr std::size_t minimum_bucket_count = 8u;
+    entt::dense_map<std::size_t, std::size_t, entt::identity> map;
+
+    map.reserve(4u * minimum_bucket_count);
+    map[32u] = 2u;
+
+    ASSERT_GT(map.bucket_count(), minimum_bucket_count);
+
+    map.shrink_to_fit();
+
+    ASSERT_EQ(map.bucket_count(), minimum_bucket_count);
+    ASSERT_TRUE(map.contains(32u));
+    ASSERT_EQ(map.bucket(32u), 0u);
+    ASSERT_EQ(map[32u], 2u);
+}
+
 TEST(DenseMap, ThrowingAllocator) {
     constexpr std::size_t minimum_bucket_count = 8u;
     using allocator = test::throwing_allocator<std::pair<const std::size_t, std::size_t>>;
@@ -777,6 +777,33 @@ TEST(DenseSet, Swap) {
     ASSERT_TRUE(other.contains(0));
 }
 
+TEST(DenseSet, FindMany) {
+    entt::dense_set<int, entt::identity, test::transparent_equal_to> set;
+    const auto &cset = set;
+
+    for(int next{}; next < 40; next += 2) {
+        set.emplace(next);
+    }
+
+    const std::array<double, 5u> values{0.0, 1.0, 2.0, 38.0, 39.0};
+    std::array<typename decltype(set)::iterator, values.size()> found{};
+    std::vector<typename decltype(set)::const_iterator> cfound{};
+
+    ASSERT_EQ(set.find_many(values.begin(), values.end(), found.begin()), found.end());
+
+    cset.find_many(values.begin(), values.end(), std::back_inserter(cfound));
+
+    ASSERT_EQ(cfound.size(), values.size());
+
+    for(std::size_t pos{}; pos < values.size(); ++pos) {
+        ASSERT_EQ(found[pos], set.find(values[pos]));
+        ASSERT_EQ(cfound[pos], cset.find(values[pos]));
+    }
+
+    ASSERT_EQ(*found[3u], 38);
+    ASSERT_EQ(found[4u], set.end());
+}
+
 TEST(DenseSet, EqualRange) {
     entt::dense_set<int, entt::identity, test::transparent_equal_to> set;
     const auto &cset = set;
@@ -978,6 +1005,22 @@ TEST(DenseSet, Reserve) {
     ASSERT_EQ(set.bucket_count(), entt::next_power_of_two(static_cast<std::size_t>(std::ceil(minimum_bucket_count / set.max_load_factor()))));
 }
 
+TEST(DenseSet, ShrinkToFit) {
+    constexpr std::size_t minimum_bucket_count = 8u;
+    entt::dense_set<std::size_t, entt::identity> set;
+
+    set.reserve(4u * minimum_bucket_count);
+    set.emplace(32u);
+
+    ASSERT_GT(set.bucket_count(), minimum_bucket_count);
+
+    set.shrink_to_fit();
+
+    ASSERT_EQ(set.bucket_count(), minimum_bucket_count);
+    ASSERT_TRUE(set.contains(32u));
+    ASSERT_EQ(set.bucket(32u), 0u);
+}
+
 TEST(DenseSet, ThrowingAllocator) {
     constexpr std::size_t minimum_bucket_count = 8u;
     using allocator = test::throwing_allocator<std::size_t>;
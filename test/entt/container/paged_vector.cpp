@@ -0,0 +1,228 @@
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/container/paged_vector.hpp>
+#include "../../common/config.h"
+#include "../../common/linter.hpp"
+#include "../../common/throwing_allocator.hpp"
+#include "../../common/throwing_type.hpp"
+#include "../../common/tracked_memory_resource.hpp"
+
+TEST(PagedVector, Functionalities) {
+    entt::paged_vector<int, 4u> vec;
+    const auto &cvec = vec;
+
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = vec.get_allocator());
+
+    ASSERT_TRUE(vec.empty());
+    ASSERT_EQ(vec.size(), 0u);
+    ASSERT_EQ(vec.capacity(), 0u);
+    ASSERT_NE(vec.max_size(), 0u);
+    ASSERT_EQ(vec.begin(), vec.end());
+    ASSERT_EQ(cvec.begin(), cvec.end());
+
+    vec.emplace_back(3);
+    vec.push_back(1);
+
+    ASSERT_FALSE(vec.empty());
+    ASSERT_EQ(vec.size(), 2u);
+    ASSERT_EQ(vec.capacity(), 4u);
+    ASSERT_EQ(vec.front(), 3);
+    ASSERT_EQ(cvec.back(), 1);
+    ASSERT_EQ(vec[1u], 1);
+    ASSERT_EQ(cvec[0u], 3);
+    ASSERT_EQ(*vec.raw()[0u], 3);
+
+    vec.pop_back();
+
+    ASSERT_EQ(vec.size(), 1u);
+    ASSERT_EQ(vec.back(), 3);
+
+    vec.clear();
+
+    ASSERT_TRUE(vec.empty());
+    ASSERT_EQ(vec.capacity(), 4u);
+
+    vec.shrink_to_fit();
+
+    ASSERT_EQ(vec.capacity(), 0u);
+}
+
+TEST(PagedVector, Stability) {
+    entt::paged_vector<std::size_t, 4u> vec;
+    const auto *first = &vec.emplace_back(0u);
+
+    for(std::size_t next = 1u; next < 64u; ++next) {
+        vec.push_back(next);
+    }
+
+    ASSERT_EQ(vec.size(), 64u);
+    ASSERT_EQ(vec.capacity(), 64u);
+    ASSERT_EQ(first, &vec.front());
+    ASSERT_EQ(&vec[2u] + 1, &*(vec.begin() + 3));
+    ASSERT_NE(&vec[3u] + 1, &vec[4u]);
+
+    for(std::size_t next{}; next < vec.size(); ++next) {
+        ASSERT_EQ(vec[next], next);
+    }
+
+    vec.reserve(128u);
+
+    ASSERT_EQ(vec.capacity(), 128u);
+    ASSERT_EQ(first, &vec.front());
+
+    while(vec.size() > 5u) {
+        vec.pop_back();
+    }
+
+    vec.shrink_to_fit();
+
+    ASSERT_EQ(vec.capacity(), 8u);
+    ASSERT_EQ(first, &vec.front());
+}
+
+TEST(PagedVector, Iterator) {
+    using iterator = typename entt::paged_vector<int, 2u>::iterator;
+    using const_iterator = typename entt::paged_vector<int, 2u>::const_iterator;
+
+    testing::StaticAssertTypeEq<typename iterator::value_type, int>();
+    testing::StaticAssertTypeEq<typename iterator::pointer, int *>();
+    testing::StaticAssertTypeEq<typename iterator::reference, int &>();
+    testing::StaticAssertTypeEq<typename const_iterator::reference, const int &>();
+
+    entt::paged_vector<int, 2u> vec;
+
+    for(int next{}; next < 5; ++next) {
+        vec.emplace_back(next);
+    }
+
+    iterator end{vec.begin()};
+    iterator begin{};
+    begin = vec.end();
+    std::swap(begin, end);
+
+    ASSERT_EQ(begin, vec.begin());
+    ASSERT_EQ(end, vec.end());
+    ASSERT_NE(begin, end);
+
+    ASSERT_EQ(begin++, vec.begin());
+    ASSERT_EQ(begin--, vec.begin() + 1);
+    ASSERT_EQ(begin + 3, vec.begin() + 3);
+    ASSERT_EQ(end - 2, vec.begin() + 3);
+
+    ASSERT_EQ(begin[3u], 3);
+    ASSERT_EQ(*(end - 1), 4);
+    ASSERT_EQ(end - begin, 5);
+    ASSERT_LT(begin, end);
+    ASSERT_GE(end, begin);
+
+    const_iterator cbegin = begin;
+
+    ASSERT_EQ(cbegin, vec.cbegin());
+    ASSERT_EQ(vec.cend() - cbegin, 5);
+
+    int expected{};
+
+    for(auto &&elem: vec) {
+        ASSERT_EQ(elem, expected++);
+    }
+
+    for(auto it = vec.rbegin(); it != vec.rend(); ++it) {
+        ASSERT_EQ(*it, --expected);
+    }
+
+    ASSERT_EQ(std::distance(vec.crbegin(), vec.crend()), 5);
+}
+
+TEST(PagedVector, CopyAndMove) {
+    entt::paged_vector<std::string, 2u> vec;
+
+    vec.emplace_back("foo");
+    vec.emplace_back(3u, 'a');
+    vec.emplace_back("bar");
+
+    entt::paged_vector<std::string, 2u> other{vec};
+
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_EQ(other[1u], "aaa");
+    ASSERT_NE(&other[1u], &vec[1u]);
+
+    const auto *elem = &vec[2u];
+    entt::paged_vector<std::string, 2u> moved{std::move(vec)};
+    test::is_initialized(vec);
+
+    ASSERT_TRUE(vec.empty());
+    ASSERT_EQ(&moved[2u], elem);
+
+    vec = moved;
+
+    ASSERT_EQ(vec.size(), 3u);
+    ASSERT_EQ(vec[2u], "bar");
+
+    other.clear();
+    other = std::move(moved);
+
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_EQ(&other[2u], elem);
+
+    other.swap(vec);
+
+    ASSERT_EQ(vec.size(), 3u);
+    ASSERT_EQ(&vec[2u], elem);
+}
+
+ENTT_DEBUG_TEST(PagedVectorDeathTest, Indexing) {
+    entt::paged_vector<int, 4u> vec;
+
+    ASSERT_DEATH([[maybe_unused]] auto value = vec[0u], "");
+    ASSERT_DEATH([[maybe_unused]] auto value = std::as_const(vec).back(), "");
+    ASSERT_DEATH(vec.pop_back(), "");
+}
+
+TEST(PagedVector, ThrowingType) {
+    entt::paged_vector<test::throwing_type, 4u> vec;
+
+    const test::throwing_type value{true};
+    vec.emplace_back(false);
+
+    ASSERT_THROW(vec.push_back(value), test::throwing_type_exception);
+    ASSERT_EQ(vec.size(), 1u);
+
+    vec.emplace_back(false);
+
+    ASSERT_EQ(vec.size(), 2u);
+}
+
+TEST(PagedVector, ThrowingAllocator) {
+    entt::paged_vector<int, 4u, test::throwing_allocator<int>> vec;
+
+    vec.get_allocator().template throw_counter<int>(0u);
+
+    ASSERT_THROW(vec.emplace_back(0), test::throwing_allocator_exception);
+    ASSERT_TRUE(vec.empty());
+    ASSERT_EQ(vec.capacity(), 0u);
+
+    vec.emplace_back(0);
+
+    ASSERT_EQ(vec.size(), 1u);
+}
+
+#if defined(ENTT_HAS_TRACKED_MEMORY_RESOURCE)
+#    include <memory_resource>
+
+TEST(PagedVector, UsesAllocatorConstruction) {
+    using string_type = typename test::tracked_memory_resource::string_type;
+
+    test::tracked_memory_resource memory_resource{};
+    entt::paged_vector<string_type, 4u, std::pmr::polymorphic_allocator<string_type>> vec{&memory_resource};
+
+    vec.emplace_back(test::tracked_memory_resource::default_value);
+
+    ASSERT_TRUE(vec.get_allocator().resource()->is_equal(memory_resource));
+    ASSERT_GT(memory_resource.do_allocate_counter(), 0u);
+}
+
+#endif
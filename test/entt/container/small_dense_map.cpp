@@ -0,0 +1,327 @@
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/container/small_dense_map.hpp>
+#include <entt/core/utility.hpp>
+#include "../../common/config.h"
+#include "../../common/linter.hpp"
+#include "../../common/tracked_memory_resource.hpp"
+#include "../../common/transparent_equal_to.h"
+
+TEST(SmallDenseMap, Functionalities) {
+    entt::small_dense_map<int, int, 4u, entt::identity, test::transparent_equal_to> map;
+    const auto &cmap = map;
+
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = map.get_allocator());
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_TRUE(map.is_inline());
+    ASSERT_EQ(map.size(), 0u);
+    ASSERT_EQ(map.inline_capacity(), 4u);
+    ASSERT_NE(map.max_size(), 0u);
+
+    ASSERT_EQ(map.begin(), map.end());
+    ASSERT_EQ(cmap.begin(), cmap.end());
+    ASSERT_EQ(map.cbegin(), map.cend());
+
+    ASSERT_FALSE(map.contains(64));
+    ASSERT_FALSE(map.contains(6.4));
+
+    ASSERT_EQ(map.hash_function()(64), 64);
+    ASSERT_TRUE(map.key_eq()(64, 64));
+
+    map.emplace(0, 0);
+
+    ASSERT_EQ(map.count(0), 1u);
+    ASSERT_EQ(map.count(6.4), 0u);
+    ASSERT_EQ(cmap.count(0.0), 1u);
+    ASSERT_EQ(cmap.count(64), 0u);
+
+    ASSERT_FALSE(map.empty());
+    ASSERT_EQ(map.size(), 1u);
+
+    ASSERT_NE(map.begin(), map.end());
+    ASSERT_NE(cmap.begin(), cmap.end());
+    ASSERT_NE(map.cbegin(), map.cend());
+
+    ASSERT_EQ(map.find(0), map.begin());
+    ASSERT_EQ(cmap.find(0.0), cmap.begin());
+    ASSERT_EQ(map.find(6.4), map.end());
+
+    map.clear();
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_TRUE(map.is_inline());
+}
+
+TEST(SmallDenseMap, Spill) {
+    entt::small_dense_map<std::size_t, std::size_t, 4u, entt::identity> map;
+
+    for(std::size_t next{}; next < 4u; ++next) {
+        map.emplace(next, next);
+    }
+
+    ASSERT_TRUE(map.is_inline());
+    ASSERT_EQ(map.size(), 4u);
+
+    map.emplace(4u, 4u);
+
+    ASSERT_FALSE(map.is_inline());
+    ASSERT_EQ(map.size(), 5u);
+
+    for(std::size_t next{}; next < 100u; ++next) {
+        map.try_emplace(next, next);
+    }
+
+    ASSERT_EQ(map.size(), 100u);
+
+    std::size_t expected{};
+
+    for(auto [key, value]: map) {
+        // insertion order is preserved across the transition
+        ASSERT_EQ(key, expected);
+        ASSERT_EQ(value, expected++);
+    }
+
+    for(std::size_t next{}; next < 100u; ++next) {
+        ASSERT_EQ(map.at(next), next);
+    }
+
+    map.clear();
+
+    ASSERT_TRUE(map.is_inline());
+    ASSERT_TRUE(map.empty());
+
+    map.emplace(1u, 1u);
+
+    ASSERT_TRUE(map.is_inline());
+    ASSERT_EQ(map.at(1u), 1u);
+
+    map.reserve(4u);
+
+    ASSERT_TRUE(map.is_inline());
+
+    map.reserve(8u);
+
+    ASSERT_FALSE(map.is_inline());
+    ASSERT_EQ(map.at(1u), 1u);
+}
+
+TEST(SmallDenseMap, CopyAndMove) {
+    entt::small_dense_map<int, std::string, 2u> map;
+    map.emplace(0, "0");
+
+    entt::small_dense_map<int, std::string, 2u> other{map};
+
+    ASSERT_EQ(map.at(0), "0");
+    ASSERT_EQ(other.at(0), "0");
+
+    map.emplace(1, "1");
+    map.emplace(2, "2");
+    other = map;
+
+    ASSERT_FALSE(other.is_inline());
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_EQ(other.at(2), "2");
+
+    entt::small_dense_map<int, std::string, 2u> moved{std::move(other)};
+    test::is_initialized(other);
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_TRUE(other.is_inline());
+    ASSERT_EQ(moved.at(1), "1");
+
+    other.emplace(3, "3");
+    moved = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_TRUE(moved.is_inline());
+    ASSERT_EQ(moved.size(), 1u);
+    ASSERT_EQ(moved.at(3), "3");
+
+    moved.swap(map);
+
+    ASSERT_EQ(moved.size(), 3u);
+    ASSERT_EQ(map.size(), 1u);
+    ASSERT_EQ(map.at(3), "3");
+}
+
+TEST(SmallDenseMap, Insert) {
+    entt::small_dense_map<int, int, 2u> map;
+    typename entt::small_dense_map<int, int, 2u>::iterator it;
+    bool result{};
+
+    std::tie(it, result) = map.insert(std::make_pair(1, 2));
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it, --map.end());
+    ASSERT_EQ(it->second, 2);
+
+    std::tie(it, result) = map.insert(std::make_pair(1, 4));
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(it->second, 2);
+
+    std::tie(it, result) = map.insert_or_assign(1, 8);
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(it->second, 8);
+
+    std::tie(it, result) = map.insert_or_assign(3, 10);
+
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(map.is_inline());
+
+    std::pair<const int, int> range[2u]{std::make_pair(5, 0), std::make_pair(7, 1)};
+    map.insert(std::begin(range), std::end(range));
+
+    ASSERT_FALSE(map.is_inline());
+    ASSERT_EQ(map.size(), 4u);
+    ASSERT_EQ(map[7], 1);
+    ASSERT_EQ(map[9], 0);
+    ASSERT_EQ(map.size(), 5u);
+}
+
+TEST(SmallDenseMap, Emplace) {
+    entt::small_dense_map<int, std::string, 2u> map;
+    typename entt::small_dense_map<int, std::string, 2u>::iterator it;
+    bool result{};
+
+    std::tie(it, result) = map.emplace();
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it->first, 0);
+
+    std::tie(it, result) = map.emplace(std::piecewise_construct, std::make_tuple(1), std::make_tuple(3u, 'a'));
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it->second, "aaa");
+
+    std::tie(it, result) = map.emplace(std::piecewise_construct, std::make_tuple(1), std::make_tuple("b"));
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(it->second, "aaa");
+    ASSERT_EQ(map.size(), 2u);
+
+    std::tie(it, result) = map.emplace(std::piecewise_construct, std::make_tuple(2), std::make_tuple("c"));
+
+    ASSERT_TRUE(result);
+    ASSERT_FALSE(map.is_inline());
+
+    std::tie(it, result) = map.emplace(std::piecewise_construct, std::make_tuple(1), std::make_tuple("d"));
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(it->second, "aaa");
+    ASSERT_EQ(map.size(), 3u);
+
+    std::tie(it, result) = map.try_emplace(3, 2u, 'e');
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it->second, "ee");
+}
+
+TEST(SmallDenseMap, Erase) {
+    entt::small_dense_map<std::size_t, std::size_t, 16u, entt::identity> map;
+    entt::small_dense_map<std::size_t, std::size_t, 2u, entt::identity> other;
+
+    for(std::size_t next{}; next < 10u; ++next) {
+        map.emplace(next, next);
+        other.emplace(next, next);
+    }
+
+    auto it = map.erase(++map.begin());
+    it = map.erase(it, it + 1);
+
+    auto oit = other.erase(++other.begin());
+    oit = other.erase(oit, oit + 1);
+
+    ASSERT_EQ(map.erase(7u), 1u);
+    ASSERT_EQ(map.erase(7u), 0u);
+    ASSERT_EQ(other.erase(7u), 1u);
+    ASSERT_EQ(other.erase(7u), 0u);
+
+    ASSERT_EQ(map.size(), 7u);
+    ASSERT_EQ(other.size(), 7u);
+    ASSERT_EQ(it->first, 8u);
+    ASSERT_EQ(oit->first, 8u);
+
+    for(std::size_t next{}; next < 10u; ++next) {
+        ASSERT_EQ(map.contains(next), other.contains(next));
+    }
+
+    ASSERT_FALSE(map.contains(1u));
+    ASSERT_FALSE(map.contains(9u));
+
+    map.erase(map.begin(), map.end());
+    other.erase(other.begin(), other.end());
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_TRUE(other.empty());
+}
+
+TEST(SmallDenseMap, EqualRange) {
+    entt::small_dense_map<int, int, 4u, entt::identity, test::transparent_equal_to> map;
+    const auto &cmap = map;
+
+    map.emplace(4, 1);
+
+    ASSERT_EQ(map.equal_range(0).first, map.end());
+    ASSERT_EQ(cmap.equal_range(0.0).first, cmap.cend());
+
+    ASSERT_EQ(map.equal_range(4).first->second, 1);
+    ASSERT_EQ(map.equal_range(4).second, map.end());
+    ASSERT_EQ(cmap.equal_range(4.0).first->second, 1);
+    ASSERT_EQ(cmap.equal_range(4.0).second, cmap.cend());
+}
+
+ENTT_DEBUG_TEST(SmallDenseMapDeathTest, Indexing) {
+    entt::small_dense_map<int, int, 4u> map;
+    const auto &cmap = map;
+
+    ASSERT_DEATH([[maybe_unused]] auto value = map.at(0), "");
+    ASSERT_DEATH([[maybe_unused]] auto value = cmap.at(42), "");
+}
+
+#if defined(ENTT_HAS_TRACKED_MEMORY_RESOURCE)
+#    include <memory_resource>
+
+TEST(SmallDenseMap, NoAllocation) {
+    using allocator = std::pmr::polymorphic_allocator<std::pair<const int, int>>;
+
+    test::tracked_memory_resource memory_resource{};
+    entt::small_dense_map<int, int, 4u, std::hash<int>, std::equal_to<>, allocator> map{&memory_resource};
+
+    for(int next{}; next < 4; ++next) {
+        map.emplace(next, next);
+    }
+
+    map.erase(0);
+
+    ASSERT_EQ(memory_resource.do_allocate_counter(), 0u);
+
+    map.emplace(4, 4);
+    map.emplace(5, 5);
+
+    ASSERT_GT(memory_resource.do_allocate_counter(), 0u);
+}
+
+TEST(SmallDenseMap, KeyUsesAllocatorConstruction) {
+    using string_type = typename test::tracked_memory_resource::string_type;
+    using allocator = std::pmr::polymorphic_allocator<std::pair<const string_type, int>>;
+
+    test::tracked_memory_resource memory_resource{};
+    entt::small_dense_map<string_type, int, 4u, std::hash<string_type>, std::equal_to<>, allocator> map{&memory_resource};
+
+    map.emplace(test::tracked_memory_resource::default_value, 0);
+
+    ASSERT_TRUE(map.is_inline());
+    ASSERT_TRUE(map.get_allocator().resource()->is_equal(memory_resource));
+    ASSERT_GT(memory_resource.do_allocate_counter(), 0u);
+}
+
+#endif
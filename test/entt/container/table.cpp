@@ -7,6 +7,7 @@
 #include <entt/container/table.hpp>
 #include <entt/core/iterator.hpp>
 #include "../../common/config.h"
+#include "../../common/empty.h"
 #include "../../common/linter.hpp"
 #include "../../common/throwing_allocator.hpp"
 
@@ -440,6 +441,35 @@ ENTT_DEBUG_TEST(TableDeathTest, Erase) {
     ASSERT_DEATH(table.erase(1u), "");
 }
 
+TEST(Table, SwapAndPop) {
+    entt::table<int, char> table;
+
+    table.emplace(3, 'c');
+    table.emplace(0, '\0');
+    table.emplace(1, 'a');
+    table.swap_and_pop(0u);
+
+    ASSERT_EQ(table.size(), 2u);
+    ASSERT_EQ(table[0u], std::make_tuple(1, 'a'));
+    ASSERT_EQ(table[1u], std::make_tuple(0, '\0'));
+
+    table.swap_and_pop(1u);
+
+    ASSERT_EQ(table.size(), 1u);
+    ASSERT_EQ(table[0u], std::make_tuple(1, 'a'));
+
+    table.pop_back();
+
+    ASSERT_TRUE(table.empty());
+}
+
+ENTT_DEBUG_TEST(TableDeathTest, SwapAndPop) {
+    entt::table<int, char> table;
+
+    ASSERT_DEATH(table.swap_and_pop(0u), "");
+    ASSERT_DEATH(table.pop_back(), "");
+}
+
 TEST(Table, Indexing) {
     entt::table<int, char> table;
 
@@ -457,6 +487,76 @@ ENTT_DEBUG_TEST(TableDeathTest, Indexing) {
     ASSERT_DEATH([[maybe_unused]] auto value = std::as_const(table)[0u], "");
 }
 
+TEST(Table, Column) {
+    entt::table<int, char> table;
+    const auto &ctable = table;
+
+    table.emplace(3, 'c');
+    table.emplace(0, '\0');
+
+    auto column = table.column<0u>();
+    auto ccolumn = ctable.column<1u>();
+
+    testing::StaticAssertTypeEq<decltype(column), entt::iterable_adaptor<typename std::vector<int>::iterator>>();
+    testing::StaticAssertTypeEq<decltype(ccolumn), entt::iterable_adaptor<typename std::vector<char>::const_iterator>>();
+
+    ASSERT_EQ(column.end() - column.begin(), 2);
+    ASSERT_EQ(ccolumn.end() - ccolumn.begin(), 2);
+    ASSERT_EQ(&*column.begin() + 1, &*(column.begin() + 1));
+
+    for(auto &&elem: column) {
+        elem += 1;
+    }
+
+    ASSERT_EQ(table[0u], std::make_tuple(4, 'c'));
+    ASSERT_EQ(table[1u], std::make_tuple(1, '\0'));
+    ASSERT_EQ(*ccolumn.begin(), 'c');
+}
+
+TEST(Table, EmptyType) {
+    entt::table<int, test::empty> table;
+
+    auto [value, elem] = table.emplace(3, test::empty{});
+
+    ASSERT_EQ(value, 3);
+
+    table.emplace();
+    table.emplace(1, test::empty{});
+
+    ASSERT_EQ(table.size(), 3u);
+    ASSERT_GE(table.capacity(), table.size());
+
+    auto column = table.column<1u>();
+
+    ASSERT_EQ(column.end() - column.begin(), 3);
+    ASSERT_EQ(&*column.begin(), &elem);
+    ASSERT_EQ(&std::get<1>(table[2u]), &elem);
+
+    table.swap_and_pop(0u);
+
+    ASSERT_EQ(table.size(), 2u);
+    ASSERT_EQ(std::get<0>(table[0u]), 1);
+    ASSERT_EQ(std::get<0>(table[1u]), 0);
+
+    table.erase(table.begin());
+
+    ASSERT_EQ(table.size(), 1u);
+    ASSERT_EQ(std::get<0>(table[0u]), 0);
+    ASSERT_EQ(table.rend() - table.rbegin(), 1);
+
+    entt::table<int, test::empty> other{std::move(table)};
+    test::is_initialized(table);
+
+    ASSERT_TRUE(table.empty());
+    ASSERT_EQ(other.size(), 1u);
+    ASSERT_EQ(other.column<1u>().end() - other.column<1u>().begin(), 1);
+
+    other.clear();
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(other.begin(), other.end());
+}
+
 TEST(Table, Clear) {
     entt::table<int, char> table;
 
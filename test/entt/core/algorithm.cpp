@@ -1,8 +1,10 @@
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/algorithm.hpp>
+#include <entt/core/utility.hpp>
 #include "../../common/boxed_type.h"
 
 TEST(Algorithm, StdSort) {
@@ -89,3 +91,63 @@ TEST(Algorithm, RadixSortEmptyContainer) {
     // this should crash with asan enabled if we break the constraint
     sort(vec.begin(), vec.end());
 }
+
+TEST(Algorithm, RadixSortScratchBuffer) {
+    std::vector<unsigned int> vec{4u, 1u, 3u, 2u, 0u};
+    std::vector<unsigned int> aux{};
+    const entt::radix_sort<2, 6> sort;
+
+    sort(vec.begin(), vec.end(), entt::identity{}, aux);
+
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+    ASSERT_EQ(aux.size(), vec.size());
+
+    vec.assign({3u, 2u, 1u});
+    sort(vec.begin(), vec.end(), entt::identity{}, aux);
+
+    ASSERT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+    ASSERT_EQ(aux.size(), 5u);
+}
+
+TEST(Algorithm, ParallelRadixSort) {
+    std::array arr{4u, 1u, 3u, 2u, 0u};
+    const entt::parallel_radix_sort<8, 32> sort{4u};
+
+    sort(arr.begin(), arr.end(), [](const auto &value) {
+        return value;
+    });
+
+    ASSERT_TRUE(std::is_sorted(arr.begin(), arr.end()));
+}
+
+TEST(Algorithm, ParallelRadixSortLargeRange) {
+    std::vector<test::boxed_int> vec(entt::parallel_radix_sort<8, 32>::grain * 4u + 3u);
+    std::vector<test::boxed_int> aux{};
+
+    for(std::size_t pos{}, seed{7u}; pos < vec.size(); ++pos) {
+        seed = seed * 1103515245u + 12345u;
+        vec[pos].value = static_cast<int>((seed >> 8u) % 4096u);
+    }
+
+    const auto original = vec;
+    auto expected = vec;
+    std::stable_sort(expected.begin(), expected.end(), [](const auto &lhs, const auto &rhs) { return lhs.value < rhs.value; });
+
+    // odd number of passes with a reverse range
+    entt::parallel_radix_sort<4, 12>{3u}(vec.rbegin(), vec.rend(), [](const auto &instance) { return instance.value; }, aux);
+
+    ASSERT_TRUE(std::is_sorted(vec.rbegin(), vec.rend()));
+    ASSERT_EQ(aux.size(), vec.size());
+
+    vec = original;
+    entt::parallel_radix_sort<8, 16>{4u}(vec.begin(), vec.end(), [](const auto &instance) { return instance.value; }, aux);
+
+    ASSERT_EQ(vec, expected);
+}
+
+TEST(Algorithm, ParallelRadixSortEmptyContainer) {
+    std::vector<int> vec{};
+    const entt::parallel_radix_sort<8, 32> sort;
+    // this should crash with asan enabled if we break the constraint
+    sort(vec.begin(), vec.end());
+}
@@ -15,6 +15,7 @@
 #include "../../common/new_delete.h"
 #include "../../common/non_comparable.h"
 #include "../../common/non_movable.h"
+#include "../../common/throwing_type.hpp"
 
 template<std::size_t Len>
 struct tracker {
@@ -46,6 +47,24 @@ struct fat {
 
 struct alignas(64u) over_aligned {};
 
+struct counting_resource final: entt::any_resource {
+    [[nodiscard]] void *allocate(const size_type bytes, const size_type alignment) override {
+        ++allocated;
+        memory += bytes;
+        return ::operator new(bytes, std::align_val_t{alignment});
+    }
+
+    void deallocate(void *block, const size_type bytes, const size_type alignment) noexcept override {
+        ++deallocated;
+        memory -= bytes;
+        ::operator delete(block, std::align_val_t{alignment});
+    }
+
+    size_type allocated{};
+    size_type deallocated{};
+    size_type memory{};
+};
+
 TEST(Any, Empty) {
     entt::any any{};
 
@@ -1802,3 +1821,211 @@ TEST(Any, ClassLevelNewDelete) {
     ASSERT_EQ(any.info(), entt::type_id<test::new_delete>());
     ASSERT_EQ(entt::any_cast<const test::new_delete &>(any).value, 3);
 }
+
+TEST(Any, Arena) {
+    entt::any_arena arena{128u};
+    int counter{};
+
+    ASSERT_EQ(entt::any_arena::current(), nullptr);
+    ASSERT_EQ(entt::any_arena::install(&arena), nullptr);
+    ASSERT_EQ(entt::any_arena::current(), &arena);
+
+    {
+        entt::any any{fat{.1, .2, .3, .4}};
+        entt::any other{tracker<64u>{counter}};
+        entt::any sbo{3};
+
+        ASSERT_EQ(arena.size(), 1u);
+        ASSERT_EQ(any.policy(), entt::any_policy::arena);
+        ASSERT_EQ(other.policy(), entt::any_policy::arena);
+        ASSERT_EQ(sbo.policy(), entt::any_policy::embedded);
+        ASSERT_TRUE(any.owner());
+        ASSERT_EQ(entt::any_cast<const fat &>(any), (fat{.1, .2, .3, .4}));
+
+        const entt::any copy{any};
+
+        ASSERT_EQ(copy.policy(), entt::any_policy::arena);
+        ASSERT_NE(copy.data(), any.data());
+        ASSERT_EQ(copy, any);
+
+        entt::any moved{std::move(other)};
+
+        ASSERT_EQ(moved.policy(), entt::any_policy::arena);
+        ASSERT_EQ(counter, 1);
+
+        moved.reset();
+
+        ASSERT_EQ(counter, 2);
+
+        entt::any_arena::install(nullptr);
+        const entt::any heap{any};
+
+        ASSERT_EQ(heap.policy(), entt::any_policy::dynamic);
+        ASSERT_EQ(heap, any);
+    }
+
+    // chunks are kept until they are released
+    ASSERT_EQ(arena.size(), 2u);
+
+    arena.clear();
+
+    ASSERT_EQ(arena.size(), 2u);
+
+    arena.release();
+
+    ASSERT_EQ(arena.size(), 0u);
+
+    {
+        entt::any_arena other{};
+        entt::any_arena::install(&other);
+    }
+
+    ASSERT_EQ(entt::any_arena::current(), nullptr);
+}
+
+TEST(Any, ArenaAlignment) {
+    struct alignas(64u) aligned_type {
+        std::array<std::byte, 64u> buffer{};
+    };
+
+    entt::any_arena arena{8u};
+    entt::any_arena::install(&arena);
+
+    const entt::any any{aligned_type{}};
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+    const entt::any array{std::in_place_type<int[3]>};
+
+    entt::any_arena::install(nullptr);
+
+    ASSERT_EQ(any.policy(), entt::any_policy::arena);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(any.data()) % 64u, 0u);
+    ASSERT_EQ(array.policy(), entt::any_policy::dynamic);
+}
+
+ENTT_DEBUG_TEST(AnyDeathTest, Arena) {
+    ASSERT_DEATH(entt::any_arena{0u}, "");
+}
+
+TEST(Any, Resource) {
+    counting_resource resource{};
+    int counter{};
+
+    ASSERT_EQ(entt::any_resource::current(), nullptr);
+    ASSERT_EQ(entt::any_resource::install(&resource), nullptr);
+    ASSERT_EQ(entt::any_resource::current(), &resource);
+
+    {
+        entt::any any{fat{.1, .2, .3, .4}};
+        entt::any other{tracker<64u>{counter}};
+        const entt::any sbo{3};
+
+        ASSERT_EQ(resource.allocated, 2u);
+        ASSERT_GE(resource.memory, sizeof(fat) + sizeof(tracker<64u>));
+        ASSERT_EQ(any.policy(), entt::any_policy::resource);
+        ASSERT_EQ(other.policy(), entt::any_policy::resource);
+        ASSERT_EQ(sbo.policy(), entt::any_policy::embedded);
+        ASSERT_TRUE(any.owner());
+        ASSERT_EQ(entt::any_cast<const fat &>(any), (fat{.1, .2, .3, .4}));
+
+        const entt::any copy{any};
+
+        ASSERT_EQ(copy.policy(), entt::any_policy::resource);
+        ASSERT_NE(copy.data(), any.data());
+        ASSERT_EQ(copy, any);
+        ASSERT_EQ(resource.allocated, 3u);
+
+        entt::any moved{std::move(other)};
+
+        ASSERT_EQ(moved.policy(), entt::any_policy::resource);
+        ASSERT_EQ(resource.allocated, 3u);
+        ASSERT_EQ(counter, 1);
+
+        moved.reset();
+
+        ASSERT_EQ(counter, 2);
+        ASSERT_EQ(resource.deallocated, 1u);
+
+        entt::any_resource::install(nullptr);
+        const entt::any heap{any};
+
+        ASSERT_EQ(heap.policy(), entt::any_policy::dynamic);
+        ASSERT_EQ(heap, any);
+
+        entt::any_arena arena{};
+        entt::any_arena::install(&arena);
+        entt::any_resource::install(&resource);
+
+        // arenas take precedence over resources
+        const entt::any elem{fat{.1, .2, .3, .4}};
+
+        ASSERT_EQ(elem.policy(), entt::any_policy::arena);
+
+        entt::any_arena::install(nullptr);
+    }
+
+    ASSERT_EQ(resource.allocated, 3u);
+    ASSERT_EQ(resource.deallocated, 3u);
+    ASSERT_EQ(resource.memory, 0u);
+
+    {
+        counting_resource other{};
+        entt::any_resource::install(&other);
+    }
+
+    ASSERT_EQ(entt::any_resource::current(), nullptr);
+}
+
+TEST(Any, ResourceAlignment) {
+    counting_resource resource{};
+    entt::any_resource::install(&resource);
+
+    const entt::any any{over_aligned{}};
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+    const entt::any array{std::in_place_type<int[3]>};
+
+    entt::any_resource::install(nullptr);
+
+    ASSERT_EQ(any.policy(), entt::any_policy::resource);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(any.data()) % alignof(over_aligned), 0u);
+    ASSERT_EQ(array.policy(), entt::any_policy::dynamic);
+}
+
+TEST(Any, ResourceThrowOnCopy) {
+    counting_resource resource{};
+    entt::any_resource::install(&resource);
+
+    entt::basic_any<0u> any{test::throwing_type{false}};
+    entt::any_cast<test::throwing_type &>(any).throw_on_copy(true);
+
+    ASSERT_EQ(any.policy(), entt::any_policy::resource);
+    ASSERT_EQ(resource.allocated, 1u);
+    ASSERT_THROW(entt::basic_any<0u>{any}, test::throwing_type_exception);
+    ASSERT_EQ(resource.allocated, 2u);
+    ASSERT_EQ(resource.deallocated, 1u);
+
+    entt::any_resource::install(nullptr);
+}
+
+TEST(Any, AllocatorResource) {
+    entt::any_allocator_resource<std::allocator<int>> resource{};
+
+    testing::StaticAssertTypeEq<typename decltype(resource)::allocator_type, std::allocator<std::max_align_t>>();
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = resource.get_allocator());
+
+    entt::any_resource::install(&resource);
+    entt::any any{fat{.1, .2, .3, .4}};
+    entt::any_resource::install(nullptr);
+
+    ASSERT_EQ(any.policy(), entt::any_policy::resource);
+    ASSERT_EQ(entt::any_cast<const fat &>(any), (fat{.1, .2, .3, .4}));
+
+    any.reset();
+
+    ASSERT_FALSE(any);
+}
+
+ENTT_DEBUG_TEST(AnyDeathTest, AllocatorResource) {
+    entt::any_allocator_resource resource{};
+
+    ASSERT_DEATH([[maybe_unused]] auto *block = resource.allocate(1u, 2u * alignof(std::max_align_t)), "");
+}
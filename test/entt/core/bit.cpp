@@ -18,6 +18,20 @@ TEST(PopCount, Functionalities) {
     ASSERT_EQ(entt::popcount(201u), 4u);
 }
 
+TEST(CountrZero, Functionalities) {
+    // constexpr-ness guaranteed
+    constexpr auto zero_countr_zero = entt::countr_zero(0u);
+
+    ASSERT_EQ(zero_countr_zero, std::numeric_limits<unsigned int>::digits);
+    ASSERT_EQ(entt::countr_zero(1u), 0);
+    ASSERT_EQ(entt::countr_zero(2u), 1);
+    ASSERT_EQ(entt::countr_zero(12u), 2);
+    ASSERT_EQ(entt::countr_zero(128u), 7);
+    ASSERT_EQ(entt::countr_zero(static_cast<unsigned char>(0u)), 8);
+    ASSERT_EQ(entt::countr_zero(static_cast<unsigned char>(64u)), 6);
+    ASSERT_EQ(entt::countr_zero(std::size_t{1u} << (std::numeric_limits<std::size_t>::digits - 1)), std::numeric_limits<std::size_t>::digits - 1);
+}
+
 TEST(HasSingleBit, Functionalities) {
     // constexpr-ness guaranteed
     constexpr auto zero_is_power_of_two = entt::has_single_bit(0u);
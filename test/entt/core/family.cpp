@@ -3,6 +3,7 @@
 
 using a_family = entt::family<struct a_family_type>;
 using another_family = entt::family<struct another_family_type>;
+using a_fixed_family = entt::fixed_family<int, char, double>;
 
 TEST(Family, Functionalities) {
     auto t1 = a_family::value<int>;
@@ -20,3 +21,20 @@ TEST(Family, Uniqueness) {
     ASSERT_NE(a_family::value<int>, a_family::value<int &&>);
     ASSERT_NE(a_family::value<int>, a_family::value<const int &>);
 }
+
+TEST(FixedFamily, Functionalities) {
+    constexpr auto t1 = a_fixed_family::value<int>;
+    constexpr auto t2 = a_fixed_family::value<char>;
+    constexpr auto t3 = a_fixed_family::value<double>;
+
+    testing::StaticAssertTypeEq<decltype(a_fixed_family::value<int>), const a_fixed_family::value_type>();
+
+    ASSERT_EQ(t1, 0u);
+    ASSERT_EQ(t2, 1u);
+    ASSERT_EQ(t3, 2u);
+    ASSERT_EQ(a_fixed_family::size, 3u);
+
+    ASSERT_TRUE(a_fixed_family::contains<int>);
+    ASSERT_FALSE(a_fixed_family::contains<int &>);
+    ASSERT_FALSE(a_fixed_family::contains<float>);
+}
@@ -1,4 +1,6 @@
+#include <cstddef>
 #include <cstdint>
+#include <string>
 #include <string_view>
 #include <type_traits>
 #include <gtest/gtest.h>
@@ -216,3 +218,42 @@ TEST_F(HashedWString, Constexprness) {
     ASSERT_GT(entt::hashed_wstring{L"foo"}, L"bar"_hws);
     ASSERT_GE(entt::hashed_wstring{L"foo"}, L"foo"_hws);
 }
+
+TEST(WordHashPolicy, Functionalities) {
+    using hashed_string = entt::basic_hashed_string<char, entt::word_hash_policy>;
+    using hash_type = hashed_string::hash_type;
+
+    const std::string path{"assets/textures/environment/forest/oak_tree_bark_diffuse.png"};
+
+    testing::StaticAssertTypeEq<typename hashed_string::policy_type, entt::word_hash_policy>();
+
+    ASSERT_EQ((hashed_string{path.data(), path.size()}), hashed_string{path.c_str()});
+    ASSERT_EQ(hashed_string::value(path.data(), path.size()), hashed_string::value(path.c_str()));
+    ASSERT_EQ(hashed_string{path.c_str()}.size(), path.size());
+
+    ASSERT_NE(hashed_string{"foo"}, hashed_string{"bar"});
+    ASSERT_NE((hashed_string{"foo", 3u}), (hashed_string{"foo\0", 4u}));
+    ASSERT_NE(static_cast<hash_type>(hashed_string{"foo"}), static_cast<hash_type>(entt::hashed_string{"foo"}));
+
+    // every length exercises a different combination of full and partial words
+    for(std::size_t len = 1u; len < path.size(); ++len) {
+        ASSERT_NE((hashed_string{path.data(), len - 1u}), (hashed_string{path.data(), len}));
+        ASSERT_NE((hashed_string{path.data(), len}), (hashed_string{path.data() + 1u, len}));
+    }
+}
+
+TEST(WordHashPolicy, Constexprness) {
+    using hashed_string = entt::basic_hashed_string<char, entt::word_hash_policy>;
+    using hashed_wstring = entt::basic_hashed_string<wchar_t, entt::word_hash_policy>;
+
+    constexpr auto value = hashed_string::value("assets/textures/environment/forest.png");
+    constexpr auto wvalue = hashed_wstring::value(L"assets/textures/environment/forest.png");
+    const std::string path{"assets/textures/environment/forest.png"};
+    const std::wstring wpath{L"assets/textures/environment/forest.png"};
+
+    ASSERT_EQ(value, hashed_string::value(path.data(), path.size()));
+    ASSERT_EQ(wvalue, hashed_wstring::value(wpath.data(), wpath.size()));
+    ASSERT_NE(value, static_cast<entt::id_type>(wvalue));
+
+    ASSERT_EQ((hashed_string::value("", 0u)), hashed_string{});
+}
@@ -0,0 +1,153 @@
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/core/hashed_string_pool.hpp>
+#include "../../common/config.h"
+#include "../../common/linter.hpp"
+
+struct constant_hash_policy {
+    template<typename Char>
+    [[nodiscard]] static constexpr entt::id_type hash(const Char *, const std::size_t) noexcept {
+        return entt::id_type{42};
+    }
+};
+
+TEST(HashedStringPool, Functionalities) {
+    using namespace entt::literals;
+
+    entt::hashed_string_pool pool;
+
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = pool.get_allocator());
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.size(), 0u);
+    ASSERT_EQ(pool.begin(), pool.end());
+    ASSERT_FALSE(pool.contains("foo"_hs));
+    ASSERT_EQ(pool.find("foo"_hs).data(), nullptr);
+
+    std::string str{"foo"};
+    const auto foo = pool.intern(str.c_str());
+
+    str = "bar";
+
+    ASSERT_FALSE(pool.empty());
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_EQ(foo, "foo"_hs);
+    ASSERT_STREQ(foo.data(), "foo");
+    ASSERT_EQ(foo.size(), 3u);
+
+    const auto bar = pool.intern(str.data(), 2u);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(bar, "ba"_hs);
+    ASSERT_STREQ(bar.data(), "ba");
+
+    ASSERT_EQ(pool.intern("foo").data(), foo.data());
+    ASSERT_EQ(pool.intern(entt::hashed_string{"foo"}).data(), foo.data());
+    ASSERT_EQ(pool.size(), 2u);
+
+    ASSERT_TRUE(pool.contains("foo"_hs));
+    ASSERT_TRUE(pool.contains("ba"_hs));
+    ASSERT_FALSE(pool.contains("bar"_hs));
+
+    ASSERT_EQ(pool.find("foo"_hs).data(), foo.data());
+    ASSERT_EQ(pool.find("bar"_hs).data(), nullptr);
+    ASSERT_EQ(pool["ba"_hs], bar.data());
+
+    const std::vector<entt::hashed_string> expected{foo, bar};
+    const std::vector<entt::hashed_string> values{pool.begin(), pool.end()};
+
+    ASSERT_EQ(values, expected);
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_FALSE(pool.contains("foo"_hs));
+    ASSERT_EQ(pool.begin(), pool.end());
+}
+
+TEST(HashedStringPool, Stability) {
+    entt::hashed_string_pool pool;
+    std::vector<entt::hashed_string> interned{};
+
+    pool.reserve(8u);
+
+    for(std::size_t next{}; next < 2048u; ++next) {
+        interned.push_back(pool.intern(std::to_string(next).c_str()));
+    }
+
+    const std::string large(8192u, 'a');
+    const auto elem = pool.intern(large.c_str());
+
+    ASSERT_EQ(pool.size(), 2049u);
+    ASSERT_EQ(elem.size(), large.size());
+    ASSERT_EQ(pool[elem.value()], elem.data());
+
+    for(std::size_t next{}; next < interned.size(); ++next) {
+        ASSERT_EQ(interned[next].data(), pool[interned[next].value()]);
+        ASSERT_EQ(interned[next].data(), std::to_string(next));
+    }
+}
+
+TEST(HashedStringPool, Move) {
+    using namespace entt::literals;
+
+    entt::hashed_string_pool pool;
+    const auto *str = pool.intern("foo").data();
+
+    entt::hashed_string_pool other{std::move(pool)};
+    test::is_initialized(pool);
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(other["foo"_hs], str);
+
+    pool = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_EQ(pool["foo"_hs], str);
+
+    pool.intern("bar");
+    pool.swap(other);
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_TRUE(other.contains("bar"_hs));
+}
+
+TEST(HashedStringPool, Policy) {
+    entt::basic_hashed_string_pool<char, entt::word_hash_policy> pool;
+    const auto elem = pool.intern("a fairly long string");
+
+    testing::StaticAssertTypeEq<decltype(elem), const entt::basic_hashed_string<char, entt::word_hash_policy>>();
+
+    ASSERT_EQ(elem, (entt::basic_hashed_string<char, entt::word_hash_policy>{"a fairly long string"}));
+    ASSERT_STREQ(pool[elem.value()], "a fairly long string");
+}
+
+TEST(HashedWStringPool, Functionalities) {
+    entt::hashed_wstring_pool pool;
+    const auto elem = pool.intern(L"foo");
+
+    ASSERT_EQ(elem, entt::hashed_wstring{L"foo"});
+    ASSERT_EQ(std::wstring{pool[elem.value()]}, L"foo");
+}
+
+ENTT_DEBUG_TEST(HashedStringPoolDeathTest, Functionalities) {
+    using namespace entt::literals;
+
+    entt::hashed_string_pool pool;
+
+    ASSERT_DEATH([[maybe_unused]] const auto *str = pool["foo"_hs], "");
+}
+
+ENTT_DEBUG_TEST(HashedStringPoolDeathTest, Collision) {
+    entt::basic_hashed_string_pool<char, constant_hash_policy> pool;
+
+    pool.intern("foo");
+
+    ASSERT_NO_THROW(pool.intern("foo"));
+    ASSERT_DEATH(pool.intern("bar"), "");
+}
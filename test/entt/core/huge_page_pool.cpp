@@ -0,0 +1,144 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/core/huge_page_pool.hpp>
+#include <entt/entity/registry.hpp>
+#include "../../common/config.h"
+
+TEST(HugePagePool, Functionalities) {
+    entt::huge_page_pool pool{};
+
+    ASSERT_EQ(pool.chunks(), 0u);
+    ASSERT_EQ(pool.capacity(), 0u);
+
+    auto *first = static_cast<std::byte *>(pool.allocate(16u, alignof(std::max_align_t)));
+    auto *second = static_cast<std::byte *>(pool.allocate(16u, alignof(std::max_align_t)));
+
+    ASSERT_EQ(pool.chunks(), 1u);
+    ASSERT_EQ(pool.capacity(), entt::huge_page_pool::huge_page_size);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(first) % entt::huge_page_pool::huge_page_size, 0u);
+    ASSERT_EQ(first + 16u, second);
+
+    // blocks are written to make sure the memory is usable
+    first[0u] = std::byte{1};
+    second[15u] = std::byte{2};
+
+    pool.deallocate(first, 16u, alignof(std::max_align_t));
+
+    ASSERT_EQ(pool.allocate(16u, alignof(std::max_align_t)), first);
+    ASSERT_NE(pool.allocate(16u, alignof(std::max_align_t)), first);
+    ASSERT_NE(pool.allocate(32u, alignof(std::max_align_t)), nullptr);
+
+    pool.release();
+
+    ASSERT_EQ(pool.chunks(), 0u);
+    ASSERT_EQ(pool.capacity(), 0u);
+}
+
+TEST(HugePagePool, Chunks) {
+    entt::huge_page_pool pool{1u};
+    constexpr auto half = entt::huge_page_pool::huge_page_size / 2u;
+
+    void *first = pool.allocate(half, alignof(std::max_align_t));
+    void *second = pool.allocate(half, alignof(std::max_align_t));
+
+    ASSERT_EQ(pool.chunks(), 1u);
+
+    void *third = pool.allocate(half, alignof(std::max_align_t));
+
+    ASSERT_EQ(pool.chunks(), 2u);
+    ASSERT_EQ(pool.capacity(), 2u * entt::huge_page_pool::huge_page_size);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(third) % entt::huge_page_pool::huge_page_size, 0u);
+
+    pool.deallocate(first, half, alignof(std::max_align_t));
+    pool.deallocate(second, half, alignof(std::max_align_t));
+    pool.deallocate(third, half, alignof(std::max_align_t));
+
+    ASSERT_EQ(pool.capacity(), 2u * entt::huge_page_pool::huge_page_size);
+}
+
+TEST(HugePagePool, Large) {
+    entt::huge_page_pool pool{};
+    constexpr auto bytes = entt::huge_page_pool::huge_page_size + 1u;
+
+    auto *block = static_cast<std::byte *>(pool.allocate(bytes, alignof(std::max_align_t)));
+
+    ASSERT_EQ(pool.chunks(), 0u);
+    ASSERT_EQ(pool.capacity(), 2u * entt::huge_page_pool::huge_page_size);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(block) % entt::huge_page_pool::huge_page_size, 0u);
+
+    block[bytes - 1u] = std::byte{1};
+    pool.deallocate(block, bytes, alignof(std::max_align_t));
+
+    ASSERT_EQ(pool.capacity(), 0u);
+}
+
+TEST(HugePagePool, Alignment) {
+    entt::huge_page_pool pool{};
+    constexpr std::size_t alignment = 4u * alignof(std::max_align_t);
+
+    [[maybe_unused]] const auto *ptr = pool.allocate(1u, 1u);
+    void *block = pool.allocate(16u, alignment);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignment, 0u);
+
+    pool.deallocate(block, 16u, alignment);
+}
+
+ENTT_DEBUG_TEST(HugePagePoolDeathTest, Alignment) {
+    entt::huge_page_pool pool{};
+
+    ASSERT_DEATH([[maybe_unused]] auto *ptr = pool.allocate(1u, 2u * entt::huge_page_pool::huge_page_size), "");
+}
+
+TEST(HugePageAllocator, Functionalities) {
+    const entt::huge_page_allocator<int> allocator{};
+    const entt::huge_page_allocator<char> rebound{allocator};
+    const entt::huge_page_allocator<int> other{std::make_shared<entt::huge_page_pool>()};
+
+    ASSERT_NE(allocator.resource(), nullptr);
+    ASSERT_EQ(allocator.resource(), rebound.resource());
+    ASSERT_TRUE(allocator == rebound);
+    ASSERT_FALSE(allocator != rebound);
+    ASSERT_FALSE(allocator == other);
+    ASSERT_TRUE(allocator != other);
+
+    entt::huge_page_allocator<int> copy{other};
+    entt::huge_page_allocator<int> moved{std::move(copy)};
+
+    // moving an allocator is the same as copying it
+    ASSERT_EQ(copy, other);
+    ASSERT_EQ(moved, other);
+
+    int *value = moved.allocate(4u);
+    value[3u] = 1;
+    moved.deallocate(value, 4u);
+
+    ASSERT_EQ(other.resource()->chunks(), 1u);
+
+    copy = allocator;
+
+    ASSERT_EQ(copy, allocator);
+}
+
+TEST(HugePageAllocator, Registry) {
+    using allocator_type = entt::huge_page_allocator<entt::entity>;
+    entt::basic_registry<entt::entity, allocator_type> registry{};
+    const auto pool = registry.get_allocator().resource();
+
+    for(int pos{}; pos < 4096; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+        registry.emplace<char>(entity, 'c');
+    }
+
+    int sum{};
+
+    registry.view<int, char>().each([&sum](const int value, const char) { sum += value; });
+
+    ASSERT_EQ(sum, 4096 * 4095 / 2);
+    ASSERT_EQ(registry.storage<int>().get_allocator(), registry.get_allocator());
+    ASSERT_NE(pool->chunks(), 0u);
+}
@@ -0,0 +1,132 @@
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/monotonic_pool.hpp>
+#include <entt/entity/registry.hpp>
+#include "../../common/config.h"
+
+TEST(MonotonicPool, Functionalities) {
+    entt::monotonic_pool pool{256u};
+
+    ASSERT_EQ(pool.chunks(), 0u);
+    ASSERT_EQ(pool.capacity(), 0u);
+
+    auto *first = static_cast<std::byte *>(pool.allocate(16u, alignof(std::max_align_t)));
+    auto *second = static_cast<std::byte *>(pool.allocate(16u, alignof(std::max_align_t)));
+
+    ASSERT_EQ(pool.chunks(), 1u);
+    ASSERT_EQ(pool.capacity(), 256u);
+    ASSERT_EQ(first + 16u, second);
+
+    pool.deallocate(second, 16u, alignof(std::max_align_t));
+
+    ASSERT_EQ(pool.allocate(16u, alignof(std::max_align_t)), second);
+
+    pool.deallocate(first, 16u, alignof(std::max_align_t));
+
+    ASSERT_NE(pool.allocate(16u, alignof(std::max_align_t)), first);
+
+    void *large = pool.allocate(1024u, alignof(std::max_align_t));
+
+    ASSERT_NE(large, nullptr);
+    ASSERT_EQ(pool.chunks(), 2u);
+    ASSERT_GE(pool.capacity(), 256u + 1024u);
+
+    pool.reset();
+
+    ASSERT_EQ(pool.chunks(), 2u);
+    ASSERT_EQ(pool.allocate(16u, alignof(std::max_align_t)), first);
+
+    pool.release();
+
+    ASSERT_EQ(pool.chunks(), 0u);
+    ASSERT_EQ(pool.capacity(), 0u);
+}
+
+TEST(MonotonicPool, Alignment) {
+    entt::monotonic_pool pool{};
+    constexpr std::size_t alignment = 4u * alignof(std::max_align_t);
+
+    [[maybe_unused]] const auto *ptr = pool.allocate(1u, 1u);
+    void *block = pool.allocate(16u, alignment);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignment, 0u);
+
+    pool.deallocate(block, 16u, alignment);
+}
+
+ENTT_DEBUG_TEST(MonotonicPoolDeathTest, Constructors) {
+    ASSERT_DEATH(entt::monotonic_pool{0u}, "");
+}
+
+TEST(MonotonicPoolAllocator, Functionalities) {
+    entt::monotonic_pool pool{};
+    entt::monotonic_pool another{};
+    const entt::monotonic_pool_allocator<int> allocator{pool};
+    const entt::monotonic_pool_allocator<char> rebound{allocator};
+    const entt::monotonic_pool_allocator<int> other{another};
+
+    ASSERT_EQ(allocator, rebound);
+    ASSERT_NE(allocator, other);
+    ASSERT_EQ(allocator.resource(), &pool);
+    ASSERT_EQ(rebound.resource(), &pool);
+
+    entt::monotonic_pool_allocator<int> copy{other};
+    entt::monotonic_pool_allocator<int> moved{std::move(copy)};
+
+    ASSERT_EQ(copy, moved);
+    ASSERT_EQ(moved, other);
+
+    copy = allocator;
+
+    ASSERT_EQ(copy, allocator);
+}
+
+TEST(MonotonicPoolAllocator, Container) {
+    entt::monotonic_pool pool{};
+    std::vector<int, entt::monotonic_pool_allocator<int>> vec{entt::monotonic_pool_allocator<int>{pool}};
+
+    for(int next{}; next < 1024; ++next) {
+        vec.push_back(next);
+    }
+
+    ASSERT_EQ(vec.size(), 1024u);
+    ASSERT_EQ(vec.back(), 1023);
+    ASSERT_NE(pool.chunks(), 0u);
+}
+
+TEST(MonotonicPoolAllocator, Registry) {
+    using allocator_type = entt::monotonic_pool_allocator<entt::entity>;
+    entt::monotonic_pool pool{};
+
+    {
+        entt::basic_registry<entt::entity, allocator_type> registry{allocator_type{pool}};
+        const auto entity = registry.create(entt::entity{ENTT_SPARSE_PAGE * 2u});
+
+        registry.on_construct<int>().connect<&entt::basic_registry<entt::entity, allocator_type>::emplace_or_replace<char>>();
+        registry.emplace<int>(entity, 1);
+
+        ASSERT_EQ(registry.storage<int>().get_allocator(), registry.get_allocator());
+        ASSERT_EQ(registry.get_allocator().resource(), &pool);
+        ASSERT_EQ(registry.get<char>(entity), char{});
+    }
+
+    const auto chunks = pool.chunks();
+
+    ASSERT_NE(chunks, 0u);
+
+    pool.reset();
+
+    {
+        entt::basic_registry<entt::entity, allocator_type> registry{allocator_type{pool}};
+        const auto entity = registry.create(entt::entity{ENTT_SPARSE_PAGE * 2u});
+
+        registry.emplace<int>(entity, 3);
+
+        ASSERT_EQ(registry.get<int>(entity), 3);
+    }
+
+    ASSERT_EQ(pool.chunks(), chunks);
+}
@@ -0,0 +1,115 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/page_pool.hpp>
+#include <entt/entity/registry.hpp>
+
+TEST(PagePool, Functionalities) {
+    entt::page_pool pool{};
+
+    ASSERT_EQ(pool.size(), 0u);
+
+    void *block = pool.allocate(64u, alignof(std::max_align_t));
+    pool.deallocate(block, 64u, alignof(std::max_align_t));
+
+    ASSERT_EQ(pool.size(), 1u);
+    void *small = pool.allocate(32u, alignof(std::max_align_t));
+    void *aligned = pool.allocate(64u, 2u * alignof(std::max_align_t));
+
+    ASSERT_NE(small, block);
+    ASSERT_NE(aligned, block);
+    ASSERT_EQ(pool.size(), 1u);
+
+    pool.deallocate(small, 32u, alignof(std::max_align_t));
+    pool.deallocate(aligned, 64u, 2u * alignof(std::max_align_t));
+
+    ASSERT_EQ(pool.size(), 3u);
+
+    void *other = pool.allocate(64u, alignof(std::max_align_t));
+
+    ASSERT_EQ(other, block);
+    ASSERT_EQ(pool.size(), 2u);
+
+    pool.deallocate(other, 64u, alignof(std::max_align_t));
+    pool.release();
+
+    ASSERT_EQ(pool.size(), 0u);
+}
+
+TEST(PagePool, Alignment) {
+    entt::page_pool pool{};
+    constexpr std::size_t alignment = 4u * alignof(std::max_align_t);
+    void *block = pool.allocate(16u, alignment);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignment, 0u);
+
+    pool.deallocate(block, 16u, alignment);
+}
+
+TEST(PagePoolAllocator, Functionalities) {
+    const entt::page_pool_allocator<int> allocator{};
+    const entt::page_pool_allocator<char> rebound{allocator};
+    const entt::page_pool_allocator<int> other{};
+
+    ASSERT_NE(allocator.resource(), nullptr);
+    ASSERT_EQ(allocator.resource(), rebound.resource());
+    ASSERT_TRUE(allocator == rebound);
+    ASSERT_FALSE(allocator != rebound);
+    ASSERT_FALSE(allocator == other);
+    ASSERT_TRUE(allocator != other);
+
+    entt::page_pool_allocator<int> copy{other};
+    entt::page_pool_allocator<int> moved{std::move(copy)};
+
+    // moving an allocator is the same as copying it
+    ASSERT_EQ(copy, other);
+    ASSERT_EQ(moved, other);
+
+    copy = allocator;
+
+    ASSERT_EQ(copy, allocator);
+}
+
+TEST(PagePoolAllocator, Recycle) {
+    auto pool = std::make_shared<entt::page_pool>();
+    std::vector<int, entt::page_pool_allocator<int>> vec{entt::page_pool_allocator<int>{pool}};
+
+    vec.reserve(4u);
+    const auto *data = vec.data();
+    vec = decltype(vec){entt::page_pool_allocator<int>{pool}};
+
+    ASSERT_EQ(pool->size(), 1u);
+
+    std::vector<int, entt::page_pool_allocator<int>> other{entt::page_pool_allocator<int>{pool}};
+    other.reserve(4u);
+
+    ASSERT_EQ(other.data(), data);
+    ASSERT_EQ(pool->size(), 0u);
+}
+
+TEST(PagePoolAllocator, Registry) {
+    using allocator_type = entt::page_pool_allocator<entt::entity>;
+    entt::basic_registry<entt::entity, allocator_type> registry{};
+    const auto pool = registry.get_allocator().resource();
+    const auto entity = registry.create(entt::entity{ENTT_SPARSE_PAGE * 2u});
+
+    registry.emplace<int>(entity, 1);
+
+    ASSERT_EQ(registry.storage<int>().get_allocator(), registry.get_allocator());
+
+    registry.storage<int>().shrink_to_fit();
+    registry.erase<int>(entity);
+    registry.storage<int>().shrink_to_fit();
+
+    const auto cached = pool->size();
+
+    ASSERT_NE(cached, 0u);
+
+    registry.emplace<char>(entity, 'c');
+
+    ASSERT_LT(pool->size(), cached);
+    ASSERT_EQ(registry.get<char>(entity), 'c');
+}
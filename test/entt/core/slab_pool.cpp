@@ -0,0 +1,166 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/slab_pool.hpp>
+#include <entt/process/process.hpp>
+#include <entt/process/scheduler.hpp>
+#include "../../common/config.h"
+
+TEST(SlabPool, Functionalities) {
+    entt::slab_pool pool{4u};
+
+    ASSERT_EQ(pool.size(), 0u);
+    ASSERT_EQ(pool.chunks(), 0u);
+
+    void *first = pool.allocate(sizeof(int), alignof(int));
+    void *second = pool.allocate(sizeof(int), alignof(int));
+
+    ASSERT_NE(first, second);
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.chunks(), 1u);
+
+    pool.deallocate(first, sizeof(int), alignof(int));
+
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_EQ(pool.allocate(sizeof(int), alignof(int)), first);
+
+    pool.deallocate(first, sizeof(int), alignof(int));
+    pool.deallocate(second, sizeof(int), alignof(int));
+
+    ASSERT_EQ(pool.size(), 0u);
+    ASSERT_EQ(pool.chunks(), 1u);
+}
+
+TEST(SlabPool, Contiguous) {
+    entt::slab_pool pool{4u};
+    std::vector<void *> block{};
+
+    for(std::size_t pos{}; pos < 4u; ++pos) {
+        block.push_back(pool.allocate(16u, 8u));
+    }
+
+    for(std::size_t pos{1u}; pos < block.size(); ++pos) {
+        ASSERT_EQ(static_cast<std::byte *>(block[pos]), static_cast<std::byte *>(block[pos - 1u]) + 16u);
+    }
+
+    ASSERT_EQ(pool.chunks(), 1u);
+
+    block.push_back(pool.allocate(16u, 8u));
+
+    ASSERT_EQ(pool.chunks(), 2u);
+
+    void *other = pool.allocate(32u, 8u);
+
+    ASSERT_EQ(pool.chunks(), 3u);
+    ASSERT_EQ(pool.size(), 6u);
+
+    pool.deallocate(other, 32u, 8u);
+
+    for(auto *elem: block) {
+        pool.deallocate(elem, 16u, 8u);
+    }
+
+    ASSERT_EQ(pool.size(), 0u);
+}
+
+TEST(SlabPool, Alignment) {
+    entt::slab_pool pool{};
+    constexpr std::size_t alignment = 4u * alignof(std::max_align_t);
+    void *first = pool.allocate(8u, alignment);
+    void *second = pool.allocate(8u, alignment);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(first) % alignment, 0u);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(second) % alignment, 0u);
+
+    pool.deallocate(first, 8u, alignment);
+    pool.deallocate(second, 8u, alignment);
+}
+
+ENTT_DEBUG_TEST(SlabPoolDeathTest, SlabPool) {
+    entt::slab_pool pool{};
+    int value{};
+
+    ASSERT_DEATH(entt::slab_pool{0u}, "");
+    ASSERT_DEATH(pool.deallocate(&value, sizeof(int), alignof(int)), "");
+}
+
+TEST(SlabPoolAllocator, Functionalities) {
+    const entt::slab_pool_allocator<int> allocator{};
+    const entt::slab_pool_allocator<char> rebound{allocator};
+    const entt::slab_pool_allocator<int> other{};
+
+    ASSERT_NE(allocator.resource(), nullptr);
+    ASSERT_EQ(allocator.resource(), rebound.resource());
+    ASSERT_TRUE(allocator == rebound);
+    ASSERT_FALSE(allocator != rebound);
+    ASSERT_FALSE(allocator == other);
+    ASSERT_TRUE(allocator != other);
+
+    entt::slab_pool_allocator<int> copy{other};
+    entt::slab_pool_allocator<int> moved{std::move(copy)};
+
+    // moving an allocator is the same as copying it
+    ASSERT_EQ(copy, other);
+    ASSERT_EQ(moved, other);
+
+    copy = allocator;
+
+    ASSERT_EQ(copy, allocator);
+}
+
+TEST(SlabPoolAllocator, Shared) {
+    const entt::slab_pool_allocator<int> allocator{};
+    const auto pool = allocator.resource();
+
+    {
+        auto first = std::allocate_shared<int>(allocator, 1);
+        auto second = std::allocate_shared<int>(allocator, 2);
+
+        ASSERT_EQ(pool->size(), 2u);
+        ASSERT_EQ(*first + *second, 3);
+    }
+
+    ASSERT_EQ(pool->size(), 0u);
+
+    std::vector<int, entt::slab_pool_allocator<int>> vec{allocator};
+    vec.assign(8u, 0);
+
+    ASSERT_EQ(pool->size(), 0u);
+}
+
+TEST(SlabPoolAllocator, Scheduler) {
+    using allocator_type = entt::slab_pool_allocator<void>;
+    entt::basic_scheduler<std::uint32_t, allocator_type> scheduler{};
+    const auto pool = scheduler.get_allocator().resource();
+    int counter{};
+
+    for(int pos{}; pos < 3; ++pos) {
+        scheduler
+            .attach([&counter](auto &proc, std::uint32_t, void *) {
+                ++counter;
+                proc.succeed();
+            })
+            .then([&counter](auto &proc, std::uint32_t, void *) {
+                counter += 10;
+                proc.succeed();
+            });
+    }
+
+    ASSERT_EQ(pool->size(), 6u);
+    ASSERT_EQ(scheduler.size(), 3u);
+
+    scheduler.update(0u);
+
+    ASSERT_EQ(counter, 3);
+    ASSERT_EQ(pool->size(), 3u);
+    ASSERT_EQ(scheduler.size(), 3u);
+
+    scheduler.update(0u);
+
+    ASSERT_EQ(counter, 33);
+    ASSERT_EQ(pool->size(), 0u);
+    ASSERT_TRUE(scheduler.empty());
+}
@@ -0,0 +1,215 @@
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/bit.hpp>
+#include <entt/entity/archetype.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include "../../common/boxed_type.h"
+#include "../../common/config.h"
+#include "../../common/linter.hpp"
+#include "../../common/throwing_type.hpp"
+
+struct position {
+    float x;
+    float y;
+};
+
+TEST(Archetype, Functionalities) {
+    entt::archetype<position, test::boxed_int, std::string> archetype{};
+    entt::registry registry{};
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = archetype.get_allocator());
+    ASSERT_TRUE(archetype.empty());
+    ASSERT_EQ(archetype.size(), 0u);
+    ASSERT_EQ(archetype.capacity(), 0u);
+    ASSERT_FALSE(archetype.contains(entity));
+
+    auto [pos, value, str] = archetype.emplace(entity, position{1.f, 2.f}, 3, "foo");
+
+    ASSERT_FALSE(archetype.empty());
+    ASSERT_EQ(archetype.size(), 1u);
+    ASSERT_EQ(archetype.capacity(), archetype.chunk_size);
+    ASSERT_TRUE(archetype.contains(entity));
+    ASSERT_FALSE(archetype.contains(other));
+
+    ASSERT_EQ(pos.x, 1.f);
+    ASSERT_EQ(pos.y, 2.f);
+    ASSERT_EQ(value.value, 3);
+    ASSERT_EQ(str, "foo");
+
+    archetype.emplace(other);
+
+    ASSERT_EQ(archetype.index(other), 1u);
+    ASSERT_EQ(archetype.get<test::boxed_int>(other).value, 0);
+    ASSERT_TRUE(archetype.get<std::string>(other).empty());
+
+    archetype.get<test::boxed_int>(other).value = 4;
+    const auto &cref = std::as_const(archetype);
+
+    ASSERT_EQ(cref.get<test::boxed_int>(other).value, 4);
+    ASSERT_EQ(std::get<1u>(cref.get<position, std::string>(entity)), "foo");
+    ASSERT_EQ(cref.data()[0u], entity);
+    ASSERT_EQ(cref.data()[1u], other);
+
+    ASSERT_TRUE(archetype.remove(entity));
+    ASSERT_FALSE(archetype.remove(entity));
+
+    ASSERT_EQ(archetype.size(), 1u);
+    ASSERT_EQ(archetype.index(other), 0u);
+    ASSERT_EQ(archetype.get<test::boxed_int>(other).value, 4);
+
+    archetype.clear();
+
+    ASSERT_TRUE(archetype.empty());
+    ASSERT_EQ(archetype.capacity(), archetype.chunk_size);
+
+    archetype.shrink_to_fit();
+
+    ASSERT_EQ(archetype.capacity(), 0u);
+}
+
+TEST(Archetype, ChunkSize) {
+    using archetype_type = entt::archetype<position, test::boxed_int>;
+
+    ASSERT_TRUE(entt::has_single_bit(archetype_type::chunk_size));
+    ASSERT_LE(archetype_type::chunk_size * (sizeof(position) + sizeof(test::boxed_int)), archetype_type::chunk_bytes);
+    ASSERT_GT(archetype_type::chunk_size * 2u * (sizeof(position) + sizeof(test::boxed_int)), archetype_type::chunk_bytes);
+
+    // rows larger than a chunk still fit one entity per chunk
+    ASSERT_EQ((entt::archetype<std::array<char, 32768u>>::chunk_size), 1u);
+}
+
+TEST(Archetype, Erase) {
+    entt::archetype<test::boxed_int, test::boxed_char> archetype{};
+    entt::registry registry{};
+    std::vector<entt::entity> entity(3u);
+
+    registry.create(entity.begin(), entity.end());
+
+    for(std::size_t pos{}; pos < entity.size(); ++pos) {
+        archetype.emplace(entity[pos], static_cast<int>(pos), static_cast<char>('a' + pos));
+    }
+
+    archetype.erase(entity[0u]);
+
+    ASSERT_EQ(archetype.size(), 2u);
+    ASSERT_FALSE(archetype.contains(entity[0u]));
+    ASSERT_EQ(archetype.index(entity[2u]), 0u);
+    ASSERT_EQ(archetype.get<test::boxed_int>(entity[2u]).value, 2);
+    ASSERT_EQ(archetype.get<test::boxed_char>(entity[2u]).value, 'c');
+
+    archetype.erase(entity[1u]);
+
+    ASSERT_EQ(archetype.size(), 1u);
+    ASSERT_EQ(archetype.get<test::boxed_int>(entity[2u]).value, 2);
+}
+
+TEST(Archetype, Each) {
+    using archetype_type = entt::archetype<test::boxed_int, position>;
+
+    archetype_type archetype{};
+    entt::registry registry{};
+    std::vector<entt::entity> entity(archetype_type::chunk_size * 2u + 3u);
+
+    registry.create(entity.begin(), entity.end());
+    archetype.reserve(entity.size());
+
+    ASSERT_EQ(archetype.capacity(), archetype_type::chunk_size * 3u);
+
+    for(auto entt: entity) {
+        archetype.emplace(entt, static_cast<int>(entt::to_entity(entt)), position{});
+    }
+
+    std::size_t chunks{};
+    std::size_t count{};
+
+    archetype.each_chunk([&](const entt::entity *entt, const std::size_t len, test::boxed_int *value, position *pos) {
+        ASSERT_EQ(len, (chunks == 2u) ? 3u : archetype_type::chunk_size);
+
+        for(std::size_t elem{}; elem < len; ++elem, ++count) {
+            ASSERT_EQ(entt[elem], entity[count]);
+            ASSERT_EQ(value[elem].value, static_cast<int>(entt::to_entity(entity[count])));
+            pos[elem].x = 1.f;
+        }
+
+        ++chunks;
+    });
+
+    ASSERT_EQ(chunks, 3u);
+    ASSERT_EQ(count, entity.size());
+
+    count = 0u;
+
+    archetype.each([&](const entt::entity entt, test::boxed_int &value, const position &pos) {
+        ASSERT_EQ(entt, entity[count++]);
+        ASSERT_EQ(value.value, static_cast<int>(entt::to_entity(entt)));
+        ASSERT_EQ(pos.x, 1.f);
+    });
+
+    ASSERT_EQ(count, entity.size());
+
+    archetype.clear();
+    archetype.each_chunk([](auto &&...) { FAIL(); });
+}
+
+TEST(Archetype, Move) {
+    entt::archetype<std::string> archetype{};
+    entt::registry registry{};
+    const auto entity = registry.create();
+
+    archetype.emplace(entity, "foo");
+
+    entt::archetype<std::string> other{std::move(archetype)};
+
+    test::is_initialized(archetype);
+
+    ASSERT_TRUE(archetype.empty());
+    ASSERT_EQ(archetype.capacity(), 0u);
+    ASSERT_EQ(other.get<std::string>(entity), "foo");
+
+    archetype = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(archetype.get<std::string>(entity), "foo");
+
+    other.emplace(registry.create(), "bar");
+    archetype.swap(other);
+
+    ASSERT_FALSE(archetype.contains(entity));
+    ASSERT_TRUE(other.contains(entity));
+}
+
+ENTT_DEBUG_TEST(ArchetypeDeathTest, Emplace) {
+    entt::archetype<test::boxed_int> archetype{};
+    const auto entity = entt::registry{}.create();
+
+    archetype.emplace(entity);
+
+    ASSERT_DEATH(archetype.emplace(entity), "");
+}
+
+TEST(Archetype, ThrowingType) {
+    entt::archetype<test::boxed_int, test::throwing_type> archetype{};
+    entt::registry registry{};
+    const auto entity = registry.create();
+    const test::throwing_type value{true};
+
+    ASSERT_THROW(archetype.emplace(entity, 1, value), test::throwing_type_exception);
+    ASSERT_TRUE(archetype.empty());
+    ASSERT_FALSE(archetype.contains(entity));
+
+    archetype.emplace(entity, 1, test::throwing_type{false});
+
+    ASSERT_EQ(archetype.size(), 1u);
+    ASSERT_EQ(archetype.get<test::boxed_int>(entity).value, 1);
+}
@@ -0,0 +1,143 @@
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+
+struct position {
+    int value{};
+};
+
+struct velocity {
+    int value{};
+};
+
+template<>
+struct entt::storage_type<position> {
+    using type = entt::sigh_mixin<entt::bitset_mixin<entt::storage<position>>>;
+};
+
+template<>
+struct entt::storage_type<velocity> {
+    using type = entt::sigh_mixin<entt::bitset_mixin<entt::storage<velocity>>>;
+};
+
+template<typename Type, typename... Other>
+std::vector<entt::entity> common(const Type &pool, const Other &...other) {
+    std::vector<entt::entity> result{};
+    pool.intersect([&result](const entt::entity entt) { result.push_back(entt); }, other...);
+    return result;
+}
+
+TEST(BitsetMixin, Functionalities) {
+    entt::bitset_mixin<entt::storage<position>> pool;
+
+    ASSERT_EQ(pool.levels_count(), 4u);
+    ASSERT_EQ(pool.word(3u, 0u), 0u);
+    ASSERT_TRUE(common(pool).empty());
+
+    pool.emplace(entt::entity{3});
+    pool.emplace(entt::entity{64});
+    pool.emplace(entt::entity{4096});
+
+    ASSERT_EQ(pool.word(0u, 0u), std::uint64_t{1u} << 3u);
+    ASSERT_EQ(pool.word(0u, 1u), 1u);
+    ASSERT_EQ(pool.word(0u, 64u), 1u);
+    ASSERT_EQ(pool.word(1u, 0u), 3u);
+    ASSERT_EQ(pool.word(1u, 1u), 1u);
+    ASSERT_EQ(pool.word(2u, 0u), 3u);
+    ASSERT_EQ(pool.word(3u, 0u), 1u);
+    ASSERT_EQ(pool.word(0u, 1024u), 0u);
+
+    ASSERT_EQ(common(pool), (std::vector<entt::entity>{entt::entity{3}, entt::entity{64}, entt::entity{4096}}));
+
+    pool.erase(entt::entity{4096});
+
+    ASSERT_EQ(pool.word(0u, 64u), 0u);
+    ASSERT_EQ(pool.word(1u, 1u), 0u);
+    ASSERT_EQ(pool.word(2u, 0u), 1u);
+
+    pool.erase(entt::entity{64});
+
+    ASSERT_EQ(pool.word(1u, 0u), 1u);
+
+    pool.clear();
+
+    ASSERT_EQ(pool.word(0u, 0u), 0u);
+    ASSERT_EQ(pool.word(3u, 0u), 0u);
+    ASSERT_TRUE(common(pool).empty());
+}
+
+TEST(BitsetMixin, Intersect) {
+    entt::registry registry;
+    std::vector<entt::entity> expected{};
+
+    for(int pos{}; pos < 1000; ++pos) {
+        const auto entity = registry.create();
+
+        if(pos % 3 == 0) {
+            registry.emplace<position>(entity, pos);
+        }
+
+        if(pos % 5 == 0) {
+            registry.emplace<velocity>(entity, pos);
+        }
+
+        if(pos % 15 == 0) {
+            expected.push_back(entity);
+        }
+    }
+
+    const auto &lhs = registry.storage<position>();
+    const auto &rhs = registry.storage<velocity>();
+
+    ASSERT_EQ(common(lhs, rhs), expected);
+    ASSERT_EQ(common(rhs, lhs), expected);
+
+    registry.destroy(expected.front());
+    expected.erase(expected.begin());
+
+    // versions come from the storage that drives the iteration
+    const auto entity = registry.create();
+    registry.emplace<position>(entity);
+    registry.emplace<velocity>(entity);
+    expected.insert(expected.begin(), entity);
+
+    ASSERT_EQ(common(lhs, rhs), expected);
+
+    lhs.intersect([&registry](const entt::entity entt) { registry.remove<velocity>(entt); }, rhs);
+
+    ASSERT_TRUE(common(lhs, rhs).empty());
+}
+
+TEST(BitsetMixin, Insert) {
+    entt::bitset_mixin<entt::storage<position>> pool;
+    const std::array entity{entt::entity{1}, entt::entity{2}, entt::entity{128}};
+
+    pool.insert(entity.begin(), entity.end(), position{2});
+
+    ASSERT_EQ(common(pool), (std::vector<entt::entity>{entity.begin(), entity.end()}));
+}
+
+TEST(BitsetMixin, Move) {
+    entt::bitset_mixin<entt::storage<position>> pool;
+    pool.emplace(entt::entity{2});
+
+    entt::bitset_mixin<entt::storage<position>> other{std::move(pool)};
+
+    ASSERT_EQ(other.word(0u, 0u), 4u);
+    ASSERT_EQ(common(other), (std::vector<entt::entity>{entt::entity{2}}));
+
+    pool = std::move(other);
+
+    ASSERT_EQ(common(pool), (std::vector<entt::entity>{entt::entity{2}}));
+
+    pool.swap(other);
+
+    ASSERT_TRUE(common(pool).empty());
+    ASSERT_EQ(common(other), (std::vector<entt::entity>{entt::entity{2}}));
+}
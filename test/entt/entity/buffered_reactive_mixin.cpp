@@ -0,0 +1,173 @@
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/entity/mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include "../../common/config.h"
+#include "../../common/empty.h"
+#include "../../common/linter.hpp"
+
+using buffered_storage = entt::buffered_reactive_mixin<entt::storage<void>>;
+
+void emplace_if_odd(buffered_storage::buffer_type &buffer, const entt::registry &registry, const entt::entity entity) {
+    if((registry.get<int>(entity) % 2) != 0 && !buffer.contains(entity)) {
+        buffer.emplace(entity);
+    }
+}
+
+TEST(BufferedReactiveMixin, Functionalities) {
+    entt::registry registry;
+    buffered_storage pool;
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+
+    pool.bind(registry);
+    pool.on_construct<int>().on_update<int>();
+
+    ASSERT_TRUE(pool);
+    ASSERT_TRUE(pool.empty());
+    ASSERT_TRUE(pool.pending().empty());
+
+    registry.emplace<int>(entity[0u]);
+    registry.emplace<int>(entity[1u]);
+    registry.patch<int>(entity[0u]);
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.pending().size(), 2u);
+
+    pool.swap_buffers();
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_TRUE(pool.contains(entity[0u]));
+    ASSERT_TRUE(pool.contains(entity[1u]));
+    ASSERT_TRUE(pool.pending().empty());
+
+    registry.emplace<int>(entity[2u]);
+    registry.patch<int>(entity[0u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.pending().size(), 2u);
+
+    pool.swap_buffers();
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_TRUE(pool.contains(entity[0u]));
+    ASSERT_FALSE(pool.contains(entity[1u]));
+    ASSERT_TRUE(pool.contains(entity[2u]));
+
+    pool.swap_buffers();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_TRUE(pool.pending().empty());
+}
+
+TEST(BufferedReactiveMixin, Remove) {
+    entt::registry registry;
+    buffered_storage pool;
+    const std::array entity{registry.create(), registry.create()};
+
+    pool.bind(registry);
+    pool.on_update<int>();
+
+    registry.emplace<int>(entity[0u]);
+    registry.emplace<int>(entity[1u]);
+    registry.patch<int>(entity[0u]);
+    pool.swap_buffers();
+    registry.patch<int>(entity[0u]);
+    registry.patch<int>(entity[1u]);
+
+    pool.remove(entity[0u]);
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_FALSE(pool.pending().contains(entity[0u]));
+    ASSERT_TRUE(pool.pending().contains(entity[1u]));
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.pending().empty());
+}
+
+TEST(BufferedReactiveMixin, Custom) {
+    entt::registry registry;
+    buffered_storage pool;
+    const std::array entity{registry.create(), registry.create()};
+
+    pool.bind(registry);
+    pool.on_update<int, &emplace_if_odd>();
+
+    registry.emplace<int>(entity[0u], 1);
+    registry.emplace<int>(entity[1u], 2);
+    registry.patch<int>(entity[0u]);
+    registry.patch<int>(entity[1u]);
+    pool.swap_buffers();
+
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_TRUE(pool.contains(entity[0u]));
+}
+
+TEST(BufferedReactiveMixin, View) {
+    entt::registry registry;
+    buffered_storage storage;
+    const std::array entity{registry.create(), registry.create()};
+
+    storage.bind(registry);
+    storage.on_construct<test::empty>();
+
+    registry.emplace<test::empty>(entity[0u]);
+    registry.emplace<test::empty>(entity[1u]);
+    registry.emplace<int>(entity[1u]);
+
+    ASSERT_FALSE(storage.view<int>().contains(entity[1u]));
+
+    storage.swap_buffers();
+
+    const auto view = storage.view<int>();
+
+    ASSERT_FALSE(view.contains(entity[0u]));
+    ASSERT_TRUE(view.contains(entity[1u]));
+
+    registry.destroy(entity[1u]);
+
+    ASSERT_TRUE(storage.contains(entity[1u]));
+    ASSERT_EQ(std::as_const(storage).view<test::empty>(entt::exclude<int>).front(), entity[0u]);
+}
+
+TEST(BufferedReactiveMixin, Move) {
+    entt::registry registry;
+    buffered_storage pool;
+    const std::array entity{registry.create(), registry.create()};
+
+    static_assert(std::is_move_constructible_v<decltype(pool)>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<decltype(pool)>, "Move assignable type required");
+
+    pool.bind(registry);
+    pool.on_construct<int>();
+    registry.emplace<int>(entity[0u]);
+    pool.swap_buffers();
+    registry.emplace<int>(entity[1u]);
+
+    buffered_storage other{std::move(pool)};
+
+    test::is_initialized(pool);
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_TRUE(other.contains(entity[0u]));
+    ASSERT_TRUE(other.pending().contains(entity[1u]));
+
+    pool = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_TRUE(pool.contains(entity[0u]));
+    ASSERT_TRUE(pool.pending().contains(entity[1u]));
+
+    pool.reset();
+}
+
+ENTT_DEBUG_TEST(BufferedReactiveMixinDeathTest, Registry) {
+    buffered_storage pool;
+
+    ASSERT_FALSE(pool);
+    ASSERT_DEATH([[maybe_unused]] const auto &registry = pool.registry(), "");
+    ASSERT_DEATH(pool.on_construct<int>(), "");
+}
@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/entity/cached_query.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include "../../common/boxed_type.h"
+#include "../../common/empty.h"
+
+TEST(CachedQuery, Functionalities) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+
+    registry.emplace<int>(entity[0u], 1);
+    registry.emplace<char>(entity[0u], 'a');
+    registry.emplace<int>(entity[1u], 2);
+
+    entt::cached_query<entt::get_t<int, const char>> query{registry};
+
+    testing::StaticAssertTypeEq<decltype(query.get<int>(entity[0u])), int &>();
+    testing::StaticAssertTypeEq<decltype(query.get<const char>(entity[0u])), const char &>();
+
+    ASSERT_EQ(query.size(), 1u);
+    ASSERT_FALSE(query.empty());
+    ASSERT_TRUE(query.contains(entity[0u]));
+    ASSERT_FALSE(query.contains(entity[1u]));
+    ASSERT_EQ(query.front(), entity[0u]);
+    ASSERT_EQ(query.back(), entity[0u]);
+    ASSERT_EQ(query[0u], entity[0u]);
+    ASSERT_EQ(*query.find(entity[0u]), entity[0u]);
+    ASSERT_EQ(query.find(entity[1u]), query.end());
+    ASSERT_EQ(query.storage<int>(), &registry.storage<int>());
+    ASSERT_EQ(query.storage<1u>(), &registry.storage<char>());
+
+    registry.emplace<char>(entity[1u], 'b');
+    registry.emplace<char>(entity[2u], 'c');
+
+    ASSERT_EQ(query.size(), 2u);
+    ASSERT_TRUE(query.contains(entity[1u]));
+    ASSERT_FALSE(query.contains(entity[2u]));
+
+    registry.erase<int>(entity[0u]);
+
+    ASSERT_EQ(query.size(), 1u);
+    ASSERT_FALSE(query.contains(entity[0u]));
+    ASSERT_EQ(query.get<int>(entity[1u]), 2);
+
+    registry.destroy(entity[1u]);
+
+    ASSERT_TRUE(query.empty());
+    ASSERT_EQ(query.front(), static_cast<entt::entity>(entt::null));
+    ASSERT_EQ(query.back(), static_cast<entt::entity>(entt::null));
+
+    query.shrink_to_fit();
+
+    ASSERT_EQ(query.handle().capacity(), 0u);
+}
+
+TEST(CachedQuery, Each) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+
+    registry.insert<int>(entity.begin(), entity.end(), 1);
+    registry.insert<test::empty>(entity.begin(), entity.end());
+    registry.erase<test::empty>(entity[1u]);
+
+    entt::cached_query<entt::get_t<int, test::empty>> query{registry};
+    std::size_t count{};
+
+    query.each([&count](int &value) {
+        value += 1;
+        ++count;
+    });
+
+    query.each([&query, &count](const auto entt, const int &value) {
+        ASSERT_TRUE(query.contains(entt));
+        ASSERT_EQ(value, 2);
+        ++count;
+    });
+
+    for(auto [entt, value]: query.each()) {
+        testing::StaticAssertTypeEq<decltype(value), int &>();
+        ASSERT_TRUE(query.contains(entt));
+        ++count;
+    }
+
+    ASSERT_EQ(count, 6u);
+    ASSERT_EQ(registry.get<int>(entity[1u]), 1);
+}
+
+TEST(CachedQuery, Exclude) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create()};
+
+    registry.insert<test::boxed_int>(entity.begin(), entity.end());
+    registry.emplace<char>(entity[0u]);
+
+    entt::cached_query<entt::get_t<test::boxed_int>, entt::exclude_t<char>> query{registry};
+
+    ASSERT_EQ(query.size(), 1u);
+    ASSERT_TRUE(query.contains(entity[1u]));
+    ASSERT_EQ(query.storage<char>(), &registry.storage<char>());
+
+    registry.erase<char>(entity[0u]);
+    registry.emplace<char>(entity[1u]);
+
+    ASSERT_EQ(query.size(), 1u);
+    ASSERT_TRUE(query.contains(entity[0u]));
+
+    registry.clear<char>();
+
+    ASSERT_EQ(query.size(), 2u);
+}
+
+TEST(CachedQuery, Lifetime) {
+    entt::registry registry;
+    const auto entity = registry.create();
+
+    registry.emplace<int>(entity);
+
+    {
+        auto query = std::make_unique<entt::cached_query<entt::get_t<int>>>(registry);
+
+        ASSERT_EQ(query->size(), 1u);
+        ASSERT_FALSE(registry.on_construct<int>().empty());
+    }
+
+    // destroyed queries don't listen to the storage anymore
+    ASSERT_TRUE(registry.on_construct<int>().empty());
+    ASSERT_TRUE(registry.on_destroy<int>().empty());
+
+    registry.emplace<int>(registry.create());
+
+    const entt::cached_query<entt::get_t<int>> query{registry.storage<int>()};
+
+    ASSERT_EQ(query.size(), 2u);
+}
+
+TEST(CachedQuery, SortAs) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+
+    registry.insert<int>(entity.begin(), entity.end());
+
+    entt::cached_query<entt::get_t<int>> query{registry};
+    auto &&storage = registry.storage<char>();
+
+    storage.emplace(entity[1u]);
+    storage.emplace(entity[2u]);
+    storage.emplace(entity[0u]);
+
+    const entt::sparse_set &base = storage;
+    query.sort_as(base.begin(), base.end());
+
+    ASSERT_TRUE(std::equal(query.begin(), query.end(), base.begin()));
+}
@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include "../../common/boxed_type.h"
+#include "../../common/linter.hpp"
+#include "../../common/pointer_stable.h"
+
+struct transform {
+    int value;
+};
+
+template<>
+struct entt::storage_type<transform> {
+    using type = entt::sigh_mixin<entt::changed_mixin<entt::storage<transform>>>;
+};
+
+template<typename Type>
+std::vector<entt::entity> changed_since(const Type &pool, const typename Type::tick_type tick) {
+    std::vector<entt::entity> result{};
+    pool.changed_since(tick, [&result](const entt::entity entt) { result.push_back(entt); });
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+TEST(ChangedMixin, Functionalities) {
+    entt::changed_mixin<entt::storage<test::boxed_int>> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}};
+
+    ASSERT_EQ(pool.tick(), 0u);
+    ASSERT_TRUE(changed_since(pool, 0u).empty());
+
+    pool.emplace(entity[0u], 1);
+    pool.emplace(entity[1u], 2);
+
+    ASSERT_EQ(pool.changed(entity[0u]), 0u);
+    ASSERT_EQ(changed_since(pool, 0u), (std::vector{entity[0u], entity[1u]}));
+    ASSERT_EQ(pool.advance(), 1u);
+    ASSERT_EQ(pool.tick(), 1u);
+    ASSERT_TRUE(changed_since(pool, 1u).empty());
+
+    pool.patch(entity[1u], [](auto &elem) { ++elem.value; });
+    pool.emplace(entity[2u], 4);
+
+    ASSERT_EQ(pool.changed(entity[0u]), 0u);
+    ASSERT_EQ(pool.changed(entity[1u]), 1u);
+    ASSERT_EQ(changed_since(pool, 1u), (std::vector{entity[1u], entity[2u]}));
+    ASSERT_EQ(changed_since(pool, 0u), (std::vector{entity[0u], entity[1u], entity[2u]}));
+
+    pool.advance();
+    pool.patch(entity[0u]);
+    pool.erase(entity[0u]);
+
+    ASSERT_TRUE(changed_since(pool, 2u).empty());
+    ASSERT_EQ(pool.changed(entity[2u]), 1u);
+    ASSERT_EQ(changed_since(pool, 1u), (std::vector{entity[1u], entity[2u]}));
+
+    pool.clear();
+
+    ASSERT_TRUE(changed_since(pool, 0u).empty());
+}
+
+TEST(ChangedMixin, Insert) {
+    entt::changed_mixin<entt::storage<test::boxed_int>> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+    const std::array value{test::boxed_int{1}, test::boxed_int{2}};
+
+    pool.advance();
+    pool.insert(entity.begin(), entity.end(), value.begin());
+
+    ASSERT_EQ(pool.changed(entity[0u]), 1u);
+    ASSERT_EQ(pool.changed(entity[1u]), 1u);
+
+    pool.advance();
+    pool.remove(entity.begin(), entity.begin() + 1u);
+    pool.insert(entity.begin(), entity.begin() + 1u);
+
+    ASSERT_EQ(pool.changed(entity[1u]), 1u);
+    ASSERT_EQ(changed_since(pool, 2u), (std::vector{entity[0u]}));
+}
+
+TEST(ChangedMixin, Sort) {
+    entt::changed_mixin<entt::storage<test::boxed_int>> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}};
+
+    pool.emplace(entity[0u], 3);
+    pool.advance();
+    pool.emplace(entity[1u], 2);
+    pool.advance();
+    pool.emplace(entity[2u], 1);
+
+    pool.sort([&pool](const auto lhs, const auto rhs) { return pool.get(lhs) < pool.get(rhs); });
+
+    ASSERT_EQ(pool.changed(entity[0u]), 0u);
+    ASSERT_EQ(pool.changed(entity[1u]), 1u);
+    ASSERT_EQ(pool.changed(entity[2u]), 2u);
+    ASSERT_EQ(changed_since(pool, 1u), (std::vector{entity[1u], entity[2u]}));
+}
+
+TEST(ChangedMixin, InPlaceDelete) {
+    entt::changed_mixin<entt::storage<test::pointer_stable>> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}};
+
+    pool.emplace(entity[0u], 1);
+    pool.advance();
+    pool.emplace(entity[1u], 2);
+    pool.erase(entity[0u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(changed_since(pool, 0u), (std::vector{entity[1u]}));
+
+    pool.advance();
+    pool.emplace(entity[2u], 3);
+
+    ASSERT_EQ(pool.index(entity[2u]), 0u);
+    ASSERT_EQ(changed_since(pool, 2u), (std::vector{entity[2u]}));
+
+    pool.erase(entity[2u]);
+    pool.compact();
+
+    ASSERT_EQ(pool.changed(entity[1u]), 1u);
+    ASSERT_EQ(changed_since(pool, 0u), (std::vector{entity[1u]}));
+}
+
+TEST(ChangedMixin, Move) {
+    entt::changed_mixin<entt::storage<test::boxed_int>> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+
+    static_assert(std::is_move_constructible_v<decltype(pool)>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<decltype(pool)>, "Move assignable type required");
+
+    pool.advance();
+    pool.emplace(entity[0u], 1);
+
+    entt::changed_mixin<entt::storage<test::boxed_int>> other{std::move(pool)};
+
+    test::is_initialized(pool);
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.tick(), 0u);
+    ASSERT_EQ(other.tick(), 1u);
+    ASSERT_EQ(other.changed(entity[0u]), 1u);
+
+    pool = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_EQ(pool.tick(), 1u);
+    ASSERT_EQ(pool.changed(entity[0u]), 1u);
+
+    other.emplace(entity[1u], 2);
+    pool.swap(other);
+
+    ASSERT_EQ(pool.tick(), 0u);
+    ASSERT_EQ(changed_since(pool, 0u), (std::vector{entity[1u]}));
+    ASSERT_EQ(changed_since(other, 1u), (std::vector{entity[0u]}));
+}
+
+TEST(ChangedMixin, DeepCopyFrom) {
+    entt::changed_mixin<entt::storage<test::boxed_int>> pool;
+    entt::changed_mixin<entt::storage<test::boxed_int>> other;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+
+    pool.emplace(entity[0u], 1);
+    pool.advance();
+    pool.emplace(entity[1u], 2);
+
+    other.emplace(entity[1u], 3);
+    other.deep_copy_from(pool);
+
+    ASSERT_EQ(other.tick(), 1u);
+    ASSERT_EQ(other.get(entity[1u]), test::boxed_int{2});
+    ASSERT_EQ(other.changed(entity[0u]), 0u);
+    ASSERT_EQ(changed_since(other, 1u), (std::vector{entity[1u]}));
+
+    pool.advance();
+    pool.patch(entity[0u]);
+
+    ASSERT_EQ(changed_since(other, 1u), (std::vector{entity[1u]}));
+}
+
+TEST(ChangedMixin, Registry) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+    auto &&storage = registry.storage<transform>();
+
+    registry.emplace<transform>(entity[0u], 1);
+    registry.emplace<transform>(entity[1u], 2);
+    registry.emplace<transform>(entity[2u], 3);
+
+    const auto tick = storage.advance();
+
+    ASSERT_TRUE(changed_since(storage, tick).empty());
+
+    registry.patch<transform>(entity[0u], [](auto &elem) { elem.value = 4; });
+    registry.replace<transform>(entity[2u], 5);
+
+    ASSERT_EQ(changed_since(storage, tick), (std::vector{entity[0u], entity[2u]}));
+
+    registry.destroy(entity[0u]);
+    registry.emplace_or_replace<transform>(entity[1u], 6);
+
+    ASSERT_EQ(changed_since(storage, tick), (std::vector{entity[1u], entity[2u]}));
+
+    registry.clear();
+
+    ASSERT_TRUE(changed_since(storage, 0u).empty());
+}
@@ -0,0 +1,164 @@
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include "../../common/boxed_type.h"
+#include "../../common/linter.hpp"
+#include "../../common/pointer_stable.h"
+
+struct health {
+    int value;
+};
+
+struct health_hash {
+    [[nodiscard]] std::size_t operator()(const health &elem) const noexcept {
+        return static_cast<std::size_t>(elem.value);
+    }
+};
+
+struct boxed_hash {
+    template<typename Type>
+    [[nodiscard]] std::size_t operator()(const Type &elem) const noexcept {
+        return static_cast<std::size_t>(elem.value);
+    }
+};
+
+template<>
+struct entt::storage_type<health> {
+    using type = entt::sigh_mixin<entt::checksum_mixin<entt::storage<health>, health_hash>>;
+};
+
+TEST(ChecksumMixin, Functionalities) {
+    entt::checksum_mixin<entt::storage<test::boxed_int>, boxed_hash> pool;
+    entt::checksum_mixin<entt::storage<test::boxed_int>, boxed_hash> other;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}};
+
+    ASSERT_EQ(pool.checksum(), 0u);
+
+    pool.emplace(entity[0u], 1);
+    pool.emplace(entity[1u], 2);
+
+    other.emplace(entity[1u], 2);
+    other.emplace(entity[0u], 1);
+
+    ASSERT_NE(pool.checksum(), 0u);
+    ASSERT_EQ(pool.checksum(), other.checksum());
+
+    pool.patch(entity[1u], [](auto &elem) { elem.value = 3; });
+
+    ASSERT_NE(pool.checksum(), other.checksum());
+
+    other.patch(entity[1u], [](auto &elem) { elem.value = 3; });
+
+    ASSERT_EQ(pool.checksum(), other.checksum());
+
+    pool.emplace(entity[2u], 4);
+    pool.erase(entity[2u]);
+
+    ASSERT_EQ(pool.checksum(), other.checksum());
+
+    other.erase(entity[0u]);
+    other.emplace(entity[2u], 1);
+
+    ASSERT_NE(pool.checksum(), other.checksum());
+
+    pool.clear();
+
+    ASSERT_EQ(pool.checksum(), 0u);
+}
+
+TEST(ChecksumMixin, Insert) {
+    entt::checksum_mixin<entt::storage<test::boxed_int>, boxed_hash> pool;
+    entt::checksum_mixin<entt::storage<test::boxed_int>, boxed_hash> other;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+    const std::array value{test::boxed_int{1}, test::boxed_int{2}};
+
+    pool.insert(entity.begin(), entity.end(), value.begin());
+    other.emplace(entity[0u], value[0u]);
+    other.emplace(entity[1u], value[1u]);
+
+    ASSERT_EQ(pool.checksum(), other.checksum());
+
+    pool.remove(entity.begin(), entity.end());
+
+    ASSERT_EQ(pool.checksum(), 0u);
+}
+
+TEST(ChecksumMixin, InPlaceDelete) {
+    entt::checksum_mixin<entt::storage<test::pointer_stable>, boxed_hash> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+
+    pool.emplace(entity[0u], 1);
+    const auto checksum = pool.checksum();
+    pool.emplace(entity[1u], 2);
+    pool.erase(entity[1u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.checksum(), checksum);
+
+    pool.compact();
+
+    ASSERT_EQ(pool.checksum(), checksum);
+}
+
+TEST(ChecksumMixin, Move) {
+    entt::checksum_mixin<entt::storage<test::boxed_int>, boxed_hash> pool;
+
+    static_assert(std::is_move_constructible_v<decltype(pool)>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<decltype(pool)>, "Move assignable type required");
+
+    pool.emplace(entt::entity{1}, 1);
+
+    const auto checksum = pool.checksum();
+    entt::checksum_mixin<entt::storage<test::boxed_int>, boxed_hash> other{std::move(pool)};
+
+    test::is_initialized(pool);
+
+    ASSERT_EQ(pool.checksum(), 0u);
+    ASSERT_EQ(other.checksum(), checksum);
+
+    pool = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_EQ(pool.checksum(), checksum);
+    ASSERT_EQ(other.checksum(), 0u);
+
+    other.deep_copy_from(pool);
+
+    ASSERT_EQ(other.checksum(), checksum);
+}
+
+TEST(ChecksumMixin, Registry) {
+    entt::registry registry;
+    entt::registry other;
+    const std::array entity{registry.create(), registry.create()};
+
+    ASSERT_EQ(other.create(), entity[0u]);
+    ASSERT_EQ(other.create(), entity[1u]);
+
+    registry.emplace<health>(entity[0u], 1);
+    registry.emplace<health>(entity[1u], 2);
+    registry.replace<health>(entity[0u], 3);
+
+    other.emplace<health>(entity[1u], 2);
+    other.emplace_or_replace<health>(entity[0u], 3);
+
+    ASSERT_EQ(registry.storage<health>().checksum(), other.storage<health>().checksum());
+
+    registry.destroy(entity[1u]);
+
+    ASSERT_NE(registry.storage<health>().checksum(), other.storage<health>().checksum());
+
+    other.remove<health>(entity[1u]);
+
+    ASSERT_EQ(registry.storage<health>().checksum(), other.storage<health>().checksum());
+
+    registry.clear();
+
+    ASSERT_EQ(registry.storage<health>().checksum(), 0u);
+}
@@ -0,0 +1,155 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/columnar.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/soa_storage.hpp>
+#include <entt/entity/storage.hpp>
+
+struct particle {
+    static constexpr std::size_t page_size = 4u;
+    int value{};
+};
+
+struct stable_particle {
+    static constexpr auto in_place_delete = true;
+    static constexpr std::size_t page_size = 16u;
+    int value{};
+};
+
+struct position {
+    float x{};
+    double y{};
+
+    using soa_columns = entt::value_list<&position::x, &position::y>;
+};
+
+TEST(ColumnarExport, Storage) {
+    entt::storage<particle> pool;
+    entt::columnar_export exporter{pool};
+    std::size_t count{};
+
+    testing::StaticAssertTypeEq<decltype(decltype(exporter)::batch::values), std::tuple<const particle *>>();
+    static_assert(decltype(exporter)::column_count == 1u, "Unexpected number of columns");
+
+    exporter.each([&count](const auto &) { ++count; });
+
+    ASSERT_EQ(count, 0u);
+
+    for(std::size_t pos{}; pos < 10u; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), static_cast<int>(pos));
+    }
+
+    exporter.each([&pool, &count](const auto &batch) {
+        ASSERT_EQ(batch.offset, count * 4u);
+        ASSERT_EQ(batch.length, count == 2u ? 2u : 4u);
+        ASSERT_EQ(batch.null_count, 0u);
+        ASSERT_EQ(batch.validity, nullptr);
+        ASSERT_EQ(batch.entity, pool.data() + batch.offset);
+        ASSERT_EQ(std::get<0>(batch.values), &pool.get(batch.entity[0u]));
+        ASSERT_EQ(std::get<0>(batch.values)[1u].value, static_cast<int>(batch.offset + 1u));
+        ++count;
+    });
+
+    ASSERT_EQ(count, 3u);
+}
+
+TEST(ColumnarExport, InPlaceDelete) {
+    entt::storage<stable_particle> pool;
+    entt::columnar_export exporter{pool};
+    std::vector<const std::uint8_t *> validity{};
+
+    for(std::size_t pos{}; pos < 20u; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), static_cast<int>(pos));
+    }
+
+    pool.erase(entt::entity{1});
+    pool.erase(entt::entity{10});
+
+    exporter.each([&validity](const auto &batch) {
+        validity.push_back(batch.validity);
+
+        if(batch.offset == 0u) {
+            ASSERT_EQ(batch.length, 16u);
+            ASSERT_EQ(batch.null_count, 2u);
+            ASSERT_EQ(batch.entity[1u], static_cast<entt::entity>(entt::tombstone));
+            ASSERT_EQ(batch.validity[0u], 0xFDu);
+            ASSERT_EQ(batch.validity[1u], 0xFBu);
+            ASSERT_EQ(std::get<0>(batch.values)[2u].value, 2);
+        } else {
+            ASSERT_EQ(batch.offset, 16u);
+            ASSERT_EQ(batch.length, 4u);
+            ASSERT_EQ(batch.null_count, 0u);
+        }
+    });
+
+    ASSERT_EQ(validity.size(), 2u);
+    ASSERT_NE(validity[0u], nullptr);
+    ASSERT_EQ(validity[1u], nullptr);
+
+    pool.compact();
+    std::size_t count{};
+
+    exporter.each([&count](const auto &batch) {
+        ASSERT_EQ(batch.validity, nullptr);
+        ASSERT_EQ(batch.null_count, 0u);
+        count += batch.length;
+    });
+
+    ASSERT_EQ(count, 18u);
+}
+
+TEST(ColumnarExport, SoaStorage) {
+    entt::basic_soa_storage<position> pool;
+    entt::columnar_export exporter{pool};
+    std::size_t count{};
+
+    testing::StaticAssertTypeEq<decltype(decltype(exporter)::batch::values), std::tuple<const float *, const double *>>();
+    static_assert(decltype(exporter)::column_count == 2u, "Unexpected number of columns");
+
+    pool.emplace(entt::entity{3}, 1.f, 2.);
+    pool.emplace(entt::entity{1}, 3.f, 4.);
+
+    exporter.each([&pool, &count](const auto &batch) {
+        ASSERT_EQ(batch.offset, 0u);
+        ASSERT_EQ(batch.length, 2u);
+        ASSERT_EQ(batch.validity, nullptr);
+        ASSERT_EQ(batch.entity, pool.data());
+        ASSERT_EQ(std::get<0>(batch.values), pool.column<&position::x>());
+        ASSERT_EQ(std::get<1>(batch.values), pool.column<&position::y>());
+        ASSERT_EQ(std::get<1>(batch.values)[1u], 4.);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 1u);
+}
+
+TEST(ColumnarExport, Registry) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+
+    registry.insert<particle>(entity.begin(), entity.end(), particle{2});
+    registry.insert<position>(entity.begin(), entity.end());
+
+    entt::columnar_export elements{registry.storage<particle>()};
+    entt::columnar_export columns{registry.storage<position>()};
+    int sum{};
+
+    elements.each([&sum](const auto &batch) {
+        for(std::size_t pos{}; pos < batch.length; ++pos) {
+            sum += std::get<0>(batch.values)[pos].value;
+        }
+    });
+
+    columns.each([&entity](const auto &batch) {
+        ASSERT_EQ(batch.length, entity.size());
+        ASSERT_EQ(batch.entity[0u], entity[0u]);
+    });
+
+    ASSERT_EQ(sum, 6);
+}
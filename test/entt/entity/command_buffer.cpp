@@ -0,0 +1,143 @@
+#include <array>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/entity/command_buffer.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include "../../common/aggregate.h"
+#include "../../common/boxed_type.h"
+#include "../../common/empty.h"
+
+TEST(CommandBuffer, Constructors) {
+    static_assert(!std::is_copy_constructible_v<entt::command_buffer>, "Copy constructible type not allowed");
+    static_assert(!std::is_copy_assignable_v<entt::command_buffer>, "Copy assignable type not allowed");
+    static_assert(std::is_move_constructible_v<entt::command_buffer>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<entt::command_buffer>, "Move assignable type required");
+
+    const entt::command_buffer buffer{};
+
+    ASSERT_TRUE(buffer.empty());
+}
+
+TEST(CommandBuffer, Functionalities) {
+    entt::registry registry;
+    entt::command_buffer buffer{};
+    const std::array entity{registry.create(), registry.create()};
+
+    registry.emplace<int>(entity[0u], 1);
+
+    const auto placeholder = buffer.create();
+
+    ASSERT_FALSE(buffer.empty());
+    ASSERT_FALSE(registry.valid(placeholder));
+
+    buffer.emplace<int>(placeholder, 4);
+    buffer.emplace<test::empty>(placeholder);
+    buffer.emplace<test::aggregate>(entity[1u], 2);
+    buffer.remove<int>(entity[0u]);
+    buffer.emplace<int>(entity[0u], 3);
+    buffer.remove<test::empty, double>(entity[1u]);
+    buffer.destroy(entity[1u]);
+
+    ASSERT_TRUE(registry.valid(entity[1u]));
+    ASSERT_EQ(registry.get<int>(entity[0u]), 1);
+    ASSERT_FALSE(registry.all_of<test::aggregate>(entity[1u]));
+
+    buffer.flush(registry);
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(registry.get<int>(entity[0u]), 3);
+    ASSERT_FALSE(registry.valid(entity[1u]));
+
+    const auto view = registry.view<int, test::empty>();
+
+    ASSERT_EQ(view.size_hint(), 1u);
+
+    const auto created = view.front();
+
+    ASSERT_TRUE(registry.valid(created));
+    ASSERT_NE(created, entity[0u]);
+    ASSERT_EQ(registry.get<int>(created), 4);
+
+    buffer.flush(registry);
+
+    ASSERT_TRUE(buffer.empty());
+    ASSERT_EQ(registry.view<int>().size(), 2u);
+}
+
+TEST(CommandBuffer, Placeholders) {
+    entt::registry registry;
+    entt::command_buffer buffer{};
+
+    const auto entity = buffer.create();
+    const auto other = buffer.create();
+
+    ASSERT_NE(entity, other);
+
+    buffer.emplace<test::boxed_int>(other, 2);
+    buffer.emplace<test::boxed_int>(entity, 1);
+    buffer.destroy(entity);
+    buffer.flush(registry);
+
+    ASSERT_EQ(registry.storage<entt::entity>().free_list(), 1u);
+    ASSERT_EQ(registry.storage<test::boxed_int>().size(), 1u);
+    ASSERT_EQ(registry.storage<test::boxed_int>().begin()->value, 2);
+
+    const auto recycled = buffer.create();
+
+    ASSERT_EQ(recycled, entity);
+
+    buffer.emplace<test::boxed_int>(recycled, 3);
+    buffer.flush(registry);
+
+    ASSERT_EQ(registry.storage<entt::entity>().free_list(), 2u);
+    ASSERT_EQ(registry.storage<test::boxed_int>().size(), 2u);
+}
+
+TEST(CommandBuffer, Clear) {
+    entt::registry registry;
+    entt::command_buffer buffer{};
+    const auto entity = registry.create();
+
+    buffer.emplace<int>(buffer.create());
+    buffer.emplace<int>(entity);
+    buffer.destroy(entity);
+
+    ASSERT_FALSE(buffer.empty());
+
+    buffer.clear();
+
+    ASSERT_TRUE(buffer.empty());
+
+    buffer.flush(registry);
+
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_EQ(registry.storage<entt::entity>().free_list(), 1u);
+    ASSERT_TRUE(registry.storage<int>().empty());
+}
+
+TEST(CommandBuffer, Threads) {
+    entt::registry registry;
+    std::array<entt::command_buffer, 4u> buffer{};
+    std::array<std::thread, 4u> worker{};
+
+    for(std::size_t pos{}; pos < worker.size(); ++pos) {
+        worker[pos] = std::thread{[&elem = buffer[pos], pos]() {
+            for(int count{}; count < 64; ++count) {
+                elem.emplace<int>(elem.create(), static_cast<int>(pos));
+            }
+        }};
+    }
+
+    for(auto &&elem: worker) {
+        elem.join();
+    }
+
+    for(auto &&elem: buffer) {
+        elem.flush(registry);
+    }
+
+    ASSERT_EQ(registry.storage<int>().size(), 256u);
+}
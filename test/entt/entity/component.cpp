@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 #include <entt/config/config.h>
 #include <entt/entity/component.hpp>
+#include <entt/entity/entity.hpp>
 #include "../../common/boxed_type.h"
 #include "../../common/empty.h"
 #include "../../common/entity.h"
@@ -10,6 +11,13 @@
 struct self_contained {
     static constexpr auto in_place_delete = true;
     static constexpr auto page_size = 4u;
+    static constexpr auto sparse_page_size = 64u;
+    static constexpr auto page_alignment = 64u;
+};
+
+struct byte_based {
+    static constexpr auto page_bytes = 1024u;
+    int value[3]{};
 };
 
 struct traits_based {};
@@ -69,6 +77,8 @@ TYPED_TEST(Component, NonEmpty) {
 
     ASSERT_FALSE(traits_type::in_place_delete);
     ASSERT_EQ(traits_type::page_size, ENTT_PACKED_PAGE);
+    ASSERT_EQ(traits_type::sparse_page_size, entt::entt_traits<typename TestFixture::entity_type>::page_size);
+    ASSERT_EQ(traits_type::page_alignment, alignof(test::boxed_int));
 }
 
 TYPED_TEST(Component, NonMovable) {
@@ -83,6 +93,18 @@ TYPED_TEST(Component, SelfContained) {
 
     ASSERT_TRUE(traits_type::in_place_delete);
     ASSERT_EQ(traits_type::page_size, 4u);
+    ASSERT_EQ(traits_type::sparse_page_size, 64u);
+    ASSERT_EQ(traits_type::page_alignment, 64u);
+}
+
+TYPED_TEST(Component, ByteBased) {
+    using traits_type = entt::component_traits<byte_based, typename TestFixture::entity_type>;
+
+    // 1024 bytes fit 85 elements of 12 bytes, rounded down to a power of two
+    ASSERT_EQ(traits_type::page_size, 64u);
+    ASSERT_EQ(traits_type::page_size, entt::internal::page_size_for(1024u, sizeof(byte_based)));
+    ASSERT_EQ(entt::internal::page_size_for(1u, 1024u), 1u);
+    ASSERT_EQ(entt::internal::page_size_for(16384u, 1u), 16384u);
 }
 
 TYPED_TEST(Component, TraitsBased) {
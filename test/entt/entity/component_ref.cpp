@@ -0,0 +1,109 @@
+#include <type_traits>
+#include <gtest/gtest.h>
+#include <entt/entity/component_ref.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include "../../common/config.h"
+#include "../../common/pointer_stable.h"
+
+TEST(ComponentRef, Functionalities) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    const entt::component_ref<int> invalid{};
+
+    ASSERT_FALSE(invalid);
+    ASSERT_EQ(invalid.entity(), static_cast<entt::entity>(entt::null));
+    ASSERT_EQ(invalid.get(), nullptr);
+
+    registry.emplace<int>(entity, 2);
+    registry.emplace<int>(other, 3);
+
+    entt::component_ref<int> ref{registry.storage<int>(), entity};
+    const entt::component_ref<const int> cref{registry.storage<int>(), other};
+
+    static_assert(std::is_same_v<decltype(ref.get()), int *>, "Invalid type");
+    static_assert(std::is_same_v<decltype(cref.get()), const int *>, "Invalid type");
+
+    ASSERT_TRUE(ref);
+    ASSERT_EQ(ref.entity(), entity);
+    ASSERT_EQ(*ref, 2);
+    ASSERT_EQ(*cref, 3);
+
+    *ref = 4;
+
+    ASSERT_EQ(registry.get<int>(entity), 4);
+
+    const auto epoch = registry.storage<int>().epoch();
+    registry.emplace<int>(registry.create(), 0);
+
+    ASSERT_EQ(registry.storage<int>().epoch(), epoch);
+
+    // the last element fills the hole
+    registry.erase<int>(entity);
+
+    ASSERT_NE(registry.storage<int>().epoch(), epoch);
+    ASSERT_FALSE(ref);
+    ASSERT_EQ(*cref, 3);
+    ASSERT_EQ(cref.get(), &registry.get<int>(other));
+
+    registry.destroy(other);
+    const auto recycled = registry.create();
+    registry.emplace<int>(recycled, 1);
+
+    // the version of the entity is checked on lookup
+    ASSERT_EQ(entt::to_entity(recycled), entt::to_entity(other));
+    ASSERT_FALSE(cref);
+}
+
+TEST(ComponentRef, PointerStable) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    auto &&storage = registry.storage<test::pointer_stable>();
+
+    storage.emplace(entity, 1);
+
+    const entt::component_ref<test::pointer_stable> ref{storage, entity};
+
+    for(int pos{}; pos < 64; ++pos) {
+        storage.emplace(registry.create(), pos);
+    }
+
+    ASSERT_EQ(ref->value, 1);
+    ASSERT_EQ(ref.get(), &storage.get(entity));
+
+    storage.sort([](const auto lhs, const auto rhs) { return lhs < rhs; });
+
+    ASSERT_EQ(ref->value, 1);
+    ASSERT_EQ(ref.get(), &storage.get(entity));
+
+    storage.clear();
+
+    ASSERT_FALSE(ref);
+}
+
+TEST(ComponentRef, Swap) {
+    entt::storage<int> lhs;
+    entt::storage<int> rhs;
+    const entt::entity entity{1};
+
+    lhs.emplace(entity, 2);
+    rhs.emplace(entity, 3);
+
+    const entt::basic_component_ref<entt::storage<int>> ref{lhs, entity};
+
+    ASSERT_EQ(*ref, 2);
+
+    lhs.swap(rhs);
+
+    ASSERT_EQ(*ref, 3);
+    ASSERT_EQ(ref.get(), &lhs.get(entity));
+}
+
+ENTT_DEBUG_TEST(ComponentRefDeathTest, Dereference) {
+    const entt::component_ref<int> ref{};
+
+    ASSERT_DEATH([[maybe_unused]] auto &elem = *ref, "");
+}
@@ -0,0 +1,212 @@
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include "../../common/linter.hpp"
+
+struct particle {
+    static constexpr std::size_t page_size = 4u;
+    int value{};
+};
+
+struct stable_particle {
+    static constexpr auto in_place_delete = true;
+    static constexpr std::size_t page_size = 4u;
+    int value{};
+};
+
+template<>
+struct entt::storage_type<particle> {
+    using type = entt::sigh_mixin<entt::dirty_mixin<entt::storage<particle>>>;
+};
+
+template<typename Type>
+std::vector<std::size_t> dirty_pages(const Type &pool) {
+    std::vector<std::size_t> result{};
+    pool.each_dirty([&result](const std::size_t page, const auto *, const std::size_t) { result.push_back(page); });
+    return result;
+}
+
+TEST(DirtyMixin, Functionalities) {
+    entt::dirty_mixin<entt::storage<particle>> pool;
+
+    ASSERT_EQ(pool.dirty_count(), 0u);
+    ASSERT_FALSE(pool.dirty(0u));
+
+    for(std::size_t pos{}; pos < 10u; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), static_cast<int>(pos));
+    }
+
+    ASSERT_EQ(pool.dirty_count(), 3u);
+    ASSERT_EQ(dirty_pages(pool), (std::vector<std::size_t>{0u, 1u, 2u}));
+
+    pool.clean();
+
+    ASSERT_EQ(pool.dirty_count(), 0u);
+    ASSERT_FALSE(pool.dirty(1u));
+
+    pool.patch(entt::entity{5}, [](auto &elem) { elem.value = 42; });
+
+    ASSERT_TRUE(pool.dirty(1u));
+    ASSERT_EQ(dirty_pages(pool), (std::vector<std::size_t>{1u}));
+
+    pool.each_dirty([&pool](const std::size_t page, const particle *elem, const std::size_t count) {
+        ASSERT_EQ(page, 1u);
+        ASSERT_EQ(elem, pool.raw()[1u]);
+        ASSERT_EQ(count, 4u);
+        ASSERT_EQ(elem[1u].value, 42);
+    });
+
+    pool.clean();
+
+    // the last element fills the hole left by the erased one
+    pool.erase(entt::entity{2});
+
+    ASSERT_EQ(dirty_pages(pool), (std::vector<std::size_t>{0u}));
+    ASSERT_EQ(pool.index(entt::entity{9}), 2u);
+
+    pool.clean();
+    pool.erase(entt::entity{8});
+
+    pool.each_dirty([](const std::size_t page, const particle *elem, const std::size_t count) {
+        ASSERT_EQ(page, 2u);
+        ASSERT_EQ(elem, nullptr);
+        ASSERT_EQ(count, 0u);
+    });
+
+    pool.clean();
+    pool.clear();
+
+    ASSERT_EQ(dirty_pages(pool), (std::vector<std::size_t>{0u, 1u}));
+}
+
+TEST(DirtyMixin, Insert) {
+    entt::dirty_mixin<entt::storage<particle>> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}, entt::entity{7}, entt::entity{8}};
+
+    pool.emplace(entt::entity{0});
+    pool.clean();
+    pool.insert(entity.begin(), entity.end(), particle{});
+
+    ASSERT_EQ(dirty_pages(pool), (std::vector<std::size_t>{0u, 1u}));
+
+    pool.clean();
+    pool.insert(entity.begin(), entity.begin(), particle{});
+
+    ASSERT_EQ(pool.dirty_count(), 0u);
+}
+
+TEST(DirtyMixin, Sort) {
+    entt::dirty_mixin<entt::storage<particle>> pool;
+
+    for(std::size_t pos{}; pos < 8u; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), static_cast<int>(pos));
+    }
+
+    pool.clean();
+    pool.swap_elements(entt::entity{0}, entt::entity{1});
+
+    ASSERT_EQ(dirty_pages(pool), (std::vector<std::size_t>{0u}));
+
+    pool.clean();
+    pool.sort([](const auto lhs, const auto rhs) { return lhs < rhs; });
+
+    ASSERT_EQ(pool.dirty_count(), 2u);
+}
+
+TEST(DirtyMixin, InPlaceDelete) {
+    entt::dirty_mixin<entt::storage<stable_particle>> pool;
+
+    for(std::size_t pos{}; pos < 6u; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), static_cast<int>(pos));
+    }
+
+    pool.clean();
+    pool.erase(entt::entity{5});
+
+    ASSERT_EQ(pool.size(), 6u);
+    ASSERT_EQ(dirty_pages(pool), (std::vector<std::size_t>{1u}));
+
+    pool.clean();
+    pool.compact();
+
+    ASSERT_EQ(pool.dirty_count(), 0u);
+
+    pool.erase(entt::entity{1});
+    pool.compact();
+
+    ASSERT_EQ(dirty_pages(pool), (std::vector<std::size_t>{0u, 1u}));
+}
+
+TEST(DirtyMixin, Move) {
+    entt::dirty_mixin<entt::storage<particle>> pool;
+
+    static_assert(std::is_move_constructible_v<decltype(pool)>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<decltype(pool)>, "Move assignable type required");
+
+    pool.emplace(entt::entity{1});
+
+    entt::dirty_mixin<entt::storage<particle>> other{std::move(pool)};
+
+    test::is_initialized(pool);
+
+    ASSERT_EQ(pool.dirty_count(), 0u);
+    ASSERT_EQ(other.dirty_count(), 1u);
+
+    pool = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_TRUE(pool.dirty(0u));
+    ASSERT_FALSE(other.dirty(0u));
+
+    pool.swap(other);
+
+    ASSERT_EQ(pool.dirty_count(), 0u);
+    ASSERT_EQ(other.dirty_count(), 1u);
+}
+
+TEST(DirtyMixin, DeepCopyFrom) {
+    entt::dirty_mixin<entt::storage<particle>> pool;
+    entt::dirty_mixin<entt::storage<particle>> other;
+
+    for(std::size_t pos{}; pos < 6u; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), static_cast<int>(pos));
+    }
+
+    other.deep_copy_from(pool);
+
+    ASSERT_EQ(other.size(), 6u);
+    ASSERT_EQ(dirty_pages(other), (std::vector<std::size_t>{0u, 1u}));
+}
+
+TEST(DirtyMixin, Registry) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+    auto &&storage = registry.storage<particle>();
+
+    registry.insert<particle>(entity.begin(), entity.end());
+    storage.clean();
+
+    registry.replace<particle>(entity[1u], 2);
+
+    ASSERT_TRUE(storage.dirty(0u));
+    ASSERT_EQ(storage.dirty_count(), 1u);
+
+    storage.clean();
+    registry.destroy(entity[0u]);
+
+    ASSERT_EQ(storage.dirty_count(), 1u);
+
+    storage.clean();
+    registry.emplace_or_replace<particle>(registry.create(), 3);
+    registry.emplace_or_replace<particle>(entity[2u], 4);
+
+    ASSERT_EQ(storage.size(), 3u);
+    ASSERT_EQ(storage.dirty_count(), 1u);
+}
@@ -0,0 +1,179 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/entity/dynamic_storage.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/runtime_view.hpp>
+#include "../../common/config.h"
+#include "../../common/linter.hpp"
+
+struct health {
+    std::int32_t value;
+    float ratio;
+};
+
+void on_construct(std::size_t &counter, entt::registry &, entt::entity) {
+    ++counter;
+}
+
+[[nodiscard]] static entt::dynamic_type health_type() noexcept {
+    // defined by hand as a scripting language would do
+    return entt::dynamic_type{sizeof(health), alignof(health)};
+}
+
+TEST(DynamicStorage, Functionalities) {
+    entt::dynamic_storage pool{health_type()};
+    const health value{3, .5f};
+
+    ASSERT_EQ(pool.info(), entt::type_id<entt::dynamic_element>());
+    ASSERT_EQ(pool.descriptor().size, sizeof(health));
+    ASSERT_EQ(pool.capacity(), 0u);
+
+    auto *elem = static_cast<health *>(pool.emplace(entt::entity{3}));
+
+    ASSERT_EQ(elem->value, 0);
+    ASSERT_EQ(elem->ratio, 0.f);
+    ASSERT_EQ(pool.capacity(), ENTT_PACKED_PAGE);
+
+    pool.emplace(entt::entity{1}, &value);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.get(entt::entity{3}), elem);
+    ASSERT_EQ(pool.at(1u), pool.get(entt::entity{1}));
+    ASSERT_EQ(pool.value(entt::entity{1}), pool.get(entt::entity{1}));
+    ASSERT_EQ(static_cast<const health *>(pool.get(entt::entity{1}))->value, 3);
+
+    pool.patch(entt::entity{3}, [](void *instance) { static_cast<health *>(instance)->value = 42; });
+
+    ASSERT_EQ(elem->value, 42);
+
+    pool.erase(entt::entity{3});
+
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_EQ(pool.get(entt::entity{1}), elem);
+    ASSERT_EQ(elem->ratio, .5f);
+
+    pool.push(entt::entity{2}, &value);
+    pool.insert(pool.begin(), pool.begin());
+
+    ASSERT_EQ(static_cast<const health *>(pool.value(entt::entity{2}))->value, 3);
+
+    pool.clear();
+    pool.shrink_to_fit();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.capacity(), 0u);
+    ASSERT_EQ(pool.memory_usage().element_pages, 0u);
+}
+
+TEST(DynamicStorage, NonTrivial) {
+    entt::dynamic_storage pool{entt::dynamic_type::of<std::string>()};
+    const std::string value{"a string long enough to be allocated on the heap"};
+
+    ASSERT_NE(pool.descriptor().copy, nullptr);
+    ASSERT_NE(pool.descriptor().destroy, nullptr);
+
+    for(std::size_t pos{}; pos < 4u; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), &value);
+    }
+
+    static_cast<std::string *>(pool.get(entt::entity{3}))->append("!");
+    pool.erase(entt::entity{0});
+
+    ASSERT_EQ(*static_cast<std::string *>(pool.at(0u)), value + "!");
+    ASSERT_EQ(*static_cast<std::string *>(pool.at(1u)), value);
+
+    pool.swap_elements(entt::entity{3}, entt::entity{2});
+
+    ASSERT_EQ(*static_cast<std::string *>(pool.at(0u)), value);
+    ASSERT_EQ(*static_cast<std::string *>(pool.get(entt::entity{3})), value + "!");
+
+    pool.sort([](const auto lhs, const auto rhs) { return lhs < rhs; });
+
+    ASSERT_EQ(pool.index(entt::entity{1}), 2u);
+    ASSERT_EQ(pool.index(entt::entity{3}), 0u);
+    ASSERT_EQ(*static_cast<std::string *>(pool.at(0u)), value + "!");
+
+    entt::dynamic_storage other{};
+    other.deep_copy_from(pool);
+
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_NE(other.get(entt::entity{3}), pool.get(entt::entity{3}));
+    ASSERT_EQ(*static_cast<std::string *>(other.get(entt::entity{3})), value + "!");
+}
+
+TEST(DynamicStorage, Move) {
+    entt::dynamic_storage pool{health_type()};
+
+    static_assert(std::is_move_constructible_v<decltype(pool)>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<decltype(pool)>, "Move assignable type required");
+
+    pool.emplace(entt::entity{1});
+
+    entt::dynamic_storage other{std::move(pool)};
+
+    test::is_initialized(pool);
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_TRUE(other.contains(entt::entity{1}));
+    ASSERT_EQ(other.descriptor().size, sizeof(health));
+
+    pool = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_TRUE(pool.contains(entt::entity{1}));
+    ASSERT_TRUE(other.empty());
+}
+
+ENTT_DEBUG_TEST(DynamicStorageDeathTest, Descriptor) {
+    entt::dynamic_storage pool{};
+
+    ASSERT_DEATH(pool.emplace(entt::entity{1}), "");
+    ASSERT_DEATH(pool.descriptor(entt::dynamic_type{3u, 2u}), "");
+
+    pool.descriptor(health_type());
+    pool.emplace(entt::entity{1});
+
+    ASSERT_DEATH(pool.descriptor(health_type()), "");
+}
+
+TEST(DynamicStorage, Registry) {
+    using namespace entt::literals;
+
+    entt::registry registry;
+    auto &&pool = registry.storage<entt::dynamic_element>("health"_hs);
+    const health value{2, 1.f};
+    std::size_t count{};
+
+    pool.descriptor(health_type());
+    pool.on_construct().connect<&on_construct>(count);
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    registry.emplace<int>(entity);
+    registry.emplace<int>(other);
+    pool.emplace(entity, &value);
+
+    ASSERT_EQ(count, 1u);
+    ASSERT_EQ(registry.storage("health"_hs), &pool);
+
+    entt::runtime_view view{};
+    view.iterate(registry.storage<int>()).iterate(*registry.storage("health"_hs));
+
+    ASSERT_EQ(view.size_hint(), 1u);
+
+    view.each([&](const auto entt) {
+        ASSERT_EQ(entt, entity);
+        ASSERT_EQ(static_cast<const health *>(registry.storage("health"_hs)->value(entt))->value, 2);
+    });
+
+    registry.destroy(entity);
+
+    ASSERT_TRUE(pool.empty());
+}
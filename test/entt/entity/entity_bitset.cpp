@@ -0,0 +1,183 @@
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/entity_bitset.hpp>
+#include "../../common/entity.h"
+#include "../../common/linter.hpp"
+
+TEST(EntityBitset, Functionalities) {
+    entt::entity_bitset set;
+
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = set.get_allocator());
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.size(), 0u);
+    ASSERT_EQ(set.begin(), set.end());
+    ASSERT_FALSE(set.contains(entt::entity{3}));
+
+    ASSERT_TRUE(set.insert(entt::entity{3}));
+    ASSERT_FALSE(set.insert(entt::entity{3}));
+    ASSERT_TRUE(set.insert(entt::entity{1}));
+    ASSERT_TRUE(set.insert(entt::entity{70000}));
+
+    ASSERT_FALSE(set.empty());
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_TRUE(set.contains(entt::entity{3}));
+    ASSERT_TRUE(set.contains(entt::entity{70000}));
+    ASSERT_FALSE(set.contains(entt::entity{2}));
+
+    // versions are ignored
+    ASSERT_TRUE(set.contains(entt::entt_traits<entt::entity>::construct(3, 2)));
+
+    const std::vector<entt::entity> expected{entt::entity{1}, entt::entity{3}, entt::entity{70000}};
+    const std::vector<entt::entity> values{set.begin(), set.end()};
+
+    ASSERT_EQ(values, expected);
+
+    ASSERT_EQ(set.erase(entt::entity{3}), 1u);
+    ASSERT_EQ(set.erase(entt::entity{3}), 0u);
+    ASSERT_EQ(set.erase(entt::entity{5}), 0u);
+    ASSERT_EQ(set.erase(entt::entity{80000}), 0u);
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_FALSE(set.contains(entt::entity{3}));
+
+    set.clear();
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.begin(), set.end());
+}
+
+TEST(EntityBitset, Bitmap) {
+    entt::entity_bitset set;
+
+    for(std::uint32_t next{}; next < 10000u; next += 2u) {
+        set.insert(entt::entity{next});
+    }
+
+    const auto usage = set.memory_usage();
+
+    for(std::uint32_t next = 1u; next < 10000u; next += 2u) {
+        set.insert(entt::entity{next});
+    }
+
+    ASSERT_EQ(set.size(), 10000u);
+    ASSERT_LE(set.memory_usage(), usage);
+    ASSERT_LT(set.memory_usage(), set.size() * sizeof(entt::entity));
+
+    std::uint32_t expected{};
+
+    for(auto entt: set) {
+        ASSERT_EQ(entt, entt::entity{expected++});
+    }
+
+    ASSERT_EQ(expected, 10000u);
+
+    for(std::uint32_t next{}; next < 10000u; next += 2u) {
+        ASSERT_EQ(set.erase(entt::entity{next}), 1u);
+    }
+
+    ASSERT_EQ(set.size(), 5000u);
+    ASSERT_EQ(std::distance(set.begin(), set.end()), 5000);
+
+    for(std::uint32_t next{}; next < 10000u; ++next) {
+        ASSERT_EQ(set.contains(entt::entity{next}), (next % 2u) == 1u);
+    }
+
+    for(std::uint32_t next = 1u; next < 10000u; next += 2u) {
+        set.erase(entt::entity{next});
+    }
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.begin(), set.end());
+}
+
+TEST(EntityBitset, SetOperations) {
+    entt::entity_bitset lhs;
+    entt::entity_bitset rhs;
+    entt::entity_bitset small;
+
+    for(std::uint32_t next{}; next < 20000u; ++next) {
+        lhs.insert(entt::entity{next});
+        rhs.insert(entt::entity{next + 10000u});
+    }
+
+    small.insert(entt::entity{5});
+    small.insert(entt::entity{15000});
+    small.insert(entt::entity{100000});
+
+    const auto united = lhs | rhs;
+    const auto common = lhs & rhs;
+    const auto diff = lhs - rhs;
+
+    ASSERT_EQ(united.size(), 30000u);
+    ASSERT_EQ(common.size(), 10000u);
+    ASSERT_EQ(diff.size(), 10000u);
+
+    ASSERT_TRUE(united.contains(entt::entity{0}));
+    ASSERT_TRUE(united.contains(entt::entity{29999}));
+    ASSERT_FALSE(common.contains(entt::entity{9999}));
+    ASSERT_TRUE(common.contains(entt::entity{10000}));
+    ASSERT_TRUE(diff.contains(entt::entity{9999}));
+    ASSERT_FALSE(diff.contains(entt::entity{10000}));
+
+    ASSERT_EQ((lhs & small).size(), 2u);
+    ASSERT_EQ((small & lhs).size(), 2u);
+    ASSERT_EQ((small | lhs).size(), 20001u);
+    ASSERT_EQ((small - lhs).size(), 1u);
+    ASSERT_EQ((lhs - small).size(), 19998u);
+    ASSERT_EQ((small & (rhs - lhs)).size(), 0u);
+    ASSERT_TRUE((small & (rhs - lhs)).empty());
+
+    auto other = small;
+    other |= small;
+
+    ASSERT_EQ(other.size(), 3u);
+
+    other -= small;
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(other.begin(), other.end());
+}
+
+TEST(EntityBitset, CopyAndMove) {
+    entt::entity_bitset set;
+    set.insert(entt::entity{42});
+
+    entt::entity_bitset other{set};
+
+    ASSERT_TRUE(other.contains(entt::entity{42}));
+
+    entt::entity_bitset moved{std::move(set)};
+    test::is_initialized(set);
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_TRUE(moved.contains(entt::entity{42}));
+
+    set = moved;
+    moved = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_TRUE(set.contains(entt::entity{42}));
+    ASSERT_EQ(moved.size(), 1u);
+
+    set.swap(other);
+
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(other.size(), 1u);
+}
+
+TEST(EntityBitset, CustomEntity) {
+    entt::basic_entity_bitset<test::entity> set;
+    const std::vector<test::entity> entity{test::entity{1}, test::entity{200000}};
+
+    set.insert(entity.begin(), entity.end());
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_EQ(*set.begin(), test::entity{1});
+    ASSERT_EQ(*std::next(set.begin()), test::entity{200000});
+}
@@ -0,0 +1,208 @@
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <entt/entity/executor.hpp>
+#include <entt/entity/organizer.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/view.hpp>
+
+struct tracker {
+    std::atomic<std::size_t> counter{};
+    std::atomic<std::size_t> first{};
+    std::atomic<std::size_t> second{};
+    std::atomic<std::size_t> third{};
+};
+
+void rw_int(entt::view<entt::get_t<int>> view, tracker &track) {
+    track.first = ++track.counter;
+
+    for(auto [entt, value]: view.each()) {
+        value = 1;
+    }
+}
+
+void rw_char(entt::view<entt::get_t<char>> view, tracker &track) {
+    track.second = ++track.counter;
+
+    for(auto [entt, value]: view.each()) {
+        value = 'c';
+    }
+}
+
+void ro_int_char(entt::view<entt::get_t<const int, const char>> view, tracker &track) {
+    track.third = ++track.counter;
+
+    for(auto [entt, ivalue, cvalue]: view.each()) {
+        ASSERT_EQ(ivalue, 1);
+        ASSERT_EQ(cvalue, 'c');
+    }
+}
+
+void track_int(tracker &track, entt::view<entt::get_t<int>>) {
+    track.first = ++track.counter;
+}
+
+void track_char(tracker &track, entt::view<entt::get_t<char>>) {
+    track.second = ++track.counter;
+}
+
+void track_const_char(tracker &track, entt::view<entt::get_t<const char>>) {
+    track.third = ++track.counter;
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<std::size_t> invoked{};
+
+void count_int(entt::view<entt::get_t<const int>>) {
+    ++invoked;
+}
+
+void increment(int &value) {
+    ++value;
+}
+
+void check_int(entt::view<entt::get_t<const int>> view, tracker &track) {
+    for(auto [entt, value]: view.each()) {
+        track.counter += static_cast<std::size_t>(value);
+    }
+}
+
+TEST(Executor, Constructors) {
+    const entt::executor executor{3u};
+
+    ASSERT_EQ(executor.size(), 3u);
+    ASSERT_GE(entt::executor{}.size(), 0u);
+}
+
+TEST(Executor, Run) {
+    entt::organizer organizer;
+    entt::registry registry;
+
+    organizer.emplace<&rw_int>("t1");
+    organizer.emplace<&rw_char>("t2");
+    organizer.emplace<&ro_int_char>("t3");
+
+    auto &track = registry.ctx().emplace<tracker>();
+    const auto graph = organizer.graph();
+
+    for(std::size_t pos{}; pos < 4u; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, 0);
+        registry.emplace<char>(entity, 'a');
+    }
+
+    entt::executor executor{4u};
+
+    for(std::size_t iter{}; iter < 8u; ++iter) {
+        track.counter = 0u;
+        executor.run(graph, registry);
+
+        ASSERT_EQ(track.counter, 3u);
+        ASSERT_LT(track.first, track.third);
+        ASSERT_LT(track.second, track.third);
+    }
+}
+
+TEST(Executor, RunSequentially) {
+    entt::organizer organizer;
+    entt::registry registry;
+
+    organizer.emplace<&rw_int>("t1");
+    organizer.emplace<&rw_char>("t2");
+    organizer.emplace<&ro_int_char>("t3");
+
+    auto &track = registry.ctx().emplace<tracker>();
+    entt::executor executor{0u};
+
+    ASSERT_EQ(executor.size(), 0u);
+
+    executor.run(organizer.graph(), registry);
+
+    ASSERT_EQ(track.counter, 3u);
+    ASSERT_LT(track.first, track.third);
+    ASSERT_LT(track.second, track.third);
+}
+
+TEST(Executor, Priority) {
+    entt::organizer organizer;
+    entt::registry registry;
+
+    tracker track{};
+
+    // t2 heads a longer chain than t1, therefore it runs first on one thread
+    organizer.emplace<&track_int>(track, "t1");
+    organizer.emplace<&track_char>(track, "t2");
+    organizer.emplace<&track_const_char>(track, "t3");
+
+    const auto graph = organizer.graph();
+    entt::executor executor{0u};
+
+    executor.run(graph, registry);
+
+    ASSERT_EQ(track.counter, 3u);
+    ASSERT_LT(track.second, track.first);
+    ASSERT_LT(track.second, track.third);
+    ASSERT_GE(executor.cost(0u), 0.f);
+    ASSERT_GE(executor.cost(2u), 0.f);
+}
+
+TEST(Executor, RunChunked) {
+    entt::organizer organizer;
+    entt::registry registry;
+
+    organizer.emplace_chunked<&increment>(3u, "t1");
+    organizer.emplace<&check_int>("t2");
+
+    auto &track = registry.ctx().emplace<tracker>();
+    const auto graph = organizer.graph();
+
+    for(std::size_t pos{}; pos < 10u; ++pos) {
+        registry.emplace<int>(registry.create(), 0);
+    }
+
+    ASSERT_EQ(graph[0u].grain(), 3u);
+    ASSERT_EQ(graph[0u].chunks(registry), 4u);
+    ASSERT_EQ(graph[1u].grain(), 0u);
+    ASSERT_EQ(graph[1u].chunks(registry), 1u);
+
+    entt::executor executor{4u};
+
+    for(std::size_t iter{}; iter < 8u; ++iter) {
+        track.counter = 0u;
+        executor.run(graph, registry);
+
+        ASSERT_EQ(track.counter, 10u * (iter + 1u));
+    }
+}
+
+TEST(Executor, SkipEmpty) {
+    entt::organizer organizer;
+    entt::registry registry;
+
+    organizer.emplace<&count_int>("t1");
+    organizer.emplace<&rw_int>("t2");
+
+    auto &track = registry.ctx().emplace<tracker>();
+    const auto graph = organizer.graph();
+    entt::executor executor{2u};
+
+    invoked = 0u;
+    executor.run(graph, registry);
+
+    ASSERT_EQ(invoked, 0u);
+    ASSERT_EQ(track.counter, 1u);
+
+    registry.emplace<int>(registry.create());
+    executor.run(graph, registry);
+
+    ASSERT_EQ(invoked, 1u);
+    ASSERT_EQ(track.counter, 2u);
+}
+
+TEST(Executor, RunEmpty) {
+    entt::organizer organizer;
+    entt::registry registry;
+    entt::executor executor{2u};
+
+    ASSERT_NO_FATAL_FAILURE(executor.run(organizer.graph(), registry));
+}
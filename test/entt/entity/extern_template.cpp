@@ -0,0 +1,20 @@
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/sparse_set.hpp>
+#include <entt/entity/storage.hpp>
+
+TEST(ExternTemplate, SparseSet) {
+    entt::sparse_set set{};
+    set.push(entt::entity{3});
+
+    ASSERT_TRUE(set.contains(entt::entity{3}));
+    ASSERT_EQ(set.index(entt::entity{3}), 0u);
+}
+
+TEST(ExternTemplate, Storage) {
+    entt::basic_storage<entt::entity> storage{};
+    const auto entity = storage.generate();
+
+    ASSERT_TRUE(storage.contains(entity));
+    ASSERT_EQ(storage.free_list(), 1u);
+}
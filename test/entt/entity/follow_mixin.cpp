@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/core/algorithm.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include "../../common/linter.hpp"
+
+struct position {
+    int value;
+};
+
+struct velocity {
+    int value;
+};
+
+template<>
+struct entt::storage_type<velocity> {
+    using type = entt::sigh_mixin<entt::follow_mixin<entt::storage<velocity>>>;
+};
+
+template<typename Type>
+bool is_aligned(const Type &pool, const entt::sparse_set &leader) {
+    auto it = std::find_if(leader.begin(), leader.end(), [&pool](const auto entt) { return pool.contains(entt); });
+
+    for(auto &&entt: static_cast<const entt::sparse_set &>(pool)) {
+        if(it == leader.end()) {
+            // entities that aren't shared go to the end
+            if(leader.contains(entt)) {
+                return false;
+            }
+        } else {
+            if(entt != *it) {
+                return false;
+            }
+
+            it = std::find_if(it + 1, leader.end(), [&pool](const auto other) { return pool.contains(other); });
+        }
+    }
+
+    return it == leader.end();
+}
+
+TEST(FollowMixin, Functionalities) {
+    entt::storage<position> leader;
+    entt::follow_mixin<entt::storage<velocity>> pool;
+
+    for(std::size_t pos{}; pos < 16u; ++pos) {
+        const entt::entity entt{static_cast<entt::id_type>((pos * 7u) % 16u)};
+        leader.emplace(entt::entity{static_cast<entt::id_type>(pos)}, static_cast<int>(pos));
+
+        if(pos % 3u != 0u) {
+            pool.emplace(entt, static_cast<int>(pos));
+        }
+    }
+
+    pool.emplace(entt::entity{32}, 0);
+
+    ASSERT_EQ(pool.leader(), nullptr);
+    ASSERT_FALSE(is_aligned(pool, leader));
+
+    pool.follow(leader);
+
+    ASSERT_EQ(pool.leader(), &leader);
+    ASSERT_TRUE(is_aligned(pool, leader));
+
+    pool.emplace(entt::entity{0}, 0);
+    pool.erase(entt::entity{7});
+    leader.erase(entt::entity{2});
+
+    ASSERT_FALSE(is_aligned(pool, leader));
+
+    pool.align(entt::insertion_sort{});
+
+    ASSERT_TRUE(is_aligned(pool, leader));
+
+    leader.sort([](const entt::entity lhs, const entt::entity rhs) { return lhs < rhs; });
+
+    ASSERT_FALSE(is_aligned(pool, leader));
+
+    pool.align();
+
+    ASSERT_TRUE(is_aligned(pool, leader));
+
+    pool.unfollow();
+    leader.sort([](const entt::entity lhs, const entt::entity rhs) { return lhs > rhs; });
+    pool.align();
+
+    ASSERT_EQ(pool.leader(), nullptr);
+    ASSERT_FALSE(is_aligned(pool, leader));
+}
+
+TEST(FollowMixin, Move) {
+    entt::storage<position> leader;
+    entt::follow_mixin<entt::storage<velocity>> pool;
+
+    static_assert(std::is_move_constructible_v<decltype(pool)>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<decltype(pool)>, "Move assignable type required");
+
+    pool.follow(leader);
+
+    entt::follow_mixin<entt::storage<velocity>> other{std::move(pool)};
+
+    test::is_initialized(pool);
+
+    ASSERT_EQ(pool.leader(), nullptr);
+    ASSERT_EQ(other.leader(), &leader);
+
+    pool = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_EQ(pool.leader(), &leader);
+
+    pool.swap(other);
+
+    ASSERT_EQ(pool.leader(), nullptr);
+    ASSERT_EQ(other.leader(), &leader);
+}
+
+TEST(FollowMixin, Registry) {
+    entt::registry registry;
+    auto &&storage = registry.storage<velocity>();
+
+    storage.follow(registry.storage<position>());
+
+    for(int pos{}; pos < 64; ++pos) {
+        const auto entt = registry.create();
+
+        if(pos % 5 != 0) {
+            registry.emplace<velocity>(entt, pos);
+        }
+
+        registry.emplace<position>(entt, (pos * 37) % 64);
+    }
+
+    registry.sort<position>([](const position &lhs, const position &rhs) { return lhs.value < rhs.value; });
+    registry.destroy(storage.data()[4u]);
+    registry.emplace<velocity>(registry.create(), -1);
+    storage.align();
+
+    ASSERT_TRUE(is_aligned(storage, registry.storage<position>()));
+}
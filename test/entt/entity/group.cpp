@@ -4,6 +4,7 @@
 #include <functional>
 #include <tuple>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/entity.hpp>
 #include <entt/entity/group.hpp>
@@ -15,6 +16,19 @@
 #include "../../common/config.h"
 #include "../../common/empty.h"
 
+struct small_page {
+    static constexpr std::size_t page_size = 4u;
+    int value{};
+};
+
+struct bulk_listener {
+    void receive(entt::registry &, const entt::entity *elem, const std::size_t len) {
+        entity.assign(elem, elem + len);
+    }
+
+    std::vector<entt::entity> entity{};
+};
+
 TEST(NonOwningGroup, Functionalities) {
     entt::registry registry;
     auto group = registry.group(entt::get<int, char>);
@@ -228,6 +242,34 @@ TEST(NonOwningGroup, Each) {
     }
 }
 
+TEST(NonOwningGroup, EachRange) {
+    entt::registry registry;
+    const auto group = registry.group(entt::get<int, char>);
+    std::vector<int> visited{};
+
+    const entt::group<entt::owned_t<>, entt::get_t<int>> invalid{};
+
+    ASSERT_EQ(invalid.each_range(0u, 2u, [](int &) { FAIL(); }), 0u);
+
+    for(int pos{}; pos < 3; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+        registry.emplace<char>(entity, static_cast<char>(pos));
+    }
+
+    std::size_t cursor = group.each_range(0u, 2u, [&visited](const auto entt, int &ivalue, char &) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), ivalue);
+        visited.push_back(ivalue);
+    });
+
+    ASSERT_EQ(cursor, 2u);
+
+    cursor = group.each_range(cursor, 2u, [&visited](int &ivalue, char &) { visited.push_back(ivalue); });
+
+    ASSERT_EQ(cursor, group.size());
+    ASSERT_EQ(visited, (std::vector<int>{2, 1, 0}));
+}
+
 TEST(NonOwningGroup, Sort) {
     entt::registry registry;
     auto group = registry.group(entt::get<const int, unsigned int>);
@@ -978,6 +1020,79 @@ TEST(OwningGroup, Each) {
     }
 }
 
+
+TEST(OwningGroup, EachChunk) {
+    entt::registry registry;
+    std::array<entt::entity, 10u> entity{};
+    std::vector<std::size_t> length{};
+
+    const auto group = registry.group<int, small_page, test::empty>(entt::get<char>);
+    const auto cgroup = std::as_const(registry).group_if_exists<const int, const small_page, const test::empty>(entt::get<const char>);
+
+    group.each_chunk([](auto &&...) { FAIL(); });
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<char>(entity.begin(), entity.end());
+    registry.insert<test::empty>(entity.begin(), entity.end());
+
+    for(std::size_t pos{}; pos < entity.size(); ++pos) {
+        registry.emplace<small_page>(entity[pos], static_cast<int>(pos));
+        registry.emplace<int>(entity[pos], static_cast<int>(pos));
+    }
+
+    // observed types aren't contiguous and are never returned
+    group.each_chunk([&](const entt::entity *entt, const std::size_t count, int *ivalue, small_page *svalue) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            ASSERT_EQ(&registry.get<int>(entt[pos]), ivalue + pos);
+            ASSERT_EQ(&registry.get<small_page>(entt[pos]), svalue + pos);
+        }
+
+        length.push_back(count);
+    });
+
+    ASSERT_EQ(length.size(), 3u);
+    ASSERT_EQ(length[0u], 4u);
+    ASSERT_EQ(length[1u], 4u);
+    ASSERT_EQ(length[2u], 2u);
+
+    registry.erase<char>(entity[0u]);
+
+    cgroup.each_chunk([&length](const entt::entity *, const std::size_t count, const int *ivalue, const small_page *svalue) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            ASSERT_EQ(ivalue[pos], svalue[pos].value);
+        }
+
+        length.push_back(count);
+    });
+
+    ASSERT_EQ(length.size(), 6u);
+    ASSERT_EQ(length[5u], 1u);
+}
+
+TEST(OwningGroup, EachRange) {
+    entt::registry registry;
+    const auto group = registry.group<int>(entt::get<char>);
+    std::vector<int> visited{};
+
+    ASSERT_EQ(group.each_range(0u, 2u, [](int &, char &) { FAIL(); }), 0u);
+
+    for(int pos{}; pos < 3; ++pos) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, pos);
+        registry.emplace<char>(entity, static_cast<char>(pos));
+    }
+
+    ASSERT_EQ(group.each_range(1u, 1u, [&visited](const auto entt, int &ivalue, char &cvalue) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), ivalue);
+        ASSERT_EQ(static_cast<char>(ivalue), cvalue);
+        visited.push_back(ivalue);
+    }),
+              2u);
+
+    ASSERT_EQ(group.each_range(2u, 4u, [&visited](int &ivalue, char &) { visited.push_back(ivalue); }), group.size());
+    ASSERT_EQ(visited, (std::vector<int>{1, 0}));
+}
+
 TEST(OwningGroup, SortOrdered) {
     entt::registry registry;
     auto group = registry.group<test::boxed_int, char>();
@@ -1135,6 +1250,127 @@ TEST(OwningGroup, SortWithExclusionList) {
     ASSERT_FALSE(group.contains(entity[2]));
 }
 
+TEST(OwningGroup, KeepSorted) {
+    entt::registry registry;
+    auto group = registry.group<int>(entt::get<char>, entt::exclude<double>);
+    std::array<entt::entity, 6u> entity{};
+
+    const auto is_sorted = [&group]() {
+        std::vector<int> value{};
+
+        for(auto [entt, ivalue, cvalue]: group.each()) {
+            value.push_back(ivalue);
+        }
+
+        return std::is_sorted(value.begin(), value.end()) && (value.size() == group.size());
+    };
+
+    registry.create(entity.begin(), entity.end());
+
+    for(std::size_t pos{}; pos < entity.size(); ++pos) {
+        registry.emplace<int>(entity[pos], static_cast<int>(entity.size() - pos));
+    }
+
+    registry.insert<char>(entity.begin(), entity.begin() + 3u);
+
+    ASSERT_FALSE(group.sorted());
+
+    group.keep_sorted<int>(std::less{});
+
+    ASSERT_TRUE(group.sorted());
+    ASSERT_TRUE(is_sorted());
+
+    registry.insert<char>(entity.begin() + 3u, entity.end());
+
+    group.sort_pending();
+
+    ASSERT_EQ(group.size(), 6u);
+
+    ASSERT_TRUE(is_sorted());
+
+    registry.patch<int>(entity[0u], [](auto &value) { value = 0; });
+    registry.replace<int>(entity[5u], 42);
+    group.sort_pending();
+
+    ASSERT_TRUE(is_sorted());
+    ASSERT_EQ(*group.begin(), entity[0u]);
+    ASSERT_EQ(group.back(), entity[5u]);
+
+    registry.emplace<double>(entity[0u]);
+    registry.erase<char>(entity[2u]);
+    group.sort_pending();
+
+    ASSERT_EQ(group.size(), 4u);
+    ASSERT_TRUE(is_sorted());
+
+    registry.erase<double>(entity[0u]);
+    group.sort_pending();
+
+    ASSERT_EQ(*group.begin(), entity[0u]);
+    ASSERT_TRUE(is_sorted());
+
+    group.stop_sorting();
+    registry.patch<int>(entity[0u], [](auto &value) { value = 64; });
+    group.sort_pending();
+
+    ASSERT_FALSE(group.sorted());
+    ASSERT_FALSE(is_sorted());
+    ASSERT_TRUE(registry.on_update<int>().empty());
+    ASSERT_TRUE(registry.on_update<char>().empty());
+}
+
+TEST(OwningGroup, KeepSortedBatch) {
+    entt::registry registry;
+    auto group = registry.group<int>();
+    std::array<entt::entity, 64u> entity{};
+    std::size_t count{};
+
+    registry.create(entity.begin(), entity.end());
+
+    for(std::size_t pos{}; pos < entity.size(); ++pos) {
+        registry.emplace<int>(entity[pos], static_cast<int>(pos));
+    }
+
+    group.keep_sorted<int>([&count](const int lhs, const int rhs) {
+        ++count;
+        return lhs < rhs;
+    });
+
+    count = 0u;
+
+    for(auto entt: entity) {
+        registry.patch<int>(entt, [](auto &value) { ++value; });
+    }
+
+    // changes only mark the group, nothing is sorted until requested
+    ASSERT_EQ(count, 0u);
+
+    group.sort_pending();
+
+    // a single insertion sort pass over an already ordered group
+    ASSERT_EQ(count, entity.size() - 1u);
+
+    count = 0u;
+    group.sort_pending();
+
+    ASSERT_EQ(count, 0u);
+
+    registry.destroy(entity.begin(), entity.begin() + 8u);
+
+    ASSERT_EQ(count, 0u);
+
+    group.sort_pending();
+
+    std::vector<int> value{};
+
+    for(auto [entt, ivalue]: group.each()) {
+        value.push_back(ivalue);
+    }
+
+    ASSERT_EQ(value.size(), group.size());
+    ASSERT_TRUE(std::is_sorted(value.begin(), value.end()));
+}
+
 TEST(OwningGroup, IndexRebuiltOnDestroy) {
     entt::registry registry;
     auto group = registry.group<int>(entt::get<unsigned int>);
@@ -1496,6 +1732,106 @@ TEST(OwningGroup, SwapElements) {
     ASSERT_EQ(registry.storage<char>().index(entity[0u]), 1u);
 }
 
+TEST(OwningGroup, BulkInsert) {
+    entt::registry registry;
+    const auto group = registry.group<int, char>(entt::get<double>, entt::exclude<float>);
+    std::array<entt::entity, 8u> entity{};
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<int>(entity.begin(), entity.end());
+    registry.insert<double>(entity.begin() + 1u, entity.end());
+    registry.emplace<float>(entity[2u]);
+
+    ASSERT_TRUE(group.empty());
+
+    // newly matching entities enter the group all at once
+    registry.insert<char>(entity.begin(), entity.end(), 'c');
+
+    ASSERT_EQ(group.size(), 6u);
+    ASSERT_FALSE(group.contains(entity[0u]));
+    ASSERT_FALSE(group.contains(entity[2u]));
+
+    for(auto entt: group) {
+        ASSERT_LT(registry.storage<int>().index(entt), group.size());
+        ASSERT_EQ(registry.storage<int>().index(entt), registry.storage<char>().index(entt));
+        ASSERT_EQ(registry.get<char>(entt), 'c');
+    }
+
+    registry.erase<float>(entity[2u]);
+
+    ASSERT_EQ(group.size(), 7u);
+    ASSERT_TRUE(group.contains(entity[2u]));
+}
+
+TEST(OwningGroup, ChunkedConstruction) {
+    entt::registry registry;
+    std::array<entt::entity, 7u> entity{};
+    std::vector<std::size_t> chunks{};
+
+    // chunks are processed out of order on purpose
+    const auto executor = [&chunks](const std::size_t count, auto job) {
+        chunks.push_back(count);
+
+        for(auto pos = count; pos; --pos) {
+            job(pos - 1u);
+        }
+    };
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<int>(entity.begin(), entity.end());
+    registry.insert<char>(entity.begin() + 1u, entity.end());
+    registry.emplace<double>(entity[3u]);
+
+    const auto group = registry.group<int, char>(executor, 2u, entt::get<>, entt::exclude<double>);
+
+    ASSERT_EQ(chunks.size(), 1u);
+    ASSERT_EQ(chunks[0u], 4u);
+    ASSERT_EQ(group.size(), 5u);
+
+    for(std::size_t pos{}; pos < group.size(); ++pos) {
+        ASSERT_EQ(registry.storage<int>()[pos], registry.storage<char>()[pos]);
+        ASSERT_TRUE(group.contains(registry.storage<int>()[pos]));
+    }
+
+    // packed order is preserved for the entities of the group
+    ASSERT_EQ(registry.storage<int>().index(entity[1u]), 0u);
+    ASSERT_EQ(registry.storage<int>().index(entity[6u]), 4u);
+
+    // existing groups are returned as they are
+    const auto other = registry.group<int, char>(executor, 2u, entt::get<>, entt::exclude<double>);
+
+    ASSERT_EQ(chunks.size(), 1u);
+    ASSERT_EQ(other.handle().size(), group.handle().size());
+
+    registry.erase<double>(entity[3u]);
+
+    ASSERT_EQ(group.size(), 6u);
+}
+
+TEST(OwningGroup, BulkInsertListeners) {
+    entt::registry registry;
+    std::array<entt::entity, 4u> other{};
+    std::array<entt::entity, 4u> entity{};
+    bulk_listener before{};
+    bulk_listener after{};
+
+    registry.create(other.begin(), other.end());
+    registry.create(entity.begin(), entity.end());
+    registry.insert<int>(other.begin(), other.end());
+    registry.insert<char>(entity.begin(), entity.end());
+
+    // the group partitions the pool in between, it doesn't affect other listeners
+    registry.on_bulk_construct<int>().connect<&bulk_listener::receive>(before);
+    const auto group = registry.group<int>(entt::get<char>);
+    registry.on_bulk_construct<int>().connect<&bulk_listener::receive>(after);
+
+    registry.insert<int>(entity.begin(), entity.end());
+
+    ASSERT_EQ(group.size(), 4u);
+    ASSERT_EQ(before.entity, (std::vector<entt::entity>{entity.begin(), entity.end()}));
+    ASSERT_EQ(after.entity, before.entity);
+}
+
 TEST(OwningGroup, SwappingValuesIsAllowed) {
     entt::registry registry;
     const auto group = registry.group<test::boxed_int>(entt::get<test::empty>);
@@ -1626,6 +1962,94 @@ ENTT_DEBUG_TEST(OwningGroupDeathTest, Overlapping) {
     registry.group<char>(entt::get<int>, entt::exclude<double>);
 
     ASSERT_DEATH((registry.group<char, float>(entt::get<float>, entt::exclude<double>)), "");
-    ASSERT_DEATH(registry.group<char>(entt::get<int, float>, entt::exclude<double>), "");
-    ASSERT_DEATH(registry.group<char>(entt::get<int>, entt::exclude<double, float>), "");
+    ASSERT_DEATH(registry.group<char>(entt::get<float>, entt::exclude<double>), "");
+    ASSERT_DEATH(registry.group<char>(entt::get<int>, entt::exclude<float>), "");
+}
+
+TEST(OwningGroup, Nested) {
+    entt::registry registry;
+    const auto outer = registry.group<int, char>();
+    const auto inner = registry.group<int, char, double>(entt::get<>, entt::exclude<float>);
+    std::array<entt::entity, 64u> entity{};
+
+    registry.create(entity.begin(), entity.end());
+
+    auto validate = [&registry](const auto &group, auto view) {
+        ASSERT_EQ(group.size(), static_cast<std::size_t>(std::distance(view.begin(), view.end())));
+
+        for(auto entt: group) {
+            ASSERT_TRUE(view.contains(entt));
+            ASSERT_LT(registry.storage<int>().index(entt), group.size());
+            ASSERT_LT(registry.storage<char>().index(entt), group.size());
+        }
+    };
+
+    // middle group created after the others so that it's nested on both sides
+    const auto middle = registry.group<int, char, double>();
+
+    for(std::size_t pos{}, seed{1u}; pos < 512u; ++pos) {
+        seed = (seed * 1103515245u + 12345u) % 2147483648u;
+        const auto entt = entity[seed % entity.size()];
+
+        switch((seed / entity.size()) % 8u) {
+        case 0u:
+            registry.emplace_or_replace<int>(entt);
+            break;
+        case 1u:
+            registry.emplace_or_replace<char>(entt);
+            break;
+        case 2u:
+            registry.emplace_or_replace<double>(entt);
+            break;
+        case 3u:
+            registry.emplace_or_replace<float>(entt);
+            break;
+        case 4u:
+            registry.remove<int>(entt);
+            break;
+        case 5u:
+            registry.remove<char>(entt);
+            break;
+        case 6u:
+            registry.remove<double, float>(entt);
+            break;
+        case 7u:
+            registry.destroy(entt);
+            entity[seed % entity.size()] = registry.create();
+            break;
+        }
+
+        validate(outer, registry.view<int, char>());
+        validate(middle, registry.view<int, char, double>());
+        validate(inner, registry.view<int, char, double>(entt::exclude<float>));
+
+        ASSERT_LE(inner.size(), middle.size());
+        ASSERT_LE(middle.size(), outer.size());
+    }
+
+    ASSERT_FALSE(outer.sortable());
+    ASSERT_FALSE(middle.sortable());
+    ASSERT_TRUE(inner.sortable());
+
+    inner.sort([](const entt::entity lhs, const entt::entity rhs) { return entt::to_integral(lhs) < entt::to_integral(rhs); });
+
+    validate(outer, registry.view<int, char>());
+    validate(middle, registry.view<int, char, double>());
+    validate(inner, registry.view<int, char, double>(entt::exclude<float>));
+}
+
+ENTT_DEBUG_TEST(OwningGroupDeathTest, SortNested) {
+    entt::registry registry;
+    const auto group = registry.group<int, char>();
+    registry.group<int, char, double>();
+
+    ASSERT_DEATH(group.sort([](const entt::entity lhs, const entt::entity rhs) { return lhs < rhs; }), "");
+}
+
+ENTT_DEBUG_TEST(OwningGroupDeathTest, KeepSortedNested) {
+    entt::registry registry;
+    const auto group = registry.group<int, char>();
+    group.keep_sorted([](const entt::entity lhs, const entt::entity rhs) { return lhs < rhs; });
+
+    ASSERT_DEATH((registry.group<int, char, double>()), "");
 }
@@ -618,3 +618,66 @@ TEST(BasicHandle, Lifetime) {
     ASSERT_FALSE(registry.storage<int>().empty());
     ASSERT_NE(registry.storage<entt::entity>().free_list(), 0u);
 }
+
+TEST(BasicCachedHandle, Functionalities) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    const entt::cached_handle<int, char> handle{registry, entity};
+
+    ASSERT_TRUE(handle);
+    ASSERT_EQ(handle.entity(), entity);
+    ASSERT_EQ(handle.registry(), &registry);
+    ASSERT_EQ(handle.storage<int>(), &registry.storage<int>());
+    ASSERT_EQ(handle.storage<char>(), &registry.storage<char>());
+
+    ASSERT_FALSE((handle.any_of<int, char>()));
+    ASSERT_EQ(handle.emplace<int>(3), 3);
+    ASSERT_TRUE(handle.all_of<int>());
+    ASSERT_FALSE((handle.all_of<int, char>()));
+    ASSERT_EQ(registry.get<int>(entity), 3);
+
+    ASSERT_EQ(handle.emplace_or_replace<int>(1), 1);
+    ASSERT_EQ(handle.replace<int>(2), 2);
+    ASSERT_EQ(handle.patch<int>([](auto &value) { ++value; }), 3);
+    ASSERT_EQ(handle.get_or_emplace<char>('c'), 'c');
+    ASSERT_EQ((handle.get<int, char>()), std::make_tuple(3, 'c'));
+    ASSERT_EQ(*handle.try_get<int>(), 3);
+
+    ASSERT_EQ((handle.remove<int, char>()), 2u);
+    ASSERT_EQ(handle.try_get<int>(), nullptr);
+    ASSERT_FALSE(registry.any_of<int>(entity));
+
+    handle.emplace<char>();
+    handle.erase<char>();
+
+    ASSERT_FALSE(registry.any_of<char>(entity));
+
+    const auto other = handle.handle();
+
+    ASSERT_EQ(other.registry(), &registry);
+    ASSERT_EQ(other.entity(), entity);
+
+    registry.destroy(entity);
+
+    ASSERT_FALSE(handle);
+    ASSERT_FALSE(entt::cached_handle<int>{});
+}
+
+TEST(BasicCachedHandle, Const) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 2);
+
+    const entt::const_cached_handle<int, char> handle{std::as_const(registry), entity};
+
+    ASSERT_EQ(handle.storage<int>(), &registry.storage<int>());
+    ASSERT_EQ(handle.storage<char>(), nullptr);
+
+    ASSERT_TRUE(handle.all_of<int>());
+    ASSERT_FALSE(handle.any_of<char>());
+    ASSERT_EQ(handle.get<int>(), 2);
+    ASSERT_EQ(*handle.try_get<int>(), 2);
+    ASSERT_EQ(handle.try_get<char>(), nullptr);
+
+    testing::StaticAssertTypeEq<decltype(handle.get<int>()), const int &>();
+}
@@ -1,3 +1,4 @@
+#include <utility>
 #include <gtest/gtest.h>
 #include <entt/core/hashed_string.hpp>
 #include <entt/entity/component.hpp>
@@ -19,6 +20,11 @@ struct clazz {
     entt::entity entt{entt::null};
 };
 
+struct non_paginated {
+    static constexpr auto page_size = entt::no_pagination;
+    int value{};
+};
+
 void sigh_callback(int &value) {
     ++value;
 }
@@ -55,6 +61,55 @@ TEST(AsGroup, Functionalities) {
     ([](entt::group<entt::owned_t<const double>, entt::get_t<const char>, entt::exclude_t<const int>>) {})(entt::as_group{cregistry});
 }
 
+TEST(ViewHandle, Functionalities) {
+    entt::registry registry;
+    const entt::view_handle<entt::get_t<int>, entt::exclude_t<char>> handle{registry};
+
+    ASSERT_TRUE(handle);
+    ASSERT_EQ(handle.registry(), &registry);
+    ASSERT_FALSE(entt::view_handle<entt::get_t<int>>{});
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity);
+
+    const auto *view = &handle.get();
+
+    ASSERT_EQ(view->size_hint(), 1u);
+    ASSERT_TRUE(handle->contains(entity));
+    ASSERT_EQ((*handle).storage<int>(), &registry.storage<int>());
+    ASSERT_EQ(&handle.get(), view);
+
+    registry.emplace<char>(entity);
+
+    ASSERT_FALSE(handle->contains(entity));
+}
+
+TEST(ViewHandle, Refresh) {
+    entt::registry registry;
+    const entt::basic_view_handle<const entt::registry, entt::view<entt::get_t<const int>>> handle{std::as_const(registry)};
+    const auto epoch = registry.epoch();
+
+    ASSERT_EQ(handle->storage<const int>(), nullptr);
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity);
+
+    ASSERT_NE(registry.epoch(), epoch);
+    ASSERT_EQ(handle->storage<const int>(), &registry.storage<int>());
+    ASSERT_TRUE(handle->contains(entity));
+
+    registry.reset(entt::type_id<int>().hash());
+
+    ASSERT_EQ(handle->storage<const int>(), nullptr);
+
+    entt::registry other{};
+    other.emplace<int>(other.create());
+    registry.swap(other);
+
+    ASSERT_EQ(handle->storage<const int>(), &registry.storage<int>());
+    ASSERT_EQ(handle->size(), 1u);
+}
+
 TEST(Invoke, Functionalities) {
     entt::registry registry;
     const auto entity = registry.create();
@@ -121,6 +176,30 @@ TYPED_TEST(ToEntity, Functionalities) {
     ASSERT_EQ(entt::to_entity(storage, storage.get(other)), other);
 }
 
+TEST(ToEntity, NoPagination) {
+    entt::registry registry;
+    const entt::entity null = entt::null;
+
+    auto &storage = registry.storage<non_paginated>();
+    const non_paginated value{4};
+
+    ASSERT_EQ(entt::to_entity(storage, value), null);
+
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    storage.emplace(entity);
+    storage.emplace(other);
+
+    ASSERT_EQ(entt::to_entity(storage, storage.get(entity)), entity);
+    ASSERT_EQ(entt::to_entity(storage, storage.get(other)), other);
+    ASSERT_EQ(entt::to_entity(storage, value), null);
+
+    storage.erase(entity);
+
+    ASSERT_EQ(entt::to_entity(storage, storage.get(other)), other);
+}
+
 TEST(SighHelper, Functionalities) {
     using namespace entt::literals;
 
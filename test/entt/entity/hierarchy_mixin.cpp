@@ -0,0 +1,275 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include "../../common/config.h"
+#include "../../common/linter.hpp"
+
+struct node {
+    entt::entity parent{entt::null};
+    int value{};
+};
+
+struct stable_node {
+    static constexpr auto in_place_delete = true;
+    entt::entity parent{entt::null};
+};
+
+template<>
+struct entt::storage_type<node> {
+    using type = entt::sigh_mixin<entt::hierarchy_mixin<entt::storage<node>, &node::parent>>;
+};
+
+template<typename Type>
+void assert_hierarchical(Type &pool) {
+    std::vector<entt::entity> visited{};
+
+    pool.traverse([&](const entt::entity entt, auto &elem) {
+        ASSERT_TRUE(elem.parent == entt::null || !pool.contains(elem.parent) || std::find(visited.begin(), visited.end(), elem.parent) != visited.end());
+        visited.push_back(entt);
+    });
+
+    ASSERT_TRUE(pool.ordered());
+    ASSERT_EQ(visited.size(), pool.size());
+}
+
+TEST(HierarchyMixin, Functionalities) {
+    entt::hierarchy_mixin<entt::storage<node>, &node::parent> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}, entt::entity{2}};
+
+    ASSERT_TRUE(pool.ordered());
+
+    pool.emplace(entity[0u]);
+    pool.emplace(entity[1u], entity[0u]);
+    pool.emplace(entity[2u], entity[1u]);
+
+    ASSERT_TRUE(pool.ordered());
+
+    // children created before their parents
+    pool.patch(entity[0u], [&](auto &elem) { elem.parent = entity[3u]; });
+
+    ASSERT_TRUE(pool.ordered());
+
+    pool.emplace(entity[3u]);
+
+    ASSERT_FALSE(pool.ordered());
+
+    pool.refresh();
+
+    ASSERT_TRUE(pool.ordered());
+    ASSERT_EQ(pool.index(entity[3u]), 0u);
+    ASSERT_EQ(pool.index(entity[0u]), 1u);
+    assert_hierarchical(pool);
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.ordered());
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST(HierarchyMixin, Reparent) {
+    entt::hierarchy_mixin<entt::storage<node>, &node::parent> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}, entt::entity{2}};
+
+    for(auto entt: entity) {
+        pool.emplace(entt);
+    }
+
+    pool.patch(entity[1u], [&](auto &elem) { elem.parent = entity[0u]; });
+
+    ASSERT_TRUE(pool.ordered());
+
+    pool.patch(entity[0u], [&](auto &elem) { elem.parent = entity[3u]; });
+    pool.patch(entity[2u], [&](auto &elem) { elem.parent = entity[1u]; });
+
+    ASSERT_FALSE(pool.ordered());
+
+    pool.refresh();
+
+    ASSERT_TRUE(pool.ordered());
+    ASSERT_EQ(pool.index(entity[3u]), 0u);
+    ASSERT_EQ(pool.index(entity[0u]), 1u);
+    ASSERT_EQ(pool.index(entity[1u]), 2u);
+    ASSERT_EQ(pool.index(entity[2u]), 3u);
+    assert_hierarchical(pool);
+}
+
+TEST(HierarchyMixin, Traverse) {
+    entt::hierarchy_mixin<entt::storage<node>, &node::parent> pool;
+    std::vector<entt::entity> entity(16u);
+
+    for(std::size_t pos{}; pos < entity.size(); ++pos) {
+        entity[pos] = entt::entity{static_cast<entt::id_type>(pos)};
+    }
+
+    // each entity is the child of the one that follows it
+    for(std::size_t pos{}; pos < entity.size(); ++pos) {
+        pool.emplace(entity[pos], (pos + 1u) == entity.size() ? entt::entity{entt::null} : entity[pos + 1u], 1);
+    }
+
+    ASSERT_FALSE(pool.ordered());
+
+    pool.traverse([&pool](const entt::entity, node &elem) {
+        if(elem.parent != entt::null) {
+            elem.value += pool.get(elem.parent).value;
+        }
+    });
+
+    ASSERT_TRUE(pool.ordered());
+
+    for(std::size_t pos{}; pos < entity.size(); ++pos) {
+        ASSERT_EQ(pool.get(entity[pos]).value, static_cast<int>(entity.size() - pos));
+    }
+}
+
+TEST(HierarchyMixin, Erase) {
+    entt::hierarchy_mixin<entt::storage<node>, &node::parent> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}};
+
+    pool.emplace(entity[0u]);
+    pool.emplace(entity[1u], entity[0u]);
+    pool.emplace(entity[2u], entity[1u]);
+
+    // the last child fills the hole left by its own parent
+    pool.erase(entity[0u]);
+
+    ASSERT_FALSE(pool.ordered());
+
+    pool.refresh();
+
+    ASSERT_TRUE(pool.ordered());
+    ASSERT_LT(pool.index(entity[1u]), pool.index(entity[2u]));
+
+    // children survive their parents and wait for them to come back
+    pool.erase(entity[1u]);
+    pool.refresh();
+
+    ASSERT_TRUE(pool.ordered());
+
+    pool.emplace(entity[1u]);
+
+    ASSERT_FALSE(pool.ordered());
+
+    assert_hierarchical(pool);
+
+    ASSERT_EQ(pool.index(entity[1u]), 0u);
+}
+
+TEST(HierarchyMixin, Insert) {
+    entt::hierarchy_mixin<entt::storage<node>, &node::parent> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+    const std::array value{node{entity[1u]}, node{}};
+
+    pool.insert(entity.begin(), entity.end(), value.begin());
+
+    ASSERT_FALSE(pool.ordered());
+
+    assert_hierarchical(pool);
+
+    pool.insert(entity.begin(), entity.begin(), node{});
+
+    ASSERT_TRUE(pool.ordered());
+}
+
+TEST(HierarchyMixin, InPlaceDelete) {
+    entt::hierarchy_mixin<entt::storage<stable_node>, &stable_node::parent> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}};
+
+    pool.emplace(entity[0u]);
+    pool.emplace(entity[1u], entity[0u]);
+    pool.erase(entity[0u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+
+    // the tombstone is reused by the child
+    pool.emplace(entity[2u], entity[1u]);
+
+    ASSERT_FALSE(pool.ordered());
+
+    assert_hierarchical(pool);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_LT(pool.index(entity[1u]), pool.index(entity[2u]));
+}
+
+TEST(HierarchyMixin, Move) {
+    entt::hierarchy_mixin<entt::storage<node>, &node::parent> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+
+    static_assert(std::is_move_constructible_v<decltype(pool)>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<decltype(pool)>, "Move assignable type required");
+
+    pool.emplace(entity[0u], entity[1u]);
+    pool.emplace(entity[1u]);
+
+    entt::hierarchy_mixin<entt::storage<node>, &node::parent> other{std::move(pool)};
+
+    test::is_initialized(pool);
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_TRUE(pool.ordered());
+    ASSERT_FALSE(other.ordered());
+
+    pool = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_FALSE(pool.ordered());
+    ASSERT_TRUE(other.ordered());
+
+    pool.swap(other);
+
+    ASSERT_TRUE(pool.ordered());
+    ASSERT_FALSE(other.ordered());
+
+    assert_hierarchical(other);
+}
+
+TEST(HierarchyMixin, Registry) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+    auto &&storage = registry.storage<node>();
+
+    registry.emplace<node>(entity[1u], entity[0u]);
+    registry.emplace<node>(entity[0u]);
+    registry.emplace<node>(entity[2u], entity[1u]);
+
+    ASSERT_FALSE(storage.ordered());
+
+    assert_hierarchical(storage);
+
+    registry.replace<node>(entity[1u]);
+    registry.emplace_or_replace<node>(entity[0u], entity[1u]);
+
+    ASSERT_FALSE(storage.ordered());
+
+    assert_hierarchical(storage);
+
+    ASSERT_EQ(storage.index(entity[1u]), 0u);
+
+    registry.destroy(entity[1u]);
+
+    ASSERT_EQ(storage.size(), 2u);
+
+    assert_hierarchical(storage);
+
+    registry.clear();
+
+    ASSERT_TRUE(storage.ordered());
+}
+
+ENTT_DEBUG_TEST(HierarchyMixinDeathTest, Cycle) {
+    entt::hierarchy_mixin<entt::storage<node>, &node::parent> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+
+    pool.emplace(entity[0u], entity[1u]);
+    pool.emplace(entity[1u], entity[0u]);
+
+    ASSERT_DEATH(pool.refresh(), "");
+}
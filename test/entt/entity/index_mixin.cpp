@@ -0,0 +1,182 @@
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include "../../common/config.h"
+#include "../../common/linter.hpp"
+
+struct indexed {
+    int key;
+    char payload;
+};
+
+struct stable_indexed {
+    static constexpr auto in_place_delete = true;
+    int key;
+};
+
+void count_update(std::size_t &count, const entt::registry &, const entt::entity) {
+    ++count;
+}
+
+template<>
+struct entt::storage_type<indexed> {
+    using type = entt::sigh_mixin<entt::index_mixin<entt::storage<indexed>, &indexed::key>>;
+};
+
+TEST(IndexMixin, Functionalities) {
+    entt::index_mixin<entt::storage<indexed>, &indexed::key> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}};
+
+    ASSERT_EQ(pool.find_by(0), static_cast<entt::entity>(entt::null));
+    ASSERT_FALSE(pool.contains_key(0));
+
+    pool.emplace(entity[0u], 2, 'a');
+    pool.emplace(entity[1u], indexed{4, 'b'});
+
+    ASSERT_TRUE(pool.contains_key(2));
+    ASSERT_TRUE(pool.contains_key(4));
+    ASSERT_EQ(pool.find_by(2), entity[0u]);
+    ASSERT_EQ(pool.find_by(4), entity[1u]);
+
+    pool.patch(entity[0u], [](auto &elem) { elem.key = 8; });
+
+    ASSERT_FALSE(pool.contains_key(2));
+    ASSERT_EQ(pool.find_by(8), entity[0u]);
+
+    pool.patch(entity[1u], [](auto &elem) { elem.payload = 'c'; });
+
+    ASSERT_EQ(pool.find_by(4), entity[1u]);
+
+    pool.erase(entity[0u]);
+
+    ASSERT_FALSE(pool.contains_key(8));
+    ASSERT_EQ(pool.find_by(4), entity[1u]);
+
+    pool.insert(entity.begin() + 2u, entity.end(), indexed{16, 'd'});
+
+    ASSERT_EQ(pool.find_by(16), entity[2u]);
+    ASSERT_EQ(pool.find_by(4), entity[1u]);
+
+    pool.clear();
+
+    ASSERT_FALSE(pool.contains_key(4));
+    ASSERT_FALSE(pool.contains_key(16));
+    ASSERT_EQ(pool.find_by(4), static_cast<entt::entity>(entt::null));
+}
+
+TEST(IndexMixin, Insert) {
+    entt::index_mixin<entt::storage<indexed>, &indexed::key> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+    const std::array value{indexed{2, 'a'}, indexed{4, 'b'}};
+
+    pool.insert(entity.begin(), entity.end(), value.begin());
+
+    ASSERT_EQ(pool.find_by(2), entity[0u]);
+    ASSERT_EQ(pool.find_by(4), entity[1u]);
+
+    pool.remove(entity.begin(), entity.end());
+
+    ASSERT_FALSE(pool.contains_key(2));
+    ASSERT_FALSE(pool.contains_key(4));
+}
+
+TEST(IndexMixin, InPlaceDelete) {
+    entt::index_mixin<entt::storage<stable_indexed>, &stable_indexed::key> pool;
+    entt::sparse_set &base = pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+    const stable_indexed value{4};
+
+    pool.emplace(entity[0u], 2);
+    base.push(entity[1u], &value);
+
+    ASSERT_EQ(pool.find_by(2), entity[0u]);
+    ASSERT_EQ(pool.find_by(4), entity[1u]);
+
+    base.erase(entity[0u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_FALSE(pool.contains_key(2));
+    ASSERT_EQ(pool.find_by(4), entity[1u]);
+
+    pool.clear();
+
+    ASSERT_FALSE(pool.contains_key(4));
+}
+
+TEST(IndexMixin, Move) {
+    entt::index_mixin<entt::storage<indexed>, &indexed::key> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+
+    static_assert(std::is_move_constructible_v<decltype(pool)>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<decltype(pool)>, "Move assignable type required");
+
+    pool.emplace(entity[0u], 2);
+
+    entt::index_mixin<entt::storage<indexed>, &indexed::key> other{std::move(pool)};
+
+    test::is_initialized(pool);
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(other.find_by(2), entity[0u]);
+
+    pool = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_EQ(pool.find_by(2), entity[0u]);
+
+    other.emplace(entity[1u], 4);
+    pool.swap(other);
+
+    ASSERT_EQ(pool.find_by(4), entity[1u]);
+    ASSERT_FALSE(pool.contains_key(2));
+    ASSERT_EQ(other.find_by(2), entity[0u]);
+    ASSERT_FALSE(other.contains_key(4));
+}
+
+TEST(IndexMixin, Registry) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create()};
+    auto &&storage = registry.storage<indexed>();
+    std::size_t updated{};
+
+    registry.on_update<indexed>().connect<&count_update>(updated);
+
+    registry.emplace<indexed>(entity[0u], 2);
+    registry.emplace_or_replace<indexed>(entity[1u], 4);
+
+    ASSERT_EQ(storage.find_by(2), entity[0u]);
+    ASSERT_EQ(storage.find_by(4), entity[1u]);
+
+    registry.replace<indexed>(entity[0u], 8);
+    registry.emplace_or_replace<indexed>(entity[1u], 16);
+
+    ASSERT_EQ(updated, 2u);
+    ASSERT_FALSE(storage.contains_key(2));
+    ASSERT_FALSE(storage.contains_key(4));
+    ASSERT_EQ(storage.find_by(8), entity[0u]);
+    ASSERT_EQ(storage.find_by(16), entity[1u]);
+
+    registry.destroy(entity[0u]);
+
+    ASSERT_FALSE(storage.contains_key(8));
+    ASSERT_EQ(storage.find_by(16), entity[1u]);
+
+    registry.clear();
+
+    ASSERT_FALSE(storage.contains_key(16));
+}
+
+ENTT_DEBUG_TEST(IndexMixinDeathTest, DuplicateKey) {
+    entt::index_mixin<entt::storage<indexed>, &indexed::key> pool;
+
+    pool.emplace(entt::entity{1}, 2);
+
+    ASSERT_DEATH(pool.emplace(entt::entity{3}, 2), "");
+}
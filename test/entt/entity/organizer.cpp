@@ -8,12 +8,16 @@
 #include <entt/entity/organizer.hpp>
 #include <entt/entity/registry.hpp>
 #include <entt/entity/view.hpp>
+#include "../../common/config.h"
 
 void ro_int_rw_char_double(entt::view<entt::get_t<const int, char>>, double &) {}
 void ro_char_rw_int(entt::group<entt::owned_t<int>, entt::get_t<const char>>) {}
 void ro_char_rw_double(entt::view<entt::get_t<const char>>, double &) {}
 void ro_int_double(entt::view<entt::get_t<const int>>, const double &) {}
 void sync_point(entt::registry &, entt::view<entt::get_t<const int>>) {}
+void scale(const entt::entity, int &value, const char &factor) {
+    value *= factor;
+}
 
 struct clazz {
     void ro_int_char_double(entt::view<entt::get_t<const int, const char>>, const double &) {}
@@ -439,6 +443,74 @@ TEST(Organizer, Override) {
     ASSERT_EQ(graph[1u].out_edges()[0u], 2u);
 }
 
+TEST(Organizer, Commutative) {
+    entt::organizer organizer;
+
+    organizer.emplace<&ro_char_rw_int>("t1");
+    organizer.emplace<&ro_int_double, entt::commutative<int>>("t2");
+    organizer.emplace<&ro_int_double, entt::commutative<int>>("t3");
+    organizer.emplace<&ro_int_double>("t4");
+    organizer.emplace<&ro_int_double, entt::commutative<int>>("t5");
+
+    const auto graph = organizer.graph();
+
+    ASSERT_EQ(graph.size(), 5u);
+
+    ASSERT_EQ(graph[1u].ro_count(), 1u);
+    ASSERT_EQ(graph[1u].rw_count(), 2u);
+
+    ASSERT_TRUE(graph[0u].top_level());
+    ASSERT_FALSE(graph[1u].top_level());
+    ASSERT_FALSE(graph[2u].top_level());
+
+    // commutative writers only wait for the last writer
+    ASSERT_EQ(graph[1u].in_edges().size(), 1u);
+    ASSERT_EQ(graph[2u].in_edges().size(), 1u);
+
+    ASSERT_EQ(graph[1u].in_edges()[0u], 0u);
+    ASSERT_EQ(graph[2u].in_edges()[0u], 0u);
+
+    // the next reader waits for all commutative writers
+    ASSERT_EQ(graph[3u].in_edges().size(), 2u);
+
+    ASSERT_EQ(graph[3u].in_edges()[0u], 1u);
+    ASSERT_EQ(graph[3u].in_edges()[1u], 2u);
+
+    ASSERT_EQ(graph[4u].in_edges().size(), 1u);
+    ASSERT_EQ(graph[4u].in_edges()[0u], 3u);
+
+    ASSERT_EQ(graph[0u].out_edges().size(), 2u);
+    ASSERT_EQ(graph[4u].out_edges().size(), 0u);
+}
+
+TEST(Organizer, HasWork) {
+    entt::organizer organizer;
+    entt::registry registry;
+
+    organizer.emplace<&ro_int_double>("t1");
+    organizer.emplace<&ro_char_rw_int>("t2");
+    organizer.emplace_chunked<&scale>(2u, "t3");
+    organizer.emplace(+[](const void *, entt::registry &) {}, nullptr, "t4");
+
+    const auto graph = organizer.graph();
+
+    ASSERT_TRUE(graph[0u].has_work(registry));
+    ASSERT_FALSE(graph[1u].has_work(registry));
+    ASSERT_FALSE(graph[2u].has_work(registry));
+    ASSERT_TRUE(graph[3u].has_work(registry));
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity);
+
+    ASSERT_FALSE(graph[1u].has_work(registry));
+    ASSERT_FALSE(graph[2u].has_work(registry));
+
+    registry.emplace<char>(entity);
+
+    ASSERT_TRUE(graph[1u].has_work(registry));
+    ASSERT_TRUE(graph[2u].has_work(registry));
+}
+
 TEST(Organizer, Prepare) {
     entt::organizer organizer;
     entt::registry registry;
@@ -517,6 +589,104 @@ TEST(Organizer, Dependencies) {
     ASSERT_EQ(*buffer[0u], entt::type_id<char>());
 }
 
+TEST(Organizer, Erase) {
+    entt::organizer organizer;
+
+    organizer.emplace<&ro_int_rw_char_double>("t1");
+    organizer.emplace<&ro_char_rw_int>("t2");
+    organizer.emplace<&ro_char_rw_double>("t3");
+    organizer.emplace<&ro_int_double>("t4");
+
+    ASSERT_EQ(organizer.size(), 4u);
+    ASSERT_EQ(organizer.graph()[3u].in_edges().size(), 2u);
+
+    organizer.erase(1u);
+
+    auto graph = organizer.graph();
+
+    ASSERT_EQ(organizer.size(), 3u);
+    ASSERT_EQ(graph.size(), 3u);
+
+    ASSERT_STREQ(graph[1u].name(), "t3");
+    ASSERT_STREQ(graph[2u].name(), "t4");
+
+    ASSERT_EQ(graph[0u].out_edges().size(), 1u);
+    ASSERT_EQ(graph[0u].out_edges()[0u], 1u);
+    ASSERT_EQ(graph[1u].in_edges().size(), 1u);
+    ASSERT_EQ(graph[1u].in_edges()[0u], 0u);
+    ASSERT_EQ(graph[2u].in_edges().size(), 1u);
+    ASSERT_EQ(graph[2u].in_edges()[0u], 1u);
+
+    organizer.emplace<&ro_char_rw_int>("t2");
+    graph = organizer.graph();
+
+    ASSERT_EQ(graph.size(), 4u);
+    ASSERT_STREQ(graph[3u].name(), "t2");
+
+    ASSERT_EQ(graph[2u].out_edges().size(), 1u);
+    ASSERT_EQ(graph[2u].out_edges()[0u], 3u);
+    ASSERT_EQ(graph[3u].in_edges().size(), 1u);
+    ASSERT_EQ(graph[3u].in_edges()[0u], 2u);
+
+    organizer.erase(0u);
+    graph = organizer.graph();
+
+    ASSERT_STREQ(graph[0u].name(), "t3");
+    ASSERT_TRUE(graph[0u].top_level());
+    ASSERT_EQ(graph[0u].out_edges().size(), 1u);
+    ASSERT_EQ(graph[2u].in_edges().size(), 1u);
+    ASSERT_EQ(graph[2u].in_edges()[0u], 1u);
+}
+
+TEST(Organizer, EmplaceChunked) {
+    entt::organizer organizer;
+    entt::registry registry;
+
+    organizer.emplace<&ro_char_rw_int>("t1");
+    organizer.emplace_chunked<&scale>(2u, "t2");
+    organizer.emplace<&ro_int_double>("t3");
+
+    const auto graph = organizer.graph();
+
+    ASSERT_EQ(graph.size(), 3u);
+
+    ASSERT_EQ(graph[1u].ro_count(), 1u);
+    ASSERT_EQ(graph[1u].rw_count(), 1u);
+    ASSERT_EQ(graph[1u].grain(), 2u);
+    ASSERT_EQ(graph[1u].in_edges().size(), 1u);
+    ASSERT_EQ(graph[1u].out_edges().size(), 1u);
+
+    for(auto &&vertex: graph) {
+        vertex.prepare(registry);
+    }
+
+    for(int value{1}; value < 6; ++value) {
+        const auto entity = registry.create();
+        registry.emplace<int>(entity, value);
+        registry.emplace<char>(entity, static_cast<char>(2));
+    }
+
+    ASSERT_EQ(graph[0u].chunks(registry), 1u);
+    ASSERT_EQ(graph[1u].chunks(registry), 3u);
+
+    graph[1u].chunk(registry, 2u);
+
+    // chunks are visited in the same order of a view, from the last element
+    ASSERT_EQ(registry.storage<int>().rbegin()[0u], 2);
+    ASSERT_EQ(registry.storage<int>().rbegin()[1u], 2);
+
+    graph[1u].callback()(graph[1u].data(), registry);
+
+    ASSERT_EQ(registry.storage<int>().rbegin()[0u], 4);
+    ASSERT_EQ(registry.storage<int>().rbegin()[4u], 10);
+}
+
+ENTT_DEBUG_TEST(OrganizerDeathTest, Erase) {
+    entt::organizer organizer;
+
+    ASSERT_DEATH(organizer.erase(0u), "");
+}
+
 TEST(Organizer, ToArgsIntegrity) {
     entt::organizer organizer;
     entt::registry registry;
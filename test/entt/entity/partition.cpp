@@ -0,0 +1,162 @@
+#include <array>
+#include <cstddef>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/partition.hpp>
+#include <entt/entity/registry.hpp>
+#include "../../common/config.h"
+
+TEST(PartitionedRegistry, Constructors) {
+    static_assert(!std::is_copy_constructible_v<entt::partitioned_registry>, "Copy constructible type not allowed");
+    static_assert(!std::is_copy_assignable_v<entt::partitioned_registry>, "Copy assignable type not allowed");
+    static_assert(std::is_move_constructible_v<entt::partitioned_registry>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<entt::partitioned_registry>, "Move assignable type required");
+
+    const entt::partitioned_registry registry{4u};
+
+    ASSERT_EQ(registry.size(), 4u);
+    ASSERT_NE(&registry.partition(0u), &registry.partition(1u));
+    ASSERT_NE(&registry.partition(0u), &registry.global());
+}
+
+TEST(PartitionedRegistry, Functionalities) {
+    entt::partitioned_registry registry{2u};
+    std::array<entt::entity, 2u> entity{};
+
+    const auto first = registry.create(0u);
+    registry.create(1u, entity.begin(), entity.end());
+
+    ASSERT_NE(first, entity[0u]);
+    ASSERT_NE(entity[0u], entity[1u]);
+    ASSERT_TRUE(registry.global().valid(first));
+    ASSERT_TRUE(registry.partition(0u).valid(first));
+    ASSERT_FALSE(registry.partition(1u).valid(first));
+    ASSERT_TRUE(registry.partition(1u).valid(entity[1u]));
+
+    ASSERT_EQ(registry.locate(first), 0u);
+    ASSERT_EQ(registry.locate(entity[0u]), 1u);
+
+    registry.global().emplace<int>(entity[0u], 3);
+    registry.destroy(entity[0u]);
+
+    ASSERT_EQ(registry.locate(entity[0u]), registry.size());
+    ASSERT_FALSE(registry.global().valid(entity[0u]));
+    ASSERT_TRUE(registry.global().storage<int>().empty());
+
+    // identifiers are recycled by the global registry for all partitions
+    const auto other = registry.create(0u);
+
+    ASSERT_EQ(entt::to_entity(other), entt::to_entity(entity[0u]));
+    ASSERT_NE(other, entity[0u]);
+    ASSERT_EQ(registry.locate(other), 0u);
+}
+
+TEST(PartitionedRegistry, Migrate) {
+    entt::partitioned_registry registry{2u};
+    std::array<entt::entity, 3u> entity{};
+
+    registry.prepare<int, char>();
+    registry.create(0u, entity.begin(), entity.end());
+
+    registry.partition(0u).emplace<int>(entity[0u], 1);
+    registry.partition(0u).emplace<int>(entity[1u], 2);
+    registry.partition(0u).emplace<char>(entity[1u], 'c');
+    registry.global().emplace<double>(entity[1u], .5);
+
+    registry.migrate(0u, 1u, entity.begin(), entity.begin() + 2u);
+
+    ASSERT_EQ(registry.locate(entity[0u]), 1u);
+    ASSERT_EQ(registry.locate(entity[1u]), 1u);
+    ASSERT_EQ(registry.locate(entity[2u]), 0u);
+
+    ASSERT_TRUE(registry.partition(0u).storage<int>().empty());
+    ASSERT_EQ(registry.partition(1u).get<int>(entity[0u]), 1);
+    ASSERT_EQ((registry.partition(1u).get<int, char>(entity[1u])), (std::make_tuple(2, 'c')));
+    ASSERT_EQ(registry.global().get<double>(entity[1u]), .5);
+
+    registry.migrate(1u, 0u, entity.begin(), entity.begin() + 1u);
+
+    ASSERT_EQ(registry.locate(entity[0u]), 0u);
+    ASSERT_EQ(registry.partition(0u).get<int>(entity[0u]), 1);
+}
+
+TEST(PartitionedRegistry, View) {
+    entt::partitioned_registry registry{2u};
+    const auto entity = registry.create(1u);
+    const auto other = registry.create(1u);
+
+    registry.partition(1u).emplace<int>(entity, 1);
+    registry.partition(1u).emplace<int>(other, 2);
+
+    auto view = registry.view<int>(1u, entt::get<char>);
+
+    static_assert(std::is_same_v<decltype(view.get<char>(entity)), const char &>, "Unexpected type");
+
+    // missing pools of the global registry aren't created
+    ASSERT_FALSE(view);
+    ASSERT_EQ(std::as_const(registry.global()).storage<char>(), nullptr);
+
+    registry.global().emplace<char>(other, 'c');
+    view = registry.view<int>(1u, entt::get<char>);
+
+    ASSERT_TRUE(view);
+    ASSERT_EQ(view.size_hint(), 1u);
+
+    view.each([other](const auto entt, const int value, const char elem) {
+        ASSERT_EQ(entt, other);
+        ASSERT_EQ(value, 2);
+        ASSERT_EQ(elem, 'c');
+    });
+}
+
+TEST(PartitionedRegistry, Threads) {
+    entt::partitioned_registry registry{4u};
+    std::array<std::thread, 4u> worker{};
+
+    for(std::size_t pos{}; pos < registry.size(); ++pos) {
+        for(int count{}; count < 16; ++count) {
+            registry.partition(pos).emplace<int>(registry.create(pos), count);
+        }
+
+        registry.global().emplace<char>(registry.create(pos), 'c');
+    }
+
+    for(std::size_t pos{}; pos < worker.size(); ++pos) {
+        worker[pos] = std::thread{[&registry, pos]() {
+            for(auto [entt, value]: registry.view<int>(pos).each()) {
+                value *= 2;
+            }
+        }};
+    }
+
+    for(auto &&elem: worker) {
+        elem.join();
+    }
+
+    for(std::size_t pos{}; pos < registry.size(); ++pos) {
+        int sum{};
+
+        for(auto [entt, value]: registry.partition(pos).view<int>().each()) {
+            sum += value;
+        }
+
+        ASSERT_EQ(sum, 16 * 15);
+    }
+
+    ASSERT_EQ(registry.global().storage<entt::entity>().free_list(), 68u);
+}
+
+ENTT_DEBUG_TEST(PartitionedRegistryDeathTest, Migrate) {
+    entt::partitioned_registry registry{2u};
+    const auto entity = registry.create(0u);
+
+    registry.partition(0u).emplace<int>(entity);
+
+    ASSERT_DEATH(registry.migrate(0u, 0u, &entity, &entity + 1u), "");
+    ASSERT_DEATH(registry.migrate(1u, 0u, &entity, &entity + 1u), "");
+    ASSERT_DEATH(registry.migrate(0u, 1u, &entity, &entity + 1u), "");
+}
@@ -0,0 +1,172 @@
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/poly_view.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include "../../common/config.h"
+
+struct shape {
+    shape() = default;
+    shape(const shape &) = default;
+    shape(shape &&) = default;
+    shape &operator=(const shape &) = default;
+    shape &operator=(shape &&) = default;
+    virtual ~shape() = default;
+
+    [[nodiscard]] virtual int area() const = 0;
+};
+
+struct square final: shape {
+    square(int len = 0)
+        : side{len} {}
+
+    [[nodiscard]] int area() const override {
+        return side * side;
+    }
+
+    int side;
+};
+
+struct rectangle final: shape {
+    rectangle(int len = 0, int other = 0)
+        : width{len},
+          height{other} {}
+
+    [[nodiscard]] int area() const override {
+        return width * height;
+    }
+
+    int width;
+    int height;
+};
+
+struct stable_square final: shape {
+    static constexpr auto in_place_delete = true;
+
+    [[nodiscard]] int area() const override {
+        return 1;
+    }
+};
+
+TEST(PolyView, Functionalities) {
+    entt::storage<square> squares{};
+    entt::storage<rectangle> rectangles{};
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{5}};
+    entt::basic_poly_view<shape, entt::storage<square>, entt::storage<rectangle>> view{};
+
+    ASSERT_FALSE(view);
+
+    view.storage(squares);
+    view.storage<1u>(rectangles);
+
+    ASSERT_TRUE(view);
+    ASSERT_EQ(view.storage<square>(), &squares);
+    ASSERT_EQ(view.storage<1u>(), &rectangles);
+
+    ASSERT_TRUE(view.empty());
+    ASSERT_EQ(view.size(), 0u);
+    ASSERT_FALSE(view.contains(entity[0u]));
+    ASSERT_EQ(view.try_get(entity[0u]), nullptr);
+
+    squares.emplace(entity[0u], 2);
+    rectangles.emplace(entity[1u], 2, 3);
+    squares.emplace(entity[2u], 1);
+    rectangles.emplace(entity[2u], 1, 4);
+
+    ASSERT_FALSE(view.empty());
+    ASSERT_EQ(view.size(), 4u);
+    ASSERT_TRUE(view.contains(entity[0u]));
+    ASSERT_TRUE(view.contains(entity[1u]));
+    ASSERT_FALSE(view.contains(entt::entity{0}));
+
+    ASSERT_EQ(view.try_get(entity[0u]), &squares.get(entity[0u]));
+    ASSERT_EQ(view.get(entity[1u]).area(), 6);
+    // the first storage wins
+    ASSERT_EQ(view.get(entity[2u]).area(), 1);
+}
+
+TEST(PolyView, Each) {
+    entt::storage<square> squares{};
+    entt::storage<rectangle> rectangles{};
+    entt::basic_poly_view<const shape, entt::storage<square>, entt::storage<rectangle>> view{squares, rectangles};
+
+    squares.emplace(entt::entity{1}, 2);
+    squares.emplace(entt::entity{0}, 1);
+    rectangles.emplace(entt::entity{2}, 2, 3);
+
+    std::size_t count{};
+    int total{};
+
+    view.each([&count, &total](auto &elem) {
+        // element types are preserved, calls aren't virtual
+        static_assert(!std::is_same_v<std::remove_const_t<std::remove_reference_t<decltype(elem)>>, shape>, "Unexpected type");
+        total += elem.area();
+        ++count;
+    });
+
+    ASSERT_EQ(count, 3u);
+    ASSERT_EQ(total, 11);
+
+    count = 0u;
+
+    view.each([&count](const entt::entity entt, const shape &elem) {
+        ASSERT_EQ(elem.area(), (entt == entt::entity{0}) ? 1 : ((entt == entt::entity{1}) ? 4 : 6));
+        ++count;
+    });
+
+    ASSERT_EQ(count, 3u);
+
+    count = 0u;
+
+    view.visit([&count](auto &storage) {
+        count += storage.size();
+    });
+
+    ASSERT_EQ(count, 3u);
+}
+
+TEST(PolyView, EachPointerStable) {
+    entt::storage<stable_square> squares{};
+    entt::storage<square> others{};
+    const entt::basic_poly_view<shape, entt::storage<stable_square>, entt::storage<square>> view{squares, others};
+
+    squares.emplace(entt::entity{0});
+    squares.emplace(entt::entity{1});
+    squares.emplace(entt::entity{2});
+    others.emplace(entt::entity{1}, 3);
+    squares.erase(entt::entity{1});
+
+    int total{};
+    view.each([&total](const shape &elem) { total += elem.area(); });
+
+    ASSERT_EQ(total, 11);
+    ASSERT_EQ(view.get(entt::entity{1}).area(), 9);
+}
+
+TEST(PolyView, Registry) {
+    entt::registry registry{};
+    const auto entity = registry.create();
+
+    registry.emplace<square>(entity, 3);
+    registry.emplace<rectangle>(registry.create(), 1, 2);
+
+    const entt::poly_view<shape, square, rectangle> view{registry.storage<square>(), registry.storage<rectangle>()};
+    int total{};
+
+    view.each([&total](const auto, auto &elem) { total += elem.area(); });
+
+    ASSERT_EQ(total, 11);
+    ASSERT_EQ(&view.get(entity), &registry.get<square>(entity));
+}
+
+ENTT_DEBUG_TEST(PolyViewDeathTest, Get) {
+    entt::storage<square> squares{};
+    entt::storage<rectangle> rectangles{};
+    const entt::basic_poly_view<shape, entt::storage<square>, entt::storage<rectangle>> view{squares, rectangles};
+
+    ASSERT_DEATH([[maybe_unused]] auto &elem = view.get(entt::entity{0}), "");
+}
@@ -1,4 +1,5 @@
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -55,6 +56,10 @@ struct listener {
     int counter{0};
 };
 
+void push_storage_id(std::vector<entt::id_type> &vec, entt::registry &, const entt::id_type id) {
+    vec.push_back(id);
+}
+
 struct owner {
     void receive(const entt::registry &ref) {
         parent = &ref;
@@ -92,11 +97,25 @@ struct entity_traits {
     static constexpr entity_type version_mask = 0x00;
 };
 
+struct other_entity_traits {
+    using value_type = test::other_entity;
+    using entity_type = uint32_t;
+    using version_type = uint16_t;
+    static constexpr entity_type entity_mask = 0xFFFF;
+    static constexpr entity_type version_mask = 0x0FFF;
+    static constexpr entity_type disabled_mask = 0x10000000;
+};
+
 template<>
 struct entt::entt_traits<test::entity>: entt::basic_entt_traits<entity_traits> {
     static constexpr auto page_size = ENTT_SPARSE_PAGE;
 };
 
+template<>
+struct entt::entt_traits<test::other_entity>: entt::basic_entt_traits<other_entity_traits> {
+    static constexpr auto page_size = ENTT_SPARSE_PAGE;
+};
+
 TEST(Registry, Functionalities) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -571,6 +590,291 @@ ENTT_DEBUG_TEST(RegistryDeathTest, StorageReset) {
     ASSERT_TRUE(registry.valid(entity));
 }
 
+TEST(Registry, SparsePageSize) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    registry.emplace<int>(entity);
+
+    ASSERT_EQ(registry.sparse_page_size(), 0u);
+    ASSERT_EQ(registry.storage<int>().sparse_page_size(), ENTT_SPARSE_PAGE);
+
+    registry.sparse_page_size(64u);
+
+    ASSERT_EQ(registry.sparse_page_size(), 64u);
+    ASSERT_EQ(registry.storage<entt::entity>().sparse_page_size(), 64u);
+    ASSERT_EQ(registry.storage<int>().sparse_page_size(), 64u);
+    ASSERT_EQ(registry.storage<char>().sparse_page_size(), 64u);
+
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_TRUE(registry.all_of<int>(entity));
+
+    entt::registry other{};
+    other.swap(registry);
+
+    ASSERT_EQ(registry.sparse_page_size(), 0u);
+    ASSERT_EQ(other.sparse_page_size(), 64u);
+}
+
+TEST(Registry, MemoryUsage) {
+    entt::registry registry{};
+
+    ASSERT_EQ(registry.memory_usage().bytes(), 0u);
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity);
+    registry.emplace<char>(entity);
+    registry.destroy(registry.create());
+
+    const auto report = registry.memory_usage();
+    auto expected = registry.storage<entt::entity>().memory_usage();
+
+    expected += registry.storage<int>().memory_usage();
+    expected += registry.storage<char>().memory_usage();
+
+    ASSERT_EQ(report.bytes(), expected.bytes());
+    ASSERT_EQ(report.sparse_pages, 3u);
+    ASSERT_EQ(report.element_pages, 2u);
+    ASSERT_EQ(report.free_list, 1u);
+}
+
+TEST(Registry, Prepare) {
+    entt::registry registry{};
+
+    ASSERT_EQ(std::as_const(registry).storage<int>(), nullptr);
+    ASSERT_EQ(std::as_const(registry).storage<char>(), nullptr);
+
+    registry.prepare<int, const char>();
+
+    ASSERT_NE(std::as_const(registry).storage<int>(), nullptr);
+    ASSERT_NE(std::as_const(registry).storage<char>(), nullptr);
+    ASSERT_EQ(std::as_const(registry).storage<double>(), nullptr);
+}
+
+TEST(Registry, DeepCopyFrom) {
+    entt::registry registry{};
+    entt::registry other{};
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+    listener listener{};
+
+    registry.emplace<int>(entity[0u], 1);
+    registry.emplace<int>(entity[2u], 3);
+    registry.emplace<test::pointer_stable>(entity[1u], 2);
+    registry.emplace<test::pointer_stable>(entity[2u], 4);
+    registry.destroy(entity[0u]);
+
+    other.prepare<int, test::pointer_stable, char>();
+    other.emplace<char>(other.create(), 'c');
+    other.on_construct<int>().connect<&listener::incr>(listener);
+    other.deep_copy_from(registry);
+
+    ASSERT_EQ(listener.counter, 0);
+    ASSERT_FALSE(other.valid(entity[0u]));
+    ASSERT_TRUE(other.valid(entity[1u]));
+    ASSERT_TRUE(other.valid(entity[2u]));
+    ASSERT_TRUE(other.storage<char>().empty());
+
+    ASSERT_EQ(other.storage<int>().size(), 1u);
+    ASSERT_EQ(other.get<int>(entity[2u]), 3);
+    ASSERT_EQ(other.storage<test::pointer_stable>().size(), 2u);
+    ASSERT_EQ(other.storage<test::pointer_stable>().index(entity[2u]), 1u);
+    ASSERT_EQ(other.get<test::pointer_stable>(entity[1u]).value, 2);
+
+    ASSERT_EQ(other.create(), registry.create());
+
+    other.emplace<int>(entity[1u]);
+
+    ASSERT_EQ(listener.counter, 1);
+    ASSERT_FALSE(registry.all_of<int>(entity[1u]));
+}
+
+ENTT_DEBUG_TEST(RegistryDeathTest, DeepCopyFrom) {
+    entt::registry registry{};
+    entt::registry other{};
+
+    registry.prepare<int>();
+
+    ASSERT_DEATH(other.deep_copy_from(registry), "");
+
+    other.prepare<int, char>();
+    other.group<int>(entt::get<char>);
+
+    ASSERT_DEATH(other.deep_copy_from(registry), "");
+}
+
+TEST(Registry, Transfer) {
+    entt::registry registry{};
+    entt::registry other{};
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+    std::array<entt::entity, 2u> result{};
+    listener listener{};
+
+    registry.emplace<int>(entity[0u], 1);
+    registry.emplace<int>(entity[1u], 2);
+    registry.emplace<char>(entity[1u], 'c');
+    registry.emplace<test::pointer_stable>(entity[2u], 3);
+
+    other.prepare<int, char>();
+    other.destroy(other.create());
+    other.on_construct<int>().connect<&listener::incr>(listener);
+    registry.on_destroy<int>().connect<&listener::incr>(listener);
+    registry.transfer(other, entity.begin(), entity.begin() + 2u, result.begin());
+
+    ASSERT_EQ(listener.counter, 4);
+    ASSERT_FALSE(registry.valid(entity[0u]));
+    ASSERT_FALSE(registry.valid(entity[1u]));
+    ASSERT_TRUE(registry.valid(entity[2u]));
+    ASSERT_TRUE(registry.storage<int>().empty());
+    ASSERT_TRUE(registry.storage<char>().empty());
+
+    ASSERT_TRUE(other.valid(result[0u]));
+    ASSERT_TRUE(other.valid(result[1u]));
+    ASSERT_NE(result[0u], entity[0u]);
+    ASSERT_EQ(other.get<int>(result[0u]), 1);
+    ASSERT_EQ(other.get<int>(result[1u]), 2);
+    ASSERT_EQ(other.get<char>(result[1u]), 'c');
+    ASSERT_FALSE(other.all_of<char>(result[0u]));
+    ASSERT_EQ(other.storage<int>().size(), 2u);
+}
+
+TEST(Registry, TransferMoveOnly) {
+    entt::registry registry{};
+    entt::registry other{};
+    const std::array entity{registry.create(), registry.create()};
+    std::array<entt::entity, 2u> result{};
+
+    registry.emplace<std::unique_ptr<int>>(entity[0u], std::make_unique<int>(1));
+    registry.emplace<std::unique_ptr<int>>(entity[1u], std::make_unique<int>(2));
+    registry.emplace<int>(entity[1u], 3);
+
+    other.prepare<std::unique_ptr<int>, int>();
+
+    ASSERT_TRUE(other.storage<std::unique_ptr<int>>().movable());
+    ASSERT_TRUE(registry.transfer(other, entity.begin(), entity.end(), result.begin()));
+
+    ASSERT_FALSE(registry.valid(entity[0u]));
+    ASSERT_FALSE(registry.valid(entity[1u]));
+    ASSERT_TRUE(registry.storage<std::unique_ptr<int>>().empty());
+
+    ASSERT_NE(other.get<std::unique_ptr<int>>(result[0u]), nullptr);
+    ASSERT_EQ(*other.get<std::unique_ptr<int>>(result[0u]), 1);
+    ASSERT_EQ(*other.get<std::unique_ptr<int>>(result[1u]), 2);
+    ASSERT_EQ(other.get<int>(result[1u]), 3);
+}
+
+TEST(Registry, TransferMissingStorage) {
+    entt::registry registry{};
+    entt::registry other{};
+    const std::array entity{registry.create(), registry.create()};
+    std::array<entt::entity, 2u> result{};
+
+    registry.emplace<int>(entity[0u], 1);
+    registry.emplace<char>(entity[1u], 'c');
+    other.prepare<int>();
+
+    ASSERT_FALSE(registry.transfer(other, entity.begin(), entity.end(), result.begin()));
+
+    ASSERT_TRUE(registry.valid(entity[0u]));
+    ASSERT_TRUE(registry.valid(entity[1u]));
+    ASSERT_EQ(registry.get<int>(entity[0u]), 1);
+    ASSERT_EQ(registry.get<char>(entity[1u]), 'c');
+
+    ASSERT_TRUE(other.storage<entt::entity>().empty());
+    ASSERT_TRUE(other.storage<int>().empty());
+}
+
+ENTT_DEBUG_TEST(RegistryDeathTest, Transfer) {
+    entt::registry registry{};
+    const std::array entity{registry.create()};
+    std::array<entt::entity, 1u> result{};
+
+    registry.emplace<int>(entity[0u]);
+
+    ASSERT_DEATH(registry.transfer(registry, entity.begin(), entity.end(), result.begin()), "");
+}
+
+TEST(Registry, Freeze) {
+    entt::registry registry{};
+    const auto entity = registry.create();
+
+    registry.emplace<int>(entity, 1);
+    registry.prepare<char>();
+
+    ASSERT_FALSE(registry.frozen());
+
+    registry.freeze();
+
+    ASSERT_TRUE(registry.frozen());
+
+    registry.patch<int>(entity, [](auto &value) { ++value; });
+    registry.replace<int>(entity, registry.get<int>(entity) + 1);
+
+    ASSERT_EQ(registry.get<int>(entity), 3);
+    ASSERT_EQ(registry.view<int>().size(), 1u);
+    ASSERT_TRUE(registry.view<char>().empty());
+    ASSERT_EQ(registry.try_get<char>(entity), nullptr);
+
+    registry.freeze(false);
+
+    ASSERT_FALSE(registry.frozen());
+
+    registry.emplace<char>(entity, 'c');
+
+    ASSERT_TRUE((registry.all_of<int, char>(entity)));
+
+    entt::registry other{std::move(registry)};
+
+    other.freeze();
+    registry = std::move(other);
+
+    ASSERT_TRUE(registry.frozen());
+    ASSERT_FALSE(other.frozen());
+}
+
+TEST(Registry, OnStorage) {
+    using namespace entt::literals;
+
+    entt::registry registry{};
+    std::vector<entt::id_type> created{};
+
+    registry.on_storage().connect<&push_storage_id>(created);
+
+    registry.prepare<int>();
+    [[maybe_unused]] auto &&unused = registry.storage<int>();
+    registry.emplace<char>(registry.create());
+
+    ASSERT_EQ(std::as_const(registry).storage<double>(), nullptr);
+    ASSERT_EQ(created, (std::vector{entt::type_id<int>().hash(), entt::type_id<char>().hash()}));
+
+    entt::registry other{std::move(registry)};
+    [[maybe_unused]] auto &&named = other.storage<int>("other"_hs);
+
+    ASSERT_EQ(created.size(), 3u);
+    ASSERT_EQ(created.back(), "other"_hs);
+
+    other.on_storage().disconnect(&created);
+    other.prepare<double>();
+
+    ASSERT_EQ(created.size(), 3u);
+}
+
+ENTT_DEBUG_TEST(RegistryDeathTest, Freeze) {
+    entt::registry registry{};
+    const auto entity = registry.create();
+
+    registry.emplace<int>(entity);
+    registry.freeze();
+
+    ASSERT_DEATH([[maybe_unused]] auto &&unused = registry.storage<char>(), "");
+    ASSERT_DEATH([[maybe_unused]] auto elem = registry.create(), "");
+    ASSERT_DEATH(registry.destroy(entity), "");
+    ASSERT_DEATH(registry.emplace<char>(entity), "");
+    ASSERT_DEATH(registry.remove<int>(entity), "");
+    ASSERT_DEATH(registry.erase<int>(entity), "");
+    ASSERT_DEATH(registry.clear(), "");
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_TRUE(registry.all_of<int>(entity));
+}
+
 TEST(Registry, Identifiers) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -709,6 +1013,83 @@ TEST(Registry, CreateManyEntitiesAtOnceWithListener) {
     ASSERT_EQ(listener.counter, 6);
 }
 
+TEST(Registry, ReserveEntity) {
+    entt::registry registry{};
+    listener listener;
+
+    registry.on_construct<entt::entity>().connect<&listener::incr>(listener);
+    registry.destroy(registry.create());
+
+    ASSERT_EQ(listener.counter, 1);
+
+    const std::array entity{registry.reserve_entity(), registry.reserve_entity()};
+
+    ASSERT_NE(entity[0u], entity[1u]);
+    ASSERT_FALSE(registry.valid(entity[0u]));
+    ASSERT_FALSE(registry.valid(entity[1u]));
+
+    registry.materialize();
+
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_TRUE(registry.valid(entity[0u]));
+    ASSERT_TRUE(registry.valid(entity[1u]));
+    ASSERT_EQ(registry.storage<entt::entity>().free_list(), 2u);
+}
+
+TEST(Registry, Block) {
+    entt::registry registry{};
+    listener listener;
+
+    registry.on_construct<entt::entity>().connect<&listener::incr>(listener);
+
+    auto block = registry.acquire_block(4u);
+    const std::array entity{block.create(), block.create()};
+
+    ASSERT_EQ(block.size(), 2u);
+    ASSERT_FALSE(registry.valid(entity[0u]));
+    ASSERT_FALSE(registry.valid(entity[1u]));
+
+    registry.release_block(block);
+
+    ASSERT_EQ(listener.counter, 2);
+    ASSERT_TRUE(registry.valid(entity[0u]));
+    ASSERT_TRUE(registry.valid(entity[1u]));
+    ASSERT_EQ(registry.create(), entt::entity{2});
+}
+
+TEST(Registry, Instantiate) {
+    entt::registry registry{};
+    std::array<entt::entity, 4u> entity{};
+    auto group = registry.group<int>(entt::get<char>);
+    listener listener;
+
+    const auto prefab = registry.create();
+    registry.emplace<int>(prefab, 3);
+    registry.emplace<char>(prefab, 'c');
+    registry.emplace<test::empty>(prefab);
+    registry.emplace<double>(registry.create(), .3);
+
+    registry.on_construct<int>().connect<&listener::incr>(listener);
+    registry.instantiate(prefab, entity.begin(), entity.end());
+
+    ASSERT_EQ(listener.counter, 4);
+    ASSERT_EQ(group.size(), 5u);
+    ASSERT_EQ(registry.storage<double>().size(), 1u);
+
+    for(auto entt: entity) {
+        ASSERT_TRUE(registry.valid(entt));
+        ASSERT_NE(entt, prefab);
+        ASSERT_EQ(registry.get<int>(entt), 3);
+        ASSERT_EQ(registry.get<char>(entt), 'c');
+        ASSERT_TRUE(registry.all_of<test::empty>(entt));
+        ASSERT_FALSE(registry.all_of<double>(entt));
+    }
+
+    registry.instantiate(prefab, entity.begin(), entity.begin());
+
+    ASSERT_EQ(registry.storage<int>().size(), 5u);
+}
+
 TEST(Registry, CreateWithHint) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -836,6 +1217,70 @@ ENTT_DEBUG_TEST(RegistryDeathTest, DestroyVersion) {
     ASSERT_DEATH(registry.destroy(entity, 3), "");
 }
 
+TEST(Registry, DisableEnable) {
+    entt::basic_registry<test::other_entity> registry{};
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+    auto view = registry.view<test::other_entity, int>();
+
+    registry.insert<int>(entity.begin(), entity.end());
+
+    ASSERT_TRUE(registry.enabled(entity[0u]));
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 3);
+
+    registry.disable(entity[0u]);
+    registry.disable(entity[2u]);
+
+    ASSERT_TRUE(registry.valid(entity[0u]));
+    ASSERT_FALSE(registry.enabled(entity[0u]));
+    ASSERT_TRUE(registry.enabled(entity[1u]));
+    ASSERT_EQ(registry.current(entity[0u]), entt::to_version(entity[0u]));
+    ASSERT_EQ(registry.storage<int>().index(entity[0u]), 0u);
+    ASSERT_TRUE(registry.all_of<int>(entity[0u]));
+
+    view.use<int>();
+
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 1);
+    ASSERT_EQ(*view.begin(), entity[1u]);
+
+    view.use<test::other_entity>();
+
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 1);
+    ASSERT_EQ(*view.begin(), entity[1u]);
+
+    registry.enable(entity[0u]);
+
+    ASSERT_TRUE(registry.enabled(entity[0u]));
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 2);
+
+    registry.destroy(entity[2u]);
+
+    ASSERT_FALSE(registry.valid(entity[2u]));
+    ASSERT_FALSE(registry.enabled(entity[2u]));
+    ASSERT_EQ(registry.storage<int>().size(), 2u);
+
+    registry.disable(entity[1u]);
+    registry.destroy(entity.begin(), entity.begin() + 2u);
+
+    ASSERT_FALSE(registry.valid(entity[0u]));
+    ASSERT_FALSE(registry.valid(entity[1u]));
+    ASSERT_TRUE(registry.storage<int>().empty());
+    ASSERT_TRUE(registry.enabled(registry.create()));
+}
+
+ENTT_DEBUG_TEST(RegistryDeathTest, DisableEnable) {
+    entt::basic_registry<test::other_entity> registry{};
+    const auto entity = registry.create();
+
+    registry.disable(entity);
+
+    ASSERT_DEATH(registry.group<int>(), "");
+
+    registry.enable(entity);
+    registry.group<int>();
+
+    ASSERT_DEATH(registry.disable(entity), "");
+}
+
 TEST(Registry, DestroyRange) {
     entt::registry registry{};
     const auto iview = registry.view<int>();
@@ -1072,6 +1517,26 @@ TEST(Registry, Insert) {
     ASSERT_EQ(registry.get<float>(entity[2u]), 2.f);
 }
 
+TEST(Registry, InsertGenerator) {
+    entt::registry registry{};
+    std::array<entt::entity, 3u> entity{};
+    listener listener{};
+
+    registry.create(entity.begin(), entity.end());
+    registry.on_construct<int>().connect<&listener::incr>(listener);
+    registry.insert<int>(entity.begin(), entity.end(), [](const entt::entity entt) { return static_cast<int>(entt::to_integral(entt)) + 1; });
+
+    ASSERT_EQ(registry.get<int>(entity[0u]), 1);
+    ASSERT_EQ(registry.get<int>(entity[1u]), 2);
+    ASSERT_EQ(registry.get<int>(entity[2u]), 3);
+    ASSERT_EQ(listener.counter, 3);
+    ASSERT_EQ(listener.last, entity[2u]);
+
+    registry.insert(entity.begin(), entity.end(), 'c');
+
+    ASSERT_EQ(registry.get<char>(entity[2u]), 'c');
+}
+
 ENTT_DEBUG_TEST(RegistryDeathTest, Insert) {
     entt::registry registry{};
     const std::array entity{registry.create()};
@@ -1480,6 +1945,90 @@ TEST(Registry, Compact) {
     ASSERT_EQ(registry.storage<test::pointer_stable>().size(), 0u);
 }
 
+TEST(Registry, Defragment) {
+    entt::registry registry{};
+    std::array<entt::entity, 8u> entity{};
+    std::size_t count{};
+
+    registry.create(entity.begin(), entity.end());
+
+    registry.emplace<int>(entity[6u], 6);
+    registry.emplace<test::pointer_stable>(entity[6u], 6);
+    registry.emplace<int>(entity[7u], 7);
+    registry.emplace<int>(entity[1u], 1);
+
+    registry.destroy(entity.begin() + 2u, entity.begin() + 6u);
+    registry.destroy(entity[0u]);
+
+    registry.defragment([&count](const entt::entity, const entt::entity) { ++count; });
+
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(registry.storage<entt::entity>().free_list(), 3u);
+    ASSERT_TRUE(registry.valid(entity[1u]));
+    ASSERT_FALSE(registry.valid(entity[6u]));
+    ASSERT_FALSE(registry.valid(entity[7u]));
+    ASSERT_EQ(registry.get<int>(entity[1u]), 1);
+
+    for(auto [entt, value]: registry.view<int>().each()) {
+        ASSERT_LT(entt::to_entity(entt), 3u);
+        ASSERT_TRUE(registry.valid(entt));
+    }
+
+    const auto elem = registry.view<int, test::pointer_stable>().front();
+
+    ASSERT_TRUE((registry.all_of<int, test::pointer_stable>(elem)));
+    ASSERT_EQ(registry.get<int>(elem), 6);
+
+    registry.destroy(entity[1u]);
+
+    const auto table = registry.defragment();
+
+    ASSERT_EQ(table.size(), 1u);
+    ASSERT_FALSE(registry.valid(table.begin()->first));
+    ASSERT_TRUE(registry.valid(table.begin()->second));
+    ASSERT_EQ(entt::to_entity(table.begin()->second), 1u);
+    ASSERT_TRUE(registry.all_of<int>(table.begin()->second));
+}
+
+TEST(Registry, Trim) {
+    entt::registry registry{};
+    std::array<entt::entity, 64u> entity{};
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<int>(entity.begin(), entity.end());
+    registry.insert<char>(entity.begin(), entity.end());
+    registry.ctx().emplace<int>(3);
+
+    const auto group = registry.group(entt::get<int, char>);
+
+    ASSERT_EQ(group.size(), entity.size());
+
+    registry.destroy(entity.begin(), entity.end());
+
+    ASSERT_NE(registry.memory_usage().element_pages, 0u);
+    ASSERT_NE(group.handle().capacity(), 0u);
+
+    // the entity storage, two pools, a group and the context
+    for(std::size_t step{}; step < 4u; ++step) {
+        ASSERT_FALSE(registry.trim(std::chrono::nanoseconds::zero()));
+    }
+
+    ASSERT_EQ(registry.storage<int>().capacity(), 0u);
+    ASSERT_EQ(registry.storage<char>().capacity(), 0u);
+    ASSERT_EQ(group.handle().capacity(), 0u);
+    ASSERT_TRUE(registry.trim(std::chrono::nanoseconds::zero()));
+
+    ASSERT_EQ(registry.memory_usage().element_pages, 0u);
+    ASSERT_EQ(registry.storage<int>().memory_usage().sparse_pages, 0u);
+    ASSERT_EQ(registry.ctx().get<int>(), 3);
+
+    registry.emplace<int>(registry.create());
+    registry.trim();
+
+    ASSERT_EQ(registry.storage<int>().size(), 1u);
+    ASSERT_EQ(registry.storage<char>().capacity(), 0u);
+}
+
 TEST(Registry, AllAnyOf) {
     entt::registry registry{};
     const auto entity = registry.create();
@@ -1620,6 +2169,75 @@ TEST(Registry, Orphan) {
     }
 }
 
+TEST(Registry, ManyPools) {
+    using namespace entt::literals;
+
+    entt::registry registry{};
+    std::array<entt::entity, 4u> entity{};
+    constexpr entt::id_type count = 130u;
+
+    registry.create(entity.begin(), entity.end());
+
+    // enough named pools to exceed the size of a machine word a couple of times
+    for(entt::id_type id{}; id < count; ++id) {
+        auto &storage = registry.storage<int>("pool"_hs + id);
+        storage.emplace(entity[id % 2u]);
+
+        if(id % 3u == 0u) {
+            storage.emplace(entity[2u]);
+        }
+    }
+
+    registry.emplace<test::pointer_stable>(entity[3u]);
+    registry.emplace<char>(entity[1u]);
+
+    ASSERT_FALSE(registry.orphan(entity[0u]));
+    ASSERT_FALSE(registry.orphan(entity[2u]));
+    ASSERT_TRUE((registry.all_of<test::pointer_stable>(entity[3u])));
+    ASSERT_FALSE((registry.any_of<test::pointer_stable, char>(entity[0u])));
+    ASSERT_TRUE((registry.any_of<test::pointer_stable, char>(entity[1u])));
+
+    registry.destroy(entity[0u]);
+    const auto other = registry.create();
+
+    ASSERT_EQ(entt::to_entity(other), entt::to_entity(entity[0u]));
+    ASSERT_TRUE(registry.orphan(other));
+
+    for(entt::id_type id{}; id < count; ++id) {
+        ASSERT_FALSE(registry.storage<int>("pool"_hs + id).contains(other));
+        ASSERT_EQ(registry.storage<int>("pool"_hs + id).size(), (id % 2u) + (id % 3u == 0u));
+    }
+
+    registry.emplace<char>(entity[2u]);
+    ASSERT_TRUE(registry.reset("pool"_hs + 1u));
+
+    registry.destroy(entity.begin() + 1u, entity.end());
+
+    ASSERT_FALSE(registry.storage<test::pointer_stable>().contains(entity[3u]));
+    ASSERT_TRUE(registry.storage<char>().empty());
+
+    for(entt::id_type id{}; id < count; ++id) {
+        if(const auto *storage = registry.storage("pool"_hs + id); storage != nullptr) {
+            ASSERT_TRUE(storage->empty());
+        }
+    }
+
+    entt::registry source{};
+    entt::registry copy{};
+    const auto elem = source.create();
+
+    source.emplace<char>(elem);
+    copy.prepare<char>();
+    copy.deep_copy_from(source);
+
+    ASSERT_TRUE(copy.all_of<char>(elem));
+    ASSERT_FALSE(copy.orphan(elem));
+
+    copy.destroy(elem);
+
+    ASSERT_TRUE(copy.storage<char>().empty());
+}
+
 TEST(Registry, Signals) {
     entt::registry registry{};
     std::array<entt::entity, 2u> entity{};
@@ -2182,14 +2800,59 @@ TEST(Registry, CleanPartialOwningGroupViewAfterRemoveAndClear) {
     ASSERT_EQ(group.size(), 0u);
 }
 
+TEST(Registry, NestedGroups) {
+    entt::registry registry{};
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+
+    registry.emplace<int>(entity[0u]);
+    registry.emplace<double>(entity[0u]);
+    registry.emplace<char>(entity[0u]);
+    registry.emplace<int>(entity[1u]);
+    registry.emplace<char>(entity[1u]);
+    registry.emplace<int>(entity[2u]);
+    registry.emplace<double>(entity[2u]);
+
+    const auto group = registry.group<int, double>(entt::get<char>);
+    const auto outer = registry.group<int>(entt::get<char>);
+    const auto inner = registry.group<int, double>(entt::get<char>, entt::exclude<float>);
+
+    ASSERT_TRUE(registry.owned<int>());
+    ASSERT_TRUE(registry.owned<double>());
+    ASSERT_FALSE(registry.owned<char>());
+
+    ASSERT_EQ(group.size(), 1u);
+    ASSERT_EQ(outer.size(), 2u);
+    ASSERT_EQ(inner.size(), 1u);
+
+    ASSERT_EQ(group.front(), entity[0u]);
+    ASSERT_TRUE(outer.contains(entity[1u]));
+    ASSERT_EQ(inner.front(), entity[0u]);
+
+    registry.emplace<float>(entity[0u]);
+
+    ASSERT_EQ(group.size(), 1u);
+    ASSERT_EQ(outer.size(), 2u);
+    ASSERT_TRUE(inner.empty());
+
+    registry.erase<double>(entity[0u]);
+
+    ASSERT_TRUE(group.empty());
+    ASSERT_EQ(outer.size(), 2u);
+    ASSERT_TRUE(inner.empty());
+
+    registry.emplace<double>(entity[1u]);
+
+    ASSERT_EQ(group.front(), entity[1u]);
+    ASSERT_EQ(outer.size(), 2u);
+    ASSERT_EQ(inner.front(), entity[1u]);
+}
+
 ENTT_DEBUG_TEST(RegistryDeathTest, NestedGroups) {
     entt::registry registry{};
     registry.group<int, double>(entt::get<char>);
 
-    ASSERT_DEATH(registry.group<int>(entt::get<char>), "");
     ASSERT_DEATH(registry.group<int>(entt::get<char, double>), "");
     ASSERT_DEATH(registry.group<int>(entt::get<char>, entt::exclude<double>), "");
-    ASSERT_DEATH((registry.group<int, double>()), "");
 }
 
 ENTT_DEBUG_TEST(RegistryDeathTest, ConflictingGroups) {
@@ -2402,6 +3065,61 @@ TEST(Registry, ContextHint) {
     ASSERT_EQ(ctx.find<int>("other"_hs), nullptr);
 }
 
+TEST(Registry, ContextSlot) {
+    using namespace entt::literals;
+
+    entt::registry registry{};
+    auto &ctx = registry.ctx();
+    int value{3};
+
+    ctx.emplace<int>(1);
+    ctx.emplace_as<int &>("alias"_hs, value);
+
+    int *slot = ctx.slot<int>();
+    const int *cslot = std::as_const(registry).ctx().slot<const int>();
+
+    ASSERT_EQ(slot, cslot);
+    ASSERT_EQ(*slot, 1);
+    ASSERT_EQ(ctx.slot<int>("alias"_hs), &value);
+
+    // slots survive insertions, erasures and assignments
+    for(entt::id_type next{}; next < 64u; ++next) {
+        ctx.emplace_as<char>(next, static_cast<char>(next));
+    }
+
+    for(entt::id_type next{}; next < 64u; next += 2u) {
+        ctx.erase<char>(next);
+    }
+
+    ctx.insert_or_assign(2);
+
+    ASSERT_EQ(ctx.slot<int>(), slot);
+    ASSERT_EQ(*slot, 2);
+
+    *slot = 4;
+
+    ASSERT_EQ(ctx.get<int>(), 4);
+
+    entt::registry other{std::move(registry)};
+
+    ASSERT_EQ(other.ctx().slot<int>(), slot);
+
+    // aliased properties are still converted on assignment
+    other.ctx().insert_or_assign("alias"_hs, 0);
+
+    ASSERT_EQ(value, 3);
+    ASSERT_NE(other.ctx().slot<int>("alias"_hs), &value);
+}
+
+ENTT_DEBUG_TEST(RegistryDeathTest, ContextSlot) {
+    entt::registry registry{};
+
+    registry.ctx().emplace<char>();
+
+    ASSERT_DEATH([[maybe_unused]] auto *slot = registry.ctx().slot<int>(), "");
+    ASSERT_DEATH([[maybe_unused]] const auto *slot = std::as_const(registry).ctx().slot<const int>(), "");
+}
+
 TEST(Registry, ContextAsRef) {
     entt::registry registry{};
     int value{3};
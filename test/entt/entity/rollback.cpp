@@ -0,0 +1,209 @@
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/rollback.hpp>
+#include <entt/entity/snapshot.hpp>
+#include "../../common/config.h"
+#include "../../common/pointer_stable.h"
+
+struct tracked {
+    static constexpr std::size_t page_size = 4u;
+    int value{};
+};
+
+template<>
+struct entt::storage_type<tracked> {
+    using type = entt::sigh_mixin<entt::dirty_mixin<entt::storage<tracked>>>;
+};
+
+TEST(Rollback, Constructors) {
+    static_assert(!std::is_copy_constructible_v<entt::rollback>, "Copy constructible type not allowed");
+    static_assert(!std::is_copy_assignable_v<entt::rollback>, "Copy assignable type not allowed");
+    static_assert(std::is_move_constructible_v<entt::rollback>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<entt::rollback>, "Move assignable type required");
+
+    entt::registry registry;
+    const entt::rollback rollback{registry, 4u};
+
+    ASSERT_EQ(rollback.size(), 4u);
+    ASSERT_FALSE(rollback.contains(0u));
+}
+
+TEST(Rollback, Functionalities) {
+    entt::registry registry;
+    entt::rollback rollback{registry, 4u};
+    const std::array entity{registry.create(), registry.create()};
+
+    registry.prepare<int, test::pointer_stable>();
+    rollback.prepare<int, test::pointer_stable>();
+
+    registry.emplace<int>(entity[0u], 1);
+    rollback.save(0u);
+
+    ASSERT_TRUE(rollback.contains(0u));
+    ASSERT_FALSE(rollback.contains(4u));
+
+    registry.patch<int>(entity[0u], [](auto &value) { value = 2; });
+    registry.emplace<test::pointer_stable>(entity[1u], 3);
+    rollback.save(1u);
+
+    registry.destroy(entity[0u]);
+    rollback.save(2u);
+
+    ASSERT_FALSE(registry.valid(entity[0u]));
+    ASSERT_EQ(rollback.at(1u).get<int>(entity[0u]), 2);
+    ASSERT_EQ(rollback.at(0u).get<int>(entity[0u]), 1);
+
+    rollback.restore(1u);
+
+    ASSERT_TRUE(registry.valid(entity[0u]));
+    ASSERT_EQ(registry.get<int>(entity[0u]), 2);
+    ASSERT_EQ(registry.get<test::pointer_stable>(entity[1u]).value, 3);
+
+    ASSERT_TRUE(rollback.contains(0u));
+    ASSERT_TRUE(rollback.contains(1u));
+    ASSERT_FALSE(rollback.contains(2u));
+
+    rollback.restore(0u);
+
+    ASSERT_EQ(registry.get<int>(entity[0u]), 1);
+    ASSERT_FALSE(registry.all_of<test::pointer_stable>(entity[1u]));
+
+    rollback.clear();
+
+    ASSERT_FALSE(rollback.contains(0u));
+}
+
+TEST(Rollback, Ring) {
+    entt::registry registry;
+    entt::rollback rollback{registry, 2u};
+    const auto entity = registry.create();
+
+    registry.prepare<int>();
+    rollback.prepare<int>();
+
+    for(int frame{}; frame < 5; ++frame) {
+        registry.emplace_or_replace<int>(entity, frame);
+        rollback.save(static_cast<entt::rollback::frame_type>(frame));
+    }
+
+    ASSERT_FALSE(rollback.contains(2u));
+    ASSERT_TRUE(rollback.contains(3u));
+    ASSERT_TRUE(rollback.contains(4u));
+    ASSERT_EQ(rollback.at(3u).get<int>(entity), 3);
+
+    rollback.restore(3u);
+
+    ASSERT_EQ(registry.get<int>(entity), 3);
+    ASSERT_FALSE(rollback.contains(4u));
+}
+
+TEST(Rollback, Snapshot) {
+    entt::registry registry;
+    entt::rollback rollback{registry, 2u};
+    const std::array entity{registry.create(), registry.create()};
+
+    registry.prepare<int>();
+    rollback.prepare<int>();
+
+    registry.emplace<int>(entity[1u], 3);
+    rollback.save(0u);
+    registry.destroy(entity[1u]);
+
+    entt::packed_output_archive output{};
+    entt::snapshot{rollback.at(0u)}.get<entt::entity>(output).get<int>(output);
+
+    entt::registry other;
+    entt::packed_input_archive input{output.data().data(), output.data().size()};
+    entt::snapshot_loader{other}.get<entt::entity>(input).get<int>(input);
+
+    ASSERT_TRUE(other.valid(entity[0u]));
+    ASSERT_TRUE(other.valid(entity[1u]));
+    ASSERT_EQ(other.get<int>(entity[1u]), 3);
+}
+
+TEST(Rollback, DirtyPages) {
+    entt::registry registry;
+    entt::rollback rollback{registry, 2u};
+    std::array<entt::entity, 10u> entity{};
+
+    registry.prepare<tracked>();
+    rollback.prepare<tracked>();
+    registry.create(entity.begin(), entity.end());
+
+    for(std::size_t pos{}; pos < entity.size(); ++pos) {
+        registry.emplace<tracked>(entity[pos], static_cast<int>(pos));
+    }
+
+    rollback.save(0u);
+    rollback.save(1u);
+    rollback.restore(1u);
+
+    ASSERT_EQ(registry.storage<tracked>().dirty_count(), 0u);
+
+    registry.patch<tracked>(entity[0u], [](auto &elem) { elem.value = -1; });
+    // untracked changes are invisible to rollbacks, pages are copied only if dirty
+    registry.get<tracked>(entity[5u]).value = -1;
+
+    rollback.restore(1u);
+
+    ASSERT_EQ(registry.get<tracked>(entity[0u]).value, 0);
+    ASSERT_EQ(registry.get<tracked>(entity[5u]).value, -1);
+    ASSERT_EQ(registry.storage<tracked>().dirty_count(), 0u);
+
+    registry.get<tracked>(entity[5u]).value = 5;
+    registry.erase<tracked>(entity[2u]);
+    registry.erase<tracked>(entity.begin() + 8u, entity.end());
+    registry.destroy(entity[7u]);
+
+    rollback.save(2u);
+
+    ASSERT_EQ(registry.storage<tracked>().size(), 6u);
+    ASSERT_EQ(rollback.at(2u).storage<tracked>()->size(), 6u);
+    ASSERT_FALSE(rollback.at(2u).all_of<tracked>(entity[2u]));
+    ASSERT_EQ(rollback.at(2u).get<tracked>(entity[6u]).value, 6);
+
+    const auto other = registry.create();
+    registry.insert<tracked>(entity.begin() + 8u, entity.end(), tracked{8});
+    registry.emplace<tracked>(other, 42);
+    registry.patch<tracked>(entity[1u], [](auto &elem) { elem.value = -1; });
+
+    rollback.restore(1u);
+
+    ASSERT_FALSE(registry.valid(other));
+    ASSERT_EQ(registry.storage<tracked>().size(), entity.size());
+
+    for(std::size_t pos{}; pos < entity.size(); ++pos) {
+        ASSERT_EQ(registry.get<tracked>(entity[pos]).value, static_cast<int>(pos));
+    }
+
+    ASSERT_FALSE(rollback.contains(2u));
+
+    registry.destroy(entity[3u]);
+    rollback.save(2u);
+
+    ASSERT_EQ(rollback.at(2u).storage<tracked>()->size(), entity.size() - 1u);
+
+    rollback.restore(1u);
+
+    ASSERT_TRUE(registry.valid(entity[3u]));
+    ASSERT_EQ(registry.get<tracked>(entity[3u]).value, 3);
+    ASSERT_EQ(registry.get<tracked>(entity[9u]).value, 9);
+}
+
+ENTT_DEBUG_TEST(RollbackDeathTest, Rollback) {
+    entt::registry registry;
+    entt::rollback rollback{registry, 2u};
+
+    ASSERT_DEATH(entt::rollback(registry, 0u), "");
+    ASSERT_DEATH(rollback.restore(0u), "");
+    ASSERT_DEATH([[maybe_unused]] const auto &state = rollback.at(0u), "");
+
+    registry.prepare<int>();
+
+    ASSERT_DEATH(rollback.save(0u), "");
+}
@@ -1,9 +1,11 @@
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <tuple>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/entity/entity.hpp>
 #include <entt/entity/runtime_view.hpp>
@@ -346,6 +348,79 @@ TYPED_TEST(RuntimeView, EachWithHoles) {
     });
 }
 
+TYPED_TEST(RuntimeView, EachChunked) {
+    using runtime_view_type = typename TestFixture::type;
+
+    std::tuple<entt::storage<int>, entt::storage<char>, entt::storage<double>> storage{};
+    runtime_view_type view{};
+    std::vector<entt::entity> expected{};
+    std::vector<entt::entity> chunked{};
+    std::size_t count{};
+
+    for(std::size_t pos{}; pos < 300u; ++pos) {
+        const auto entt = entt::entity{static_cast<entt::id_type>(pos)};
+
+        std::get<0>(storage).emplace(entt);
+
+        if(pos % 2u == 0u) {
+            std::get<1>(storage).emplace(entt);
+        }
+
+        if(pos % 3u == 0u) {
+            std::get<2>(storage).emplace(entt);
+        }
+    }
+
+    auto executor = [&count](const std::size_t len, auto job) {
+        count = len;
+
+        for(std::size_t pos{}; pos < len; ++pos) {
+            job(pos);
+        }
+    };
+
+    view.each_chunked(executor, 10u, [](auto) { FAIL(); });
+
+    ASSERT_EQ(count, 0u);
+
+    view.iterate(std::get<0>(storage)).iterate(std::get<1>(storage)).exclude(std::get<2>(storage));
+    view.each([&expected](const auto entt) { expected.push_back(entt); });
+    view.each_chunked(executor, 100u, [&chunked](const auto entt) { chunked.push_back(entt); });
+
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(chunked.size(), 100u);
+    ASSERT_EQ(chunked, expected);
+
+    chunked.clear();
+    view.each_chunked(executor, 7u, [&chunked](const auto entt) { chunked.push_back(entt); });
+
+    ASSERT_EQ(count, 22u);
+    ASSERT_EQ(chunked, expected);
+}
+
+TYPED_TEST(RuntimeView, EachChunkedWithTombstones) {
+    using runtime_view_type = typename TestFixture::type;
+
+    entt::storage<test::pointer_stable> storage{};
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{5}};
+    runtime_view_type view{};
+    std::vector<entt::entity> chunked{};
+
+    storage.insert(entity.begin(), entity.end());
+    storage.erase(entity[1u]);
+    view.iterate(storage);
+
+    auto executor = [](const std::size_t len, auto job) {
+        for(std::size_t pos{}; pos < len; ++pos) {
+            job(pos);
+        }
+    };
+
+    view.each_chunked(executor, 2u, [&chunked](const auto entt) { chunked.push_back(entt); });
+
+    ASSERT_EQ(chunked, (std::vector<entt::entity>{entity[2u], entity[0u]}));
+}
+
 TYPED_TEST(RuntimeView, Exclude) {
     using runtime_view_type = typename TestFixture::type;
 
@@ -368,6 +443,45 @@ TYPED_TEST(RuntimeView, Exclude) {
     });
 }
 
+TYPED_TEST(RuntimeView, Refresh) {
+    using runtime_view_type = typename TestFixture::type;
+
+    std::tuple<entt::storage<int>, entt::storage<char>, entt::storage<double>, entt::storage<float>> storage{};
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{5}, entt::entity{7}};
+    runtime_view_type view{};
+
+    std::get<0>(storage).insert(entity.begin(), entity.end());
+    std::get<1>(storage).insert(entity.begin(), entity.begin() + 2u);
+    std::get<2>(storage).insert(entity.begin(), entity.begin() + 3u);
+    std::get<3>(storage).emplace(entity[0u]);
+
+    view.iterate(std::get<2>(storage)).iterate(std::get<0>(storage)).iterate(std::get<1>(storage)).exclude(std::get<3>(storage));
+
+    ASSERT_EQ(view.size_hint(), 2u);
+    ASSERT_TRUE(view.refresh(.5f));
+    ASSERT_FALSE(view.refresh(.5f));
+    ASSERT_EQ(view.size_hint(), 2u);
+
+    std::get<1>(storage).insert(entity.begin() + 2u, entity.end());
+
+    ASSERT_FALSE(view.refresh(1.f));
+    ASSERT_TRUE(view.refresh(.5f));
+    ASSERT_EQ(view.size_hint(), 3u);
+
+    view.each([&](auto entt) {
+        ASSERT_TRUE(entt == entity[1u] || entt == entity[2u]);
+    });
+
+    view.exclude(std::get<3>(storage));
+
+    ASSERT_TRUE(view.refresh(1.f));
+
+    view.clear();
+
+    ASSERT_FALSE(view.refresh());
+    ASSERT_EQ(view.size_hint(), 0u);
+}
+
 TYPED_TEST(RuntimeView, StableType) {
     using runtime_view_type = typename TestFixture::type;
 
@@ -0,0 +1,273 @@
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/shared_storage.hpp>
+#include <entt/entity/view.hpp>
+#include "../../common/linter.hpp"
+
+struct material {
+    std::string name{};
+    int flags{};
+};
+
+[[nodiscard]] bool operator==(const material &lhs, const material &rhs) {
+    return lhs.name == rhs.name && lhs.flags == rhs.flags;
+}
+
+template<>
+struct std::hash<material> {
+    [[nodiscard]] std::size_t operator()(const material &elem) const noexcept {
+        return std::hash<std::string>{}(elem.name);
+    }
+};
+
+struct opaque {
+    int value{};
+};
+
+[[nodiscard]] bool operator==(const opaque &lhs, const opaque &rhs) {
+    return lhs.value == rhs.value;
+}
+
+template<>
+struct entt::storage_type<material> {
+    using type = entt::sigh_mixin<entt::shared_storage<material>>;
+};
+
+TEST(SharedStorage, Constructors) {
+    entt::shared_storage<material> pool;
+
+    ASSERT_EQ(pool.policy(), entt::deletion_policy::swap_and_pop);
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = pool.get_allocator());
+    ASSERT_EQ(pool.info(), entt::type_id<material>());
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.unique(), 0u);
+
+    pool.emplace(entt::entity{1}, "stone", 1);
+    entt::shared_storage<material> other{std::move(pool)};
+
+    test::is_initialized(pool);
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.unique(), 0u);
+    ASSERT_FALSE(other.empty());
+    ASSERT_EQ(other.unique(), 1u);
+    ASSERT_EQ(other.get(entt::entity{1}).name, "stone");
+
+    pool = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_FALSE(pool.empty());
+    ASSERT_TRUE(other.empty());
+
+    other.emplace(entt::entity{1}, "stone", 1);
+    other.emplace(entt::entity{2}, "stone", 1);
+    pool.swap(other);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.unique(), 1u);
+    ASSERT_EQ(other.size(), 1u);
+    ASSERT_EQ(other.unique(), 1u);
+}
+
+TEST(SharedStorage, Functionalities) {
+    entt::shared_storage<material> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{42}, entt::entity{7}};
+
+    pool.reserve(4u);
+
+    ASSERT_EQ(pool.capacity(), 4u);
+
+    const auto &value = pool.emplace(entity[0u], "stone", 1);
+    pool.emplace(entity[1u], material{"stone", 1});
+    pool.emplace(entity[2u], "wood", 2);
+    pool.emplace(entity[3u]);
+
+    testing::StaticAssertTypeEq<decltype(pool.get(entity[0u])), const material &>();
+
+    ASSERT_EQ(pool.size(), 4u);
+    ASSERT_EQ(pool.unique(), 3u);
+    ASSERT_EQ(&pool.get(entity[0u]), &value);
+    ASSERT_EQ(&pool.get(entity[1u]), &value);
+    ASSERT_NE(&pool.get(entity[2u]), &value);
+    ASSERT_EQ(pool.use_count(entity[0u]), 2u);
+    ASSERT_EQ(pool.use_count(entity[2u]), 1u);
+    ASSERT_EQ(pool.get(entity[3u]), material{});
+    ASSERT_EQ(std::get<0>(pool.get_as_tuple(entity[2u])).name, "wood");
+    ASSERT_EQ(pool.at(1u), value);
+    ASSERT_EQ(pool.value(entity[1u]), &value);
+
+    pool.erase(entity[0u]);
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.unique(), 3u);
+    ASSERT_EQ(pool.get(entity[1u]).name, "stone");
+    ASSERT_EQ(pool.use_count(entity[1u]), 1u);
+
+    pool.erase(entity[1u]);
+
+    ASSERT_EQ(pool.unique(), 2u);
+    ASSERT_GE(pool.memory_usage().element_bytes, pool.capacity() * sizeof(void *) + pool.unique() * sizeof(material));
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(pool.unique(), 0u);
+
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.capacity(), 0u);
+}
+
+TEST(SharedStorage, Patch) {
+    entt::shared_storage<material> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{42}};
+
+    pool.insert(entity.begin(), entity.end(), material{"stone", 1});
+
+    ASSERT_EQ(pool.unique(), 1u);
+
+    // shared values are copied on write
+    const auto &value = pool.patch(entity[0u], [](auto &elem) { elem.flags = 2; });
+
+    ASSERT_EQ(pool.unique(), 2u);
+    ASSERT_EQ(value.flags, 2);
+    ASSERT_EQ(pool.get(entity[1u]).flags, 1);
+    ASSERT_EQ(pool.use_count(entity[1u]), 2u);
+
+    // unique values are updated in place
+    pool.patch(entity[0u], [](auto &elem) { elem.name = "marble"; });
+
+    ASSERT_EQ(&pool.get(entity[0u]), &value);
+    ASSERT_EQ(pool.get(entity[0u]), (material{"marble", 2}));
+    ASSERT_EQ(pool.unique(), 2u);
+
+    // updated values are shared again when possible
+    pool.patch(entity[1u], [](auto &elem) { elem = material{"marble", 2}; });
+
+    ASSERT_EQ(&pool.get(entity[1u]), &value);
+    ASSERT_EQ(pool.use_count(entity[0u]), 2u);
+
+    pool.patch(entity[2u], [](auto &elem) { elem = material{"marble", 2}; });
+
+    ASSERT_EQ(pool.unique(), 1u);
+    ASSERT_EQ(&pool.get(entity[2u]), &value);
+    ASSERT_EQ(pool.use_count(entity[2u]), 3u);
+}
+
+TEST(SharedStorage, NoHash) {
+    entt::shared_storage<opaque> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{42}};
+    const std::array value{opaque{1}, opaque{2}, opaque{1}};
+
+    pool.insert(entity.begin(), entity.end(), value.begin());
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.unique(), 2u);
+    ASSERT_EQ(&pool.get(entity[0u]), &pool.get(entity[2u]));
+
+    pool.patch(entity[1u], [](auto &elem) { elem.value = 1; });
+
+    ASSERT_EQ(pool.unique(), 1u);
+    ASSERT_EQ(pool.use_count(entity[1u]), 3u);
+}
+
+TEST(SharedStorage, Iterator) {
+    entt::shared_storage<opaque> pool;
+
+    pool.emplace(entt::entity{1}, 1);
+    pool.emplace(entt::entity{3}, 3);
+
+    testing::StaticAssertTypeEq<decltype(*pool.begin()), const opaque &>();
+
+    auto it = pool.begin();
+
+    ASSERT_EQ(it->value, 3);
+    ASSERT_EQ((++it)->value, 1);
+    ASSERT_EQ(++it, pool.end());
+    ASSERT_EQ(pool.end() - pool.begin(), 2);
+    ASSERT_EQ(pool.begin()[1u].value, 1);
+    ASSERT_EQ(pool.rbegin()->value, 1);
+
+    std::size_t count{};
+
+    for(auto [entt, elem]: pool.each()) {
+        testing::StaticAssertTypeEq<decltype(elem), const opaque &>();
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), elem.value);
+        ++count;
+    }
+
+    for(auto [entt, elem]: pool.reach()) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), elem.value);
+        ++count;
+    }
+
+    ASSERT_EQ(count, 4u);
+}
+
+TEST(SharedStorage, Sort) {
+    entt::shared_storage<opaque> pool;
+
+    pool.emplace(entt::entity{1}, 3);
+    pool.emplace(entt::entity{2}, 1);
+    pool.emplace(entt::entity{3}, 2);
+
+    pool.sort([&pool](const entt::entity lhs, const entt::entity rhs) { return pool.get(lhs).value < pool.get(rhs).value; });
+
+    ASSERT_EQ(pool.begin()->value, 1);
+    ASSERT_EQ((pool.begin() + 1)->value, 2);
+    ASSERT_EQ((pool.begin() + 2)->value, 3);
+    ASSERT_EQ(pool.get(entt::entity{1}).value, 3);
+}
+
+TEST(SharedStorage, Registry) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+
+    testing::StaticAssertTypeEq<entt::storage_type_t<material>, entt::sigh_mixin<entt::shared_storage<material>>>();
+
+    registry.emplace<material>(entity[0u], "stone", 1);
+    registry.emplace<material>(entity[1u], "stone", 1);
+    registry.emplace<char>(entity[1u]);
+
+    ASSERT_EQ(registry.storage<material>().unique(), 1u);
+    ASSERT_EQ(&registry.get<material>(entity[0u]), &registry.get<material>(entity[1u]));
+
+    registry.replace<material>(entity[0u], "wood", 2);
+    registry.emplace_or_replace<material>(entity[2u], "wood", 2);
+
+    ASSERT_EQ(registry.storage<material>().unique(), 2u);
+    ASSERT_EQ(registry.get<material>(entity[1u]).name, "stone");
+    ASSERT_EQ(&registry.get<material>(entity[0u]), &registry.get<material>(entity[2u]));
+
+    std::size_t count{};
+
+    registry.view<material>().each([&count](const material &elem) {
+        ASSERT_FALSE(elem.name.empty());
+        ++count;
+    });
+
+    ASSERT_EQ(count, 3u);
+
+    registry.view<const material, char>().each([&entity](const auto entt, const material &elem, const char) {
+        ASSERT_EQ(entt, entity[1u]);
+        ASSERT_EQ(elem.name, "stone");
+    });
+
+    registry.destroy(entity[1u]);
+
+    ASSERT_EQ(registry.storage<material>().size(), 2u);
+    ASSERT_EQ(registry.storage<material>().unique(), 1u);
+
+    registry.clear();
+
+    ASSERT_EQ(registry.storage<material>().unique(), 0u);
+}
@@ -1,8 +1,10 @@
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/type_info.hpp>
 #include <entt/entity/component.hpp>
@@ -44,11 +46,27 @@ private:
     bool *destroyed{};
 };
 
+struct transform {
+    int position;
+    int rotation;
+};
+
 template<typename Registry>
 void listener(std::size_t &counter, Registry &, typename Registry::entity_type) {
     ++counter;
 }
 
+struct bulk_listener {
+    template<typename Registry>
+    void receive(Registry &, const typename Registry::entity_type *elem, const std::size_t len) {
+        ++calls;
+        entity.assign(elem, elem + len);
+    }
+
+    std::size_t calls{};
+    std::vector<entt::entity> entity{};
+};
+
 template<typename Type>
 struct SighMixin: testing::Test {
     using type = Type;
@@ -138,6 +156,49 @@ TYPED_TEST(SighMixin, Functionalities) {
     ASSERT_EQ(pool.size(), 0u);
 }
 
+TYPED_TEST(SighMixin, Observed) {
+    using value_type = typename TestFixture::type;
+
+    entt::sigh_mixin<entt::storage<value_type>> pool;
+    entt::registry registry;
+    bulk_listener listener{};
+    std::size_t counter{};
+
+    pool.bind(registry);
+
+    ASSERT_FALSE(pool.observed());
+    ASSERT_EQ(pool.statistics().listeners, 0u);
+
+    pool.emplace(entt::entity{1});
+    pool.patch(entt::entity{1});
+    pool.erase(entt::entity{1});
+
+    pool.on_update().template connect<&::listener<entt::registry>>(counter);
+
+    ASSERT_TRUE(pool.observed());
+    ASSERT_EQ(pool.statistics().listeners, 1u);
+
+    pool.emplace(entt::entity{1});
+    pool.patch(entt::entity{1});
+
+    ASSERT_EQ(counter, 1u);
+
+    pool.on_update().disconnect(&counter);
+    pool.on_bulk_destroy().template connect<&bulk_listener::receive<entt::registry>>(listener);
+
+    ASSERT_TRUE(pool.observed());
+    ASSERT_EQ(static_cast<const entt::sparse_set &>(pool).statistics().listeners, 1u);
+
+    pool.erase(entt::entity{1});
+
+    ASSERT_EQ(listener.calls, 1u);
+
+    pool.on_bulk_destroy().disconnect(&listener);
+
+    ASSERT_FALSE(pool.observed());
+    ASSERT_EQ(pool.statistics().listeners, 0u);
+}
+
 TYPED_TEST(SighMixin, InsertWeakRange) {
     using value_type = typename TestFixture::type;
 
@@ -155,6 +216,111 @@ TYPED_TEST(SighMixin, InsertWeakRange) {
     ASSERT_EQ(on_construct, 2u);
 }
 
+TYPED_TEST(SighMixin, BulkSignals) {
+    using value_type = typename TestFixture::type;
+
+    entt::registry registry;
+    auto &pool = registry.storage<value_type>();
+    std::array<entt::entity, 3u> entity{};
+    bulk_listener on_construct{};
+    bulk_listener on_destroy{};
+
+    registry.create(entity.begin(), entity.end());
+    pool.on_bulk_construct().template connect<&bulk_listener::receive<entt::registry>>(on_construct);
+    pool.on_bulk_destroy().template connect<&bulk_listener::receive<entt::registry>>(on_destroy);
+
+    pool.insert(entity.begin(), entity.end(), value_type{1});
+
+    ASSERT_EQ(on_construct.calls, 1u);
+    ASSERT_EQ(on_construct.entity, (std::vector<entt::entity>{entity.begin(), entity.end()}));
+
+    pool.erase(pool.entt::sparse_set::begin(), pool.entt::sparse_set::end());
+
+    ASSERT_EQ(on_destroy.calls, 1u);
+    ASSERT_EQ(on_destroy.entity.size(), 3u);
+    ASSERT_TRUE(std::is_permutation(on_destroy.entity.begin(), on_destroy.entity.end(), entity.begin()));
+
+    pool.emplace(entity[1u]);
+    pool.push(entity[2u]);
+
+    ASSERT_EQ(on_construct.calls, 3u);
+    ASSERT_EQ(on_construct.entity, std::vector<entt::entity>{entity[2u]});
+
+    registry.erase<value_type>(entity[1u]);
+
+    ASSERT_EQ(on_destroy.calls, 2u);
+    ASSERT_EQ(on_destroy.entity, std::vector<entt::entity>{entity[1u]});
+
+    pool.clear();
+
+    ASSERT_EQ(on_destroy.calls, 3u);
+    ASSERT_EQ(on_destroy.entity, std::vector<entt::entity>{entity[2u]});
+
+    pool.clear();
+
+    ASSERT_EQ(on_destroy.calls, 3u);
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST(SighMixin, BulkSignalsStorageEntity) {
+    entt::registry registry;
+    auto &pool = registry.storage<entt::entity>();
+    std::array<entt::entity, 3u> entity{};
+    bulk_listener on_construct{};
+    bulk_listener on_destroy{};
+
+    pool.on_bulk_construct().connect<&bulk_listener::receive<entt::registry>>(on_construct);
+    pool.on_bulk_destroy().connect<&bulk_listener::receive<entt::registry>>(on_destroy);
+
+    registry.create(entity.begin(), entity.end());
+
+    ASSERT_EQ(on_construct.calls, 1u);
+    ASSERT_EQ(on_construct.entity, (std::vector<entt::entity>{entity.begin(), entity.end()}));
+
+    const auto other = registry.create();
+
+    ASSERT_EQ(on_construct.calls, 2u);
+    ASSERT_EQ(on_construct.entity, std::vector<entt::entity>{other});
+
+    registry.destroy(entity.begin(), entity.end());
+
+    ASSERT_EQ(on_destroy.calls, 1u);
+    ASSERT_EQ(on_destroy.entity.size(), 3u);
+    ASSERT_TRUE(std::is_permutation(on_destroy.entity.begin(), on_destroy.entity.end(), entity.begin()));
+
+    registry.clear();
+
+    ASSERT_EQ(on_destroy.calls, 2u);
+    ASSERT_EQ(on_destroy.entity, std::vector<entt::entity>{other});
+}
+
+TEST(SighMixin, BulkSignalsOwningGroup) {
+    entt::registry registry;
+    std::array<entt::entity, 8u> grouped{};
+    std::array<entt::entity, 4u> other{};
+    std::array<entt::entity, 8u> entity{};
+    bulk_listener on_construct{};
+
+    registry.create(grouped.begin(), grouped.end());
+    registry.create(other.begin(), other.end());
+    registry.create(entity.begin(), entity.end());
+
+    registry.insert<int>(grouped.begin(), grouped.end());
+    registry.insert<char>(grouped.begin(), grouped.end());
+
+    // listeners connected before the group are notified after it (and its swaps)
+    registry.on_bulk_construct<int>().connect<&bulk_listener::receive<entt::registry>>(on_construct);
+    const auto group = registry.group<int>(entt::get<char>);
+
+    registry.insert<int>(other.begin(), other.end());
+    registry.insert<char>(entity.begin(), entity.end());
+    registry.insert<int>(entity.begin(), entity.end());
+
+    ASSERT_EQ(group.size(), 16u);
+    ASSERT_EQ(on_construct.calls, 2u);
+    ASSERT_EQ(on_construct.entity, (std::vector<entt::entity>{entity.begin(), entity.end()}));
+}
+
 TEST(SighMixin, NonDefaultConstructibleType) {
     entt::registry registry;
     auto &pool = registry.storage<test::non_default_constructible>();
@@ -460,6 +626,61 @@ TEST(SighMixin, AutoSignal) {
     ASSERT_FALSE(registry.valid(entity));
 }
 
+TEST(SighMixin, FieldSignals) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    auto &&storage = registry.storage<transform>();
+
+    std::size_t on_update{};
+    std::size_t on_position{};
+    std::size_t on_rotation{};
+
+    registry.emplace<transform>(entity, 0, 0);
+
+    ASSERT_FALSE(storage.observed());
+
+    storage.on_update().connect<&listener<entt::registry>>(on_update);
+    registry.on_update<&transform::position>().connect<&listener<entt::registry>>(on_position);
+    storage.on_update<&transform::rotation>().connect<&listener<entt::registry>>(on_rotation);
+
+    ASSERT_TRUE(storage.observed());
+
+    registry.patch<&transform::position>(entity, [](int &value) { value = 2; });
+
+    ASSERT_EQ(registry.get<transform>(entity).position, 2);
+    ASSERT_EQ(on_update, 1u);
+    ASSERT_EQ(on_position, 1u);
+    ASSERT_EQ(on_rotation, 0u);
+
+    registry.replace<&transform::rotation>(entity, 3);
+
+    ASSERT_EQ(registry.get<transform>(entity).rotation, 3);
+    ASSERT_EQ(on_update, 2u);
+    ASSERT_EQ(on_position, 1u);
+    ASSERT_EQ(on_rotation, 1u);
+
+    // equal values don't trigger any listener
+    registry.replace<&transform::rotation>(entity, 3);
+
+    ASSERT_EQ(on_update, 2u);
+    ASSERT_EQ(on_rotation, 1u);
+
+    // any field could change, all listeners are notified
+    registry.patch<transform>(entity);
+
+    ASSERT_EQ(on_update, 3u);
+    ASSERT_EQ(on_position, 2u);
+    ASSERT_EQ(on_rotation, 2u);
+
+    storage.on_update<&transform::position>().disconnect<&listener<entt::registry>>(on_position);
+    storage.patch<&transform::position>(entity, [](int &value) { ++value; });
+
+    ASSERT_EQ(registry.get<transform>(entity).position, 3);
+    ASSERT_EQ(on_update, 4u);
+    ASSERT_EQ(on_position, 2u);
+    ASSERT_EQ(on_rotation, 2u);
+}
+
 TYPED_TEST(SighMixin, Registry) {
     using value_type = typename TestFixture::type;
 
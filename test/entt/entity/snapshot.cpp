@@ -1,5 +1,10 @@
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -23,6 +28,92 @@ struct shadow {
     }
 };
 
+struct relationship {
+    entt::entity parent{entt::null};
+    std::vector<entt::entity> children{};
+};
+
+struct tracked {
+    int value{};
+};
+
+template<>
+struct entt::storage_type<tracked> {
+    using type = entt::sigh_mixin<entt::changed_mixin<entt::storage<tracked>>>;
+};
+
+struct quantized {
+    float value{};
+};
+
+template<>
+struct entt::snapshot_codec<quantized> {
+    static void encode(std::vector<std::byte> &out, const quantized &elem) {
+        entt::snapshot_codec<std::int32_t>::encode(out, static_cast<std::int32_t>(elem.value * 100.f));
+    }
+
+    static const std::byte *decode(const std::byte *first, const std::byte *last, quantized &elem) {
+        std::int32_t value{};
+        first = entt::snapshot_codec<std::int32_t>::decode(first, last, value);
+        elem.value = static_cast<float>(value) / 100.f;
+        return first;
+    }
+};
+
+struct run_length_codec {
+    void encode(const std::byte *data, const std::size_t len, std::vector<std::byte> &out) const {
+        for(std::size_t pos{}; pos < len;) {
+            std::size_t count{1u};
+
+            for(; pos + count < len && count < 255u && data[pos + count] == data[pos]; ++count) {}
+
+            out.push_back(static_cast<std::byte>(count));
+            out.push_back(data[pos]);
+            pos += count;
+        }
+    }
+
+    void decode(const std::byte *data, const std::size_t len, std::byte *out, [[maybe_unused]] const std::size_t size) const {
+        for(std::size_t pos{}; pos < len; pos += 2u) {
+            out = std::fill_n(out, std::to_integer<std::size_t>(data[pos]), data[pos + 1u]);
+        }
+    }
+};
+
+struct bulk_output_archive {
+    template<typename Type>
+    void operator()(const Type &value) {
+        data.emplace_back(value);
+    }
+
+    void write(const void *value, const std::size_t len) {
+        const auto *first = static_cast<const std::byte *>(value);
+        bytes.insert(bytes.end(), first, first + len);
+        ++writes;
+    }
+
+    std::vector<entt::any> data{};
+    std::vector<std::byte> bytes{};
+    std::size_t writes{};
+};
+
+struct bulk_input_archive {
+    template<typename Type>
+    void operator()(Type &value) {
+        value = entt::any_cast<Type>(data[pos++]);
+    }
+
+    void read(void *value, const std::size_t len) {
+        std::memcpy(value, bytes.data() + offset, len);
+        offset += len;
+    }
+
+    std::vector<entt::any> data{};
+    std::vector<std::byte> bytes{};
+    std::size_t pos{};
+    std::size_t offset{};
+};
+
 TEST(BasicSnapshot, Constructors) {
     static_assert(!std::is_default_constructible_v<entt::basic_snapshot<entt::registry>>, "Default constructible type not allowed");
     static_assert(!std::is_copy_constructible_v<entt::basic_snapshot<entt::registry>>, "Copy constructible type not allowed");
@@ -271,6 +362,206 @@ TEST(BasicSnapshot, GetTypeSparse) {
     ASSERT_EQ(entt::any_cast<int>(data[5u]), value[2u]);
 }
 
+TEST(BasicSnapshot, GetTypeBulk) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry registry;
+    const entt::basic_snapshot snapshot{registry};
+    const auto &storage = registry.storage<int>();
+    bulk_output_archive archive{};
+
+    std::array<entt::entity, 3u> entity{};
+    registry.create(entity.begin(), entity.end());
+
+    for(const auto entt: entity) {
+        registry.emplace<int>(entt, static_cast<int>(entt::to_integral(entt)));
+    }
+
+    snapshot.get<int>(archive);
+
+    ASSERT_EQ(archive.data.size(), 1u);
+    ASSERT_EQ(entt::any_cast<typename traits_type::entity_type>(archive.data[0u]), storage.size());
+    ASSERT_EQ(archive.writes, 2u);
+    ASSERT_EQ(archive.bytes.size(), storage.size() * (sizeof(entt::entity) + sizeof(int)));
+    ASSERT_EQ(std::memcmp(archive.bytes.data(), storage.data(), storage.size() * sizeof(entt::entity)), 0);
+    ASSERT_EQ(std::memcmp(archive.bytes.data() + storage.size() * sizeof(entt::entity), storage.raw()[0u], storage.size() * sizeof(int)), 0);
+
+    archive = {};
+    snapshot.get<test::pointer_stable>(archive);
+
+    // pointer stable types aren't serialized in bulk
+    ASSERT_EQ(archive.writes, 0u);
+
+    archive = {};
+    registry.destroy(entity[1u]);
+    snapshot.get<int>(archive, entity.begin(), entity.end());
+
+    ASSERT_EQ(entt::any_cast<typename traits_type::entity_type>(archive.data[0u]), 2u);
+    ASSERT_EQ(archive.writes, 2u);
+    ASSERT_EQ(archive.bytes.size(), 2u * (sizeof(entt::entity) + sizeof(int)));
+}
+
+TEST(BasicSnapshotCapture, Constructors) {
+    static_assert(!std::is_default_constructible_v<entt::basic_snapshot_capture<entt::registry>>, "Default constructible type not allowed");
+    static_assert(!std::is_copy_constructible_v<entt::basic_snapshot_capture<entt::registry>>, "Copy constructible type not allowed");
+    static_assert(!std::is_copy_assignable_v<entt::basic_snapshot_capture<entt::registry>>, "Copy assignable type not allowed");
+    static_assert(std::is_move_constructible_v<entt::basic_snapshot_capture<entt::registry>>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<entt::basic_snapshot_capture<entt::registry>>, "Move assignable type required");
+
+    const entt::registry registry;
+    entt::basic_snapshot_capture capture{registry};
+    entt::basic_snapshot_capture other{std::move(capture)};
+
+    ASSERT_NO_THROW(capture = std::move(other));
+}
+
+TEST(BasicSnapshotCapture, Get) {
+    entt::registry registry;
+    entt::basic_snapshot_capture capture{registry};
+    const entt::basic_snapshot snapshot{registry};
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+
+    registry.emplace<int>(entity[0u], 1);
+    registry.emplace<int>(entity[2u], 3);
+    registry.emplace<test::empty>(entity[1u]);
+    registry.emplace<test::pointer_stable>(entity[1u], 4);
+    registry.destroy(registry.create());
+
+    std::vector<entt::any> expected{};
+    std::vector<entt::any> data{};
+    auto archive = [&data](auto &&elem) { data.emplace_back(std::forward<decltype(elem)>(elem)); };
+    auto reference = [&expected](auto &&elem) { expected.emplace_back(std::forward<decltype(elem)>(elem)); };
+
+    capture.capture<entt::entity>().capture<int>().capture<test::empty>().capture<test::pointer_stable>().capture<double>();
+    snapshot.get<entt::entity>(reference).get<int>(reference).get<test::empty>(reference).get<test::pointer_stable>(reference).get<double>(reference);
+
+    registry.clear();
+    registry.emplace<int>(registry.create(), 2);
+
+    capture.get<entt::entity>(archive).get<int>(archive).get<test::empty>(archive).get<test::pointer_stable>(archive).get<double>(archive).get<char>(archive);
+
+    ASSERT_EQ(data.size(), expected.size() + 1u);
+
+    for(std::size_t pos{}; pos < expected.size(); ++pos) {
+        ASSERT_EQ(data[pos], expected[pos]);
+    }
+
+    capture.capture<int>();
+    data.clear();
+    capture.get<int>(archive);
+
+    ASSERT_EQ(data.size(), 3u);
+    ASSERT_EQ(entt::any_cast<int>(data[2u]), 2);
+}
+
+TEST(BasicSnapshotCapture, Threads) {
+    entt::registry registry;
+    entt::basic_snapshot_capture capture{registry};
+    bulk_output_archive output{};
+    std::array<entt::entity, 8u> entity{};
+
+    registry.create(entity.begin(), entity.end());
+
+    for(auto entt: entity) {
+        registry.emplace<int>(entt, static_cast<int>(entt::to_integral(entt)));
+    }
+
+    capture.capture<entt::entity>().capture<int>();
+
+    std::thread worker{[&capture, &output]() { capture.get<entt::entity>(output).get<int>(output); }};
+
+    for(auto entt: entity) {
+        registry.replace<int>(entt, 0);
+    }
+
+    worker.join();
+
+    ASSERT_EQ(output.writes, 2u);
+
+    entt::registry other;
+    bulk_input_archive input{std::move(output.data), std::move(output.bytes)};
+    entt::basic_snapshot_loader{other}.get<entt::entity>(input).get<int>(input);
+
+    for(auto entt: entity) {
+        ASSERT_EQ(other.get<int>(entt), static_cast<int>(entt::to_integral(entt)));
+    }
+}
+
+TEST(BasicDeltaSnapshot, Constructors) {
+    static_assert(!std::is_default_constructible_v<entt::basic_delta_snapshot<entt::registry>>, "Default constructible type not allowed");
+    static_assert(!std::is_copy_constructible_v<entt::basic_delta_snapshot<entt::registry>>, "Copy constructible type not allowed");
+    static_assert(!std::is_copy_assignable_v<entt::basic_delta_snapshot<entt::registry>>, "Copy assignable type not allowed");
+    static_assert(std::is_move_constructible_v<entt::basic_delta_snapshot<entt::registry>>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<entt::basic_delta_snapshot<entt::registry>>, "Move assignable type required");
+
+    entt::registry registry;
+    entt::basic_delta_snapshot snapshot{registry};
+    entt::basic_delta_snapshot other{std::move(snapshot)};
+
+    ASSERT_NO_THROW(snapshot = std::move(other));
+}
+
+TEST(BasicDeltaSnapshot, Get) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry registry;
+    entt::basic_delta_snapshot snapshot{registry};
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+
+    registry.emplace<int>(entity[0u], 1);
+    registry.emplace<int>(entity[1u], 2);
+    registry.emplace<tracked>(entity[0u], 3);
+    registry.emplace<tracked>(entity[1u], 4);
+
+    std::vector<entt::any> data{};
+    auto archive = [&data](auto &&elem) { data.emplace_back(std::forward<decltype(elem)>(elem)); };
+
+    snapshot.get<tracked>(archive);
+
+    ASSERT_EQ(data.size(), 6u);
+    ASSERT_EQ(entt::any_cast<typename traits_type::entity_type>(data[0u]), 0u);
+    ASSERT_EQ(entt::any_cast<typename traits_type::entity_type>(data[1u]), 2u);
+
+    snapshot.baseline<entt::entity>().baseline<int>().baseline<tracked>();
+    data.clear();
+
+    snapshot.get<entt::entity>(archive).get<int>(archive).get<tracked>(archive);
+
+    ASSERT_EQ(data.size(), 10u);
+    ASSERT_EQ(entt::any_cast<typename traits_type::entity_type>(data[0u]), 0u);
+    ASSERT_EQ(entt::any_cast<typename traits_type::entity_type>(data[1u]), 0u);
+    ASSERT_EQ(entt::any_cast<typename traits_type::entity_type>(data[2u]), 0u);
+    ASSERT_EQ(entt::any_cast<typename traits_type::entity_type>(data[3u]), 2u);
+    ASSERT_EQ(entt::any_cast<typename traits_type::entity_type>(data[8u]), 0u);
+    ASSERT_EQ(entt::any_cast<typename traits_type::entity_type>(data[9u]), 0u);
+
+    registry.destroy(entity[2u]);
+    registry.remove<int>(entity[0u]);
+    registry.patch<tracked>(entity[1u], [](auto &elem) { elem.value = 5; });
+    registry.erase<tracked>(entity[0u]);
+
+    const auto other = registry.create();
+
+    data.clear();
+    snapshot.get<entt::entity>(archive);
+
+    ASSERT_EQ(data.size(), 4u);
+    ASSERT_EQ(entt::any_cast<typename traits_type::entity_type>(data[0u]), 1u);
+    ASSERT_EQ(entt::any_cast<entt::entity>(data[1u]), entity[2u]);
+    ASSERT_EQ(entt::any_cast<typename traits_type::entity_type>(data[2u]), 1u);
+    ASSERT_EQ(entt::any_cast<entt::entity>(data[3u]), other);
+
+    data.clear();
+    snapshot.get<tracked>(archive);
+
+    ASSERT_EQ(data.size(), 5u);
+    ASSERT_EQ(entt::any_cast<typename traits_type::entity_type>(data[0u]), 1u);
+    ASSERT_EQ(entt::any_cast<entt::entity>(data[1u]), entity[0u]);
+    ASSERT_EQ(entt::any_cast<typename traits_type::entity_type>(data[2u]), 1u);
+    ASSERT_EQ(entt::any_cast<entt::entity>(data[3u]), entity[1u]);
+    ASSERT_EQ(entt::any_cast<tracked>(data[4u]).value, 5);
+}
+
 TEST(BasicSnapshotLoader, Constructors) {
     static_assert(!std::is_default_constructible_v<entt::basic_snapshot_loader<entt::registry>>, "Default constructible type not allowed");
     static_assert(!std::is_copy_constructible_v<entt::basic_snapshot_loader<entt::registry>>, "Copy constructible type not allowed");
@@ -552,6 +843,72 @@ TEST(BasicSnapshotLoader, Orphans) {
     ASSERT_FALSE(registry.valid(entity[1u]));
 }
 
+TEST(BasicSnapshotLoader, GetTypeBulk) {
+    entt::registry registry;
+    entt::registry other;
+    bulk_output_archive output{};
+
+    std::array<entt::entity, 4u> entity{};
+    registry.create(entity.begin(), entity.end());
+    registry.destroy(entity[2u]);
+
+    registry.emplace<int>(entity[0u], 1);
+    registry.emplace<int>(entity[3u], 4);
+    registry.emplace<test::pointer_stable>(entity[1u], 2);
+
+    entt::basic_snapshot{registry}.get<entt::entity>(output).get<int>(output).get<test::pointer_stable>(output);
+
+    bulk_input_archive input{output.data, output.bytes};
+    entt::basic_snapshot_loader{other}.get<entt::entity>(input).get<int>(input).get<test::pointer_stable>(input);
+
+    ASSERT_EQ(input.pos, output.data.size());
+    ASSERT_EQ(input.offset, output.bytes.size());
+
+    ASSERT_TRUE(other.valid(entity[0u]));
+    ASSERT_FALSE(other.valid(entity[2u]));
+    ASSERT_EQ(other.storage<int>().size(), 2u);
+    ASSERT_EQ(other.get<int>(entity[0u]), 1);
+    ASSERT_EQ(other.get<int>(entity[3u]), 4);
+    ASSERT_EQ(other.get<test::pointer_stable>(entity[1u]), test::pointer_stable{2});
+}
+
+TEST(BasicSnapshotLoader, Threads) {
+    entt::registry source;
+    std::array<entt::entity, 8u> entity{};
+
+    source.create(entity.begin(), entity.end());
+
+    for(auto entt: entity) {
+        source.emplace<int>(entt, static_cast<int>(entt::to_integral(entt)));
+        source.emplace<char>(entt, static_cast<char>(entt::to_integral(entt)));
+    }
+
+    std::array<bulk_output_archive, 3u> output{};
+    const entt::basic_snapshot snapshot{source};
+    snapshot.get<entt::entity>(output[0u]).get<int>(output[1u]).get<char>(output[2u]);
+
+    entt::registry registry;
+    entt::basic_snapshot_loader loader{registry};
+    std::array<bulk_input_archive, 3u> input{};
+
+    for(std::size_t pos{}; pos < input.size(); ++pos) {
+        input[pos].data = std::move(output[pos].data);
+        input[pos].bytes = std::move(output[pos].bytes);
+    }
+
+    loader.get<entt::entity>(input[0u]);
+    registry.prepare<int, char>();
+
+    std::thread worker{[&loader, &input]() { loader.get<int>(input[1u]); }};
+    loader.get<char>(input[2u]);
+    worker.join();
+
+    for(auto entt: entity) {
+        ASSERT_EQ(registry.get<int>(entt), static_cast<int>(entt::to_integral(entt)));
+        ASSERT_EQ(registry.get<char>(entt), static_cast<char>(entt::to_integral(entt)));
+    }
+}
+
 TEST(BasicContinuousLoader, Constructors) {
     static_assert(!std::is_default_constructible_v<entt::basic_continuous_loader<entt::registry>>, "Default constructible type not allowed");
     static_assert(!std::is_copy_constructible_v<entt::basic_continuous_loader<entt::registry>>, "Copy constructible type not allowed");
@@ -758,6 +1115,30 @@ TEST(BasicContinuousLoader, GetType) {
     ASSERT_EQ(storage.get(loader.map(entity[1u])), value[1u]);
 }
 
+TEST(BasicContinuousLoader, GetTypeBulk) {
+    entt::registry registry;
+    entt::registry other;
+    entt::basic_continuous_loader loader{other};
+    bulk_output_archive output{};
+
+    std::array<entt::entity, 2u> entity{};
+    registry.create(entity.begin(), entity.end());
+    registry.emplace<int>(entity[0u], 1);
+    registry.emplace<int>(entity[1u], 2);
+
+    static_cast<void>(other.create());
+    entt::basic_snapshot{registry}.get<entt::entity>(output).get<int>(output);
+
+    bulk_input_archive input{output.data, output.bytes};
+    loader.get<entt::entity>(input).get<int>(input);
+
+    ASSERT_EQ(input.offset, output.bytes.size());
+    ASSERT_EQ(other.storage<int>().size(), 2u);
+    ASSERT_NE(loader.map(entity[0u]), entity[0u]);
+    ASSERT_EQ(other.get<int>(loader.map(entity[0u])), 1);
+    ASSERT_EQ(other.get<int>(loader.map(entity[1u])), 2);
+}
+
 TEST(BasicContinuousLoader, GetTypeExtended) {
     using namespace entt::literals;
     using traits_type = entt::entt_traits<entt::entity>;
@@ -811,6 +1192,50 @@ TEST(BasicContinuousLoader, GetTypeExtended) {
     ASSERT_EQ(storage.get(loader.map(entity[1u])).target, loader.map(entity[0u]));
 }
 
+TEST(BasicContinuousLoader, Remap) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::registry registry;
+    entt::basic_continuous_loader loader{registry};
+
+    std::vector<entt::any> data{};
+    auto archive = [&data, pos = 0u](auto &elem) mutable { elem = entt::any_cast<std::remove_reference_t<decltype(elem)>>(data[pos++]); };
+    const std::array entity{traits_type::construct(3u, 1u), traits_type::construct(8192u, 0u), traits_type::construct(1u, 2u)};
+    const auto local = registry.create();
+
+    registry.emplace<relationship>(local, entity[0u], std::vector{entity[1u]});
+
+    data.emplace_back(static_cast<typename traits_type::entity_type>(3u));
+    data.emplace_back(static_cast<typename traits_type::entity_type>(3u));
+
+    data.emplace_back(entity[0u]);
+    data.emplace_back(entity[1u]);
+    data.emplace_back(entity[2u]);
+
+    data.emplace_back(static_cast<typename traits_type::entity_type>(2u));
+    data.emplace_back(entity[0u]);
+    data.emplace_back(relationship{entity[2u], std::vector{entity[1u], entity[2u], traits_type::construct(3u, 0u)}});
+    data.emplace_back(entity[1u]);
+    data.emplace_back(relationship{entity[0u], {}});
+
+    loader.get<entt::entity>(archive).get<relationship>(archive).remap(&relationship::parent, &relationship::children);
+
+    std::array<entt::entity, 4u> other{};
+    const std::array remote{entity[0u], entity[1u], entity[2u], traits_type::construct(8192u, 1u)};
+
+    ASSERT_EQ(loader.map(remote.begin(), remote.end(), other.begin()), other.end());
+    ASSERT_TRUE(registry.valid(other[0u]));
+    ASSERT_TRUE(registry.valid(other[1u]));
+    ASSERT_TRUE(registry.valid(other[2u]));
+    ASSERT_EQ(other[3u], static_cast<entt::entity>(entt::null));
+
+    ASSERT_EQ(registry.get<relationship>(other[0u]).parent, other[2u]);
+    ASSERT_EQ(registry.get<relationship>(other[0u]).children, (std::vector<entt::entity>{other[1u], other[2u], entt::null}));
+    ASSERT_EQ(registry.get<relationship>(other[1u]).parent, other[0u]);
+    ASSERT_EQ(registry.get<relationship>(local).parent, entity[0u]);
+    ASSERT_EQ(registry.get<relationship>(local).children, (std::vector{entity[1u]}));
+}
+
 TEST(BasicContinuousLoader, GetEmptyType) {
     using namespace entt::literals;
     using traits_type = entt::entt_traits<entt::entity>;
@@ -948,6 +1373,57 @@ TEST(BasicContinuousLoader, GetTypeWithListener) {
     ASSERT_EQ(check, entity);
 }
 
+TEST(BasicContinuousLoader, Delta) {
+    entt::registry source;
+    entt::registry registry;
+    entt::basic_delta_snapshot snapshot{source};
+    entt::basic_continuous_loader loader{registry};
+    const std::array entity{source.create(), source.create(), source.create()};
+
+    std::vector<entt::any> data{};
+    std::size_t pos{};
+    auto output = [&data](auto &&elem) { data.emplace_back(std::forward<decltype(elem)>(elem)); };
+    auto input = [&data, &pos](auto &elem) { elem = entt::any_cast<std::remove_reference_t<decltype(elem)>>(data[pos++]); };
+
+    source.emplace<int>(entity[0u], 1);
+    source.emplace<int>(entity[1u], 2);
+    source.emplace<test::empty>(entity[2u]);
+    source.emplace<tracked>(entity[0u], 3);
+    source.emplace<tracked>(entity[1u], 4);
+
+    snapshot.get<entt::entity>(output).get<int>(output).get<test::empty>(output).get<tracked>(output);
+    snapshot.baseline<entt::entity>().baseline<int>().baseline<test::empty>().baseline<tracked>();
+    loader.delta<entt::entity>(input).delta<int>(input).delta<test::empty>(input).delta<tracked>(input);
+
+    ASSERT_EQ(registry.storage<entt::entity>().free_list(), 3u);
+    ASSERT_EQ(registry.get<int>(loader.map(entity[1u])), 2);
+    ASSERT_TRUE(registry.all_of<test::empty>(loader.map(entity[2u])));
+    ASSERT_EQ(registry.get<tracked>(loader.map(entity[0u])).value, 3);
+
+    source.destroy(entity[2u]);
+    source.remove<int>(entity[0u]);
+    source.patch<tracked>(entity[1u], [](auto &elem) { elem.value = 5; });
+
+    const auto other = source.create();
+    source.emplace<tracked>(other, 6);
+
+    data.clear();
+    pos = 0u;
+
+    snapshot.get<entt::entity>(output).get<int>(output).get<test::empty>(output).get<tracked>(output);
+    loader.delta<entt::entity>(input).delta<int>(input).delta<test::empty>(input).delta<tracked>(input);
+
+    ASSERT_FALSE(loader.contains(entity[2u]));
+    ASSERT_TRUE(loader.contains(other));
+    ASSERT_EQ(registry.storage<entt::entity>().free_list(), 3u);
+    ASSERT_FALSE(registry.all_of<int>(loader.map(entity[0u])));
+    ASSERT_EQ(registry.get<int>(loader.map(entity[1u])), 2);
+    ASSERT_TRUE(registry.storage<test::empty>().empty());
+    ASSERT_EQ(registry.get<tracked>(loader.map(entity[0u])).value, 3);
+    ASSERT_EQ(registry.get<tracked>(loader.map(entity[1u])).value, 5);
+    ASSERT_EQ(registry.get<tracked>(loader.map(other)).value, 6);
+}
+
 TEST(BasicContinuousLoader, Orphans) {
     using namespace entt::literals;
     using traits_type = entt::entt_traits<entt::entity>;
@@ -990,3 +1466,328 @@ TEST(BasicContinuousLoader, Orphans) {
     ASSERT_TRUE(registry.valid(loader.map(entity[0u])));
     ASSERT_FALSE(registry.valid(loader.map(entity[1u])));
 }
+
+TEST(BasicImageWriter, Constructors) {
+    static_assert(!std::is_default_constructible_v<entt::basic_image_writer<entt::registry>>, "Default constructible type not allowed");
+    static_assert(!std::is_copy_constructible_v<entt::basic_image_writer<entt::registry>>, "Copy constructible type not allowed");
+    static_assert(!std::is_copy_assignable_v<entt::basic_image_writer<entt::registry>>, "Copy assignable type not allowed");
+    static_assert(std::is_move_constructible_v<entt::basic_image_writer<entt::registry>>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<entt::basic_image_writer<entt::registry>>, "Move assignable type required");
+
+    const entt::registry registry;
+    entt::basic_image_writer writer{registry};
+    entt::basic_image_writer other{std::move(writer)};
+
+    ASSERT_NO_THROW(writer = std::move(other));
+    ASSERT_FALSE(writer.image().empty());
+}
+
+TEST(BasicImageLoader, Constructors) {
+    static_assert(!std::is_default_constructible_v<entt::basic_image_loader<entt::registry>>, "Default constructible type not allowed");
+    static_assert(!std::is_copy_constructible_v<entt::basic_image_loader<entt::registry>>, "Copy constructible type not allowed");
+    static_assert(!std::is_copy_assignable_v<entt::basic_image_loader<entt::registry>>, "Copy assignable type not allowed");
+    static_assert(!std::is_move_constructible_v<entt::basic_image_loader<entt::registry>>, "Move constructible type not allowed");
+    static_assert(!std::is_move_assignable_v<entt::basic_image_loader<entt::registry>>, "Move assignable type not allowed");
+
+    const entt::registry source;
+    const auto image = entt::basic_image_writer{source}.image();
+
+    entt::registry registry;
+    const entt::basic_image_loader loader{registry, image.data(), image.size()};
+
+    ASSERT_FALSE(loader.contains(entt::type_id<entt::entity>().hash()));
+}
+
+ENTT_DEBUG_TEST(BasicImageLoaderDeathTest, Constructors) {
+    const entt::registry source;
+    auto image = entt::basic_image_writer{source}.image();
+    entt::registry registry;
+
+    ASSERT_DEATH([[maybe_unused]] const entt::basic_image_loader loader(registry, image.data(), image.size() - 1u), "");
+
+    image[0u] = std::byte{};
+
+    ASSERT_DEATH([[maybe_unused]] const entt::basic_image_loader loader(registry, image.data(), image.size()), "");
+}
+
+TEST(BasicImageLoader, Get) {
+    entt::registry source;
+    const std::array entity{source.create(), source.create(), source.create()};
+
+    source.emplace<int>(entity[0u], 1);
+    source.emplace<int>(entity[2u], 3);
+    source.emplace<test::empty>(entity[1u]);
+    source.emplace<test::pointer_stable>(entity[0u], 4);
+    source.emplace<test::pointer_stable>(entity[1u], 5);
+    source.erase<test::pointer_stable>(entity[0u]);
+    source.destroy(source.create());
+
+    const auto image = entt::basic_image_writer{source}.get<entt::entity>().get<int>().get<test::empty>().get<test::pointer_stable>().get<double>().image();
+
+    entt::registry registry;
+    entt::basic_image_loader loader{registry, image.data(), image.size()};
+
+    ASSERT_TRUE(loader.contains(entt::type_id<int>().hash()));
+    ASSERT_FALSE(loader.contains(entt::type_id<double>().hash()));
+
+    loader.get<entt::entity>().get<int>().get<test::empty>().get<test::pointer_stable>().get<double>();
+
+    ASSERT_EQ(registry.storage<entt::entity>().size(), source.storage<entt::entity>().size());
+    ASSERT_EQ(registry.storage<entt::entity>().free_list(), source.storage<entt::entity>().free_list());
+    ASSERT_TRUE(registry.valid(entity[0u]));
+    ASSERT_TRUE(registry.valid(entity[1u]));
+    ASSERT_TRUE(registry.valid(entity[2u]));
+
+    ASSERT_EQ(registry.storage<int>().size(), 2u);
+    ASSERT_EQ(registry.get<int>(entity[0u]), 1);
+    ASSERT_EQ(registry.get<int>(entity[2u]), 3);
+    ASSERT_TRUE(registry.all_of<test::empty>(entity[1u]));
+    ASSERT_EQ(registry.storage<test::pointer_stable>().size(), 1u);
+    ASSERT_EQ(registry.get<test::pointer_stable>(entity[1u]).value, 5);
+    ASSERT_EQ(std::as_const(registry).storage<double>(), nullptr);
+}
+
+TEST(BasicImageLoader, Lazy) {
+    entt::registry source;
+    const std::array entity{source.create(), source.create()};
+
+    source.emplace<int>(entity[0u], 1);
+    source.emplace<int>(entity[1u], 2);
+    source.emplace<char>(entity[1u], 'c');
+
+    const auto image = entt::basic_image_writer{source}.get<entt::entity>().get<int>().get<char>().image();
+    const auto id = entt::type_id<int>().hash();
+
+    entt::registry registry;
+    entt::registry other;
+
+    {
+        entt::basic_image_loader loader{registry, image.data(), image.size()};
+
+        loader.lazy<entt::entity>().lazy<int>().lazy<char>();
+
+        ASSERT_FALSE(loader.pending(entt::type_id<entt::entity>().hash()));
+        ASSERT_TRUE(loader.pending(id));
+        ASSERT_TRUE(registry.valid(entity[1u]));
+        ASSERT_EQ(std::as_const(registry).storage<int>(), nullptr);
+
+        ASSERT_EQ(registry.get<int>(entity[1u]), 2);
+        ASSERT_EQ(registry.storage<int>().size(), 2u);
+        ASSERT_FALSE(loader.pending(id));
+        ASSERT_TRUE(loader.pending(entt::type_id<char>().hash()));
+
+        entt::basic_image_loader eager{other, image.data(), image.size()};
+        other.storage<int>();
+
+        eager.lazy<int>();
+
+        ASSERT_FALSE(eager.pending(id));
+        ASSERT_EQ(other.storage<int>().size(), 2u);
+    }
+
+    ASSERT_TRUE(registry.storage<char>().empty());
+}
+
+TEST(BasicImageLoader, Threads) {
+    entt::registry source;
+    std::array<entt::entity, 8u> entity{};
+
+    source.create(entity.begin(), entity.end());
+
+    for(auto entt: entity) {
+        source.emplace<int>(entt, static_cast<int>(entt::to_integral(entt)));
+        source.emplace<char>(entt, static_cast<char>(entt::to_integral(entt)));
+    }
+
+    const auto image = entt::basic_image_writer{source}.get<entt::entity>().get<int>().get<char>().image();
+
+    entt::registry registry;
+    entt::basic_image_loader loader{registry, image.data(), image.size()};
+
+    loader.get<entt::entity>();
+    registry.prepare<int, char>();
+
+    std::thread worker{[&loader]() { loader.get<int>(); }};
+    loader.get<char>();
+    worker.join();
+
+    for(auto entt: entity) {
+        ASSERT_EQ(registry.get<int>(entt), static_cast<int>(entt::to_integral(entt)));
+        ASSERT_EQ(registry.get<char>(entt), static_cast<char>(entt::to_integral(entt)));
+    }
+}
+
+TEST(BasicEntityPager, Constructors) {
+    static_assert(!std::is_default_constructible_v<entt::basic_entity_pager<entt::registry>>, "Default constructible type not allowed");
+    static_assert(!std::is_copy_constructible_v<entt::basic_entity_pager<entt::registry>>, "Copy constructible type not allowed");
+    static_assert(!std::is_copy_assignable_v<entt::basic_entity_pager<entt::registry>>, "Copy assignable type not allowed");
+    static_assert(std::is_move_constructible_v<entt::basic_entity_pager<entt::registry>>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<entt::basic_entity_pager<entt::registry>>, "Move assignable type required");
+
+    entt::registry registry;
+    entt::basic_entity_pager pager{registry};
+    entt::basic_entity_pager other{std::move(pager)};
+
+    ASSERT_NO_THROW(pager = std::move(other));
+    ASSERT_EQ(pager.size(), 0u);
+}
+
+TEST(BasicEntityPager, Functionalities) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create(), registry.create(), registry.create()};
+
+    registry.emplace<int>(entity[0u], 1);
+    registry.emplace<int>(entity[1u], 2);
+    registry.emplace<int>(entity[3u], 4);
+    registry.emplace<test::empty>(entity[1u]);
+    registry.emplace<char>(entity[0u], 'c');
+
+    entt::basic_entity_pager pager{registry};
+    pager.get<int>().get<test::empty>().get<char>().get<double>();
+
+    const auto first = pager.page_out(entity.begin(), entity.begin() + 2u);
+    const auto second = pager.page_out(entity.begin() + 2u, entity.end());
+
+    ASSERT_EQ(pager.size(), 4u);
+    ASSERT_TRUE(pager.contains(entity[0u]));
+    ASSERT_EQ(pager.page(entity[1u]), 0u);
+    ASSERT_EQ(pager.page(entity[3u]), 1u);
+
+    ASSERT_TRUE(registry.valid(entity[0u]));
+    ASSERT_TRUE(registry.orphan(entity[0u]));
+    ASSERT_TRUE(registry.storage<int>().empty());
+    ASSERT_TRUE(registry.storage<test::empty>().empty());
+    ASSERT_EQ(std::as_const(registry).storage<double>(), nullptr);
+
+    const auto other = registry.create();
+
+    ASSERT_NE(other, entity[0u]);
+    ASSERT_NE(other, entity[3u]);
+
+    pager.page_in(first.data(), first.size());
+
+    ASSERT_EQ(pager.size(), 2u);
+    ASSERT_FALSE(pager.contains(entity[0u]));
+    ASSERT_TRUE(pager.contains(entity[2u]));
+
+    ASSERT_EQ(registry.get<int>(entity[0u]), 1);
+    ASSERT_EQ(registry.get<int>(entity[1u]), 2);
+    ASSERT_EQ(registry.get<char>(entity[0u]), 'c');
+    ASSERT_TRUE(registry.all_of<test::empty>(entity[1u]));
+    ASSERT_FALSE(registry.all_of<int>(entity[3u]));
+
+    registry.destroy(entity[3u]);
+    pager.page_in(second.data(), second.size());
+
+    ASSERT_EQ(pager.size(), 0u);
+    ASSERT_EQ(registry.storage<int>().size(), 2u);
+    ASSERT_TRUE(registry.orphan(entity[2u]));
+}
+
+ENTT_DEBUG_TEST(BasicEntityPagerDeathTest, Functionalities) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    entt::basic_entity_pager pager{registry};
+
+    auto image = pager.page_out(&entity, &entity + 1u);
+
+    ASSERT_DEATH([[maybe_unused]] const auto other = pager.page_out(&entity, &entity + 1u), "");
+    ASSERT_DEATH(pager.page_in(image.data(), image.size() - 1u), "");
+
+    image[0u] = std::byte{};
+
+    ASSERT_DEATH(pager.page_in(image.data(), image.size()), "");
+}
+
+TEST(PackedArchive, Functionalities) {
+    entt::registry registry;
+    std::array<entt::entity, 256u> entity{};
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<int>(entity.begin(), entity.end(), -3);
+    registry.insert<test::pointer_stable>(entity.begin(), entity.end(), test::pointer_stable{4});
+    registry.destroy(entity[1u]);
+
+    entt::packed_output_archive output{};
+    std::vector<entt::any> data{};
+    auto archive = [&data](auto &&elem) { data.emplace_back(std::forward<decltype(elem)>(elem)); };
+
+    entt::basic_snapshot{registry}.get<entt::entity>(output).get<int>(output).get<test::pointer_stable>(output);
+    entt::basic_snapshot{registry}.get<entt::entity>(archive).get<int>(archive).get<test::pointer_stable>(archive);
+
+    // one byte per entity and integral value, four bytes per pointer stable element
+    ASSERT_LT(output.data().size(), data.size() * 2u + entity.size() * sizeof(test::pointer_stable));
+
+    entt::registry other;
+    entt::packed_input_archive input{output.data().data(), output.data().size()};
+    entt::basic_snapshot_loader{other}.get<entt::entity>(input).get<int>(input).get<test::pointer_stable>(input);
+
+    ASSERT_EQ(input.size(), 0u);
+    ASSERT_EQ(other.storage<entt::entity>().size(), registry.storage<entt::entity>().size());
+    ASSERT_EQ(other.storage<entt::entity>().free_list(), registry.storage<entt::entity>().free_list());
+    ASSERT_FALSE(other.valid(entity[1u]));
+
+    for(auto entt: registry.view<int, test::pointer_stable>()) {
+        ASSERT_EQ(other.get<int>(entt), -3);
+        ASSERT_EQ(other.get<test::pointer_stable>(entt).value, 4);
+    }
+}
+
+TEST(PackedArchive, Codec) {
+    entt::packed_output_archive output{};
+
+    output(quantized{1.25f});
+    output(std::uint64_t{300u});
+    output(std::int8_t{-1});
+    output(true);
+
+    ASSERT_EQ(output.data().size(), 6u);
+
+    entt::packed_input_archive input{output.data().data(), output.data().size()};
+    quantized value{};
+    std::uint64_t unsigned_value{};
+    std::int8_t signed_value{};
+    bool flag{};
+
+    input(value);
+    input(unsigned_value);
+    input(signed_value);
+    input(flag);
+
+    ASSERT_EQ(value.value, 1.25f);
+    ASSERT_EQ(unsigned_value, 300u);
+    ASSERT_EQ(signed_value, -1);
+    ASSERT_TRUE(flag);
+    ASSERT_EQ(input.size(), 0u);
+}
+
+TEST(PackedArchive, BlockCodec) {
+    entt::registry registry;
+    std::array<entt::entity, 64u> entity{};
+
+    registry.create(entity.begin(), entity.end());
+    registry.insert<int>(entity.begin(), entity.end(), 2);
+
+    entt::basic_packed_output_archive<entt::entity, run_length_codec> output{};
+    entt::basic_snapshot{registry}.get<entt::entity>(output).get<int>(output);
+
+    entt::registry other;
+    entt::basic_packed_input_archive<entt::entity, run_length_codec> input{output.data().data(), output.data().size(), run_length_codec{}};
+    entt::basic_snapshot_loader{other}.get<entt::entity>(input).get<int>(input);
+
+    ASSERT_EQ(input.size(), 0u);
+
+    for(auto entt: entity) {
+        ASSERT_EQ(other.get<int>(entt), 2);
+    }
+}
+
+ENTT_DEBUG_TEST(PackedArchiveDeathTest, Functionalities) {
+    entt::packed_output_archive output{};
+    output(std::uint32_t{1024u});
+
+    entt::packed_input_archive input{output.data().data(), output.data().size() - 1u};
+    std::uint32_t value{};
+
+    ASSERT_DEATH(input(value), "");
+}
@@ -0,0 +1,194 @@
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/core/type_traits.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/soa_storage.hpp>
+#include <entt/entity/view.hpp>
+
+struct position {
+    int x{};
+    int y{};
+
+    using soa_columns = entt::value_list<&position::x, &position::y>;
+};
+
+[[nodiscard]] bool operator==(const position &lhs, const position &rhs) {
+    return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+TEST(SoaStorage, Constructors) {
+    entt::soa_storage<position> pool;
+
+    ASSERT_EQ(pool.policy(), entt::deletion_policy::swap_and_pop);
+    ASSERT_NO_THROW([[maybe_unused]] auto alloc = pool.get_allocator());
+    ASSERT_EQ(pool.info(), entt::type_id<position>());
+    ASSERT_TRUE(pool.empty());
+
+    pool.emplace(entt::entity{1}, 1, 2);
+    entt::soa_storage<position> other{std::move(pool)};
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_FALSE(other.empty());
+    ASSERT_EQ(static_cast<position>(other.get(entt::entity{1})), (position{1, 2}));
+
+    pool = std::move(other);
+
+    ASSERT_FALSE(pool.empty());
+    ASSERT_TRUE(other.empty());
+}
+
+TEST(SoaStorage, Functionalities) {
+    entt::soa_storage<position> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{42}};
+
+    pool.reserve(4u);
+
+    ASSERT_EQ(pool.capacity(), 4u);
+
+    pool.emplace(entity[0u], 1, 2);
+    pool.emplace(entity[1u], position{3, 4});
+    pool.emplace(entity[2u]);
+
+    ASSERT_EQ(pool.size(), 3u);
+    ASSERT_EQ(pool.get(entity[0u]).get<&position::x>(), 1);
+    ASSERT_EQ(pool.get(entity[1u]).get<&position::y>(), 4);
+    ASSERT_EQ(static_cast<position>(std::as_const(pool).get(entity[2u])), position{});
+
+    pool.get(entity[2u]) = position{5, 6};
+    pool.patch(entity[0u], [](auto &elem) { elem.template get<&position::x>() = 7; });
+
+    ASSERT_EQ(static_cast<position>(pool.get(entity[0u])), (position{7, 2}));
+    ASSERT_EQ(static_cast<position>(pool.get(entity[2u])), (position{5, 6}));
+
+    ASSERT_EQ(pool.column<&position::x>()[pool.index(entity[1u])], 3);
+    ASSERT_EQ(std::as_const(pool).column<&position::y>()[pool.index(entity[2u])], 6);
+
+    pool.erase(entity[0u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_FALSE(pool.contains(entity[0u]));
+    ASSERT_EQ(static_cast<position>(pool.get(entity[1u])), (position{3, 4}));
+    ASSERT_EQ(static_cast<position>(pool.get(entity[2u])), (position{5, 6}));
+
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.capacity(), 2u);
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST(SoaStorage, InsertGenerator) {
+    entt::soa_storage<position> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+
+    pool.insert(entity.begin(), entity.end(), [](const entt::entity entt) { return position{static_cast<int>(entt::to_integral(entt)), 0}; });
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(static_cast<position>(pool.get(entity[0u])), (position{1, 0}));
+    ASSERT_EQ(static_cast<position>(pool.get(entity[1u])), (position{3, 0}));
+}
+
+TEST(SoaStorage, Iterator) {
+    entt::soa_storage<position> pool;
+
+    pool.emplace(entt::entity{1}, 1, 1);
+    pool.emplace(entt::entity{2}, 2, 2);
+
+    auto first = pool.begin();
+    entt::soa_storage<position>::const_iterator cfirst = first;
+
+    ASSERT_EQ(cfirst, pool.cbegin());
+    ASSERT_EQ(pool.end() - first, 2);
+    ASSERT_EQ((*first).get<&position::x>(), 2);
+    ASSERT_EQ(first[1].get<&position::y>(), 1);
+    ASSERT_EQ(++first, pool.end() - 1);
+    ASSERT_EQ(first->get<&position::x>(), 1);
+    ASSERT_EQ(pool.rbegin()->get<&position::x>(), 1);
+
+    for(auto elem: pool) {
+        elem.get<&position::y>() *= 10;
+    }
+
+    ASSERT_EQ(pool.get(entt::entity{1}).get<&position::y>(), 10);
+    ASSERT_EQ(pool.get(entt::entity{2}).get<&position::y>(), 20);
+}
+
+TEST(SoaStorage, Iterable) {
+    entt::soa_storage<position> pool;
+
+    pool.emplace(entt::entity{1}, 1, 1);
+    pool.emplace(entt::entity{3}, 3, 3);
+
+    for(auto [entt, elem]: pool.each()) {
+        testing::StaticAssertTypeEq<decltype(elem), entt::soa_reference<position>>();
+        ASSERT_EQ(elem.get<&position::x>(), static_cast<int>(entt::to_integral(entt)));
+    }
+
+    for(auto [entt, elem]: std::as_const(pool).reach()) {
+        testing::StaticAssertTypeEq<decltype(elem), entt::soa_reference<const position>>();
+        ASSERT_EQ(elem.get<&position::y>(), static_cast<int>(entt::to_integral(entt)));
+    }
+}
+
+TEST(SoaStorage, Sort) {
+    entt::soa_storage<position> pool;
+
+    pool.emplace(entt::entity{1}, 3, 0);
+    pool.emplace(entt::entity{2}, 1, 0);
+    pool.emplace(entt::entity{3}, 2, 0);
+
+    pool.sort([&pool](const entt::entity lhs, const entt::entity rhs) { return pool.get(lhs).get<&position::x>() < pool.get(rhs).get<&position::x>(); });
+
+    ASSERT_EQ(pool.begin()->get<&position::x>(), 1);
+    ASSERT_EQ((pool.begin() + 1)->get<&position::x>(), 2);
+    ASSERT_EQ((pool.begin() + 2)->get<&position::x>(), 3);
+    ASSERT_EQ(pool.get(entt::entity{1}).get<&position::x>(), 3);
+}
+
+TEST(SoaStorage, Registry) {
+    entt::registry registry;
+    const auto entity = registry.create();
+    const auto other = registry.create();
+
+    testing::StaticAssertTypeEq<entt::storage_type_t<position>, entt::sigh_mixin<entt::soa_storage<position>>>();
+
+    registry.emplace<position>(entity, 1, 2);
+    registry.emplace<position>(other, 3, 4);
+    registry.emplace<char>(other);
+
+    ASSERT_EQ(static_cast<position>(registry.get<position>(entity)), (position{1, 2}));
+
+    registry.replace<position>(entity, 5, 6);
+    registry.patch<position>(other, [](auto &elem) { elem.template get<&position::y>() = 0; });
+
+    ASSERT_EQ(static_cast<position>(registry.get<const position>(entity)), (position{5, 6}));
+    ASSERT_EQ(static_cast<position>(registry.get<position>(other)), (position{3, 0}));
+
+    std::size_t count{};
+
+    registry.view<position>().each([&count](auto elem) {
+        elem.template get<&position::x>() += 1;
+        ++count;
+    });
+
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(registry.get<position>(entity).get<&position::x>(), 6);
+
+    registry.view<const position, char>().each([other](const auto entt, const auto elem, const char) {
+        ASSERT_EQ(entt, other);
+        ASSERT_EQ(elem.template get<&position::x>(), 4);
+    });
+
+    registry.erase<position>(entity);
+
+    ASSERT_FALSE(registry.all_of<position>(entity));
+    ASSERT_EQ(registry.storage<position>().size(), 1u);
+}
@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/core/algorithm.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include "../../common/linter.hpp"
+
+struct sprite {
+    int depth;
+};
+
+template<>
+struct entt::storage_type<sprite> {
+    using type = entt::sigh_mixin<entt::sorted_mixin<entt::storage<sprite>>>;
+};
+
+template<typename Type>
+bool is_sorted(const Type &pool) {
+    return std::is_sorted(pool.begin(), pool.end(), [](const auto &lhs, const auto &rhs) { return lhs.depth < rhs.depth; });
+}
+
+TEST(SortedMixin, Functionalities) {
+    entt::sorted_mixin<entt::storage<sprite>> pool;
+    const auto compare = [&pool](const entt::entity lhs, const entt::entity rhs) { return pool.get(lhs).depth < pool.get(rhs).depth; };
+
+    for(std::size_t pos{}; pos < 16u; ++pos) {
+        pool.emplace(entt::entity{static_cast<entt::id_type>(pos)}, static_cast<int>((pos * 7u) % 16u));
+    }
+
+    ASSERT_EQ(pool.pending(), 16u);
+    ASSERT_FALSE(is_sorted(pool));
+
+    pool.sort(compare);
+
+    ASSERT_EQ(pool.pending(), 0u);
+    ASSERT_TRUE(is_sorted(pool));
+
+    pool.patch(entt::entity{3}, [](auto &elem) { elem.depth = -1; });
+    pool.patch(entt::entity{5}, [](auto &elem) { elem.depth = 32; });
+    pool.patch(entt::entity{5}, [](auto &elem) { elem.depth = 8; });
+    pool.emplace(entt::entity{16}, 4);
+
+    ASSERT_EQ(pool.pending(), 3u);
+    ASSERT_FALSE(is_sorted(pool));
+
+    pool.sort(compare, entt::insertion_sort{});
+
+    ASSERT_EQ(pool.pending(), 0u);
+    ASSERT_TRUE(is_sorted(pool));
+    ASSERT_EQ(pool.begin()->depth, -1);
+
+    pool.erase(pool.data()[0u]);
+
+    ASSERT_EQ(pool.pending(), 1u);
+
+    pool.sort(compare);
+
+    ASSERT_EQ(pool.pending(), 0u);
+    ASSERT_TRUE(is_sorted(pool));
+
+    pool.clear();
+
+    ASSERT_EQ(pool.pending(), 0u);
+}
+
+TEST(SortedMixin, Insert) {
+    entt::sorted_mixin<entt::storage<sprite>> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+    const std::array value{sprite{4}, sprite{2}};
+
+    pool.sort([](auto, auto) { return false; });
+    pool.insert(entity.begin(), entity.end(), value.begin());
+
+    ASSERT_EQ(pool.pending(), 2u);
+
+    pool.sort([&pool](const entt::entity lhs, const entt::entity rhs) { return pool.get(lhs).depth < pool.get(rhs).depth; });
+
+    ASSERT_EQ(pool.pending(), 0u);
+    ASSERT_TRUE(is_sorted(pool));
+
+    pool.remove(entity.begin(), entity.end());
+
+    ASSERT_EQ(pool.pending(), 0u);
+}
+
+TEST(SortedMixin, Move) {
+    entt::sorted_mixin<entt::storage<sprite>> pool;
+
+    static_assert(std::is_move_constructible_v<decltype(pool)>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<decltype(pool)>, "Move assignable type required");
+
+    pool.emplace(entt::entity{1}, 2);
+
+    entt::sorted_mixin<entt::storage<sprite>> other{std::move(pool)};
+
+    test::is_initialized(pool);
+
+    ASSERT_EQ(pool.pending(), 0u);
+    ASSERT_EQ(other.pending(), 1u);
+
+    pool = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_EQ(pool.pending(), 1u);
+
+    other.emplace(entt::entity{3}, 4);
+    other.emplace(entt::entity{5}, 4);
+    pool.swap(other);
+
+    ASSERT_EQ(pool.pending(), 2u);
+    ASSERT_EQ(other.pending(), 1u);
+}
+
+TEST(SortedMixin, Registry) {
+    entt::registry registry;
+
+    for(int pos{}; pos < 64; ++pos) {
+        registry.emplace<sprite>(registry.create(), (pos * 37) % 64);
+    }
+
+    auto &&storage = registry.storage<sprite>();
+    const auto compare = [](const sprite &lhs, const sprite &rhs) { return lhs.depth < rhs.depth; };
+
+    registry.sort<sprite>(compare);
+
+    ASSERT_EQ(storage.pending(), 0u);
+    ASSERT_TRUE(is_sorted(storage));
+
+    for(std::size_t pos{}; pos < 64u; pos += 9u) {
+        const auto entt = storage.data()[pos];
+        registry.replace<sprite>(entt, 63 - storage.get(entt).depth);
+    }
+
+    registry.destroy(storage.data()[4u]);
+    registry.emplace<sprite>(registry.create(), -1);
+
+    ASSERT_FALSE(is_sorted(storage));
+
+    registry.sort<sprite>(compare);
+
+    ASSERT_EQ(storage.pending(), 0u);
+    ASSERT_TRUE(is_sorted(storage));
+    ASSERT_EQ(storage.begin()->depth, -1);
+}
+
+TEST(SortedMixin, SortAs) {
+    entt::sorted_mixin<entt::storage<sprite>> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{5}};
+    const auto compare = [&pool](const entt::entity lhs, const entt::entity rhs) { return pool.get(lhs).depth < pool.get(rhs).depth; };
+
+    pool.emplace(entity[0u], 1);
+    pool.emplace(entity[1u], 3);
+    pool.emplace(entity[2u], 5);
+
+    pool.sort(compare);
+    pool.sort_as(entity.rbegin(), entity.rend());
+
+    ASSERT_FALSE(is_sorted(pool));
+
+    pool.sort(compare);
+
+    ASSERT_TRUE(is_sorted(pool));
+}
@@ -6,8 +6,10 @@
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/config/config.h>
+#include <entt/core/algorithm.hpp>
 #include <entt/core/type_info.hpp>
 #include <entt/entity/entity.hpp>
 #include <entt/entity/sparse_set.hpp>
@@ -169,6 +171,63 @@ TYPED_TEST(SparseSet, Swap) {
     }
 }
 
+TYPED_TEST(SparseSet, DeepCopyFrom) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+    using traits_type = entt::entt_traits<entity_type>;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+        sparse_set_type other{entt::type_id<void>(), policy, 4u};
+
+        const std::array entity{entity_type{1}, entity_type{3}, entity_type{traits_type::page_size + 2u}};
+
+        set.push(entity.begin(), entity.end());
+        set.erase(entity[1u]);
+
+        other.push(entity_type{traits_type::page_size * 2u});
+        other.deep_copy_from(set);
+
+        ASSERT_EQ(other.size(), set.size());
+        ASSERT_EQ(other.free_list(), set.free_list());
+        ASSERT_TRUE(std::equal(set.data(), set.data() + set.size(), other.data()));
+
+        ASSERT_TRUE(other.contains(entity[0u]));
+        ASSERT_FALSE(other.contains(entity[1u]));
+        ASSERT_TRUE(other.contains(entity[2u]));
+        ASSERT_FALSE(other.contains(entity_type{traits_type::page_size * 2u}));
+
+        ASSERT_EQ(other.index(entity[0u]), set.index(entity[0u]));
+        ASSERT_EQ(other.index(entity[2u]), set.index(entity[2u]));
+        ASSERT_EQ(other.current(entity[1u]), set.current(entity[1u]));
+
+        set.erase(entity[0u]);
+
+        ASSERT_TRUE(other.contains(entity[0u]));
+
+        other.deep_copy_from(other);
+
+        ASSERT_TRUE(other.contains(entity[0u]));
+
+        other.push(entity[1u]);
+
+        ASSERT_TRUE(other.contains(entity[1u]));
+        ASSERT_FALSE(set.contains(entity[1u]));
+    }
+}
+
+ENTT_DEBUG_TYPED_TEST(SparseSetDeathTest, DeepCopyFrom) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+
+    sparse_set_type set{entt::deletion_policy::swap_and_pop};
+    sparse_set_type other{entt::deletion_policy::in_place};
+    sparse_set_type typed{entt::type_id<int>()};
+
+    ASSERT_DEATH(set.deep_copy_from(other), "");
+    ASSERT_DEATH(set.deep_copy_from(typed), "");
+}
+
 TYPED_TEST(SparseSet, FreeList) {
     using entity_type = typename TestFixture::type;
     using sparse_set_type = entt::basic_sparse_set<entity_type>;
@@ -285,6 +344,92 @@ TYPED_TEST(SparseSet, Capacity) {
     }
 }
 
+TYPED_TEST(SparseSet, MemoryUsage) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+    using traits_type = entt::entt_traits<entity_type>;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+
+        ASSERT_EQ(set.memory_usage().bytes(), 0u);
+
+        set.reserve(4u);
+        set.push(entity_type{1});
+        set.push(entity_type{2});
+        set.push(entity_type{traits_type::page_size * 2u});
+        set.erase(entity_type{1});
+
+        const auto report = set.memory_usage();
+
+        ASSERT_EQ(report.sparse_pages, 2u);
+        ASSERT_GE(report.sparse_bytes, 2u * traits_type::page_size * sizeof(entity_type));
+        ASSERT_EQ(report.packed_bytes, set.capacity() * sizeof(entity_type) + (policy == entt::deletion_policy::in_place) * sizeof(std::size_t));
+        ASSERT_EQ(report.element_pages, 0u);
+        ASSERT_EQ(report.element_bytes, 0u);
+        ASSERT_EQ(report.bytes(), report.sparse_bytes + report.packed_bytes);
+        ASSERT_EQ(report.tombstones, static_cast<std::size_t>(policy == entt::deletion_policy::in_place));
+        ASSERT_EQ(report.free_list, static_cast<std::size_t>(policy == entt::deletion_policy::swap_only));
+
+        set.clear();
+        set.shrink_to_fit();
+
+        ASSERT_EQ(set.memory_usage().sparse_pages, 0u);
+        ASSERT_EQ(set.memory_usage().tombstones, 0u);
+    }
+}
+
+TYPED_TEST(SparseSet, Repaginate) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+    using traits_type = entt::entt_traits<entity_type>;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+        const std::array entity{entity_type{1}, entity_type{traits_type::page_size + 3u}, entity_type{5}};
+
+        ASSERT_EQ(set.sparse_page_size(), traits_type::page_size);
+
+        set.push(entity.begin(), entity.end());
+        set.erase(entity[2u]);
+        set.sparse_page_size(16u);
+
+        ASSERT_EQ(set.sparse_page_size(), 16u);
+        ASSERT_EQ(set.extent(), traits_type::page_size + 16u);
+
+        ASSERT_TRUE(set.contains(entity[0u]));
+        ASSERT_TRUE(set.contains(entity[1u]));
+        ASSERT_EQ(set.index(entity[0u]), 0u);
+        ASSERT_EQ(set.index(entity[1u]), 1u);
+
+        switch(policy) {
+        case entt::deletion_policy::swap_and_pop: {
+            ASSERT_FALSE(set.contains(entity[2u]));
+        } break;
+        case entt::deletion_policy::in_place: {
+            ASSERT_FALSE(set.contains(entity[2u]));
+            ASSERT_EQ(set.size(), 3u);
+        } break;
+        case entt::deletion_policy::swap_only: {
+            ASSERT_FALSE(set.contains(entity[2u]));
+            ASSERT_EQ(set.current(entity[2u]), traits_type::to_version(traits_type::next(entity[2u])));
+            ASSERT_EQ(set.free_list(), 2u);
+        } break;
+        }
+
+        set.push(entity_type{7});
+
+        ASSERT_TRUE(set.contains(entity_type{7}));
+
+        set.sparse_page_size(traits_type::page_size);
+
+        ASSERT_EQ(set.extent(), 2u * traits_type::page_size);
+        ASSERT_TRUE(set.contains(entity[0u]));
+        ASSERT_TRUE(set.contains(entity[1u]));
+        ASSERT_TRUE(set.contains(entity_type{7}));
+    }
+}
+
 TYPED_TEST(SparseSet, ShrinkToFit) {
     using entity_type = typename TestFixture::type;
     using sparse_set_type = entt::basic_sparse_set<entity_type>;
@@ -473,6 +618,49 @@ TYPED_TEST(SparseSet, Pagination) {
     }
 }
 
+TYPED_TEST(SparseSet, SparsePageSize) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+    constexpr std::size_t page_size = 8u;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{entt::type_id<void>(), policy, page_size};
+        sparse_set_type other{std::move(set)};
+
+        ASSERT_EQ(other.extent(), 0u);
+
+        other.push(entity_type{page_size - 1u});
+
+        ASSERT_EQ(other.extent(), page_size);
+
+        other.push(entity_type{page_size * 3u});
+
+        ASSERT_EQ(other.extent(), page_size * 4u);
+        ASSERT_TRUE(other.contains(entity_type{page_size - 1u}));
+        ASSERT_TRUE(other.contains(entity_type{page_size * 3u}));
+        ASSERT_FALSE(other.contains(entity_type{page_size}));
+        ASSERT_EQ(other.index(entity_type{page_size * 3u}), 1u);
+
+        sparse_set_type swapped{policy};
+        swapped.push(entity_type{page_size - 1u});
+        swapped.swap(other);
+
+        ASSERT_EQ(swapped.extent(), page_size * 4u);
+        ASSERT_EQ(other.extent(), entt::entt_traits<entity_type>::page_size);
+
+        swapped.erase(entity_type{page_size * 3u});
+        swapped.shrink_to_fit();
+
+        if(policy == entt::deletion_policy::swap_only) {
+            ASSERT_EQ(swapped.extent(), page_size * 4u);
+        } else {
+            ASSERT_EQ(swapped.extent(), page_size);
+        }
+
+        ASSERT_TRUE(swapped.contains(entity_type{page_size - 1u}));
+    }
+}
+
 TYPED_TEST(SparseSet, Contiguous) {
     using entity_type = typename TestFixture::type;
     using sparse_set_type = entt::basic_sparse_set<entity_type>;
@@ -1292,6 +1480,59 @@ ENTT_DEBUG_TYPED_TEST(SparseSetDeathTest, Bump) {
     }
 }
 
+TYPED_TEST(SparseSet, Rename) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+    using traits_type = entt::entt_traits<entity_type>;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+
+        const std::array entity{entity_type{1}, entity_type{3}, traits_type::construct(2, 4)};
+        const auto other = traits_type::construct(4096, 2);
+
+        set.push(entity.begin(), entity.end());
+        set.rename(entity[1u], other);
+
+        ASSERT_EQ(set.size(), 3u);
+        ASSERT_FALSE(set.contains(entity[1u]));
+        ASSERT_TRUE(set.contains(other));
+        ASSERT_EQ(set.index(other), 1u);
+        ASSERT_EQ(set.current(other), 2u);
+        ASSERT_EQ(set.data()[1u], other);
+
+        set.rename(other, entity[1u]);
+
+        ASSERT_EQ(set.index(entity[1u]), 1u);
+        ASSERT_FALSE(set.contains(other));
+    }
+}
+
+ENTT_DEBUG_TYPED_TEST(SparseSetDeathTest, Rename) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+
+        // rename works the same in all cases, test only once
+        switch(policy) {
+        case entt::deletion_policy::swap_and_pop:
+            set.push(entity_type{1});
+            set.push(entity_type{3});
+
+            ASSERT_DEATH(set.rename(entity_type{2}, entity_type{4}), "");
+            ASSERT_DEATH(set.rename(entity_type{1}, entity_type{3}), "");
+            ASSERT_DEATH(set.rename(entity_type{1}, entt::tombstone), "");
+            break;
+        case entt::deletion_policy::in_place:
+        case entt::deletion_policy::swap_only:
+            SUCCEED();
+            break;
+        }
+    }
+}
+
 TYPED_TEST(SparseSet, Erase) {
     using entity_type = typename TestFixture::type;
     using sparse_set_type = entt::basic_sparse_set<entity_type>;
@@ -1680,6 +1921,196 @@ TYPED_TEST(SparseSet, Compact) {
     }
 }
 
+
+TYPED_TEST(SparseSet, CompactIncremental) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+
+    sparse_set_type set{entt::deletion_policy::in_place};
+    const std::array entity{entity_type{0}, entity_type{1}, entity_type{2}, entity_type{3}, entity_type{4}, entity_type{5}, entity_type{6}, entity_type{7}};
+
+    set.push(entity.begin(), entity.end());
+    set.erase(entity[0u]);
+    set.erase(entity[2u]);
+    set.erase(entity[4u]);
+    set.erase(entity[7u]);
+
+    ASSERT_EQ(set.size(), 8u);
+    ASSERT_EQ(set.memory_usage().tombstones, 4u);
+
+    set.compact(1u);
+
+    ASSERT_EQ(set.size(), 6u);
+    ASSERT_EQ(set.memory_usage().tombstones, 2u);
+    ASSERT_EQ(set.index(entity[6u]), 4u);
+    ASSERT_EQ(set.index(entity[5u]), 5u);
+
+    set.compact(1u);
+
+    ASSERT_EQ(set.size(), 5u);
+    ASSERT_EQ(set.memory_usage().tombstones, 1u);
+    ASSERT_EQ(set.index(entity[5u]), 2u);
+
+    set.push(entity[0u]);
+
+    ASSERT_EQ(set.index(entity[0u]), 0u);
+    ASSERT_EQ(set.memory_usage().tombstones, 0u);
+
+    set.erase(entity[1u]);
+    set.compact(8u);
+
+    ASSERT_EQ(set.size(), 4u);
+    ASSERT_EQ(set.memory_usage().tombstones, 0u);
+    ASSERT_EQ(set.index(entity[0u]), 0u);
+    ASSERT_EQ(set.index(entity[6u]), 1u);
+    ASSERT_EQ(set.index(entity[5u]), 2u);
+    ASSERT_EQ(set.index(entity[3u]), 3u);
+
+    set.push(entity[7u]);
+
+    ASSERT_EQ(set.index(entity[7u]), 4u);
+}
+
+TYPED_TEST(SparseSet, Compaction) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+
+    sparse_set_type set{entt::deletion_policy::in_place};
+    const std::array entity{entity_type{0}, entity_type{1}, entity_type{2}, entity_type{3}};
+
+    set.compaction(.25f, 1u);
+    set.push(entity.begin(), entity.end());
+    set.erase(entity[0u]);
+
+    ASSERT_EQ(set.size(), 4u);
+
+    set.erase(entity[1u]);
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(set.index(entity[3u]), 1u);
+    ASSERT_EQ(set.memory_usage().tombstones, 1u);
+
+    set.compaction(0.f, 0u);
+    set.erase(entity[2u]);
+
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(set.memory_usage().tombstones, 2u);
+}
+
+TYPED_TEST(SparseSet, ChangePolicy) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+    using traits_type = entt::entt_traits<entity_type>;
+
+    const std::array entity{entity_type{1}, entity_type{3}, entity_type{4}};
+    sparse_set_type set{entt::deletion_policy::swap_and_pop};
+
+    set.push(entity.begin(), entity.end());
+    set.policy(entt::deletion_policy::in_place);
+    set.erase(entity[0u]);
+
+    ASSERT_EQ(set.policy(), entt::deletion_policy::in_place);
+    ASSERT_EQ(set.size(), 3u);
+    ASSERT_EQ(set.index(entity[2u]), 2u);
+
+    set.policy(entt::deletion_policy::swap_and_pop);
+
+    ASSERT_EQ(set.policy(), entt::deletion_policy::swap_and_pop);
+    ASSERT_EQ(set.free_list(), traits_type::to_entity(entt::tombstone));
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_EQ(set.index(entity[2u]), 0u);
+    ASSERT_EQ(set.index(entity[1u]), 1u);
+
+    set.policy(entt::deletion_policy::swap_only);
+
+    ASSERT_EQ(set.free_list(), 2u);
+
+    set.erase(entity[2u]);
+
+    ASSERT_EQ(set.size(), 2u);
+    ASSERT_EQ(set.free_list(), 1u);
+
+    set.policy(entt::deletion_policy::swap_and_pop);
+
+    ASSERT_EQ(set.size(), 1u);
+    ASSERT_FALSE(set.contains(entity[2u]));
+    ASSERT_TRUE(set.contains(entity[1u]));
+    ASSERT_EQ(set.index(entity[1u]), 0u);
+
+    set.push(entity[2u]);
+
+    ASSERT_EQ(set.index(entity[2u]), 1u);
+}
+
+TEST(SparseSet, SuggestedPolicy) {
+    entt::storage_statistics stats{};
+
+    ASSERT_EQ(entt::suggested_policy(stats), entt::deletion_policy::swap_and_pop);
+
+    stats.peak = 4u;
+    stats.erased = 16u;
+    stats.iterations = 1u;
+    stats.gets = 2u;
+
+    ASSERT_EQ(entt::suggested_policy(stats), entt::deletion_policy::swap_and_pop);
+
+    stats.gets = 64u;
+
+    ASSERT_EQ(entt::suggested_policy(stats), entt::deletion_policy::in_place);
+
+    stats.erased = 2u;
+
+    ASSERT_EQ(entt::suggested_policy(stats), entt::deletion_policy::swap_and_pop);
+}
+
+TYPED_TEST(SparseSet, SkipTombstones) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+    using traits_type = entt::entt_traits<entity_type>;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+
+        ASSERT_EQ(set.skip_tombstones(set.begin()), set.end());
+
+        for(typename traits_type::entity_type next{}; next < 160u; ++next) {
+            set.push(traits_type::construct(next, {}));
+        }
+
+        ASSERT_EQ(set.skip_tombstones(set.begin()), set.begin());
+        ASSERT_EQ(set.skip_tombstones(set.end()), set.end());
+
+        if(policy == entt::deletion_policy::in_place) {
+            for(typename traits_type::entity_type next{1u}; next < 159u; ++next) {
+                set.erase(traits_type::construct(next, {}));
+            }
+
+            auto it = set.skip_tombstones(set.begin());
+
+            ASSERT_EQ(*it, traits_type::construct(159u, {}));
+            ASSERT_EQ(*(it = set.skip_tombstones(++it)), traits_type::construct(0u, {}));
+            ASSERT_EQ(set.skip_tombstones(++it), set.end());
+
+            set.push(traits_type::construct(64u, {}));
+            it = set.skip_tombstones(set.begin() + 1);
+
+            ASSERT_EQ(*it, traits_type::construct(64u, {}));
+            ASSERT_EQ(it.index(), 158);
+
+            set.compact();
+
+            ASSERT_EQ(set.skip_tombstones(set.begin() + 1), set.begin() + 1);
+            ASSERT_EQ(*set.skip_tombstones(set.end() - 1), traits_type::construct(0u, {}));
+
+            set.erase(traits_type::construct(0u, {}));
+            set.clear();
+            set.push(traits_type::construct(0u, {}));
+
+            ASSERT_EQ(set.skip_tombstones(set.begin()), set.begin());
+        }
+    }
+}
+
 TYPED_TEST(SparseSet, SwapElements) {
     using entity_type = typename TestFixture::type;
     using sparse_set_type = entt::basic_sparse_set<entity_type>;
@@ -1750,6 +2181,34 @@ TYPED_TEST(SparseSet, Clear) {
     }
 }
 
+TYPED_TEST(SparseSet, ClearDense) {
+    using entity_type = typename TestFixture::type;
+    using traits_type = entt::entt_traits<entity_type>;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+        std::vector<entity_type> entity(traits_type::page_size);
+
+        // dense enough for the whole sparse page to be reset at once
+        for(std::size_t pos{}; pos < entity.size(); ++pos) {
+            entity[pos] = traits_type::construct(static_cast<typename traits_type::entity_type>(pos), 0u);
+        }
+
+        set.push(entity.begin(), entity.end());
+        set.erase(entity[1u]);
+        set.clear();
+
+        ASSERT_EQ(set.size(), 0u);
+        ASSERT_TRUE(std::none_of(entity.begin(), entity.end(), [&set](auto entt) { return set.contains(entt); }));
+
+        set.push(entity[1u]);
+
+        ASSERT_EQ(set.index(entity[1u]), 0u);
+        ASSERT_FALSE(set.contains(entity[0u]));
+    }
+}
+
 TYPED_TEST(SparseSet, SortOrdered) {
     using entity_type = typename TestFixture::type;
     using sparse_set_type = entt::basic_sparse_set<entity_type>;
@@ -1807,6 +2266,36 @@ TYPED_TEST(SparseSet, SortUnordered) {
     }
 }
 
+TYPED_TEST(SparseSet, SortRadix) {
+    using entity_type = typename TestFixture::type;
+    using traits_type = entt::entt_traits<entity_type>;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+
+    const auto getter = [](const entity_type entity) { return traits_type::to_entity(entity); };
+    std::vector<entity_type> aux{};
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+
+        for(std::size_t pos{}; pos < entt::parallel_radix_sort<8, 16>::grain * 2u; ++pos) {
+            set.push(traits_type::construct(static_cast<typename traits_type::entity_type>((pos * 7919u) % 65521u), 0u));
+        }
+
+        set.sort(getter, entt::parallel_radix_sort<8, 16>{2u}, aux);
+
+        ASSERT_TRUE(std::is_sorted(set.begin(), set.end(), [](const auto lhs, const auto rhs) { return traits_type::to_entity(lhs) < traits_type::to_entity(rhs); }));
+        ASSERT_EQ(aux.size(), set.size());
+
+        for(auto it = set.begin(), last = set.end(); it != last; ++it) {
+            ASSERT_EQ(set.index(*it), static_cast<typename sparse_set_type::size_type>(it.index()));
+        }
+
+        set.sort(getter, entt::radix_sort<8, 16>{}, aux);
+
+        ASSERT_TRUE(std::is_sorted(set.begin(), set.end(), [](const auto lhs, const auto rhs) { return traits_type::to_entity(lhs) < traits_type::to_entity(rhs); }));
+    }
+}
+
 ENTT_DEBUG_TYPED_TEST(SparseSetDeathTest, Sort) {
     using entity_type = typename TestFixture::type;
     using sparse_set_type = entt::basic_sparse_set<entity_type>;
@@ -2239,3 +2728,22 @@ TYPED_TEST(SparseSet, ThrowingAllocator) {
         ASSERT_TRUE(set.contains(entity_type{traits_type::page_size}));
     }
 }
+
+TYPED_TEST(SparseSet, ThrowingAllocatorInPlaceErase) {
+    using entity_type = typename TestFixture::type;
+    using traits_type = entt::entt_traits<entity_type>;
+
+    entt::basic_sparse_set<entity_type, test::throwing_allocator<entity_type>> set{entt::deletion_policy::in_place};
+
+    for(typename traits_type::entity_type next{}; next < 160u; ++next) {
+        set.push(traits_type::construct(next, {}));
+    }
+
+    // tombstones are tracked without allocating, erasing a range never throws
+    set.get_allocator().template throw_counter<std::size_t>(0u);
+    set.get_allocator().template throw_counter<entity_type>(0u);
+
+    ASSERT_NO_THROW(set.erase(set.begin(), set.end()));
+    ASSERT_EQ(set.size(), 160u);
+    ASSERT_EQ(set.skip_tombstones(set.begin()), set.end());
+}
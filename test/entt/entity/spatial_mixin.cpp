@@ -0,0 +1,245 @@
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include "../../common/config.h"
+#include "../../common/linter.hpp"
+
+struct position {
+    float x;
+    float y;
+};
+
+struct stable_position {
+    static constexpr auto in_place_delete = true;
+    int x;
+    int y;
+};
+
+template<>
+struct entt::storage_type<position> {
+    using type = entt::sigh_mixin<entt::spatial_mixin<entt::storage<position>, &position::x, &position::y>>;
+};
+
+template<typename Type>
+std::vector<entt::entity> within(const Type &pool, const std::array<typename Type::coordinate_type, 2u> &lhs, const std::array<typename Type::coordinate_type, 2u> &rhs) {
+    std::vector<entt::entity> result{};
+    pool.within(lhs, rhs, [&result](const entt::entity entt) { result.push_back(entt); });
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+TEST(SpatialMixin, Functionalities) {
+    entt::spatial_mixin<entt::storage<position>, &position::x, &position::y> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}};
+
+    ASSERT_EQ(pool.cell_size(), 1.f);
+    ASSERT_TRUE(within(pool, {0.f, 0.f}, {8.f, 8.f}).empty());
+
+    pool.emplace(entity[0u], .5f, .5f);
+    pool.emplace(entity[1u], position{2.5f, 1.5f});
+    pool.emplace(entity[2u], -3.5f, -.5f);
+
+    ASSERT_EQ(within(pool, {0.f, 0.f}, {1.f, 1.f}), (std::vector{entity[0u]}));
+    ASSERT_EQ(within(pool, {0.f, 0.f}, {2.5f, 1.5f}), (std::vector{entity[0u], entity[1u]}));
+    ASSERT_EQ(within(pool, {-4.f, -1.f}, {0.f, 0.f}), (std::vector{entity[2u]}));
+    ASSERT_EQ(within(pool, {-8.f, -8.f}, {8.f, 8.f}), (std::vector{entity[0u], entity[1u], entity[2u]}));
+    ASSERT_TRUE(within(pool, {.6f, .6f}, {.9f, .9f}).empty());
+    ASSERT_TRUE(within(pool, {1.f, 1.f}, {0.f, 0.f}).empty());
+
+    pool.patch(entity[0u], [](auto &elem) { elem.x = 5.5f; });
+
+    ASSERT_TRUE(within(pool, {0.f, 0.f}, {1.f, 1.f}).empty());
+    ASSERT_EQ(within(pool, {5.f, 0.f}, {6.f, 1.f}), (std::vector{entity[0u]}));
+
+    pool.patch(entity[1u], [](auto &elem) { elem.y = 1.75f; });
+
+    ASSERT_EQ(within(pool, {2.f, 1.f}, {3.f, 2.f}), (std::vector{entity[1u]}));
+
+    pool.erase(entity[1u]);
+
+    ASSERT_TRUE(within(pool, {2.f, 1.f}, {3.f, 2.f}).empty());
+    ASSERT_EQ(within(pool, {-8.f, -8.f}, {8.f, 8.f}), (std::vector{entity[0u], entity[2u]}));
+
+    pool.cell_size(4.f);
+
+    ASSERT_EQ(pool.cell_size(), 4.f);
+    ASSERT_EQ(within(pool, {5.f, 0.f}, {6.f, 1.f}), (std::vector{entity[0u]}));
+    ASSERT_EQ(within(pool, {-4.f, -1.f}, {0.f, 0.f}), (std::vector{entity[2u]}));
+
+    pool.clear();
+
+    ASSERT_TRUE(within(pool, {-8.f, -8.f}, {8.f, 8.f}).empty());
+}
+
+TEST(SpatialMixin, Insert) {
+    entt::spatial_mixin<entt::storage<position>, &position::x, &position::y> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+    const std::array value{position{1.f, 1.f}, position{3.f, 3.f}};
+
+    pool.insert(entity.begin(), entity.end(), value.begin());
+
+    ASSERT_EQ(within(pool, {0.f, 0.f}, {2.f, 2.f}), (std::vector{entity[0u]}));
+    ASSERT_EQ(within(pool, {0.f, 0.f}, {4.f, 4.f}), (std::vector{entity[0u], entity[1u]}));
+
+    pool.remove(entity.begin(), entity.end());
+
+    ASSERT_TRUE(within(pool, {0.f, 0.f}, {4.f, 4.f}).empty());
+}
+
+TEST(SpatialMixin, InPlaceDelete) {
+    entt::spatial_mixin<entt::storage<stable_position>, &stable_position::x, &stable_position::y> pool;
+    entt::sparse_set &base = pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+    const stable_position value{4, 4};
+
+    pool.cell_size(2);
+    pool.emplace(entity[0u], 1, 1);
+    base.push(entity[1u], &value);
+
+    ASSERT_EQ(within(pool, {0, 0}, {4, 4}), (std::vector{entity[0u], entity[1u]}));
+
+    base.erase(entity[0u]);
+    pool.cell_size(4);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(within(pool, {0, 0}, {4, 4}), (std::vector{entity[1u]}));
+}
+
+TEST(SpatialMixin, Move) {
+    entt::spatial_mixin<entt::storage<position>, &position::x, &position::y> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+
+    static_assert(std::is_move_constructible_v<decltype(pool)>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<decltype(pool)>, "Move assignable type required");
+
+    pool.cell_size(2.f);
+    pool.emplace(entity[0u], 1.f, 1.f);
+
+    entt::spatial_mixin<entt::storage<position>, &position::x, &position::y> other{std::move(pool)};
+
+    test::is_initialized(pool);
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(other.cell_size(), 2.f);
+    ASSERT_EQ(within(other, {0.f, 0.f}, {1.f, 1.f}), (std::vector{entity[0u]}));
+
+    pool = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_EQ(within(pool, {0.f, 0.f}, {1.f, 1.f}), (std::vector{entity[0u]}));
+
+    other.emplace(entity[1u], 3.f, 3.f);
+    pool.swap(other);
+
+    ASSERT_EQ(within(pool, {0.f, 0.f}, {4.f, 4.f}), (std::vector{entity[1u]}));
+    ASSERT_EQ(within(other, {0.f, 0.f}, {4.f, 4.f}), (std::vector{entity[0u]}));
+}
+
+TEST(SpatialMixin, SortAlong) {
+    entt::spatial_mixin<entt::storage<position>, &position::x, &position::y> pool;
+    const auto cell = [&pool](const entt::entity entt) { return std::array{static_cast<int>(pool.get(entt).x), static_cast<int>(pool.get(entt).y)}; };
+
+    ASSERT_EQ(pool.pending(), 0u);
+
+    for(entt::id_type pos{}; pos < 16u; ++pos) {
+        const auto next = (pos * 7u) % 16u;
+        pool.emplace(entt::entity{pos}, static_cast<float>(next % 4u) + .5f, static_cast<float>(next / 4u) + .5f);
+    }
+
+    ASSERT_EQ(pool.pending(), 16u);
+    ASSERT_TRUE(pool.sort_along(entt::space_filling_curve::morton));
+    ASSERT_EQ(pool.pending(), 0u);
+
+    std::vector<std::array<int, 2u>> order{};
+
+    for(auto &&entt: static_cast<const entt::sparse_set &>(pool)) {
+        order.push_back(cell(entt));
+    }
+
+    ASSERT_EQ(order.size(), 16u);
+    ASSERT_EQ(order[0u], (std::array{0, 0}));
+    ASSERT_EQ(order[1u], (std::array{1, 0}));
+    ASSERT_EQ(order[2u], (std::array{0, 1}));
+    ASSERT_EQ(order[3u], (std::array{1, 1}));
+    ASSERT_EQ(order[4u], (std::array{2, 0}));
+    ASSERT_EQ(order[15u], (std::array{3, 3}));
+
+    pool.patch(pool.data()[0u], [](auto &elem) { elem.x += .25f; });
+
+    ASSERT_EQ(pool.pending(), 0u);
+
+    pool.patch(pool.data()[0u], [](auto &elem) { elem.x = -1.f; });
+
+    ASSERT_EQ(pool.pending(), 1u);
+    ASSERT_FALSE(pool.sort_along(entt::space_filling_curve::hilbert, 2u));
+
+    pool.patch(pool.data()[0u], [](auto &elem) { elem.x = 3.5f; });
+
+    ASSERT_EQ(pool.pending(), 2u);
+    ASSERT_TRUE(pool.sort_along(entt::space_filling_curve::hilbert, 2u));
+    ASSERT_EQ(pool.pending(), 0u);
+
+    const entt::sparse_set &base = pool;
+
+    for(auto it = base.begin(), last = base.end() - 1; it != last; ++it) {
+        const auto lhs = cell(*it);
+        const auto rhs = cell(*(it + 1));
+        // consecutive cells of a Hilbert curve are always adjacent
+        ASSERT_EQ(std::abs(lhs[0u] - rhs[0u]) + std::abs(lhs[1u] - rhs[1u]), 1);
+    }
+
+    pool.erase(pool.data()[3u]);
+
+    ASSERT_EQ(pool.pending(), 1u);
+}
+
+TEST(SpatialMixin, Registry) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+    const auto &storage = registry.storage<position>();
+
+    registry.emplace<position>(entity[0u], 1.f, 1.f);
+    registry.emplace_or_replace<position>(entity[1u], 2.f, 2.f);
+    registry.emplace<position>(entity[2u], 3.f, 3.f);
+    registry.emplace<int>(entity[1u]);
+
+    ASSERT_EQ(within(storage, {0.f, 0.f}, {2.f, 2.f}), (std::vector{entity[0u], entity[1u]}));
+
+    registry.replace<position>(entity[0u], 8.f, 8.f);
+    registry.emplace_or_replace<position>(entity[2u], 1.f, 1.f);
+
+    ASSERT_EQ(within(storage, {0.f, 0.f}, {2.f, 2.f}), (std::vector{entity[1u], entity[2u]}));
+
+    std::vector<entt::entity> result{};
+    const auto view = registry.view<position, int>();
+    storage.within({0.f, 0.f}, {2.f, 2.f}, [&](const entt::entity entt) {
+        if(view.contains(entt)) {
+            result.push_back(entt);
+        }
+    });
+
+    ASSERT_EQ(result, (std::vector{entity[1u]}));
+
+    registry.destroy(entity[2u]);
+
+    ASSERT_EQ(within(storage, {0.f, 0.f}, {2.f, 2.f}), (std::vector{entity[1u]}));
+
+    registry.clear();
+
+    ASSERT_TRUE(within(storage, {-8.f, -8.f}, {8.f, 8.f}).empty());
+}
+
+ENTT_DEBUG_TEST(SpatialMixinDeathTest, CellSize) {
+    entt::spatial_mixin<entt::storage<position>, &position::x, &position::y> pool;
+
+    ASSERT_DEATH(pool.cell_size(0.f), "");
+    ASSERT_DEATH(pool.cell_size(-1.f), "");
+}
@@ -0,0 +1,199 @@
+#include <array>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include "../../common/boxed_type.h"
+#include "../../common/linter.hpp"
+#include "../../common/pointer_stable.h"
+
+struct body {
+    float x;
+    float y;
+};
+
+struct description {
+    std::string name;
+    int level;
+};
+
+template<>
+struct entt::storage_type<body> {
+    using type = entt::sigh_mixin<entt::split_storage<body, description>>;
+};
+
+TEST(SplitMixin, Functionalities) {
+    entt::split_storage<test::boxed_int, description> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}};
+
+    testing::StaticAssertTypeEq<decltype(pool.cold(entity[0u])), description &>();
+    testing::StaticAssertTypeEq<decltype(std::as_const(pool).cold(entity[0u])), const description &>();
+
+    pool.emplace(entity[0u], 1);
+    pool.emplace(entity[1u], 2);
+    pool.emplace(entity[2u], 3);
+
+    ASSERT_EQ(pool.get(entity[1u]).value, 2);
+    ASSERT_TRUE(pool.cold(entity[1u]).name.empty());
+    ASSERT_EQ(pool.cold(entity[1u]).level, 0);
+
+    pool.cold(entity[0u]) = {"first", 1};
+    pool.cold(entity[2u]) = {"last", 3};
+
+    ASSERT_EQ(pool.cold_data()[pool.index(entity[2u])].name, "last");
+
+    pool.erase(entity[0u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.get(entity[2u]).value, 3);
+    ASSERT_EQ(pool.cold(entity[2u]).name, "last");
+    ASSERT_EQ(pool.cold(entity[2u]).level, 3);
+    ASSERT_TRUE(pool.cold(entity[1u]).name.empty());
+
+    pool.emplace(entity[0u], 4);
+
+    ASSERT_TRUE(pool.cold(entity[0u]).name.empty());
+
+    pool.clear();
+
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST(SplitMixin, Insert) {
+    entt::split_storage<test::boxed_int, description> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+    const std::array value{test::boxed_int{1}, test::boxed_int{2}};
+
+    pool.insert(entity.begin(), entity.end(), value.begin());
+    pool.cold(entity[0u]).level = 1;
+    pool.cold(entity[1u]).level = 2;
+
+    ASSERT_EQ(pool.get(entity[1u]).value, 2);
+    ASSERT_EQ(pool.cold(entity[1u]).level, 2);
+
+    pool.remove(entity.begin(), entity.begin() + 1u);
+    pool.insert(entity.begin(), entity.begin() + 1u);
+
+    ASSERT_EQ(pool.cold(entity[0u]).level, 0);
+    ASSERT_EQ(pool.cold(entity[1u]).level, 2);
+}
+
+TEST(SplitMixin, Sort) {
+    entt::split_storage<test::boxed_int, description> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}};
+
+    pool.emplace(entity[0u], 3);
+    pool.emplace(entity[1u], 2);
+    pool.emplace(entity[2u], 1);
+
+    for(auto &&[entt, elem]: pool.each()) {
+        pool.cold(entt).level = elem.value;
+    }
+
+    pool.sort([&pool](const auto lhs, const auto rhs) { return pool.get(lhs) < pool.get(rhs); });
+
+    for(auto &&[entt, elem]: pool.each()) {
+        ASSERT_EQ(pool.cold(entt).level, elem.value);
+    }
+}
+
+TEST(SplitMixin, InPlaceDelete) {
+    entt::split_storage<test::pointer_stable, description> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}};
+
+    pool.emplace(entity[0u], 1);
+    pool.emplace(entity[1u], 2);
+    pool.cold(entity[0u]).name = "first";
+    pool.cold(entity[1u]).name = "second";
+    pool.erase(entity[0u]);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_TRUE(pool.cold_data()[0u].name.empty());
+
+    pool.emplace(entity[2u], 3);
+
+    ASSERT_EQ(pool.index(entity[2u]), 0u);
+    ASSERT_TRUE(pool.cold(entity[2u]).name.empty());
+
+    pool.erase(entity[2u]);
+    pool.compact();
+
+    ASSERT_EQ(pool.size(), 1u);
+    ASSERT_EQ(pool.cold(entity[1u]).name, "second");
+
+    pool.shrink_to_fit();
+    pool.emplace(entity[0u], 4);
+
+    ASSERT_EQ(pool.cold(entity[1u]).name, "second");
+    ASSERT_TRUE(pool.cold(entity[0u]).name.empty());
+}
+
+TEST(SplitMixin, Move) {
+    entt::split_storage<test::boxed_int, description> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+
+    static_assert(std::is_move_constructible_v<decltype(pool)>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<decltype(pool)>, "Move assignable type required");
+
+    pool.emplace(entity[0u], 1);
+    pool.cold(entity[0u]).level = 1;
+
+    entt::split_storage<test::boxed_int, description> other{std::move(pool)};
+
+    test::is_initialized(pool);
+
+    ASSERT_TRUE(pool.empty());
+    ASSERT_EQ(other.cold(entity[0u]).level, 1);
+
+    pool = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_EQ(pool.cold(entity[0u]).level, 1);
+
+    other.emplace(entity[1u], 2);
+    other.cold(entity[1u]).level = 2;
+    pool.swap(other);
+
+    ASSERT_EQ(pool.cold(entity[1u]).level, 2);
+    ASSERT_EQ(other.cold(entity[0u]).level, 1);
+}
+
+TEST(SplitMixin, MemoryUsage) {
+    entt::split_storage<test::boxed_int, description> pool;
+    const auto bytes = pool.memory_usage().element_bytes;
+
+    pool.reserve(4u);
+
+    ASSERT_GE(pool.memory_usage().element_bytes, bytes + 4u * (sizeof(test::boxed_int) + sizeof(description)));
+}
+
+TEST(SplitMixin, Registry) {
+    entt::registry registry;
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+    auto &&storage = registry.storage<body>();
+
+    registry.emplace<body>(entity[0u], 1.f, 1.f);
+    registry.emplace<body>(entity[1u], 2.f, 2.f);
+    registry.emplace_or_replace<body>(entity[2u], 3.f, 3.f);
+
+    storage.cold(entity[0u]).name = "first";
+    storage.cold(entity[2u]).name = "last";
+
+    registry.destroy(entity[0u]);
+
+    ASSERT_EQ(storage.cold(entity[2u]).name, "last");
+    ASSERT_TRUE(storage.cold(entity[1u]).name.empty());
+
+    for(auto [entt, elem]: registry.view<body>().each()) {
+        ASSERT_EQ(storage.cold(entt).name.empty(), entt != entity[2u]);
+        ASSERT_EQ(elem.x, registry.get<body>(entt).x);
+    }
+
+    registry.clear();
+
+    ASSERT_TRUE(storage.empty());
+}
@@ -0,0 +1,175 @@
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/mixin.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/storage.hpp>
+#include <entt/entity/view.hpp>
+#include "../../common/boxed_type.h"
+#include "../../common/empty.h"
+#include "../../common/linter.hpp"
+
+struct position {
+    int x;
+};
+
+template<>
+struct entt::storage_type<position> {
+    using type = entt::sigh_mixin<entt::statistics_mixin<entt::storage<position>>>;
+};
+
+TEST(StatisticsMixin, Functionalities) {
+    entt::statistics_mixin<entt::storage<test::boxed_int>> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}, entt::entity{4}};
+
+    ASSERT_EQ(pool.statistics().emplaced, 0u);
+    ASSERT_EQ(pool.statistics().peak, 0u);
+
+    pool.emplace(entity[0u], 1);
+    pool.emplace(entity[1u], 2);
+    pool.emplace(entity[2u], 3);
+    pool.erase(entity[1u]);
+    pool.patch(entity[0u], [](auto &elem) { elem.value = 4; });
+
+    ASSERT_EQ(pool.get(entity[0u]).value, 4);
+    ASSERT_EQ(std::get<0>(std::as_const(pool).get_as_tuple(entity[2u])).value, 3);
+
+    auto stats = pool.statistics();
+
+    ASSERT_EQ(stats.emplaced, 3u);
+    ASSERT_EQ(stats.erased, 1u);
+    ASSERT_EQ(stats.patched, 1u);
+    ASSERT_EQ(stats.gets, 2u);
+    ASSERT_EQ(stats.iterations, 0u);
+    ASSERT_EQ(stats.peak, 3u);
+
+    for([[maybe_unused]] auto &&elem: pool) {}
+    for([[maybe_unused]] auto [entt, elem]: std::as_const(pool).each()) {}
+    for([[maybe_unused]] auto [entt, elem]: pool.reach()) {}
+
+    ASSERT_EQ(pool.statistics().iterations, 3u);
+
+    pool.clear();
+    stats = pool.statistics();
+
+    ASSERT_EQ(stats.erased, 3u);
+    ASSERT_EQ(stats.peak, 3u);
+
+    pool.reset_statistics();
+    stats = pool.statistics();
+
+    ASSERT_EQ(stats.emplaced, 0u);
+    ASSERT_EQ(stats.erased, 0u);
+    ASSERT_EQ(stats.patched, 0u);
+    ASSERT_EQ(stats.gets, 0u);
+    ASSERT_EQ(stats.iterations, 0u);
+    ASSERT_EQ(stats.peak, 0u);
+}
+
+TEST(StatisticsMixin, Insert) {
+    entt::statistics_mixin<entt::storage<test::boxed_int>> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+
+    pool.insert(entity.begin(), entity.end(), test::boxed_int{1});
+
+    ASSERT_EQ(pool.statistics().emplaced, 2u);
+    ASSERT_EQ(pool.statistics().peak, 2u);
+}
+
+TEST(StatisticsMixin, EmptyType) {
+    entt::statistics_mixin<entt::storage<test::empty>> pool;
+    const entt::entity entity{1};
+
+    pool.emplace(entity);
+    pool.erase(entity);
+
+    ASSERT_EQ(pool.statistics().emplaced, 1u);
+    ASSERT_EQ(pool.statistics().erased, 1u);
+}
+
+TEST(StatisticsMixin, Base) {
+    entt::statistics_mixin<entt::storage<test::boxed_int>> pool;
+    entt::sparse_set &base = pool;
+    const entt::entity entity{1};
+
+    base.push(entity);
+
+    ASSERT_EQ(base.statistics().emplaced, 1u);
+    ASSERT_EQ(base.statistics().peak, 1u);
+
+    base.erase(entity);
+
+    ASSERT_EQ(base.statistics().erased, 1u);
+    ASSERT_EQ(entt::storage<test::boxed_int>{}.statistics().emplaced, 0u);
+}
+
+TEST(StatisticsMixin, Move) {
+    entt::statistics_mixin<entt::storage<test::boxed_int>> pool;
+
+    pool.emplace(entt::entity{1}, 1);
+    pool.emplace(entt::entity{3}, 2);
+
+    entt::statistics_mixin<entt::storage<test::boxed_int>> other{std::move(pool)};
+
+    test::is_initialized(pool);
+
+    ASSERT_EQ(pool.statistics().emplaced, 0u);
+    ASSERT_EQ(other.statistics().emplaced, 2u);
+    ASSERT_EQ(other.statistics().peak, 2u);
+
+    pool = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_EQ(pool.statistics().emplaced, 2u);
+    ASSERT_EQ(other.statistics().emplaced, 0u);
+}
+
+TEST(StatisticsMixin, Registry) {
+    entt::registry registry;
+    const auto entity = registry.create();
+
+    registry.emplace<position>(entity, 1);
+    registry.emplace_or_replace<position>(entity, 2);
+    registry.patch<position>(entity, [](auto &elem) { ++elem.x; });
+
+    ASSERT_EQ(registry.get<position>(entity).x, 3);
+
+    registry.view<position>().each([](position &elem) { ++elem.x; });
+    ASSERT_EQ(registry.view<position>().get<position>(entity).x, 4);
+
+    registry.destroy(entity);
+
+    std::size_t found{};
+
+    for(auto [id, pool]: registry.storage()) {
+        if(const auto stats = pool.statistics(); pool.type() == entt::type_id<position>()) {
+            ASSERT_EQ(stats.emplaced, 1u);
+            ASSERT_EQ(stats.erased, 1u);
+            ASSERT_EQ(stats.patched, 2u);
+            ASSERT_GE(stats.gets, 2u);
+            ASSERT_EQ(stats.peak, 1u);
+            ++found;
+        } else {
+            ASSERT_EQ(stats.emplaced, 0u);
+        }
+    }
+
+    ASSERT_EQ(found, 1u);
+}
+
+#ifdef ENTT_USE_STATISTICS
+TEST(StatisticsMixin, DefaultStorage) {
+    entt::registry registry;
+    const auto entity = registry.create();
+
+    registry.emplace<int>(entity, 1);
+    registry.emplace<char>(entity, 'c');
+    registry.erase<char>(entity);
+
+    ASSERT_EQ(registry.storage<int>().statistics().emplaced, 1u);
+    ASSERT_EQ(registry.storage<char>().statistics().emplaced, 1u);
+    ASSERT_EQ(registry.storage<char>().statistics().erased, 1u);
+}
+#endif
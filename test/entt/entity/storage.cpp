@@ -1,11 +1,13 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <tuple>
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/iterator.hpp>
 #include <entt/core/type_info.hpp>
@@ -61,6 +63,47 @@ struct create_from_constructor {
     entt::entity child;
 };
 
+struct non_paginated {
+    static constexpr auto page_size = entt::no_pagination;
+    int value{};
+};
+
+struct non_paginated_stable {
+    static constexpr auto in_place_delete = true;
+    static constexpr auto page_size = entt::no_pagination;
+    int value{};
+};
+
+struct pinned {
+    explicit pinned(const int elem)
+        : value{elem} {}
+
+    pinned(const pinned &) = delete;
+    pinned(pinned &&) = delete;
+
+    pinned &operator=(const pinned &) = delete;
+    pinned &operator=(pinned &&) = delete;
+
+    int value;
+};
+
+struct small_sparse_page {
+    static constexpr auto sparse_page_size = 16u;
+    int value{};
+};
+
+struct aligned_page {
+    static constexpr auto page_size = 4u;
+    static constexpr auto page_alignment = 64u;
+    int value{};
+};
+
+struct aligned_non_paginated {
+    static constexpr auto page_size = entt::no_pagination;
+    static constexpr auto page_alignment = 32u;
+    int value{};
+};
+
 template<>
 struct entt::component_traits<std::unordered_set<char>> {
     static constexpr auto in_place_delete = true;
@@ -196,6 +239,83 @@ TYPED_TEST(Storage, Swap) {
     ASSERT_EQ(other.get(entt::entity{4}), value_type{1});
 }
 
+TYPED_TEST(Storage, DeepCopyFrom) {
+    using value_type = typename TestFixture::type;
+    using traits_type = entt::component_traits<value_type>;
+
+    entt::storage<value_type> pool;
+    entt::storage<value_type> other;
+
+    for(std::size_t pos{}; pos < traits_type::page_size + 2u; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), static_cast<int>(pos));
+    }
+
+    pool.erase(entt::entity{1});
+    other.emplace(entt::entity{traits_type::page_size * 3u}, 0);
+    other.deep_copy_from(pool);
+
+    ASSERT_EQ(other.size(), pool.size());
+    ASSERT_FALSE(other.contains(entt::entity{1}));
+    ASSERT_FALSE(other.contains(entt::entity{traits_type::page_size * 3u}));
+    ASSERT_TRUE(std::equal(pool.data(), pool.data() + pool.size(), other.data()));
+
+    for(std::size_t pos{2u}; pos < traits_type::page_size + 2u; ++pos) {
+        const auto entt = static_cast<entt::entity>(pos);
+        ASSERT_EQ(other.index(entt), pool.index(entt));
+        ASSERT_EQ(other.get(entt), pool.get(entt));
+    }
+
+    pool.patch(entt::entity{0}, [](auto &elem) { elem = value_type{64}; });
+
+    ASSERT_EQ(other.get(entt::entity{0}), value_type{0});
+
+    other.emplace(entt::entity{1}, 1);
+
+    ASSERT_EQ(other.index(entt::entity{1}), traits_type::in_place_delete ? 1u : (other.size() - 1u));
+}
+
+TEST(Storage, DeepCopyFromNonTrivial) {
+    entt::storage<std::unordered_set<char>> pool;
+    entt::storage<std::unordered_set<char>> other;
+
+    pool.emplace(entt::entity{1}, std::unordered_set<char>{'a'});
+    pool.emplace(entt::entity{3}, std::unordered_set<char>{'b', 'c'});
+    pool.emplace(entt::entity{5});
+    pool.erase(entt::entity{3});
+
+    other.emplace(entt::entity{2}, std::unordered_set<char>{'d'});
+    other.deep_copy_from(pool);
+
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_FALSE(other.contains(entt::entity{2}));
+    ASSERT_FALSE(other.contains(entt::entity{3}));
+    ASSERT_EQ(other.index(entt::entity{5}), 2u);
+    ASSERT_EQ(other.get(entt::entity{1}), std::unordered_set<char>{'a'});
+
+    pool.get(entt::entity{1}).insert('e');
+
+    ASSERT_EQ(other.get(entt::entity{1}).size(), 1u);
+}
+
+ENTT_DEBUG_TEST(StorageDeathTest, DeepCopyFrom) {
+    entt::storage<update_from_destructor> pool;
+    entt::storage<update_from_destructor> other;
+
+    ASSERT_DEATH(other.deep_copy_from(pool), "");
+}
+
+ENTT_DEBUG_TYPED_TEST(StorageDeathTest, Policy) {
+    using value_type = typename TestFixture::type;
+
+    entt::storage<value_type> pool;
+    entt::sparse_set &base = pool;
+    const auto policy = pool.policy();
+
+    ASSERT_NO_THROW(base.policy(policy));
+    ASSERT_DEATH(base.policy((policy == entt::deletion_policy::in_place) ? entt::deletion_policy::swap_and_pop : entt::deletion_policy::in_place), "");
+    ASSERT_EQ(pool.policy(), policy);
+}
+
 TYPED_TEST(Storage, Capacity) {
     using value_type = typename TestFixture::type;
     using traits_type = entt::component_traits<value_type>;
@@ -213,6 +333,36 @@ TYPED_TEST(Storage, Capacity) {
     ASSERT_TRUE(pool.empty());
 }
 
+TYPED_TEST(Storage, MemoryUsage) {
+    using value_type = typename TestFixture::type;
+    using traits_type = entt::component_traits<value_type>;
+
+    entt::storage<value_type> pool;
+
+    ASSERT_EQ(pool.memory_usage().bytes(), 0u);
+
+    pool.emplace(entt::entity{1});
+    pool.emplace(entt::entity{traits_type::page_size});
+
+    auto report = pool.memory_usage();
+
+    ASSERT_EQ(report.sparse_pages, 1u);
+    ASSERT_EQ(report.element_pages, 1u);
+
+    pool.reserve(traits_type::page_size + 1u);
+    report = pool.memory_usage();
+
+    ASSERT_EQ(report.element_pages, 2u);
+    ASSERT_GE(report.element_bytes, 2u * traits_type::page_size * sizeof(value_type));
+    ASSERT_EQ(report.bytes(), report.sparse_bytes + report.packed_bytes + report.element_bytes);
+
+    pool.erase(entt::entity{1});
+    report = pool.memory_usage();
+
+    ASSERT_EQ(report.tombstones, static_cast<std::size_t>(traits_type::in_place_delete));
+    ASSERT_EQ(report.free_list, 0u);
+}
+
 TYPED_TEST(Storage, ShrinkToFit) {
     using value_type = typename TestFixture::type;
     using traits_type = entt::component_traits<value_type>;
@@ -582,6 +732,28 @@ TYPED_TEST(Storage, Getters) {
     ASSERT_EQ(std::as_const(pool).get_as_tuple(entity), std::make_tuple(value_type{3}));
 }
 
+TYPED_TEST(Storage, PositionalGetters) {
+    using value_type = typename TestFixture::type;
+
+    entt::storage<value_type> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+
+    pool.emplace(entity[0u], 3);
+    pool.emplace(entity[1u], 1);
+
+    testing::StaticAssertTypeEq<decltype(pool.at({})), value_type &>();
+    testing::StaticAssertTypeEq<decltype(std::as_const(pool).at({})), const value_type &>();
+
+    testing::StaticAssertTypeEq<decltype(pool.at_as_tuple({})), std::tuple<value_type &>>();
+    testing::StaticAssertTypeEq<decltype(std::as_const(pool).at_as_tuple({})), std::tuple<const value_type &>>();
+
+    ASSERT_EQ(&pool.at(pool.index(entity[0u])), &pool.get(entity[0u]));
+    ASSERT_EQ(&std::as_const(pool).at(pool.index(entity[1u])), &pool.get(entity[1u]));
+
+    ASSERT_EQ(pool.at_as_tuple(1u), std::make_tuple(value_type{1}));
+    ASSERT_EQ(std::as_const(pool).at_as_tuple(0u), std::make_tuple(value_type{3}));
+}
+
 ENTT_DEBUG_TYPED_TEST(StorageDeathTest, Getters) {
     using value_type = typename TestFixture::type;
 
@@ -595,6 +767,18 @@ ENTT_DEBUG_TYPED_TEST(StorageDeathTest, Getters) {
     ASSERT_DEATH([[maybe_unused]] const auto value = std::as_const(pool).get_as_tuple(entity), "");
 }
 
+ENTT_DEBUG_TYPED_TEST(StorageDeathTest, PositionalGetters) {
+    using value_type = typename TestFixture::type;
+
+    entt::storage<value_type> pool;
+
+    ASSERT_DEATH([[maybe_unused]] const auto &value = pool.at(0u), "");
+    ASSERT_DEATH([[maybe_unused]] const auto &value = std::as_const(pool).at(0u), "");
+
+    ASSERT_DEATH([[maybe_unused]] const auto value = pool.at_as_tuple(0u), "");
+    ASSERT_DEATH([[maybe_unused]] const auto value = std::as_const(pool).at_as_tuple(0u), "");
+}
+
 TYPED_TEST(Storage, Value) {
     using value_type = typename TestFixture::type;
 
@@ -876,6 +1060,29 @@ TYPED_TEST(Storage, Insert) {
     ASSERT_EQ(*it.operator->(), value_type{3});
 }
 
+TYPED_TEST(Storage, InsertGenerator) {
+    using value_type = typename TestFixture::type;
+
+    entt::storage<value_type> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+    typename entt::storage<value_type>::iterator it{};
+    int invoked{};
+
+    it = pool.insert(entity.begin(), entity.end(), [&invoked](const entt::entity entt) {
+        ++invoked;
+        return value_type{static_cast<int>(entt::to_integral(entt))};
+    });
+
+    ASSERT_EQ(it, pool.cbegin());
+    ASSERT_EQ(invoked, 2);
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.get(entity[0u]), value_type{1});
+    ASSERT_EQ(pool.get(entity[1u]), value_type{3});
+    ASSERT_EQ(pool.index(entity[0u]), 0u);
+    ASSERT_EQ(pool.index(entity[1u]), 1u);
+}
+
 TYPED_TEST(Storage, Erase) {
     using value_type = typename TestFixture::type;
     using traits_type = entt::component_traits<value_type>;
@@ -1064,6 +1271,33 @@ TYPED_TEST(Storage, Compact) {
     ASSERT_TRUE(pool.empty());
 }
 
+TYPED_TEST(Storage, CompactIncremental) {
+    using value_type = typename TestFixture::type;
+    using traits_type = entt::component_traits<value_type>;
+
+    entt::storage<value_type> pool;
+
+    for(int next{}; next < 4; ++next) {
+        pool.emplace(entt::entity(next), value_type{next});
+    }
+
+    pool.erase(entt::entity{0});
+    pool.erase(entt::entity{1});
+    pool.compact(1u);
+
+    ASSERT_EQ(pool.size(), 2u + traits_type::in_place_delete);
+    ASSERT_EQ(pool.get(entt::entity{2}), value_type{2});
+    ASSERT_EQ(pool.get(entt::entity{3}), value_type{3});
+
+    pool.compaction(.1f, 1u);
+    pool.emplace(entt::entity{4}, value_type{4});
+    pool.erase(entt::entity{2});
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.get(entt::entity{3}), value_type{3});
+    ASSERT_EQ(pool.get(entt::entity{4}), value_type{4});
+}
+
 TYPED_TEST(Storage, SwapElements) {
     using value_type = typename TestFixture::type;
     using traits_type = entt::component_traits<value_type>;
@@ -1337,6 +1571,44 @@ TYPED_TEST(Storage, ReverseIterableAlgorithmCompatibility) {
     ASSERT_EQ(std::get<0>(*it), entt::entity{3});
 }
 
+TYPED_TEST(Storage, EachChunk) {
+    using value_type = typename TestFixture::type;
+    using traits_type = entt::component_traits<value_type>;
+
+    entt::storage<value_type> pool;
+    std::vector<std::size_t> length{};
+
+    pool.each_chunk([](auto &&...) { FAIL(); });
+
+    for(unsigned int next{}; next < traits_type::page_size + 2u; ++next) {
+        pool.emplace(entt::entity{next}, static_cast<int>(next));
+    }
+
+    pool.each_chunk([&pool, &length](const entt::entity *entity, const std::size_t count, value_type *elem) {
+        ASSERT_EQ(elem, pool.raw()[length.size()]);
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            ASSERT_EQ(&pool.get(entity[pos]), elem + pos);
+        }
+
+        length.push_back(count);
+    });
+
+    ASSERT_EQ(length.size(), 2u);
+    ASSERT_EQ(length[0u], traits_type::page_size);
+    ASSERT_EQ(length[1u], 2u);
+
+    std::as_const(pool).each_chunk([&length](const entt::entity *entity, const std::size_t count, const value_type *elem) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            ASSERT_EQ(elem[pos], value_type{static_cast<int>(entt::to_integral(entity[pos]))});
+        }
+
+        length.push_back(count);
+    });
+
+    ASSERT_EQ(length.size(), 4u);
+}
+
 TYPED_TEST(Storage, SortOrdered) {
     using value_type = typename TestFixture::type;
 
@@ -1633,6 +1905,199 @@ ENTT_DEBUG_TEST(StorageDeathTest, NonMovableComponent) {
     ASSERT_DEATH(pool.sort([](auto &&lhs, auto &&rhs) { return lhs < rhs; }), "");
 }
 
+TEST(Storage, InsertGeneratorInPlace) {
+    entt::storage<pinned> pool;
+    const std::array entity{entt::entity{1}, entt::entity{3}};
+
+    pool.insert(entity.begin(), entity.end(), [](const entt::entity entt) { return pinned{static_cast<int>(entt::to_integral(entt)) * 2}; });
+
+    ASSERT_EQ(pool.size(), 2u);
+    ASSERT_EQ(pool.get(entity[0u]).value, 2);
+    ASSERT_EQ(pool.get(entity[1u]).value, 6);
+}
+
+TEST(Storage, NoPagination) {
+    entt::storage<non_paginated> pool;
+
+    ASSERT_EQ(pool.capacity(), 0u);
+    ASSERT_EQ(pool.raw(), nullptr);
+
+    pool.reserve(4u);
+
+    ASSERT_EQ(pool.capacity(), 4u);
+    ASSERT_TRUE(pool.empty());
+
+    for(std::size_t pos{}; pos < 4096u; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), static_cast<int>(pos));
+    }
+
+    ASSERT_GE(pool.capacity(), 4096u);
+    ASSERT_EQ(pool.size(), 4096u);
+
+    for(std::size_t pos{}; pos < 4096u; ++pos) {
+        const auto entity = static_cast<entt::entity>(pos);
+
+        ASSERT_EQ(&pool.get(entity), pool.raw()[0u] + pool.index(entity));
+        ASSERT_EQ(pool.get(entity).value, static_cast<int>(pos));
+    }
+
+    for(auto [entity, elem]: pool.each()) {
+        ASSERT_EQ(elem.value, static_cast<int>(entt::to_integral(entity)));
+    }
+
+    pool.erase(entt::entity{0});
+    pool.erase(entt::entity{1024});
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.capacity(), 4094u);
+    ASSERT_EQ(pool.get(entt::entity{4095}).value, 4095);
+    ASSERT_EQ(pool.get(entt::entity{1}).value, 1);
+
+    entt::storage<non_paginated> other{std::move(pool)};
+
+    test::is_initialized(pool);
+
+    ASSERT_EQ(pool.capacity(), 0u);
+    ASSERT_EQ(other.capacity(), 4094u);
+    ASSERT_EQ(other.get(entt::entity{2048}).value, 2048);
+
+    pool.swap(other);
+
+    ASSERT_EQ(pool.capacity(), 4094u);
+    ASSERT_EQ(other.capacity(), 0u);
+
+    pool.clear();
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.capacity(), 0u);
+    ASSERT_EQ(pool.raw(), nullptr);
+}
+
+TEST(Storage, NoPaginationInPlaceDelete) {
+    entt::storage<non_paginated_stable> pool;
+
+    for(std::size_t pos{}; pos < 8u; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), static_cast<int>(pos));
+    }
+
+    pool.erase(entt::entity{2});
+    pool.erase(entt::entity{5});
+
+    ASSERT_EQ(pool.size(), 8u);
+    ASSERT_EQ(pool.capacity(), 8u);
+
+    const std::array other{entt::entity{8}};
+    // forces a reallocation while there are tombstones in the packed array
+    pool.insert(other.begin(), other.end(), non_paginated_stable{8});
+
+    ASSERT_GT(pool.capacity(), 8u);
+    ASSERT_FALSE(pool.contains(entt::entity{2}));
+    ASSERT_FALSE(pool.contains(entt::entity{5}));
+
+    for(auto [entity, elem]: pool.each()) {
+        if(entity != entt::tombstone) {
+            ASSERT_EQ(elem.value, static_cast<int>(entt::to_integral(entity)));
+        }
+    }
+
+    pool.compact();
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.size(), 7u);
+    ASSERT_EQ(pool.capacity(), 7u);
+
+    for(auto [entity, elem]: pool.each()) {
+        ASSERT_EQ(&elem, pool.raw()[0u] + pool.index(entity));
+        ASSERT_EQ(elem.value, static_cast<int>(entt::to_integral(entity)));
+    }
+}
+
+TEST(Storage, SparsePageSize) {
+    entt::storage<small_sparse_page> pool;
+    entt::storage<int> other;
+    const entt::entity entity{16u * 4u};
+
+    pool.emplace(entity, 1);
+    other.emplace(entity, 1);
+
+    ASSERT_EQ(pool.extent(), 16u * 5u);
+    ASSERT_EQ(other.extent(), ENTT_SPARSE_PAGE);
+    ASSERT_TRUE(pool.contains(entity));
+    ASSERT_FALSE(pool.contains(entt::entity{16u * 4u + 1u}));
+    ASSERT_EQ(pool.get(entity).value, 1);
+
+    pool.erase(entity);
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.extent(), 0u);
+}
+
+TEST(Storage, PageAlignment) {
+    entt::storage<aligned_page> pool;
+    entt::storage<aligned_non_paginated> other;
+
+    for(std::size_t pos{}; pos < 10u; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), static_cast<int>(pos));
+        other.emplace(static_cast<entt::entity>(pos), static_cast<int>(pos));
+    }
+
+    ASSERT_EQ(pool.capacity(), 12u);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(pool.raw()[0u]) % 64u, 0u);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(pool.raw()[1u]) % 64u, 0u);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(pool.raw()[2u]) % 64u, 0u);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(other.raw()[0u]) % 32u, 0u);
+
+    for(std::size_t pos{}; pos < 10u; ++pos) {
+        ASSERT_EQ(pool.get(static_cast<entt::entity>(pos)).value, static_cast<int>(pos));
+        ASSERT_EQ(other.get(static_cast<entt::entity>(pos)).value, static_cast<int>(pos));
+    }
+
+    pool.erase(entt::entity{9});
+    pool.shrink_to_fit();
+    other.shrink_to_fit();
+
+    ASSERT_EQ(pool.capacity(), 12u);
+    ASSERT_EQ(other.capacity(), 10u);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(other.raw()[0u]) % 32u, 0u);
+
+    pool.clear();
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.capacity(), 0u);
+}
+
+TEST(Storage, ReserveExecutor) {
+    entt::storage<aligned_page> pool;
+    entt::storage<non_paginated> other;
+    std::vector<std::size_t> jobs{};
+
+    const auto exec = [&jobs](const std::size_t count, auto job) {
+        jobs.push_back(count);
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            job(pos);
+        }
+    };
+
+    pool.reserve(10u, exec);
+
+    ASSERT_EQ(pool.capacity(), 12u);
+    ASSERT_EQ(jobs, (std::vector<std::size_t>{3u}));
+
+    pool.reserve(12u, exec);
+    pool.emplace(entt::entity{1}, 1);
+    pool.reserve(13u, exec);
+
+    ASSERT_EQ(pool.capacity(), 16u);
+    ASSERT_EQ(jobs, (std::vector<std::size_t>{3u, 1u}));
+    ASSERT_EQ(pool.get(entt::entity{1}).value, 1);
+
+    other.reserve(10u, exec);
+
+    ASSERT_EQ(other.capacity(), 10u);
+    ASSERT_EQ(jobs.size(), 2u);
+}
+
 TYPED_TEST(Storage, CanModifyDuringIteration) {
     using value_type = typename TestFixture::type;
     using traits_type = entt::component_traits<value_type>;
@@ -3,9 +3,11 @@
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/iterator.hpp>
 #include <entt/core/type_info.hpp>
@@ -107,6 +109,27 @@ TEST(StorageEntity, Swap) {
     ASSERT_EQ(other.index(entt::entity{4}), 0u);
 }
 
+TEST(StorageEntity, DeepCopyFrom) {
+    entt::storage<entt::entity> pool;
+    entt::storage<entt::entity> other;
+
+    pool.generate();
+    pool.generate();
+    pool.generate();
+    pool.erase(entt::entity{1});
+
+    other.generate(entt::entity{8});
+    other.deep_copy_from(pool);
+
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_EQ(other.free_list(), 2u);
+    ASSERT_TRUE(std::equal(pool.data(), pool.data() + pool.size(), other.data()));
+    ASSERT_FALSE(other.contains(entt::entity{8}));
+
+    ASSERT_EQ(other.generate(), pool.generate());
+    ASSERT_EQ(other.generate(), pool.generate());
+}
+
 TEST(StorageEntity, Getters) {
     entt::storage<entt::entity> pool;
     const entt::entity entity{4};
@@ -201,6 +224,38 @@ TEST(StorageEntity, GenerateRange) {
     ASSERT_EQ(pool.free_list(), 1u);
 }
 
+TEST(StorageEntity, GenerateLargeRange) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::storage<entt::entity> pool;
+    std::vector<entt::entity> entity(ENTT_SPARSE_PAGE + 2u);
+
+    pool.generate(entity.begin(), entity.begin() + 3u);
+    pool.generate(entt::entity{5});
+    pool.erase(entity.begin(), entity.begin() + 2u);
+
+    ASSERT_EQ(pool.free_list(), 2u);
+
+    pool.generate(entity.begin(), entity.end());
+
+    ASSERT_EQ(pool.size(), entity.size() + 2u);
+    ASSERT_EQ(pool.free_list(), pool.size());
+    ASSERT_EQ(entity[0u], traits_type::construct(1u, 1u));
+    ASSERT_EQ(entity[1u], traits_type::construct(0u, 1u));
+    ASSERT_EQ(entity[2u], entt::entity{3});
+    ASSERT_EQ(entity[3u], entt::entity{4});
+    ASSERT_EQ(entity[4u], entt::entity{6});
+    ASSERT_EQ(entity.back(), entt::entity{ENTT_SPARSE_PAGE + 3u});
+
+    for(std::size_t pos{}; pos < entity.size(); ++pos) {
+        ASSERT_TRUE(pool.contains(entity[pos]));
+        ASSERT_EQ(pool.index(entity[pos]), pos + 2u);
+    }
+
+    ASSERT_TRUE(pool.contains(entt::entity{2}));
+    ASSERT_TRUE(pool.contains(entt::entity{5}));
+}
+
 TEST(StorageEntity, GenerateFrom) {
     entt::storage<entt::entity> pool;
     std::array entity{entt::entity{0}, entt::entity{1}, entt::entity{2}};
@@ -232,6 +287,83 @@ TEST(StorageEntity, GenerateInUse) {
     ASSERT_EQ(entity[1u], entt::entity{2});
 }
 
+TEST(StorageEntity, Recycling) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::storage<entt::entity> pool;
+    std::array<entt::entity, 6u> entity{};
+
+    pool.generate(entity.begin(), entity.end());
+
+    ASSERT_EQ(pool.recycling(), entt::recycling_policy::last_in_first_out);
+
+    pool.erase(entity[1u]);
+    pool.erase(entity[4u]);
+    pool.erase(entity[2u]);
+
+    ASSERT_EQ(traits_type::to_entity(pool.generate()), 2u);
+
+    pool.recycling(entt::recycling_policy::lowest_index_first);
+
+    ASSERT_EQ(pool.recycling(), entt::recycling_policy::lowest_index_first);
+    ASSERT_EQ(pool.generate(), traits_type::construct(1u, 1u));
+
+    pool.erase(entity[0u]);
+
+    ASSERT_EQ(traits_type::to_entity(pool.generate()), 0u);
+    ASSERT_EQ(traits_type::to_entity(pool.generate()), 4u);
+    ASSERT_EQ(traits_type::to_entity(pool.generate()), 6u);
+
+    pool.erase(entity[5u]);
+    pool.erase(entity[3u]);
+
+    pool.generate(entity.begin(), entity.begin() + 2u);
+
+    ASSERT_EQ(traits_type::to_entity(entity[0u]), 3u);
+    ASSERT_EQ(traits_type::to_entity(entity[1u]), 5u);
+}
+
+TEST(StorageEntity, Defragment) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::storage<entt::entity> pool;
+    std::array<entt::entity, 6u> entity{};
+    std::vector<std::pair<entt::entity, entt::entity>> remap{};
+
+    pool.generate(entity.begin(), entity.end());
+    pool.generate(traits_type::construct(10000u, 0u));
+    pool.erase(entity[0u]);
+    pool.erase(entity[2u]);
+    pool.erase(entity[3u]);
+
+    pool.defragment([&remap](const entt::entity from, const entt::entity to) { remap.emplace_back(from, to); });
+
+    ASSERT_EQ(pool.size(), 4u);
+    ASSERT_EQ(pool.free_list(), 4u);
+    ASSERT_EQ(remap.size(), 3u);
+
+    for(auto [from, to]: remap) {
+        ASSERT_FALSE(pool.contains(from));
+        ASSERT_TRUE(pool.contains(to));
+        ASSERT_LT(traits_type::to_entity(to), 4u);
+        // versions of recycled indices are preserved
+        ASSERT_EQ(traits_type::to_version(to), 1u);
+    }
+
+    ASSERT_TRUE(pool.contains(entity[1u]));
+
+    pool.shrink_to_fit();
+
+    ASSERT_EQ(pool.memory_usage().sparse_pages, 1u);
+    ASSERT_EQ(pool.generate(), entt::entity{4});
+
+    remap.clear();
+    pool.defragment([&remap](const entt::entity from, const entt::entity to) { remap.emplace_back(from, to); });
+
+    ASSERT_TRUE(remap.empty());
+    ASSERT_EQ(pool.size(), 5u);
+}
+
 TEST(StorageEntity, TryGenerate) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -294,6 +426,141 @@ TEST(StorageEntity, TryGenerateInUse) {
     ASSERT_EQ(*(++it), entt::entity{0});
 }
 
+TEST(StorageEntity, ReserveEntity) {
+    using traits_type = entt::entt_traits<entt::entity>;
+
+    entt::storage<entt::entity> pool;
+    const entt::entity other{2};
+
+    pool.generate(entt::entity{0});
+    pool.generate(entt::entity{1});
+    pool.generate(other);
+    pool.erase(entt::entity{1});
+
+    ASSERT_EQ(pool.reserve_entity(), traits_type::construct(1, 1));
+    ASSERT_EQ(pool.reserve_entity(), entt::entity{3});
+    ASSERT_EQ(pool.reserve_entity(), entt::entity{4});
+
+    ASSERT_EQ(pool.free_list(), 2u);
+    ASSERT_FALSE(pool.contains(entt::entity{3}));
+
+    pool.materialize();
+
+    ASSERT_EQ(pool.free_list(), 5u);
+    ASSERT_LT(pool.index(traits_type::construct(1, 1)), pool.free_list());
+    ASSERT_LT(pool.index(entt::entity{3}), pool.free_list());
+    ASSERT_LT(pool.index(entt::entity{4}), pool.free_list());
+    ASSERT_EQ(pool.generate(), entt::entity{5});
+
+    pool.materialize();
+
+    ASSERT_EQ(pool.free_list(), 6u);
+}
+
+TEST(StorageEntity, ReserveEntityThreads) {
+    entt::storage<entt::entity> pool;
+    std::array<std::vector<entt::entity>, 4u> reserved{};
+    std::array<std::thread, 4u> worker{};
+
+    for(std::size_t pos{}; pos < 8u; ++pos) {
+        pool.generate();
+    }
+
+    for(std::size_t pos{}; pos < 4u; ++pos) {
+        pool.erase(static_cast<entt::entity>(pos));
+    }
+
+    for(std::size_t pos{}; pos < worker.size(); ++pos) {
+        worker[pos] = std::thread{[&pool, &elem = reserved[pos]]() {
+            for(int count{}; count < 16; ++count) {
+                elem.push_back(pool.reserve_entity());
+            }
+        }};
+    }
+
+    for(auto &&elem: worker) {
+        elem.join();
+    }
+
+    pool.materialize();
+
+    ASSERT_EQ(pool.free_list(), 68u);
+
+    for(auto &&elem: reserved) {
+        for(auto entt: elem) {
+            ASSERT_LT(pool.index(entt), pool.free_list());
+        }
+    }
+}
+
+TEST(StorageEntity, Block) {
+    entt::storage<entt::entity> pool;
+
+    pool.generate(entt::entity{3});
+
+    auto block = pool.acquire_block(8u);
+
+    // the identifier assigned on request ends the block
+    ASSERT_EQ(block.size(), 3u);
+    ASSERT_EQ(block.create(), entt::entity{0});
+    ASSERT_EQ(block.create(), entt::entity{1});
+    ASSERT_FALSE(pool.contains(entt::entity{0}));
+
+    auto other = pool.acquire_block(2u);
+
+    ASSERT_EQ(other.size(), 2u);
+
+    pool.release_block(block);
+
+    ASSERT_TRUE(block.empty());
+    ASSERT_EQ(pool.free_list(), 3u);
+    ASSERT_EQ(pool.size(), 4u);
+    ASSERT_LT(pool.index(entt::entity{0}), pool.free_list());
+    ASSERT_LT(pool.index(entt::entity{1}), pool.free_list());
+    ASSERT_EQ(pool.generate(), entt::entity{2});
+
+    pool.release_block(other);
+
+    ASSERT_EQ(pool.generate(), entt::entity{4});
+    ASSERT_EQ(pool.acquire_block(0u).size(), 0u);
+}
+
+TEST(StorageEntity, BlockThreads) {
+    entt::storage<entt::entity> pool;
+    std::array<entt::entity_block, 4u> block{};
+    std::array<std::vector<entt::entity>, 4u> created{};
+    std::array<std::thread, 4u> worker{};
+
+    for(auto &&elem: block) {
+        elem = pool.acquire_block(16u);
+    }
+
+    for(std::size_t pos{}; pos < worker.size(); ++pos) {
+        worker[pos] = std::thread{[&elem = block[pos], &entt = created[pos]]() {
+            for(int count{}; count < 8; ++count) {
+                entt.push_back(elem.create());
+            }
+        }};
+    }
+
+    for(auto &&elem: worker) {
+        elem.join();
+    }
+
+    for(auto &&elem: block) {
+        pool.release_block(elem);
+    }
+
+    ASSERT_EQ(pool.free_list(), 32u);
+    ASSERT_EQ(pool.size(), 56u);
+
+    for(auto &&elem: created) {
+        for(auto entt: elem) {
+            ASSERT_LT(pool.index(entt), pool.free_list());
+        }
+    }
+}
+
 TEST(StorageEntity, Patch) {
     entt::storage<entt::entity> pool;
     const auto entity = pool.generate();
@@ -369,6 +636,15 @@ ENTT_DEBUG_TEST(StorageEntityDeathTest, FreeList) {
     ASSERT_DEATH(pool.free_list(2u), "");
 }
 
+ENTT_DEBUG_TEST(StorageEntityDeathTest, Policy) {
+    entt::storage<entt::entity> pool;
+    entt::sparse_set &base = pool;
+
+    ASSERT_NO_THROW(base.policy(entt::deletion_policy::swap_only));
+    ASSERT_DEATH(base.policy(entt::deletion_policy::swap_and_pop), "");
+    ASSERT_EQ(pool.policy(), entt::deletion_policy::swap_only);
+}
+
 TEST(StorageEntity, Iterable) {
     using iterator = typename entt::storage<entt::entity>::iterable::iterator;
 
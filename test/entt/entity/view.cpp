@@ -1,8 +1,14 @@
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
+#include <thread>
 #include <tuple>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/type_info.hpp>
 #include <entt/entity/entity.hpp>
@@ -212,6 +218,180 @@ TEST(SingleStorageView, Each) {
     }
 }
 
+TEST(SingleStorageView, EachIf) {
+    entt::storage<int> storage{};
+    const entt::basic_view view{storage};
+    const std::array entity{entt::entity{0}, entt::entity{1}, entt::entity{2}};
+
+    storage.emplace(entity[0u], 0);
+    storage.emplace(entity[1u], 3);
+    storage.emplace(entity[2u], 1);
+
+    std::size_t count{};
+
+    view.each_if([](const int value) { return value > 1; }, [&](const auto entt, int &value) {
+        ASSERT_EQ(entt, entity[1u]);
+        ASSERT_EQ(value, 3);
+        ++count;
+    });
+
+    view.each_if([](const int value) { return value < 2; }, [&count](int &) { ++count; });
+
+    ASSERT_EQ(count, 3u);
+}
+
+TEST(SingleStorageView, EachRange) {
+    entt::storage<test::pointer_stable> storage{};
+    const entt::basic_view view{storage};
+    std::vector<int> visited{};
+
+    const entt::basic_view<entt::get_t<entt::storage<int>>, entt::exclude_t<>> invalid{};
+
+    ASSERT_EQ(invalid.each_range(0u, 2u, [](int &) { FAIL(); }), 0u);
+    ASSERT_EQ(view.each_range(0u, 2u, [](test::pointer_stable &) { FAIL(); }), 0u);
+
+    for(int pos{}; pos < 5; ++pos) {
+        storage.emplace(static_cast<entt::entity>(pos), pos);
+    }
+
+    storage.erase(entt::entity{3});
+
+    std::size_t cursor{};
+
+    do {
+        cursor = view.each_range(cursor, 2u, [&visited](const auto entt, test::pointer_stable &elem) {
+            ASSERT_NE(entt, static_cast<entt::entity>(entt::tombstone));
+            visited.push_back(elem.value);
+        });
+    } while(cursor != storage.size());
+
+    ASSERT_EQ(visited, (std::vector<int>{4, 2, 1, 0}));
+    ASSERT_EQ(view.each_range(7u, 2u, [](test::pointer_stable &) { FAIL(); }), storage.size());
+}
+
+TEST(SingleStorageView, EachChunked) {
+    entt::storage<int> storage{};
+    const entt::basic_view view{storage};
+    const entt::basic_view cview{std::as_const(storage)};
+    std::vector<std::size_t> chunks{};
+    std::vector<int> visited{};
+
+    const auto executor = [&chunks](const std::size_t count, auto job) {
+        chunks.push_back(count);
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            job(pos);
+        }
+    };
+
+    view.each_chunked(executor, 2u, [](int &) { FAIL(); });
+
+    ASSERT_EQ(chunks.size(), 1u);
+    ASSERT_EQ(chunks[0u], 0u);
+
+    for(int pos{}; pos < 5; ++pos) {
+        storage.emplace(static_cast<entt::entity>(pos), pos);
+    }
+
+    view.each_chunked(executor, 2u, [&visited](const auto entt, int &value) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), value);
+        visited.push_back(value);
+    });
+
+    ASSERT_EQ(chunks.size(), 2u);
+    ASSERT_EQ(chunks[1u], 3u);
+    ASSERT_EQ(visited.size(), 5u);
+
+    cview.each_chunked(executor, 5u, [&visited](const int &value) {
+        ASSERT_EQ(visited[static_cast<std::size_t>(4 - value)], value);
+    });
+
+    ASSERT_EQ(chunks.size(), 3u);
+    ASSERT_EQ(chunks[2u], 1u);
+}
+
+TEST(SingleStorageView, EachChunkedStableType) {
+    entt::storage<test::pointer_stable> storage{};
+    const entt::basic_view view{storage};
+    std::size_t count{};
+
+    storage.emplace(entt::entity{0}, 0);
+    storage.emplace(entt::entity{1}, 1);
+    storage.emplace(entt::entity{2}, 2);
+    storage.erase(entt::entity{1});
+
+    const auto executor = [](const std::size_t len, auto job) {
+        for(std::size_t pos{}; pos < len; ++pos) {
+            job(pos);
+        }
+    };
+
+    view.each_chunked(executor, 1u, [&count](const auto entt, test::pointer_stable &elem) {
+        ASSERT_NE(entt, static_cast<entt::entity>(entt::tombstone));
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), elem.value);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 2u);
+}
+
+TEST(SingleStorageView, Reduce) {
+    entt::storage<int> storage{};
+    const entt::basic_view view{storage};
+
+    const auto executor = [](const std::size_t count, auto job) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            job(pos);
+        }
+    };
+
+    ASSERT_EQ(view.reduce(executor, 2u, 0, [](int &, int &) { FAIL(); }, std::plus<>{}), 0);
+    ASSERT_EQ(view.transform_reduce(executor, 2u, 3, [](const int value) { return value; }, std::plus<>{}), 3);
+
+    for(int pos{}; pos < 5; ++pos) {
+        storage.emplace(static_cast<entt::entity>(pos), pos);
+    }
+
+    const auto count = view.reduce(executor, 2u, std::size_t{}, [](std::size_t &acc, const auto entt, const int value) { acc += static_cast<std::size_t>(entt::to_integral(entt) == static_cast<std::uint32_t>(value)); }, std::plus<>{});
+    const auto sum = view.transform_reduce(executor, 2u, 10, [](const int value) { return value; }, std::plus<>{});
+    const auto last = view.transform_reduce(executor, 1u, -1, [](const auto entt, const int) { return static_cast<int>(entt::to_integral(entt)); }, [](const int lhs, const int rhs) { return (std::max)(lhs, rhs); });
+
+    ASSERT_EQ(count, 5u);
+    ASSERT_EQ(sum, 20);
+    ASSERT_EQ(last, 4);
+}
+
+TEST(SingleStorageView, EachChunk) {
+    entt::storage<int> storage{};
+    const entt::basic_view view{storage};
+    const entt::basic_view cview{std::as_const(storage)};
+    std::size_t count{};
+
+    view.each_chunk([](auto &&...) { FAIL(); });
+
+    storage.emplace(entt::entity{1}, 1);
+    storage.emplace(entt::entity{3}, 3);
+
+    view.each_chunk([&count](const entt::entity *entt, const std::size_t len, int *value) {
+        ASSERT_EQ(len, 2u);
+        ASSERT_EQ(entt[0u], entt::entity{1});
+        ASSERT_EQ(value[1u], 3);
+        value[0u] = 2;
+        ++count;
+    });
+
+    cview.each_chunk([&count](const entt::entity *, const std::size_t, const int *value) {
+        ASSERT_EQ(value[0u], 2);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(storage.get(entt::entity{1}), 2);
+
+    entt::basic_view<entt::get_t<entt::storage<int>>, entt::exclude_t<>> invalid{};
+    invalid.each_chunk([](auto &&...) { FAIL(); });
+}
+
 TEST(SingleStorageView, ConstNonConstAndAllInBetween) {
     entt::storage<int> storage{};
     const entt::basic_view view{storage};
@@ -427,6 +607,39 @@ TEST(SingleStorageView, StableType) {
     ASSERT_EQ(view->size(), 0u);
 }
 
+
+TEST(SingleStorageView, StableTypeRunsOfTombstones) {
+    entt::storage<test::pointer_stable> storage{};
+    entt::storage<int> other{};
+    const entt::basic_view view{storage};
+    const entt::basic_view filtered{std::forward_as_tuple(storage), std::forward_as_tuple(other)};
+
+    for(std::uint32_t next{}; next < 200u; ++next) {
+        storage.emplace(entt::entity{next}, static_cast<int>(next));
+    }
+
+    for(std::uint32_t next{1u}; next < 199u; ++next) {
+        if(next != 100u) {
+            storage.erase(entt::entity{next});
+        }
+    }
+
+    other.emplace(entt::entity{100u});
+
+    ASSERT_EQ(view.size_hint(), 200u);
+    ASSERT_EQ(std::distance(view.begin(), view.end()), 3);
+    ASSERT_EQ(std::distance(filtered.begin(), filtered.end()), 2);
+
+    auto it = view.begin();
+
+    ASSERT_EQ(*it++, entt::entity{199u});
+    ASSERT_EQ(*it++, entt::entity{100u});
+    ASSERT_EQ(*it++, entt::entity{0u});
+    ASSERT_EQ(it, view.end());
+
+    ASSERT_EQ(*filtered.begin(), entt::entity{199u});
+    ASSERT_EQ(*++filtered.begin(), entt::entity{0u});
+}
 TEST(SingleStorageView, Storage) {
     std::tuple<entt::storage<int>, entt::storage<char>> storage{};
     entt::basic_view view{std::get<0>(storage)};
@@ -870,6 +1083,43 @@ TEST(MultiStorageView, UseAndRefresh) {
     ASSERT_EQ(view.handle()->info(), entt::type_id<int>());
 }
 
+TEST(MultiStorageView, RefreshWithGain) {
+    std::tuple<entt::storage<int>, entt::storage<char>> storage{};
+    entt::basic_view view{std::get<0>(storage), std::get<1>(storage)};
+
+    for(std::size_t pos{}; pos < 10u; ++pos) {
+        std::get<0>(storage).emplace(entt::entity{static_cast<entt::id_type>(pos)});
+        std::get<1>(storage).emplace(entt::entity{static_cast<entt::id_type>(pos)});
+    }
+
+    std::get<1>(storage).emplace(entt::entity{10u});
+    view.use<int>();
+
+    ASSERT_FALSE(view.refresh(.5f));
+    ASSERT_EQ(view.handle()->info(), entt::type_id<int>());
+
+    std::get<1>(storage).erase(entt::entity{10u});
+    std::get<1>(storage).erase(entt::entity{9u});
+
+    ASSERT_FALSE(view.refresh(.5f));
+    ASSERT_EQ(view.handle()->info(), entt::type_id<int>());
+
+    ASSERT_TRUE(view.refresh(0.f));
+    ASSERT_EQ(view.handle()->info(), entt::type_id<char>());
+
+    for(std::size_t pos{}; pos < 6u; ++pos) {
+        std::get<0>(storage).erase(entt::entity{static_cast<entt::id_type>(pos)});
+    }
+
+    ASSERT_TRUE(view.refresh(.5f));
+    ASSERT_EQ(view.handle()->info(), entt::type_id<int>());
+
+    view = {};
+
+    ASSERT_FALSE(view.refresh(.5f));
+    ASSERT_EQ(view.handle(), nullptr);
+}
+
 TEST(MultiStorageView, Each) {
     std::tuple<entt::storage<int>, entt::storage<char>, entt::storage<double>> storage{};
     const entt::basic_view view{std::forward_as_tuple(std::get<0>(storage), std::get<1>(storage)), std::forward_as_tuple(std::get<2>(storage))};
@@ -921,6 +1171,156 @@ TEST(MultiStorageView, Each) {
     }
 }
 
+TEST(MultiStorageView, EachIf) {
+    std::tuple<entt::storage<int>, entt::storage<char>> storage{};
+    const entt::basic_view view{std::get<0>(storage), std::get<1>(storage)};
+    const std::array entity{entt::entity{0}, entt::entity{1}, entt::entity{2}};
+
+    std::get<0>(storage).insert(entity.begin(), entity.end(), 0);
+    std::get<0>(storage).get(entity[1u]) = 3;
+    std::get<0>(storage).get(entity[2u]) = 1;
+    std::get<1>(storage).insert(entity.begin(), entity.end() - 1u, 'c');
+
+    std::size_t count{};
+
+    view.each_if<int>([](const int value) { return value != 0; }, [&](const auto entt, int &value, char &elem) {
+        ASSERT_EQ(entt, entity[1u]);
+        ASSERT_EQ(value, 3);
+        ASSERT_EQ(elem, 'c');
+        ++count;
+    });
+
+    view.each_if<1u>([](const char value) { return value == 'c'; }, [&count](int &, char &) { ++count; });
+
+    ASSERT_EQ(count, 3u);
+}
+
+TEST(MultiStorageView, EachRange) {
+    std::tuple<entt::storage<int>, entt::storage<char>> storage{};
+    const entt::basic_view view{std::get<0>(storage), std::get<1>(storage)};
+    std::vector<int> visited{};
+
+    ASSERT_EQ(view.each_range(0u, 2u, [](int &, char &) { FAIL(); }), 0u);
+
+    for(int pos{}; pos < 6; ++pos) {
+        const auto entity = static_cast<entt::entity>(pos);
+
+        std::get<0>(storage).emplace(entity, pos);
+
+        if(pos % 2 == 0) {
+            std::get<1>(storage).emplace(entity, static_cast<char>(pos));
+        }
+    }
+
+    ASSERT_EQ(view.each_range(0u, 2u, [&visited](const auto entt, int &ivalue, char &cvalue) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), ivalue);
+        ASSERT_EQ(static_cast<char>(ivalue), cvalue);
+        visited.push_back(ivalue);
+    }),
+              2u);
+
+    // offsets refer to the leading storage, entities that aren't part of the view count too
+    ASSERT_EQ(view.each_range(2u, 4u, [&visited](const int &ivalue, const char &) { visited.push_back(ivalue); }), view.size_hint());
+    ASSERT_EQ(view.each_range(6u, 2u, [](const int &, const char &) { FAIL(); }), view.size_hint());
+    ASSERT_EQ(visited, (std::vector<int>{4, 2, 0}));
+}
+
+TEST(MultiStorageView, EachChunked) {
+    std::tuple<entt::storage<int>, entt::storage<char>, entt::storage<double>> storage{};
+    const entt::basic_view view{std::forward_as_tuple(std::get<0>(storage), std::get<1>(storage)), std::forward_as_tuple(std::get<2>(storage))};
+    std::array<std::atomic<int>, 8u> visited{};
+
+    for(int pos{}; pos < static_cast<int>(visited.size()); ++pos) {
+        const auto entity = static_cast<entt::entity>(pos);
+
+        std::get<0>(storage).emplace(entity, pos);
+
+        if(pos % 2 == 0) {
+            std::get<1>(storage).emplace(entity, static_cast<char>(pos));
+        }
+
+        if(pos % 4 == 0) {
+            std::get<2>(storage).emplace(entity);
+        }
+    }
+
+    const auto executor = [](const std::size_t count, auto job) {
+        std::vector<std::thread> workers{};
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            workers.emplace_back(job, pos);
+        }
+
+        for(auto &&elem: workers) {
+            elem.join();
+        }
+    };
+
+    view.each_chunked(executor, 1u, [&visited](const auto entt, int &ivalue, char &cvalue) {
+        ASSERT_EQ(static_cast<int>(entt::to_integral(entt)), ivalue);
+        ASSERT_EQ(static_cast<char>(ivalue), cvalue);
+        ++visited[static_cast<std::size_t>(ivalue)];
+    });
+
+    view.each_chunked(executor, 3u, [&visited](const int &ivalue, const char &) {
+        ++visited[static_cast<std::size_t>(ivalue)];
+    });
+
+    for(std::size_t pos{}; pos < visited.size(); ++pos) {
+        ASSERT_EQ(visited[pos], (pos % 4u == 2u) ? 2 : 0);
+    }
+
+    view.each_chunked([hint = view.size_hint()](const std::size_t count, auto) { ASSERT_EQ(count, (hint + 1u) / 2u); }, 2u, [](const int &, const char &) { FAIL(); });
+}
+
+TEST(MultiStorageView, Reduce) {
+    std::tuple<entt::storage<int>, entt::storage<char>, entt::storage<double>> storage{};
+    const entt::basic_view view{std::forward_as_tuple(std::get<0>(storage), std::get<1>(storage)), std::forward_as_tuple(std::get<2>(storage))};
+
+    for(int pos{}; pos < 64; ++pos) {
+        const auto entity = static_cast<entt::entity>(pos);
+
+        std::get<0>(storage).emplace(entity, pos);
+
+        if(pos % 2 == 0) {
+            std::get<1>(storage).emplace(entity, static_cast<char>(pos % 3));
+        }
+
+        if(pos % 4 == 0) {
+            std::get<2>(storage).emplace(entity);
+        }
+    }
+
+    const auto executor = [](const std::size_t count, auto job) {
+        std::vector<std::thread> workers{};
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            workers.emplace_back(job, pos);
+        }
+
+        for(auto &&elem: workers) {
+            elem.join();
+        }
+    };
+
+    // entities with even indexes that aren't multiples of four, grouped by the value of the char
+    const auto counts = view.reduce(
+        executor, 5u, std::array<int, 3u>{}, [](auto &acc, const int, const char value) { ++acc[static_cast<std::size_t>(value)]; }, [](auto lhs, const auto &rhs) {
+            for(std::size_t pos{}; pos < lhs.size(); ++pos) {
+                lhs[pos] += rhs[pos];
+            }
+
+            return lhs;
+        });
+
+    ASSERT_EQ(counts[0u] + counts[1u] + counts[2u], 16);
+    ASSERT_EQ(counts[0u], 5);
+
+    const auto sum = view.transform_reduce(executor, 3u, 0, [](const auto entt, const int value, const char) { return static_cast<int>(entt::to_integral(entt)) + value; }, std::plus<>{});
+
+    ASSERT_EQ(sum, 2 * (2 + 6 + 10 + 14 + 18 + 22 + 26 + 30 + 34 + 38 + 42 + 46 + 50 + 54 + 58 + 62));
+}
+
 TEST(MultiStorageView, EachWithSuggestedType) {
     std::tuple<entt::storage<int>, entt::storage<char>> storage{};
     entt::basic_view view{std::get<0>(storage), std::get<1>(storage)};
@@ -998,6 +1398,51 @@ TEST(MultiStorageView, EachWithHoles) {
     }
 }
 
+TEST(MultiStorageView, EachSparseIntersection) {
+    std::tuple<entt::storage<int>, entt::storage<char>, entt::storage<double>> storage{};
+    entt::basic_view view{std::forward_as_tuple(std::get<0>(storage), std::get<1>(storage)), std::forward_as_tuple(std::get<2>(storage))};
+
+    for(std::size_t pos{}; pos < 100u; ++pos) {
+        const auto entity = static_cast<entt::entity>(pos);
+
+        std::get<0>(storage).emplace(entity, static_cast<int>(pos));
+
+        if(pos % 3u == 0u) {
+            std::get<1>(storage).emplace(entity, static_cast<char>(pos));
+        }
+
+        if(pos % 5u == 0u) {
+            std::get<2>(storage).emplace(entity, static_cast<double>(pos));
+        }
+    }
+
+    view.use<int>();
+
+    auto it = view.begin();
+    std::size_t count{};
+
+    view.each([&](const auto entt, const int &ivalue, const char &cvalue) {
+        ASSERT_EQ(entt, *it++);
+        ASSERT_EQ(ivalue, static_cast<int>(entt::to_integral(entt)));
+        ASSERT_EQ(cvalue, static_cast<char>(entt::to_integral(entt)));
+        ++count;
+    });
+
+    ASSERT_EQ(it, view.end());
+    ASSERT_EQ(count, 27u);
+
+    view.use<char>();
+    count = 0u;
+
+    view.each([&count](const auto entt, const int &, const char &) {
+        ASSERT_EQ(entt::to_integral(entt) % 3u, 0u);
+        ASSERT_NE(entt::to_integral(entt) % 5u, 0u);
+        ++count;
+    });
+
+    ASSERT_EQ(count, 27u);
+}
+
 TEST(MultiStorageView, ConstNonConstAndAllInBetween) {
     std::tuple<entt::storage<int>, entt::storage<test::empty>, entt::storage<char>> storage{};
     const entt::basic_view view{std::get<0>(storage), std::get<1>(storage), std::as_const(std::get<2>(storage))};
@@ -0,0 +1,191 @@
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/graph/adjacency_list.hpp>
+#include "../../common/config.h"
+#include "../../common/linter.hpp"
+#include "../../common/throwing_allocator.hpp"
+
+using edge_type = std::pair<std::size_t, std::size_t>;
+
+TEST(AdjacencyList, Constructors) {
+    const std::array edge{edge_type{0u, 1u}, edge_type{1u, 2u}, edge_type{0u, 1u}};
+    entt::adjacency_list<entt::directed_tag> adjacency_list{};
+
+    ASSERT_EQ(adjacency_list.size(), 0u);
+    ASSERT_TRUE(adjacency_list.empty());
+
+    adjacency_list = entt::adjacency_list<entt::directed_tag>{std::allocator<bool>{}};
+    adjacency_list = entt::adjacency_list<entt::directed_tag>{3u, std::allocator<bool>{}};
+
+    ASSERT_TRUE(adjacency_list.empty());
+    ASSERT_EQ(adjacency_list.size(), 3u);
+
+    adjacency_list = entt::adjacency_list<entt::directed_tag>{3u, edge.begin(), edge.end()};
+
+    ASSERT_FALSE(adjacency_list.empty());
+
+    const entt::adjacency_list<entt::directed_tag> temp{adjacency_list, adjacency_list.get_allocator()};
+    const entt::adjacency_list<entt::directed_tag> other{std::move(adjacency_list), adjacency_list.get_allocator()};
+
+    test::is_initialized(adjacency_list);
+
+    ASSERT_TRUE(adjacency_list.empty());
+
+    ASSERT_EQ(temp.size(), 3u);
+    ASSERT_TRUE(temp.contains(1u, 2u));
+
+    ASSERT_FALSE(other.empty());
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_TRUE(other.contains(0u, 1u));
+    ASSERT_TRUE(other.contains(1u, 2u));
+    ASSERT_FALSE(other.contains(1u, 0u));
+    ASSERT_FALSE(other.contains(3u, 0u));
+}
+
+TEST(AdjacencyList, Copy) {
+    const std::array edge{edge_type{0u, 1u}};
+    entt::adjacency_list<entt::directed_tag> adjacency_list{3u, edge.begin(), edge.end()};
+    entt::adjacency_list<entt::directed_tag> other{adjacency_list};
+
+    ASSERT_TRUE(adjacency_list.contains(0u, 1u));
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_TRUE(other.contains(0u, 1u));
+
+    other = entt::adjacency_list<entt::directed_tag>{4u};
+    other = adjacency_list;
+
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_TRUE(other.contains(0u, 1u));
+}
+
+TEST(AdjacencyList, Move) {
+    const std::array edge{edge_type{0u, 1u}};
+    entt::adjacency_list<entt::directed_tag> adjacency_list{3u, edge.begin(), edge.end()};
+    entt::adjacency_list<entt::directed_tag> other{std::move(adjacency_list)};
+
+    test::is_initialized(adjacency_list);
+
+    ASSERT_TRUE(adjacency_list.empty());
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_TRUE(other.contains(0u, 1u));
+
+    adjacency_list = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(adjacency_list.size(), 3u);
+    ASSERT_TRUE(adjacency_list.contains(0u, 1u));
+}
+
+TEST(AdjacencyList, Swap) {
+    const std::array edge{edge_type{0u, 1u}};
+    entt::adjacency_list<entt::directed_tag> adjacency_list{3u, edge.begin(), edge.end()};
+    entt::adjacency_list<entt::directed_tag> other{};
+
+    adjacency_list.swap(other);
+
+    ASSERT_TRUE(adjacency_list.empty());
+    ASSERT_FALSE(other.empty());
+
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_EQ(adjacency_list.size(), 0u);
+    ASSERT_FALSE(adjacency_list.contains(0u, 1u));
+    ASSERT_TRUE(other.contains(0u, 1u));
+}
+
+TEST(AdjacencyList, Clear) {
+    const std::array edge{edge_type{0u, 1u}};
+    entt::adjacency_list<entt::directed_tag> adjacency_list{3u, edge.begin(), edge.end()};
+
+    adjacency_list.clear();
+
+    ASSERT_TRUE(adjacency_list.empty());
+    ASSERT_EQ(adjacency_list.size(), 0u);
+    ASSERT_FALSE(adjacency_list.contains(0u, 1u));
+    ASSERT_EQ(adjacency_list.edges().begin(), adjacency_list.edges().end());
+}
+
+TEST(AdjacencyList, Vertices) {
+    const entt::adjacency_list<entt::directed_tag> adjacency_list{2u};
+    auto iterable = adjacency_list.vertices();
+    auto it = iterable.begin();
+
+    ASSERT_EQ(*it++, 0u);
+    ASSERT_EQ(*it++, 1u);
+    ASSERT_EQ(it, iterable.end());
+}
+
+TEST(AdjacencyList, EdgesDirected) {
+    const std::array edge{edge_type{2u, 0u}, edge_type{0u, 1u}, edge_type{2u, 3u}};
+    const entt::adjacency_list<entt::directed_tag> adjacency_list{4u, edge.begin(), edge.end()};
+    auto iterable = adjacency_list.edges();
+    auto it = iterable.begin();
+
+    ASSERT_NE(it, iterable.end());
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{0u}, std::size_t{1u}));
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{2u}, std::size_t{0u}));
+    ASSERT_EQ(it->first, 2u);
+    ASSERT_EQ(it->second, 3u);
+    ASSERT_EQ(++it, iterable.end());
+}
+
+TEST(AdjacencyList, EdgesUndirected) {
+    const std::array edge{edge_type{0u, 1u}, edge_type{1u, 0u}, edge_type{1u, 2u}};
+    const entt::adjacency_list<entt::undirected_tag> adjacency_list{3u, edge.begin(), edge.end()};
+    auto iterable = adjacency_list.edges();
+    auto it = iterable.begin();
+
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{0u}, std::size_t{1u}));
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{1u}, std::size_t{0u}));
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{1u}, std::size_t{2u}));
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{2u}, std::size_t{1u}));
+    ASSERT_EQ(it, iterable.end());
+}
+
+TEST(AdjacencyList, OutEdges) {
+    const std::array edge{edge_type{0u, 2u}, edge_type{0u, 1u}, edge_type{1u, 2u}};
+    const entt::adjacency_list<entt::directed_tag> adjacency_list{3u, edge.begin(), edge.end()};
+    auto iterable = adjacency_list.out_edges(0u);
+    auto it = iterable.begin();
+
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{0u}, std::size_t{1u}));
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{0u}, std::size_t{2u}));
+    ASSERT_EQ(it, iterable.end());
+
+    iterable = adjacency_list.out_edges(2u);
+
+    ASSERT_EQ(iterable.cbegin(), iterable.cend());
+}
+
+TEST(AdjacencyList, InEdges) {
+    const std::array edge{edge_type{1u, 2u}, edge_type{0u, 2u}, edge_type{0u, 1u}};
+    const entt::adjacency_list<entt::directed_tag> adjacency_list{3u, edge.begin(), edge.end()};
+    auto iterable = adjacency_list.in_edges(2u);
+    auto it = iterable.begin();
+
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{0u}, std::size_t{2u}));
+    ASSERT_EQ(*it++, std::make_pair(std::size_t{1u}, std::size_t{2u}));
+    ASSERT_EQ(it, iterable.end());
+
+    iterable = adjacency_list.in_edges(0u);
+
+    ASSERT_EQ(iterable.cbegin(), iterable.cend());
+}
+
+TEST(AdjacencyList, ThrowingAllocator) {
+    const std::array edge{edge_type{0u, 1u}};
+    entt::adjacency_list<entt::directed_tag, test::throwing_allocator<std::size_t>> adjacency_list{2u};
+
+    adjacency_list.get_allocator().throw_counter<std::size_t>(0u);
+
+    ASSERT_THROW((entt::adjacency_list<entt::directed_tag, test::throwing_allocator<std::size_t>>{2u, edge.begin(), edge.end(), adjacency_list.get_allocator()}), test::throwing_allocator_exception);
+}
+
+ENTT_DEBUG_TEST(AdjacencyListDeathTest, InvalidVertex) {
+    const std::array edge{edge_type{0u, 3u}};
+
+    ASSERT_DEATH((entt::adjacency_list<entt::directed_tag>{2u, edge.begin(), edge.end()}), "");
+}
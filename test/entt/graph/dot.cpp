@@ -61,3 +61,33 @@ TEST(Dot, CustomWriter) {
     ASSERT_FALSE(str.empty());
     ASSERT_EQ(str, expected);
 }
+
+TEST(Dot, CostWriter) {
+    std::ostringstream output{};
+    entt::adjacency_matrix<entt::directed_tag> adjacency_matrix{4u};
+    const int cost[4u]{1, 2, 5, 3};
+
+    adjacency_matrix.insert(0u, 1u);
+    adjacency_matrix.insert(0u, 2u);
+    adjacency_matrix.insert(1u, 3u);
+    adjacency_matrix.insert(2u, 3u);
+
+    entt::dot(output, adjacency_matrix, [&cost](std::size_t vertex) { return cost[vertex]; }, [](auto &&...) {});
+
+    std::string expected = R"(digraph{label="critical path 9 of 11";)";
+    expected += R"(0[xlabel="1",color="red",penwidth=2];1[xlabel="2"];2[xlabel="5",color="red",penwidth=2];3[xlabel="3",color="red",penwidth=2];)";
+    expected += R"(0->1;0->2[color="red",penwidth=2];1->3;2->3[color="red",penwidth=2];})";
+
+    ASSERT_EQ(output.str(), expected);
+
+    output.str("");
+    entt::dot(output, adjacency_matrix, [](std::size_t) { return 1.f; }, [](std::ostream &out, std::size_t vertex) {
+        out << "label=\"v" << vertex << "\"";
+    });
+
+    expected = R"(digraph{label="critical path 3 of 4";)";
+    expected += R"(0[xlabel="1",color="red",penwidth=2,label="v0"];1[xlabel="1",color="red",penwidth=2,label="v1"];2[xlabel="1",label="v2"];3[xlabel="1",color="red",penwidth=2,label="v3"];)";
+    expected += R"(0->1[color="red",penwidth=2];0->2;1->3[color="red",penwidth=2];2->3;})";
+
+    ASSERT_EQ(output.str(), expected);
+}
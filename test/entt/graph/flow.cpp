@@ -241,6 +241,34 @@ TEST(Flow, Graph) {
     ASSERT_EQ(it, last);
 }
 
+TEST(Flow, SparseGraph) {
+    entt::flow flow{};
+
+    for(entt::id_type pos{}; pos < 96u; ++pos) {
+        flow.bind(pos).ro(pos % 7u).rw(pos % 5u);
+
+        if(pos % 32u == 0u) {
+            flow.sync();
+        }
+    }
+
+    const auto graph = flow.graph();
+    const auto sparse = flow.sparse_graph();
+
+    ASSERT_EQ(sparse.size(), graph.size());
+
+    auto it = sparse.edges().begin();
+
+    for(auto &&elem: graph.edges()) {
+        ASSERT_NE(it, sparse.edges().end());
+        ASSERT_EQ(*it++, elem);
+    }
+
+    ASSERT_EQ(it, sparse.edges().end());
+    ASSERT_EQ(flow.priority(sparse), flow.priority(graph));
+    ASSERT_EQ(flow.critical_path(sparse), flow.critical_path(graph));
+}
+
 TEST(Flow, Sync) {
     using namespace entt::literals;
 
@@ -289,6 +317,9 @@ ENTT_DEBUG_TEST(FlowDeathTest, NoBind) {
 
     ASSERT_DEATH(flow.ro(4), "");
     ASSERT_DEATH(flow.rw(4), "");
+    ASSERT_DEATH(flow.cost(2.f), "");
+    ASSERT_DEATH(flow.measure(0u, 2.f), "");
+    ASSERT_DEATH([[maybe_unused]] const auto value = flow.cost_of(0u), "");
 
     flow.bind(0);
 
@@ -335,6 +366,76 @@ TEST(Flow, Loop) {
     ASSERT_TRUE(graph.contains(1u, 0u));
 }
 
+TEST(Flow, Cost) {
+    entt::flow flow{};
+
+    flow.bind(0).rw(1).cost(4.f);
+    flow.bind(1).rw(2);
+
+    ASSERT_EQ(flow.cost_of(0u), 4.f);
+    ASSERT_EQ(flow.cost_of(1u), 1.f);
+
+    flow.measure(1u, 5.f).measure(0u, 0.f, 1.f);
+
+    ASSERT_EQ(flow.cost_of(0u), 0.f);
+    ASSERT_EQ(flow.cost_of(1u), 2.f);
+
+    flow.bind(0).cost(3.f);
+
+    ASSERT_EQ(flow.cost_of(0u), 3.f);
+
+    entt::flow other{flow};
+
+    ASSERT_EQ(other.cost_of(1u), 2.f);
+
+    flow.clear();
+    flow.bind(0);
+
+    ASSERT_EQ(flow.cost_of(0u), 1.f);
+}
+
+TEST(Flow, Priority) {
+    entt::flow flow{};
+
+    // 0 -> 1 -> 3 and 0 -> 2 -> 3, with a long task in the second branch
+    flow.bind(0).rw(10).rw(11);
+    flow.bind(1).ro(10).rw(12);
+    flow.bind(2).ro(11).rw(13).cost(4.f);
+    flow.bind(3).ro(12).ro(13);
+    flow.bind(4).rw(14).cost(2.f);
+
+    const auto graph = flow.graph();
+    const auto rank = flow.priority(graph);
+
+    ASSERT_EQ(rank.size(), 5u);
+    ASSERT_EQ(rank[0u], 6.f);
+    ASSERT_EQ(rank[1u], 2.f);
+    ASSERT_EQ(rank[2u], 5.f);
+    ASSERT_EQ(rank[3u], 1.f);
+    ASSERT_EQ(rank[4u], 2.f);
+
+    const auto path = flow.critical_path(graph);
+
+    ASSERT_EQ(path.size(), 3u);
+    ASSERT_EQ(path[0u], 0u);
+    ASSERT_EQ(path[1u], 2u);
+    ASSERT_EQ(path[2u], 3u);
+}
+
+TEST(Flow, PriorityLoop) {
+    entt::flow flow{};
+    flow.bind(0).rw(2).bind(1).ro(2).bind(0).rw(2);
+    flow.bind(1).cost(3.f);
+
+    const auto graph = flow.graph();
+    const auto rank = flow.priority(graph);
+
+    ASSERT_EQ(rank[0u], 1.f);
+    ASSERT_EQ(rank[1u], 3.f);
+    ASSERT_TRUE(flow.critical_path(graph).empty());
+    ASSERT_TRUE(flow.critical_path(entt::flow{}.graph()).empty());
+}
+
 TEST(Flow, ThrowingAllocator) {
     entt::basic_flow<test::throwing_allocator<entt::id_type>> flow{};
 
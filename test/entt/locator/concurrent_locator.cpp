@@ -0,0 +1,119 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <gtest/gtest.h>
+#include <entt/locator/concurrent_locator.hpp>
+#include "../../common/config.h"
+
+struct base_service {
+    virtual ~base_service() = default;
+    virtual int invoke(int) = 0;
+};
+
+struct derived_service: base_service {
+    derived_service(int val)
+        : value{val} {}
+
+    int invoke(int other) override {
+        return value + other;
+    }
+
+private:
+    int value;
+};
+
+struct ConcurrentServiceLocator: ::testing::Test {
+    void SetUp() override {
+        entt::concurrent_locator<base_service>::reset();
+        entt::concurrent_locator<base_service>::reclaim();
+    }
+};
+
+using ConcurrentServiceLocatorDeathTest = ConcurrentServiceLocator;
+
+TEST_F(ConcurrentServiceLocator, ValueAndTheLike) {
+    ASSERT_FALSE(entt::concurrent_locator<base_service>::has_value());
+    ASSERT_EQ(entt::concurrent_locator<base_service>::value_or<derived_service>(1).invoke(3), 4);
+    ASSERT_TRUE(entt::concurrent_locator<base_service>::has_value());
+    ASSERT_EQ(entt::concurrent_locator<base_service>::value_or<derived_service>(2).invoke(3), 4);
+    ASSERT_EQ(entt::concurrent_locator<base_service>::value().invoke(9), 10);
+}
+
+TEST_F(ConcurrentServiceLocator, Emplace) {
+    ASSERT_FALSE(entt::concurrent_locator<base_service>::has_value());
+    ASSERT_EQ(entt::concurrent_locator<base_service>::emplace<derived_service>(5).invoke(1), 6);
+    ASSERT_TRUE(entt::concurrent_locator<base_service>::has_value());
+    ASSERT_EQ(entt::concurrent_locator<base_service>::value().invoke(3), 8);
+
+    entt::concurrent_locator<base_service>::reset();
+
+    ASSERT_FALSE(entt::concurrent_locator<base_service>::has_value());
+    ASSERT_EQ(entt::concurrent_locator<base_service>::emplace<derived_service>(std::allocator_arg, std::allocator<derived_service>{}, 5).invoke(1), 6);
+    ASSERT_TRUE(entt::concurrent_locator<base_service>::has_value());
+    ASSERT_EQ(entt::concurrent_locator<base_service>::value().invoke(3), 8);
+}
+
+TEST_F(ConcurrentServiceLocator, ResetHandle) {
+    entt::concurrent_locator<base_service>::emplace<derived_service>(1);
+    auto handle = entt::concurrent_locator<base_service>::handle();
+
+    ASSERT_TRUE(entt::concurrent_locator<base_service>::has_value());
+    ASSERT_EQ(entt::concurrent_locator<base_service>::value().invoke(3), 4);
+
+    entt::concurrent_locator<base_service>::reset();
+
+    ASSERT_FALSE(entt::concurrent_locator<base_service>::has_value());
+
+    entt::concurrent_locator<base_service>::reset(handle);
+
+    ASSERT_TRUE(entt::concurrent_locator<base_service>::has_value());
+    ASSERT_EQ(entt::concurrent_locator<base_service>::value().invoke(3), 4);
+}
+
+TEST_F(ConcurrentServiceLocator, Reclaim) {
+    derived_service service{1};
+    bool released{};
+
+    entt::concurrent_locator<base_service>::reset(&service, [&released](base_service *) { released = true; });
+    auto &elem = entt::concurrent_locator<base_service>::value();
+    entt::concurrent_locator<base_service>::emplace<derived_service>(2);
+
+    ASSERT_FALSE(released);
+    ASSERT_EQ(elem.invoke(1), 2);
+    ASSERT_EQ(entt::concurrent_locator<base_service>::value().invoke(1), 3);
+
+    ASSERT_EQ(entt::concurrent_locator<base_service>::reclaim(), 1u);
+    ASSERT_TRUE(released);
+    ASSERT_EQ(entt::concurrent_locator<base_service>::reclaim(), 0u);
+}
+
+TEST_F(ConcurrentServiceLocator, Concurrent) {
+    std::atomic<bool> done{};
+    entt::concurrent_locator<base_service>::emplace<derived_service>(0);
+
+    std::thread reader{[&done]() {
+        while(!done.load()) {
+            const auto value = entt::concurrent_locator<base_service>::value().invoke(0);
+            ASSERT_GE(value, 0);
+            ASSERT_LT(value, 1000);
+        }
+    }};
+
+    for(int next{}; next < 1000; ++next) {
+        entt::concurrent_locator<base_service>::emplace<derived_service>(next);
+    }
+
+    done = true;
+    reader.join();
+
+    ASSERT_EQ(entt::concurrent_locator<base_service>::value().invoke(0), 999);
+    ASSERT_EQ(entt::concurrent_locator<base_service>::reclaim(), 1000u);
+}
+
+ENTT_DEBUG_TEST_F(ConcurrentServiceLocatorDeathTest, UninitializedValue) {
+    ASSERT_EQ(entt::concurrent_locator<base_service>::value_or<derived_service>(1).invoke(1), 2);
+
+    entt::concurrent_locator<base_service>::reset();
+
+    ASSERT_DEATH(entt::concurrent_locator<base_service>::value().invoke(4), "");
+}
@@ -0,0 +1,122 @@
+#include <memory>
+#include <thread>
+#include <gtest/gtest.h>
+#include <entt/locator/thread_local_locator.hpp>
+#include "../../common/config.h"
+
+struct base_service {
+    virtual ~base_service() = default;
+    virtual void invoke(int) = 0;
+    [[nodiscard]] virtual int total() const = 0;
+};
+
+struct derived_service: base_service {
+    derived_service(int val)
+        : value{val} {}
+
+    void invoke(int other) override {
+        value += other;
+    }
+
+    [[nodiscard]] int total() const override {
+        return value;
+    }
+
+private:
+    int value;
+};
+
+struct ThreadLocalServiceLocator: ::testing::Test {
+    void SetUp() override {
+        entt::thread_local_locator<base_service>::reset();
+    }
+};
+
+using ThreadLocalServiceLocatorDeathTest = ThreadLocalServiceLocator;
+
+TEST_F(ThreadLocalServiceLocator, Functionalities) {
+    ASSERT_FALSE(entt::thread_local_locator<base_service>::has_value());
+    ASSERT_EQ(entt::thread_local_locator<base_service>::size(), 0u);
+
+    entt::thread_local_locator<base_service>::emplace<derived_service>(1);
+
+    ASSERT_TRUE(entt::thread_local_locator<base_service>::has_value());
+    ASSERT_EQ(entt::thread_local_locator<base_service>::size(), 0u);
+
+    auto &service = entt::thread_local_locator<base_service>::value();
+
+    ASSERT_EQ(&service, &entt::thread_local_locator<base_service>::value());
+    ASSERT_EQ(entt::thread_local_locator<base_service>::size(), 1u);
+
+    service.invoke(2);
+
+    std::thread first{[]() { entt::thread_local_locator<base_service>::value().invoke(3); }};
+    std::thread second{[]() { entt::thread_local_locator<base_service>::value().invoke(4); }};
+
+    first.join();
+    second.join();
+
+    int total{};
+    entt::thread_local_locator<base_service>::each([&total](const base_service &elem) { total += elem.total(); });
+
+    ASSERT_EQ(entt::thread_local_locator<base_service>::size(), 3u);
+    ASSERT_EQ(total, 3 + 4 + 5);
+
+    entt::thread_local_locator<base_service>::reset();
+
+    ASSERT_FALSE(entt::thread_local_locator<base_service>::has_value());
+    ASSERT_EQ(entt::thread_local_locator<base_service>::size(), 0u);
+}
+
+TEST_F(ThreadLocalServiceLocator, Factory) {
+    entt::thread_local_locator<base_service>::factory([]() { return std::make_unique<derived_service>(2); });
+
+    ASSERT_EQ(entt::thread_local_locator<base_service>::value().total(), 2);
+
+    entt::thread_local_locator<base_service>::value().invoke(1);
+    entt::thread_local_locator<base_service>::factory([]() { return std::make_shared<derived_service>(4); });
+
+    ASSERT_EQ(entt::thread_local_locator<base_service>::size(), 0u);
+    ASSERT_EQ(entt::thread_local_locator<base_service>::value().total(), 4);
+    ASSERT_EQ(entt::thread_local_locator<base_service>::size(), 1u);
+}
+
+TEST_F(ThreadLocalServiceLocator, ReentrantFactory) {
+    entt::thread_local_locator<base_service>::factory([]() {
+        // factories run out of the lock and can use the locator
+        const auto count = static_cast<int>(entt::thread_local_locator<base_service>::size());
+        entt::thread_local_locator<base_service>::each([](base_service &) {});
+        return std::make_shared<derived_service>(count);
+    });
+
+    ASSERT_EQ(entt::thread_local_locator<base_service>::value().total(), 0);
+
+    std::thread other{[]() { entt::thread_local_locator<base_service>::value().invoke(1); }};
+    other.join();
+
+    ASSERT_EQ(entt::thread_local_locator<base_service>::size(), 2u);
+}
+
+TEST_F(ThreadLocalServiceLocator, ReplacedWhileBuilding) {
+    entt::thread_local_locator<base_service>::factory([]() {
+        // the instance is discarded and the new factory is invoked in its place
+        entt::thread_local_locator<base_service>::emplace<derived_service>(4);
+        return std::make_shared<derived_service>(2);
+    });
+
+    ASSERT_EQ(entt::thread_local_locator<base_service>::value().total(), 4);
+    ASSERT_EQ(entt::thread_local_locator<base_service>::size(), 1u);
+}
+
+ENTT_DEBUG_TEST_F(ThreadLocalServiceLocatorDeathTest, RecursiveFactory) {
+    entt::thread_local_locator<base_service>::factory([]() {
+        entt::thread_local_locator<base_service>::value().invoke(1);
+        return std::make_shared<derived_service>(0);
+    });
+
+    ASSERT_DEATH([[maybe_unused]] auto &value = entt::thread_local_locator<base_service>::value(), "");
+}
+
+ENTT_DEBUG_TEST_F(ThreadLocalServiceLocatorDeathTest, UninitializedValue) {
+    ASSERT_DEATH([[maybe_unused]] auto &value = entt::thread_local_locator<base_service>::value(), "");
+}
@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <gtest/gtest.h>
 #include <entt/core/any.hpp>
@@ -179,6 +180,35 @@ TEST_F(MetaAny, NoSBO) {
     ASSERT_NE(any, fat{});
 }
 
+TEST_F(MetaAny, SBOConfiguration) {
+    using any_type = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<entt::meta_any>().base())>>;
+
+    ASSERT_EQ(any_type::length, ENTT_META_ANY_LENGTH);
+    ASSERT_EQ(any_type::alignment, ENTT_META_ANY_ALIGNMENT);
+}
+
+TEST_F(MetaAny, NoSBOArena) {
+    const fat instance{.1, .2, .3, .4};
+    entt::any_arena arena{};
+    entt::any_arena::install(&arena);
+
+    entt::meta_any any{instance};
+    const entt::meta_any other{any};
+
+    entt::any_arena::install(nullptr);
+
+    ASSERT_TRUE(any.base().owner());
+    ASSERT_EQ(any.base().policy(), entt::any_policy::arena);
+    ASSERT_EQ(other.base().policy(), entt::any_policy::arena);
+    ASSERT_EQ(any.cast<fat>(), instance);
+    ASSERT_EQ(any, other);
+
+    any.reset();
+
+    ASSERT_FALSE(any);
+    ASSERT_EQ(arena.size(), 1u);
+}
+
 TEST_F(MetaAny, SBOInPlaceConstruction) {
     std::unique_ptr<int> elem = std::make_unique<int>(2);
     // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
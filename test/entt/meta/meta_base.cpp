@@ -192,3 +192,52 @@ TEST_F(MetaBase, ReRegistration) {
     ASSERT_FALSE(node.details->base.empty());
     ASSERT_EQ(node.details->base.size(), 2u);
 }
+
+TEST_F(MetaBase, LookupAfterChanges) {
+    using namespace entt::literals;
+
+    auto type = entt::resolve<derived>();
+
+    ASSERT_TRUE(type.data("value_2"_hs));
+    ASSERT_FALSE(type.data("other"_hs));
+    ASSERT_EQ(type.data("value_1"_hs).type(), entt::resolve<int>());
+
+    // members are added to the bases after the first lookup
+    entt::meta_factory<base_2>{}.data<&base_2::value_2>("other"_hs);
+
+    ASSERT_TRUE(type.data("other"_hs));
+
+    // members of derived classes shadow those of their bases
+    entt::meta_factory<derived>{}.data<&derived::value>("value_1"_hs);
+
+    derived instance{};
+    instance.value = 3;
+
+    ASSERT_EQ(type.data("value_1"_hs).get(instance).cast<int>(), 3);
+
+    entt::meta_reset<base_2>();
+
+    ASSERT_FALSE(type.data("other"_hs));
+    ASSERT_TRUE(type.data("value_3"_hs));
+}
+
+TEST_F(MetaBase, CastAfterChanges) {
+    derived instance{};
+    auto any = entt::forward_as_meta(instance);
+
+    ASSERT_EQ(any.try_cast<base_2>(), static_cast<base_2 *>(&instance));
+    ASSERT_TRUE(std::as_const(any).allow_cast<int>());
+    ASSERT_EQ(any.try_cast<base_2>(), static_cast<base_2 *>(&instance));
+
+    // the link between base_3 and base_2 goes away with base_3
+    entt::meta_reset<base_3>();
+
+    ASSERT_EQ(any.try_cast<base_2>(), nullptr);
+    ASSERT_FALSE(std::as_const(any).allow_cast<int>());
+    ASSERT_NE(any.try_cast<base_3>(), nullptr);
+
+    entt::meta_factory<base_3>{}.base<base_2>();
+
+    ASSERT_EQ(any.try_cast<base_2>(), static_cast<base_2 *>(&instance));
+    ASSERT_TRUE(std::as_const(any).allow_cast<int>());
+}
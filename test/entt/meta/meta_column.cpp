@@ -0,0 +1,146 @@
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/storage.hpp>
+#include <entt/locator/locator.hpp>
+#include <entt/meta/column.hpp>
+#include <entt/meta/context.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+#include <entt/meta/resolve.hpp>
+#include "../../common/config.h"
+
+struct base {
+    int id{};
+};
+
+struct clazz: base {
+    static constexpr std::size_t page_size = 4u;
+
+    int value{};
+    char other{};
+    float scale{};
+
+    [[nodiscard]] int get() const {
+        return value;
+    }
+};
+
+struct MetaColumn: ::testing::Test {
+    void SetUp() override {
+        using namespace entt::literals;
+
+        entt::meta_factory<base>{}
+            .data<&base::id>("id"_hs);
+
+        entt::meta_factory<clazz>{}
+            .base<base>()
+            .data<&clazz::value>("value"_hs)
+            .data<&clazz::other>("other"_hs)
+            .data<&clazz::scale>("scale"_hs)
+            .data<nullptr, &clazz::get>("get"_hs);
+
+        for(std::size_t pos{}; pos < 10u; ++pos) {
+            const auto value = static_cast<int>(pos);
+            storage.emplace(entt::entity{static_cast<entt::id_type>(pos)}, clazz{{-value}, value, static_cast<char>('a' + value), static_cast<float>(value) / 2.f});
+        }
+    }
+
+    void TearDown() override {
+        entt::meta_reset();
+    }
+
+    entt::storage<clazz> storage;
+};
+
+using MetaColumnDeathTest = MetaColumn;
+
+TEST_F(MetaColumn, Address) {
+    using namespace entt::literals;
+
+    const auto &instance = storage.get(entt::entity{3});
+
+    ASSERT_EQ(entt::resolve<clazz>().data("value"_hs).address(instance), &instance.value);
+    ASSERT_EQ(entt::resolve<clazz>().data("id"_hs).address(instance), &instance.id);
+    ASSERT_EQ(entt::resolve<clazz>().data("get"_hs).address(instance), nullptr);
+    ASSERT_EQ(entt::resolve<clazz>().data("value"_hs).address(entt::meta_any{42}), nullptr);
+}
+
+TEST_F(MetaColumn, Functionalities) {
+    using namespace entt::literals;
+
+    entt::meta_column column{};
+
+    ASSERT_FALSE(column);
+
+    column = entt::meta_column{storage, entt::resolve<clazz>().data("scale"_hs)};
+
+    ASSERT_TRUE(column);
+    ASSERT_EQ(column.size(), storage.size());
+    ASSERT_EQ(column.step(), sizeof(clazz));
+    ASSERT_EQ(column.type(), entt::resolve<float>());
+
+    for(std::size_t pos{}; pos < column.size(); ++pos) {
+        ASSERT_EQ(column[pos], &storage.get(entt::entity{static_cast<entt::id_type>(pos)}).scale);
+    }
+}
+
+TEST_F(MetaColumn, Each) {
+    using namespace entt::literals;
+
+    const entt::meta_column column{storage, entt::resolve<clazz>().data("other"_hs)};
+    std::size_t segments{};
+    std::size_t count{};
+
+    column.each([&](const void *first, const entt::meta_column::size_type len) {
+        ASSERT_LE(len, clazz::page_size);
+
+        for(std::size_t pos{}; pos < len; ++pos) {
+            ASSERT_EQ(*(static_cast<const char *>(first) + pos * column.step()), static_cast<char>('a' + count));
+            ++count;
+        }
+
+        ++segments;
+    });
+
+    ASSERT_EQ(segments, 3u);
+    ASSERT_EQ(count, storage.size());
+}
+
+TEST_F(MetaColumn, BaseMember) {
+    using namespace entt::literals;
+
+    const entt::meta_column column{storage, entt::resolve<clazz>().data("id"_hs)};
+
+    ASSERT_EQ(column.type(), entt::resolve<int>());
+
+    for(std::size_t pos{}; pos < column.size(); ++pos) {
+        ASSERT_EQ(*static_cast<const int *>(column[pos]), -static_cast<int>(pos));
+    }
+}
+
+TEST_F(MetaColumn, Empty) {
+    using namespace entt::literals;
+
+    storage.clear();
+
+    const entt::meta_column column{storage, entt::resolve<clazz>().data("value"_hs)};
+    std::size_t segments{};
+
+    column.each([&segments](const void *, const entt::meta_column::size_type) { ++segments; });
+
+    ASSERT_TRUE(column);
+    ASSERT_EQ(column.size(), 0u);
+    ASSERT_EQ(segments, 0u);
+}
+
+ENTT_DEBUG_TEST_F(MetaColumnDeathTest, MetaColumn) {
+    using namespace entt::literals;
+
+    ASSERT_DEATH(entt::meta_column(storage, entt::resolve<clazz>().data("get"_hs)), "");
+
+    const entt::meta_column column{storage, entt::resolve<clazz>().data("value"_hs)};
+
+    ASSERT_DEATH([[maybe_unused]] const auto *elem = column[storage.size()], "");
+}
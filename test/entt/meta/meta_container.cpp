@@ -327,6 +327,31 @@ TEST(SequenceContainer, NonDefaultConstructible) {
     ASSERT_FALSE(view.resize(5u));
 }
 
+TEST(SequenceContainer, Contiguous) {
+    std::vector<float> vec{1.f, 2.f, 3.f};
+    std::array<int, 2u> arr{4, 5};
+    std::vector<bool> bits{true};
+    std::deque<int> deq{6};
+    auto any = entt::forward_as_meta(vec);
+    auto view = any.as_sequence_container();
+
+    ASSERT_EQ(view.data(), vec.data());
+    ASSERT_EQ(std::as_const(view).data(), vec.data());
+    ASSERT_EQ(view.value_type(), entt::resolve<float>());
+    ASSERT_EQ(static_cast<const float *>(view.data())[2u], 3.f);
+
+    ASSERT_EQ(entt::forward_as_meta(arr).as_sequence_container().data(), arr.data());
+    ASSERT_EQ(entt::forward_as_meta(bits).as_sequence_container().data(), nullptr);
+    ASSERT_EQ(entt::forward_as_meta(deq).as_sequence_container().data(), nullptr);
+
+    auto cany = entt::forward_as_meta(std::as_const(vec));
+    auto cview = cany.as_sequence_container();
+
+    ASSERT_EQ(cview.data(), nullptr);
+    ASSERT_EQ(std::as_const(cview).data(), vec.data());
+    ASSERT_EQ(entt::meta_sequence_container{}.data(), nullptr);
+}
+
 TEST(SequenceContainer, Constness) {
     std::vector<int> vec{};
     auto any = entt::forward_as_meta(std::as_const(vec));
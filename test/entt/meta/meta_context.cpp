@@ -1,4 +1,7 @@
+#include <atomic>
+#include <cstddef>
 #include <iterator>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -74,6 +77,14 @@ private:
 template<typename...>
 struct template_clazz {};
 
+template<std::size_t>
+struct late {};
+
+template<std::size_t... Index>
+void register_late(entt::meta_ctx &area, std::index_sequence<Index...>) {
+    (entt::meta_factory<late<Index>>{area}.type(static_cast<entt::id_type>(Index + 1u)), ...);
+}
+
 class MetaContext: public ::testing::Test {
     static void init_global_context() {
         using namespace entt::literals;
@@ -507,3 +518,79 @@ TEST_F(MetaContext, ForwardAsMeta) {
     ASSERT_EQ(global.type().data("marker"_hs).get({}).cast<int>(), global_marker);
     ASSERT_EQ(local.type().data("marker"_hs).get({}).cast<int>(), local_marker);
 }
+
+TEST_F(MetaContext, LateRegistration) {
+    using namespace entt::literals;
+
+    entt::meta_ctx area{};
+    std::atomic<bool> done{};
+
+    entt::meta_factory<base>{area}
+        .type("base"_hs)
+        .data<&base::value>("value"_hs);
+
+    std::thread reader{[&area, &done]() {
+        while(!done.load()) {
+            ASSERT_TRUE(entt::resolve(area, "base"_hs));
+            ASSERT_TRUE(entt::resolve<base>(area).data("value"_hs));
+        }
+    }};
+
+    register_late(area, std::make_index_sequence<32u>{});
+    done = true;
+    reader.join();
+
+    ASSERT_TRUE(entt::resolve<late<0u>>(area));
+    ASSERT_EQ(entt::resolve(area, entt::id_type{32u}), entt::resolve<late<31u>>(area));
+    ASSERT_NE(entt::meta_reclaim(area), 0u);
+    ASSERT_EQ(entt::meta_reclaim(area), 0u);
+    ASSERT_TRUE(entt::resolve(area, "base"_hs));
+
+    entt::meta_reset<late<0u>>(area);
+
+    ASSERT_FALSE(entt::resolve(area, entt::id_type{1u}));
+    ASSERT_TRUE(entt::resolve(area, entt::id_type{2u}));
+
+    entt::meta_reset(area, entt::id_type{2u});
+
+    ASSERT_FALSE(entt::resolve(area, entt::id_type{2u}));
+    ASSERT_FALSE(entt::resolve(area, entt::type_id<late<1u>>()));
+
+    entt::meta_reset(area);
+
+    ASSERT_FALSE(entt::resolve(area, "base"_hs));
+    ASSERT_EQ(entt::meta_reclaim(area), 0u);
+}
+
+TEST_F(MetaContext, Batch) {
+    using namespace entt::literals;
+
+    entt::meta_ctx area{};
+
+    entt::meta_factory<base>{area}.type("base"_hs);
+    entt::meta_reclaim(area);
+
+    {
+        const entt::meta_batch outer{area};
+
+        {
+            const entt::meta_batch inner{area};
+            register_late(area, std::make_index_sequence<16u>{});
+        }
+
+        ASSERT_TRUE(entt::resolve(area, "base"_hs));
+        ASSERT_FALSE(entt::resolve(area, entt::id_type{1u}));
+        ASSERT_FALSE(entt::resolve(area, entt::type_id<late<15u>>()));
+    }
+
+    ASSERT_TRUE(entt::resolve(area, "base"_hs));
+    ASSERT_EQ(entt::resolve(area, entt::id_type{16u}), entt::resolve<late<15u>>(area));
+    // the whole batch is published with a single table
+    ASSERT_EQ(entt::meta_reclaim(area), 1u);
+
+    {
+        const entt::meta_batch batch{area};
+    }
+
+    ASSERT_EQ(entt::meta_reclaim(area), 0u);
+}
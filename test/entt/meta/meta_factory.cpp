@@ -414,6 +414,24 @@ TEST_F(MetaFactory, Custom) {
     ASSERT_EQ(static_cast<int>(type.func("func"_hs).next().custom()), 3);
 }
 
+TEST_F(MetaFactory, MetaReserve) {
+    entt::meta_ctx ctx{};
+    auto &&context = entt::internal::meta_context::from(ctx);
+    const auto bucket_count = context.value.bucket_count();
+
+    entt::meta_reserve(ctx, 1024u);
+
+    ASSERT_GT(context.value.bucket_count(), bucket_count);
+    ASSERT_EQ(context.value.size(), 0u);
+
+    entt::meta_factory<int>{ctx};
+    entt::meta_factory<double>{ctx};
+
+    ASSERT_EQ(context.value.size(), 2u);
+    ASSERT_TRUE(entt::resolve(ctx, entt::type_id<int>()));
+    ASSERT_TRUE(entt::resolve(ctx, entt::type_id<double>()));
+}
+
 TEST_F(MetaFactory, MetaReset) {
     using namespace entt::literals;
 
@@ -710,3 +710,40 @@ TEST_F(MetaFunc, ReRegistration) {
 
     ASSERT_EQ(reset_and_check(), 0u);
 }
+
+TEST_F(MetaFunc, Bind) {
+    using namespace entt::literals;
+
+    auto type = entt::resolve<function>();
+    function instance{};
+    int value = 3;
+
+    ASSERT_EQ(entt::meta_func{}.bind<void(int)>(), nullptr);
+    ASSERT_EQ(type.func("g"_hs).bind<void(int)>(), nullptr);
+    ASSERT_EQ(type.func("g"_hs).bind<void(const function &, int)>(), nullptr);
+
+    auto *g = type.func("g"_hs).bind<void(function &, int)>();
+
+    ASSERT_NE(g, nullptr);
+
+    g(instance, 3);
+
+    ASSERT_EQ(instance.value, 9);
+    ASSERT_EQ(type.func("f1"_hs).bind<int(const function &, int)>()(instance, 2), 18);
+    ASSERT_EQ(type.func("h"_hs).bind<int(int &, const function &)>()(value, instance), 27);
+    ASSERT_EQ(value, 27);
+
+    // policies don't apply to direct calls
+    ASSERT_EQ(&type.func("a"_hs).bind<int &(function &)>()(instance), &instance.value);
+    ASSERT_EQ(type.func("v"_hs).bind<int(const function &, int &)>()(instance, value), 9);
+
+    entt::meta_factory<function>{}
+        .func<entt::overload<int(int, int)>(&function::f)>("f"_hs)
+        .func<entt::overload<int(int) const>(&function::f)>("f"_hs);
+
+    ASSERT_EQ(type.func("f"_hs).bind<int(function &, int, int)>()(instance, 1, 4), 16);
+    ASSERT_EQ(instance.value, 1);
+    ASSERT_EQ(type.func("f"_hs).bind<int(const function &, int)>()(instance, 5), 5);
+
+    ASSERT_NE(entt::resolve<base>().func("fake_member"_hs).bind<void(base &, int)>(), nullptr);
+}
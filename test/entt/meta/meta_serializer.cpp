@@ -0,0 +1,206 @@
+#include <array>
+#include <cstddef>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/snapshot.hpp>
+#include <entt/meta/container.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+#include <entt/meta/resolve.hpp>
+#include <entt/meta/serializer.hpp>
+#include "../../common/config.h"
+
+struct position {
+    float x{};
+    float y{};
+};
+
+struct item {
+    int value{};
+    std::vector<char> tags{};
+};
+
+struct base {
+    int id{};
+};
+
+struct record: base {
+    float scale{};
+    const int constant{3};
+    std::vector<int> list{};
+    std::array<position, 2u> points{};
+    std::vector<item> items{};
+    int hidden{};
+
+    [[nodiscard]] int get() const {
+        return hidden;
+    }
+};
+
+struct MetaSerializer: ::testing::Test {
+    void SetUp() override {
+        using namespace entt::literals;
+
+        entt::meta_factory<base>{}
+            .data<&base::id>("id"_hs);
+
+        entt::meta_factory<item>{}
+            .data<&item::value>("value"_hs)
+            .data<&item::tags>("tags"_hs);
+
+        entt::meta_factory<record>{}
+            .base<base>()
+            .data<&record::scale>("scale"_hs)
+            .data<&record::constant>("constant"_hs)
+            .data<&record::list>("list"_hs)
+            .data<&record::points>("points"_hs)
+            .data<&record::items>("items"_hs)
+            .data<nullptr, &record::get>("get"_hs);
+    }
+
+    void TearDown() override {
+        entt::meta_reset();
+    }
+};
+
+using MetaSerializerDeathTest = MetaSerializer;
+
+TEST_F(MetaSerializer, Plan) {
+    const record instance{};
+    const position other{};
+
+    // id and scale are merged, points is trivially copyable
+    ASSERT_EQ(entt::meta_plan(entt::resolve<record>(), &instance).size(), 4u);
+    ASSERT_EQ(entt::meta_plan(entt::resolve<position>(), &other).size(), 1u);
+    ASSERT_EQ(entt::meta_plan(entt::resolve<int>(), nullptr).size(), 1u);
+    ASSERT_EQ(entt::meta_plan{}.size(), 0u);
+}
+
+TEST_F(MetaSerializer, RoundTrip) {
+    record instance{};
+    instance.id = 42;
+    instance.scale = 1.5f;
+    instance.list = {1, 2, 3};
+    instance.points = {position{1.f, 2.f}, position{3.f, 4.f}};
+    instance.items = {item{1, {'a', 'b'}}, item{2, {}}};
+    instance.hidden = 99;
+
+    std::vector<std::byte> buffer{};
+    entt::meta_output_archive output{buffer};
+
+    output(instance);
+    output(7);
+
+    record other{};
+    int value{};
+    entt::meta_input_archive input{buffer.data(), buffer.data() + buffer.size()};
+
+    input(other);
+
+    ASSERT_EQ(other.id, 42);
+    ASSERT_EQ(other.scale, 1.5f);
+    ASSERT_EQ(other.list, (std::vector<int>{1, 2, 3}));
+    ASSERT_EQ(other.points[1u].x, 3.f);
+    ASSERT_EQ(other.points[1u].y, 4.f);
+    ASSERT_EQ(other.items.size(), 2u);
+    ASSERT_EQ(other.items[0u].value, 1);
+    ASSERT_EQ(other.items[0u].tags, (std::vector<char>{'a', 'b'}));
+    ASSERT_EQ(other.items[1u].value, 2);
+    ASSERT_TRUE(other.items[1u].tags.empty());
+    // not registered as pointers to members
+    ASSERT_EQ(other.hidden, 0);
+    ASSERT_NE(input.size(), 0u);
+
+    input(value);
+
+    ASSERT_EQ(value, 7);
+    ASSERT_EQ(input.size(), 0u);
+}
+
+TEST_F(MetaSerializer, HashAndEqual) {
+    record instance{};
+    instance.id = 42;
+    instance.list = {1, 2, 3};
+    instance.items = {item{1, {'a', 'b'}}, item{2, {}}};
+    instance.hidden = 99;
+
+    record other = instance;
+    // not registered as pointers to members
+    other.hidden = 0;
+
+    entt::meta_hasher hasher{};
+
+    ASSERT_EQ(hasher.size(), 0u);
+    ASSERT_EQ(hasher.hash(entt::forward_as_meta(instance)), hasher.hash(entt::forward_as_meta(other)));
+    ASSERT_TRUE(hasher.equal(entt::forward_as_meta(instance), entt::forward_as_meta(other)));
+    ASSERT_EQ(hasher.size(), 1u);
+
+    other.items[0u].tags.back() = 'c';
+
+    ASSERT_NE(hasher.hash(entt::forward_as_meta(instance)), hasher.hash(entt::forward_as_meta(other)));
+    ASSERT_FALSE(hasher.equal(entt::forward_as_meta(instance), entt::forward_as_meta(other)));
+
+    other.items[0u].tags.pop_back();
+
+    ASSERT_NE(hasher.hash(entt::forward_as_meta(instance)), hasher.hash(entt::forward_as_meta(other)));
+    ASSERT_FALSE(hasher.equal(entt::forward_as_meta(instance), entt::forward_as_meta(other)));
+
+    other.items = instance.items;
+    other.list[2u] = 4;
+
+    ASSERT_NE(hasher.hash(entt::forward_as_meta(instance)), hasher.hash(entt::forward_as_meta(other)));
+    ASSERT_FALSE(hasher.equal(entt::forward_as_meta(instance), entt::forward_as_meta(other)));
+
+    const auto seed = hasher.hash(entt::forward_as_meta(instance));
+
+    ASSERT_EQ(hasher.hash(entt::meta_any{3}, seed), hasher.hash(entt::meta_any{3}, seed));
+    ASSERT_NE(hasher.hash(entt::meta_any{3}, seed), hasher.hash(entt::meta_any{3}));
+    ASSERT_TRUE(hasher.equal(entt::meta_any{3}, entt::meta_any{3}));
+    ASSERT_FALSE(hasher.equal(entt::meta_any{3}, entt::meta_any{4}));
+    ASSERT_FALSE(hasher.equal(entt::meta_any{3}, entt::meta_any{3.}));
+    ASSERT_EQ(hasher.size(), 2u);
+}
+
+TEST_F(MetaSerializer, Snapshot) {
+    entt::registry source{};
+    entt::registry destination{};
+
+    for(int pos{}; pos < 3; ++pos) {
+        const auto entity = source.create();
+        source.emplace<position>(entity, static_cast<float>(pos), static_cast<float>(-pos));
+        source.emplace<record>(entity).list.assign(static_cast<std::size_t>(pos), pos);
+    }
+
+    std::vector<std::byte> buffer{};
+    entt::meta_output_archive output{buffer};
+
+    entt::snapshot{source}
+        .get<entt::entity>(output)
+        .get<position>(output)
+        .get<record>(output);
+
+    entt::meta_input_archive input{buffer.data(), buffer.data() + buffer.size()};
+
+    entt::snapshot_loader{destination}
+        .get<entt::entity>(input)
+        .get<position>(input)
+        .get<record>(input);
+
+    ASSERT_EQ(input.size(), 0u);
+
+    for(auto [entity, pos, elem]: source.view<position, record>().each()) {
+        ASSERT_TRUE(destination.valid(entity));
+        ASSERT_EQ(destination.get<position>(entity).x, pos.x);
+        ASSERT_EQ(destination.get<position>(entity).y, pos.y);
+        ASSERT_EQ(destination.get<record>(entity).list, elem.list);
+    }
+}
+
+ENTT_DEBUG_TEST_F(MetaSerializerDeathTest, MetaPlan) {
+    const record instance{};
+
+    ASSERT_DEATH(entt::meta_plan(entt::meta_type{}, &instance), "");
+    ASSERT_DEATH(entt::meta_plan(entt::resolve<record>(), nullptr), "");
+}
@@ -1,7 +1,10 @@
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <new>
 #include <utility>
 #include <vector>
 #include <gtest/gtest.h>
@@ -344,6 +347,9 @@ TEST_F(MetaType, Traits) {
     ASSERT_TRUE(entt::resolve<derived>().is_class());
     ASSERT_FALSE(entt::resolve<double>().is_class());
 
+    ASSERT_TRUE(entt::resolve<double>().is_trivially_copyable());
+    ASSERT_FALSE(entt::resolve<std::vector<int>>().is_trivially_copyable());
+
     ASSERT_TRUE(entt::resolve<int *>().is_pointer());
     ASSERT_FALSE(entt::resolve<int>().is_pointer());
 
@@ -617,6 +623,49 @@ TEST_F(MetaType, ConstructInvalidArgs) {
     ASSERT_FALSE(entt::resolve<clazz>().construct('c', base{}));
 }
 
+TEST_F(MetaType, ConstructN) {
+    alignas(clazz) std::array<std::byte, sizeof(clazz) * 5u> buffer{};
+    auto *elem = std::launder(reinterpret_cast<clazz *>(buffer.data()));
+    const auto type = entt::resolve<clazz>();
+
+    ASSERT_TRUE(type.construct_n(buffer.data(), 5u, base{}, 2));
+
+    for(std::size_t pos{}; pos < 5u; ++pos) {
+        ASSERT_EQ(elem[pos].value, 2);
+    }
+
+    ASSERT_TRUE(type.construct_n(buffer.data(), 3u, base{}, 4));
+    ASSERT_EQ(elem[2u].value, 4);
+    ASSERT_EQ(elem[3u].value, 2);
+
+    ASSERT_TRUE(type.construct_n(buffer.data(), 0u));
+    ASSERT_FALSE(type.construct_n(buffer.data(), 1u, 'c', base{}));
+    ASSERT_FALSE(entt::resolve<void>().construct_n(buffer.data(), 1u));
+
+    type.destroy_n(buffer.data(), 5u);
+}
+
+TEST_F(MetaType, ConstructNNonTrivial) {
+    using value_type = std::vector<int>;
+
+    entt::meta_factory<value_type>{}.ctor<int>();
+
+    alignas(value_type) std::array<std::byte, sizeof(value_type) * 3u> buffer{};
+    auto *elem = std::launder(reinterpret_cast<value_type *>(buffer.data()));
+    const auto type = entt::resolve<value_type>();
+    const auto expected = type.construct(2).cast<value_type>();
+
+    ASSERT_FALSE(type.is_trivially_copyable());
+    ASSERT_FALSE(expected.empty());
+    ASSERT_TRUE(type.construct_n(buffer.data(), 3u, 2));
+
+    for(std::size_t pos{}; pos < 3u; ++pos) {
+        ASSERT_EQ(elem[pos], expected);
+    }
+
+    type.destroy_n(buffer.data(), 3u);
+}
+
 TEST_F(MetaType, LessArgs) {
     ASSERT_FALSE(entt::resolve<clazz>().construct(base{}));
 }
@@ -1,6 +1,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
 #include <utility>
 #include <gtest/gtest.h>
 #include <entt/core/type_info.hpp>
@@ -107,6 +108,14 @@ struct Defined
     using impl = common_impl<Type>;
 };
 
+struct DeducedInline: Deduced {
+    static constexpr bool inline_vtable = true;
+};
+
+struct DefinedInline: Defined {
+    static constexpr bool inline_vtable = true;
+};
+
 struct DeducedEmbedded
     : entt::type_list<> {
     template<typename Base>
@@ -189,6 +198,12 @@ struct impl {
 
 struct alignas(64u) over_aligned: impl {};
 
+struct doubled: impl {
+    void incr() {
+        value += 2;
+    }
+};
+
 template<typename Type>
 struct Poly: testing::Test {
     template<std::size_t... Args>
@@ -198,7 +213,7 @@ struct Poly: testing::Test {
 template<typename Type>
 using PolyDeathTest = Poly<Type>;
 
-using PolyTypes = ::testing::Types<Deduced, Defined>;
+using PolyTypes = ::testing::Types<Deduced, Defined, DeducedInline, DefinedInline>;
 
 TYPED_TEST_SUITE(Poly, PolyTypes, );
 TYPED_TEST_SUITE(PolyDeathTest, PolyTypes, );
@@ -465,6 +480,45 @@ TYPED_TEST(Poly, NoSboAlignment) {
     ASSERT_EQ(data, nosbo[1].data());
 }
 
+TYPED_TEST(Poly, Collection) {
+    entt::basic_poly_collection<TypeParam> collection{};
+
+    ASSERT_TRUE(collection.empty());
+    ASSERT_EQ(collection.size(), 0u);
+    ASSERT_EQ(collection.template size<impl>(), 0u);
+
+    auto &elem = collection.template emplace<impl>(1);
+    auto &other = collection.template emplace<doubled>();
+
+    ASSERT_FALSE(collection.empty());
+    ASSERT_EQ(collection.size(), 2u);
+    ASSERT_EQ(collection.template size<impl>(), 1u);
+    ASSERT_EQ(collection.template size<doubled>(), 1u);
+
+    collection.template for_each<0u>();
+
+    ASSERT_EQ(elem.value, 2);
+    ASSERT_EQ(other.value, 2);
+
+    collection.template for_each<1u>(3);
+    std::as_const(collection).template for_each<2u>();
+
+    ASSERT_EQ(elem.value, 3);
+    ASSERT_EQ(other.value, 3);
+
+    collection.template emplace<impl>();
+    collection.template emplace<impl>(4);
+    collection.template for_each<0u>();
+
+    ASSERT_EQ(collection.size(), 4u);
+    ASSERT_EQ(collection.template size<impl>(), 3u);
+
+    collection.clear();
+
+    ASSERT_TRUE(collection.empty());
+    ASSERT_EQ(collection.template size<doubled>(), 0u);
+}
+
 TYPED_TEST(PolyEmbedded, EmbeddedVtable) {
     using poly_type = typename TestFixture::type;
 
@@ -481,6 +535,32 @@ TYPED_TEST(PolyEmbedded, EmbeddedVtable) {
     ASSERT_EQ(poly->get(), 2);
 }
 
+TEST(Poly, InlineVtable) {
+    using poly_type = entt::basic_poly<Defined>;
+    using inline_type = entt::basic_poly<DefinedInline>;
+
+    static_assert(std::is_pointer_v<typename poly_type::vtable_type>, "Shared vtable expected");
+    testing::StaticAssertTypeEq<typename inline_type::vtable_type, std::remove_const_t<std::remove_pointer_t<typename poly_type::vtable_type>>>();
+
+    inline_type poly{impl{}};
+    inline_type other = poly;
+
+    poly->set(2);
+    other->incr();
+
+    ASSERT_EQ(poly->get(), 2);
+    ASSERT_EQ(other->get(), 1);
+    ASSERT_EQ(poly->mul(3), 6);
+
+    other = impl{4};
+
+    ASSERT_EQ(other->get(), 4);
+
+    other.reset();
+
+    ASSERT_FALSE(other);
+}
+
 TYPED_TEST(PolyDerived, InheritanceSupport) {
     using poly_type = typename TestFixture::type;
 
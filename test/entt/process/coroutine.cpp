@@ -0,0 +1,187 @@
+#include <entt/process/coroutine.hpp>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#    include <cstdint>
+#    include <memory>
+#    include <utility>
+#    include <gtest/gtest.h>
+#    include <entt/core/page_pool.hpp>
+#    include <entt/process/process.hpp>
+#    include <entt/process/scheduler.hpp>
+#    include "../../common/config.h"
+
+entt::coroutine frames(int &counter) {
+    ++counter;
+    co_await entt::next_frame;
+    ++counter;
+    co_await entt::next_frame;
+    ++counter;
+}
+
+entt::coroutine sleep(int &counter, const std::uint32_t value) {
+    co_await entt::delay{value};
+    ++counter;
+}
+
+entt::coroutine listen(entt::co_event<int> &event, int &value) {
+    value = co_await event;
+    value += co_await event;
+}
+
+template<typename Allocator>
+entt::coroutine arena(std::allocator_arg_t, const Allocator &, int &counter) {
+    co_await entt::next_frame;
+    ++counter;
+}
+
+TEST(Coroutine, Functionalities) {
+    int counter{};
+    entt::coroutine coro{};
+
+    ASSERT_FALSE(coro);
+    ASSERT_TRUE(coro.done());
+
+    coro = frames(counter);
+
+    ASSERT_TRUE(coro);
+    ASSERT_FALSE(coro.done());
+    ASSERT_EQ(counter, 0);
+
+    ASSERT_FALSE(coro.resume(0u));
+    ASSERT_EQ(counter, 1);
+
+    entt::coroutine other{std::move(coro)};
+
+    ASSERT_FALSE(other.resume(0u));
+    ASSERT_TRUE(other.resume(0u));
+    ASSERT_TRUE(other.done());
+    ASSERT_EQ(counter, 3);
+}
+
+TEST(Coroutine, NextFrame) {
+    entt::scheduler scheduler{};
+    int counter{};
+
+    scheduler.attach<entt::coroutine_process>(frames, std::ref(counter));
+
+    ASSERT_EQ(counter, 0);
+
+    scheduler.update(0u);
+
+    ASSERT_EQ(counter, 1);
+
+    scheduler.update(0u);
+
+    ASSERT_EQ(counter, 2);
+    ASSERT_FALSE(scheduler.empty());
+
+    scheduler.update(0u);
+
+    ASSERT_EQ(counter, 3);
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, Delay) {
+    entt::scheduler scheduler{};
+    int counter{};
+
+    scheduler.attach<entt::coroutine_process>(sleep(counter, 5u));
+    scheduler.update(0u);
+
+    ASSERT_EQ(scheduler.sleeping(), 1u);
+
+    scheduler.update(2u);
+    scheduler.update(2u);
+
+    ASSERT_EQ(counter, 0);
+    ASSERT_FALSE(scheduler.empty());
+
+    scheduler.update(1u);
+
+    ASSERT_EQ(counter, 1);
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, Event) {
+    entt::scheduler scheduler{};
+    entt::co_event<int> event{};
+    int value{};
+
+    scheduler.attach<entt::coroutine_process>(listen, std::ref(event), std::ref(value));
+    scheduler.update(0u);
+    scheduler.update(0u);
+
+    ASSERT_FALSE(event.ready());
+    ASSERT_EQ(value, 0);
+
+    event.publish(2);
+
+    ASSERT_TRUE(event.ready());
+
+    scheduler.update(0u);
+
+    ASSERT_FALSE(event.ready());
+    ASSERT_EQ(value, 2);
+
+    scheduler.update(0u);
+    event.publish(3);
+    scheduler.update(0u);
+
+    ASSERT_EQ(value, 5);
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, Then) {
+    entt::scheduler scheduler{};
+    int counter{};
+
+    scheduler.attach<entt::coroutine_process>(frames, std::ref(counter))
+        .then<entt::coroutine_process>(sleep(counter, 1u));
+
+    while(!scheduler.empty()) {
+        scheduler.update(1u);
+    }
+
+    ASSERT_EQ(counter, 4);
+}
+
+TEST(Coroutine, Abort) {
+    entt::scheduler scheduler{};
+    int counter{};
+
+    scheduler.attach<entt::coroutine_process>(frames, std::ref(counter));
+    scheduler.update(0u);
+    scheduler.abort(true);
+    scheduler.update(0u);
+
+    ASSERT_EQ(counter, 1);
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, Allocator) {
+    using allocator_type = entt::page_pool_allocator<void>;
+    entt::basic_scheduler<std::uint32_t, allocator_type> scheduler{};
+    const auto pool = scheduler.get_allocator().resource();
+    int counter{};
+
+    scheduler.attach<entt::basic_coroutine_process<std::uint32_t, allocator_type>>(arena<allocator_type>, std::ref(counter));
+    scheduler.update(0u);
+
+    ASSERT_EQ(pool->size(), 0u);
+
+    scheduler.update(0u);
+
+    ASSERT_EQ(counter, 1);
+    ASSERT_TRUE(scheduler.empty());
+    // both the process and its coroutine frame return to the pool
+    ASSERT_EQ(pool->size(), 2u);
+}
+
+ENTT_DEBUG_TEST(CoroutineDeathTest, Coroutine) {
+    entt::coroutine coro{};
+
+    ASSERT_DEATH(coro.resume(0u), "");
+    ASSERT_DEATH(entt::coroutine_process(std::allocator<void>{}, entt::coroutine{}), "");
+}
+
+#endif
@@ -43,6 +43,11 @@ TEST(Process, Basics) {
     ASSERT_FALSE(process.finished());
     ASSERT_FALSE(process.paused());
     ASSERT_FALSE(process.rejected());
+    ASSERT_EQ(process.cost(), 1u);
+
+    process.cost(3u);
+
+    ASSERT_EQ(process.cost(), 3u);
 
     process.succeed();
     process.fail();
@@ -186,6 +191,29 @@ TEST(Process, AbortImmediately) {
     ASSERT_TRUE(process.aborted_invoked);
 }
 
+TEST(Process, Sleep) {
+    test_process<int> process{};
+
+    process.sleep(3);
+
+    ASSERT_TRUE(process.sleeping());
+
+    process.tick(2);
+
+    ASSERT_TRUE(process.sleeping());
+    ASSERT_FALSE(process.update_invoked);
+
+    process.tick(1);
+
+    ASSERT_FALSE(process.sleeping());
+    ASSERT_TRUE(process.update_invoked);
+
+    process.succeed();
+    process.sleep(3);
+
+    ASSERT_FALSE(process.sleeping());
+}
+
 TEST(Process, ThenPeek) {
     test_process<int> process{};
 
@@ -1,6 +1,13 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <thread>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/process/process.hpp>
 #include <entt/process/scheduler.hpp>
@@ -193,6 +200,267 @@ TEST(Scheduler, SpawningProcess) {
     ASSERT_EQ(counter.second, 1u);
 }
 
+TEST(Scheduler, Sleep) {
+    entt::scheduler scheduler{};
+    int ticks{};
+
+    scheduler.attach([&ticks](entt::process &proc, std::uint32_t, void *) {
+        ++ticks;
+        proc.sleep(10u);
+    });
+
+    scheduler.update(0u);
+
+    ASSERT_EQ(ticks, 1);
+    ASSERT_EQ(scheduler.size(), 1u);
+    ASSERT_EQ(scheduler.sleeping(), 1u);
+    ASSERT_FALSE(scheduler.empty());
+
+    for(int pos{}; pos < 9; ++pos) {
+        scheduler.update(1u);
+    }
+
+    ASSERT_EQ(ticks, 1);
+
+    scheduler.update(1u);
+
+    ASSERT_EQ(ticks, 2);
+    ASSERT_EQ(scheduler.sleeping(), 1u);
+
+    scheduler.update(25u);
+
+    ASSERT_EQ(ticks, 3);
+
+    scheduler.clear();
+
+    ASSERT_TRUE(scheduler.empty());
+    ASSERT_EQ(scheduler.sleeping(), 0u);
+}
+
+TEST(Scheduler, SleepWheel) {
+    entt::scheduler scheduler{};
+    const std::vector<std::uint32_t> delay{1u, 63u, 64u, 65u, 4095u, 4096u, 4097u, 100000u, 262143u, 1u << 30u};
+    const std::vector<std::uint32_t> step{1u, 7u, 300u, 5000u, 123457u, 9999999u};
+    std::vector<std::uint64_t> woken(delay.size());
+    std::uint64_t elapsed{};
+
+    for(std::size_t pos{}; pos < delay.size(); ++pos) {
+        scheduler.attach([&, pos, first = true](entt::process &proc, std::uint32_t, void *) mutable {
+            if(std::exchange(first, false)) {
+                proc.sleep(delay[pos]);
+            } else {
+                woken[pos] = elapsed;
+                proc.succeed();
+            }
+        });
+    }
+
+    scheduler.update(0u);
+
+    ASSERT_EQ(scheduler.sleeping(), delay.size());
+
+    for(std::size_t pos{}; !scheduler.empty(); ++pos) {
+        elapsed += step[pos % step.size()];
+        scheduler.update(step[pos % step.size()]);
+    }
+
+    for(std::size_t pos{}; pos < delay.size(); ++pos) {
+        std::uint64_t expected{};
+
+        for(std::size_t next{}; expected < delay[pos]; ++next) {
+            expected += step[next % step.size()];
+        }
+
+        ASSERT_EQ(woken[pos], expected);
+    }
+}
+
+TEST(Scheduler, SleepFloatingPoint) {
+    entt::basic_scheduler<float> scheduler{};
+    int ticks{};
+
+    scheduler.attach([&ticks](entt::basic_process<float> &proc, float, void *) {
+        ++ticks;
+        proc.sleep(1.5f);
+    });
+
+    scheduler.update(.25f);
+
+    for(int pos{}; pos < 5; ++pos) {
+        scheduler.update(.25f);
+    }
+
+    ASSERT_EQ(ticks, 1);
+
+    scheduler.update(.25f);
+
+    ASSERT_EQ(ticks, 2);
+}
+
+TEST(Scheduler, SleepAbort) {
+    entt::scheduler scheduler{};
+    int updated{};
+    bool aborted{};
+
+    auto &process = scheduler.attach<foo_process>([&updated]() { ++updated; }, [&aborted]() { aborted = true; });
+    scheduler.update(1u);
+    process.sleep(100u);
+    scheduler.update(1u);
+    scheduler.update(1u);
+
+    ASSERT_EQ(updated, 1);
+    ASSERT_EQ(scheduler.sleeping(), 1u);
+
+    scheduler.abort(true);
+
+    ASSERT_EQ(updated, 1);
+    ASSERT_TRUE(aborted);
+    ASSERT_EQ(scheduler.sleeping(), 0u);
+
+    scheduler.update(1u);
+
+    ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Scheduler, UpdateWithExecutor) {
+    entt::scheduler scheduler{};
+    std::atomic<int> succeeded{};
+    std::atomic<int> failed{};
+    std::size_t chunks{};
+
+    const auto executor = [&chunks](const std::size_t count, auto job) {
+        std::vector<std::thread> workers{};
+        chunks = count;
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            workers.emplace_back(job, pos);
+        }
+
+        for(auto &&elem: workers) {
+            elem.join();
+        }
+    };
+
+    for(int pos{}; pos < 10; ++pos) {
+        scheduler
+            .attach([&succeeded](entt::process &proc, std::uint32_t, void *) {
+                ++succeeded;
+                proc.succeed();
+            })
+            .then([&failed, pos](entt::process &proc, std::uint32_t, void *) {
+                ++failed;
+                (pos % 2) == 0 ? proc.fail() : proc.succeed();
+            })
+            .then([&succeeded](entt::process &proc, std::uint32_t, void *) {
+                ++succeeded;
+                proc.succeed();
+            });
+    }
+
+    scheduler.update(executor, 4u, 0u);
+
+    ASSERT_EQ(chunks, 3u);
+    ASSERT_EQ(succeeded, 10);
+    ASSERT_EQ(failed, 0);
+    ASSERT_EQ(scheduler.size(), 10u);
+
+    scheduler.update(executor, 4u, 0u);
+
+    ASSERT_EQ(failed, 10);
+    ASSERT_EQ(scheduler.size(), 5u);
+
+    while(!scheduler.empty()) {
+        scheduler.update(executor, 4u, 0u);
+    }
+
+    ASSERT_EQ(chunks, 2u);
+    ASSERT_EQ(succeeded, 15);
+}
+
+TEST(Scheduler, UpdateSliced) {
+    entt::scheduler scheduler{};
+    std::array<std::uint32_t, 4u> elapsed{};
+    std::array<std::size_t, 4u> ticks{};
+
+    for(std::size_t pos{}; pos < elapsed.size(); ++pos) {
+        scheduler.attach([&elapsed, &ticks, pos](entt::process &, std::uint32_t delta, void *) {
+            elapsed[pos] += delta;
+            ++ticks[pos];
+        });
+    }
+
+    scheduler.attach([](entt::process &proc, std::uint32_t, void *) { proc.succeed(); }).cost(2u);
+    scheduler.update_sliced(2u, 1u);
+
+    ASSERT_EQ(ticks, (std::array<std::size_t, 4u>{1u, 1u, 0u, 0u}));
+    ASSERT_EQ(elapsed, (std::array<std::uint32_t, 4u>{1u, 1u, 0u, 0u}));
+
+    scheduler.update_sliced(2u, 1u);
+
+    // processes receive all the time elapsed since their last update
+    ASSERT_EQ(ticks, (std::array<std::size_t, 4u>{1u, 1u, 1u, 1u}));
+    ASSERT_EQ(elapsed, (std::array<std::uint32_t, 4u>{1u, 1u, 2u, 2u}));
+
+    scheduler.update_sliced(2u, 1u);
+
+    ASSERT_EQ(scheduler.size(), 4u);
+    ASSERT_EQ(ticks, (std::array<std::size_t, 4u>{1u, 1u, 1u, 1u}));
+
+    // at least one process is updated in any case
+    scheduler.update_sliced(0u, 1u);
+
+    ASSERT_EQ(ticks, (std::array<std::size_t, 4u>{2u, 1u, 1u, 1u}));
+    ASSERT_EQ(elapsed, (std::array<std::uint32_t, 4u>{4u, 1u, 2u, 2u}));
+
+    scheduler.update_sliced(std::chrono::seconds{1}, 1u);
+
+    ASSERT_EQ(ticks, (std::array<std::size_t, 4u>{3u, 2u, 2u, 2u}));
+    ASSERT_EQ(elapsed, (std::array<std::uint32_t, 4u>{5u, 5u, 5u, 5u}));
+
+    scheduler.update_sliced(std::chrono::seconds{0}, 1u);
+
+    ASSERT_EQ(ticks, (std::array<std::size_t, 4u>{3u, 3u, 2u, 2u}));
+    ASSERT_EQ(elapsed, (std::array<std::uint32_t, 4u>{5u, 6u, 5u, 5u}));
+}
+
+TEST(Scheduler, SleepWithExecutor) {
+    entt::scheduler scheduler{};
+    const auto executor = [](const std::size_t count, auto job) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            job(pos);
+        }
+    };
+
+    int ticks{};
+
+    for(int pos{}; pos < 4; ++pos) {
+        scheduler.attach([&ticks](entt::process &proc, std::uint32_t, void *) {
+            ++ticks;
+            proc.sleep(5u);
+        });
+    }
+
+    scheduler.update(executor, 2u, 0u);
+
+    ASSERT_EQ(ticks, 4);
+    ASSERT_EQ(scheduler.sleeping(), 4u);
+
+    scheduler.update(executor, 2u, 4u);
+
+    ASSERT_EQ(ticks, 4);
+
+    scheduler.update(executor, 2u, 1u);
+
+    ASSERT_EQ(ticks, 8);
+    ASSERT_EQ(scheduler.size(), 4u);
+}
+
+ENTT_DEBUG_TEST(SchedulerDeathTest, UpdateWithExecutor) {
+    entt::scheduler scheduler{};
+
+    ASSERT_DEATH(scheduler.update([](std::size_t, auto) {}, 0u, 0u), "");
+}
+
 TEST(Scheduler, CustomAllocator) {
     const std::allocator<void> allocator{};
     entt::scheduler scheduler{allocator};
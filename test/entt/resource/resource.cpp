@@ -70,6 +70,19 @@ TEST(Resource, Functionalities) {
     ASSERT_NE(copy, move);
 }
 
+TEST(Resource, Pending) {
+    const entt::resource<derived> resource{std::shared_ptr<derived>{std::make_shared<int>(), nullptr}};
+
+    ASSERT_FALSE(resource);
+    ASSERT_TRUE(resource.pending());
+    ASSERT_FALSE(entt::resource<derived>{}.pending());
+    ASSERT_FALSE(entt::resource<derived>{std::make_shared<derived>()}.pending());
+
+    const entt::resource<base> other{resource};
+
+    ASSERT_TRUE(other.pending());
+}
+
 TEST(Resource, Swap) {
     entt::resource<int> resource{};
     entt::resource<int> other{};
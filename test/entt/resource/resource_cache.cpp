@@ -1,7 +1,13 @@
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <thread>
 #include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/container/dense_map.hpp>
 #include <entt/core/hashed_string.hpp>
@@ -33,6 +39,17 @@ struct loader {
     }
 };
 
+struct texture {
+    std::size_t bytes;
+};
+
+template<>
+struct entt::resource_cost<texture> {
+    [[nodiscard]] std::size_t operator()(const texture &elem) const noexcept {
+        return elem.bytes;
+    }
+};
+
 TEST(ResourceCache, Functionalities) {
     using namespace entt::literals;
 
@@ -322,6 +339,118 @@ TEST(ResourceCache, Load) {
     ASSERT_EQ(it->second, 3);
 }
 
+TEST(ResourceCache, LoadAsync) {
+    using namespace entt::literals;
+
+    entt::resource_cache<int> cache;
+    std::vector<std::function<void()>> tasks{};
+    const auto executor = [&tasks](auto task) { tasks.emplace_back(std::move(task)); };
+    std::vector<entt::id_type> loaded{};
+    typename entt::resource_cache<int>::iterator it;
+    bool result{};
+
+    cache.on_load().connect<&std::vector<entt::id_type>::emplace_back<const entt::id_type &>>(loaded);
+
+    std::tie(it, result) = cache.load_async("resource"_hs, executor, 1);
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(tasks.size(), 1u);
+    ASSERT_EQ(it->first, "resource"_hs);
+    ASSERT_TRUE(cache.contains("resource"_hs));
+    ASSERT_FALSE(cache["resource"_hs]);
+    ASSERT_TRUE(cache["resource"_hs].pending());
+
+    std::tie(it, result) = cache.load_async("resource"_hs, executor, 2);
+
+    ASSERT_FALSE(result);
+    ASSERT_EQ(tasks.size(), 1u);
+
+    cache.load_async("other"_hs, executor, 3);
+    cache.load_async("erased"_hs, executor, 4);
+    cache.erase("erased"_hs);
+
+    cache.update();
+
+    ASSERT_TRUE(loaded.empty());
+    ASSERT_TRUE(cache["resource"_hs].pending());
+
+    for(auto &&task: tasks) {
+        task();
+    }
+
+    cache.update();
+
+    ASSERT_EQ(loaded.size(), 2u);
+    ASSERT_FALSE(cache.contains("erased"_hs));
+    ASSERT_FALSE(cache["resource"_hs].pending());
+    ASSERT_EQ(cache["resource"_hs], 1);
+    ASSERT_EQ(cache["other"_hs], 3);
+
+    cache.update();
+
+    ASSERT_EQ(loaded.size(), 2u);
+}
+
+TEST(ResourceCache, LoadAsyncThread) {
+    using namespace entt::literals;
+
+    entt::resource_cache<int> cache;
+    std::thread worker{};
+
+    cache.load_async("resource"_hs, [&worker](auto task) { worker = std::thread{std::move(task)}; }, 2);
+    worker.join();
+    cache.update();
+
+    ASSERT_EQ(cache["resource"_hs], 2);
+}
+
+TEST(ResourceCache, LoadAsyncForceLoad) {
+    using namespace entt::literals;
+
+    entt::resource_cache<int> cache;
+    std::function<void()> task{};
+
+    cache.load_async("resource"_hs, [&task](auto func) { task = std::move(func); }, 1);
+    cache.force_load("resource"_hs, 2);
+    task();
+    cache.update();
+
+    ASSERT_EQ(cache["resource"_hs], 2);
+}
+
+TEST(ResourceCache, LoadMany) {
+    entt::resource_cache<std::pair<entt::id_type, int>> cache;
+    const std::vector<entt::id_type> ids{entt::id_type{1}, entt::id_type{3}, entt::id_type{1}, entt::id_type{2}};
+
+    cache.load(entt::id_type{2}, entt::id_type{0}, 0);
+
+    ASSERT_EQ(cache.load_many(ids.begin(), ids.end(), 4), 2u);
+    ASSERT_EQ(cache.size(), 3u);
+    ASSERT_EQ(*cache[entt::id_type{1}], (std::pair<entt::id_type, int>{1, 4}));
+    ASSERT_EQ(*cache[entt::id_type{2}], (std::pair<entt::id_type, int>{0, 0}));
+    ASSERT_EQ(*cache[entt::id_type{3}], (std::pair<entt::id_type, int>{3, 4}));
+
+    ASSERT_EQ(cache.load_many(ids.begin(), ids.end(), 2), 0u);
+    ASSERT_EQ(cache.size(), 3u);
+}
+
+TEST(ResourceCache, LoadManyAsync) {
+    entt::resource_cache<entt::id_type> cache;
+    const std::vector<entt::id_type> ids{entt::id_type{1}, entt::id_type{3}, entt::id_type{1}};
+    std::vector<std::function<void()>> tasks{};
+
+    cache.load(entt::id_type{3});
+
+    ASSERT_EQ(cache.load_many_async(ids.begin(), ids.end(), [&tasks](auto task) { tasks.emplace_back(std::move(task)); }), 1u);
+    ASSERT_EQ(tasks.size(), 1u);
+    ASSERT_TRUE(cache[entt::id_type{1}].pending());
+
+    tasks.front()();
+    cache.update();
+
+    ASSERT_EQ(*cache[entt::id_type{1}], entt::id_type{1});
+}
+
 TEST(ResourceCache, Erase) {
     constexpr std::size_t resource_count = 5u;
     entt::resource_cache<std::size_t> cache;
@@ -412,6 +541,156 @@ TEST(ResourceCache, BrokenLoader) {
     ASSERT_TRUE(cache["resource"_hs]);
 }
 
+TEST(ResourceCache, BrokenAsyncLoader) {
+    using namespace entt::literals;
+
+    entt::resource_cache<int, loader<int>> cache;
+    const auto executor = [](auto task) { task(); };
+
+    cache.load_async("resource"_hs, executor, test::empty{});
+    cache.update();
+
+    ASSERT_TRUE(cache.contains("resource"_hs));
+    ASSERT_FALSE(cache["resource"_hs]);
+    ASSERT_FALSE(cache["resource"_hs].pending());
+}
+
+TEST(ResourceCache, Budget) {
+    entt::resource_cache<texture> cache;
+
+    ASSERT_EQ(cache.budget(), (std::numeric_limits<std::size_t>::max)());
+    ASSERT_EQ(cache.memory_usage(), 0u);
+
+    cache.load(entt::id_type{1}, texture{4u});
+    cache.load(entt::id_type{2}, texture{4u});
+    cache.load(entt::id_type{3}, texture{4u});
+
+    ASSERT_EQ(cache.memory_usage(), 12u);
+    ASSERT_EQ(cache.evict(), 0u);
+
+    // least recently used first, unless referenced elsewhere
+    const auto handle = cache[entt::id_type{1}];
+
+    {
+        [[maybe_unused]] const auto other = cache[entt::id_type{2}];
+        cache.budget(8u);
+    }
+
+    ASSERT_EQ(cache.budget(), 8u);
+    ASSERT_EQ(cache.memory_usage(), 8u);
+    ASSERT_TRUE(cache.contains(entt::id_type{1}));
+    ASSERT_TRUE(cache.contains(entt::id_type{2}));
+    ASSERT_FALSE(cache.contains(entt::id_type{3}));
+
+    const auto [it, result] = cache.load(entt::id_type{4}, texture{4u});
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(it->first, entt::id_type{4});
+    ASSERT_EQ(cache.memory_usage(), 8u);
+    ASSERT_TRUE(cache.contains(entt::id_type{1}));
+    ASSERT_FALSE(cache.contains(entt::id_type{2}));
+
+    // resources that don't fit are kept if there is nothing else to evict
+    cache.force_load(entt::id_type{1}, texture{16u});
+
+    ASSERT_EQ(cache.memory_usage(), 16u);
+    ASSERT_TRUE(cache.contains(entt::id_type{1}));
+    ASSERT_FALSE(cache.contains(entt::id_type{4}));
+    ASSERT_EQ(handle->bytes, 4u);
+
+    cache.erase(entt::id_type{1});
+
+    ASSERT_EQ(cache.memory_usage(), 0u);
+
+    cache.budget(32u);
+    cache.load(entt::id_type{5}, texture{4u});
+    cache.load(entt::id_type{6}, texture{4u});
+    cache.erase(cache.begin(), cache.end());
+
+    ASSERT_EQ(cache.memory_usage(), 0u);
+
+    cache.load(entt::id_type{7}, texture{4u});
+    cache.clear();
+
+    ASSERT_EQ(cache.memory_usage(), 0u);
+}
+
+TEST(ResourceCache, BudgetAsync) {
+    entt::resource_cache<texture> cache;
+    const auto executor = [](auto task) { task(); };
+
+    cache.budget(4u);
+    cache.load(entt::id_type{1}, texture{4u});
+    cache.load_async(entt::id_type{2}, executor, texture{4u});
+
+    ASSERT_EQ(cache.memory_usage(), 4u);
+
+    cache.update();
+
+    ASSERT_EQ(cache.memory_usage(), 4u);
+    ASSERT_FALSE(cache.contains(entt::id_type{1}));
+    ASSERT_TRUE(cache.contains(entt::id_type{2}));
+}
+
+TEST(ResourceCache, Slot) {
+    using slot_type = entt::resource_slot<texture>;
+
+    static_assert(std::is_trivially_copyable_v<slot_type>, "Trivially copyable type required");
+    static_assert(sizeof(slot_type) == 2u * sizeof(std::uint32_t), "Unexpected size");
+
+    entt::resource_cache<texture> cache;
+    cache.budget(8u);
+
+    ASSERT_FALSE(cache.slot(entt::id_type{1}));
+    ASSERT_EQ(cache.resolve(slot_type{}), nullptr);
+
+    cache.load(entt::id_type{1}, texture{4u});
+    cache.load(entt::id_type{2}, texture{4u});
+
+    const auto slot = cache.slot(entt::id_type{1});
+    const auto other = cache.slot(entt::id_type{2});
+
+    ASSERT_TRUE(slot);
+    ASSERT_EQ(slot, cache.slot(entt::id_type{1}));
+    ASSERT_NE(slot, other);
+    ASSERT_EQ(cache.resolve(slot), &*cache[entt::id_type{1}]);
+    ASSERT_EQ(std::as_const(cache).resolve(other)->bytes, 4u);
+
+    ASSERT_TRUE(cache.pin(slot));
+
+    // pinned resources are never evicted, the others are invalidated
+    static_cast<void>(cache[entt::id_type{2}]);
+    cache.load(entt::id_type{3}, texture{4u});
+
+    ASSERT_TRUE(cache.contains(entt::id_type{1}));
+    ASSERT_FALSE(cache.contains(entt::id_type{2}));
+    ASSERT_EQ(cache.resolve(other), nullptr);
+    ASSERT_FALSE(cache.pin(other));
+
+    cache.unpin(slot);
+    static_cast<void>(cache[entt::id_type{3}]);
+    cache.load(entt::id_type{4}, texture{4u});
+
+    ASSERT_FALSE(cache.contains(entt::id_type{1}));
+    ASSERT_EQ(cache.resolve(slot), nullptr);
+
+    // released slots are recycled with a new generation
+    const auto recycled = cache.slot(entt::id_type{4});
+
+    ASSERT_NE(recycled, slot);
+    ASSERT_NE(recycled, other);
+    ASSERT_EQ(cache.resolve(recycled)->bytes, 4u);
+
+    cache.force_load(entt::id_type{4}, texture{2u});
+
+    ASSERT_EQ(cache.resolve(recycled), nullptr);
+
+    const auto last = cache.slot(entt::id_type{3});
+    cache.clear();
+
+    ASSERT_EQ(cache.resolve(last), nullptr);
+}
+
 TEST(ResourceCache, ThrowingAllocator) {
     using namespace entt::literals;
 
@@ -1,5 +1,8 @@
+#include <cstdint>
 #include <memory>
 #include <gtest/gtest.h>
+#include <entt/core/slab_pool.hpp>
+#include <entt/resource/cache.hpp>
 #include <entt/resource/loader.hpp>
 
 TEST(ResourceLoader, Functionalities) {
@@ -11,3 +14,42 @@ TEST(ResourceLoader, Functionalities) {
     ASSERT_TRUE(resource);
     ASSERT_EQ(*resource, 4);
 }
+
+TEST(SlabResourceLoader, Functionalities) {
+    using loader_type = entt::slab_resource_loader<int>;
+    const loader_type loader{};
+    const auto pool = loader.get_allocator().resource();
+
+    testing::StaticAssertTypeEq<typename loader_type::result_type, std::shared_ptr<int>>();
+
+    auto resource = loader(4);
+    const auto other = loader_type{loader}(2);
+
+    ASSERT_TRUE(resource);
+    ASSERT_EQ(*resource, 4);
+    ASSERT_EQ(*other, 2);
+    ASSERT_EQ(pool->size(), 2u);
+    ASSERT_EQ(pool->chunks(), 1u);
+
+    resource.reset();
+
+    ASSERT_EQ(pool->size(), 1u);
+}
+
+TEST(SlabResourceLoader, Cache) {
+    const auto pool = std::make_shared<entt::slab_pool>(16u);
+    entt::resource_cache<std::uint64_t, entt::slab_resource_loader<std::uint64_t>> cache{entt::slab_resource_loader<std::uint64_t>{entt::slab_pool_allocator<std::uint64_t>{pool}}};
+
+    for(std::uint64_t next{}; next < 32u; ++next) {
+        cache.load(static_cast<entt::id_type>(next), next);
+    }
+
+    ASSERT_EQ(cache.size(), 32u);
+    ASSERT_EQ(pool->size(), 32u);
+    ASSERT_EQ(pool->chunks(), 2u);
+    ASSERT_EQ(*cache[entt::id_type{3}], 3u);
+
+    cache.clear();
+
+    ASSERT_EQ(pool->size(), 0u);
+}
@@ -0,0 +1,143 @@
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/signal/concurrent_sigh.hpp>
+#include "../../common/config.h"
+
+struct concurrent_listener {
+    static void f(int &value) {
+        ++value;
+    }
+
+    void g(int &value) {
+        value += 10;
+        ++count;
+    }
+
+    [[nodiscard]] int h(int &) const {
+        return count;
+    }
+
+    std::atomic<int> count{};
+};
+
+TEST(ConcurrentSigH, Functionalities) {
+    entt::concurrent_sigh<void(int &)> sigh{};
+    entt::sink sink{sigh};
+    concurrent_listener listener{};
+    int value{};
+
+    ASSERT_TRUE(sigh.empty());
+    ASSERT_TRUE(sink.empty());
+    ASSERT_EQ(sigh.size(), 0u);
+
+    sigh.publish(value);
+
+    ASSERT_EQ(value, 0);
+
+    sink.connect<&concurrent_listener::f>();
+    sink.connect<&concurrent_listener::f>();
+    sink.connect<&concurrent_listener::g>(listener);
+
+    ASSERT_FALSE(sigh.empty());
+    ASSERT_EQ(sigh.size(), 2u);
+
+    sigh.publish(value);
+
+    ASSERT_EQ(value, 11);
+    ASSERT_EQ(listener.count, 1);
+
+    sink.disconnect<&concurrent_listener::f>();
+    sigh.publish(value);
+
+    ASSERT_EQ(sigh.size(), 1u);
+    ASSERT_EQ(value, 21);
+
+    sink.disconnect(&listener);
+
+    ASSERT_TRUE(sigh.empty());
+
+    sink.connect<&concurrent_listener::f>();
+    sink.connect<&concurrent_listener::g>(&listener);
+    sink.disconnect<&concurrent_listener::g>(&listener);
+
+    ASSERT_EQ(sigh.size(), 1u);
+
+    sink.disconnect();
+
+    ASSERT_TRUE(sigh.empty());
+    ASSERT_EQ(sigh.get_allocator(), std::allocator<void>{});
+}
+
+TEST(ConcurrentSigH, Connection) {
+    entt::concurrent_sigh<void(int &)> sigh{};
+    int value{};
+
+    {
+        const entt::scoped_connection conn{entt::sink{sigh}.connect<&concurrent_listener::f>()};
+        sigh.publish(value);
+
+        ASSERT_EQ(value, 1);
+    }
+
+    sigh.publish(value);
+
+    ASSERT_TRUE(sigh.empty());
+    ASSERT_EQ(value, 1);
+}
+
+TEST(ConcurrentSigH, Collector) {
+    entt::concurrent_sigh<int(int &)> sigh{};
+    concurrent_listener listener{};
+    std::vector<int> result{};
+    int value{};
+
+    listener.count = 3;
+    entt::sink{sigh}.connect<&concurrent_listener::h>(listener);
+    sigh.collect([&result](int elem) { result.push_back(elem); }, value);
+
+    ASSERT_EQ(result, std::vector<int>{3});
+}
+
+TEST(ConcurrentSigH, Threads) {
+    entt::concurrent_sigh<void(int &)> sigh{};
+    concurrent_listener listener{};
+    std::atomic<bool> done{};
+
+    std::thread publisher{[&]() {
+        while(!done) {
+            int value{};
+            sigh.publish(value);
+        }
+    }};
+
+    std::thread other{[&]() {
+        while(!done) {
+            int value{};
+            sigh.publish(value);
+        }
+    }};
+
+    for(std::size_t pos{}; pos < 1000u; ++pos) {
+        entt::sink{sigh}.connect<&concurrent_listener::g>(listener);
+        entt::sink{sigh}.connect<&concurrent_listener::f>();
+        entt::sink{sigh}.disconnect(&listener);
+        entt::sink{sigh}.disconnect<&concurrent_listener::f>();
+    }
+
+    done = true;
+    publisher.join();
+    other.join();
+
+    ASSERT_TRUE(sigh.empty());
+}
+
+ENTT_DEBUG_TEST(ConcurrentSigHDeathTest, Sink) {
+    entt::sink<entt::concurrent_sigh<void(int &)>> sink{};
+
+    ASSERT_FALSE(sink);
+    ASSERT_DEATH(sink.connect<&concurrent_listener::f>(), "");
+}
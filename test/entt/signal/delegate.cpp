@@ -1,3 +1,4 @@
+#include <array>
 #include <memory>
 #include <utility>
 #include <gtest/gtest.h>
@@ -464,3 +465,103 @@ TEST(Delegate, TheLessTheBetter) {
 
     ASSERT_EQ(unbound(functor, 3, 'c'), 6);
 }
+
+TEST(OwningDelegate, Functionalities) {
+    entt::owning_delegate<int(int)> delegate{};
+
+    ASSERT_FALSE(delegate);
+    ASSERT_EQ(delegate.data(), nullptr);
+
+    delegate = [value = 2](const int iv) { return iv * value; };
+
+    ASSERT_TRUE(delegate);
+    ASSERT_TRUE(delegate.in_place());
+    ASSERT_EQ(delegate(3), 6);
+
+    delegate.reset();
+
+    ASSERT_FALSE(delegate);
+    ASSERT_EQ(delegate.data(), nullptr);
+
+    delegate = &power_of_two;
+
+    ASSERT_TRUE(delegate);
+    ASSERT_EQ(delegate(3), 9);
+}
+
+ENTT_DEBUG_TEST(OwningDelegateDeathTest, InvokeEmpty) {
+    const entt::owning_delegate<int(int)> delegate{};
+
+    ASSERT_FALSE(delegate);
+    ASSERT_DEATH([[maybe_unused]] const int value = delegate(4), "");
+}
+
+TEST(OwningDelegate, Storage) {
+    const auto large = [data = std::array<int, 8u>{1, 2}](const int iv) { return data[0u] + data[1u] + iv; };
+    entt::basic_owning_delegate<int(int), 0u> heap{[](const int iv) { return iv; }};
+    entt::owning_delegate<int(int)> small{[](const int iv) { return iv; }};
+    entt::owning_delegate<int(int)> other{large};
+
+    ASSERT_FALSE(heap.in_place());
+    ASSERT_TRUE(small.in_place());
+    ASSERT_FALSE(other.in_place());
+
+    ASSERT_EQ(heap(3), 3);
+    ASSERT_EQ(small(3), 3);
+    ASSERT_EQ(other(3), 6);
+
+    const void *data = other.data();
+    entt::owning_delegate<int(int)> moved{std::move(other)};
+
+    ASSERT_FALSE(other);
+    ASSERT_EQ(moved.data(), data);
+    ASSERT_EQ(moved(3), 6);
+}
+
+TEST(OwningDelegate, CopyAndMove) {
+    entt::owning_delegate<int()> delegate{[value = 0]() mutable { return ++value; }};
+
+    ASSERT_EQ(delegate(), 1);
+
+    entt::owning_delegate<int()> copy{delegate};
+
+    ASSERT_EQ(delegate(), 2);
+    ASSERT_EQ(copy(), 2);
+
+    entt::owning_delegate<int()> move{std::move(copy)};
+
+    ASSERT_FALSE(copy);
+    ASSERT_EQ(move(), 3);
+
+    copy = move;
+
+    ASSERT_EQ(copy(), 4);
+    ASSERT_EQ(move(), 4);
+
+    delegate = std::move(move);
+
+    ASSERT_FALSE(move);
+    ASSERT_EQ(delegate(), 5);
+}
+
+TEST(OwningDelegate, MoveOnlyType) {
+    entt::owning_delegate<int()> delegate{[ptr = std::make_unique<int>(3)]() { return *ptr; }};
+    entt::owning_delegate<int()> copy{delegate};
+
+    ASSERT_TRUE(delegate);
+    ASSERT_FALSE(copy);
+
+    copy = std::move(delegate);
+
+    ASSERT_FALSE(delegate);
+    ASSERT_EQ(copy(), 3);
+}
+
+TEST(OwningDelegate, Delegate) {
+    entt::owning_delegate<int(int)> owner{[value = 3](const int iv) { return iv + value; }};
+    entt::delegate<int(int)> delegate{};
+
+    delegate.connect<&entt::owning_delegate<int(int)>::operator()>(owner);
+
+    ASSERT_EQ(delegate(1), 4);
+}
@@ -1,7 +1,12 @@
+#include <cstddef>
 #include <memory>
+#include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/hashed_string.hpp>
+#include <entt/core/monotonic_pool.hpp>
 #include <entt/signal/dispatcher.hpp>
 #include "../../common/empty.h"
 
@@ -10,6 +15,39 @@ struct non_aggregate {
     non_aggregate(int) {}
 };
 
+struct keyed_event {
+    int key;
+    int value;
+};
+
+struct message_event {
+    using allocator_type = entt::monotonic_pool_allocator<char>;
+
+    message_event(const char *str, const allocator_type &allocator)
+        : text{str, allocator} {}
+
+    message_event(message_event &&) noexcept = default;
+    message_event &operator=(message_event &&) noexcept = default;
+
+    std::basic_string<char, std::char_traits<char>, allocator_type> text;
+};
+
+struct message_collector {
+    void receive(message_event &event) {
+        ASSERT_NE(event.text.get_allocator().resource(), nullptr);
+        data.emplace_back(event.text.data(), event.text.size());
+
+        if(std::exchange(forward, false)) {
+            event.text.append("!");
+            dispatcher->enqueue<message_event>(event.text.c_str());
+        }
+    }
+
+    entt::dispatcher *dispatcher{};
+    std::vector<std::string> data{};
+    bool forward{true};
+};
+
 struct receiver {
     static void forward(entt::dispatcher &dispatcher, test::empty &event) {
         dispatcher.enqueue(event);
@@ -26,6 +64,37 @@ struct receiver {
     int cnt{0};
 };
 
+struct collector {
+    void receive(const int &value) {
+        data.push_back(value);
+    }
+
+    void keyed(const keyed_event &event) {
+        data.push_back(event.value);
+    }
+
+    void batch(entt::iterable_adaptor<int *> range) {
+        for(auto &&elem: range) {
+            data.push_back(elem);
+            elem = -elem;
+        }
+    }
+
+    void forward(entt::iterable_adaptor<int *> range) {
+        for(auto elem: range) {
+            data.push_back(elem);
+
+            // enough to force a reallocation of the other buffer
+            for(int pos{}; elem > 0 && pos < 64; ++pos) {
+                dispatcher->enqueue<int>(elem - 1);
+            }
+        }
+    }
+
+    entt::dispatcher *dispatcher{};
+    std::vector<int> data{};
+};
+
 TEST(Dispatcher, Functionalities) {
     entt::dispatcher dispatcher{};
     entt::dispatcher other{std::move(dispatcher)};
@@ -134,6 +203,25 @@ TEST(Dispatcher, StopAndGo) {
     ASSERT_EQ(receiver.cnt, 2);
 }
 
+TEST(Dispatcher, Reentrant) {
+    entt::dispatcher dispatcher{};
+    collector collector{};
+    const auto &value = collector.data;
+
+    dispatcher.batch_sink<int>().connect<&collector::forward>(collector);
+    dispatcher.enqueue<int>(1);
+    collector.dispatcher = &dispatcher;
+    dispatcher.update();
+
+    ASSERT_EQ(value.size(), 1u);
+    ASSERT_EQ(dispatcher.size<int>(), 64u);
+
+    dispatcher.update();
+
+    ASSERT_EQ(value.size(), 65u);
+    ASSERT_EQ(dispatcher.size<int>(), 0u);
+}
+
 TEST(Dispatcher, OpaqueDisconnect) {
     entt::dispatcher dispatcher{};
     receiver receiver{};
@@ -184,6 +272,203 @@ TEST(Dispatcher, NamedQueue) {
     ASSERT_EQ(receiver.cnt, 3);
 }
 
+TEST(Dispatcher, Batch) {
+    using namespace entt::literals;
+
+    entt::dispatcher dispatcher{};
+    collector listener{};
+    collector other{};
+    const auto &value = listener.data;
+
+    dispatcher.update<int>();
+    dispatcher.batch_sink<int>().connect<&collector::batch>(listener);
+    dispatcher.sink<int>().connect<&collector::receive>(other);
+
+    dispatcher.enqueue<int>(1);
+    dispatcher.enqueue<int>(2);
+    dispatcher.enqueue_hint<int>("named"_hs, 3);
+
+    ASSERT_TRUE(value.empty());
+
+    dispatcher.update();
+
+    ASSERT_EQ(value.size(), 2u);
+    ASSERT_EQ(value[0u], 1);
+    ASSERT_EQ(value[1u], 2);
+
+    // batch listeners come first
+    ASSERT_EQ(other.data.size(), 2u);
+    ASSERT_EQ(other.data[0u], -1);
+    ASSERT_EQ(other.data[1u], -2);
+
+    dispatcher.trigger(3);
+
+    ASSERT_EQ(value.size(), 3u);
+    ASSERT_EQ(value[2u], 3);
+
+    dispatcher.disconnect(listener);
+    dispatcher.enqueue<int>(4);
+    dispatcher.update<int>();
+
+    ASSERT_EQ(value.size(), 3u);
+    ASSERT_EQ(other.data.size(), 4u);
+}
+
+TEST(Dispatcher, Priority) {
+    using namespace entt::literals;
+
+    entt::dispatcher dispatcher{};
+    std::vector<int> value{};
+
+    dispatcher.sink<int>().connect<&std::vector<int>::emplace_back<int &>>(value);
+    dispatcher.sink<int>("named"_hs).connect<&std::vector<int>::emplace_back<int &>>(value);
+    dispatcher.sink<int>("other"_hs).connect<&std::vector<int>::emplace_back<int &>>(value);
+
+    const auto enqueue = [&dispatcher]() {
+        dispatcher.enqueue<int>(0);
+        dispatcher.enqueue_hint<int>("named"_hs, 1);
+        dispatcher.enqueue_hint<int>("other"_hs, 2);
+    };
+
+    enqueue();
+    dispatcher.update();
+
+    ASSERT_EQ(value, (std::vector<int>{0, 1, 2}));
+
+    dispatcher.priority<int>(1, "other"_hs);
+    dispatcher.priority<int>(-1);
+    value.clear();
+    enqueue();
+    dispatcher.update();
+
+    ASSERT_EQ(value, (std::vector<int>{2, 1, 0}));
+
+    dispatcher.priority<int>(1, "named"_hs);
+    value.clear();
+    enqueue();
+    dispatcher.update();
+
+    // queues that get a priority last come last
+    ASSERT_EQ(value, (std::vector<int>{2, 1, 0}));
+
+    entt::dispatcher other{std::move(dispatcher)};
+    value.clear();
+    other.enqueue<int>(0);
+    other.enqueue_hint<int>("named"_hs, 1);
+    other.update();
+
+    ASSERT_EQ(value, (std::vector<int>{1, 0}));
+}
+
+TEST(Dispatcher, Coalesce) {
+    entt::dispatcher dispatcher{};
+    collector listener{};
+    auto &value = listener.data;
+
+    dispatcher.sink<keyed_event>().connect<&collector::keyed>(listener);
+    dispatcher.coalesce<keyed_event, &keyed_event::key>();
+
+    dispatcher.enqueue<keyed_event>(0, 1);
+    dispatcher.enqueue<keyed_event>(1, 2);
+    dispatcher.enqueue(keyed_event{0, 3});
+    dispatcher.producer<keyed_event>().enqueue(1, 4);
+    dispatcher.producer<keyed_event>().enqueue(2, 5);
+
+    ASSERT_EQ(dispatcher.size<keyed_event>(), 4u);
+
+    dispatcher.update();
+
+    ASSERT_EQ(dispatcher.size<keyed_event>(), 0u);
+    ASSERT_EQ(value, (std::vector<int>{1, 2, 5}));
+
+    value.clear();
+    dispatcher.enqueue<keyed_event>(0, 6);
+    dispatcher.enqueue<keyed_event>(0, 7);
+    dispatcher.clear<keyed_event>();
+    dispatcher.enqueue<keyed_event>(0, 8);
+    dispatcher.trigger(keyed_event{0, 9});
+    dispatcher.update<keyed_event>();
+
+    ASSERT_EQ(value, (std::vector<int>{9, 8}));
+}
+
+TEST(Dispatcher, Producer) {
+    using namespace entt::literals;
+
+    entt::dispatcher dispatcher{};
+    collector collector{};
+    const auto &value = collector.data;
+
+    auto producer = dispatcher.producer<int>();
+    auto named = dispatcher.producer<non_aggregate>("named"_hs);
+
+    dispatcher.sink<int>().connect<&collector::receive>(collector);
+    dispatcher.enqueue<int>(0);
+    producer.enqueue(1);
+    producer.enqueue(2);
+    named.enqueue(3);
+
+    ASSERT_EQ(dispatcher.size<int>(), 3u);
+    ASSERT_EQ(dispatcher.size<non_aggregate>(), 0u);
+    ASSERT_EQ(dispatcher.size<non_aggregate>("named"_hs), 1u);
+    ASSERT_EQ(dispatcher.size(), 4u);
+
+    dispatcher.update<int>();
+
+    ASSERT_EQ(dispatcher.size(), 1u);
+    ASSERT_EQ(value.size(), 3u);
+    ASSERT_EQ(value[0u], 0);
+    ASSERT_EQ(value[1u], 1);
+    ASSERT_EQ(value[2u], 2);
+
+    producer.enqueue(3);
+    dispatcher.clear();
+    dispatcher.update();
+
+    ASSERT_EQ(dispatcher.size(), 0u);
+    ASSERT_EQ(value.size(), 3u);
+
+    producer.enqueue(4);
+}
+
+TEST(Dispatcher, ProducerThreads) {
+    constexpr std::size_t count = 4u;
+    constexpr int length = 1000;
+
+    entt::dispatcher dispatcher{};
+    collector collector{};
+    const auto &value = collector.data;
+    std::vector<std::thread> worker{};
+
+    dispatcher.sink<int>().connect<&collector::receive>(collector);
+
+    for(std::size_t pos{}; pos < count; ++pos) {
+        worker.emplace_back([producer = dispatcher.producer<int>(), pos]() {
+            for(int next{}; next < length; ++next) {
+                producer.enqueue(static_cast<int>(pos) * length + next);
+            }
+        });
+    }
+
+    while(value.size() != count * length) {
+        dispatcher.update();
+    }
+
+    for(auto &&elem: worker) {
+        elem.join();
+    }
+
+    std::vector<int> last(count, -1);
+
+    for(auto elem: value) {
+        // events from the same thread are delivered in order
+        ASSERT_LT(last[static_cast<std::size_t>(elem / length)], elem);
+        last[static_cast<std::size_t>(elem / length)] = elem;
+    }
+
+    ASSERT_EQ(dispatcher.size(), 0u);
+}
+
 TEST(Dispatcher, CustomAllocator) {
     const std::allocator<void> allocator{};
     entt::dispatcher dispatcher{allocator};
@@ -196,3 +481,35 @@ TEST(Dispatcher, CustomAllocator) {
 
     ASSERT_EQ(other.size<test::empty>(), 1u);
 }
+
+TEST(Dispatcher, Arena) {
+    entt::dispatcher dispatcher{};
+    const char *str = "a string long enough to be allocated on the heap";
+    message_collector listener{&dispatcher};
+
+    dispatcher.sink<message_event>().connect<&message_collector::receive>(listener);
+
+    for(std::size_t pos{}; pos < 32u; ++pos) {
+        dispatcher.enqueue<message_event>(str);
+    }
+
+    dispatcher.update<message_event>();
+
+    ASSERT_EQ(listener.data.size(), 32u);
+    ASSERT_EQ(listener.data.back(), str);
+    ASSERT_EQ(dispatcher.size<message_event>(), 1u);
+
+    // events enqueued by listeners outlive the arena of the previous update
+    dispatcher.update<message_event>();
+
+    ASSERT_EQ(listener.data.size(), 33u);
+    ASSERT_EQ(listener.data.back(), std::string{str} + "!");
+
+    dispatcher.enqueue<message_event>("other");
+    dispatcher.clear<message_event>();
+    dispatcher.enqueue<message_event>(str);
+    dispatcher.update();
+
+    ASSERT_EQ(listener.data.size(), 34u);
+    ASSERT_EQ(listener.data.back(), str);
+}
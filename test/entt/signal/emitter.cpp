@@ -167,3 +167,138 @@ TEST(Emitter, CustomAllocator) {
     ASSERT_TRUE(emitter.empty());
     ASSERT_FALSE(other.empty());
 }
+
+TEST(PooledEmitter, Functionalities) {
+    entt::emitter_context context{};
+    test::pooled_emitter emitter{context};
+    test::pooled_emitter other{context};
+    int value{};
+
+    ASSERT_TRUE(emitter.empty());
+    ASSERT_EQ(context.size(), 0u);
+    ASSERT_EQ(emitter.get_allocator(), context.get_allocator());
+
+    emitter.publish(test::boxed_int{1});
+    emitter.on<test::boxed_int>([&value](auto &event, const auto &) { value += event.value; });
+    other.on<test::boxed_int>([&value](auto &event, const auto &) { value -= event.value; });
+    other.on<test::empty>([](auto &, const auto &) {});
+
+    ASSERT_FALSE(emitter.empty());
+    ASSERT_TRUE(emitter.contains<test::boxed_int>());
+    ASSERT_FALSE(emitter.contains<test::empty>());
+    ASSERT_EQ(context.size(), 3u);
+
+    emitter.publish(test::boxed_int{3});
+
+    ASSERT_EQ(value, 3);
+
+    other.publish(test::boxed_int{1});
+
+    ASSERT_EQ(value, 2);
+
+    other.erase<test::empty>();
+
+    ASSERT_FALSE(other.contains<test::empty>());
+    ASSERT_FALSE(other.empty());
+    ASSERT_EQ(context.size(), 2u);
+
+    other.clear();
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(context.size(), 1u);
+
+    other.publish(test::boxed_int{1});
+
+    ASSERT_EQ(value, 2);
+}
+
+TEST(PooledEmitter, Lifetime) {
+    entt::emitter_context context{};
+    int value{};
+
+    {
+        test::pooled_emitter emitter{context};
+        emitter.on<test::boxed_int>([&value](auto &event, const auto &) { value = event.value; });
+
+        test::pooled_emitter other{std::move(emitter)};
+
+        test::is_initialized(emitter);
+
+        ASSERT_TRUE(emitter.empty());
+        ASSERT_FALSE(other.empty());
+        ASSERT_EQ(context.size(), 1u);
+
+        other.publish(test::boxed_int{1});
+
+        ASSERT_EQ(value, 1);
+
+        emitter = std::move(other);
+        emitter.publish(test::boxed_int{2});
+
+        ASSERT_EQ(value, 2);
+    }
+
+    ASSERT_EQ(context.size(), 0u);
+
+    // slots are recycled and start empty
+    test::pooled_emitter emitter{context};
+    emitter.on<test::empty>([](auto &, const auto &) {});
+
+    ASSERT_FALSE(emitter.contains<test::boxed_int>());
+    ASSERT_TRUE(emitter.contains<test::empty>());
+}
+
+TEST(PooledEmitter, Broadcast) {
+    entt::emitter_context context{};
+    test::pooled_emitter emitter{context};
+    test::pooled_emitter other{context};
+    test::pooled_emitter quiet{context};
+    const void *owner{};
+    int value{};
+
+    context.broadcast(test::boxed_int{1});
+
+    emitter.on<test::boxed_int>([&value](auto &event, const auto &) { value += event.value; });
+    other.on<test::boxed_int>([&value, &owner](auto &event, const auto &elem) {
+        value += event.value * 2;
+        owner = &elem;
+    });
+    quiet.on<test::empty>([](auto &, const auto &) { FAIL(); });
+
+    context.broadcast(test::boxed_int{1});
+
+    ASSERT_EQ(value, 3);
+    ASSERT_EQ(owner, &other);
+
+    test::pooled_emitter moved{std::move(other)};
+    context.broadcast(test::boxed_int{2});
+
+    ASSERT_EQ(value, 9);
+    ASSERT_EQ(owner, &moved);
+
+    moved.swap(emitter);
+    context.broadcast(test::boxed_int{1});
+
+    ASSERT_EQ(value, 12);
+    ASSERT_EQ(owner, &emitter);
+
+    emitter.erase<test::boxed_int>();
+    moved.clear();
+    context.broadcast(test::boxed_int{1});
+
+    ASSERT_EQ(value, 12);
+}
+
+TEST(PooledEmitter, ClearFromCallback) {
+    entt::emitter_context context{};
+    test::pooled_emitter emitter{context};
+
+    emitter.on<test::boxed_int>([](auto &, auto &owner) {
+        owner.template on<test::boxed_int>([](auto &, auto &) {});
+        owner.template erase<test::boxed_int>();
+    });
+
+    emitter.publish(test::boxed_int{1});
+
+    ASSERT_TRUE(emitter.empty());
+}
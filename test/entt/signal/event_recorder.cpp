@@ -0,0 +1,150 @@
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <entt/signal/event_recorder.hpp>
+#include "../../common/config.h"
+
+struct damage_event {
+    std::uint32_t target;
+    float amount;
+};
+
+struct listener {
+    void receive(const damage_event &event) {
+        data.push_back(event.target);
+    }
+
+    void forward(const int &value) {
+        values.push_back(value);
+
+        if(value > 0) {
+            target->enqueue_hint<int>(entt::hashed_string::value("named"), value - 1);
+        }
+    }
+
+    entt::dispatcher *target{};
+    std::vector<std::uint32_t> data{};
+    std::vector<int> values{};
+};
+
+TEST(EventRecorder, Constructors) {
+    static_assert(!std::is_copy_constructible_v<entt::event_recorder>, "Copy constructible type not allowed");
+    static_assert(!std::is_move_constructible_v<entt::event_recorder>, "Move constructible type not allowed");
+
+    const entt::event_recorder recorder{};
+
+    ASSERT_EQ(recorder.size(), 0u);
+}
+
+TEST(EventRecorder, Functionalities) {
+    entt::dispatcher dispatcher{};
+    entt::event_recorder recorder{};
+    listener receiver{};
+    std::size_t ticks{};
+
+    recorder.record<damage_event>(dispatcher);
+    dispatcher.sink<damage_event>().connect<&listener::receive>(receiver);
+
+    dispatcher.enqueue<damage_event>(1u, 2.f);
+    dispatcher.enqueue<damage_event>(2u, 2.f);
+    dispatcher.update();
+    recorder.tick();
+
+    ASSERT_NE(recorder.size(), 0u);
+    ASSERT_NE(recorder.data(), nullptr);
+
+    dispatcher.trigger(damage_event{3u, 1.f});
+    // events that aren't recorded don't end up in the log
+    dispatcher.trigger(4);
+    recorder.tick();
+
+    ASSERT_EQ(receiver.data, (std::vector<std::uint32_t>{1u, 2u, 3u}));
+
+    const auto size = recorder.size();
+    receiver.data.clear();
+    recorder.replay(dispatcher, [&]() { ++ticks; });
+
+    ASSERT_EQ(ticks, 2u);
+    ASSERT_EQ(recorder.size(), size);
+    ASSERT_EQ(receiver.data, (std::vector<std::uint32_t>{1u, 2u, 3u}));
+
+    recorder.stop(dispatcher);
+    dispatcher.trigger(damage_event{5u, 1.f});
+
+    ASSERT_EQ(recorder.size(), size);
+
+    recorder.clear();
+
+    ASSERT_EQ(recorder.size(), 0u);
+}
+
+TEST(EventRecorder, NamedQueue) {
+    using namespace entt::literals;
+
+    entt::dispatcher dispatcher{};
+    entt::event_recorder recorder{};
+    listener receiver{&dispatcher};
+
+    recorder.record<int>(dispatcher, "named"_hs);
+    dispatcher.sink<int>("named"_hs).connect<&listener::forward>(receiver);
+
+    dispatcher.enqueue_hint<int>("named"_hs, 1);
+    dispatcher.update();
+    recorder.tick();
+    dispatcher.update();
+    recorder.tick();
+
+    ASSERT_EQ(receiver.values, (std::vector<int>{1, 0}));
+
+    entt::dispatcher other{};
+    other.sink<int>("named"_hs).connect<&listener::forward>(receiver);
+    receiver.target = &other;
+    receiver.values.clear();
+    recorder.replay(other);
+
+    // events enqueued by listeners during a replay aren't delivered
+    ASSERT_EQ(receiver.values, (std::vector<int>{1, 0}));
+    ASSERT_EQ(other.size<int>("named"_hs), 1u);
+}
+
+TEST(EventRecorder, Bounded) {
+    entt::dispatcher dispatcher{};
+    entt::event_recorder recorder{256u};
+    listener receiver{};
+
+    recorder.record<damage_event>(dispatcher);
+    dispatcher.sink<damage_event>().connect<&listener::receive>(receiver);
+
+    for(std::uint32_t pos{}; pos < 64u; ++pos) {
+        dispatcher.trigger(damage_event{pos, 0.f});
+        recorder.tick();
+    }
+
+    ASSERT_LE(recorder.size(), 256u);
+
+    receiver.data.clear();
+    recorder.replay(dispatcher);
+
+    // only the latest events are retained
+    ASSERT_FALSE(receiver.data.empty());
+    ASSERT_EQ(receiver.data.back(), 63u);
+    ASSERT_EQ(receiver.data.front(), 64u - receiver.data.size());
+}
+
+ENTT_DEBUG_TEST(EventRecorderDeathTest, Bounded) {
+    entt::dispatcher dispatcher{};
+    entt::event_recorder recorder{32u};
+    const std::vector<damage_event> events(4u);
+
+    recorder.record<damage_event>(dispatcher);
+
+    for(auto &&elem: events) {
+        dispatcher.enqueue(elem);
+    }
+
+    ASSERT_DEATH(dispatcher.update(), "");
+}
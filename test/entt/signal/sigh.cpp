@@ -1,5 +1,6 @@
 #include <memory>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/signal/sigh.hpp>
 #include "../../common/config.h"
@@ -47,6 +48,10 @@ struct const_nonconst_noexcept {
     mutable int cnt{0};
 };
 
+void push_back(int &value, std::vector<int> &vec) {
+    vec.push_back(value);
+}
+
 void connect_and_auto_disconnect(entt::sigh<void(int &)> &sigh, const int &) {
     entt::sink sink{sigh};
     sink.connect<sigh_listener::f>();
@@ -137,6 +142,48 @@ TEST(SigH, Disconnect) {
     ASSERT_TRUE(sigh.empty());
 }
 
+TEST(SigH, InlineAndHeap) {
+    entt::sigh<void(std::vector<int> &)> sigh;
+    entt::sink sink{sigh};
+    int value[5u]{0, 1, 2, 3, 4};
+    std::vector<int> order{};
+
+    for(auto &&elem: value) {
+        sink.connect<&push_back>(elem);
+    }
+
+    ASSERT_EQ(sigh.size(), 5u);
+
+    sigh.publish(order);
+
+    ASSERT_EQ(order, (std::vector<int>{4, 3, 2, 1, 0}));
+
+    sink.disconnect(&value[1u]);
+    sink.disconnect(&value[3u]);
+    order.clear();
+    sigh.publish(order);
+
+    ASSERT_EQ(sigh.size(), 3u);
+    ASSERT_EQ(order, (std::vector<int>{2, 4, 0}));
+
+    entt::sigh<void(std::vector<int> &)> other{std::move(sigh)};
+    order.clear();
+    other.publish(order);
+
+    ASSERT_TRUE(sigh.empty());
+    ASSERT_EQ(other.size(), 3u);
+    ASSERT_EQ(order, (std::vector<int>{2, 4, 0}));
+
+    sigh = other;
+    entt::sink{other}.disconnect();
+    order.clear();
+    sigh.publish(order);
+    other.publish(order);
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(order, (std::vector<int>{2, 4, 0}));
+}
+
 TEST(SigH, Swap) {
     entt::sigh<void(int &)> sigh1;
     entt::sigh<void(int &)> sigh2;
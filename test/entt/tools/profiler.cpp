@@ -0,0 +1,182 @@
+#define ENTT_USE_PROFILER
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/executor.hpp>
+#include <entt/entity/organizer.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/view.hpp>
+#include <entt/process/scheduler.hpp>
+#include <entt/tools/profiler.hpp>
+#include "../../common/config.h"
+
+void task(entt::view<entt::get_t<int>> view) {
+    for(auto [entt, value]: view.each()) {
+        ++value;
+    }
+}
+
+void increment(int &value) {
+    ++value;
+}
+
+TEST(Profiler, Functionalities) {
+    entt::profiler profiler{2u};
+
+    ASSERT_EQ(profiler.size(), 0u);
+    ASSERT_EQ(profiler.capacity(), 2u);
+
+    profiler.push("first", 1u, 2u);
+    profiler.push("second", 3u, 5u);
+
+    ASSERT_EQ(profiler.size(), 2u);
+
+    profiler.push("third", 8u, 13u);
+
+    ASSERT_EQ(profiler.size(), 2u);
+
+    std::vector<std::string> name{};
+    profiler.each([&name](const entt::profiler::event_type &elem) { name.emplace_back(elem.name); });
+
+    ASSERT_EQ(name.size(), 2u);
+    ASSERT_EQ(name[0u], "second");
+    ASSERT_EQ(name[1u], "third");
+
+    profiler.push("third", 21u, 1021u);
+
+    ASSERT_FLOAT_EQ(profiler.total("third"), 1.005f);
+    ASSERT_EQ(profiler.total("first"), 0.f);
+
+    profiler.clear();
+
+    ASSERT_EQ(profiler.size(), 0u);
+    ASSERT_EQ(profiler.capacity(), 2u);
+}
+
+TEST(Profiler, Install) {
+    ASSERT_EQ(entt::profiler::current(), nullptr);
+
+    {
+        entt::profiler profiler{};
+        entt::profiler::install(&profiler);
+
+        ASSERT_EQ(entt::profiler::current(), &profiler);
+
+        {
+            const entt::profile_scope scope{"scope"};
+        }
+
+        ASSERT_EQ(profiler.size(), 1u);
+
+        profiler.each([](const entt::profiler::event_type &elem) {
+            ASSERT_EQ(std::string{elem.name}, "scope");
+            ASSERT_LE(elem.begin, elem.end);
+        });
+    }
+
+    ASSERT_EQ(entt::profiler::current(), nullptr);
+
+    {
+        // nothing is recorded without a profiler
+        const entt::profile_scope scope{"scope"};
+    }
+}
+
+TEST(Profiler, ChromeTrace) {
+    entt::profiler profiler{};
+
+    ASSERT_EQ(profiler.chrome_trace(), "{\"traceEvents\":[]}");
+
+    profiler.push("a \"task\"", 1000u, 3500u);
+    profiler.push(nullptr, 123456u, 123457u);
+
+    std::string tid{};
+    profiler.each([&tid](const entt::profiler::event_type &elem) { tid = std::to_string(elem.thread); });
+
+    std::string expected{"{\"traceEvents\":["};
+    expected += "{\"name\":\"a \\\"task\\\"\",\"ph\":\"X\",\"pid\":0,\"tid\":" + tid + ",\"ts\":1.000,\"dur\":2.500},";
+    expected += "{\"name\":\"unknown\",\"ph\":\"X\",\"pid\":0,\"tid\":" + tid + ",\"ts\":123.456,\"dur\":0.001}";
+    expected += "]}";
+
+    ASSERT_EQ(profiler.chrome_trace(), expected);
+}
+
+TEST(Profiler, Threads) {
+    entt::profiler profiler{};
+    entt::profiler::install(&profiler);
+
+    std::thread worker{[]() { const entt::profile_scope scope{"worker"}; }};
+    worker.join();
+
+    {
+        const entt::profile_scope scope{"main"};
+    }
+
+    entt::profiler::install(nullptr);
+
+    std::vector<std::size_t> thread{};
+    profiler.each([&thread](const entt::profiler::event_type &elem) { thread.push_back(elem.thread); });
+
+    ASSERT_EQ(thread.size(), 2u);
+    ASSERT_NE(thread[0u], thread[1u]);
+}
+
+TEST(Profiler, Organizer) {
+    entt::profiler profiler{};
+    entt::organizer organizer{};
+    entt::registry registry{};
+
+    organizer.emplace<&task>("task");
+    organizer.emplace_chunked<&increment>(1u, "chunked");
+    registry.emplace<int>(registry.create());
+    registry.emplace<int>(registry.create());
+
+    entt::profiler::install(&profiler);
+    entt::executor{2u}.run(organizer.graph(), registry);
+    entt::profiler::install(nullptr);
+
+    std::size_t plain{};
+    std::size_t chunked{};
+
+    profiler.each([&](const entt::profiler::event_type &elem) {
+        plain += (std::string{elem.name} == "task");
+        chunked += (std::string{elem.name} == "chunked");
+    });
+
+    ASSERT_EQ(plain, 1u);
+    ASSERT_EQ(chunked, 2u);
+    ASSERT_EQ(registry.get<int>(entt::entity{0}), 2);
+}
+
+TEST(Profiler, Scheduler) {
+    entt::profiler profiler{};
+    entt::scheduler scheduler{};
+    const auto executor = [](const std::size_t count, auto job) {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            job(pos);
+        }
+    };
+
+    scheduler.attach([](entt::process &, std::uint32_t, void *) {});
+
+    entt::profiler::install(&profiler);
+    scheduler.update(0u);
+    scheduler.update(executor, 1u, 0u);
+    entt::profiler::install(nullptr);
+
+    std::vector<std::string> name{};
+    profiler.each([&name](const entt::profiler::event_type &elem) { name.emplace_back(elem.name); });
+
+    ASSERT_EQ(name.size(), 3u);
+    ASSERT_EQ(name[0u], "scheduler::update");
+    ASSERT_EQ(name[1u], "scheduler::job");
+    ASSERT_EQ(name[2u], "scheduler::update");
+}
+
+ENTT_DEBUG_TEST(ProfilerDeathTest, Profiler) {
+    ASSERT_DEATH(entt::profiler{0u}, "");
+}
@@ -0,0 +1,153 @@
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/core/type_info.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/tools/recorder.hpp>
+#include "../../common/pointer_stable.h"
+
+struct position {
+    int x;
+    int y;
+};
+
+struct tag {};
+
+TEST(Recorder, Functionalities) {
+    entt::registry registry;
+    entt::recorder recorder{registry};
+
+    recorder.track<position>();
+    recorder.track<tag>();
+
+    ASSERT_EQ(recorder.size(), 0u);
+
+    const auto entity = registry.create();
+    registry.emplace<position>(entity, 1, 2);
+    registry.patch<position>(entity);
+    registry.emplace<tag>(entity);
+    registry.emplace<int>(entity);
+    recorder.frame();
+    registry.erase<tag>(entity);
+    registry.destroy(entity);
+
+    const auto &trace = recorder.trace();
+    const auto value = static_cast<std::uint64_t>(entt::to_integral(entity));
+
+    ASSERT_EQ(recorder.size(), 8u);
+    ASSERT_EQ(trace.size(), 8u);
+
+    ASSERT_EQ(trace[0u].op, entt::trace_op::create);
+    ASSERT_EQ(trace[0u].entity, value);
+
+    ASSERT_EQ(trace[1u].op, entt::trace_op::emplace);
+    ASSERT_EQ(trace[1u].type, entt::type_hash<position>::value());
+    ASSERT_EQ(trace[1u].entity, value);
+    ASSERT_EQ(trace[1u].size, sizeof(position));
+    ASSERT_FALSE(trace[1u].stable);
+
+    ASSERT_EQ(trace[2u].op, entt::trace_op::patch);
+    ASSERT_EQ(trace[2u].type, entt::type_hash<position>::value());
+
+    ASSERT_EQ(trace[3u].op, entt::trace_op::emplace);
+    ASSERT_EQ(trace[3u].type, entt::type_hash<tag>::value());
+    ASSERT_EQ(trace[3u].size, 0u);
+
+    ASSERT_EQ(trace[4u].op, entt::trace_op::frame);
+
+    ASSERT_EQ(trace[5u].op, entt::trace_op::erase);
+    ASSERT_EQ(trace[5u].type, entt::type_hash<tag>::value());
+
+    ASSERT_EQ(trace[6u].op, entt::trace_op::erase);
+    ASSERT_EQ(trace[6u].type, entt::type_hash<position>::value());
+
+    ASSERT_EQ(trace[7u].op, entt::trace_op::destroy);
+    ASSERT_EQ(trace[7u].entity, value);
+
+    recorder.clear();
+
+    ASSERT_EQ(recorder.size(), 0u);
+}
+
+TEST(Recorder, Named) {
+    using namespace entt::literals;
+
+    entt::registry registry;
+    entt::recorder recorder{registry};
+
+    recorder.track<test::pointer_stable>("stable"_hs);
+
+    const auto entity = registry.create();
+    registry.emplace<test::pointer_stable>(entity);
+    registry.storage<test::pointer_stable>("stable"_hs).emplace(entity);
+
+    ASSERT_EQ(recorder.size(), 2u);
+    ASSERT_EQ(recorder.trace()[1u].op, entt::trace_op::emplace);
+    ASSERT_EQ(recorder.trace()[1u].type, "stable"_hs);
+    ASSERT_TRUE(recorder.trace()[1u].stable);
+}
+
+TEST(Recorder, Disconnect) {
+    entt::registry registry;
+
+    {
+        entt::recorder recorder{registry};
+        recorder.track<position>();
+    }
+
+    ASSERT_TRUE(registry.on_construct<entt::entity>().empty());
+    ASSERT_TRUE(registry.on_construct<position>().empty());
+    ASSERT_TRUE(registry.on_update<position>().empty());
+    ASSERT_TRUE(registry.on_destroy<position>().empty());
+}
+
+TEST(Recorder, ReadWrite) {
+    entt::registry registry;
+    entt::recorder recorder{registry};
+    std::vector<entt::trace_event> trace{};
+    std::stringstream buffer{};
+
+    recorder.track<position>();
+
+    for(int pos{}; pos < 4; ++pos) {
+        registry.emplace<position>(registry.create(), pos, pos);
+        recorder.frame();
+    }
+
+    registry.destroy(registry.view<position>().front());
+    recorder.write(buffer);
+
+    ASSERT_TRUE(entt::read_trace(buffer, trace));
+    ASSERT_EQ(trace.size(), recorder.size());
+
+    for(std::size_t pos{}; pos < trace.size(); ++pos) {
+        ASSERT_EQ(trace[pos].op, recorder.trace()[pos].op);
+        ASSERT_EQ(trace[pos].stable, recorder.trace()[pos].stable);
+        ASSERT_EQ(trace[pos].type, recorder.trace()[pos].type);
+        ASSERT_EQ(trace[pos].entity, recorder.trace()[pos].entity);
+        ASSERT_EQ(trace[pos].size, recorder.trace()[pos].size);
+    }
+}
+
+TEST(Recorder, InvalidTrace) {
+    std::vector<entt::trace_event> trace{};
+    std::stringstream buffer{};
+
+    ASSERT_FALSE(entt::read_trace(buffer, trace));
+
+    buffer.clear();
+    buffer.str("not a trace at all");
+
+    ASSERT_FALSE(entt::read_trace(buffer, trace));
+
+    std::stringstream truncated{};
+    entt::write_trace(truncated, std::vector<entt::trace_event>(2u));
+    const auto data = truncated.str();
+    truncated.str(data.substr(0u, data.size() - 1u));
+
+    ASSERT_FALSE(entt::read_trace(truncated, trace));
+}
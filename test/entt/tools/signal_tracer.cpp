@@ -0,0 +1,144 @@
+#define ENTT_USE_SIGNAL_TRACER
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/type_info.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <entt/signal/emitter.hpp>
+#include <entt/signal/sigh.hpp>
+#include <entt/tools/signal_tracer.hpp>
+#include "../../common/boxed_type.h"
+#include "../../common/emitter.h"
+#include "../../common/empty.h"
+
+struct report {
+    const entt::type_info *info;
+    std::size_t listeners;
+    std::uint64_t duration;
+};
+
+struct recording_tracer final: entt::signal_tracer {
+    void trace(const entt::type_info &info, const std::size_t listeners, const std::uint64_t duration) noexcept override {
+        reports.push_back(report{&info, listeners, duration});
+    }
+
+    std::vector<report> reports{};
+};
+
+void listener(int &value) {
+    ++value;
+}
+
+void receive(int &value, const test::boxed_int &) {
+    ++value;
+}
+
+TEST(SignalTracer, Install) {
+    ASSERT_EQ(entt::signal_tracer::current(), nullptr);
+
+    {
+        recording_tracer tracer{};
+        entt::signal_tracer::install(&tracer);
+
+        ASSERT_EQ(entt::signal_tracer::current(), &tracer);
+
+        {
+            const entt::signal_scope scope{entt::type_id<int>(), 3u};
+        }
+
+        ASSERT_EQ(tracer.reports.size(), 1u);
+        ASSERT_EQ(*tracer.reports[0u].info, entt::type_id<int>());
+        ASSERT_EQ(tracer.reports[0u].listeners, 3u);
+    }
+
+    ASSERT_EQ(entt::signal_tracer::current(), nullptr);
+
+    {
+        // nothing is reported without a tracer
+        const entt::signal_scope scope{entt::type_id<int>(), 3u};
+    }
+}
+
+TEST(SignalTracer, Sigh) {
+    recording_tracer tracer{};
+    entt::sigh<void(int &)> sigh{};
+    entt::sink sink{sigh};
+    int value{};
+
+    sink.connect<&listener>();
+    entt::signal_tracer::install(&tracer);
+    sigh.publish(value);
+    sigh.collect([]() {}, value);
+    entt::signal_tracer::install(nullptr);
+    sigh.publish(value);
+
+    ASSERT_EQ(value, 3);
+    ASSERT_EQ(tracer.reports.size(), 2u);
+
+    for(auto &&elem: tracer.reports) {
+        ASSERT_EQ(*elem.info, (entt::type_id<void(int &)>()));
+        ASSERT_EQ(elem.listeners, 1u);
+    }
+}
+
+TEST(SignalTracer, Dispatcher) {
+    recording_tracer tracer{};
+    entt::dispatcher dispatcher{};
+    int value{};
+
+    dispatcher.sink<test::boxed_int>().connect<&receive>(value);
+    dispatcher.enqueue<test::boxed_int>(1);
+    dispatcher.enqueue<test::boxed_int>(2);
+    dispatcher.enqueue<test::empty>();
+
+    entt::signal_tracer::install(&tracer);
+    dispatcher.update();
+    entt::signal_tracer::install(nullptr);
+
+    ASSERT_EQ(value, 2);
+
+    std::size_t queues{};
+    std::size_t signals{};
+
+    for(auto &&elem: tracer.reports) {
+        if(*elem.info == entt::type_id<test::boxed_int>()) {
+            ASSERT_EQ(elem.listeners, 1u);
+            ++queues;
+        } else if(*elem.info == entt::type_id<test::empty>()) {
+            ASSERT_EQ(elem.listeners, 0u);
+            ++queues;
+        } else {
+            ASSERT_EQ(*elem.info, (entt::type_id<void(test::boxed_int &)>()));
+            ++signals;
+        }
+    }
+
+    ASSERT_EQ(queues, 2u);
+    ASSERT_EQ(signals, 2u);
+}
+
+TEST(SignalTracer, Emitter) {
+    recording_tracer tracer{};
+    test::emitter emitter{};
+    entt::emitter_context context{};
+    test::pooled_emitter pooled{context};
+
+    emitter.on<test::boxed_int>([](auto &, const auto &) {});
+    pooled.on<test::boxed_int>([](auto &, const auto &) {});
+
+    entt::signal_tracer::install(&tracer);
+    emitter.publish(test::boxed_int{1});
+    emitter.publish(test::empty{});
+    pooled.publish(test::boxed_int{1});
+    pooled.publish(test::empty{});
+    entt::signal_tracer::install(nullptr);
+
+    ASSERT_EQ(tracer.reports.size(), 2u);
+
+    for(auto &&elem: tracer.reports) {
+        ASSERT_EQ(*elem.info, entt::type_id<test::boxed_int>());
+        ASSERT_EQ(elem.listeners, 1u);
+    }
+}